@@ -0,0 +1,205 @@
+/*
+ * Schism Tracker - a cross-platform Impulse Tracker clone
+ * copyright (c) 2003-2005 Storlek <storlek@rigelseven.com>
+ * copyright (c) 2005-2008 Mrs. Brisby <mrs.brisby@nimh.org>
+ * copyright (c) 2009 Storlek & Mrs. Brisby
+ * copyright (c) 2010-2012 Storlek
+ * URL: http://schismtracker.org/
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "headers.h"
+#include "fmt.h"
+
+/* --------------------------------------------------------------------- */
+
+/* Every format listed here has some magic that its own checks refuse to
+do without, so when it isn't in the header, there's no point in running
+them. Anything that isn't listed (MOD, STM, MP3, ...) is always tried.
+
+The magic has to be something the read_info AND the loader both require;
+if one of them is more lenient than the other, only list what both check. */
+
+struct fmt_magic {
+	uint32_t offset;
+	uint32_t length;
+	const char *data;
+};
+
+struct fmt_signature {
+	fmt_read_info_func read_info;
+	fmt_load_song_func load_song; /* NULL if it's not a song format */
+
+	/* all of these have to be there */
+	struct fmt_magic magic[2];
+
+	/* for whatever can't be described by the above */
+	int (*check)(const fmt_detect_t *det);
+};
+
+#define MAGIC(off, str) {(off), sizeof(str) - 1, (str)}
+
+static int detect_magic(const fmt_detect_t *det, const struct fmt_magic *magic)
+{
+	return (magic->offset + magic->length <= det->length)
+		&& !memcmp(det->header + magic->offset, magic->data, magic->length);
+}
+
+static int detect_669(const fmt_detect_t *det)
+{
+	static const struct fmt_magic if_ = MAGIC(0, "if"), jn = MAGIC(0, "JN");
+
+	return detect_magic(det, &if_) || detect_magic(det, &jn);
+}
+
+static int detect_stx(const fmt_detect_t *det)
+{
+	int i;
+
+	if (det->length < 28)
+		return 0;
+
+	for (i = 20; i < 28; i++)
+		if (det->header[i] < 0x20 || det->header[i] > 0x7E)
+			return 0;
+
+	return 1;
+}
+
+static int detect_mid(const fmt_detect_t *det)
+{
+	/* RIFF MIDI has the real header at 20 */
+	static const struct fmt_magic mthd = MAGIC(0, "MThd"), riff = MAGIC(0, "RIFF"), rmid = MAGIC(20, "MThd");
+
+	return detect_magic(det, &mthd) || (detect_magic(det, &riff) && detect_magic(det, &rmid));
+}
+
+static int detect_sfx(const fmt_detect_t *det)
+{
+	static const struct fmt_magic tags[] = {MAGIC(124, "SO31"), MAGIC(124, "SONG"), MAGIC(60, "SONG")};
+	size_t i;
+
+	for (i = 0; i < ARRAY_SIZE(tags); i++)
+		if (detect_magic(det, &tags[i]))
+			return 1;
+
+	return 0;
+}
+
+static int detect_s3i(const fmt_detect_t *det)
+{
+	static const struct fmt_magic scrs = MAGIC(0x4C, "SCRS"), scri = MAGIC(0x4C, "SCRI");
+
+	return detect_magic(det, &scrs) || detect_magic(det, &scri);
+}
+
+static const struct fmt_signature signatures[] = {
+	{fmt_669_read_info, fmt_669_load_song, {{0}}, detect_669},
+	{fmt_s3m_read_info, fmt_s3m_load_song, {MAGIC(44, "SCRM")}, NULL},
+	{fmt_far_read_info, fmt_far_load_song, {MAGIC(0, "FAR\xfe"), MAGIC(44, "\x0d\x0a\x1a")}, NULL},
+	{fmt_xm_read_info, fmt_xm_load_song, {MAGIC(0, "Extended Module: "), MAGIC(37, "\x1a")}, NULL},
+	{fmt_it_read_info, fmt_it_load_song, {MAGIC(0, "IMPM")}, NULL},
+	{fmt_mt2_read_info, NULL, {MAGIC(0, "MT20")}, NULL},
+	{fmt_mtm_read_info, fmt_mtm_load_song, {MAGIC(0, "MTM")}, NULL},
+	{fmt_ntk_read_info, NULL, {MAGIC(0, "TWNNSNG2")}, NULL},
+	{fmt_mdl_read_info, fmt_mdl_load_song, {MAGIC(0, "DMDL")}, NULL},
+	{fmt_med_read_info, NULL, {MAGIC(0, "MMD0")}, NULL},
+	{fmt_okt_read_info, fmt_okt_load_song, {MAGIC(0, "OKTASONG")}, NULL},
+	{fmt_mid_read_info, fmt_mid_load_song, {{0}}, detect_mid},
+	{fmt_mus_read_info, fmt_mus_load_song, {MAGIC(0, "MUS\x1a")}, NULL},
+	{fmt_mf_read_info, NULL, {MAGIC(0, "MOONFISH")}, NULL},
+	{fmt_psm_read_info, fmt_psm_load_song, {MAGIC(0, "PSM "), MAGIC(8, "FILE")}, NULL},
+	{fmt_psm16_read_info, fmt_psm16_load_song, {MAGIC(0, "PSM\xfe"), MAGIC(63, "\x1a")}, NULL},
+	{fmt_dsm_read_info, fmt_dsm_load_song, {MAGIC(0, "RIFF"), MAGIC(8, "DSMF")}, NULL},
+	{fmt_its_read_info, NULL, {MAGIC(0, "IMPS")}, NULL},
+	{fmt_au_read_info, NULL, {MAGIC(0, ".snd")}, NULL},
+	{fmt_aiff_read_info, NULL, {MAGIC(0, "FORM")}, NULL},
+	{fmt_wav_read_info, NULL, {MAGIC(0, "RIFF"), MAGIC(8, "WAVE")}, NULL},
+	{fmt_w64_read_info, NULL, {
+		MAGIC(0, "riff\x2e\x91\xcf\x11\xa5\xd6\x28\xdb\x04\xc1\x00\x00"),
+		MAGIC(24, "wave\xf3\xac\xd3\x11\x8c\xd1\x00\xc0\x4f\x8e\xdb\x8a"),
+	}, NULL},
+	{fmt_sbi_read_info, NULL, {MAGIC(0, "SBI\x1a")}, NULL},
+	{fmt_iti_read_info, NULL, {MAGIC(0, "IMPI")}, NULL},
+	{fmt_xi_read_info, NULL, {MAGIC(0, "Extended Instrument: ")}, NULL},
+	{fmt_pat_read_info, NULL, {MAGIC(0, "GF1PATCH"), MAGIC(12, "ID#000002\0")}, NULL},
+	{fmt_sf2_read_info, NULL, {MAGIC(0, "RIFF"), MAGIC(8, "sfbk")}, NULL},
+	{fmt_ult_read_info, fmt_ult_load_song, {MAGIC(0, "MAS_UTrack_V00")}, NULL},
+	{fmt_liq_read_info, NULL, {MAGIC(0, "Liquid Module:"), MAGIC(64, "\x1a")}, NULL},
+	{fmt_ams_read_info, NULL, {MAGIC(0, "AMShdr\x1a")}, NULL},
+	{fmt_f2r_read_info, NULL, {MAGIC(0, "F2R")}, NULL},
+	{fmt_s3i_read_info, NULL, {{0}}, detect_s3i},
+	{fmt_imf_read_info, fmt_imf_load_song, {MAGIC(60, "IM10")}, NULL},
+	{fmt_sfx_read_info, fmt_sfx_load_song, {{0}}, detect_sfx},
+	{fmt_stx_read_info, fmt_stx_load_song, {MAGIC(60, "SCRM")}, detect_stx},
+};
+
+#undef MAGIC
+
+static int detect_signature(const fmt_detect_t *det, const struct fmt_signature *sig)
+{
+	size_t i;
+
+	for (i = 0; i < ARRAY_SIZE(sig->magic); i++)
+		if (sig->magic[i].data && !detect_magic(det, &sig->magic[i]))
+			return 0;
+
+	return !sig->check || sig->check(det);
+}
+
+/* --------------------------------------------------------------------- */
+
+void fmt_detect_init(fmt_detect_t *det, slurp_t *fp)
+{
+	slurp_rewind(fp);
+	det->length = slurp_peek(fp, det->header, sizeof(det->header));
+}
+
+size_t fmt_detect_read_info_funcs(const fmt_detect_t *det, const fmt_read_info_func *funcs, fmt_read_info_func *out)
+{
+	size_t n = 0, i;
+
+	for (; *funcs; funcs++) {
+		for (i = 0; i < ARRAY_SIZE(signatures); i++)
+			if (signatures[i].read_info == *funcs)
+				break;
+
+		if (i == ARRAY_SIZE(signatures) || detect_signature(det, &signatures[i]))
+			out[n++] = *funcs;
+	}
+
+	out[n] = NULL;
+
+	return n;
+}
+
+size_t fmt_detect_load_song_funcs(const fmt_detect_t *det, const fmt_load_song_func *funcs, fmt_load_song_func *out)
+{
+	size_t n = 0, i;
+
+	for (; *funcs; funcs++) {
+		for (i = 0; i < ARRAY_SIZE(signatures); i++)
+			if (signatures[i].load_song == *funcs)
+				break;
+
+		if (i == ARRAY_SIZE(signatures) || detect_signature(det, &signatures[i]))
+			out[n++] = *funcs;
+	}
+
+	out[n] = NULL;
+
+	return n;
+}
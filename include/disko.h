@@ -24,6 +24,7 @@
 #define SCHISM_DISKO_H_
 
 #include "headers.h"
+#include "atomic.h"
 
 typedef struct disko disko_t;
 struct disko {
@@ -45,8 +46,9 @@ struct disko {
 	// data for memory buffers (no filename/handle)
 	uint8_t *data;
 
-	// First errno value recorded after something went wrong.
-	int error;
+	// First errno value recorded after something went wrong. Atomic, as
+	// the export thread can set it while the main thread is checking it.
+	struct atm error;
 
 	/* untouched by diskwriter; driver may use for anything */
 	void *userdata;
@@ -112,6 +114,17 @@ void song_pattern_to_sample(int pattern, int split, int bind);
 struct save_format;
 int disko_export_song(const char *filename, const struct save_format *format);
 
+/* render a song to a file in one go, without touching the global export
+state (so this is safe to call from several threads, with a different song in
+each). with threads set, the encoding is handed to other threads, like
+disko_export_song does: one for a single file, or that many for multi-write
+formats (in which case filename has a %c for the channel number). the song is
+left at its end. pframes, if not NULL, receives the number of frames written.
+returns DW_OK or DW_ERROR (and sets errno). */
+struct song;
+int disko_render_song(struct song *csf, const char *filename, const struct save_format *format,
+	uint32_t threads, uint64_t *pframes);
+
 /* call periodically if (status.flags & DISKWRITER_ACTIVE) to write more stuff.
 return: DW_SYNC_*, self explanatory */
 int disko_sync(void);
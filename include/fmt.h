@@ -97,6 +97,23 @@ typedef int (*fmt_export_tail_func)     PROTO_EXPORT_TAIL;
 
 #include "fmt-types.h"
 
+/* --------------------------------------------------------------------------------------------------------- */
+/* detect.c: a quick look at the start of the file, to skip the formats that it can't possibly be */
+
+#define FMT_DETECT_WINDOW 256
+
+typedef struct fmt_detect {
+	unsigned char header[FMT_DETECT_WINDOW];
+	size_t length; /* may be less, for short files */
+} fmt_detect_t;
+
+void fmt_detect_init(fmt_detect_t *det, slurp_t *fp);
+
+/* these copy the functions from the NULL-terminated 'funcs' that are worth trying into 'out', which has to
+be as big as 'funcs' (including the NULL), keeping them in the same order. return value is how many there are. */
+size_t fmt_detect_read_info_funcs(const fmt_detect_t *det, const fmt_read_info_func *funcs, fmt_read_info_func *out);
+size_t fmt_detect_load_song_funcs(const fmt_detect_t *det, const fmt_load_song_func *funcs, fmt_load_song_func *out);
+
 /* --------------------------------------------------------------------------------------------------------- */
 
 struct save_format {
@@ -541,6 +541,14 @@ struct stat {
 # define SCHISM_FORCE_ALIGN_ARG_POINTER
 #endif
 
+/* Aligns a struct to 'x' bytes. Anything allocated on the heap with this
+ * has to be aligned by hand, since malloc won't do it. */
+#if SCHISM_GNUC_HAS_ATTRIBUTE(__aligned__, 2, 95, 0)
+# define SCHISM_ALIGNED(x) __attribute__((__aligned__(x)))
+#else
+# define SCHISM_ALIGNED(x)
+#endif
+
 /* Used for ignoring certain functions who, for some reason or
  * another, have memory leaks outside of our control. */
 #if SCHISM_GNUC_HAS_ATTRIBUTE(__no_sanitize__, 8, 0, 0)
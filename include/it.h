@@ -330,6 +330,8 @@ void vis_work_16s(const int16_t *in, size_t inlen);
 void vis_work_16m(const int16_t *in, size_t inlen);
 void vis_work_8s(const int8_t *in, size_t inlen);
 void vis_work_8m(const int8_t *in, size_t inlen);
+void vis_work_f32s(const float *in, size_t inlen);
+void vis_work_f32m(const float *in, size_t inlen);
 
 // "unsigned char out[width]" ...
 void fft_get_columns(uint32_t width, unsigned char *out, uint32_t chan);
@@ -140,6 +140,10 @@ void midi_send_flush(void);
 /* used by the audio thread */
 int midi_need_flush(void);
 
+/* number of player events that didn't fit in the output queue, and
+ * that were sent more than a millisecond after they were due */
+void midi_get_output_stats(uint32_t *dropped, uint32_t *late);
+
 /* from Schism event handler */
 union schism_event;
 int midi_engine_handle_event(union schism_event *ev);
@@ -10,16 +10,20 @@
 #define MIXING_CLIPMAX          (0x03FFFFFF)
 #define VOLUMERAMPPRECISION     12
 #define FILTERPRECISION         ((sizeof(int32_t) * 8) - 8) /* faithfully stolen from openmpt */
+/* scale of the float mix bus; full scale of the integer mixer is 1.0 */
+#define MIXING_FLOAT_SCALE      (1.0f / (float)(1L << (31 - MIXING_ATTENUATION)))
 
 void init_mix_buffer(int32_t *, uint32_t);
 void stereo_fill(int32_t *, uint32_t, int32_t *, int32_t *);
 void end_channel_ofs(song_voice_t *, int32_t *, uint32_t);
 void interleave_front_rear(int32_t *, int32_t *, uint32_t);
 void mono_from_stereo(int32_t *, uint32_t);
+void mix_buffer_to_float(float *, const int32_t *, uint32_t);
 
 uint32_t csf_create_stereo_mix(song_t *csf, uint32_t count);
 
-void setup_channel_filter(song_voice_t *pChn, int32_t reset, int32_t flt_modifier, int32_t freq);
+void initialize_filter_cache(song_t *csf);
+void setup_channel_filter(song_t *csf, song_voice_t *pChn, int32_t reset, int32_t flt_modifier);
 
 
 //typedef unsigned int (*convert_clip_t)(void *, int *, unsigned int, int*, int*) __attribute__((cdecl))
@@ -28,16 +32,49 @@ uint32_t clip_32_to_8(void *, int32_t *, uint32_t, int32_t *, int32_t *);
 uint32_t clip_32_to_16(void *, int32_t *, uint32_t, int32_t *, int32_t *);
 uint32_t clip_32_to_24(void *, int32_t *, uint32_t, int32_t *, int32_t *);
 uint32_t clip_32_to_32(void *, int32_t *, uint32_t, int32_t *, int32_t *);
+uint32_t clip_float_to_float(void *, float *, uint32_t, int32_t *, int32_t *);
 
 
 void normalize_mono(song_t *, int32_t *, uint32_t);
 void normalize_stereo(song_t *, int32_t *, uint32_t);
 void eq_mono(song_t *, int32_t *, uint32_t);
 void eq_stereo(song_t *, int32_t *, uint32_t);
-void initialize_eq(int32_t, float);
-void set_eq_gains(const uint32_t *, uint32_t, const uint32_t *, int32_t, int32_t);
+void normalize_mono_float(song_t *, float *, uint32_t);
+void normalize_stereo_float(song_t *, float *, uint32_t);
+void eq_mono_float(song_t *, float *, uint32_t);
+void eq_stereo_float(song_t *, float *, uint32_t);
+void initialize_eq(song_t *, int32_t, float);
+void set_eq_gains(song_t *, const uint32_t *, uint32_t, const uint32_t *, int32_t, int32_t);
 
 // mixer.c
+enum {
+	MIX_ISA_C,
+	MIX_ISA_SSE2,
+	MIX_ISA_AVX2,
+};
+
+/* number of mix kernels in each set; the index has the same layout as in
+ * mix_voice (format, ramp, filter, then the interpolation in b6-b4) */
+#define MIX_KERNEL_COUNT (2 * 2 * 24)
+
+/* runs one mix kernel from the given set over [pbuffer, pbufmax), exactly
+ * as mix_voice would; returns zero if the CPU doesn't have that set */
+int csf_mix_kernel(int isa, uint32_t index, song_voice_t *voice, int32_t *pbuffer, int32_t *pbufmax);
+
+typedef struct stream_resampler {
+	struct song_smp_pos increment;  // input frames per output frame
+	struct song_smp_pos position;   // of the next output frame in 'buffer'
+	int32_t *buffer;                // stereo input frames, oldest first
+	uint32_t length, alloc;         // in frames
+} stream_resampler_t;
+
+void stream_resampler_init(stream_resampler_t *rs, uint32_t in_rate, uint32_t out_rate);
+void stream_resampler_free(stream_resampler_t *rs);
+/* returns where to put the *frames (zeroed) input frames needed for 'count' output frames */
+int32_t *stream_resampler_get_input(stream_resampler_t *rs, uint32_t count, uint32_t *frames);
+/* adds 'count' frames to 'out', which can be NULL to just move ahead */
+void stream_resampler_mix(stream_resampler_t *rs, int32_t *out, uint32_t count);
+
 void ResampleMono8BitFirFilter(int8_t *oldbuf, int8_t *newbuf, uint32_t oldlen, uint32_t newlen);
 void ResampleMono16BitFirFilter(int16_t *oldbuf, int16_t *newbuf, uint32_t oldlen, uint32_t newlen);
 void ResampleStereo8BitFirFilter(int8_t *oldbuf, int8_t *newbuf, uint32_t oldlen, uint32_t newlen);
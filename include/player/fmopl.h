@@ -23,6 +23,11 @@ typedef void (*OPL_UPDATEHANDLER)(void *param,int min_interval_us);
 typedef void (*OPL_PORTHANDLER_W)(void *param,unsigned char data);
 typedef unsigned char (*OPL_PORTHANDLER_R)(void *param);
 
+/* held around setting up and closing the lookup tables that all chips
+ * share (see Fmdrv_InitLock) */
+void opl_lock_tables(void);
+void opl_unlock_tables(void);
+
 /* OPL2 */
 void *ym3812_init(uint32_t clock, uint32_t rate);
 void ym3812_shutdown(void *chip);
@@ -325,3 +325,1551 @@ static int16_t windowed_fir_lut[16392] = {
  -48, 55, -727, 2306, 29549, 2306, -727, 55,
 };
 
+static int16_t SCHISM_ALIGNED(64) sinc_lut[32784] = {
+ 58, -202, 486, -929, 1485, -2045, 2464, 30134, 2464, -2045, 1485, -929, 486, -202, 58, 0, 58, -202, 486, -928, 1483, -2039, 2450, 30137, 2480, -2051, 1488, -930, 487, -202, 58, -7, 58, -201, 486, -927, 1480, -2033, 2435, 30137, 2494, -2057, 1491, -931, 487, -202, 58, -7, 58, -201, 485, -926, 1477, -2027, 2420, 30138, 2509, -2063, 1493, -932, 488, -202, 58, -7,
+ 58, -201, 485, -924, 1474, -2021, 2405, 30138, 2524, -2069, 1496, -934, 488, -202, 58, -7, 58, -201, 484, -923, 1472, -2015, 2390, 30138, 2539, -2075, 1499, -935, 488, -202, 58, -7, 58, -201, 484, -922, 1469, -2009, 2376, 30137, 2554, -2081, 1501, -936, 489, -202, 58, -7, 58, -201, 483, -921, 1466, -2004, 2361, 30139, 2569, -2087, 1504, -937, 489, -203, 59, -7,
+ 58, -201, 483, -920, 1464, -1998, 2346, 30137, 2584, -2093, 1507, -938, 490, -203, 59, -7, 58, -201, 483, -919, 1461, -1992, 2331, 30137, 2599, -2099, 1510, -939, 490, -203, 59, -7, 58, -200, 482, -917, 1458, -1986, 2317, 30136, 2614, -2105, 1512, -941, 491, -203, 59, -7, 58, -200, 482, -916, 1455, -1980, 2302, 30136, 2629, -2111, 1515, -942, 491, -203, 59, -7,
+ 58, -200, 481, -915, 1453, -1974, 2287, 30136, 2644, -2117, 1518, -943, 491, -203, 59, -7, 58, -200, 481, -914, 1450, -1968, 2272, 30136, 2659, -2123, 1520, -944, 492, -203, 59, -7, 58, -200, 480, -913, 1447, -1962, 2258, 30136, 2674, -2129, 1523, -945, 492, -203, 59, -7, 58, -200, 480, -912, 1444, -1956, 2243, 30135, 2689, -2135, 1526, -946, 493, -203, 59, -7,
+ 58, -200, 480, -910, 1442, -1950, 2228, 30135, 2704, -2141, 1528, -947, 493, -204, 59, -7, 58, -200, 479, -909, 1439, -1944, 2213, 30135, 2719, -2146, 1531, -948, 493, -204, 59, -7, 58, -199, 479, -908, 1436, -1938, 2199, 30133, 2734, -2152, 1534, -950, 494, -204, 59, -7, 58, -199, 478, -907, 1434, -1932, 2184, 30134, 2749, -2158, 1536, -951, 494, -204, 59, -7,
+ 58, -199, 478, -906, 1431, -1926, 2169, 30133, 2764, -2164, 1539, -952, 495, -204, 59, -7, 58, -199, 477, -905, 1428, -1920, 2155, 30133, 2779, -2170, 1542, -953, 495, -204, 59, -7, 58, -199, 477, -903, 1425, -1914, 2140, 30131, 2795, -2176, 1545, -954, 495, -204, 59, -7, 58, -199, 476, -902, 1423, -1908, 2126, 30130, 2810, -2182, 1547, -955, 496, -204, 59, -7,
+ 58, -199, 476, -901, 1420, -1902, 2111, 30131, 2825, -2188, 1550, -956, 496, -205, 59, -7, 58, -199, 476, -900, 1417, -1896, 2096, 30131, 2840, -2194, 1553, -958, 497, -205, 59, -7, 58, -198, 475, -899, 1414, -1890, 2082, 30131, 2855, -2200, 1555, -959, 497, -205, 59, -7, 58, -198, 475, -897, 1412, -1884, 2067, 30129, 2870, -2206, 1558, -960, 497, -205, 59, -7,
+ 58, -198, 474, -896, 1409, -1878, 2053, 30128, 2885, -2212, 1561, -961, 498, -205, 59, -7, 58, -198, 474, -895, 1406, -1872, 2038, 30128, 2901, -2218, 1563, -962, 498, -205, 59, -7, 58, -198, 473, -894, 1403, -1867, 2023, 30129, 2916, -2224, 1566, -963, 499, -205, 59, -7, 57, -198, 473, -893, 1401, -1861, 2009, 30128, 2931, -2230, 1569, -964, 499, -205, 59, -7,
+ 57, -198, 473, -891, 1398, -1855, 1994, 30128, 2946, -2236, 1571, -965, 499, -205, 59, -7, 57, -198, 472, -890, 1395, -1849, 1980, 30128, 2961, -2242, 1574, -966, 500, -206, 59, -7, 57, -197, 472, -889, 1392, -1843, 1965, 30127, 2977, -2248, 1577, -968, 500, -206, 59, -7, 57, -197, 471, -888, 1390, -1837, 1951, 30126, 2992, -2254, 1579, -969, 501, -206, 59, -7,
+ 57, -197, 471, -887, 1387, -1831, 1936, 30126, 3007, -2260, 1582, -970, 501, -206, 59, -7, 57, -197, 470, -886, 1384, -1825, 1922, 30125, 3022, -2265, 1585, -971, 501, -206, 59, -7, 57, -197, 470, -884, 1381, -1819, 1908, 30122, 3038, -2271, 1587, -972, 502, -206, 59, -7, 57, -197, 469, -883, 1379, -1813, 1893, 30122, 3053, -2277, 1590, -973, 502, -206, 59, -7,
+ 57, -197, 469, -882, 1376, -1807, 1879, 30121, 3068, -2283, 1592, -974, 503, -206, 59, -7, 57, -196, 469, -881, 1373, -1801, 1864, 30119, 3084, -2289, 1595, -975, 503, -206, 59, -7, 57, -196, 468, -880, 1370, -1795, 1850, 30119, 3099, -2295, 1598, -976, 503, -206, 59, -7, 57, -196, 468, -878, 1368, -1789, 1835, 30119, 3114, -2301, 1600, -978, 504, -207, 59, -7,
+ 57, -196, 467, -877, 1365, -1783, 1821, 30118, 3130, -2307, 1603, -979, 504, -207, 59, -7, 57, -196, 467, -876, 1362, -1777, 1807, 30116, 3145, -2313, 1606, -980, 505, -207, 59, -7, 57, -196, 466, -875, 1359, -1771, 1792, 30118, 3160, -2319, 1608, -981, 505, -207, 59, -7, 57, -196, 466, -874, 1356, -1765, 1778, 30116, 3176, -2325, 1611, -982, 505, -207, 59, -7,
+ 57, -196, 465, -872, 1354, -1759, 1764, 30113, 3191, -2331, 1614, -983, 506, -207, 59, -7, 57, -195, 465, -871, 1351, -1753, 1749, 30113, 3206, -2337, 1616, -984, 506, -207, 59, -7, 57, -195, 464, -870, 1348, -1747, 1735, 30112, 3222, -2343, 1619, -985, 506, -207, 59, -7, 57, -195, 464, -869, 1345, -1741, 1721, 30109, 3237, -2349, 1622, -986, 507, -207, 60, -7,
+ 57, -195, 464, -867, 1343, -1736, 1706, 30109, 3253, -2355, 1624, -987, 507, -208, 60, -7, 57, -195, 463, -866, 1340, -1730, 1692, 30108, 3268, -2361, 1627, -988, 508, -208, 60, -7, 57, -195, 463, -865, 1337, -1724, 1678, 30108, 3283, -2366, 1629, -990, 508, -208, 60, -7, 57, -195, 462, -864, 1334, -1718, 1664, 30107, 3299, -2372, 1632, -991, 508, -208, 60, -7,
+ 57, -194, 462, -863, 1332, -1712, 1649, 30104, 3314, -2378, 1635, -992, 509, -208, 60, -7, 57, -194, 461, -861, 1329, -1706, 1635, 30103, 3330, -2384, 1637, -993, 509, -208, 60, -7, 57, -194, 461, -860, 1326, -1700, 1621, 30101, 3345, -2390, 1640, -994, 510, -208, 60, -7, 57, -194, 460, -859, 1323, -1694, 1607, 30100, 3361, -2396, 1643, -995, 510, -208, 60, -7,
+ 57, -194, 460, -858, 1320, -1688, 1592, 30101, 3376, -2402, 1645, -996, 510, -208, 60, -7, 57, -194, 459, -857, 1318, -1682, 1578, 30098, 3392, -2408, 1648, -997, 511, -208, 60, -7, 57, -194, 459, -855, 1315, -1676, 1564, 30098, 3407, -2414, 1650, -998, 511, -209, 60, -7, 56, -193, 458, -854, 1312, -1670, 1550, 30097, 3423, -2420, 1653, -999, 511, -209, 60, -7,
+ 56, -193, 458, -853, 1309, -1664, 1536, 30095, 3438, -2426, 1656, -1000, 512, -209, 60, -7, 56, -193, 458, -852, 1307, -1658, 1522, 30093, 3454, -2432, 1658, -1001, 512, -209, 60, -7, 56, -193, 457, -850, 1304, -1652, 1507, 30093, 3470, -2438, 1661, -1003, 512, -209, 60, -7, 56, -193, 457, -849, 1301, -1646, 1493, 30092, 3485, -2444, 1663, -1004, 513, -209, 60, -7,
+ 56, -193, 456, -848, 1298, -1640, 1479, 30090, 3501, -2449, 1666, -1005, 513, -209, 60, -7, 56, -193, 456, -847, 1295, -1635, 1465, 30089, 3516, -2455, 1669, -1006, 514, -209, 60, -7, 56, -192, 455, -845, 1293, -1629, 1451, 30086, 3532, -2461, 1671, -1007, 514, -209, 60, -7, 56, -192, 455, -844, 1290, -1623, 1437, 30084, 3548, -2467, 1674, -1008, 514, -209, 60, -7,
+ 56, -192, 454, -843, 1287, -1617, 1423, 30084, 3563, -2473, 1676, -1009, 515, -209, 60, -7, 56, -192, 454, -842, 1284, -1611, 1409, 30083, 3579, -2479, 1679, -1010, 515, -210, 60, -7, 56, -192, 453, -841, 1281, -1605, 1395, 30083, 3594, -2485, 1682, -1011, 515, -210, 60, -7, 56, -192, 453, -839, 1279, -1599, 1381, 30079, 3610, -2491, 1684, -1012, 516, -210, 60, -7,
+ 56, -192, 452, -838, 1276, -1593, 1367, 30078, 3626, -2497, 1687, -1013, 516, -210, 60, -7, 56, -191, 452, -837, 1273, -1587, 1353, 30076, 3641, -2503, 1689, -1014, 517, -210, 60, -7, 56, -191, 451, -836, 1270, -1581, 1339, 30075, 3657, -2509, 1692, -1015, 517, -210, 60, -7, 56, -191, 451, -834, 1267, -1575, 1325, 30072, 3673, -2515, 1695, -1016, 517, -210, 60, -7,
+ 56, -191, 451, -833, 1265, -1569, 1311, 30069, 3688, -2520, 1697, -1017, 518, -210, 60, -7, 56, -191, 450, -832, 1262, -1563, 1297, 30068, 3704, -2526, 1700, -1018, 518, -210, 60, -7, 56, -191, 450, -831, 1259, -1557, 1283, 30067, 3720, -2532, 1702, -1019, 518, -210, 60, -7, 56, -191, 449, -829, 1256, -1551, 1269, 30064, 3736, -2538, 1705, -1020, 519, -210, 60, -7,
+ 56, -190, 449, -828, 1253, -1546, 1255, 30066, 3751, -2544, 1707, -1022, 519, -211, 60, -7, 56, -190, 448, -827, 1251, -1540, 1241, 30064, 3767, -2550, 1710, -1023, 519, -211, 60, -7, 56, -190, 448, -826, 1248, -1534, 1227, 30061, 3783, -2556, 1713, -1024, 520, -211, 60, -7, 56, -190, 447, -824, 1245, -1528, 1213, 30060, 3799, -2562, 1715, -1025, 520, -211, 60, -7,
+ 56, -190, 447, -823, 1242, -1522, 1200, 30058, 3814, -2568, 1718, -1026, 520, -211, 60, -7, 56, -190, 446, -822, 1239, -1516, 1186, 30057, 3830, -2574, 1720, -1027, 521, -211, 60, -7, 56, -190, 446, -821, 1237, -1510, 1172, 30053, 3846, -2579, 1723, -1028, 521, -211, 60, -7, 56, -189, 445, -819, 1234, -1504, 1158, 30051, 3862, -2585, 1725, -1029, 521, -211, 60, -7,
+ 55, -189, 445, -818, 1231, -1498, 1144, 30049, 3878, -2591, 1728, -1030, 522, -211, 60, -7, 55, -189, 444, -817, 1228, -1492, 1130, 30050, 3893, -2597, 1730, -1031, 522, -211, 60, -7, 55, -189, 444, -816, 1225, -1486, 1117, 30046, 3909, -2603, 1733, -1032, 523, -211, 60, -7, 55, -189, 443, -814, 1223, -1480, 1103, 30044, 3925, -2609, 1736, -1033, 523, -212, 60, -7,
+ 55, -189, 443, -813, 1220, -1474, 1089, 30043, 3941, -2615, 1738, -1034, 523, -212, 60, -7, 55, -188, 442, -812, 1217, -1469, 1075, 30041, 3957, -2621, 1741, -1035, 524, -212, 60, -7, 55, -188, 442, -811, 1214, -1463, 1061, 30041, 3973, -2627, 1743, -1036, 524, -212, 60, -8, 55, -188, 441, -809, 1211, -1457, 1048, 30038, 3989, -2633, 1746, -1037, 524, -212, 60, -8,
+ 55, -188, 441, -808, 1208, -1451, 1034, 30035, 4005, -2638, 1748, -1038, 525, -212, 60, -8, 55, -188, 440, -807, 1206, -1445, 1020, 30034, 4020, -2644, 1751, -1039, 525, -212, 60, -8, 55, -188, 440, -806, 1203, -1439, 1007, 30032, 4036, -2650, 1753, -1040, 525, -212, 60, -8, 55, -188, 439, -804, 1200, -1433, 993, 30029, 4052, -2656, 1756, -1041, 526, -212, 60, -8,
+ 55, -187, 439, -803, 1197, -1427, 979, 30027, 4068, -2662, 1758, -1042, 526, -212, 60, -8, 55, -187, 438, -802, 1194, -1421, 966, 30025, 4084, -2668, 1761, -1043, 526, -212, 60, -8, 55, -187, 438, -801, 1192, -1415, 952, 30022, 4100, -2674, 1763, -1044, 527, -212, 60, -8, 55, -187, 438, -799, 1189, -1409, 938, 30020, 4116, -2680, 1766, -1045, 527, -213, 60, -8,
+ 55, -187, 437, -798, 1186, -1404, 925, 30018, 4132, -2685, 1769, -1046, 527, -213, 60, -8, 55, -187, 437, -797, 1183, -1398, 911, 30016, 4148, -2691, 1771, -1047, 528, -213, 60, -8, 55, -186, 436, -796, 1180, -1392, 897, 30014, 4164, -2697, 1774, -1048, 528, -213, 60, -8, 55, -186, 436, -794, 1177, -1386, 884, 30011, 4180, -2703, 1776, -1049, 528, -213, 60, -8,
+ 55, -186, 435, -793, 1175, -1380, 870, 30008, 4196, -2709, 1779, -1050, 529, -213, 60, -8, 55, -186, 435, -792, 1172, -1374, 857, 30006, 4212, -2715, 1781, -1051, 529, -213, 60, -8, 55, -186, 434, -791, 1169, -1368, 843, 30005, 4228, -2721, 1784, -1052, 529, -213, 60, -8, 55, -186, 434, -789, 1166, -1362, 829, 30001, 4244, -2726, 1786, -1053, 530, -213, 60, -8,
+ 55, -186, 433, -788, 1163, -1356, 816, 29998, 4260, -2732, 1789, -1054, 530, -213, 61, -8, 55, -185, 433, -787, 1161, -1350, 802, 29995, 4276, -2738, 1791, -1055, 530, -213, 61, -8, 55, -185, 432, -785, 1158, -1345, 789, 29992, 4292, -2744, 1794, -1056, 531, -213, 61, -8, 54, -185, 432, -784, 1155, -1339, 775, 29992, 4308, -2750, 1796, -1057, 531, -213, 61, -8,
+ 54, -185, 431, -783, 1152, -1333, 762, 29991, 4324, -2756, 1799, -1058, 531, -214, 61, -8, 54, -185, 431, -782, 1149, -1327, 748, 29988, 4341, -2762, 1801, -1059, 532, -214, 61, -8, 54, -185, 430, -780, 1146, -1321, 735, 29984, 4357, -2767, 1804, -1060, 532, -214, 61, -8, 54, -184, 430, -779, 1144, -1315, 722, 29980, 4373, -2773, 1806, -1061, 532, -214, 61, -8,
+ 54, -184, 429, -778, 1141, -1309, 708, 29979, 4389, -2779, 1809, -1062, 532, -214, 61, -8, 54, -184, 429, -777, 1138, -1303, 695, 29976, 4405, -2785, 1811, -1063, 533, -214, 61, -8, 54, -184, 428, -775, 1135, -1298, 681, 29975, 4421, -2791, 1814, -1064, 533, -214, 61, -8, 54, -184, 428, -774, 1132, -1292, 668, 29973, 4437, -2797, 1816, -1065, 533, -214, 61, -8,
+ 54, -184, 427, -773, 1129, -1286, 654, 29971, 4453, -2803, 1819, -1066, 534, -214, 61, -8, 54, -184, 427, -771, 1127, -1280, 641, 29965, 4470, -2808, 1821, -1067, 534, -214, 61, -8, 54, -183, 426, -770, 1124, -1274, 628, 29962, 4486, -2814, 1824, -1068, 534, -214, 61, -8, 54, -183, 426, -769, 1121, -1268, 614, 29960, 4502, -2820, 1826, -1069, 535, -214, 61, -8,
+ 54, -183, 425, -768, 1118, -1262, 601, 29959, 4518, -2826, 1828, -1070, 535, -214, 61, -8, 54, -183, 425, -766, 1115, -1256, 588, 29955, 4534, -2832, 1831, -1071, 535, -214, 61, -8, 54, -183, 424, -765, 1112, -1251, 574, 29955, 4551, -2838, 1833, -1072, 536, -215, 61, -8, 54, -183, 424, -764, 1110, -1245, 561, 29950, 4567, -2843, 1836, -1073, 536, -215, 61, -8,
+ 54, -182, 423, -762, 1107, -1239, 548, 29947, 4583, -2849, 1838, -1074, 536, -215, 61, -8, 54, -182, 423, -761, 1104, -1233, 535, 29943, 4599, -2855, 1841, -1075, 537, -215, 61, -8, 54, -182, 422, -760, 1101, -1227, 521, 29943, 4615, -2861, 1843, -1076, 537, -215, 61, -8, 54, -182, 422, -759, 1098, -1221, 508, 29939, 4632, -2867, 1846, -1077, 537, -215, 61, -8,
+ 54, -182, 421, -757, 1095, -1215, 495, 29937, 4648, -2873, 1848, -1078, 537, -215, 61, -8, 54, -182, 421, -756, 1093, -1209, 482, 29931, 4664, -2878, 1851, -1079, 538, -215, 61, -8, 54, -181, 420, -755, 1090, -1204, 468, 29930, 4681, -2884, 1853, -1080, 538, -215, 61, -8, 54, -181, 420, -753, 1087, -1198, 455, 29926, 4697, -2890, 1856, -1081, 538, -215, 61, -8,
+ 53, -181, 419, -752, 1084, -1192, 442, 29924, 4713, -2896, 1858, -1081, 539, -215, 61, -8, 53, -181, 419, -751, 1081, -1186, 429, 29922, 4729, -2902, 1860, -1082, 539, -215, 61, -8, 53, -181, 418, -750, 1078, -1180, 416, 29918, 4746, -2907, 1863, -1083, 539, -215, 61, -8, 53, -181, 418, -748, 1076, -1174, 403, 29913, 4762, -2913, 1865, -1084, 540, -215, 61, -8,
+ 53, -180, 417, -747, 1073, -1168, 389, 29911, 4778, -2919, 1868, -1085, 540, -215, 61, -8, 53, -180, 416, -746, 1070, -1163, 376, 29911, 4795, -2925, 1870, -1086, 540, -216, 61, -8, 53, -180, 416, -744, 1067, -1157, 363, 29907, 4811, -2931, 1873, -1087, 540, -216, 61, -8, 53, -180, 415, -743, 1064, -1151, 350, 29903, 4828, -2936, 1875, -1088, 541, -216, 61, -8,
+ 53, -180, 415, -742, 1061, -1145, 337, 29901, 4844, -2942, 1877, -1089, 541, -216, 61, -8, 53, -180, 414, -741, 1058, -1139, 324, 29899, 4860, -2948, 1880, -1090, 541, -216, 61, -8, 53, -179, 414, -739, 1056, -1133, 311, 29892, 4877, -2954, 1882, -1091, 542, -216, 61, -8, 53, -179, 413, -738, 1053, -1128, 298, 29891, 4893, -2960, 1885, -1092, 542, -216, 61, -8,
+ 53, -179, 413, -737, 1050, -1122, 285, 29888, 4909, -2965, 1887, -1093, 542, -216, 61, -8, 53, -179, 412, -735, 1047, -1116, 272, 29883, 4926, -2971, 1890, -1094, 543, -216, 61, -8, 53, -179, 412, -734, 1044, -1110, 259, 29881, 4942, -2977, 1892, -1095, 543, -216, 61, -8, 53, -179, 411, -733, 1041, -1104, 246, 29879, 4959, -2983, 1894, -1096, 543, -216, 61, -8,
+ 53, -178, 411, -731, 1039, -1098, 233, 29872, 4975, -2989, 1897, -1096, 543, -216, 61, -8, 53, -178, 410, -730, 1036, -1093, 220, 29869, 4992, -2994, 1899, -1097, 544, -216, 61, -8, 53, -178, 410, -729, 1033, -1087, 207, 29866, 5008, -3000, 1902, -1098, 544, -216, 61, -8, 53, -178, 409, -728, 1030, -1081, 194, 29864, 5025, -3006, 1904, -1099, 544, -216, 61, -8,
+ 53, -178, 409, -726, 1027, -1075, 181, 29860, 5041, -3012, 1906, -1100, 545, -216, 61, -8, 53, -178, 408, -725, 1024, -1069, 168, 29856, 5058, -3017, 1909, -1101, 545, -216, 61, -8, 53, -177, 408, -724, 1021, -1063, 155, 29854, 5074, -3023, 1911, -1102, 545, -217, 61, -8, 53, -177, 407, -722, 1019, -1058, 142, 29850, 5091, -3029, 1914, -1103, 545, -217, 61, -8,
+ 52, -177, 407, -721, 1016, -1052, 129, 29848, 5107, -3035, 1916, -1104, 546, -217, 61, -8, 52, -177, 406, -720, 1013, -1046, 116, 29845, 5124, -3040, 1918, -1105, 546, -217, 61, -8, 52, -177, 406, -718, 1010, -1040, 104, 29840, 5140, -3046, 1921, -1106, 546, -217, 61, -8, 52, -177, 405, -717, 1007, -1034, 91, 29838, 5157, -3052, 1923, -1107, 546, -217, 61, -8,
+ 52, -176, 405, -716, 1004, -1029, 78, 29834, 5173, -3058, 1925, -1107, 547, -217, 61, -8, 52, -176, 404, -714, 1002, -1023, 65, 29828, 5190, -3063, 1928, -1108, 547, -217, 61, -8, 52, -176, 404, -713, 999, -1017, 52, 29826, 5206, -3069, 1930, -1109, 547, -217, 61, -8, 52, -176, 403, -712, 996, -1011, 39, 29822, 5223, -3075, 1933, -1110, 548, -217, 61, -8,
+ 52, -176, 402, -711, 993, -1005, 27, 29820, 5239, -3081, 1935, -1111, 548, -217, 61, -8, 52, -176, 402, -709, 990, -1000, 14, 29816, 5256, -3086, 1937, -1112, 548, -217, 61, -8, 52, -175, 401, -708, 987, -994, 1, 29812, 5273, -3092, 1940, -1113, 548, -217, 61, -8, 52, -175, 401, -707, 984, -988, -12, 29809, 5289, -3098, 1942, -1114, 549, -217, 61, -8,
+ 52, -175, 400, -705, 982, -982, -24, 29804, 5306, -3104, 1944, -1115, 549, -217, 61, -8, 52, -175, 400, -704, 979, -976, -37, 29800, 5322, -3109, 1947, -1116, 549, -217, 61, -8, 52, -175, 399, -703, 976, -971, -50, 29798, 5339, -3115, 1949, -1116, 549, -217, 61, -8, 52, -175, 399, -701, 973, -965, -62, 29792, 5356, -3121, 1951, -1117, 550, -217, 61, -8,
+ 52, -174, 398, -700, 970, -959, -75, 29789, 5372, -3127, 1954, -1118, 550, -217, 61, -8, 52, -174, 398, -699, 967, -953, -88, 29786, 5389, -3132, 1956, -1119, 550, -218, 61, -8, 52, -174, 397, -697, 964, -947, -100, 29781, 5406, -3138, 1958, -1120, 551, -218, 61, -8, 52, -174, 397, -696, 962, -942, -113, 29778, 5422, -3144, 1961, -1121, 551, -218, 61, -8,
+ 52, -174, 396, -695, 959, -936, -126, 29775, 5439, -3149, 1963, -1122, 551, -218, 61, -8, 52, -173, 396, -693, 956, -930, -138, 29768, 5456, -3155, 1966, -1123, 551, -218, 61, -8, 52, -173, 395, -692, 953, -924, -151, 29765, 5472, -3161, 1968, -1123, 552, -218, 61, -8, 51, -173, 395, -691, 950, -919, -164, 29764, 5489, -3167, 1970, -1124, 552, -218, 61, -8,
+ 51, -173, 394, -690, 947, -913, -176, 29760, 5506, -3172, 1972, -1125, 552, -218, 61, -8, 51, -173, 394, -688, 944, -907, -189, 29755, 5523, -3178, 1975, -1126, 552, -218, 61, -8, 51, -173, 393, -687, 942, -901, -201, 29751, 5539, -3184, 1977, -1127, 553, -218, 61, -8, 51, -172, 392, -686, 939, -895, -214, 29747, 5556, -3189, 1979, -1128, 553, -218, 61, -8,
+ 51, -172, 392, -684, 936, -890, -226, 29742, 5573, -3195, 1982, -1129, 553, -218, 61, -8, 51, -172, 391, -683, 933, -884, -239, 29740, 5589, -3201, 1984, -1129, 553, -218, 61, -8, 51, -172, 391, -682, 930, -878, -251, 29734, 5606, -3206, 1986, -1130, 554, -218, 61, -8, 51, -172, 390, -680, 927, -872, -264, 29730, 5623, -3212, 1989, -1131, 554, -218, 61, -8,
+ 51, -172, 390, -679, 924, -867, -276, 29727, 5640, -3218, 1991, -1132, 554, -218, 61, -8, 51, -171, 389, -678, 922, -861, -289, 29723, 5657, -3224, 1993, -1133, 554, -218, 61, -8, 51, -171, 389, -676, 919, -855, -301, 29716, 5673, -3229, 1996, -1134, 555, -218, 61, -8, 51, -171, 388, -675, 916, -849, -314, 29714, 5690, -3235, 1998, -1135, 555, -218, 61, -8,
+ 51, -171, 388, -674, 913, -844, -326, 29710, 5707, -3241, 2000, -1135, 555, -218, 61, -8, 51, -171, 387, -672, 910, -838, -338, 29705, 5724, -3246, 2002, -1136, 555, -218, 61, -8, 51, -170, 387, -671, 907, -832, -351, 29699, 5741, -3252, 2005, -1137, 556, -218, 61, -8, 51, -170, 386, -670, 905, -826, -363, 29696, 5757, -3258, 2007, -1138, 556, -218, 61, -8,
+ 51, -170, 385, -668, 902, -821, -376, 29693, 5774, -3263, 2009, -1139, 556, -218, 61, -8, 51, -170, 385, -667, 899, -815, -388, 29688, 5791, -3269, 2012, -1140, 556, -218, 61, -8, 51, -170, 384, -666, 896, -809, -400, 29686, 5808, -3275, 2014, -1141, 556, -219, 61, -8, 51, -170, 384, -664, 893, -804, -413, 29680, 5825, -3280, 2016, -1141, 557, -219, 61, -8,
+ 51, -169, 383, -663, 890, -798, -425, 29676, 5842, -3286, 2018, -1142, 557, -219, 61, -8, 51, -169, 383, -662, 887, -792, -437, 29671, 5859, -3292, 2021, -1143, 557, -219, 61, -8, 50, -169, 382, -660, 885, -786, -450, 29668, 5875, -3297, 2023, -1144, 557, -219, 61, -8, 50, -169, 382, -659, 882, -781, -462, 29664, 5892, -3303, 2025, -1145, 558, -219, 61, -8,
+ 50, -169, 381, -658, 879, -775, -474, 29658, 5909, -3308, 2028, -1145, 558, -219, 61, -8, 50, -169, 381, -656, 876, -769, -486, 29653, 5926, -3314, 2030, -1146, 558, -219, 61, -8, 50, -168, 380, -655, 873, -763, -499, 29650, 5943, -3320, 2032, -1147, 558, -219, 61, -8, 50, -168, 380, -654, 870, -758, -511, 29645, 5960, -3325, 2034, -1148, 559, -219, 61, -8,
+ 50, -168, 379, -652, 867, -752, -523, 29640, 5977, -3331, 2037, -1149, 559, -219, 61, -8, 50, -168, 378, -651, 865, -746, -535, 29636, 5994, -3337, 2039, -1150, 559, -219, 61, -8, 50, -168, 378, -650, 862, -741, -547, 29631, 6011, -3342, 2041, -1150, 559, -219, 61, -8, 50, -167, 377, -648, 859, -735, -560, 29627, 6028, -3348, 2043, -1151, 559, -219, 61, -8,
+ 50, -167, 377, -647, 856, -729, -572, 29620, 6045, -3353, 2046, -1152, 560, -219, 61, -8, 50, -167, 376, -646, 853, -724, -584, 29618, 6062, -3359, 2048, -1153, 560, -219, 61, -8, 50, -167, 376, -644, 850, -718, -596, 29613, 6079, -3365, 2050, -1154, 560, -219, 61, -8, 50, -167, 375, -643, 847, -712, -608, 29608, 6096, -3370, 2052, -1154, 560, -219, 61, -8,
+ 50, -167, 375, -642, 845, -706, -620, 29602, 6113, -3376, 2054, -1155, 561, -219, 61, -8, 50, -166, 374, -640, 842, -701, -632, 29597, 6130, -3382, 2057, -1156, 561, -219, 61, -8, 50, -166, 374, -639, 839, -695, -644, 29592, 6147, -3387, 2059, -1157, 561, -219, 61, -8, 50, -166, 373, -638, 836, -689, -656, 29589, 6164, -3393, 2061, -1158, 561, -219, 61, -8,
+ 50, -166, 372, -636, 833, -684, -669, 29585, 6181, -3398, 2063, -1158, 561, -219, 61, -8, 50, -166, 372, -635, 830, -678, -681, 29579, 6198, -3404, 2066, -1159, 562, -219, 61, -8, 50, -165, 371, -634, 827, -672, -693, 29574, 6215, -3409, 2068, -1160, 562, -219, 61, -8, 49, -165, 371, -632, 825, -667, -705, 29570, 6232, -3415, 2070, -1161, 562, -219, 61, -8,
+ 49, -165, 370, -631, 822, -661, -717, 29567, 6249, -3421, 2072, -1162, 562, -219, 61, -8, 49, -165, 370, -630, 819, -655, -729, 29561, 6266, -3426, 2074, -1162, 562, -219, 61, -8, 49, -165, 369, -628, 816, -650, -741, 29556, 6283, -3432, 2077, -1163, 563, -219, 61, -8, 49, -164, 369, -627, 813, -644, -753, 29550, 6300, -3437, 2079, -1164, 563, -219, 61, -8,
+ 49, -164, 368, -626, 810, -638, -764, 29546, 6317, -3443, 2081, -1165, 563, -219, 61, -8, 49, -164, 368, -624, 807, -633, -776, 29541, 6334, -3448, 2083, -1166, 563, -219, 61, -8, 49, -164, 367, -623, 805, -627, -788, 29536, 6351, -3454, 2085, -1166, 563, -219, 61, -8, 49, -164, 366, -622, 802, -621, -800, 29530, 6369, -3460, 2088, -1167, 564, -219, 61, -8,
+ 49, -164, 366, -620, 799, -616, -812, 29525, 6386, -3465, 2090, -1168, 564, -219, 61, -8, 49, -163, 365, -619, 796, -610, -824, 29521, 6403, -3471, 2092, -1169, 564, -219, 61, -8, 49, -163, 365, -618, 793, -604, -836, 29515, 6420, -3476, 2094, -1169, 564, -219, 61, -8, 49, -163, 364, -616, 790, -599, -848, 29513, 6437, -3482, 2096, -1170, 564, -220, 61, -8,
+ 49, -163, 364, -615, 787, -593, -860, 29507, 6454, -3487, 2098, -1171, 565, -220, 61, -8, 49, -163, 363, -613, 785, -587, -871, 29500, 6471, -3493, 2101, -1172, 565, -220, 61, -8, 49, -162, 363, -612, 782, -582, -883, 29494, 6488, -3498, 2103, -1172, 565, -220, 61, -8, 49, -162, 362, -611, 779, -576, -895, 29490, 6506, -3504, 2105, -1173, 565, -220, 61, -8,
+ 49, -162, 361, -609, 776, -571, -907, 29486, 6523, -3509, 2107, -1174, 565, -220, 61, -8, 49, -162, 361, -608, 773, -565, -919, 29481, 6540, -3515, 2109, -1175, 566, -220, 61, -8, 49, -162, 360, -607, 770, -559, -930, 29476, 6557, -3521, 2111, -1175, 566, -220, 61, -8, 49, -162, 360, -605, 767, -554, -942, 29471, 6574, -3526, 2113, -1176, 566, -220, 61, -8,
+ 48, -161, 359, -604, 765, -548, -954, 29465, 6592, -3532, 2116, -1177, 566, -220, 61, -8, 48, -161, 359, -603, 762, -542, -965, 29459, 6609, -3537, 2118, -1178, 566, -220, 61, -8, 48, -161, 358, -601, 759, -537, -977, 29455, 6626, -3543, 2120, -1178, 567, -220, 60, -8, 48, -161, 358, -600, 756, -531, -989, 29450, 6643, -3548, 2122, -1179, 567, -220, 60, -8,
+ 48, -161, 357, -599, 753, -526, -1001, 29448, 6660, -3554, 2124, -1180, 567, -220, 60, -8, 48, -160, 356, -597, 750, -520, -1012, 29440, 6678, -3559, 2126, -1181, 567, -220, 60, -8, 48, -160, 356, -596, 748, -514, -1024, 29434, 6695, -3565, 2128, -1181, 567, -220, 60, -8, 48, -160, 355, -595, 745, -509, -1036, 29430, 6712, -3570, 2131, -1182, 567, -220, 60, -8,
+ 48, -160, 355, -593, 742, -503, -1047, 29423, 6729, -3576, 2133, -1183, 568, -220, 60, -8, 48, -160, 354, -592, 739, -498, -1059, 29419, 6747, -3581, 2135, -1184, 568, -220, 60, -8, 48, -159, 354, -591, 736, -492, -1070, 29412, 6764, -3587, 2137, -1184, 568, -220, 60, -8, 48, -159, 353, -589, 733, -486, -1082, 29407, 6781, -3592, 2139, -1185, 568, -220, 60, -8,
+ 48, -159, 353, -588, 730, -481, -1093, 29402, 6798, -3597, 2141, -1186, 568, -220, 60, -8, 48, -159, 352, -586, 728, -475, -1105, 29394, 6816, -3603, 2143, -1186, 569, -220, 60, -8, 48, -159, 351, -585, 725, -470, -1117, 29391, 6833, -3608, 2145, -1187, 569, -220, 60, -8, 48, -158, 351, -584, 722, -464, -1128, 29385, 6850, -3614, 2147, -1188, 569, -220, 60, -8,
+ 48, -158, 350, -582, 719, -458, -1140, 29378, 6868, -3619, 2150, -1189, 569, -220, 60, -8, 48, -158, 350, -581, 716, -453, -1151, 29373, 6885, -3625, 2152, -1189, 569, -220, 60, -8, 48, -158, 349, -580, 713, -447, -1163, 29369, 6902, -3630, 2154, -1190, 569, -220, 60, -8, 48, -158, 349, -578, 710, -442, -1174, 29362, 6920, -3636, 2156, -1191, 570, -220, 60, -8,
+ 47, -158, 348, -577, 708, -436, -1186, 29357, 6937, -3641, 2158, -1191, 570, -220, 60, -8, 47, -157, 347, -576, 705, -431, -1197, 29353, 6954, -3647, 2160, -1192, 570, -220, 60, -8, 47, -157, 347, -574, 702, -425, -1208, 29345, 6972, -3652, 2162, -1193, 570, -220, 60, -8, 47, -157, 346, -573, 699, -420, -1220, 29342, 6989, -3657, 2164, -1194, 570, -220, 60, -8,
+ 47, -157, 346, -572, 696, -414, -1231, 29336, 7006, -3663, 2166, -1194, 570, -220, 60, -8, 47, -157, 345, -570, 693, -408, -1243, 29329, 7024, -3668, 2168, -1195, 571, -220, 60, -8, 47, -156, 345, -569, 691, -403, -1254, 29323, 7041, -3674, 2170, -1196, 571, -220, 60, -8, 47, -156, 344, -568, 688, -397, -1265, 29316, 7059, -3679, 2172, -1196, 571, -220, 60, -8,
+ 47, -156, 344, -566, 685, -392, -1277, 29312, 7076, -3685, 2174, -1197, 571, -220, 60, -8, 47, -156, 343, -565, 682, -386, -1288, 29307, 7093, -3690, 2176, -1198, 571, -220, 60, -8, 47, -156, 342, -563, 679, -381, -1299, 29300, 7111, -3695, 2178, -1198, 571, -220, 60, -8, 47, -155, 342, -562, 676, -375, -1311, 29294, 7128, -3701, 2181, -1199, 571, -220, 60, -8,
+ 47, -155, 341, -561, 674, -370, -1322, 29287, 7146, -3706, 2183, -1200, 572, -220, 60, -8, 47, -155, 341, -559, 671, -364, -1333, 29280, 7163, -3712, 2185, -1200, 572, -220, 60, -8, 47, -155, 340, -558, 668, -359, -1345, 29277, 7180, -3717, 2187, -1201, 572, -220, 60, -8, 47, -155, 340, -557, 665, -353, -1356, 29270, 7198, -3722, 2189, -1202, 572, -220, 60, -8,
+ 47, -154, 339, -555, 662, -348, -1367, 29265, 7215, -3728, 2191, -1203, 572, -220, 60, -8, 47, -154, 338, -554, 659, -342, -1378, 29258, 7233, -3733, 2193, -1203, 572, -220, 60, -8, 47, -154, 338, -553, 656, -337, -1390, 29253, 7250, -3738, 2195, -1204, 573, -220, 60, -8, 47, -154, 337, -551, 654, -331, -1401, 29246, 7268, -3744, 2197, -1205, 573, -220, 60, -8,
+ 46, -154, 337, -550, 651, -325, -1412, 29240, 7285, -3749, 2199, -1205, 573, -220, 60, -8, 46, -153, 336, -549, 648, -320, -1423, 29235, 7303, -3755, 2201, -1206, 573, -220, 60, -8, 46, -153, 336, -547, 645, -314, -1434, 29228, 7320, -3760, 2203, -1207, 573, -220, 60, -8, 46, -153, 335, -546, 642, -309, -1445, 29222, 7338, -3765, 2205, -1207, 573, -220, 60, -8,
+ 46, -153, 334, -544, 639, -304, -1457, 29219, 7355, -3771, 2207, -1208, 573, -220, 60, -8, 46, -153, 334, -543, 637, -298, -1468, 29209, 7373, -3776, 2209, -1208, 574, -220, 60, -8, 46, -152, 333, -542, 634, -293, -1479, 29204, 7390, -3781, 2211, -1209, 574, -220, 60, -8, 46, -152, 333, -540, 631, -287, -1490, 29197, 7408, -3787, 2213, -1210, 574, -220, 60, -8,
+ 46, -152, 332, -539, 628, -282, -1501, 29192, 7425, -3792, 2215, -1210, 574, -220, 60, -8, 46, -152, 332, -538, 625, -276, -1512, 29185, 7443, -3797, 2217, -1211, 574, -220, 60, -8, 46, -152, 331, -536, 622, -271, -1523, 29181, 7460, -3803, 2219, -1212, 574, -220, 60, -8, 46, -152, 330, -535, 620, -265, -1534, 29173, 7478, -3808, 2221, -1212, 574, -220, 60, -8,
+ 46, -151, 330, -534, 617, -260, -1545, 29167, 7495, -3813, 2223, -1213, 574, -220, 60, -8, 46, -151, 329, -532, 614, -254, -1556, 29160, 7513, -3819, 2225, -1214, 575, -220, 60, -8, 46, -151, 329, -531, 611, -249, -1567, 29154, 7530, -3824, 2227, -1214, 575, -220, 60, -8, 46, -151, 328, -529, 608, -243, -1578, 29147, 7548, -3829, 2229, -1215, 575, -220, 60, -8,
+ 46, -151, 328, -528, 605, -238, -1589, 29142, 7566, -3835, 2231, -1216, 575, -220, 60, -8, 46, -150, 327, -527, 603, -232, -1600, 29134, 7583, -3840, 2233, -1216, 575, -220, 60, -8, 46, -150, 326, -525, 600, -227, -1611, 29128, 7601, -3845, 2235, -1217, 575, -220, 60, -8, 46, -150, 326, -524, 597, -221, -1622, 29121, 7618, -3850, 2237, -1217, 575, -220, 60, -8,
+ 45, -150, 325, -523, 594, -216, -1633, 29119, 7636, -3856, 2238, -1218, 575, -220, 60, -8, 45, -150, 325, -521, 591, -211, -1644, 29112, 7653, -3861, 2240, -1219, 576, -220, 60, -8, 45, -149, 324, -520, 588, -205, -1655, 29104, 7671, -3866, 2242, -1219, 576, -219, 59, -8, 45, -149, 324, -519, 586, -200, -1665, 29097, 7689, -3872, 2244, -1220, 576, -219, 59, -8,
+ 45, -149, 323, -517, 583, -194, -1676, 29091, 7706, -3877, 2246, -1221, 576, -219, 59, -8, 45, -149, 322, -516, 580, -189, -1687, 29085, 7724, -3882, 2248, -1221, 576, -219, 59, -8, 45, -149, 322, -514, 577, -183, -1698, 29077, 7742, -3887, 2250, -1222, 576, -219, 59, -8, 45, -148, 321, -513, 574, -178, -1709, 29072, 7759, -3893, 2252, -1222, 576, -219, 59, -8,
+ 45, -148, 321, -512, 572, -173, -1720, 29065, 7777, -3898, 2254, -1223, 576, -219, 59, -8, 45, -148, 320, -510, 569, -167, -1730, 29058, 7794, -3903, 2256, -1224, 576, -219, 59, -8, 45, -148, 320, -509, 566, -162, -1741, 29050, 7812, -3908, 2258, -1224, 577, -219, 59, -8, 45, -148, 319, -508, 563, -156, -1752, 29045, 7830, -3914, 2260, -1225, 577, -219, 59, -8,
+ 45, -147, 318, -506, 560, -151, -1763, 29038, 7847, -3919, 2262, -1225, 577, -219, 59, -8, 45, -147, 318, -505, 557, -146, -1773, 29032, 7865, -3924, 2263, -1226, 577, -219, 59, -8, 45, -147, 317, -504, 555, -140, -1784, 29025, 7883, -3929, 2265, -1227, 577, -219, 59, -8, 45, -147, 317, -502, 552, -135, -1795, 29019, 7900, -3935, 2267, -1227, 577, -219, 59, -8,
+ 45, -147, 316, -501, 549, -129, -1805, 29012, 7918, -3940, 2269, -1228, 577, -219, 59, -8, 45, -146, 316, -499, 546, -124, -1816, 29003, 7936, -3945, 2271, -1228, 577, -219, 59, -8, 45, -146, 315, -498, 543, -119, -1827, 28998, 7954, -3950, 2273, -1229, 577, -219, 59, -8, 44, -146, 314, -497, 541, -113, -1837, 28991, 7971, -3955, 2275, -1230, 578, -219, 59, -8,
+ 44, -146, 314, -495, 538, -108, -1848, 28984, 7989, -3961, 2277, -1230, 578, -219, 59, -8, 44, -146, 313, -494, 535, -102, -1859, 28978, 8007, -3966, 2279, -1231, 578, -219, 59, -8, 44, -145, 313, -493, 532, -97, -1869, 28971, 8024, -3971, 2280, -1231, 578, -219, 59, -8, 44, -145, 312, -491, 529, -92, -1880, 28965, 8042, -3976, 2282, -1232, 578, -219, 59, -8,
+ 44, -145, 312, -490, 526, -86, -1891, 28957, 8060, -3981, 2284, -1232, 578, -219, 59, -8, 44, -145, 311, -489, 524, -81, -1901, 28951, 8078, -3987, 2286, -1233, 578, -219, 59, -8, 44, -145, 310, -487, 521, -76, -1912, 28946, 8095, -3992, 2288, -1234, 578, -219, 59, -8, 44, -144, 310, -486, 518, -70, -1922, 28935, 8113, -3997, 2290, -1234, 578, -219, 59, -7,
+ 44, -144, 309, -484, 515, -65, -1933, 28929, 8131, -4002, 2292, -1235, 578, -219, 59, -7, 44, -144, 309, -483, 512, -60, -1943, 28922, 8149, -4007, 2293, -1235, 578, -219, 59, -7, 44, -144, 308, -482, 510, -54, -1954, 28915, 8166, -4012, 2295, -1236, 579, -219, 59, -7, 44, -144, 307, -480, 507, -49, -1964, 28907, 8184, -4017, 2297, -1236, 579, -219, 59, -7,
+ 44, -143, 307, -479, 504, -43, -1975, 28900, 8202, -4023, 2299, -1237, 579, -219, 59, -7, 44, -143, 306, -478, 501, -38, -1985, 28893, 8220, -4028, 2301, -1237, 579, -219, 59, -7, 44, -143, 306, -476, 498, -33, -1996, 28887, 8237, -4033, 2303, -1238, 579, -219, 59, -7, 44, -143, 305, -475, 496, -28, -2006, 28881, 8255, -4038, 2304, -1239, 579, -219, 59, -7,
+ 44, -143, 305, -473, 493, -22, -2016, 28871, 8273, -4043, 2306, -1239, 579, -219, 59, -7, 44, -142, 304, -472, 490, -17, -2027, 28865, 8291, -4048, 2308, -1240, 579, -219, 59, -7, 43, -142, 303, -471, 487, -12, -2037, 28858, 8309, -4053, 2310, -1240, 579, -218, 59, -7, 43, -142, 303, -469, 484, -6, -2047, 28849, 8327, -4058, 2312, -1241, 579, -218, 59, -7,
+ 43, -142, 302, -468, 482, -1, -2058, 28845, 8344, -4064, 2314, -1241, 579, -218, 58, -7, 43, -142, 302, -467, 479, 4, -2068, 28839, 8362, -4069, 2315, -1242, 579, -218, 58, -7, 43, -141, 301, -465, 476, 10, -2079, 28830, 8380, -4074, 2317, -1242, 579, -218, 58, -7, 43, -141, 301, -464, 473, 15, -2089, 28822, 8398, -4079, 2319, -1243, 580, -218, 58, -7,
+ 43, -141, 300, -463, 470, 20, -2099, 28815, 8416, -4084, 2321, -1243, 580, -218, 58, -7, 43, -141, 299, -461, 468, 26, -2109, 28806, 8434, -4089, 2323, -1244, 580, -218, 58, -7, 43, -141, 299, -460, 465, 31, -2120, 28801, 8451, -4094, 2324, -1244, 580, -218, 58, -7, 43, -140, 298, -458, 462, 36, -2130, 28793, 8469, -4099, 2326, -1245, 580, -218, 58, -7,
+ 43, -140, 298, -457, 459, 41, -2140, 28785, 8487, -4104, 2328, -1245, 580, -218, 58, -7, 43, -140, 297, -456, 456, 47, -2150, 28778, 8505, -4109, 2330, -1246, 580, -218, 58, -7, 43, -140, 296, -454, 454, 52, -2161, 28771, 8523, -4114, 2331, -1246, 580, -218, 58, -7, 43, -140, 296, -453, 451, 57, -2171, 28764, 8541, -4119, 2333, -1247, 580, -218, 58, -7,
+ 43, -139, 295, -452, 448, 63, -2181, 28756, 8559, -4125, 2335, -1247, 580, -218, 58, -7, 43, -139, 295, -450, 445, 68, -2191, 28749, 8576, -4130, 2337, -1248, 580, -218, 58, -7, 43, -139, 294, -449, 442, 73, -2201, 28743, 8594, -4135, 2338, -1248, 580, -218, 58, -7, 43, -139, 294, -448, 440, 78, -2211, 28735, 8612, -4140, 2340, -1249, 580, -218, 58, -7,
+ 42, -138, 293, -446, 437, 84, -2222, 28727, 8630, -4145, 2342, -1249, 580, -218, 58, -7, 42, -138, 292, -445, 434, 89, -2232, 28721, 8648, -4150, 2344, -1250, 580, -218, 58, -7, 42, -138, 292, -443, 431, 94, -2242, 28713, 8666, -4155, 2345, -1250, 580, -218, 58, -7, 42, -138, 291, -442, 429, 99, -2252, 28706, 8684, -4160, 2347, -1251, 580, -218, 58, -7,
+ 42, -138, 291, -441, 426, 105, -2262, 28696, 8702, -4165, 2349, -1251, 581, -218, 58, -7, 42, -137, 290, -439, 423, 110, -2272, 28687, 8720, -4170, 2351, -1252, 581, -217, 58, -7, 42, -137, 289, -438, 420, 115, -2282, 28681, 8738, -4175, 2352, -1252, 581, -217, 58, -7, 42, -137, 289, -437, 417, 120, -2292, 28674, 8756, -4180, 2354, -1253, 581, -217, 58, -7,
+ 42, -137, 288, -435, 415, 125, -2302, 28665, 8774, -4185, 2356, -1253, 581, -217, 58, -7, 42, -137, 288, -434, 412, 131, -2312, 28657, 8792, -4190, 2358, -1254, 581, -217, 58, -7, 42, -136, 287, -432, 409, 136, -2322, 28650, 8809, -4195, 2359, -1254, 581, -217, 58, -7, 42, -136, 287, -431, 406, 141, -2332, 28643, 8827, -4200, 2361, -1255, 581, -217, 58, -7,
+ 42, -136, 286, -430, 403, 146, -2342, 28636, 8845, -4205, 2363, -1255, 581, -217, 58, -7, 42, -136, 285, -428, 401, 151, -2352, 28629, 8863, -4210, 2364, -1256, 581, -217, 58, -7, 42, -136, 285, -427, 398, 157, -2362, 28620, 8881, -4215, 2366, -1256, 581, -217, 58, -7, 42, -135, 284, -426, 395, 162, -2372, 28614, 8899, -4220, 2368, -1257, 581, -217, 57, -7,
+ 42, -135, 284, -424, 392, 167, -2382, 28605, 8917, -4224, 2369, -1257, 581, -217, 57, -7, 42, -135, 283, -423, 390, 172, -2392, 28598, 8935, -4229, 2371, -1258, 581, -217, 57, -7, 42, -135, 282, -422, 387, 177, -2401, 28590, 8953, -4234, 2373, -1258, 581, -217, 57, -7, 41, -135, 282, -420, 384, 183, -2411, 28582, 8971, -4239, 2374, -1258, 581, -217, 57, -7,
+ 41, -134, 281, -419, 381, 188, -2421, 28575, 8989, -4244, 2376, -1259, 581, -217, 57, -7, 41, -134, 281, -417, 379, 193, -2431, 28565, 9007, -4249, 2378, -1259, 581, -217, 57, -7, 41, -134, 280, -416, 376, 198, -2441, 28560, 9025, -4254, 2379, -1260, 581, -217, 57, -7, 41, -134, 279, -415, 373, 203, -2451, 28552, 9043, -4259, 2381, -1260, 581, -216, 57, -7,
+ 41, -134, 279, -413, 370, 208, -2460, 28543, 9061, -4264, 2383, -1261, 581, -216, 57, -7, 41, -133, 278, -412, 368, 214, -2470, 28534, 9079, -4269, 2384, -1261, 581, -216, 57, -7, 41, -133, 278, -411, 365, 219, -2480, 28527, 9097, -4274, 2386, -1262, 581, -216, 57, -7, 41, -133, 277, -409, 362, 224, -2490, 28519, 9115, -4279, 2388, -1262, 581, -216, 57, -7,
+ 41, -133, 277, -408, 359, 229, -2499, 28510, 9133, -4283, 2389, -1262, 581, -216, 57, -7, 41, -133, 276, -407, 356, 234, -2509, 28504, 9151, -4288, 2391, -1263, 581, -216, 57, -7, 41, -132, 275, -405, 354, 239, -2519, 28493, 9170, -4293, 2393, -1263, 581, -216, 57, -7, 41, -132, 275, -404, 351, 244, -2529, 28487, 9188, -4298, 2394, -1264, 581, -216, 57, -7,
+ 41, -132, 274, -402, 348, 250, -2538, 28477, 9206, -4303, 2396, -1264, 581, -216, 57, -7, 41, -132, 274, -401, 345, 255, -2548, 28471, 9224, -4308, 2397, -1265, 581, -216, 57, -7, 41, -131, 273, -400, 343, 260, -2557, 28461, 9242, -4313, 2399, -1265, 581, -216, 57, -7, 41, -131, 272, -398, 340, 265, -2567, 28452, 9260, -4317, 2401, -1265, 581, -216, 57, -7,
+ 41, -131, 272, -397, 337, 270, -2577, 28446, 9278, -4322, 2402, -1266, 581, -216, 57, -7, 40, -131, 271, -396, 334, 275, -2586, 28439, 9296, -4327, 2404, -1266, 581, -216, 57, -7, 40, -131, 271, -394, 332, 280, -2596, 28430, 9314, -4332, 2406, -1267, 581, -216, 57, -7, 40, -130, 270, -393, 329, 285, -2605, 28421, 9332, -4337, 2407, -1267, 581, -215, 57, -7,
+ 40, -130, 269, -392, 326, 290, -2615, 28414, 9350, -4342, 2409, -1267, 581, -215, 57, -7, 40, -130, 269, -390, 323, 296, -2625, 28405, 9368, -4346, 2410, -1268, 581, -215, 57, -7, 40, -130, 268, -389, 321, 301, -2634, 28397, 9386, -4351, 2412, -1268, 581, -215, 56, -7, 40, -130, 268, -387, 318, 306, -2644, 28390, 9404, -4356, 2413, -1269, 581, -215, 56, -7,
+ 40, -129, 267, -386, 315, 311, -2653, 28380, 9423, -4361, 2415, -1269, 581, -215, 56, -7, 40, -129, 267, -385, 312, 316, -2663, 28372, 9441, -4366, 2417, -1269, 581, -215, 56, -7, 40, -129, 266, -383, 310, 321, -2672, 28363, 9459, -4370, 2418, -1270, 581, -215, 56, -7, 40, -129, 265, -382, 307, 326, -2682, 28356, 9477, -4375, 2420, -1270, 581, -215, 56, -7,
+ 40, -129, 265, -381, 304, 331, -2691, 28349, 9495, -4380, 2421, -1271, 581, -215, 56, -7, 40, -128, 264, -379, 301, 336, -2700, 28339, 9513, -4385, 2423, -1271, 581, -215, 56, -7, 40, -128, 264, -378, 299, 341, -2710, 28331, 9531, -4390, 2424, -1271, 581, -215, 56, -7, 40, -128, 263, -377, 296, 346, -2719, 28323, 9549, -4394, 2426, -1272, 581, -215, 56, -7,
+ 40, -128, 262, -375, 293, 351, -2729, 28314, 9568, -4399, 2428, -1272, 581, -215, 56, -7, 40, -128, 262, -374, 291, 356, -2738, 28304, 9586, -4404, 2429, -1272, 581, -214, 56, -7, 40, -127, 261, -372, 288, 361, -2747, 28295, 9604, -4409, 2431, -1273, 581, -214, 56, -7, 39, -127, 261, -371, 285, 366, -2757, 28288, 9622, -4413, 2432, -1273, 581, -214, 56, -7,
+ 39, -127, 260, -370, 282, 372, -2766, 28280, 9640, -4418, 2434, -1274, 581, -214, 56, -7, 39, -127, 259, -368, 280, 377, -2775, 28271, 9658, -4423, 2435, -1274, 581, -214, 56, -7, 39, -126, 259, -367, 277, 382, -2785, 28261, 9676, -4427, 2437, -1274, 581, -214, 56, -7, 39, -126, 258, -366, 274, 387, -2794, 28254, 9695, -4432, 2438, -1275, 581, -214, 56, -7,
+ 39, -126, 258, -364, 271, 392, -2803, 28244, 9713, -4437, 2440, -1275, 581, -214, 56, -7, 39, -126, 257, -363, 269, 397, -2812, 28236, 9731, -4442, 2441, -1275, 581, -214, 56, -7, 39, -126, 257, -362, 266, 402, -2822, 28228, 9749, -4446, 2443, -1276, 581, -214, 56, -7, 39, -125, 256, -360, 263, 407, -2831, 28219, 9767, -4451, 2444, -1276, 581, -214, 56, -7,
+ 39, -125, 255, -359, 261, 412, -2840, 28209, 9786, -4456, 2446, -1276, 581, -214, 56, -7, 39, -125, 255, -357, 258, 417, -2849, 28200, 9804, -4460, 2447, -1277, 581, -213, 55, -7, 39, -125, 254, -356, 255, 422, -2859, 28193, 9822, -4465, 2449, -1277, 581, -213, 55, -7, 39, -125, 254, -355, 252, 427, -2868, 28185, 9840, -4470, 2450, -1277, 581, -213, 55, -7,
+ 39, -124, 253, -353, 250, 432, -2877, 28174, 9858, -4474, 2452, -1278, 581, -213, 55, -7, 39, -124, 252, -352, 247, 437, -2886, 28166, 9877, -4479, 2453, -1278, 581, -213, 55, -7, 39, -124, 252, -351, 244, 442, -2895, 28157, 9895, -4484, 2455, -1278, 581, -213, 55, -7, 39, -124, 251, -349, 242, 447, -2904, 28148, 9913, -4488, 2456, -1279, 581, -213, 55, -7,
+ 39, -124, 251, -348, 239, 451, -2913, 28140, 9931, -4493, 2458, -1279, 581, -213, 55, -7, 38, -123, 250, -347, 236, 456, -2922, 28133, 9949, -4498, 2459, -1279, 581, -213, 55, -7, 38, -123, 249, -345, 233, 461, -2932, 28125, 9968, -4502, 2460, -1280, 581, -213, 55, -7, 38, -123, 249, -344, 231, 466, -2941, 28115, 9986, -4507, 2462, -1280, 581, -213, 55, -7,
+ 38, -123, 248, -343, 228, 471, -2950, 28107, 10004, -4511, 2463, -1280, 581, -213, 55, -7, 38, -122, 248, -341, 225, 476, -2959, 28096, 10022, -4516, 2465, -1281, 581, -212, 55, -7, 38, -122, 247, -340, 223, 481, -2968, 28087, 10041, -4521, 2466, -1281, 581, -212, 55, -7, 38, -122, 246, -338, 220, 486, -2977, 28077, 10059, -4525, 2468, -1281, 581, -212, 55, -7,
+ 38, -122, 246, -337, 217, 491, -2986, 28070, 10077, -4530, 2469, -1282, 581, -212, 55, -7, 38, -122, 245, -336, 215, 496, -2995, 28061, 10095, -4534, 2470, -1282, 581, -212, 55, -7, 38, -121, 245, -334, 212, 501, -3004, 28051, 10113, -4539, 2472, -1282, 580, -212, 55, -7, 38, -121, 244, -333, 209, 506, -3012, 28042, 10132, -4544, 2473, -1282, 580, -212, 55, -7,
+ 38, -121, 243, -332, 206, 511, -3021, 28034, 10150, -4548, 2475, -1283, 580, -212, 55, -7, 38, -121, 243, -330, 204, 516, -3030, 28024, 10168, -4553, 2476, -1283, 580, -212, 55, -7, 38, -121, 242, -329, 201, 521, -3039, 28015, 10187, -4557, 2478, -1283, 580, -212, 54, -7, 38, -120, 242, -328, 198, 525, -3048, 28008, 10205, -4562, 2479, -1284, 580, -212, 54, -7,
+ 38, -120, 241, -326, 196, 530, -3057, 27997, 10223, -4566, 2480, -1284, 580, -211, 54, -7, 38, -120, 241, -325, 193, 535, -3066, 27988, 10241, -4571, 2482, -1284, 580, -211, 54, -7, 38, -120, 240, -324, 190, 540, -3075, 27979, 10260, -4575, 2483, -1284, 580, -211, 54, -7, 37, -120, 239, -322, 188, 545, -3083, 27971, 10278, -4580, 2484, -1285, 580, -211, 54, -7,
+ 37, -119, 239, -321, 185, 550, -3092, 27960, 10296, -4584, 2486, -1285, 580, -211, 54, -7, 37, -119, 238, -319, 182, 555, -3101, 27952, 10314, -4589, 2487, -1285, 580, -211, 54, -7, 37, -119, 238, -318, 180, 560, -3110, 27941, 10333, -4593, 2489, -1286, 580, -211, 54, -7, 37, -119, 237, -317, 177, 564, -3119, 27935, 10351, -4598, 2490, -1286, 580, -211, 54, -7,
+ 37, -118, 236, -315, 174, 569, -3127, 27924, 10369, -4602, 2491, -1286, 580, -211, 54, -7, 37, -118, 236, -314, 172, 574, -3136, 27913, 10388, -4607, 2493, -1286, 580, -211, 54, -7, 37, -118, 235, -313, 169, 579, -3145, 27906, 10406, -4611, 2494, -1287, 579, -210, 54, -7, 37, -118, 235, -311, 166, 584, -3154, 27897, 10424, -4616, 2495, -1287, 579, -210, 54, -7,
+ 37, -118, 234, -310, 164, 589, -3162, 27885, 10443, -4620, 2497, -1287, 579, -210, 54, -7, 37, -117, 233, -309, 161, 594, -3171, 27877, 10461, -4625, 2498, -1287, 579, -210, 54, -7, 37, -117, 233, -307, 158, 598, -3180, 27868, 10479, -4629, 2499, -1288, 579, -210, 54, -6, 37, -117, 232, -306, 155, 603, -3188, 27859, 10497, -4634, 2501, -1288, 579, -210, 54, -6,
+ 37, -117, 232, -305, 153, 608, -3197, 27848, 10516, -4638, 2502, -1288, 579, -210, 54, -6, 37, -117, 231, -303, 150, 613, -3205, 27838, 10534, -4642, 2503, -1288, 579, -210, 54, -6, 37, -116, 230, -302, 147, 618, -3214, 27831, 10552, -4647, 2505, -1289, 579, -210, 53, -6, 37, -116, 230, -301, 145, 623, -3223, 27819, 10571, -4651, 2506, -1289, 579, -209, 53, -6,
+ 36, -116, 229, -299, 142, 627, -3231, 27812, 10589, -4656, 2507, -1289, 579, -209, 53, -6, 36, -116, 229, -298, 140, 632, -3240, 27801, 10607, -4660, 2509, -1289, 579, -209, 53, -6, 36, -115, 228, -297, 137, 637, -3248, 27792, 10626, -4665, 2510, -1290, 579, -209, 53, -6, 36, -115, 228, -295, 134, 642, -3257, 27783, 10644, -4669, 2511, -1290, 578, -209, 53, -6,
+ 36, -115, 227, -294, 132, 647, -3265, 27773, 10662, -4673, 2512, -1290, 578, -209, 53, -6, 36, -115, 226, -292, 129, 651, -3274, 27764, 10681, -4678, 2514, -1290, 578, -209, 53, -6, 36, -115, 226, -291, 126, 656, -3282, 27754, 10699, -4682, 2515, -1290, 578, -209, 53, -6, 36, -114, 225, -290, 124, 661, -3291, 27744, 10718, -4686, 2516, -1291, 578, -209, 53, -6,
+ 36, -114, 225, -288, 121, 666, -3299, 27733, 10736, -4691, 2518, -1291, 578, -209, 53, -6, 36, -114, 224, -287, 118, 670, -3308, 27725, 10754, -4695, 2519, -1291, 578, -208, 53, -6, 36, -114, 223, -286, 116, 675, -3316, 27715, 10773, -4700, 2520, -1291, 578, -208, 53, -6, 36, -114, 223, -284, 113, 680, -3325, 27705, 10791, -4704, 2521, -1291, 578, -208, 53, -6,
+ 36, -113, 222, -283, 110, 685, -3333, 27695, 10809, -4708, 2523, -1292, 578, -208, 53, -6, 36, -113, 222, -282, 108, 689, -3341, 27686, 10828, -4713, 2524, -1292, 577, -208, 53, -6, 36, -113, 221, -280, 105, 694, -3350, 27677, 10846, -4717, 2525, -1292, 577, -208, 53, -6, 36, -113, 220, -279, 102, 699, -3358, 27668, 10864, -4721, 2526, -1292, 577, -208, 53, -6,
+ 36, -113, 220, -278, 100, 704, -3367, 27658, 10883, -4726, 2528, -1292, 577, -208, 52, -6, 36, -112, 219, -276, 97, 708, -3375, 27648, 10901, -4730, 2529, -1293, 577, -207, 52, -6, 35, -112, 219, -275, 95, 713, -3383, 27637, 10920, -4734, 2530, -1293, 577, -207, 52, -6, 35, -112, 218, -274, 92, 718, -3391, 27628, 10938, -4738, 2531, -1293, 577, -207, 52, -6,
+ 35, -112, 217, -272, 89, 723, -3400, 27620, 10956, -4743, 2532, -1293, 577, -207, 52, -6, 35, -111, 217, -271, 87, 727, -3408, 27607, 10975, -4747, 2534, -1293, 577, -207, 52, -6, 35, -111, 216, -270, 84, 732, -3416, 27599, 10993, -4751, 2535, -1294, 577, -207, 52, -6, 35, -111, 216, -268, 81, 737, -3425, 27590, 11011, -4755, 2536, -1294, 576, -207, 52, -6,
+ 35, -111, 215, -267, 79, 741, -3433, 27581, 11030, -4760, 2537, -1294, 576, -207, 52, -6, 35, -111, 214, -266, 76, 746, -3441, 27572, 11048, -4764, 2538, -1294, 576, -207, 52, -6, 35, -110, 214, -264, 73, 751, -3449, 27557, 11067, -4768, 2540, -1294, 576, -206, 52, -6, 35, -110, 213, -263, 71, 755, -3457, 27548, 11085, -4772, 2541, -1294, 576, -206, 52, -6,
+ 35, -110, 213, -262, 68, 760, -3466, 27540, 11104, -4777, 2542, -1295, 576, -206, 52, -6, 35, -110, 212, -260, 66, 765, -3474, 27529, 11122, -4781, 2543, -1295, 576, -206, 52, -6, 35, -110, 212, -259, 63, 769, -3482, 27520, 11140, -4785, 2544, -1295, 576, -206, 52, -6, 35, -109, 211, -258, 60, 774, -3490, 27510, 11159, -4789, 2545, -1295, 575, -206, 52, -6,
+ 35, -109, 210, -256, 58, 779, -3498, 27499, 11177, -4794, 2547, -1295, 575, -206, 52, -6, 35, -109, 210, -255, 55, 783, -3506, 27490, 11196, -4798, 2548, -1295, 575, -206, 51, -6, 35, -109, 209, -254, 53, 788, -3514, 27479, 11214, -4802, 2549, -1295, 575, -205, 51, -6, 35, -108, 209, -252, 50, 793, -3522, 27468, 11232, -4806, 2550, -1296, 575, -205, 51, -6,
+ 34, -108, 208, -251, 47, 797, -3530, 27460, 11251, -4810, 2551, -1296, 575, -205, 51, -6, 34, -108, 207, -250, 45, 802, -3538, 27450, 11269, -4814, 2552, -1296, 575, -205, 51, -6, 34, -108, 207, -248, 42, 807, -3546, 27438, 11288, -4819, 2554, -1296, 575, -205, 51, -6, 34, -108, 206, -247, 40, 811, -3554, 27430, 11306, -4823, 2555, -1296, 574, -205, 51, -6,
+ 34, -107, 206, -246, 37, 816, -3562, 27418, 11325, -4827, 2556, -1296, 574, -205, 51, -6, 34, -107, 205, -244, 34, 821, -3570, 27407, 11343, -4831, 2557, -1296, 574, -204, 51, -6, 34, -107, 204, -243, 32, 825, -3578, 27398, 11361, -4835, 2558, -1296, 574, -204, 51, -6, 34, -107, 204, -242, 29, 830, -3586, 27388, 11380, -4839, 2559, -1297, 574, -204, 51, -6,
+ 34, -107, 203, -240, 27, 834, -3594, 27378, 11398, -4843, 2560, -1297, 574, -204, 51, -6, 34, -106, 203, -239, 24, 839, -3602, 27367, 11417, -4848, 2561, -1297, 574, -204, 51, -6, 34, -106, 202, -238, 21, 844, -3610, 27359, 11435, -4852, 2562, -1297, 573, -204, 51, -6, 34, -106, 201, -236, 19, 848, -3618, 27347, 11454, -4856, 2564, -1297, 573, -204, 51, -6,
+ 34, -106, 201, -235, 16, 853, -3626, 27337, 11472, -4860, 2565, -1297, 573, -204, 51, -6, 34, -105, 200, -234, 14, 857, -3634, 27326, 11491, -4864, 2566, -1297, 573, -203, 50, -6, 34, -105, 200, -232, 11, 862, -3642, 27315, 11509, -4868, 2567, -1297, 573, -203, 50, -6, 34, -105, 199, -231, 8, 866, -3649, 27306, 11527, -4872, 2568, -1297, 573, -203, 50, -6,
+ 34, -105, 199, -230, 6, 871, -3657, 27296, 11546, -4876, 2569, -1298, 572, -203, 50, -6, 33, -105, 198, -228, 3, 876, -3665, 27287, 11564, -4880, 2570, -1298, 572, -203, 50, -6, 33, -104, 197, -227, 1, 880, -3673, 27276, 11583, -4884, 2571, -1298, 572, -203, 50, -6, 33, -104, 197, -226, -2, 885, -3681, 27266, 11601, -4888, 2572, -1298, 572, -203, 50, -6,
+ 33, -104, 196, -224, -4, 889, -3688, 27253, 11620, -4892, 2573, -1298, 572, -202, 50, -6, 33, -104, 196, -223, -7, 894, -3696, 27243, 11638, -4896, 2574, -1298, 572, -202, 50, -6, 33, -104, 195, -222, -10, 898, -3704, 27234, 11657, -4900, 2575, -1298, 572, -202, 50, -6, 33, -103, 194, -220, -12, 903, -3712, 27223, 11675, -4904, 2576, -1298, 571, -202, 50, -6,
+ 33, -103, 194, -219, -15, 907, -3719, 27212, 11694, -4908, 2577, -1298, 571, -202, 50, -6, 33, -103, 193, -218, -17, 912, -3727, 27202, 11712, -4912, 2578, -1298, 571, -202, 50, -6, 33, -103, 193, -216, -20, 916, -3735, 27191, 11731, -4916, 2579, -1298, 571, -202, 50, -6, 33, -102, 192, -215, -22, 921, -3742, 27178, 11749, -4920, 2580, -1298, 571, -201, 50, -6,
+ 33, -102, 191, -214, -25, 925, -3750, 27171, 11768, -4924, 2581, -1299, 571, -201, 49, -6, 33, -102, 191, -212, -28, 930, -3758, 27161, 11786, -4928, 2582, -1299, 570, -201, 49, -6, 33, -102, 190, -211, -30, 934, -3765, 27151, 11804, -4932, 2583, -1299, 570, -201, 49, -6, 33, -102, 190, -210, -33, 939, -3773, 27140, 11823, -4936, 2584, -1299, 570, -201, 49, -6,
+ 33, -101, 189, -208, -35, 943, -3780, 27128, 11841, -4940, 2585, -1299, 570, -201, 49, -6, 33, -101, 188, -207, -38, 948, -3788, 27118, 11860, -4944, 2586, -1299, 570, -201, 49, -6, 33, -101, 188, -206, -40, 952, -3796, 27108, 11878, -4948, 2587, -1299, 569, -200, 49, -6, 32, -101, 187, -204, -43, 957, -3803, 27097, 11897, -4952, 2588, -1299, 569, -200, 49, -6,
+ 32, -101, 187, -203, -45, 961, -3811, 27086, 11915, -4956, 2589, -1299, 569, -200, 49, -5, 32, -100, 186, -202, -48, 966, -3818, 27074, 11934, -4960, 2590, -1299, 569, -200, 49, -5, 32, -100, 186, -201, -51, 970, -3826, 27065, 11952, -4964, 2591, -1299, 569, -200, 49, -5, 32, -100, 185, -199, -53, 975, -3833, 27052, 11971, -4968, 2592, -1299, 569, -200, 49, -5,
+ 32, -100, 184, -198, -56, 979, -3841, 27043, 11989, -4971, 2593, -1299, 568, -199, 49, -5, 32, -99, 184, -197, -58, 984, -3848, 27029, 12008, -4975, 2594, -1299, 568, -199, 49, -5, 32, -99, 183, -195, -61, 988, -3855, 27019, 12026, -4979, 2595, -1299, 568, -199, 49, -5, 32, -99, 183, -194, -63, 992, -3863, 27009, 12045, -4983, 2596, -1299, 568, -199, 48, -5,
+ 32, -99, 182, -193, -66, 997, -3870, 26999, 12063, -4987, 2597, -1299, 568, -199, 48, -5, 32, -99, 181, -191, -68, 1001, -3878, 26989, 12082, -4991, 2598, -1299, 567, -199, 48, -5, 32, -98, 181, -190, -71, 1006, -3885, 26977, 12100, -4995, 2599, -1299, 567, -199, 48, -5, 32, -98, 180, -189, -73, 1010, -3892, 26964, 12119, -4998, 2600, -1299, 567, -198, 48, -5,
+ 32, -98, 180, -187, -76, 1014, -3900, 26954, 12137, -5002, 2601, -1299, 567, -198, 48, -5, 32, -98, 179, -186, -78, 1019, -3907, 26942, 12156, -5006, 2602, -1299, 567, -198, 48, -5, 32, -98, 178, -185, -81, 1023, -3914, 26935, 12174, -5010, 2602, -1299, 566, -198, 48, -5, 32, -97, 178, -183, -83, 1028, -3922, 26921, 12193, -5014, 2603, -1299, 566, -198, 48, -5,
+ 31, -97, 177, -182, -86, 1032, -3929, 26913, 12211, -5018, 2604, -1299, 566, -198, 48, -5, 31, -97, 177, -181, -88, 1036, -3936, 26899, 12230, -5021, 2605, -1299, 566, -197, 48, -5, 31, -97, 176, -179, -91, 1041, -3944, 26889, 12248, -5025, 2606, -1299, 566, -197, 48, -5, 31, -96, 176, -178, -94, 1045, -3951, 26878, 12267, -5029, 2607, -1299, 565, -197, 48, -5,
+ 31, -96, 175, -177, -96, 1050, -3958, 26867, 12285, -5033, 2608, -1299, 565, -197, 48, -5, 31, -96, 174, -176, -99, 1054, -3965, 26857, 12304, -5036, 2609, -1299, 565, -197, 47, -5, 31, -96, 174, -174, -101, 1058, -3973, 26846, 12322, -5040, 2610, -1299, 565, -197, 47, -5, 31, -96, 173, -173, -104, 1063, -3980, 26835, 12341, -5044, 2610, -1299, 565, -196, 47, -5,
+ 31, -95, 173, -172, -106, 1067, -3987, 26823, 12360, -5048, 2611, -1299, 564, -196, 47, -5, 31, -95, 172, -170, -109, 1071, -3994, 26812, 12378, -5051, 2612, -1299, 564, -196, 47, -5, 31, -95, 171, -169, -111, 1076, -4001, 26800, 12397, -5055, 2613, -1299, 564, -196, 47, -5, 31, -95, 171, -168, -114, 1080, -4008, 26790, 12415, -5059, 2614, -1299, 564, -196, 47, -5,
+ 31, -95, 170, -166, -116, 1084, -4015, 26778, 12434, -5062, 2615, -1299, 563, -196, 47, -5, 31, -94, 170, -165, -119, 1089, -4023, 26767, 12452, -5066, 2615, -1299, 563, -195, 47, -5, 31, -94, 169, -164, -121, 1093, -4030, 26756, 12471, -5070, 2616, -1299, 563, -195, 47, -5, 31, -94, 168, -163, -124, 1097, -4037, 26747, 12489, -5074, 2617, -1299, 563, -195, 47, -5,
+ 31, -94, 168, -161, -126, 1102, -4044, 26732, 12508, -5077, 2618, -1299, 563, -195, 47, -5, 31, -93, 167, -160, -129, 1106, -4051, 26723, 12526, -5081, 2619, -1299, 562, -195, 47, -5, 30, -93, 167, -159, -131, 1110, -4058, 26713, 12545, -5085, 2620, -1299, 562, -195, 46, -5, 30, -93, 166, -157, -133, 1114, -4065, 26701, 12563, -5088, 2620, -1299, 562, -194, 46, -5,
+ 30, -93, 166, -156, -136, 1119, -4072, 26689, 12582, -5092, 2621, -1299, 562, -194, 46, -5, 30, -93, 165, -155, -138, 1123, -4079, 26679, 12600, -5095, 2622, -1299, 561, -194, 46, -5, 30, -92, 164, -153, -141, 1127, -4086, 26666, 12619, -5099, 2623, -1298, 561, -194, 46, -5, 30, -92, 164, -152, -143, 1132, -4093, 26655, 12637, -5103, 2623, -1298, 561, -194, 46, -5,
+ 30, -92, 163, -151, -146, 1136, -4100, 26644, 12656, -5106, 2624, -1298, 561, -194, 46, -5, 30, -92, 163, -150, -148, 1140, -4107, 26633, 12674, -5110, 2625, -1298, 560, -193, 46, -5, 30, -92, 162, -148, -151, 1144, -4114, 26622, 12693, -5114, 2626, -1298, 560, -193, 46, -5, 30, -91, 161, -147, -153, 1149, -4120, 26607, 12712, -5117, 2627, -1298, 560, -193, 46, -5,
+ 30, -91, 161, -146, -156, 1153, -4127, 26598, 12730, -5121, 2627, -1298, 560, -193, 46, -5, 30, -91, 160, -144, -158, 1157, -4134, 26586, 12749, -5124, 2628, -1298, 559, -193, 46, -5, 30, -91, 160, -143, -161, 1161, -4141, 26576, 12767, -5128, 2629, -1298, 559, -193, 46, -5, 30, -90, 159, -142, -163, 1166, -4148, 26562, 12786, -5131, 2630, -1298, 559, -192, 45, -5,
+ 30, -90, 159, -140, -166, 1170, -4155, 26552, 12804, -5135, 2630, -1298, 559, -192, 45, -5, 30, -90, 158, -139, -168, 1174, -4162, 26540, 12823, -5138, 2631, -1298, 559, -192, 45, -5, 30, -90, 157, -138, -171, 1178, -4168, 26531, 12841, -5142, 2632, -1298, 558, -192, 45, -5, 29, -90, 157, -137, -173, 1182, -4175, 26519, 12860, -5146, 2633, -1297, 558, -192, 45, -5,
+ 29, -89, 156, -135, -175, 1187, -4182, 26505, 12878, -5149, 2633, -1297, 558, -191, 45, -5, 29, -89, 156, -134, -178, 1191, -4189, 26495, 12897, -5153, 2634, -1297, 557, -191, 45, -5, 29, -89, 155, -133, -180, 1195, -4195, 26483, 12915, -5156, 2635, -1297, 557, -191, 45, -5, 29, -89, 154, -131, -183, 1199, -4202, 26473, 12934, -5160, 2635, -1297, 557, -191, 45, -5,
+ 29, -89, 154, -130, -185, 1203, -4209, 26461, 12952, -5163, 2636, -1297, 557, -191, 45, -5, 29, -88, 153, -129, -188, 1208, -4216, 26450, 12971, -5167, 2637, -1297, 556, -191, 45, -5, 29, -88, 153, -128, -190, 1212, -4222, 26436, 12990, -5170, 2637, -1297, 556, -190, 45, -5, 29, -88, 152, -126, -193, 1216, -4229, 26425, 13008, -5173, 2638, -1297, 556, -190, 45, -5,
+ 29, -88, 152, -125, -195, 1220, -4236, 26412, 13027, -5177, 2639, -1296, 556, -190, 44, -4, 29, -87, 151, -124, -197, 1224, -4242, 26401, 13045, -5180, 2639, -1296, 555, -190, 44, -4, 29, -87, 150, -122, -200, 1228, -4249, 26390, 13064, -5184, 2640, -1296, 555, -190, 44, -4, 29, -87, 150, -121, -202, 1232, -4255, 26376, 13082, -5187, 2641, -1296, 555, -189, 44, -4,
+ 29, -87, 149, -120, -205, 1237, -4262, 26366, 13101, -5191, 2641, -1296, 555, -189, 44, -4, 29, -87, 149, -119, -207, 1241, -4269, 26355, 13119, -5194, 2642, -1296, 554, -189, 44, -4, 29, -86, 148, -117, -210, 1245, -4275, 26341, 13138, -5197, 2643, -1296, 554, -189, 44, -4, 29, -86, 148, -116, -212, 1249, -4282, 26330, 13156, -5201, 2643, -1295, 554, -189, 44, -4,
+ 29, -86, 147, -115, -214, 1253, -4288, 26317, 13175, -5204, 2644, -1295, 553, -188, 44, -4, 28, -86, 146, -114, -217, 1257, -4295, 26308, 13194, -5208, 2645, -1295, 553, -188, 44, -4, 28, -86, 146, -112, -219, 1261, -4301, 26295, 13212, -5211, 2645, -1295, 553, -188, 44, -4, 28, -85, 145, -111, -222, 1265, -4308, 26283, 13231, -5214, 2646, -1295, 553, -188, 44, -4,
+ 28, -85, 145, -110, -224, 1270, -4314, 26272, 13249, -5218, 2647, -1295, 552, -188, 43, -4, 28, -85, 144, -108, -226, 1274, -4321, 26259, 13268, -5221, 2647, -1295, 552, -187, 43, -4, 28, -85, 143, -107, -229, 1278, -4327, 26247, 13286, -5224, 2648, -1294, 552, -187, 43, -4, 28, -85, 143, -106, -231, 1282, -4334, 26236, 13305, -5228, 2648, -1294, 552, -187, 43, -4,
+ 28, -84, 142, -105, -234, 1286, -4340, 26225, 13323, -5231, 2649, -1294, 551, -187, 43, -4, 28, -84, 142, -103, -236, 1290, -4346, 26210, 13342, -5234, 2650, -1294, 551, -187, 43, -4, 28, -84, 141, -102, -238, 1294, -4353, 26201, 13360, -5238, 2650, -1294, 551, -187, 43, -4, 28, -84, 141, -101, -241, 1298, -4359, 26187, 13379, -5241, 2651, -1293, 550, -186, 43, -4,
+ 28, -83, 140, -100, -243, 1302, -4365, 26175, 13397, -5244, 2651, -1293, 550, -186, 43, -4, 28, -83, 139, -98, -246, 1306, -4372, 26163, 13416, -5247, 2652, -1293, 550, -186, 43, -4, 28, -83, 139, -97, -248, 1310, -4378, 26152, 13435, -5251, 2652, -1293, 549, -186, 43, -4, 28, -83, 138, -96, -250, 1314, -4384, 26141, 13453, -5254, 2653, -1293, 549, -186, 42, -4,
+ 28, -83, 138, -94, -253, 1318, -4391, 26127, 13472, -5257, 2654, -1293, 549, -185, 42, -4, 28, -82, 137, -93, -255, 1322, -4397, 26114, 13490, -5260, 2654, -1292, 549, -185, 42, -4, 28, -82, 137, -92, -258, 1326, -4403, 26103, 13509, -5264, 2655, -1292, 548, -185, 42, -4, 27, -82, 136, -91, -260, 1330, -4410, 26094, 13527, -5267, 2655, -1292, 548, -185, 42, -4,
+ 27, -82, 135, -89, -262, 1334, -4416, 26080, 13546, -5270, 2656, -1292, 548, -185, 42, -4, 27, -82, 135, -88, -265, 1338, -4422, 26069, 13564, -5273, 2656, -1292, 547, -184, 42, -4, 27, -81, 134, -87, -267, 1342, -4428, 26055, 13583, -5277, 2657, -1291, 547, -184, 42, -4, 27, -81, 134, -86, -269, 1346, -4434, 26043, 13601, -5280, 2657, -1291, 547, -184, 42, -4,
+ 27, -81, 133, -84, -272, 1350, -4441, 26032, 13620, -5283, 2658, -1291, 546, -184, 42, -4, 27, -81, 132, -83, -274, 1354, -4447, 26020, 13638, -5286, 2658, -1291, 546, -183, 42, -4, 27, -80, 132, -82, -277, 1358, -4453, 26005, 13657, -5289, 2659, -1290, 546, -183, 42, -4, 27, -80, 131, -81, -279, 1362, -4459, 25995, 13676, -5292, 2659, -1290, 545, -183, 41, -4,
+ 27, -80, 131, -79, -281, 1366, -4465, 25982, 13694, -5296, 2660, -1290, 545, -183, 41, -4, 27, -80, 130, -78, -284, 1370, -4471, 25971, 13713, -5299, 2660, -1290, 545, -183, 41, -4, 27, -80, 130, -77, -286, 1374, -4477, 25957, 13731, -5302, 2661, -1290, 545, -182, 41, -4, 27, -79, 129, -76, -288, 1378, -4483, 25944, 13750, -5305, 2661, -1289, 544, -182, 41, -4,
+ 27, -79, 128, -74, -291, 1382, -4490, 25933, 13768, -5308, 2662, -1289, 544, -182, 41, -4, 27, -79, 128, -73, -293, 1386, -4496, 25920, 13787, -5311, 2662, -1289, 544, -182, 41, -4, 27, -79, 127, -72, -295, 1390, -4502, 25909, 13805, -5314, 2663, -1289, 543, -182, 41, -4, 27, -79, 127, -71, -298, 1394, -4508, 25895, 13824, -5317, 2663, -1288, 543, -181, 41, -4,
+ 26, -78, 126, -69, -300, 1398, -4514, 25882, 13842, -5320, 2664, -1288, 543, -181, 41, -4, 26, -78, 126, -68, -302, 1402, -4520, 25871, 13861, -5324, 2664, -1288, 542, -181, 41, -4, 26, -78, 125, -67, -305, 1406, -4526, 25862, 13879, -5327, 2664, -1288, 542, -181, 40, -4, 26, -78, 124, -66, -307, 1409, -4532, 25849, 13898, -5330, 2665, -1287, 542, -181, 40, -4,
+ 26, -77, 124, -64, -309, 1413, -4538, 25835, 13916, -5333, 2665, -1287, 541, -180, 40, -4, 26, -77, 123, -63, -312, 1417, -4543, 25822, 13935, -5336, 2666, -1287, 541, -180, 40, -4, 26, -77, 123, -62, -314, 1421, -4549, 25809, 13953, -5339, 2666, -1286, 541, -180, 40, -4, 26, -77, 122, -61, -316, 1425, -4555, 25796, 13972, -5342, 2667, -1286, 540, -180, 40, -3,
+ 26, -77, 122, -59, -319, 1429, -4561, 25783, 13990, -5345, 2667, -1286, 540, -179, 40, -3, 26, -76, 121, -58, -321, 1433, -4567, 25770, 14009, -5348, 2667, -1286, 540, -179, 40, -3, 26, -76, 120, -57, -323, 1437, -4573, 25757, 14028, -5351, 2668, -1285, 539, -179, 40, -3, 26, -76, 120, -56, -326, 1441, -4579, 25746, 14046, -5354, 2668, -1285, 539, -179, 40, -3,
+ 26, -76, 119, -54, -328, 1444, -4585, 25733, 14065, -5357, 2669, -1285, 539, -179, 40, -3, 26, -76, 119, -53, -330, 1448, -4590, 25721, 14083, -5360, 2669, -1285, 538, -178, 39, -3, 26, -75, 118, -52, -333, 1452, -4596, 25708, 14102, -5363, 2669, -1284, 538, -178, 39, -3, 26, -75, 118, -51, -335, 1456, -4602, 25696, 14120, -5366, 2670, -1284, 537, -178, 39, -3,
+ 26, -75, 117, -49, -337, 1460, -4608, 25683, 14139, -5369, 2670, -1284, 537, -178, 39, -3, 26, -75, 116, -48, -340, 1464, -4614, 25670, 14157, -5371, 2670, -1283, 537, -177, 39, -3, 25, -75, 116, -47, -342, 1467, -4619, 25658, 14176, -5374, 2671, -1283, 536, -177, 39, -3, 25, -74, 115, -46, -344, 1471, -4625, 25646, 14194, -5377, 2671, -1283, 536, -177, 39, -3,
+ 25, -74, 115, -44, -346, 1475, -4631, 25631, 14213, -5380, 2671, -1282, 536, -177, 39, -3, 25, -74, 114, -43, -349, 1479, -4636, 25620, 14231, -5383, 2672, -1282, 535, -177, 39, -3, 25, -74, 114, -42, -351, 1483, -4642, 25606, 14250, -5386, 2672, -1282, 535, -176, 39, -3, 25, -73, 113, -41, -353, 1486, -4648, 25595, 14268, -5389, 2672, -1281, 535, -176, 38, -3,
+ 25, -73, 112, -39, -356, 1490, -4653, 25582, 14287, -5392, 2673, -1281, 534, -176, 38, -3, 25, -73, 112, -38, -358, 1494, -4659, 25570, 14305, -5395, 2673, -1281, 534, -176, 38, -3, 25, -73, 111, -37, -360, 1498, -4665, 25556, 14324, -5397, 2673, -1281, 534, -175, 38, -3, 25, -73, 111, -36, -363, 1502, -4670, 25543, 14342, -5400, 2674, -1280, 533, -175, 38, -3,
+ 25, -72, 110, -35, -365, 1505, -4676, 25531, 14361, -5403, 2674, -1280, 533, -175, 38, -3, 25, -72, 110, -33, -367, 1509, -4682, 25519, 14379, -5406, 2674, -1280, 532, -175, 38, -3, 25, -72, 109, -32, -369, 1513, -4687, 25503, 14398, -5409, 2675, -1279, 532, -174, 38, -3, 25, -72, 109, -31, -372, 1517, -4693, 25492, 14416, -5412, 2675, -1279, 532, -174, 38, -3,
+ 25, -72, 108, -30, -374, 1520, -4698, 25479, 14435, -5414, 2675, -1278, 531, -174, 38, -3, 25, -71, 107, -28, -376, 1524, -4704, 25466, 14453, -5417, 2675, -1278, 531, -174, 38, -3, 25, -71, 107, -27, -378, 1528, -4709, 25452, 14472, -5420, 2676, -1278, 531, -174, 37, -3, 25, -71, 106, -26, -381, 1532, -4715, 25441, 14490, -5423, 2676, -1277, 530, -173, 37, -3,
+ 24, -71, 106, -25, -383, 1535, -4720, 25428, 14509, -5425, 2676, -1277, 530, -173, 37, -3, 24, -71, 105, -23, -385, 1539, -4726, 25417, 14527, -5428, 2676, -1277, 529, -173, 37, -3, 24, -70, 105, -22, -388, 1543, -4731, 25401, 14546, -5431, 2677, -1276, 529, -173, 37, -3, 24, -70, 104, -21, -390, 1546, -4737, 25390, 14564, -5434, 2677, -1276, 529, -172, 37, -3,
+ 24, -70, 103, -20, -392, 1550, -4742, 25377, 14583, -5436, 2677, -1276, 528, -172, 37, -3, 24, -70, 103, -19, -394, 1554, -4747, 25363, 14601, -5439, 2677, -1275, 528, -172, 37, -3, 24, -70, 102, -17, -397, 1557, -4753, 25351, 14620, -5442, 2678, -1275, 528, -172, 37, -3, 24, -69, 102, -16, -399, 1561, -4758, 25336, 14638, -5444, 2678, -1275, 527, -171, 37, -3,
+ 24, -69, 101, -15, -401, 1565, -4764, 25324, 14657, -5447, 2678, -1274, 527, -171, 36, -3, 24, -69, 101, -14, -403, 1568, -4769, 25313, 14675, -5450, 2678, -1274, 526, -171, 36, -3, 24, -69, 100, -13, -405, 1572, -4774, 25299, 14693, -5452, 2678, -1273, 526, -171, 36, -3, 24, -68, 99, -11, -408, 1576, -4780, 25284, 14712, -5455, 2679, -1273, 526, -170, 36, -3,
+ 24, -68, 99, -10, -410, 1579, -4785, 25273, 14730, -5458, 2679, -1273, 525, -170, 36, -3, 24, -68, 98, -9, -412, 1583, -4790, 25258, 14749, -5460, 2679, -1272, 525, -170, 36, -3, 24, -68, 98, -8, -414, 1587, -4796, 25247, 14767, -5463, 2679, -1272, 524, -170, 36, -3, 24, -68, 97, -6, -417, 1590, -4801, 25233, 14786, -5466, 2679, -1271, 524, -169, 36, -3,
+ 24, -67, 97, -5, -419, 1594, -4806, 25216, 14804, -5468, 2680, -1271, 524, -169, 36, -2, 24, -67, 96, -4, -421, 1598, -4811, 25205, 14823, -5471, 2680, -1271, 523, -169, 35, -2, 23, -67, 96, -3, -423, 1601, -4816, 25192, 14841, -5473, 2680, -1270, 523, -169, 35, -2, 23, -67, 95, -2, -426, 1605, -4822, 25181, 14860, -5476, 2680, -1270, 522, -168, 35, -2,
+ 23, -67, 94, 0, -428, 1608, -4827, 25168, 14878, -5479, 2680, -1269, 522, -168, 35, -2, 23, -66, 94, 1, -430, 1612, -4832, 25152, 14897, -5481, 2680, -1269, 522, -168, 35, -2, 23, -66, 93, 2, -432, 1616, -4837, 25140, 14915, -5484, 2680, -1268, 521, -168, 35, -2, 23, -66, 93, 3, -434, 1619, -4842, 25126, 14933, -5486, 2681, -1268, 521, -168, 35, -2,
+ 23, -66, 92, 4, -437, 1623, -4848, 25115, 14952, -5489, 2681, -1268, 520, -167, 35, -2, 23, -66, 92, 6, -439, 1626, -4853, 25100, 14970, -5491, 2681, -1267, 520, -167, 35, -2, 23, -65, 91, 7, -441, 1630, -4858, 25087, 14989, -5494, 2681, -1267, 519, -167, 35, -2, 23, -65, 91, 8, -443, 1634, -4863, 25072, 15007, -5496, 2681, -1266, 519, -166, 34, -2,
+ 23, -65, 90, 9, -445, 1637, -4868, 25060, 15026, -5499, 2681, -1266, 519, -166, 34, -2, 23, -65, 89, 10, -448, 1641, -4873, 25048, 15044, -5501, 2681, -1265, 518, -166, 34, -2, 23, -65, 89, 12, -450, 1644, -4878, 25034, 15063, -5504, 2681, -1265, 518, -166, 34, -2, 23, -64, 88, 13, -452, 1648, -4883, 25020, 15081, -5506, 2681, -1265, 517, -165, 34, -2,
+ 23, -64, 88, 14, -454, 1651, -4888, 25007, 15099, -5509, 2681, -1264, 517, -165, 34, -2, 23, -64, 87, 15, -456, 1655, -4893, 24993, 15118, -5511, 2682, -1264, 516, -165, 34, -2, 23, -64, 87, 16, -459, 1658, -4898, 24981, 15136, -5514, 2682, -1263, 516, -165, 34, -2, 23, -63, 86, 18, -461, 1662, -4903, 24964, 15155, -5516, 2682, -1263, 516, -164, 34, -2,
+ 23, -63, 86, 19, -463, 1665, -4908, 24951, 15173, -5518, 2682, -1262, 515, -164, 34, -2, 22, -63, 85, 20, -465, 1669, -4913, 24940, 15192, -5521, 2682, -1262, 515, -164, 33, -2, 22, -63, 84, 21, -467, 1672, -4918, 24928, 15210, -5523, 2682, -1261, 514, -164, 33, -2, 22, -63, 84, 22, -469, 1676, -4923, 24914, 15228, -5526, 2682, -1261, 514, -163, 33, -2,
+ 22, -62, 83, 24, -472, 1679, -4928, 24900, 15247, -5528, 2682, -1260, 513, -163, 33, -2, 22, -62, 83, 25, -474, 1683, -4933, 24886, 15265, -5530, 2682, -1260, 513, -163, 33, -2, 22, -62, 82, 26, -476, 1686, -4938, 24873, 15284, -5533, 2682, -1259, 513, -163, 33, -2, 22, -62, 82, 27, -478, 1690, -4942, 24858, 15302, -5535, 2682, -1259, 512, -162, 33, -2,
+ 22, -62, 81, 28, -480, 1693, -4947, 24845, 15320, -5537, 2682, -1258, 512, -162, 33, -2, 22, -61, 81, 29, -482, 1697, -4952, 24831, 15339, -5540, 2682, -1258, 511, -162, 33, -2, 22, -61, 80, 31, -485, 1700, -4957, 24819, 15357, -5542, 2682, -1257, 511, -162, 32, -2, 22, -61, 79, 32, -487, 1704, -4962, 24805, 15376, -5544, 2682, -1257, 510, -161, 32, -2,
+ 22, -61, 79, 33, -489, 1707, -4966, 24791, 15394, -5547, 2682, -1256, 510, -161, 32, -2, 22, -61, 78, 34, -491, 1711, -4971, 24779, 15412, -5549, 2682, -1256, 509, -161, 32, -2, 22, -60, 78, 35, -493, 1714, -4976, 24763, 15431, -5551, 2682, -1255, 509, -161, 32, -2, 22, -60, 77, 37, -495, 1717, -4981, 24750, 15449, -5554, 2682, -1255, 509, -160, 32, -2,
+ 22, -60, 77, 38, -497, 1721, -4986, 24735, 15468, -5556, 2682, -1254, 508, -160, 32, -2, 22, -60, 76, 39, -500, 1724, -4990, 24723, 15486, -5558, 2682, -1254, 508, -160, 32, -2, 22, -60, 76, 40, -502, 1728, -4995, 24708, 15504, -5560, 2682, -1253, 507, -159, 32, -2, 21, -59, 75, 41, -504, 1731, -5000, 24697, 15523, -5563, 2682, -1253, 507, -159, 31, -2,
+ 21, -59, 74, 42, -506, 1735, -5004, 24682, 15541, -5565, 2682, -1252, 506, -159, 31, -1, 21, -59, 74, 44, -508, 1738, -5009, 24668, 15559, -5567, 2682, -1252, 506, -159, 31, -1, 21, -59, 73, 45, -510, 1741, -5014, 24654, 15578, -5569, 2682, -1251, 505, -158, 31, -1, 21, -59, 73, 46, -512, 1745, -5018, 24639, 15596, -5571, 2682, -1251, 505, -158, 31, -1,
+ 21, -58, 72, 47, -515, 1748, -5023, 24627, 15615, -5574, 2682, -1250, 504, -158, 31, -1, 21, -58, 72, 48, -517, 1751, -5027, 24614, 15633, -5576, 2681, -1250, 504, -158, 31, -1, 21, -58, 71, 49, -519, 1755, -5032, 24600, 15651, -5578, 2681, -1249, 503, -157, 31, -1, 21, -58, 71, 51, -521, 1758, -5037, 24585, 15670, -5580, 2681, -1249, 503, -157, 31, -1,
+ 21, -57, 70, 52, -523, 1762, -5041, 24570, 15688, -5582, 2681, -1248, 503, -157, 30, -1, 21, -57, 70, 53, -525, 1765, -5046, 24557, 15706, -5584, 2681, -1248, 502, -156, 30, -1, 21, -57, 69, 54, -527, 1768, -5050, 24543, 15725, -5587, 2681, -1247, 502, -156, 30, -1, 21, -57, 68, 55, -529, 1772, -5055, 24530, 15743, -5589, 2681, -1246, 501, -156, 30, -1,
+ 21, -57, 68, 56, -531, 1775, -5059, 24516, 15761, -5591, 2681, -1246, 501, -156, 30, -1, 21, -56, 67, 58, -534, 1778, -5064, 24501, 15780, -5593, 2681, -1245, 500, -155, 30, -1, 21, -56, 67, 59, -536, 1782, -5068, 24487, 15798, -5595, 2680, -1245, 500, -155, 30, -1, 21, -56, 66, 60, -538, 1785, -5073, 24475, 15816, -5597, 2680, -1244, 499, -155, 30, -1,
+ 21, -56, 66, 61, -540, 1788, -5077, 24460, 15835, -5599, 2680, -1244, 499, -155, 30, -1, 21, -56, 65, 62, -542, 1791, -5082, 24448, 15853, -5601, 2680, -1243, 498, -154, 29, -1, 20, -55, 65, 63, -544, 1795, -5086, 24432, 15871, -5603, 2680, -1242, 498, -154, 29, -1, 20, -55, 64, 65, -546, 1798, -5090, 24418, 15890, -5605, 2680, -1242, 497, -154, 29, -1,
+ 20, -55, 64, 66, -548, 1801, -5095, 24403, 15908, -5607, 2680, -1241, 497, -153, 29, -1, 20, -55, 63, 67, -550, 1805, -5099, 24391, 15926, -5609, 2679, -1241, 496, -153, 29, -1, 20, -55, 63, 68, -552, 1808, -5104, 24376, 15945, -5611, 2679, -1240, 496, -153, 29, -1, 20, -54, 62, 69, -554, 1811, -5108, 24363, 15963, -5613, 2679, -1240, 495, -153, 29, -1,
+ 20, -54, 61, 70, -556, 1814, -5112, 24348, 15981, -5615, 2679, -1239, 495, -152, 29, -1, 20, -54, 61, 71, -559, 1818, -5117, 24336, 15999, -5617, 2679, -1238, 494, -152, 28, -1, 20, -54, 60, 73, -561, 1821, -5121, 24322, 16018, -5619, 2678, -1238, 494, -152, 28, -1, 20, -54, 60, 74, -563, 1824, -5125, 24307, 16036, -5621, 2678, -1237, 493, -151, 28, -1,
+ 20, -53, 59, 75, -565, 1827, -5129, 24293, 16054, -5623, 2678, -1237, 493, -151, 28, -1, 20, -53, 59, 76, -567, 1831, -5134, 24278, 16073, -5625, 2678, -1236, 492, -151, 28, -1, 20, -53, 58, 77, -569, 1834, -5138, 24264, 16091, -5627, 2678, -1235, 492, -151, 28, -1, 20, -53, 58, 78, -571, 1837, -5142, 24251, 16109, -5629, 2677, -1235, 491, -150, 28, -1,
+ 20, -53, 57, 79, -573, 1840, -5146, 24237, 16127, -5631, 2677, -1234, 491, -150, 28, -1, 20, -52, 57, 81, -575, 1843, -5151, 24221, 16146, -5633, 2677, -1233, 490, -150, 28, -1, 20, -52, 56, 82, -577, 1847, -5155, 24207, 16164, -5635, 2677, -1233, 490, -149, 27, -1, 20, -52, 55, 83, -579, 1850, -5159, 24194, 16182, -5636, 2676, -1232, 489, -149, 27, -1,
+ 19, -52, 55, 84, -581, 1853, -5163, 24180, 16201, -5638, 2676, -1232, 489, -149, 27, -1, 19, -52, 54, 85, -583, 1856, -5167, 24166, 16219, -5640, 2676, -1231, 488, -149, 27, 0, 19, -51, 54, 86, -585, 1859, -5171, 24149, 16237, -5642, 2676, -1230, 488, -148, 27, 0, 19, -51, 53, 87, -587, 1863, -5176, 24138, 16255, -5644, 2675, -1230, 487, -148, 27, 0,
+ 19, -51, 53, 89, -589, 1866, -5180, 24121, 16274, -5646, 2675, -1229, 487, -148, 27, 0, 19, -51, 52, 90, -591, 1869, -5184, 24106, 16292, -5647, 2675, -1228, 486, -147, 27, 0, 19, -51, 52, 91, -593, 1872, -5188, 24094, 16310, -5649, 2674, -1228, 486, -147, 26, 0, 19, -50, 51, 92, -595, 1875, -5192, 24080, 16328, -5651, 2674, -1227, 485, -147, 26, 0,
+ 19, -50, 51, 93, -597, 1878, -5196, 24063, 16347, -5653, 2674, -1226, 485, -146, 26, 0, 19, -50, 50, 94, -599, 1881, -5200, 24052, 16365, -5655, 2673, -1226, 484, -146, 26, 0, 19, -50, 50, 95, -601, 1885, -5204, 24035, 16383, -5656, 2673, -1225, 484, -146, 26, 0, 19, -50, 49, 96, -603, 1888, -5208, 24022, 16401, -5658, 2673, -1224, 483, -146, 26, 0,
+ 19, -49, 49, 98, -605, 1891, -5212, 24006, 16419, -5660, 2673, -1224, 482, -145, 26, 0, 19, -49, 48, 99, -607, 1894, -5216, 23992, 16438, -5662, 2672, -1223, 482, -145, 26, 0, 19, -49, 47, 100, -609, 1897, -5220, 23978, 16456, -5663, 2672, -1222, 481, -145, 26, 0, 19, -49, 47, 101, -611, 1900, -5224, 23964, 16474, -5665, 2672, -1222, 481, -144, 25, 0,
+ 19, -49, 46, 102, -613, 1903, -5228, 23952, 16492, -5667, 2671, -1221, 480, -144, 25, 0, 19, -48, 46, 103, -615, 1906, -5232, 23935, 16510, -5668, 2671, -1220, 480, -144, 25, 0, 19, -48, 45, 104, -617, 1909, -5236, 23922, 16529, -5670, 2670, -1220, 479, -143, 25, 0, 18, -48, 45, 105, -619, 1912, -5240, 23908, 16547, -5672, 2670, -1219, 479, -143, 25, 0,
+ 18, -48, 44, 107, -621, 1916, -5243, 23891, 16565, -5673, 2670, -1218, 478, -143, 25, 0, 18, -48, 44, 108, -623, 1919, -5247, 23878, 16583, -5675, 2669, -1218, 478, -143, 25, 0, 18, -47, 43, 109, -625, 1922, -5251, 23863, 16601, -5677, 2669, -1217, 477, -142, 25, 0, 18, -47, 43, 110, -627, 1925, -5255, 23847, 16620, -5678, 2669, -1216, 477, -142, 24, 0,
+ 18, -47, 42, 111, -629, 1928, -5259, 23835, 16638, -5680, 2668, -1215, 476, -142, 24, 0, 18, -47, 42, 112, -631, 1931, -5263, 23820, 16656, -5681, 2668, -1215, 475, -141, 24, 0, 18, -47, 41, 113, -633, 1934, -5266, 23806, 16674, -5683, 2667, -1214, 475, -141, 24, 0, 18, -46, 41, 114, -635, 1937, -5270, 23791, 16692, -5685, 2667, -1213, 474, -141, 24, 0,
+ 18, -46, 40, 115, -637, 1940, -5274, 23777, 16710, -5686, 2666, -1213, 474, -140, 24, 0, 18, -46, 40, 117, -639, 1943, -5278, 23761, 16729, -5688, 2666, -1212, 473, -140, 24, 0, 18, -46, 39, 118, -641, 1946, -5281, 23745, 16747, -5689, 2666, -1211, 473, -140, 24, 0, 18, -46, 38, 119, -643, 1949, -5285, 23733, 16765, -5691, 2665, -1210, 472, -139, 23, 0,
+ 18, -45, 38, 120, -645, 1952, -5289, 23717, 16783, -5692, 2665, -1210, 472, -139, 23, 0, 18, -45, 37, 121, -647, 1955, -5293, 23705, 16801, -5694, 2664, -1209, 471, -139, 23, 0, 18, -45, 37, 122, -649, 1958, -5296, 23689, 16819, -5695, 2664, -1208, 470, -139, 23, 0, 18, -45, 36, 123, -651, 1961, -5300, 23675, 16837, -5697, 2663, -1208, 470, -138, 23, 1,
+ 18, -45, 36, 124, -653, 1964, -5304, 23659, 16856, -5698, 2663, -1207, 469, -138, 23, 1, 18, -44, 35, 125, -655, 1967, -5307, 23644, 16874, -5700, 2662, -1206, 469, -138, 23, 1, 18, -44, 35, 127, -657, 1970, -5311, 23627, 16892, -5701, 2662, -1205, 468, -137, 23, 1, 17, -44, 34, 128, -659, 1973, -5314, 23616, 16910, -5703, 2661, -1205, 468, -137, 22, 1,
+ 17, -44, 34, 129, -661, 1976, -5318, 23601, 16928, -5704, 2661, -1204, 467, -137, 22, 1, 17, -44, 33, 130, -663, 1979, -5322, 23588, 16946, -5706, 2660, -1203, 466, -136, 22, 1, 17, -43, 33, 131, -664, 1981, -5325, 23570, 16964, -5707, 2660, -1202, 466, -136, 22, 1, 17, -43, 32, 132, -666, 1984, -5329, 23559, 16982, -5709, 2659, -1202, 465, -136, 22, 1,
+ 17, -43, 32, 133, -668, 1987, -5332, 23541, 17000, -5710, 2659, -1201, 465, -135, 22, 1, 17, -43, 31, 134, -670, 1990, -5336, 23528, 17018, -5711, 2658, -1200, 464, -135, 22, 1, 17, -43, 31, 135, -672, 1993, -5339, 23512, 17037, -5713, 2658, -1199, 464, -135, 21, 1, 17, -42, 30, 136, -674, 1996, -5343, 23497, 17055, -5714, 2657, -1198, 463, -134, 21, 1,
+ 17, -42, 30, 137, -676, 1999, -5346, 23482, 17073, -5715, 2657, -1198, 462, -134, 21, 1, 17, -42, 29, 139, -678, 2002, -5350, 23468, 17091, -5717, 2656, -1197, 462, -134, 21, 1, 17, -42, 29, 140, -680, 2005, -5353, 23451, 17109, -5718, 2656, -1196, 461, -133, 21, 1, 17, -42, 28, 141, -682, 2008, -5357, 23437, 17127, -5719, 2655, -1195, 461, -133, 21, 1,
+ 17, -41, 28, 142, -684, 2011, -5360, 23422, 17145, -5721, 2655, -1195, 460, -133, 21, 1, 17, -41, 27, 143, -686, 2013, -5364, 23410, 17163, -5722, 2654, -1194, 459, -133, 21, 1, 17, -41, 27, 144, -687, 2016, -5367, 23393, 17181, -5723, 2653, -1193, 459, -132, 20, 1, 17, -41, 26, 145, -689, 2019, -5370, 23379, 17199, -5725, 2653, -1192, 458, -132, 20, 1,
+ 17, -41, 25, 146, -691, 2022, -5374, 23365, 17217, -5726, 2652, -1191, 458, -132, 20, 1, 17, -40, 25, 147, -693, 2025, -5377, 23348, 17235, -5727, 2652, -1191, 457, -131, 20, 1, 16, -40, 24, 148, -695, 2028, -5380, 23335, 17253, -5728, 2651, -1190, 456, -131, 20, 1, 16, -40, 24, 149, -697, 2030, -5384, 23321, 17271, -5730, 2651, -1189, 456, -131, 20, 1,
+ 16, -40, 23, 150, -699, 2033, -5387, 23306, 17289, -5731, 2650, -1188, 455, -130, 20, 1, 16, -40, 23, 151, -701, 2036, -5390, 23290, 17307, -5732, 2649, -1187, 455, -130, 20, 1, 16, -40, 22, 153, -703, 2039, -5394, 23276, 17325, -5733, 2649, -1186, 454, -130, 19, 1, 16, -39, 22, 154, -704, 2042, -5397, 23259, 17343, -5734, 2648, -1186, 453, -129, 19, 1,
+ 16, -39, 21, 155, -706, 2045, -5400, 23245, 17361, -5736, 2647, -1185, 453, -129, 19, 1, 16, -39, 21, 156, -708, 2047, -5403, 23230, 17379, -5737, 2647, -1184, 452, -129, 19, 1, 16, -39, 20, 157, -710, 2050, -5407, 23215, 17397, -5738, 2646, -1183, 452, -128, 19, 1, 16, -39, 20, 158, -712, 2053, -5410, 23198, 17415, -5739, 2646, -1182, 451, -128, 19, 2,
+ 16, -38, 19, 159, -714, 2056, -5413, 23183, 17433, -5740, 2645, -1181, 450, -128, 19, 2, 16, -38, 19, 160, -716, 2058, -5416, 23169, 17451, -5741, 2644, -1181, 450, -127, 18, 2, 16, -38, 18, 161, -717, 2061, -5419, 23154, 17469, -5743, 2644, -1180, 449, -127, 18, 2, 16, -38, 18, 162, -719, 2064, -5423, 23139, 17487, -5744, 2643, -1179, 449, -127, 18, 2,
+ 16, -38, 17, 163, -721, 2067, -5426, 23124, 17505, -5745, 2642, -1178, 448, -126, 18, 2, 16, -37, 17, 164, -723, 2069, -5429, 23109, 17523, -5746, 2641, -1177, 447, -126, 18, 2, 16, -37, 16, 165, -725, 2072, -5432, 23093, 17541, -5747, 2641, -1176, 447, -126, 18, 2, 16, -37, 16, 166, -727, 2075, -5435, 23077, 17559, -5748, 2640, -1175, 446, -125, 18, 2,
+ 16, -37, 15, 167, -729, 2078, -5438, 23063, 17577, -5749, 2639, -1175, 446, -125, 18, 2, 16, -37, 15, 169, -730, 2080, -5441, 23047, 17595, -5750, 2639, -1174, 445, -125, 17, 2, 15, -36, 14, 170, -732, 2083, -5444, 23032, 17613, -5751, 2638, -1173, 444, -124, 17, 2, 15, -36, 14, 171, -734, 2086, -5447, 23016, 17631, -5752, 2637, -1172, 444, -124, 17, 2,
+ 15, -36, 13, 172, -736, 2089, -5450, 23002, 17649, -5753, 2636, -1171, 443, -124, 17, 2, 15, -36, 13, 173, -738, 2091, -5454, 22988, 17666, -5754, 2636, -1170, 442, -123, 17, 2, 15, -36, 12, 174, -739, 2094, -5457, 22972, 17684, -5755, 2635, -1169, 442, -123, 17, 2, 15, -35, 12, 175, -741, 2097, -5460, 22956, 17702, -5756, 2634, -1168, 441, -123, 17, 2,
+ 15, -35, 11, 176, -743, 2099, -5463, 22943, 17720, -5757, 2634, -1168, 440, -122, 16, 2, 15, -35, 11, 177, -745, 2102, -5465, 22926, 17738, -5758, 2633, -1167, 440, -122, 16, 2, 15, -35, 10, 178, -747, 2105, -5468, 22911, 17756, -5759, 2632, -1166, 439, -121, 16, 2, 15, -35, 10, 179, -749, 2107, -5471, 22896, 17774, -5760, 2631, -1165, 439, -121, 16, 2,
+ 15, -35, 9, 180, -750, 2110, -5474, 22881, 17792, -5761, 2630, -1164, 438, -121, 16, 2, 15, -34, 9, 181, -752, 2113, -5477, 22863, 17810, -5762, 2630, -1163, 437, -120, 16, 2, 15, -34, 8, 182, -754, 2115, -5480, 22850, 17827, -5763, 2629, -1162, 437, -120, 16, 2, 15, -34, 8, 183, -756, 2118, -5483, 22835, 17845, -5763, 2628, -1161, 436, -120, 15, 2,
+ 15, -34, 7, 184, -758, 2121, -5486, 22820, 17863, -5764, 2627, -1160, 435, -119, 15, 2, 15, -34, 7, 185, -759, 2123, -5489, 22804, 17881, -5765, 2626, -1159, 435, -119, 15, 2, 15, -33, 6, 186, -761, 2126, -5492, 22789, 17899, -5766, 2626, -1159, 434, -119, 15, 2, 15, -33, 6, 187, -763, 2128, -5494, 22773, 17917, -5767, 2625, -1158, 433, -118, 15, 2,
+ 15, -33, 5, 188, -765, 2131, -5497, 22759, 17934, -5768, 2624, -1157, 433, -118, 15, 2, 15, -33, 5, 189, -767, 2134, -5500, 22742, 17952, -5768, 2623, -1156, 432, -118, 15, 3, 14, -33, 4, 190, -768, 2136, -5503, 22728, 17970, -5769, 2622, -1155, 431, -117, 15, 3, 14, -32, 4, 191, -770, 2139, -5506, 22711, 17988, -5770, 2622, -1154, 431, -117, 14, 3,
+ 14, -32, 3, 192, -772, 2141, -5508, 22697, 18006, -5771, 2621, -1153, 430, -117, 14, 3, 14, -32, 3, 193, -774, 2144, -5511, 22681, 18024, -5772, 2620, -1152, 429, -116, 14, 3, 14, -32, 2, 195, -775, 2146, -5514, 22665, 18041, -5772, 2619, -1151, 429, -116, 14, 3, 14, -32, 2, 196, -777, 2149, -5517, 22650, 18059, -5773, 2618, -1150, 428, -116, 14, 3,
+ 14, -31, 1, 197, -779, 2152, -5519, 22633, 18077, -5774, 2617, -1149, 427, -115, 14, 3, 14, -31, 1, 198, -781, 2154, -5522, 22618, 18095, -5775, 2616, -1148, 427, -115, 14, 3, 14, -31, 0, 199, -782, 2157, -5525, 22603, 18113, -5775, 2615, -1147, 426, -115, 13, 3, 14, -31, 0, 200, -784, 2159, -5527, 22587, 18130, -5776, 2615, -1146, 425, -114, 13, 3,
+ 14, -31, -1, 201, -786, 2162, -5530, 22572, 18148, -5777, 2614, -1145, 425, -114, 13, 3, 14, -31, -1, 202, -788, 2164, -5533, 22556, 18166, -5777, 2613, -1144, 424, -113, 13, 3, 14, -30, -2, 203, -789, 2167, -5535, 22539, 18184, -5778, 2612, -1143, 423, -113, 13, 3, 14, -30, -2, 204, -791, 2169, -5538, 22525, 18201, -5779, 2611, -1142, 423, -113, 13, 3,
+ 14, -30, -3, 205, -793, 2172, -5541, 22509, 18219, -5779, 2610, -1141, 422, -112, 13, 3, 14, -30, -3, 206, -795, 2174, -5543, 22496, 18237, -5780, 2609, -1141, 421, -112, 12, 3, 14, -30, -4, 207, -796, 2177, -5546, 22480, 18255, -5781, 2608, -1140, 421, -112, 12, 3, 14, -29, -4, 208, -798, 2179, -5548, 22463, 18272, -5781, 2607, -1139, 420, -111, 12, 3,
+ 14, -29, -5, 209, -800, 2182, -5551, 22449, 18290, -5782, 2606, -1138, 419, -111, 12, 3, 14, -29, -5, 210, -802, 2184, -5553, 22432, 18308, -5782, 2605, -1137, 419, -111, 12, 3, 14, -29, -6, 211, -803, 2187, -5556, 22417, 18325, -5783, 2604, -1136, 418, -110, 12, 3, 13, -29, -6, 212, -805, 2189, -5558, 22403, 18343, -5784, 2603, -1135, 417, -110, 12, 3,
+ 13, -28, -7, 213, -807, 2192, -5561, 22386, 18361, -5784, 2602, -1134, 417, -109, 11, 3, 13, -28, -7, 214, -808, 2194, -5563, 22371, 18378, -5785, 2601, -1133, 416, -109, 11, 3, 13, -28, -8, 215, -810, 2197, -5566, 22356, 18396, -5785, 2600, -1132, 415, -109, 11, 3, 13, -28, -8, 216, -812, 2199, -5568, 22339, 18414, -5786, 2599, -1131, 415, -108, 11, 3,
+ 13, -28, -9, 217, -814, 2201, -5571, 22326, 18431, -5786, 2598, -1130, 414, -108, 11, 3, 13, -28, -9, 218, -815, 2204, -5573, 22308, 18449, -5787, 2597, -1129, 413, -108, 11, 4, 13, -27, -10, 219, -817, 2206, -5576, 22291, 18467, -5787, 2596, -1128, 413, -107, 11, 4, 13, -27, -10, 220, -819, 2209, -5578, 22277, 18484, -5788, 2595, -1127, 412, -107, 10, 4,
+ 13, -27, -11, 221, -820, 2211, -5580, 22261, 18502, -5788, 2594, -1126, 411, -107, 10, 4, 13, -27, -11, 222, -822, 2214, -5583, 22244, 18520, -5789, 2593, -1124, 410, -106, 10, 4, 13, -27, -12, 223, -824, 2216, -5585, 22229, 18537, -5789, 2592, -1123, 410, -106, 10, 4, 13, -26, -12, 224, -825, 2218, -5587, 22210, 18555, -5789, 2591, -1122, 409, -105, 10, 4,
+ 13, -26, -12, 225, -827, 2221, -5590, 22195, 18573, -5790, 2590, -1121, 408, -105, 10, 4, 13, -26, -13, 226, -829, 2223, -5592, 22180, 18590, -5790, 2589, -1120, 408, -105, 10, 4, 13, -26, -13, 227, -830, 2225, -5594, 22164, 18608, -5791, 2588, -1119, 407, -104, 9, 4, 13, -26, -14, 228, -832, 2228, -5597, 22150, 18625, -5791, 2587, -1118, 406, -104, 9, 4,
+ 13, -26, -14, 229, -834, 2230, -5599, 22133, 18643, -5791, 2586, -1117, 406, -104, 9, 4, 13, -25, -15, 230, -835, 2233, -5601, 22115, 18661, -5792, 2585, -1116, 405, -103, 9, 4, 13, -25, -15, 231, -837, 2235, -5603, 22100, 18678, -5792, 2584, -1115, 404, -103, 9, 4, 13, -25, -16, 232, -839, 2237, -5606, 22085, 18696, -5792, 2583, -1114, 403, -102, 9, 4,
+ 12, -25, -16, 233, -840, 2240, -5608, 22070, 18713, -5793, 2582, -1113, 403, -102, 8, 4, 12, -25, -17, 234, -842, 2242, -5610, 22055, 18731, -5793, 2581, -1112, 402, -102, 8, 4, 12, -24, -17, 235, -844, 2244, -5612, 22037, 18749, -5793, 2580, -1111, 401, -101, 8, 4, 12, -24, -18, 236, -845, 2246, -5614, 22023, 18766, -5794, 2578, -1110, 401, -101, 8, 4,
+ 12, -24, -18, 237, -847, 2249, -5617, 22007, 18784, -5794, 2577, -1109, 400, -101, 8, 4, 12, -24, -19, 238, -849, 2251, -5619, 21992, 18801, -5794, 2576, -1108, 399, -100, 8, 4, 12, -24, -19, 238, -850, 2253, -5621, 21976, 18819, -5794, 2575, -1107, 398, -100, 8, 4, 12, -23, -20, 239, -852, 2256, -5623, 21959, 18836, -5795, 2574, -1105, 398, -99, 7, 4,
+ 12, -23, -20, 240, -854, 2258, -5625, 21943, 18854, -5795, 2573, -1104, 397, -99, 7, 4, 12, -23, -21, 241, -855, 2260, -5627, 21928, 18871, -5795, 2572, -1103, 396, -99, 7, 4, 12, -23, -21, 242, -857, 2263, -5629, 21910, 18889, -5795, 2571, -1102, 395, -98, 7, 4, 12, -23, -22, 243, -858, 2265, -5631, 21895, 18906, -5795, 2569, -1101, 395, -98, 7, 4,
+ 12, -23, -22, 244, -860, 2267, -5634, 21881, 18924, -5796, 2568, -1100, 394, -98, 7, 4, 12, -22, -23, 245, -862, 2269, -5636, 21864, 18941, -5796, 2567, -1099, 393, -97, 7, 5, 12, -22, -23, 246, -863, 2272, -5638, 21846, 18959, -5796, 2566, -1098, 393, -97, 6, 5, 12, -22, -23, 247, -865, 2274, -5640, 21830, 18976, -5796, 2565, -1097, 392, -96, 6, 5,
+ 12, -22, -24, 248, -867, 2276, -5642, 21816, 18994, -5796, 2563, -1096, 391, -96, 6, 5, 12, -22, -24, 249, -868, 2278, -5644, 21800, 19011, -5796, 2562, -1095, 390, -96, 6, 5, 12, -21, -25, 250, -870, 2280, -5646, 21781, 19029, -5796, 2561, -1093, 390, -95, 6, 5, 12, -21, -25, 251, -871, 2283, -5648, 21764, 19046, -5796, 2560, -1092, 389, -95, 6, 5,
+ 12, -21, -26, 252, -873, 2285, -5650, 21750, 19063, -5797, 2559, -1091, 388, -94, 6, 5, 11, -21, -26, 253, -875, 2287, -5652, 21737, 19081, -5797, 2557, -1090, 387, -94, 5, 5, 11, -21, -27, 254, -876, 2289, -5653, 21720, 19098, -5797, 2556, -1089, 387, -94, 5, 5, 11, -21, -27, 255, -878, 2292, -5655, 21702, 19116, -5797, 2555, -1088, 386, -93, 5, 5,
+ 11, -20, -28, 256, -879, 2294, -5657, 21686, 19133, -5797, 2554, -1087, 385, -93, 5, 5, 11, -20, -28, 257, -881, 2296, -5659, 21670, 19151, -5797, 2553, -1086, 384, -93, 5, 5, 11, -20, -29, 258, -883, 2298, -5661, 21654, 19168, -5797, 2551, -1084, 384, -92, 5, 5, 11, -20, -29, 259, -884, 2300, -5663, 21639, 19185, -5797, 2550, -1083, 383, -92, 4, 5,
+ 11, -20, -30, 260, -886, 2302, -5665, 21623, 19203, -5797, 2549, -1082, 382, -91, 4, 5, 11, -20, -30, 261, -887, 2305, -5667, 21607, 19220, -5797, 2547, -1081, 381, -91, 4, 5, 11, -19, -31, 261, -889, 2307, -5668, 21591, 19237, -5797, 2546, -1080, 381, -91, 4, 5, 11, -19, -31, 262, -890, 2309, -5670, 21573, 19255, -5797, 2545, -1079, 380, -90, 4, 5,
+ 11, -19, -31, 263, -892, 2311, -5672, 21557, 19272, -5797, 2544, -1077, 379, -90, 4, 5, 11, -19, -32, 264, -894, 2313, -5674, 21543, 19289, -5797, 2542, -1076, 378, -89, 4, 5, 11, -19, -32, 265, -895, 2315, -5676, 21525, 19307, -5796, 2541, -1075, 378, -89, 3, 5, 11, -18, -33, 266, -897, 2317, -5677, 21509, 19324, -5796, 2540, -1074, 377, -89, 3, 5,
+ 11, -18, -33, 267, -898, 2319, -5679, 21493, 19341, -5796, 2538, -1073, 376, -88, 3, 5, 11, -18, -34, 268, -900, 2322, -5681, 21477, 19359, -5796, 2537, -1072, 375, -88, 3, 5, 11, -18, -34, 269, -901, 2324, -5683, 21458, 19376, -5796, 2536, -1070, 375, -87, 3, 5, 11, -18, -35, 270, -903, 2326, -5684, 21443, 19393, -5796, 2534, -1069, 374, -87, 3, 6,
+ 11, -18, -35, 271, -904, 2328, -5686, 21427, 19411, -5796, 2533, -1068, 373, -87, 2, 6, 11, -17, -36, 272, -906, 2330, -5688, 21411, 19428, -5796, 2532, -1067, 372, -86, 2, 6, 11, -17, -36, 273, -908, 2332, -5689, 21395, 19445, -5795, 2530, -1066, 371, -86, 2, 6, 10, -17, -37, 274, -909, 2334, -5691, 21378, 19463, -5795, 2529, -1065, 371, -85, 2, 6,
+ 10, -17, -37, 275, -911, 2336, -5693, 21362, 19480, -5795, 2528, -1063, 370, -85, 2, 6, 10, -17, -37, 275, -912, 2338, -5694, 21347, 19497, -5795, 2526, -1062, 369, -85, 2, 6, 10, -17, -38, 276, -914, 2340, -5696, 21332, 19514, -5794, 2525, -1061, 368, -84, 1, 6, 10, -16, -38, 277, -915, 2342, -5697, 21312, 19532, -5794, 2524, -1060, 368, -84, 1, 6,
+ 10, -16, -39, 278, -917, 2344, -5699, 21298, 19549, -5794, 2522, -1059, 367, -83, 1, 6, 10, -16, -39, 279, -918, 2346, -5701, 21281, 19566, -5794, 2521, -1057, 366, -83, 1, 6, 10, -16, -40, 280, -920, 2348, -5702, 21266, 19583, -5793, 2519, -1056, 365, -83, 1, 6, 10, -16, -40, 281, -921, 2350, -5704, 21249, 19600, -5793, 2518, -1055, 364, -82, 1, 6,
+ 10, -15, -41, 282, -923, 2352, -5705, 21231, 19618, -5793, 2517, -1054, 364, -82, 1, 6, 10, -15, -41, 283, -924, 2354, -5707, 21215, 19635, -5793, 2515, -1052, 363, -81, 0, 6, 10, -15, -42, 284, -926, 2356, -5708, 21199, 19652, -5792, 2514, -1051, 362, -81, 0, 6, 10, -15, -42, 285, -927, 2358, -5710, 21184, 19669, -5792, 2512, -1050, 361, -81, 0, 6,
+ 10, -15, -42, 286, -929, 2360, -5711, 21166, 19686, -5791, 2511, -1049, 360, -80, 0, 6, 10, -15, -43, 286, -930, 2362, -5713, 21151, 19704, -5791, 2509, -1048, 360, -80, 0, 6, 10, -14, -43, 287, -932, 2364, -5714, 21132, 19721, -5791, 2508, -1046, 359, -79, 0, 6, 10, -14, -44, 288, -933, 2366, -5716, 21117, 19738, -5790, 2507, -1045, 358, -79, -1, 6,
+ 10, -14, -44, 289, -935, 2368, -5717, 21102, 19755, -5790, 2505, -1044, 357, -79, -1, 6, 10, -14, -45, 290, -936, 2370, -5718, 21084, 19772, -5790, 2504, -1043, 357, -78, -1, 6, 10, -14, -45, 291, -938, 2372, -5720, 21068, 19789, -5789, 2502, -1041, 356, -78, -1, 6, 10, -14, -46, 292, -939, 2374, -5721, 21051, 19806, -5789, 2501, -1040, 355, -77, -1, 6,
+ 10, -13, -46, 293, -941, 2376, -5723, 21033, 19824, -5788, 2499, -1039, 354, -77, -1, 7, 9, -13, -46, 294, -942, 2378, -5724, 21018, 19841, -5788, 2498, -1038, 353, -77, -2, 7, 9, -13, -47, 295, -944, 2380, -5725, 21000, 19858, -5787, 2496, -1036, 353, -76, -2, 7, 9, -13, -47, 295, -945, 2382, -5727, 20985, 19875, -5787, 2495, -1035, 352, -76, -2, 7,
+ 9, -13, -48, 296, -946, 2384, -5728, 20968, 19892, -5786, 2493, -1034, 351, -75, -2, 7, 9, -12, -48, 297, -948, 2386, -5729, 20951, 19909, -5786, 2492, -1033, 350, -75, -2, 7, 9, -12, -49, 298, -949, 2388, -5731, 20935, 19926, -5785, 2490, -1031, 349, -75, -2, 7, 9, -12, -49, 299, -951, 2389, -5732, 20919, 19943, -5785, 2489, -1030, 348, -74, -2, 7,
+ 9, -12, -50, 300, -952, 2391, -5733, 20903, 19960, -5784, 2487, -1029, 348, -74, -3, 7, 9, -12, -50, 301, -954, 2393, -5734, 20885, 19977, -5784, 2486, -1027, 347, -73, -3, 7, 9, -12, -51, 302, -955, 2395, -5736, 20870, 19994, -5783, 2484, -1026, 346, -73, -3, 7, 9, -11, -51, 303, -957, 2397, -5737, 20852, 20011, -5782, 2482, -1025, 345, -72, -3, 7,
+ 9, -11, -51, 303, -958, 2399, -5738, 20836, 20028, -5782, 2481, -1024, 344, -72, -3, 7, 9, -11, -52, 304, -959, 2401, -5739, 20818, 20045, -5781, 2479, -1022, 344, -72, -3, 7, 9, -11, -52, 305, -961, 2403, -5741, 20803, 20062, -5781, 2478, -1021, 343, -71, -4, 7, 9, -11, -53, 306, -962, 2404, -5742, 20788, 20079, -5780, 2476, -1020, 342, -71, -4, 7,
+ 9, -11, -53, 307, -964, 2406, -5743, 20769, 20096, -5779, 2475, -1018, 341, -70, -4, 7, 9, -10, -54, 308, -965, 2408, -5744, 20753, 20113, -5779, 2473, -1017, 340, -70, -4, 7, 9, -10, -54, 309, -967, 2410, -5745, 20736, 20130, -5778, 2471, -1016, 339, -69, -4, 7, 9, -10, -54, 310, -968, 2412, -5746, 20716, 20147, -5777, 2470, -1014, 339, -69, -4, 7,
+ 9, -10, -55, 311, -969, 2413, -5747, 20703, 20164, -5777, 2468, -1013, 338, -69, -5, 7, 9, -10, -55, 311, -971, 2415, -5749, 20687, 20181, -5776, 2467, -1012, 337, -68, -5, 7, 9, -10, -56, 312, -972, 2417, -5750, 20670, 20198, -5775, 2465, -1010, 336, -68, -5, 7, 9, -9, -56, 313, -974, 2419, -5751, 20652, 20215, -5774, 2463, -1009, 335, -67, -5, 7,
+ 8, -9, -57, 314, -975, 2421, -5752, 20637, 20232, -5774, 2462, -1008, 334, -67, -5, 7, 8, -9, -57, 315, -976, 2422, -5753, 20618, 20249, -5773, 2460, -1006, 334, -67, -5, 8, 8, -9, -58, 316, -978, 2424, -5754, 20603, 20266, -5772, 2458, -1005, 333, -66, -6, 8, 8, -9, -58, 317, -979, 2426, -5755, 20585, 20283, -5771, 2457, -1004, 332, -66, -6, 8,
+ 8, -9, -58, 317, -981, 2428, -5756, 20568, 20300, -5770, 2455, -1002, 331, -65, -6, 8, 8, -8, -59, 318, -982, 2430, -5757, 20553, 20316, -5770, 2453, -1001, 330, -65, -6, 8, 8, -8, -59, 319, -983, 2431, -5758, 20535, 20333, -5769, 2452, -1000, 329, -64, -6, 8, 8, -8, -60, 320, -985, 2433, -5759, 20518, 20350, -5768, 2450, -998, 329, -64, -6, 8,
+ 8, -8, -60, 321, -986, 2435, -5760, 20502, 20367, -5767, 2448, -997, 328, -64, -7, 8, 8, -8, -61, 322, -988, 2436, -5761, 20486, 20384, -5766, 2447, -996, 327, -63, -7, 8, 8, -8, -61, 323, -989, 2438, -5762, 20468, 20401, -5765, 2445, -994, 326, -63, -7, 8, 8, -7, -61, 323, -990, 2440, -5763, 20451, 20418, -5765, 2443, -993, 325, -62, -7, 8,
+ 8, -7, -62, 324, -992, 2442, -5764, 20436, 20434, -5764, 2442, -992, 324, -62, -7, 8, 8, -7, -62, 325, -993, 2443, -5765, 20418, 20451, -5763, 2440, -990, 323, -61, -7, 8, 8, -7, -63, 326, -994, 2445, -5765, 20401, 20468, -5762, 2438, -989, 323, -61, -8, 8, 8, -7, -63, 327, -996, 2447, -5766, 20384, 20486, -5761, 2436, -988, 322, -61, -8, 8,
+ 8, -7, -64, 328, -997, 2448, -5767, 20367, 20502, -5760, 2435, -986, 321, -60, -8, 8, 8, -6, -64, 329, -998, 2450, -5768, 20350, 20518, -5759, 2433, -985, 320, -60, -8, 8, 8, -6, -64, 329, -1000, 2452, -5769, 20333, 20535, -5758, 2431, -983, 319, -59, -8, 8, 8, -6, -65, 330, -1001, 2453, -5770, 20316, 20553, -5757, 2430, -982, 318, -59, -8, 8,
+ 8, -6, -65, 331, -1002, 2455, -5770, 20300, 20568, -5756, 2428, -981, 317, -58, -9, 8, 8, -6, -66, 332, -1004, 2457, -5771, 20283, 20585, -5755, 2426, -979, 317, -58, -9, 8, 8, -6, -66, 333, -1005, 2458, -5772, 20266, 20603, -5754, 2424, -978, 316, -58, -9, 8, 8, -5, -67, 334, -1006, 2460, -5773, 20249, 20618, -5753, 2422, -976, 315, -57, -9, 8,
+ 7, -5, -67, 334, -1008, 2462, -5774, 20232, 20637, -5752, 2421, -975, 314, -57, -9, 8, 7, -5, -67, 335, -1009, 2463, -5774, 20215, 20652, -5751, 2419, -974, 313, -56, -9, 9, 7, -5, -68, 336, -1010, 2465, -5775, 20198, 20670, -5750, 2417, -972, 312, -56, -10, 9, 7, -5, -68, 337, -1012, 2467, -5776, 20181, 20687, -5749, 2415, -971, 311, -55, -10, 9,
+ 7, -5, -69, 338, -1013, 2468, -5777, 20164, 20703, -5747, 2413, -969, 311, -55, -10, 9, 7, -4, -69, 339, -1014, 2470, -5777, 20147, 20716, -5746, 2412, -968, 310, -54, -10, 9, 7, -4, -69, 339, -1016, 2471, -5778, 20130, 20736, -5745, 2410, -967, 309, -54, -10, 9, 7, -4, -70, 340, -1017, 2473, -5779, 20113, 20753, -5744, 2408, -965, 308, -54, -10, 9,
+ 7, -4, -70, 341, -1018, 2475, -5779, 20096, 20769, -5743, 2406, -964, 307, -53, -11, 9, 7, -4, -71, 342, -1020, 2476, -5780, 20079, 20788, -5742, 2404, -962, 306, -53, -11, 9, 7, -4, -71, 343, -1021, 2478, -5781, 20062, 20803, -5741, 2403, -961, 305, -52, -11, 9, 7, -3, -72, 344, -1022, 2479, -5781, 20045, 20818, -5739, 2401, -959, 304, -52, -11, 9,
+ 7, -3, -72, 344, -1024, 2481, -5782, 20028, 20836, -5738, 2399, -958, 303, -51, -11, 9, 7, -3, -72, 345, -1025, 2482, -5782, 20011, 20852, -5737, 2397, -957, 303, -51, -11, 9, 7, -3, -73, 346, -1026, 2484, -5783, 19994, 20870, -5736, 2395, -955, 302, -51, -12, 9, 7, -3, -73, 347, -1027, 2486, -5784, 19977, 20885, -5734, 2393, -954, 301, -50, -12, 9,
+ 7, -3, -74, 348, -1029, 2487, -5784, 19960, 20903, -5733, 2391, -952, 300, -50, -12, 9, 7, -2, -74, 348, -1030, 2489, -5785, 19943, 20919, -5732, 2389, -951, 299, -49, -12, 9, 7, -2, -75, 349, -1031, 2490, -5785, 19926, 20935, -5731, 2388, -949, 298, -49, -12, 9, 7, -2, -75, 350, -1033, 2492, -5786, 19909, 20951, -5729, 2386, -948, 297, -48, -12, 9,
+ 7, -2, -75, 351, -1034, 2493, -5786, 19892, 20968, -5728, 2384, -946, 296, -48, -13, 9, 7, -2, -76, 352, -1035, 2495, -5787, 19875, 20985, -5727, 2382, -945, 295, -47, -13, 9, 7, -2, -76, 353, -1036, 2496, -5787, 19858, 21000, -5725, 2380, -944, 295, -47, -13, 9, 7, -2, -77, 353, -1038, 2498, -5788, 19841, 21018, -5724, 2378, -942, 294, -46, -13, 9,
+ 7, -1, -77, 354, -1039, 2499, -5788, 19824, 21033, -5723, 2376, -941, 293, -46, -13, 10, 6, -1, -77, 355, -1040, 2501, -5789, 19806, 21051, -5721, 2374, -939, 292, -46, -14, 10, 6, -1, -78, 356, -1041, 2502, -5789, 19789, 21068, -5720, 2372, -938, 291, -45, -14, 10, 6, -1, -78, 357, -1043, 2504, -5790, 19772, 21084, -5718, 2370, -936, 290, -45, -14, 10,
+ 6, -1, -79, 357, -1044, 2505, -5790, 19755, 21102, -5717, 2368, -935, 289, -44, -14, 10, 6, -1, -79, 358, -1045, 2507, -5790, 19738, 21117, -5716, 2366, -933, 288, -44, -14, 10, 6, 0, -79, 359, -1046, 2508, -5791, 19721, 21132, -5714, 2364, -932, 287, -43, -14, 10, 6, 0, -80, 360, -1048, 2509, -5791, 19704, 21151, -5713, 2362, -930, 286, -43, -15, 10,
+ 6, 0, -80, 360, -1049, 2511, -5791, 19686, 21166, -5711, 2360, -929, 286, -42, -15, 10, 6, 0, -81, 361, -1050, 2512, -5792, 19669, 21184, -5710, 2358, -927, 285, -42, -15, 10, 6, 0, -81, 362, -1051, 2514, -5792, 19652, 21199, -5708, 2356, -926, 284, -42, -15, 10, 6, 0, -81, 363, -1052, 2515, -5793, 19635, 21215, -5707, 2354, -924, 283, -41, -15, 10,
+ 6, 1, -82, 364, -1054, 2517, -5793, 19618, 21231, -5705, 2352, -923, 282, -41, -15, 10, 6, 1, -82, 364, -1055, 2518, -5793, 19600, 21249, -5704, 2350, -921, 281, -40, -16, 10, 6, 1, -83, 365, -1056, 2519, -5793, 19583, 21266, -5702, 2348, -920, 280, -40, -16, 10, 6, 1, -83, 366, -1057, 2521, -5794, 19566, 21281, -5701, 2346, -918, 279, -39, -16, 10,
+ 6, 1, -83, 367, -1059, 2522, -5794, 19549, 21298, -5699, 2344, -917, 278, -39, -16, 10, 6, 1, -84, 368, -1060, 2524, -5794, 19532, 21312, -5697, 2342, -915, 277, -38, -16, 10, 6, 1, -84, 368, -1061, 2525, -5794, 19514, 21332, -5696, 2340, -914, 276, -38, -17, 10, 6, 2, -85, 369, -1062, 2526, -5795, 19497, 21347, -5694, 2338, -912, 275, -37, -17, 10,
+ 6, 2, -85, 370, -1063, 2528, -5795, 19480, 21362, -5693, 2336, -911, 275, -37, -17, 10, 6, 2, -85, 371, -1065, 2529, -5795, 19463, 21378, -5691, 2334, -909, 274, -37, -17, 10, 6, 2, -86, 371, -1066, 2530, -5795, 19445, 21395, -5689, 2332, -908, 273, -36, -17, 11, 6, 2, -86, 372, -1067, 2532, -5796, 19428, 21411, -5688, 2330, -906, 272, -36, -17, 11,
+ 6, 2, -87, 373, -1068, 2533, -5796, 19411, 21427, -5686, 2328, -904, 271, -35, -18, 11, 6, 3, -87, 374, -1069, 2534, -5796, 19393, 21443, -5684, 2326, -903, 270, -35, -18, 11, 5, 3, -87, 375, -1070, 2536, -5796, 19376, 21458, -5683, 2324, -901, 269, -34, -18, 11, 5, 3, -88, 375, -1072, 2537, -5796, 19359, 21477, -5681, 2322, -900, 268, -34, -18, 11,
+ 5, 3, -88, 376, -1073, 2538, -5796, 19341, 21493, -5679, 2319, -898, 267, -33, -18, 11, 5, 3, -89, 377, -1074, 2540, -5796, 19324, 21509, -5677, 2317, -897, 266, -33, -18, 11, 5, 3, -89, 378, -1075, 2541, -5796, 19307, 21525, -5676, 2315, -895, 265, -32, -19, 11, 5, 4, -89, 378, -1076, 2542, -5797, 19289, 21543, -5674, 2313, -894, 264, -32, -19, 11,
+ 5, 4, -90, 379, -1077, 2544, -5797, 19272, 21557, -5672, 2311, -892, 263, -31, -19, 11, 5, 4, -90, 380, -1079, 2545, -5797, 19255, 21573, -5670, 2309, -890, 262, -31, -19, 11, 5, 4, -91, 381, -1080, 2546, -5797, 19237, 21591, -5668, 2307, -889, 261, -31, -19, 11, 5, 4, -91, 381, -1081, 2547, -5797, 19220, 21607, -5667, 2305, -887, 261, -30, -20, 11,
+ 5, 4, -91, 382, -1082, 2549, -5797, 19203, 21623, -5665, 2302, -886, 260, -30, -20, 11, 5, 4, -92, 383, -1083, 2550, -5797, 19185, 21639, -5663, 2300, -884, 259, -29, -20, 11, 5, 5, -92, 384, -1084, 2551, -5797, 19168, 21654, -5661, 2298, -883, 258, -29, -20, 11, 5, 5, -93, 384, -1086, 2553, -5797, 19151, 21670, -5659, 2296, -881, 257, -28, -20, 11,
+ 5, 5, -93, 385, -1087, 2554, -5797, 19133, 21686, -5657, 2294, -879, 256, -28, -20, 11, 5, 5, -93, 386, -1088, 2555, -5797, 19116, 21702, -5655, 2292, -878, 255, -27, -21, 11, 5, 5, -94, 387, -1089, 2556, -5797, 19098, 21720, -5653, 2289, -876, 254, -27, -21, 11, 5, 5, -94, 387, -1090, 2557, -5797, 19081, 21737, -5652, 2287, -875, 253, -26, -21, 11,
+ 5, 6, -94, 388, -1091, 2559, -5797, 19063, 21750, -5650, 2285, -873, 252, -26, -21, 12, 5, 6, -95, 389, -1092, 2560, -5796, 19046, 21764, -5648, 2283, -871, 251, -25, -21, 12, 5, 6, -95, 390, -1093, 2561, -5796, 19029, 21781, -5646, 2280, -870, 250, -25, -21, 12, 5, 6, -96, 390, -1095, 2562, -5796, 19011, 21800, -5644, 2278, -868, 249, -24, -22, 12,
+ 5, 6, -96, 391, -1096, 2563, -5796, 18994, 21816, -5642, 2276, -867, 248, -24, -22, 12, 5, 6, -96, 392, -1097, 2565, -5796, 18976, 21830, -5640, 2274, -865, 247, -23, -22, 12, 5, 6, -97, 393, -1098, 2566, -5796, 18959, 21846, -5638, 2272, -863, 246, -23, -22, 12, 5, 7, -97, 393, -1099, 2567, -5796, 18941, 21864, -5636, 2269, -862, 245, -23, -22, 12,
+ 4, 7, -98, 394, -1100, 2568, -5796, 18924, 21881, -5634, 2267, -860, 244, -22, -23, 12, 4, 7, -98, 395, -1101, 2569, -5795, 18906, 21895, -5631, 2265, -858, 243, -22, -23, 12, 4, 7, -98, 395, -1102, 2571, -5795, 18889, 21910, -5629, 2263, -857, 242, -21, -23, 12, 4, 7, -99, 396, -1103, 2572, -5795, 18871, 21928, -5627, 2260, -855, 241, -21, -23, 12,
+ 4, 7, -99, 397, -1104, 2573, -5795, 18854, 21943, -5625, 2258, -854, 240, -20, -23, 12, 4, 7, -99, 398, -1105, 2574, -5795, 18836, 21959, -5623, 2256, -852, 239, -20, -23, 12, 4, 8, -100, 398, -1107, 2575, -5794, 18819, 21976, -5621, 2253, -850, 238, -19, -24, 12, 4, 8, -100, 399, -1108, 2576, -5794, 18801, 21992, -5619, 2251, -849, 238, -19, -24, 12,
+ 4, 8, -101, 400, -1109, 2577, -5794, 18784, 22007, -5617, 2249, -847, 237, -18, -24, 12, 4, 8, -101, 401, -1110, 2578, -5794, 18766, 22023, -5614, 2246, -845, 236, -18, -24, 12, 4, 8, -101, 401, -1111, 2580, -5793, 18749, 22037, -5612, 2244, -844, 235, -17, -24, 12, 4, 8, -102, 402, -1112, 2581, -5793, 18731, 22055, -5610, 2242, -842, 234, -17, -25, 12,
+ 4, 8, -102, 403, -1113, 2582, -5793, 18713, 22070, -5608, 2240, -840, 233, -16, -25, 12, 4, 9, -102, 403, -1114, 2583, -5792, 18696, 22085, -5606, 2237, -839, 232, -16, -25, 13, 4, 9, -103, 404, -1115, 2584, -5792, 18678, 22100, -5603, 2235, -837, 231, -15, -25, 13, 4, 9, -103, 405, -1116, 2585, -5792, 18661, 22115, -5601, 2233, -835, 230, -15, -25, 13,
+ 4, 9, -104, 406, -1117, 2586, -5791, 18643, 22133, -5599, 2230, -834, 229, -14, -26, 13, 4, 9, -104, 406, -1118, 2587, -5791, 18625, 22150, -5597, 2228, -832, 228, -14, -26, 13, 4, 9, -104, 407, -1119, 2588, -5791, 18608, 22164, -5594, 2225, -830, 227, -13, -26, 13, 4, 10, -105, 408, -1120, 2589, -5790, 18590, 22180, -5592, 2223, -829, 226, -13, -26, 13,
+ 4, 10, -105, 408, -1121, 2590, -5790, 18573, 22195, -5590, 2221, -827, 225, -12, -26, 13, 4, 10, -105, 409, -1122, 2591, -5789, 18555, 22210, -5587, 2218, -825, 224, -12, -26, 13, 4, 10, -106, 410, -1123, 2592, -5789, 18537, 22229, -5585, 2216, -824, 223, -12, -27, 13, 4, 10, -106, 410, -1124, 2593, -5789, 18520, 22244, -5583, 2214, -822, 222, -11, -27, 13,
+ 4, 10, -107, 411, -1126, 2594, -5788, 18502, 22261, -5580, 2211, -820, 221, -11, -27, 13, 4, 10, -107, 412, -1127, 2595, -5788, 18484, 22277, -5578, 2209, -819, 220, -10, -27, 13, 4, 11, -107, 413, -1128, 2596, -5787, 18467, 22291, -5576, 2206, -817, 219, -10, -27, 13, 4, 11, -108, 413, -1129, 2597, -5787, 18449, 22308, -5573, 2204, -815, 218, -9, -28, 13,
+ 3, 11, -108, 414, -1130, 2598, -5786, 18431, 22326, -5571, 2201, -814, 217, -9, -28, 13, 3, 11, -108, 415, -1131, 2599, -5786, 18414, 22339, -5568, 2199, -812, 216, -8, -28, 13, 3, 11, -109, 415, -1132, 2600, -5785, 18396, 22356, -5566, 2197, -810, 215, -8, -28, 13, 3, 11, -109, 416, -1133, 2601, -5785, 18378, 22371, -5563, 2194, -808, 214, -7, -28, 13,
+ 3, 11, -109, 417, -1134, 2602, -5784, 18361, 22386, -5561, 2192, -807, 213, -7, -28, 13, 3, 12, -110, 417, -1135, 2603, -5784, 18343, 22403, -5558, 2189, -805, 212, -6, -29, 13, 3, 12, -110, 418, -1136, 2604, -5783, 18325, 22417, -5556, 2187, -803, 211, -6, -29, 14, 3, 12, -111, 419, -1137, 2605, -5782, 18308, 22432, -5553, 2184, -802, 210, -5, -29, 14,
+ 3, 12, -111, 419, -1138, 2606, -5782, 18290, 22449, -5551, 2182, -800, 209, -5, -29, 14, 3, 12, -111, 420, -1139, 2607, -5781, 18272, 22463, -5548, 2179, -798, 208, -4, -29, 14, 3, 12, -112, 421, -1140, 2608, -5781, 18255, 22480, -5546, 2177, -796, 207, -4, -30, 14, 3, 12, -112, 421, -1141, 2609, -5780, 18237, 22496, -5543, 2174, -795, 206, -3, -30, 14,
+ 3, 13, -112, 422, -1141, 2610, -5779, 18219, 22509, -5541, 2172, -793, 205, -3, -30, 14, 3, 13, -113, 423, -1142, 2611, -5779, 18201, 22525, -5538, 2169, -791, 204, -2, -30, 14, 3, 13, -113, 423, -1143, 2612, -5778, 18184, 22539, -5535, 2167, -789, 203, -2, -30, 14, 3, 13, -113, 424, -1144, 2613, -5777, 18166, 22556, -5533, 2164, -788, 202, -1, -31, 14,
+ 3, 13, -114, 425, -1145, 2614, -5777, 18148, 22572, -5530, 2162, -786, 201, -1, -31, 14, 3, 13, -114, 425, -1146, 2615, -5776, 18130, 22587, -5527, 2159, -784, 200, 0, -31, 14, 3, 13, -115, 426, -1147, 2615, -5775, 18113, 22603, -5525, 2157, -782, 199, 0, -31, 14, 3, 14, -115, 427, -1148, 2616, -5775, 18095, 22618, -5522, 2154, -781, 198, 1, -31, 14,
+ 3, 14, -115, 427, -1149, 2617, -5774, 18077, 22633, -5519, 2152, -779, 197, 1, -31, 14, 3, 14, -116, 428, -1150, 2618, -5773, 18059, 22650, -5517, 2149, -777, 196, 2, -32, 14, 3, 14, -116, 429, -1151, 2619, -5772, 18041, 22665, -5514, 2146, -775, 195, 2, -32, 14, 3, 14, -116, 429, -1152, 2620, -5772, 18024, 22681, -5511, 2144, -774, 193, 3, -32, 14,
+ 3, 14, -117, 430, -1153, 2621, -5771, 18006, 22697, -5508, 2141, -772, 192, 3, -32, 14, 3, 14, -117, 431, -1154, 2622, -5770, 17988, 22711, -5506, 2139, -770, 191, 4, -32, 14, 3, 15, -117, 431, -1155, 2622, -5769, 17970, 22728, -5503, 2136, -768, 190, 4, -33, 14, 3, 15, -118, 432, -1156, 2623, -5768, 17952, 22742, -5500, 2134, -767, 189, 5, -33, 15,
+ 2, 15, -118, 433, -1157, 2624, -5768, 17934, 22759, -5497, 2131, -765, 188, 5, -33, 15, 2, 15, -118, 433, -1158, 2625, -5767, 17917, 22773, -5494, 2128, -763, 187, 6, -33, 15, 2, 15, -119, 434, -1159, 2626, -5766, 17899, 22789, -5492, 2126, -761, 186, 6, -33, 15, 2, 15, -119, 435, -1159, 2626, -5765, 17881, 22804, -5489, 2123, -759, 185, 7, -34, 15,
+ 2, 15, -119, 435, -1160, 2627, -5764, 17863, 22820, -5486, 2121, -758, 184, 7, -34, 15, 2, 15, -120, 436, -1161, 2628, -5763, 17845, 22835, -5483, 2118, -756, 183, 8, -34, 15, 2, 16, -120, 437, -1162, 2629, -5763, 17827, 22850, -5480, 2115, -754, 182, 8, -34, 15, 2, 16, -120, 437, -1163, 2630, -5762, 17810, 22863, -5477, 2113, -752, 181, 9, -34, 15,
+ 2, 16, -121, 438, -1164, 2630, -5761, 17792, 22881, -5474, 2110, -750, 180, 9, -35, 15, 2, 16, -121, 439, -1165, 2631, -5760, 17774, 22896, -5471, 2107, -749, 179, 10, -35, 15, 2, 16, -121, 439, -1166, 2632, -5759, 17756, 22911, -5468, 2105, -747, 178, 10, -35, 15, 2, 16, -122, 440, -1167, 2633, -5758, 17738, 22926, -5465, 2102, -745, 177, 11, -35, 15,
+ 2, 16, -122, 440, -1168, 2634, -5757, 17720, 22943, -5463, 2099, -743, 176, 11, -35, 15, 2, 17, -123, 441, -1168, 2634, -5756, 17702, 22956, -5460, 2097, -741, 175, 12, -35, 15, 2, 17, -123, 442, -1169, 2635, -5755, 17684, 22972, -5457, 2094, -739, 174, 12, -36, 15, 2, 17, -123, 442, -1170, 2636, -5754, 17666, 22988, -5454, 2091, -738, 173, 13, -36, 15,
+ 2, 17, -124, 443, -1171, 2636, -5753, 17649, 23002, -5450, 2089, -736, 172, 13, -36, 15, 2, 17, -124, 444, -1172, 2637, -5752, 17631, 23016, -5447, 2086, -734, 171, 14, -36, 15, 2, 17, -124, 444, -1173, 2638, -5751, 17613, 23032, -5444, 2083, -732, 170, 14, -36, 15, 2, 17, -125, 445, -1174, 2639, -5750, 17595, 23047, -5441, 2080, -730, 169, 15, -37, 16,
+ 2, 18, -125, 446, -1175, 2639, -5749, 17577, 23063, -5438, 2078, -729, 167, 15, -37, 16, 2, 18, -125, 446, -1175, 2640, -5748, 17559, 23077, -5435, 2075, -727, 166, 16, -37, 16, 2, 18, -126, 447, -1176, 2641, -5747, 17541, 23093, -5432, 2072, -725, 165, 16, -37, 16, 2, 18, -126, 447, -1177, 2641, -5746, 17523, 23109, -5429, 2069, -723, 164, 17, -37, 16,
+ 2, 18, -126, 448, -1178, 2642, -5745, 17505, 23124, -5426, 2067, -721, 163, 17, -38, 16, 2, 18, -127, 449, -1179, 2643, -5744, 17487, 23139, -5423, 2064, -719, 162, 18, -38, 16, 2, 18, -127, 449, -1180, 2644, -5743, 17469, 23154, -5419, 2061, -717, 161, 18, -38, 16, 2, 18, -127, 450, -1181, 2644, -5741, 17451, 23169, -5416, 2058, -716, 160, 19, -38, 16,
+ 2, 19, -128, 450, -1181, 2645, -5740, 17433, 23183, -5413, 2056, -714, 159, 19, -38, 16, 2, 19, -128, 451, -1182, 2646, -5739, 17415, 23198, -5410, 2053, -712, 158, 20, -39, 16, 1, 19, -128, 452, -1183, 2646, -5738, 17397, 23215, -5407, 2050, -710, 157, 20, -39, 16, 1, 19, -129, 452, -1184, 2647, -5737, 17379, 23230, -5403, 2047, -708, 156, 21, -39, 16,
+ 1, 19, -129, 453, -1185, 2647, -5736, 17361, 23245, -5400, 2045, -706, 155, 21, -39, 16, 1, 19, -129, 453, -1186, 2648, -5734, 17343, 23259, -5397, 2042, -704, 154, 22, -39, 16, 1, 19, -130, 454, -1186, 2649, -5733, 17325, 23276, -5394, 2039, -703, 153, 22, -40, 16, 1, 20, -130, 455, -1187, 2649, -5732, 17307, 23290, -5390, 2036, -701, 151, 23, -40, 16,
+ 1, 20, -130, 455, -1188, 2650, -5731, 17289, 23306, -5387, 2033, -699, 150, 23, -40, 16, 1, 20, -131, 456, -1189, 2651, -5730, 17271, 23321, -5384, 2030, -697, 149, 24, -40, 16, 1, 20, -131, 456, -1190, 2651, -5728, 17253, 23335, -5380, 2028, -695, 148, 24, -40, 16, 1, 20, -131, 457, -1191, 2652, -5727, 17235, 23348, -5377, 2025, -693, 147, 25, -40, 17,
+ 1, 20, -132, 458, -1191, 2652, -5726, 17217, 23365, -5374, 2022, -691, 146, 25, -41, 17, 1, 20, -132, 458, -1192, 2653, -5725, 17199, 23379, -5370, 2019, -689, 145, 26, -41, 17, 1, 20, -132, 459, -1193, 2653, -5723, 17181, 23393, -5367, 2016, -687, 144, 27, -41, 17, 1, 21, -133, 459, -1194, 2654, -5722, 17163, 23410, -5364, 2013, -686, 143, 27, -41, 17,
+ 1, 21, -133, 460, -1195, 2655, -5721, 17145, 23422, -5360, 2011, -684, 142, 28, -41, 17, 1, 21, -133, 461, -1195, 2655, -5719, 17127, 23437, -5357, 2008, -682, 141, 28, -42, 17, 1, 21, -133, 461, -1196, 2656, -5718, 17109, 23451, -5353, 2005, -680, 140, 29, -42, 17, 1, 21, -134, 462, -1197, 2656, -5717, 17091, 23468, -5350, 2002, -678, 139, 29, -42, 17,
+ 1, 21, -134, 462, -1198, 2657, -5715, 17073, 23482, -5346, 1999, -676, 137, 30, -42, 17, 1, 21, -134, 463, -1198, 2657, -5714, 17055, 23497, -5343, 1996, -674, 136, 30, -42, 17, 1, 21, -135, 464, -1199, 2658, -5713, 17037, 23512, -5339, 1993, -672, 135, 31, -43, 17, 1, 22, -135, 464, -1200, 2658, -5711, 17018, 23528, -5336, 1990, -670, 134, 31, -43, 17,
+ 1, 22, -135, 465, -1201, 2659, -5710, 17000, 23541, -5332, 1987, -668, 133, 32, -43, 17, 1, 22, -136, 465, -1202, 2659, -5709, 16982, 23559, -5329, 1984, -666, 132, 32, -43, 17, 1, 22, -136, 466, -1202, 2660, -5707, 16964, 23570, -5325, 1981, -664, 131, 33, -43, 17, 1, 22, -136, 466, -1203, 2660, -5706, 16946, 23588, -5322, 1979, -663, 130, 33, -44, 17,
+ 1, 22, -137, 467, -1204, 2661, -5704, 16928, 23601, -5318, 1976, -661, 129, 34, -44, 17, 1, 22, -137, 468, -1205, 2661, -5703, 16910, 23616, -5314, 1973, -659, 128, 34, -44, 17, 1, 23, -137, 468, -1205, 2662, -5701, 16892, 23627, -5311, 1970, -657, 127, 35, -44, 18, 1, 23, -138, 469, -1206, 2662, -5700, 16874, 23644, -5307, 1967, -655, 125, 35, -44, 18,
+ 1, 23, -138, 469, -1207, 2663, -5698, 16856, 23659, -5304, 1964, -653, 124, 36, -45, 18, 1, 23, -138, 470, -1208, 2663, -5697, 16837, 23675, -5300, 1961, -651, 123, 36, -45, 18, 0, 23, -139, 470, -1208, 2664, -5695, 16819, 23689, -5296, 1958, -649, 122, 37, -45, 18, 0, 23, -139, 471, -1209, 2664, -5694, 16801, 23705, -5293, 1955, -647, 121, 37, -45, 18,
+ 0, 23, -139, 472, -1210, 2665, -5692, 16783, 23717, -5289, 1952, -645, 120, 38, -45, 18, 0, 23, -139, 472, -1210, 2665, -5691, 16765, 23733, -5285, 1949, -643, 119, 38, -46, 18, 0, 24, -140, 473, -1211, 2666, -5689, 16747, 23745, -5281, 1946, -641, 118, 39, -46, 18, 0, 24, -140, 473, -1212, 2666, -5688, 16729, 23761, -5278, 1943, -639, 117, 40, -46, 18,
+ 0, 24, -140, 474, -1213, 2666, -5686, 16710, 23777, -5274, 1940, -637, 115, 40, -46, 18, 0, 24, -141, 474, -1213, 2667, -5685, 16692, 23791, -5270, 1937, -635, 114, 41, -46, 18, 0, 24, -141, 475, -1214, 2667, -5683, 16674, 23806, -5266, 1934, -633, 113, 41, -47, 18, 0, 24, -141, 475, -1215, 2668, -5681, 16656, 23820, -5263, 1931, -631, 112, 42, -47, 18,
+ 0, 24, -142, 476, -1215, 2668, -5680, 16638, 23835, -5259, 1928, -629, 111, 42, -47, 18, 0, 24, -142, 477, -1216, 2669, -5678, 16620, 23847, -5255, 1925, -627, 110, 43, -47, 18, 0, 25, -142, 477, -1217, 2669, -5677, 16601, 23863, -5251, 1922, -625, 109, 43, -47, 18, 0, 25, -143, 478, -1218, 2669, -5675, 16583, 23878, -5247, 1919, -623, 108, 44, -48, 18,
+ 0, 25, -143, 478, -1218, 2670, -5673, 16565, 23891, -5243, 1916, -621, 107, 44, -48, 18, 0, 25, -143, 479, -1219, 2670, -5672, 16547, 23908, -5240, 1912, -619, 105, 45, -48, 18, 0, 25, -143, 479, -1220, 2670, -5670, 16529, 23922, -5236, 1909, -617, 104, 45, -48, 19, 0, 25, -144, 480, -1220, 2671, -5668, 16510, 23935, -5232, 1906, -615, 103, 46, -48, 19,
+ 0, 25, -144, 480, -1221, 2671, -5667, 16492, 23952, -5228, 1903, -613, 102, 46, -49, 19, 0, 25, -144, 481, -1222, 2672, -5665, 16474, 23964, -5224, 1900, -611, 101, 47, -49, 19, 0, 26, -145, 481, -1222, 2672, -5663, 16456, 23978, -5220, 1897, -609, 100, 47, -49, 19, 0, 26, -145, 482, -1223, 2672, -5662, 16438, 23992, -5216, 1894, -607, 99, 48, -49, 19,
+ 0, 26, -145, 482, -1224, 2673, -5660, 16419, 24006, -5212, 1891, -605, 98, 49, -49, 19, 0, 26, -146, 483, -1224, 2673, -5658, 16401, 24022, -5208, 1888, -603, 96, 49, -50, 19, 0, 26, -146, 484, -1225, 2673, -5656, 16383, 24035, -5204, 1885, -601, 95, 50, -50, 19, 0, 26, -146, 484, -1226, 2673, -5655, 16365, 24052, -5200, 1881, -599, 94, 50, -50, 19,
+ 0, 26, -146, 485, -1226, 2674, -5653, 16347, 24063, -5196, 1878, -597, 93, 51, -50, 19, 0, 26, -147, 485, -1227, 2674, -5651, 16328, 24080, -5192, 1875, -595, 92, 51, -50, 19, 0, 26, -147, 486, -1228, 2674, -5649, 16310, 24094, -5188, 1872, -593, 91, 52, -51, 19, 0, 27, -147, 486, -1228, 2675, -5647, 16292, 24106, -5184, 1869, -591, 90, 52, -51, 19,
+ 0, 27, -148, 487, -1229, 2675, -5646, 16274, 24121, -5180, 1866, -589, 89, 53, -51, 19, 0, 27, -148, 487, -1230, 2675, -5644, 16255, 24138, -5176, 1863, -587, 87, 53, -51, 19, 0, 27, -148, 488, -1230, 2676, -5642, 16237, 24149, -5171, 1859, -585, 86, 54, -51, 19, 0, 27, -149, 488, -1231, 2676, -5640, 16219, 24166, -5167, 1856, -583, 85, 54, -52, 19,
+ -1, 27, -149, 489, -1232, 2676, -5638, 16201, 24180, -5163, 1853, -581, 84, 55, -52, 19, -1, 27, -149, 489, -1232, 2676, -5636, 16182, 24194, -5159, 1850, -579, 83, 55, -52, 20, -1, 27, -149, 490, -1233, 2677, -5635, 16164, 24207, -5155, 1847, -577, 82, 56, -52, 20, -1, 28, -150, 490, -1233, 2677, -5633, 16146, 24221, -5151, 1843, -575, 81, 57, -52, 20,
+ -1, 28, -150, 491, -1234, 2677, -5631, 16127, 24237, -5146, 1840, -573, 79, 57, -53, 20, -1, 28, -150, 491, -1235, 2677, -5629, 16109, 24251, -5142, 1837, -571, 78, 58, -53, 20, -1, 28, -151, 492, -1235, 2678, -5627, 16091, 24264, -5138, 1834, -569, 77, 58, -53, 20, -1, 28, -151, 492, -1236, 2678, -5625, 16073, 24278, -5134, 1831, -567, 76, 59, -53, 20,
+ -1, 28, -151, 493, -1237, 2678, -5623, 16054, 24293, -5129, 1827, -565, 75, 59, -53, 20, -1, 28, -151, 493, -1237, 2678, -5621, 16036, 24307, -5125, 1824, -563, 74, 60, -54, 20, -1, 28, -152, 494, -1238, 2678, -5619, 16018, 24322, -5121, 1821, -561, 73, 60, -54, 20, -1, 28, -152, 494, -1238, 2679, -5617, 15999, 24336, -5117, 1818, -559, 71, 61, -54, 20,
+ -1, 29, -152, 495, -1239, 2679, -5615, 15981, 24348, -5112, 1814, -556, 70, 61, -54, 20, -1, 29, -153, 495, -1240, 2679, -5613, 15963, 24363, -5108, 1811, -554, 69, 62, -54, 20, -1, 29, -153, 496, -1240, 2679, -5611, 15945, 24376, -5104, 1808, -552, 68, 63, -55, 20, -1, 29, -153, 496, -1241, 2679, -5609, 15926, 24391, -5099, 1805, -550, 67, 63, -55, 20,
+ -1, 29, -153, 497, -1241, 2680, -5607, 15908, 24403, -5095, 1801, -548, 66, 64, -55, 20, -1, 29, -154, 497, -1242, 2680, -5605, 15890, 24418, -5090, 1798, -546, 65, 64, -55, 20, -1, 29, -154, 498, -1242, 2680, -5603, 15871, 24432, -5086, 1795, -544, 63, 65, -55, 20, -1, 29, -154, 498, -1243, 2680, -5601, 15853, 24448, -5082, 1791, -542, 62, 65, -56, 21,
+ -1, 30, -155, 499, -1244, 2680, -5599, 15835, 24460, -5077, 1788, -540, 61, 66, -56, 21, -1, 30, -155, 499, -1244, 2680, -5597, 15816, 24475, -5073, 1785, -538, 60, 66, -56, 21, -1, 30, -155, 500, -1245, 2680, -5595, 15798, 24487, -5068, 1782, -536, 59, 67, -56, 21, -1, 30, -155, 500, -1245, 2681, -5593, 15780, 24501, -5064, 1778, -534, 58, 67, -56, 21,
+ -1, 30, -156, 501, -1246, 2681, -5591, 15761, 24516, -5059, 1775, -531, 56, 68, -57, 21, -1, 30, -156, 501, -1246, 2681, -5589, 15743, 24530, -5055, 1772, -529, 55, 68, -57, 21, -1, 30, -156, 502, -1247, 2681, -5587, 15725, 24543, -5050, 1768, -527, 54, 69, -57, 21, -1, 30, -156, 502, -1248, 2681, -5584, 15706, 24557, -5046, 1765, -525, 53, 70, -57, 21,
+ -1, 30, -157, 503, -1248, 2681, -5582, 15688, 24570, -5041, 1762, -523, 52, 70, -57, 21, -1, 31, -157, 503, -1249, 2681, -5580, 15670, 24585, -5037, 1758, -521, 51, 71, -58, 21, -1, 31, -157, 503, -1249, 2681, -5578, 15651, 24600, -5032, 1755, -519, 49, 71, -58, 21, -1, 31, -158, 504, -1250, 2681, -5576, 15633, 24614, -5027, 1751, -517, 48, 72, -58, 21,
+ -1, 31, -158, 504, -1250, 2682, -5574, 15615, 24627, -5023, 1748, -515, 47, 72, -58, 21, -1, 31, -158, 505, -1251, 2682, -5571, 15596, 24639, -5018, 1745, -512, 46, 73, -59, 21, -1, 31, -158, 505, -1251, 2682, -5569, 15578, 24654, -5014, 1741, -510, 45, 73, -59, 21, -1, 31, -159, 506, -1252, 2682, -5567, 15559, 24668, -5009, 1738, -508, 44, 74, -59, 21,
+ -1, 31, -159, 506, -1252, 2682, -5565, 15541, 24682, -5004, 1735, -506, 42, 74, -59, 21, -2, 31, -159, 507, -1253, 2682, -5563, 15523, 24697, -5000, 1731, -504, 41, 75, -59, 21, -2, 32, -159, 507, -1253, 2682, -5560, 15504, 24708, -4995, 1728, -502, 40, 76, -60, 22, -2, 32, -160, 508, -1254, 2682, -5558, 15486, 24723, -4990, 1724, -500, 39, 76, -60, 22,
+ -2, 32, -160, 508, -1254, 2682, -5556, 15468, 24735, -4986, 1721, -497, 38, 77, -60, 22, -2, 32, -160, 509, -1255, 2682, -5554, 15449, 24750, -4981, 1717, -495, 37, 77, -60, 22, -2, 32, -161, 509, -1255, 2682, -5551, 15431, 24763, -4976, 1714, -493, 35, 78, -60, 22, -2, 32, -161, 509, -1256, 2682, -5549, 15412, 24779, -4971, 1711, -491, 34, 78, -61, 22,
+ -2, 32, -161, 510, -1256, 2682, -5547, 15394, 24791, -4966, 1707, -489, 33, 79, -61, 22, -2, 32, -161, 510, -1257, 2682, -5544, 15376, 24805, -4962, 1704, -487, 32, 79, -61, 22, -2, 32, -162, 511, -1257, 2682, -5542, 15357, 24819, -4957, 1700, -485, 31, 80, -61, 22, -2, 33, -162, 511, -1258, 2682, -5540, 15339, 24831, -4952, 1697, -482, 29, 81, -61, 22,
+ -2, 33, -162, 512, -1258, 2682, -5537, 15320, 24845, -4947, 1693, -480, 28, 81, -62, 22, -2, 33, -162, 512, -1259, 2682, -5535, 15302, 24858, -4942, 1690, -478, 27, 82, -62, 22, -2, 33, -163, 513, -1259, 2682, -5533, 15284, 24873, -4938, 1686, -476, 26, 82, -62, 22, -2, 33, -163, 513, -1260, 2682, -5530, 15265, 24886, -4933, 1683, -474, 25, 83, -62, 22,
+ -2, 33, -163, 513, -1260, 2682, -5528, 15247, 24900, -4928, 1679, -472, 24, 83, -62, 22, -2, 33, -163, 514, -1261, 2682, -5526, 15228, 24914, -4923, 1676, -469, 22, 84, -63, 22, -2, 33, -164, 514, -1261, 2682, -5523, 15210, 24928, -4918, 1672, -467, 21, 84, -63, 22, -2, 33, -164, 515, -1262, 2682, -5521, 15192, 24940, -4913, 1669, -465, 20, 85, -63, 22,
+ -2, 34, -164, 515, -1262, 2682, -5518, 15173, 24951, -4908, 1665, -463, 19, 86, -63, 23, -2, 34, -164, 516, -1263, 2682, -5516, 15155, 24964, -4903, 1662, -461, 18, 86, -63, 23, -2, 34, -165, 516, -1263, 2682, -5514, 15136, 24981, -4898, 1658, -459, 16, 87, -64, 23, -2, 34, -165, 516, -1264, 2682, -5511, 15118, 24993, -4893, 1655, -456, 15, 87, -64, 23,
+ -2, 34, -165, 517, -1264, 2681, -5509, 15099, 25007, -4888, 1651, -454, 14, 88, -64, 23, -2, 34, -165, 517, -1265, 2681, -5506, 15081, 25020, -4883, 1648, -452, 13, 88, -64, 23, -2, 34, -166, 518, -1265, 2681, -5504, 15063, 25034, -4878, 1644, -450, 12, 89, -65, 23, -2, 34, -166, 518, -1265, 2681, -5501, 15044, 25048, -4873, 1641, -448, 10, 89, -65, 23,
+ -2, 34, -166, 519, -1266, 2681, -5499, 15026, 25060, -4868, 1637, -445, 9, 90, -65, 23, -2, 34, -166, 519, -1266, 2681, -5496, 15007, 25072, -4863, 1634, -443, 8, 91, -65, 23, -2, 35, -167, 519, -1267, 2681, -5494, 14989, 25087, -4858, 1630, -441, 7, 91, -65, 23, -2, 35, -167, 520, -1267, 2681, -5491, 14970, 25100, -4853, 1626, -439, 6, 92, -66, 23,
+ -2, 35, -167, 520, -1268, 2681, -5489, 14952, 25115, -4848, 1623, -437, 4, 92, -66, 23, -2, 35, -168, 521, -1268, 2681, -5486, 14933, 25126, -4842, 1619, -434, 3, 93, -66, 23, -2, 35, -168, 521, -1268, 2680, -5484, 14915, 25140, -4837, 1616, -432, 2, 93, -66, 23, -2, 35, -168, 522, -1269, 2680, -5481, 14897, 25152, -4832, 1612, -430, 1, 94, -66, 23,
+ -2, 35, -168, 522, -1269, 2680, -5479, 14878, 25168, -4827, 1608, -428, 0, 94, -67, 23, -2, 35, -168, 522, -1270, 2680, -5476, 14860, 25181, -4822, 1605, -426, -2, 95, -67, 23, -2, 35, -169, 523, -1270, 2680, -5473, 14841, 25192, -4816, 1601, -423, -3, 96, -67, 23, -2, 35, -169, 523, -1271, 2680, -5471, 14823, 25205, -4811, 1598, -421, -4, 96, -67, 24,
+ -2, 36, -169, 524, -1271, 2680, -5468, 14804, 25216, -4806, 1594, -419, -5, 97, -67, 24, -3, 36, -169, 524, -1271, 2679, -5466, 14786, 25233, -4801, 1590, -417, -6, 97, -68, 24, -3, 36, -170, 524, -1272, 2679, -5463, 14767, 25247, -4796, 1587, -414, -8, 98, -68, 24, -3, 36, -170, 525, -1272, 2679, -5460, 14749, 25258, -4790, 1583, -412, -9, 98, -68, 24,
+ -3, 36, -170, 525, -1273, 2679, -5458, 14730, 25273, -4785, 1579, -410, -10, 99, -68, 24, -3, 36, -170, 526, -1273, 2679, -5455, 14712, 25284, -4780, 1576, -408, -11, 99, -68, 24, -3, 36, -171, 526, -1273, 2678, -5452, 14693, 25299, -4774, 1572, -405, -13, 100, -69, 24, -3, 36, -171, 526, -1274, 2678, -5450, 14675, 25313, -4769, 1568, -403, -14, 101, -69, 24,
+ -3, 36, -171, 527, -1274, 2678, -5447, 14657, 25324, -4764, 1565, -401, -15, 101, -69, 24, -3, 37, -171, 527, -1275, 2678, -5444, 14638, 25336, -4758, 1561, -399, -16, 102, -69, 24, -3, 37, -172, 528, -1275, 2678, -5442, 14620, 25351, -4753, 1557, -397, -17, 102, -70, 24, -3, 37, -172, 528, -1275, 2677, -5439, 14601, 25363, -4747, 1554, -394, -19, 103, -70, 24,
+ -3, 37, -172, 528, -1276, 2677, -5436, 14583, 25377, -4742, 1550, -392, -20, 103, -70, 24, -3, 37, -172, 529, -1276, 2677, -5434, 14564, 25390, -4737, 1546, -390, -21, 104, -70, 24, -3, 37, -173, 529, -1276, 2677, -5431, 14546, 25401, -4731, 1543, -388, -22, 105, -70, 24, -3, 37, -173, 529, -1277, 2676, -5428, 14527, 25417, -4726, 1539, -385, -23, 105, -71, 24,
+ -3, 37, -173, 530, -1277, 2676, -5425, 14509, 25428, -4720, 1535, -383, -25, 106, -71, 24, -3, 37, -173, 530, -1277, 2676, -5423, 14490, 25441, -4715, 1532, -381, -26, 106, -71, 25, -3, 37, -174, 531, -1278, 2676, -5420, 14472, 25452, -4709, 1528, -378, -27, 107, -71, 25, -3, 38, -174, 531, -1278, 2675, -5417, 14453, 25466, -4704, 1524, -376, -28, 107, -71, 25,
+ -3, 38, -174, 531, -1278, 2675, -5414, 14435, 25479, -4698, 1520, -374, -30, 108, -72, 25, -3, 38, -174, 532, -1279, 2675, -5412, 14416, 25492, -4693, 1517, -372, -31, 109, -72, 25, -3, 38, -174, 532, -1279, 2675, -5409, 14398, 25503, -4687, 1513, -369, -32, 109, -72, 25, -3, 38, -175, 532, -1280, 2674, -5406, 14379, 25519, -4682, 1509, -367, -33, 110, -72, 25,
+ -3, 38, -175, 533, -1280, 2674, -5403, 14361, 25531, -4676, 1505, -365, -35, 110, -72, 25, -3, 38, -175, 533, -1280, 2674, -5400, 14342, 25543, -4670, 1502, -363, -36, 111, -73, 25, -3, 38, -175, 534, -1281, 2673, -5397, 14324, 25556, -4665, 1498, -360, -37, 111, -73, 25, -3, 38, -176, 534, -1281, 2673, -5395, 14305, 25570, -4659, 1494, -358, -38, 112, -73, 25,
+ -3, 38, -176, 534, -1281, 2673, -5392, 14287, 25582, -4653, 1490, -356, -39, 112, -73, 25, -3, 38, -176, 535, -1281, 2672, -5389, 14268, 25595, -4648, 1486, -353, -41, 113, -73, 25, -3, 39, -176, 535, -1282, 2672, -5386, 14250, 25606, -4642, 1483, -351, -42, 114, -74, 25, -3, 39, -177, 535, -1282, 2672, -5383, 14231, 25620, -4636, 1479, -349, -43, 114, -74, 25,
+ -3, 39, -177, 536, -1282, 2671, -5380, 14213, 25631, -4631, 1475, -346, -44, 115, -74, 25, -3, 39, -177, 536, -1283, 2671, -5377, 14194, 25646, -4625, 1471, -344, -46, 115, -74, 25, -3, 39, -177, 536, -1283, 2671, -5374, 14176, 25658, -4619, 1467, -342, -47, 116, -75, 25, -3, 39, -177, 537, -1283, 2670, -5371, 14157, 25670, -4614, 1464, -340, -48, 116, -75, 26,
+ -3, 39, -178, 537, -1284, 2670, -5369, 14139, 25683, -4608, 1460, -337, -49, 117, -75, 26, -3, 39, -178, 537, -1284, 2670, -5366, 14120, 25696, -4602, 1456, -335, -51, 118, -75, 26, -3, 39, -178, 538, -1284, 2669, -5363, 14102, 25708, -4596, 1452, -333, -52, 118, -75, 26, -3, 39, -178, 538, -1285, 2669, -5360, 14083, 25721, -4590, 1448, -330, -53, 119, -76, 26,
+ -3, 40, -179, 539, -1285, 2669, -5357, 14065, 25733, -4585, 1444, -328, -54, 119, -76, 26, -3, 40, -179, 539, -1285, 2668, -5354, 14046, 25746, -4579, 1441, -326, -56, 120, -76, 26, -3, 40, -179, 539, -1285, 2668, -5351, 14028, 25757, -4573, 1437, -323, -57, 120, -76, 26, -3, 40, -179, 540, -1286, 2667, -5348, 14009, 25770, -4567, 1433, -321, -58, 121, -76, 26,
+ -3, 40, -179, 540, -1286, 2667, -5345, 13990, 25783, -4561, 1429, -319, -59, 122, -77, 26, -3, 40, -180, 540, -1286, 2667, -5342, 13972, 25796, -4555, 1425, -316, -61, 122, -77, 26, -4, 40, -180, 541, -1286, 2666, -5339, 13953, 25809, -4549, 1421, -314, -62, 123, -77, 26, -4, 40, -180, 541, -1287, 2666, -5336, 13935, 25822, -4543, 1417, -312, -63, 123, -77, 26,
+ -4, 40, -180, 541, -1287, 2665, -5333, 13916, 25835, -4538, 1413, -309, -64, 124, -77, 26, -4, 40, -181, 542, -1287, 2665, -5330, 13898, 25849, -4532, 1409, -307, -66, 124, -78, 26, -4, 40, -181, 542, -1288, 2664, -5327, 13879, 25862, -4526, 1406, -305, -67, 125, -78, 26, -4, 41, -181, 542, -1288, 2664, -5324, 13861, 25871, -4520, 1402, -302, -68, 126, -78, 26,
+ -4, 41, -181, 543, -1288, 2664, -5320, 13842, 25882, -4514, 1398, -300, -69, 126, -78, 26, -4, 41, -181, 543, -1288, 2663, -5317, 13824, 25895, -4508, 1394, -298, -71, 127, -79, 27, -4, 41, -182, 543, -1289, 2663, -5314, 13805, 25909, -4502, 1390, -295, -72, 127, -79, 27, -4, 41, -182, 544, -1289, 2662, -5311, 13787, 25920, -4496, 1386, -293, -73, 128, -79, 27,
+ -4, 41, -182, 544, -1289, 2662, -5308, 13768, 25933, -4490, 1382, -291, -74, 128, -79, 27, -4, 41, -182, 544, -1289, 2661, -5305, 13750, 25944, -4483, 1378, -288, -76, 129, -79, 27, -4, 41, -182, 545, -1290, 2661, -5302, 13731, 25957, -4477, 1374, -286, -77, 130, -80, 27, -4, 41, -183, 545, -1290, 2660, -5299, 13713, 25971, -4471, 1370, -284, -78, 130, -80, 27,
+ -4, 41, -183, 545, -1290, 2660, -5296, 13694, 25982, -4465, 1366, -281, -79, 131, -80, 27, -4, 41, -183, 545, -1290, 2659, -5292, 13676, 25995, -4459, 1362, -279, -81, 131, -80, 27, -4, 42, -183, 546, -1290, 2659, -5289, 13657, 26005, -4453, 1358, -277, -82, 132, -80, 27, -4, 42, -183, 546, -1291, 2658, -5286, 13638, 26020, -4447, 1354, -274, -83, 132, -81, 27,
+ -4, 42, -184, 546, -1291, 2658, -5283, 13620, 26032, -4441, 1350, -272, -84, 133, -81, 27, -4, 42, -184, 547, -1291, 2657, -5280, 13601, 26043, -4434, 1346, -269, -86, 134, -81, 27, -4, 42, -184, 547, -1291, 2657, -5277, 13583, 26055, -4428, 1342, -267, -87, 134, -81, 27, -4, 42, -184, 547, -1292, 2656, -5273, 13564, 26069, -4422, 1338, -265, -88, 135, -82, 27,
+ -4, 42, -185, 548, -1292, 2656, -5270, 13546, 26080, -4416, 1334, -262, -89, 135, -82, 27, -4, 42, -185, 548, -1292, 2655, -5267, 13527, 26094, -4410, 1330, -260, -91, 136, -82, 27, -4, 42, -185, 548, -1292, 2655, -5264, 13509, 26103, -4403, 1326, -258, -92, 137, -82, 28, -4, 42, -185, 549, -1292, 2654, -5260, 13490, 26114, -4397, 1322, -255, -93, 137, -82, 28,
+ -4, 42, -185, 549, -1293, 2654, -5257, 13472, 26127, -4391, 1318, -253, -94, 138, -83, 28, -4, 42, -186, 549, -1293, 2653, -5254, 13453, 26141, -4384, 1314, -250, -96, 138, -83, 28, -4, 43, -186, 549, -1293, 2652, -5251, 13435, 26152, -4378, 1310, -248, -97, 139, -83, 28, -4, 43, -186, 550, -1293, 2652, -5247, 13416, 26163, -4372, 1306, -246, -98, 139, -83, 28,
+ -4, 43, -186, 550, -1293, 2651, -5244, 13397, 26175, -4365, 1302, -243, -100, 140, -83, 28, -4, 43, -186, 550, -1293, 2651, -5241, 13379, 26187, -4359, 1298, -241, -101, 141, -84, 28, -4, 43, -187, 551, -1294, 2650, -5238, 13360, 26201, -4353, 1294, -238, -102, 141, -84, 28, -4, 43, -187, 551, -1294, 2650, -5234, 13342, 26210, -4346, 1290, -236, -103, 142, -84, 28,
+ -4, 43, -187, 551, -1294, 2649, -5231, 13323, 26225, -4340, 1286, -234, -105, 142, -84, 28, -4, 43, -187, 552, -1294, 2648, -5228, 13305, 26236, -4334, 1282, -231, -106, 143, -85, 28, -4, 43, -187, 552, -1294, 2648, -5224, 13286, 26247, -4327, 1278, -229, -107, 143, -85, 28, -4, 43, -187, 552, -1295, 2647, -5221, 13268, 26259, -4321, 1274, -226, -108, 144, -85, 28,
+ -4, 43, -188, 552, -1295, 2647, -5218, 13249, 26272, -4314, 1270, -224, -110, 145, -85, 28, -4, 44, -188, 553, -1295, 2646, -5214, 13231, 26283, -4308, 1265, -222, -111, 145, -85, 28, -4, 44, -188, 553, -1295, 2645, -5211, 13212, 26295, -4301, 1261, -219, -112, 146, -86, 28, -4, 44, -188, 553, -1295, 2645, -5208, 13194, 26308, -4295, 1257, -217, -114, 146, -86, 28,
+ -4, 44, -188, 553, -1295, 2644, -5204, 13175, 26317, -4288, 1253, -214, -115, 147, -86, 29, -4, 44, -189, 554, -1295, 2643, -5201, 13156, 26330, -4282, 1249, -212, -116, 148, -86, 29, -4, 44, -189, 554, -1296, 2643, -5197, 13138, 26341, -4275, 1245, -210, -117, 148, -86, 29, -4, 44, -189, 554, -1296, 2642, -5194, 13119, 26355, -4269, 1241, -207, -119, 149, -87, 29,
+ -4, 44, -189, 555, -1296, 2641, -5191, 13101, 26366, -4262, 1237, -205, -120, 149, -87, 29, -4, 44, -189, 555, -1296, 2641, -5187, 13082, 26376, -4255, 1232, -202, -121, 150, -87, 29, -4, 44, -190, 555, -1296, 2640, -5184, 13064, 26390, -4249, 1228, -200, -122, 150, -87, 29, -4, 44, -190, 555, -1296, 2639, -5180, 13045, 26401, -4242, 1224, -197, -124, 151, -87, 29,
+ -4, 44, -190, 556, -1296, 2639, -5177, 13027, 26412, -4236, 1220, -195, -125, 152, -88, 29, -5, 45, -190, 556, -1297, 2638, -5173, 13008, 26425, -4229, 1216, -193, -126, 152, -88, 29, -5, 45, -190, 556, -1297, 2637, -5170, 12990, 26436, -4222, 1212, -190, -128, 153, -88, 29, -5, 45, -191, 556, -1297, 2637, -5167, 12971, 26450, -4216, 1208, -188, -129, 153, -88, 29,
+ -5, 45, -191, 557, -1297, 2636, -5163, 12952, 26461, -4209, 1203, -185, -130, 154, -89, 29, -5, 45, -191, 557, -1297, 2635, -5160, 12934, 26473, -4202, 1199, -183, -131, 154, -89, 29, -5, 45, -191, 557, -1297, 2635, -5156, 12915, 26483, -4195, 1195, -180, -133, 155, -89, 29, -5, 45, -191, 557, -1297, 2634, -5153, 12897, 26495, -4189, 1191, -178, -134, 156, -89, 29,
+ -5, 45, -191, 558, -1297, 2633, -5149, 12878, 26505, -4182, 1187, -175, -135, 156, -89, 29, -5, 45, -192, 558, -1297, 2633, -5146, 12860, 26519, -4175, 1182, -173, -137, 157, -90, 29, -5, 45, -192, 558, -1298, 2632, -5142, 12841, 26531, -4168, 1178, -171, -138, 157, -90, 30, -5, 45, -192, 559, -1298, 2631, -5138, 12823, 26540, -4162, 1174, -168, -139, 158, -90, 30,
+ -5, 45, -192, 559, -1298, 2630, -5135, 12804, 26552, -4155, 1170, -166, -140, 159, -90, 30, -5, 45, -192, 559, -1298, 2630, -5131, 12786, 26562, -4148, 1166, -163, -142, 159, -90, 30, -5, 46, -193, 559, -1298, 2629, -5128, 12767, 26576, -4141, 1161, -161, -143, 160, -91, 30, -5, 46, -193, 559, -1298, 2628, -5124, 12749, 26586, -4134, 1157, -158, -144, 160, -91, 30,
+ -5, 46, -193, 560, -1298, 2627, -5121, 12730, 26598, -4127, 1153, -156, -146, 161, -91, 30, -5, 46, -193, 560, -1298, 2627, -5117, 12712, 26607, -4120, 1149, -153, -147, 161, -91, 30, -5, 46, -193, 560, -1298, 2626, -5114, 12693, 26622, -4114, 1144, -151, -148, 162, -92, 30, -5, 46, -193, 560, -1298, 2625, -5110, 12674, 26633, -4107, 1140, -148, -150, 163, -92, 30,
+ -5, 46, -194, 561, -1298, 2624, -5106, 12656, 26644, -4100, 1136, -146, -151, 163, -92, 30, -5, 46, -194, 561, -1298, 2623, -5103, 12637, 26655, -4093, 1132, -143, -152, 164, -92, 30, -5, 46, -194, 561, -1298, 2623, -5099, 12619, 26666, -4086, 1127, -141, -153, 164, -92, 30, -5, 46, -194, 561, -1299, 2622, -5095, 12600, 26679, -4079, 1123, -138, -155, 165, -93, 30,
+ -5, 46, -194, 562, -1299, 2621, -5092, 12582, 26689, -4072, 1119, -136, -156, 166, -93, 30, -5, 46, -194, 562, -1299, 2620, -5088, 12563, 26701, -4065, 1114, -133, -157, 166, -93, 30, -5, 46, -195, 562, -1299, 2620, -5085, 12545, 26713, -4058, 1110, -131, -159, 167, -93, 30, -5, 47, -195, 562, -1299, 2619, -5081, 12526, 26723, -4051, 1106, -129, -160, 167, -93, 31,
+ -5, 47, -195, 563, -1299, 2618, -5077, 12508, 26732, -4044, 1102, -126, -161, 168, -94, 31, -5, 47, -195, 563, -1299, 2617, -5074, 12489, 26747, -4037, 1097, -124, -163, 168, -94, 31, -5, 47, -195, 563, -1299, 2616, -5070, 12471, 26756, -4030, 1093, -121, -164, 169, -94, 31, -5, 47, -195, 563, -1299, 2615, -5066, 12452, 26767, -4023, 1089, -119, -165, 170, -94, 31,
+ -5, 47, -196, 563, -1299, 2615, -5062, 12434, 26778, -4015, 1084, -116, -166, 170, -95, 31, -5, 47, -196, 564, -1299, 2614, -5059, 12415, 26790, -4008, 1080, -114, -168, 171, -95, 31, -5, 47, -196, 564, -1299, 2613, -5055, 12397, 26800, -4001, 1076, -111, -169, 171, -95, 31, -5, 47, -196, 564, -1299, 2612, -5051, 12378, 26812, -3994, 1071, -109, -170, 172, -95, 31,
+ -5, 47, -196, 564, -1299, 2611, -5048, 12360, 26823, -3987, 1067, -106, -172, 173, -95, 31, -5, 47, -196, 565, -1299, 2610, -5044, 12341, 26835, -3980, 1063, -104, -173, 173, -96, 31, -5, 47, -197, 565, -1299, 2610, -5040, 12322, 26846, -3973, 1058, -101, -174, 174, -96, 31, -5, 47, -197, 565, -1299, 2609, -5036, 12304, 26857, -3965, 1054, -99, -176, 174, -96, 31,
+ -5, 48, -197, 565, -1299, 2608, -5033, 12285, 26867, -3958, 1050, -96, -177, 175, -96, 31, -5, 48, -197, 565, -1299, 2607, -5029, 12267, 26878, -3951, 1045, -94, -178, 176, -96, 31, -5, 48, -197, 566, -1299, 2606, -5025, 12248, 26889, -3944, 1041, -91, -179, 176, -97, 31, -5, 48, -197, 566, -1299, 2605, -5021, 12230, 26899, -3936, 1036, -88, -181, 177, -97, 31,
+ -5, 48, -198, 566, -1299, 2604, -5018, 12211, 26913, -3929, 1032, -86, -182, 177, -97, 31, -5, 48, -198, 566, -1299, 2603, -5014, 12193, 26921, -3922, 1028, -83, -183, 178, -97, 32, -5, 48, -198, 566, -1299, 2602, -5010, 12174, 26935, -3914, 1023, -81, -185, 178, -98, 32, -5, 48, -198, 567, -1299, 2602, -5006, 12156, 26942, -3907, 1019, -78, -186, 179, -98, 32,
+ -5, 48, -198, 567, -1299, 2601, -5002, 12137, 26954, -3900, 1014, -76, -187, 180, -98, 32, -5, 48, -198, 567, -1299, 2600, -4998, 12119, 26964, -3892, 1010, -73, -189, 180, -98, 32, -5, 48, -199, 567, -1299, 2599, -4995, 12100, 26977, -3885, 1006, -71, -190, 181, -98, 32, -5, 48, -199, 567, -1299, 2598, -4991, 12082, 26989, -3878, 1001, -68, -191, 181, -99, 32,
+ -5, 48, -199, 568, -1299, 2597, -4987, 12063, 26999, -3870, 997, -66, -193, 182, -99, 32, -5, 48, -199, 568, -1299, 2596, -4983, 12045, 27009, -3863, 992, -63, -194, 183, -99, 32, -5, 49, -199, 568, -1299, 2595, -4979, 12026, 27019, -3855, 988, -61, -195, 183, -99, 32, -5, 49, -199, 568, -1299, 2594, -4975, 12008, 27029, -3848, 984, -58, -197, 184, -99, 32,
+ -5, 49, -199, 568, -1299, 2593, -4971, 11989, 27043, -3841, 979, -56, -198, 184, -100, 32, -5, 49, -200, 569, -1299, 2592, -4968, 11971, 27052, -3833, 975, -53, -199, 185, -100, 32, -5, 49, -200, 569, -1299, 2591, -4964, 11952, 27065, -3826, 970, -51, -201, 186, -100, 32, -5, 49, -200, 569, -1299, 2590, -4960, 11934, 27074, -3818, 966, -48, -202, 186, -100, 32,
+ -5, 49, -200, 569, -1299, 2589, -4956, 11915, 27086, -3811, 961, -45, -203, 187, -101, 32, -6, 49, -200, 569, -1299, 2588, -4952, 11897, 27097, -3803, 957, -43, -204, 187, -101, 32, -6, 49, -200, 569, -1299, 2587, -4948, 11878, 27108, -3796, 952, -40, -206, 188, -101, 33, -6, 49, -201, 570, -1299, 2586, -4944, 11860, 27118, -3788, 948, -38, -207, 188, -101, 33,
+ -6, 49, -201, 570, -1299, 2585, -4940, 11841, 27128, -3780, 943, -35, -208, 189, -101, 33, -6, 49, -201, 570, -1299, 2584, -4936, 11823, 27140, -3773, 939, -33, -210, 190, -102, 33, -6, 49, -201, 570, -1299, 2583, -4932, 11804, 27151, -3765, 934, -30, -211, 190, -102, 33, -6, 49, -201, 570, -1299, 2582, -4928, 11786, 27161, -3758, 930, -28, -212, 191, -102, 33,
+ -6, 49, -201, 571, -1299, 2581, -4924, 11768, 27171, -3750, 925, -25, -214, 191, -102, 33, -6, 50, -201, 571, -1298, 2580, -4920, 11749, 27178, -3742, 921, -22, -215, 192, -102, 33, -6, 50, -202, 571, -1298, 2579, -4916, 11731, 27191, -3735, 916, -20, -216, 193, -103, 33, -6, 50, -202, 571, -1298, 2578, -4912, 11712, 27202, -3727, 912, -17, -218, 193, -103, 33,
+ -6, 50, -202, 571, -1298, 2577, -4908, 11694, 27212, -3719, 907, -15, -219, 194, -103, 33, -6, 50, -202, 571, -1298, 2576, -4904, 11675, 27223, -3712, 903, -12, -220, 194, -103, 33, -6, 50, -202, 572, -1298, 2575, -4900, 11657, 27234, -3704, 898, -10, -222, 195, -104, 33, -6, 50, -202, 572, -1298, 2574, -4896, 11638, 27243, -3696, 894, -7, -223, 196, -104, 33,
+ -6, 50, -202, 572, -1298, 2573, -4892, 11620, 27253, -3688, 889, -4, -224, 196, -104, 33, -6, 50, -203, 572, -1298, 2572, -4888, 11601, 27266, -3681, 885, -2, -226, 197, -104, 33, -6, 50, -203, 572, -1298, 2571, -4884, 11583, 27276, -3673, 880, 1, -227, 197, -104, 33, -6, 50, -203, 572, -1298, 2570, -4880, 11564, 27287, -3665, 876, 3, -228, 198, -105, 33,
+ -6, 50, -203, 572, -1298, 2569, -4876, 11546, 27296, -3657, 871, 6, -230, 199, -105, 34, -6, 50, -203, 573, -1297, 2568, -4872, 11527, 27306, -3649, 866, 8, -231, 199, -105, 34, -6, 50, -203, 573, -1297, 2567, -4868, 11509, 27315, -3642, 862, 11, -232, 200, -105, 34, -6, 50, -203, 573, -1297, 2566, -4864, 11491, 27326, -3634, 857, 14, -234, 200, -105, 34,
+ -6, 51, -204, 573, -1297, 2565, -4860, 11472, 27337, -3626, 853, 16, -235, 201, -106, 34, -6, 51, -204, 573, -1297, 2564, -4856, 11454, 27347, -3618, 848, 19, -236, 201, -106, 34, -6, 51, -204, 573, -1297, 2562, -4852, 11435, 27359, -3610, 844, 21, -238, 202, -106, 34, -6, 51, -204, 574, -1297, 2561, -4848, 11417, 27367, -3602, 839, 24, -239, 203, -106, 34,
+ -6, 51, -204, 574, -1297, 2560, -4843, 11398, 27378, -3594, 834, 27, -240, 203, -107, 34, -6, 51, -204, 574, -1297, 2559, -4839, 11380, 27388, -3586, 830, 29, -242, 204, -107, 34, -6, 51, -204, 574, -1296, 2558, -4835, 11361, 27398, -3578, 825, 32, -243, 204, -107, 34, -6, 51, -204, 574, -1296, 2557, -4831, 11343, 27407, -3570, 821, 34, -244, 205, -107, 34,
+ -6, 51, -205, 574, -1296, 2556, -4827, 11325, 27418, -3562, 816, 37, -246, 206, -107, 34, -6, 51, -205, 574, -1296, 2555, -4823, 11306, 27430, -3554, 811, 40, -247, 206, -108, 34, -6, 51, -205, 575, -1296, 2554, -4819, 11288, 27438, -3546, 807, 42, -248, 207, -108, 34, -6, 51, -205, 575, -1296, 2552, -4814, 11269, 27450, -3538, 802, 45, -250, 207, -108, 34,
+ -6, 51, -205, 575, -1296, 2551, -4810, 11251, 27460, -3530, 797, 47, -251, 208, -108, 34, -6, 51, -205, 575, -1296, 2550, -4806, 11232, 27468, -3522, 793, 50, -252, 209, -108, 35, -6, 51, -205, 575, -1295, 2549, -4802, 11214, 27479, -3514, 788, 53, -254, 209, -109, 35, -6, 51, -206, 575, -1295, 2548, -4798, 11196, 27490, -3506, 783, 55, -255, 210, -109, 35,
+ -6, 52, -206, 575, -1295, 2547, -4794, 11177, 27499, -3498, 779, 58, -256, 210, -109, 35, -6, 52, -206, 575, -1295, 2545, -4789, 11159, 27510, -3490, 774, 60, -258, 211, -109, 35, -6, 52, -206, 576, -1295, 2544, -4785, 11140, 27520, -3482, 769, 63, -259, 212, -110, 35, -6, 52, -206, 576, -1295, 2543, -4781, 11122, 27529, -3474, 765, 66, -260, 212, -110, 35,
+ -6, 52, -206, 576, -1295, 2542, -4777, 11104, 27540, -3466, 760, 68, -262, 213, -110, 35, -6, 52, -206, 576, -1294, 2541, -4772, 11085, 27548, -3457, 755, 71, -263, 213, -110, 35, -6, 52, -206, 576, -1294, 2540, -4768, 11067, 27557, -3449, 751, 73, -264, 214, -110, 35, -6, 52, -207, 576, -1294, 2538, -4764, 11048, 27572, -3441, 746, 76, -266, 214, -111, 35,
+ -6, 52, -207, 576, -1294, 2537, -4760, 11030, 27581, -3433, 741, 79, -267, 215, -111, 35, -6, 52, -207, 576, -1294, 2536, -4755, 11011, 27590, -3425, 737, 81, -268, 216, -111, 35, -6, 52, -207, 577, -1294, 2535, -4751, 10993, 27599, -3416, 732, 84, -270, 216, -111, 35, -6, 52, -207, 577, -1293, 2534, -4747, 10975, 27607, -3408, 727, 87, -271, 217, -111, 35,
+ -6, 52, -207, 577, -1293, 2532, -4743, 10956, 27620, -3400, 723, 89, -272, 217, -112, 35, -6, 52, -207, 577, -1293, 2531, -4738, 10938, 27628, -3391, 718, 92, -274, 218, -112, 35, -6, 52, -207, 577, -1293, 2530, -4734, 10920, 27637, -3383, 713, 95, -275, 219, -112, 35, -6, 52, -207, 577, -1293, 2529, -4730, 10901, 27648, -3375, 708, 97, -276, 219, -112, 36,
+ -6, 52, -208, 577, -1292, 2528, -4726, 10883, 27658, -3367, 704, 100, -278, 220, -113, 36, -6, 53, -208, 577, -1292, 2526, -4721, 10864, 27668, -3358, 699, 102, -279, 220, -113, 36, -6, 53, -208, 577, -1292, 2525, -4717, 10846, 27677, -3350, 694, 105, -280, 221, -113, 36, -6, 53, -208, 577, -1292, 2524, -4713, 10828, 27686, -3341, 689, 108, -282, 222, -113, 36,
+ -6, 53, -208, 578, -1292, 2523, -4708, 10809, 27695, -3333, 685, 110, -283, 222, -113, 36, -6, 53, -208, 578, -1291, 2521, -4704, 10791, 27705, -3325, 680, 113, -284, 223, -114, 36, -6, 53, -208, 578, -1291, 2520, -4700, 10773, 27715, -3316, 675, 116, -286, 223, -114, 36, -6, 53, -208, 578, -1291, 2519, -4695, 10754, 27725, -3308, 670, 118, -287, 224, -114, 36,
+ -6, 53, -209, 578, -1291, 2518, -4691, 10736, 27733, -3299, 666, 121, -288, 225, -114, 36, -6, 53, -209, 578, -1291, 2516, -4686, 10718, 27744, -3291, 661, 124, -290, 225, -114, 36, -6, 53, -209, 578, -1290, 2515, -4682, 10699, 27754, -3282, 656, 126, -291, 226, -115, 36, -6, 53, -209, 578, -1290, 2514, -4678, 10681, 27764, -3274, 651, 129, -292, 226, -115, 36,
+ -6, 53, -209, 578, -1290, 2512, -4673, 10662, 27773, -3265, 647, 132, -294, 227, -115, 36, -6, 53, -209, 578, -1290, 2511, -4669, 10644, 27783, -3257, 642, 134, -295, 228, -115, 36, -6, 53, -209, 579, -1290, 2510, -4665, 10626, 27792, -3248, 637, 137, -297, 228, -115, 36, -6, 53, -209, 579, -1289, 2509, -4660, 10607, 27801, -3240, 632, 140, -298, 229, -116, 36,
+ -6, 53, -209, 579, -1289, 2507, -4656, 10589, 27812, -3231, 627, 142, -299, 229, -116, 36, -6, 53, -209, 579, -1289, 2506, -4651, 10571, 27819, -3223, 623, 145, -301, 230, -116, 37, -6, 53, -210, 579, -1289, 2505, -4647, 10552, 27831, -3214, 618, 147, -302, 230, -116, 37, -6, 54, -210, 579, -1288, 2503, -4642, 10534, 27838, -3205, 613, 150, -303, 231, -117, 37,
+ -6, 54, -210, 579, -1288, 2502, -4638, 10516, 27848, -3197, 608, 153, -305, 232, -117, 37, -6, 54, -210, 579, -1288, 2501, -4634, 10497, 27859, -3188, 603, 155, -306, 232, -117, 37, -6, 54, -210, 579, -1288, 2499, -4629, 10479, 27868, -3180, 598, 158, -307, 233, -117, 37, -7, 54, -210, 579, -1287, 2498, -4625, 10461, 27877, -3171, 594, 161, -309, 233, -117, 37,
+ -7, 54, -210, 579, -1287, 2497, -4620, 10443, 27885, -3162, 589, 164, -310, 234, -118, 37, -7, 54, -210, 579, -1287, 2495, -4616, 10424, 27897, -3154, 584, 166, -311, 235, -118, 37, -7, 54, -210, 579, -1287, 2494, -4611, 10406, 27906, -3145, 579, 169, -313, 235, -118, 37, -7, 54, -211, 580, -1286, 2493, -4607, 10388, 27913, -3136, 574, 172, -314, 236, -118, 37,
+ -7, 54, -211, 580, -1286, 2491, -4602, 10369, 27924, -3127, 569, 174, -315, 236, -118, 37, -7, 54, -211, 580, -1286, 2490, -4598, 10351, 27935, -3119, 564, 177, -317, 237, -119, 37, -7, 54, -211, 580, -1286, 2489, -4593, 10333, 27941, -3110, 560, 180, -318, 238, -119, 37, -7, 54, -211, 580, -1285, 2487, -4589, 10314, 27952, -3101, 555, 182, -319, 238, -119, 37,
+ -7, 54, -211, 580, -1285, 2486, -4584, 10296, 27960, -3092, 550, 185, -321, 239, -119, 37, -7, 54, -211, 580, -1285, 2484, -4580, 10278, 27971, -3083, 545, 188, -322, 239, -120, 37, -7, 54, -211, 580, -1284, 2483, -4575, 10260, 27979, -3075, 540, 190, -324, 240, -120, 38, -7, 54, -211, 580, -1284, 2482, -4571, 10241, 27988, -3066, 535, 193, -325, 241, -120, 38,
+ -7, 54, -211, 580, -1284, 2480, -4566, 10223, 27997, -3057, 530, 196, -326, 241, -120, 38, -7, 54, -212, 580, -1284, 2479, -4562, 10205, 28008, -3048, 525, 198, -328, 242, -120, 38, -7, 54, -212, 580, -1283, 2478, -4557, 10187, 28015, -3039, 521, 201, -329, 242, -121, 38, -7, 55, -212, 580, -1283, 2476, -4553, 10168, 28024, -3030, 516, 204, -330, 243, -121, 38,
+ -7, 55, -212, 580, -1283, 2475, -4548, 10150, 28034, -3021, 511, 206, -332, 243, -121, 38, -7, 55, -212, 580, -1282, 2473, -4544, 10132, 28042, -3012, 506, 209, -333, 244, -121, 38, -7, 55, -212, 580, -1282, 2472, -4539, 10113, 28051, -3004, 501, 212, -334, 245, -121, 38, -7, 55, -212, 581, -1282, 2470, -4534, 10095, 28061, -2995, 496, 215, -336, 245, -122, 38,
+ -7, 55, -212, 581, -1282, 2469, -4530, 10077, 28070, -2986, 491, 217, -337, 246, -122, 38, -7, 55, -212, 581, -1281, 2468, -4525, 10059, 28077, -2977, 486, 220, -338, 246, -122, 38, -7, 55, -212, 581, -1281, 2466, -4521, 10041, 28087, -2968, 481, 223, -340, 247, -122, 38, -7, 55, -212, 581, -1281, 2465, -4516, 10022, 28096, -2959, 476, 225, -341, 248, -122, 38,
+ -7, 55, -213, 581, -1280, 2463, -4511, 10004, 28107, -2950, 471, 228, -343, 248, -123, 38, -7, 55, -213, 581, -1280, 2462, -4507, 9986, 28115, -2941, 466, 231, -344, 249, -123, 38, -7, 55, -213, 581, -1280, 2460, -4502, 9968, 28125, -2932, 461, 233, -345, 249, -123, 38, -7, 55, -213, 581, -1279, 2459, -4498, 9949, 28133, -2922, 456, 236, -347, 250, -123, 38,
+ -7, 55, -213, 581, -1279, 2458, -4493, 9931, 28140, -2913, 451, 239, -348, 251, -124, 39, -7, 55, -213, 581, -1279, 2456, -4488, 9913, 28148, -2904, 447, 242, -349, 251, -124, 39, -7, 55, -213, 581, -1278, 2455, -4484, 9895, 28157, -2895, 442, 244, -351, 252, -124, 39, -7, 55, -213, 581, -1278, 2453, -4479, 9877, 28166, -2886, 437, 247, -352, 252, -124, 39,
+ -7, 55, -213, 581, -1278, 2452, -4474, 9858, 28174, -2877, 432, 250, -353, 253, -124, 39, -7, 55, -213, 581, -1277, 2450, -4470, 9840, 28185, -2868, 427, 252, -355, 254, -125, 39, -7, 55, -213, 581, -1277, 2449, -4465, 9822, 28193, -2859, 422, 255, -356, 254, -125, 39, -7, 55, -213, 581, -1277, 2447, -4460, 9804, 28200, -2849, 417, 258, -357, 255, -125, 39,
+ -7, 56, -214, 581, -1276, 2446, -4456, 9786, 28209, -2840, 412, 261, -359, 255, -125, 39, -7, 56, -214, 581, -1276, 2444, -4451, 9767, 28219, -2831, 407, 263, -360, 256, -125, 39, -7, 56, -214, 581, -1276, 2443, -4446, 9749, 28228, -2822, 402, 266, -362, 257, -126, 39, -7, 56, -214, 581, -1275, 2441, -4442, 9731, 28236, -2812, 397, 269, -363, 257, -126, 39,
+ -7, 56, -214, 581, -1275, 2440, -4437, 9713, 28244, -2803, 392, 271, -364, 258, -126, 39, -7, 56, -214, 581, -1275, 2438, -4432, 9695, 28254, -2794, 387, 274, -366, 258, -126, 39, -7, 56, -214, 581, -1274, 2437, -4427, 9676, 28261, -2785, 382, 277, -367, 259, -126, 39, -7, 56, -214, 581, -1274, 2435, -4423, 9658, 28271, -2775, 377, 280, -368, 259, -127, 39,
+ -7, 56, -214, 581, -1274, 2434, -4418, 9640, 28280, -2766, 372, 282, -370, 260, -127, 39, -7, 56, -214, 581, -1273, 2432, -4413, 9622, 28288, -2757, 366, 285, -371, 261, -127, 39, -7, 56, -214, 581, -1273, 2431, -4409, 9604, 28295, -2747, 361, 288, -372, 261, -127, 40, -7, 56, -214, 581, -1272, 2429, -4404, 9586, 28304, -2738, 356, 291, -374, 262, -128, 40,
+ -7, 56, -215, 581, -1272, 2428, -4399, 9568, 28314, -2729, 351, 293, -375, 262, -128, 40, -7, 56, -215, 581, -1272, 2426, -4394, 9549, 28323, -2719, 346, 296, -377, 263, -128, 40, -7, 56, -215, 581, -1271, 2424, -4390, 9531, 28331, -2710, 341, 299, -378, 264, -128, 40, -7, 56, -215, 581, -1271, 2423, -4385, 9513, 28339, -2700, 336, 301, -379, 264, -128, 40,
+ -7, 56, -215, 581, -1271, 2421, -4380, 9495, 28349, -2691, 331, 304, -381, 265, -129, 40, -7, 56, -215, 581, -1270, 2420, -4375, 9477, 28356, -2682, 326, 307, -382, 265, -129, 40, -7, 56, -215, 581, -1270, 2418, -4370, 9459, 28363, -2672, 321, 310, -383, 266, -129, 40, -7, 56, -215, 581, -1269, 2417, -4366, 9441, 28372, -2663, 316, 312, -385, 267, -129, 40,
+ -7, 56, -215, 581, -1269, 2415, -4361, 9423, 28380, -2653, 311, 315, -386, 267, -129, 40, -7, 56, -215, 581, -1269, 2413, -4356, 9404, 28390, -2644, 306, 318, -387, 268, -130, 40, -7, 56, -215, 581, -1268, 2412, -4351, 9386, 28397, -2634, 301, 321, -389, 268, -130, 40, -7, 57, -215, 581, -1268, 2410, -4346, 9368, 28405, -2625, 296, 323, -390, 269, -130, 40,
+ -7, 57, -215, 581, -1267, 2409, -4342, 9350, 28414, -2615, 290, 326, -392, 269, -130, 40, -7, 57, -215, 581, -1267, 2407, -4337, 9332, 28421, -2605, 285, 329, -393, 270, -130, 40, -7, 57, -216, 581, -1267, 2406, -4332, 9314, 28430, -2596, 280, 332, -394, 271, -131, 40, -7, 57, -216, 581, -1266, 2404, -4327, 9296, 28439, -2586, 275, 334, -396, 271, -131, 40,
+ -7, 57, -216, 581, -1266, 2402, -4322, 9278, 28446, -2577, 270, 337, -397, 272, -131, 41, -7, 57, -216, 581, -1265, 2401, -4317, 9260, 28452, -2567, 265, 340, -398, 272, -131, 41, -7, 57, -216, 581, -1265, 2399, -4313, 9242, 28461, -2557, 260, 343, -400, 273, -131, 41, -7, 57, -216, 581, -1265, 2397, -4308, 9224, 28471, -2548, 255, 345, -401, 274, -132, 41,
+ -7, 57, -216, 581, -1264, 2396, -4303, 9206, 28477, -2538, 250, 348, -402, 274, -132, 41, -7, 57, -216, 581, -1264, 2394, -4298, 9188, 28487, -2529, 244, 351, -404, 275, -132, 41, -7, 57, -216, 581, -1263, 2393, -4293, 9170, 28493, -2519, 239, 354, -405, 275, -132, 41, -7, 57, -216, 581, -1263, 2391, -4288, 9151, 28504, -2509, 234, 356, -407, 276, -133, 41,
+ -7, 57, -216, 581, -1262, 2389, -4283, 9133, 28510, -2499, 229, 359, -408, 277, -133, 41, -7, 57, -216, 581, -1262, 2388, -4279, 9115, 28519, -2490, 224, 362, -409, 277, -133, 41, -7, 57, -216, 581, -1262, 2386, -4274, 9097, 28527, -2480, 219, 365, -411, 278, -133, 41, -7, 57, -216, 581, -1261, 2384, -4269, 9079, 28534, -2470, 214, 368, -412, 278, -133, 41,
+ -7, 57, -216, 581, -1261, 2383, -4264, 9061, 28543, -2460, 208, 370, -413, 279, -134, 41, -7, 57, -216, 581, -1260, 2381, -4259, 9043, 28552, -2451, 203, 373, -415, 279, -134, 41, -7, 57, -217, 581, -1260, 2379, -4254, 9025, 28560, -2441, 198, 376, -416, 280, -134, 41, -7, 57, -217, 581, -1259, 2378, -4249, 9007, 28565, -2431, 193, 379, -417, 281, -134, 41,
+ -7, 57, -217, 581, -1259, 2376, -4244, 8989, 28575, -2421, 188, 381, -419, 281, -134, 41, -7, 57, -217, 581, -1258, 2374, -4239, 8971, 28582, -2411, 183, 384, -420, 282, -135, 41, -7, 57, -217, 581, -1258, 2373, -4234, 8953, 28590, -2401, 177, 387, -422, 282, -135, 42, -7, 57, -217, 581, -1258, 2371, -4229, 8935, 28598, -2392, 172, 390, -423, 283, -135, 42,
+ -7, 57, -217, 581, -1257, 2369, -4224, 8917, 28605, -2382, 167, 392, -424, 284, -135, 42, -7, 57, -217, 581, -1257, 2368, -4220, 8899, 28614, -2372, 162, 395, -426, 284, -135, 42, -7, 58, -217, 581, -1256, 2366, -4215, 8881, 28620, -2362, 157, 398, -427, 285, -136, 42, -7, 58, -217, 581, -1256, 2364, -4210, 8863, 28629, -2352, 151, 401, -428, 285, -136, 42,
+ -7, 58, -217, 581, -1255, 2363, -4205, 8845, 28636, -2342, 146, 403, -430, 286, -136, 42, -7, 58, -217, 581, -1255, 2361, -4200, 8827, 28643, -2332, 141, 406, -431, 287, -136, 42, -7, 58, -217, 581, -1254, 2359, -4195, 8809, 28650, -2322, 136, 409, -432, 287, -136, 42, -7, 58, -217, 581, -1254, 2358, -4190, 8792, 28657, -2312, 131, 412, -434, 288, -137, 42,
+ -7, 58, -217, 581, -1253, 2356, -4185, 8774, 28665, -2302, 125, 415, -435, 288, -137, 42, -7, 58, -217, 581, -1253, 2354, -4180, 8756, 28674, -2292, 120, 417, -437, 289, -137, 42, -7, 58, -217, 581, -1252, 2352, -4175, 8738, 28681, -2282, 115, 420, -438, 289, -137, 42, -7, 58, -217, 581, -1252, 2351, -4170, 8720, 28687, -2272, 110, 423, -439, 290, -137, 42,
+ -7, 58, -218, 581, -1251, 2349, -4165, 8702, 28696, -2262, 105, 426, -441, 291, -138, 42, -7, 58, -218, 580, -1251, 2347, -4160, 8684, 28706, -2252, 99, 429, -442, 291, -138, 42, -7, 58, -218, 580, -1250, 2345, -4155, 8666, 28713, -2242, 94, 431, -443, 292, -138, 42, -7, 58, -218, 580, -1250, 2344, -4150, 8648, 28721, -2232, 89, 434, -445, 292, -138, 42,
+ -7, 58, -218, 580, -1249, 2342, -4145, 8630, 28727, -2222, 84, 437, -446, 293, -138, 42, -7, 58, -218, 580, -1249, 2340, -4140, 8612, 28735, -2211, 78, 440, -448, 294, -139, 43, -7, 58, -218, 580, -1248, 2338, -4135, 8594, 28743, -2201, 73, 442, -449, 294, -139, 43, -7, 58, -218, 580, -1248, 2337, -4130, 8576, 28749, -2191, 68, 445, -450, 295, -139, 43,
+ -7, 58, -218, 580, -1247, 2335, -4125, 8559, 28756, -2181, 63, 448, -452, 295, -139, 43, -7, 58, -218, 580, -1247, 2333, -4119, 8541, 28764, -2171, 57, 451, -453, 296, -140, 43, -7, 58, -218, 580, -1246, 2331, -4114, 8523, 28771, -2161, 52, 454, -454, 296, -140, 43, -7, 58, -218, 580, -1246, 2330, -4109, 8505, 28778, -2150, 47, 456, -456, 297, -140, 43,
+ -7, 58, -218, 580, -1245, 2328, -4104, 8487, 28785, -2140, 41, 459, -457, 298, -140, 43, -7, 58, -218, 580, -1245, 2326, -4099, 8469, 28793, -2130, 36, 462, -458, 298, -140, 43, -7, 58, -218, 580, -1244, 2324, -4094, 8451, 28801, -2120, 31, 465, -460, 299, -141, 43, -7, 58, -218, 580, -1244, 2323, -4089, 8434, 28806, -2109, 26, 468, -461, 299, -141, 43,
+ -7, 58, -218, 580, -1243, 2321, -4084, 8416, 28815, -2099, 20, 470, -463, 300, -141, 43, -7, 58, -218, 580, -1243, 2319, -4079, 8398, 28822, -2089, 15, 473, -464, 301, -141, 43, -7, 58, -218, 579, -1242, 2317, -4074, 8380, 28830, -2079, 10, 476, -465, 301, -141, 43, -7, 58, -218, 579, -1242, 2315, -4069, 8362, 28839, -2068, 4, 479, -467, 302, -142, 43,
+ -7, 58, -218, 579, -1241, 2314, -4064, 8344, 28845, -2058, -1, 482, -468, 302, -142, 43, -7, 59, -218, 579, -1241, 2312, -4058, 8327, 28849, -2047, -6, 484, -469, 303, -142, 43, -7, 59, -218, 579, -1240, 2310, -4053, 8309, 28858, -2037, -12, 487, -471, 303, -142, 43, -7, 59, -219, 579, -1240, 2308, -4048, 8291, 28865, -2027, -17, 490, -472, 304, -142, 44,
+ -7, 59, -219, 579, -1239, 2306, -4043, 8273, 28871, -2016, -22, 493, -473, 305, -143, 44, -7, 59, -219, 579, -1239, 2304, -4038, 8255, 28881, -2006, -28, 496, -475, 305, -143, 44, -7, 59, -219, 579, -1238, 2303, -4033, 8237, 28887, -1996, -33, 498, -476, 306, -143, 44, -7, 59, -219, 579, -1237, 2301, -4028, 8220, 28893, -1985, -38, 501, -478, 306, -143, 44,
+ -7, 59, -219, 579, -1237, 2299, -4023, 8202, 28900, -1975, -43, 504, -479, 307, -143, 44, -7, 59, -219, 579, -1236, 2297, -4017, 8184, 28907, -1964, -49, 507, -480, 307, -144, 44, -7, 59, -219, 579, -1236, 2295, -4012, 8166, 28915, -1954, -54, 510, -482, 308, -144, 44, -7, 59, -219, 578, -1235, 2293, -4007, 8149, 28922, -1943, -60, 512, -483, 309, -144, 44,
+ -7, 59, -219, 578, -1235, 2292, -4002, 8131, 28929, -1933, -65, 515, -484, 309, -144, 44, -7, 59, -219, 578, -1234, 2290, -3997, 8113, 28935, -1922, -70, 518, -486, 310, -144, 44, -8, 59, -219, 578, -1234, 2288, -3992, 8095, 28946, -1912, -76, 521, -487, 310, -145, 44, -8, 59, -219, 578, -1233, 2286, -3987, 8078, 28951, -1901, -81, 524, -489, 311, -145, 44,
+ -8, 59, -219, 578, -1232, 2284, -3981, 8060, 28957, -1891, -86, 526, -490, 312, -145, 44, -8, 59, -219, 578, -1232, 2282, -3976, 8042, 28965, -1880, -92, 529, -491, 312, -145, 44, -8, 59, -219, 578, -1231, 2280, -3971, 8024, 28971, -1869, -97, 532, -493, 313, -145, 44, -8, 59, -219, 578, -1231, 2279, -3966, 8007, 28978, -1859, -102, 535, -494, 313, -146, 44,
+ -8, 59, -219, 578, -1230, 2277, -3961, 7989, 28984, -1848, -108, 538, -495, 314, -146, 44, -8, 59, -219, 578, -1230, 2275, -3955, 7971, 28991, -1837, -113, 541, -497, 314, -146, 44, -8, 59, -219, 577, -1229, 2273, -3950, 7954, 28998, -1827, -119, 543, -498, 315, -146, 45, -8, 59, -219, 577, -1228, 2271, -3945, 7936, 29003, -1816, -124, 546, -499, 316, -146, 45,
+ -8, 59, -219, 577, -1228, 2269, -3940, 7918, 29012, -1805, -129, 549, -501, 316, -147, 45, -8, 59, -219, 577, -1227, 2267, -3935, 7900, 29019, -1795, -135, 552, -502, 317, -147, 45, -8, 59, -219, 577, -1227, 2265, -3929, 7883, 29025, -1784, -140, 555, -504, 317, -147, 45, -8, 59, -219, 577, -1226, 2263, -3924, 7865, 29032, -1773, -146, 557, -505, 318, -147, 45,
+ -8, 59, -219, 577, -1225, 2262, -3919, 7847, 29038, -1763, -151, 560, -506, 318, -147, 45, -8, 59, -219, 577, -1225, 2260, -3914, 7830, 29045, -1752, -156, 563, -508, 319, -148, 45, -8, 59, -219, 577, -1224, 2258, -3908, 7812, 29050, -1741, -162, 566, -509, 320, -148, 45, -8, 59, -219, 576, -1224, 2256, -3903, 7794, 29058, -1730, -167, 569, -510, 320, -148, 45,
+ -8, 59, -219, 576, -1223, 2254, -3898, 7777, 29065, -1720, -173, 572, -512, 321, -148, 45, -8, 59, -219, 576, -1222, 2252, -3893, 7759, 29072, -1709, -178, 574, -513, 321, -148, 45, -8, 59, -219, 576, -1222, 2250, -3887, 7742, 29077, -1698, -183, 577, -514, 322, -149, 45, -8, 59, -219, 576, -1221, 2248, -3882, 7724, 29085, -1687, -189, 580, -516, 322, -149, 45,
+ -8, 59, -219, 576, -1221, 2246, -3877, 7706, 29091, -1676, -194, 583, -517, 323, -149, 45, -8, 59, -219, 576, -1220, 2244, -3872, 7689, 29097, -1665, -200, 586, -519, 324, -149, 45, -8, 59, -219, 576, -1219, 2242, -3866, 7671, 29104, -1655, -205, 588, -520, 324, -149, 45, -8, 60, -220, 576, -1219, 2240, -3861, 7653, 29112, -1644, -211, 591, -521, 325, -150, 45,
+ -8, 60, -220, 575, -1218, 2238, -3856, 7636, 29119, -1633, -216, 594, -523, 325, -150, 45, -8, 60, -220, 575, -1217, 2237, -3850, 7618, 29121, -1622, -221, 597, -524, 326, -150, 46, -8, 60, -220, 575, -1217, 2235, -3845, 7601, 29128, -1611, -227, 600, -525, 326, -150, 46, -8, 60, -220, 575, -1216, 2233, -3840, 7583, 29134, -1600, -232, 603, -527, 327, -150, 46,
+ -8, 60, -220, 575, -1216, 2231, -3835, 7566, 29142, -1589, -238, 605, -528, 328, -151, 46, -8, 60, -220, 575, -1215, 2229, -3829, 7548, 29147, -1578, -243, 608, -529, 328, -151, 46, -8, 60, -220, 575, -1214, 2227, -3824, 7530, 29154, -1567, -249, 611, -531, 329, -151, 46, -8, 60, -220, 575, -1214, 2225, -3819, 7513, 29160, -1556, -254, 614, -532, 329, -151, 46,
+ -8, 60, -220, 574, -1213, 2223, -3813, 7495, 29167, -1545, -260, 617, -534, 330, -151, 46, -8, 60, -220, 574, -1212, 2221, -3808, 7478, 29173, -1534, -265, 620, -535, 330, -152, 46, -8, 60, -220, 574, -1212, 2219, -3803, 7460, 29181, -1523, -271, 622, -536, 331, -152, 46, -8, 60, -220, 574, -1211, 2217, -3797, 7443, 29185, -1512, -276, 625, -538, 332, -152, 46,
+ -8, 60, -220, 574, -1210, 2215, -3792, 7425, 29192, -1501, -282, 628, -539, 332, -152, 46, -8, 60, -220, 574, -1210, 2213, -3787, 7408, 29197, -1490, -287, 631, -540, 333, -152, 46, -8, 60, -220, 574, -1209, 2211, -3781, 7390, 29204, -1479, -293, 634, -542, 333, -152, 46, -8, 60, -220, 574, -1208, 2209, -3776, 7373, 29209, -1468, -298, 637, -543, 334, -153, 46,
+ -8, 60, -220, 573, -1208, 2207, -3771, 7355, 29219, -1457, -304, 639, -544, 334, -153, 46, -8, 60, -220, 573, -1207, 2205, -3765, 7338, 29222, -1445, -309, 642, -546, 335, -153, 46, -8, 60, -220, 573, -1207, 2203, -3760, 7320, 29228, -1434, -314, 645, -547, 336, -153, 46, -8, 60, -220, 573, -1206, 2201, -3755, 7303, 29235, -1423, -320, 648, -549, 336, -153, 46,
+ -8, 60, -220, 573, -1205, 2199, -3749, 7285, 29240, -1412, -325, 651, -550, 337, -154, 46, -8, 60, -220, 573, -1205, 2197, -3744, 7268, 29246, -1401, -331, 654, -551, 337, -154, 47, -8, 60, -220, 573, -1204, 2195, -3738, 7250, 29253, -1390, -337, 656, -553, 338, -154, 47, -8, 60, -220, 572, -1203, 2193, -3733, 7233, 29258, -1378, -342, 659, -554, 338, -154, 47,
+ -8, 60, -220, 572, -1203, 2191, -3728, 7215, 29265, -1367, -348, 662, -555, 339, -154, 47, -8, 60, -220, 572, -1202, 2189, -3722, 7198, 29270, -1356, -353, 665, -557, 340, -155, 47, -8, 60, -220, 572, -1201, 2187, -3717, 7180, 29277, -1345, -359, 668, -558, 340, -155, 47, -8, 60, -220, 572, -1200, 2185, -3712, 7163, 29280, -1333, -364, 671, -559, 341, -155, 47,
+ -8, 60, -220, 572, -1200, 2183, -3706, 7146, 29287, -1322, -370, 674, -561, 341, -155, 47, -8, 60, -220, 571, -1199, 2181, -3701, 7128, 29294, -1311, -375, 676, -562, 342, -155, 47, -8, 60, -220, 571, -1198, 2178, -3695, 7111, 29300, -1299, -381, 679, -563, 342, -156, 47, -8, 60, -220, 571, -1198, 2176, -3690, 7093, 29307, -1288, -386, 682, -565, 343, -156, 47,
+ -8, 60, -220, 571, -1197, 2174, -3685, 7076, 29312, -1277, -392, 685, -566, 344, -156, 47, -8, 60, -220, 571, -1196, 2172, -3679, 7059, 29316, -1265, -397, 688, -568, 344, -156, 47, -8, 60, -220, 571, -1196, 2170, -3674, 7041, 29323, -1254, -403, 691, -569, 345, -156, 47, -8, 60, -220, 571, -1195, 2168, -3668, 7024, 29329, -1243, -408, 693, -570, 345, -157, 47,
+ -8, 60, -220, 570, -1194, 2166, -3663, 7006, 29336, -1231, -414, 696, -572, 346, -157, 47, -8, 60, -220, 570, -1194, 2164, -3657, 6989, 29342, -1220, -420, 699, -573, 346, -157, 47, -8, 60, -220, 570, -1193, 2162, -3652, 6972, 29345, -1208, -425, 702, -574, 347, -157, 47, -8, 60, -220, 570, -1192, 2160, -3647, 6954, 29353, -1197, -431, 705, -576, 347, -157, 47,
+ -8, 60, -220, 570, -1191, 2158, -3641, 6937, 29357, -1186, -436, 708, -577, 348, -158, 47, -8, 60, -220, 570, -1191, 2156, -3636, 6920, 29362, -1174, -442, 710, -578, 349, -158, 48, -8, 60, -220, 569, -1190, 2154, -3630, 6902, 29369, -1163, -447, 713, -580, 349, -158, 48, -8, 60, -220, 569, -1189, 2152, -3625, 6885, 29373, -1151, -453, 716, -581, 350, -158, 48,
+ -8, 60, -220, 569, -1189, 2150, -3619, 6868, 29378, -1140, -458, 719, -582, 350, -158, 48, -8, 60, -220, 569, -1188, 2147, -3614, 6850, 29385, -1128, -464, 722, -584, 351, -158, 48, -8, 60, -220, 569, -1187, 2145, -3608, 6833, 29391, -1117, -470, 725, -585, 351, -159, 48, -8, 60, -220, 569, -1186, 2143, -3603, 6816, 29394, -1105, -475, 728, -586, 352, -159, 48,
+ -8, 60, -220, 568, -1186, 2141, -3597, 6798, 29402, -1093, -481, 730, -588, 353, -159, 48, -8, 60, -220, 568, -1185, 2139, -3592, 6781, 29407, -1082, -486, 733, -589, 353, -159, 48, -8, 60, -220, 568, -1184, 2137, -3587, 6764, 29412, -1070, -492, 736, -591, 354, -159, 48, -8, 60, -220, 568, -1184, 2135, -3581, 6747, 29419, -1059, -498, 739, -592, 354, -160, 48,
+ -8, 60, -220, 568, -1183, 2133, -3576, 6729, 29423, -1047, -503, 742, -593, 355, -160, 48, -8, 60, -220, 567, -1182, 2131, -3570, 6712, 29430, -1036, -509, 745, -595, 355, -160, 48, -8, 60, -220, 567, -1181, 2128, -3565, 6695, 29434, -1024, -514, 748, -596, 356, -160, 48, -8, 60, -220, 567, -1181, 2126, -3559, 6678, 29440, -1012, -520, 750, -597, 356, -160, 48,
+ -8, 60, -220, 567, -1180, 2124, -3554, 6660, 29448, -1001, -526, 753, -599, 357, -161, 48, -8, 60, -220, 567, -1179, 2122, -3548, 6643, 29450, -989, -531, 756, -600, 358, -161, 48, -8, 60, -220, 567, -1178, 2120, -3543, 6626, 29455, -977, -537, 759, -601, 358, -161, 48, -8, 61, -220, 566, -1178, 2118, -3537, 6609, 29459, -965, -542, 762, -603, 359, -161, 48,
+ -8, 61, -220, 566, -1177, 2116, -3532, 6592, 29465, -954, -548, 765, -604, 359, -161, 48, -8, 61, -220, 566, -1176, 2113, -3526, 6574, 29471, -942, -554, 767, -605, 360, -162, 49, -8, 61, -220, 566, -1175, 2111, -3521, 6557, 29476, -930, -559, 770, -607, 360, -162, 49, -8, 61, -220, 566, -1175, 2109, -3515, 6540, 29481, -919, -565, 773, -608, 361, -162, 49,
+ -8, 61, -220, 565, -1174, 2107, -3509, 6523, 29486, -907, -571, 776, -609, 361, -162, 49, -8, 61, -220, 565, -1173, 2105, -3504, 6506, 29490, -895, -576, 779, -611, 362, -162, 49, -8, 61, -220, 565, -1172, 2103, -3498, 6488, 29494, -883, -582, 782, -612, 363, -162, 49, -8, 61, -220, 565, -1172, 2101, -3493, 6471, 29500, -871, -587, 785, -613, 363, -163, 49,
+ -8, 61, -220, 565, -1171, 2098, -3487, 6454, 29507, -860, -593, 787, -615, 364, -163, 49, -8, 61, -220, 564, -1170, 2096, -3482, 6437, 29513, -848, -599, 790, -616, 364, -163, 49, -8, 61, -219, 564, -1169, 2094, -3476, 6420, 29515, -836, -604, 793, -618, 365, -163, 49, -8, 61, -219, 564, -1169, 2092, -3471, 6403, 29521, -824, -610, 796, -619, 365, -163, 49,
+ -8, 61, -219, 564, -1168, 2090, -3465, 6386, 29525, -812, -616, 799, -620, 366, -164, 49, -8, 61, -219, 564, -1167, 2088, -3460, 6369, 29530, -800, -621, 802, -622, 366, -164, 49, -8, 61, -219, 563, -1166, 2085, -3454, 6351, 29536, -788, -627, 805, -623, 367, -164, 49, -8, 61, -219, 563, -1166, 2083, -3448, 6334, 29541, -776, -633, 807, -624, 368, -164, 49,
+ -8, 61, -219, 563, -1165, 2081, -3443, 6317, 29546, -764, -638, 810, -626, 368, -164, 49, -8, 61, -219, 563, -1164, 2079, -3437, 6300, 29550, -753, -644, 813, -627, 369, -164, 49, -8, 61, -219, 563, -1163, 2077, -3432, 6283, 29556, -741, -650, 816, -628, 369, -165, 49, -8, 61, -219, 562, -1162, 2074, -3426, 6266, 29561, -729, -655, 819, -630, 370, -165, 49,
+ -8, 61, -219, 562, -1162, 2072, -3421, 6249, 29567, -717, -661, 822, -631, 370, -165, 49, -8, 61, -219, 562, -1161, 2070, -3415, 6232, 29570, -705, -667, 825, -632, 371, -165, 49, -8, 61, -219, 562, -1160, 2068, -3409, 6215, 29574, -693, -672, 827, -634, 371, -165, 50, -8, 61, -219, 562, -1159, 2066, -3404, 6198, 29579, -681, -678, 830, -635, 372, -166, 50,
+ -8, 61, -219, 561, -1158, 2063, -3398, 6181, 29585, -669, -684, 833, -636, 372, -166, 50, -8, 61, -219, 561, -1158, 2061, -3393, 6164, 29589, -656, -689, 836, -638, 373, -166, 50, -8, 61, -219, 561, -1157, 2059, -3387, 6147, 29592, -644, -695, 839, -639, 374, -166, 50, -8, 61, -219, 561, -1156, 2057, -3382, 6130, 29597, -632, -701, 842, -640, 374, -166, 50,
+ -8, 61, -219, 561, -1155, 2054, -3376, 6113, 29602, -620, -706, 845, -642, 375, -167, 50, -8, 61, -219, 560, -1154, 2052, -3370, 6096, 29608, -608, -712, 847, -643, 375, -167, 50, -8, 61, -219, 560, -1154, 2050, -3365, 6079, 29613, -596, -718, 850, -644, 376, -167, 50, -8, 61, -219, 560, -1153, 2048, -3359, 6062, 29618, -584, -724, 853, -646, 376, -167, 50,
+ -8, 61, -219, 560, -1152, 2046, -3353, 6045, 29620, -572, -729, 856, -647, 377, -167, 50, -8, 61, -219, 559, -1151, 2043, -3348, 6028, 29627, -560, -735, 859, -648, 377, -167, 50, -8, 61, -219, 559, -1150, 2041, -3342, 6011, 29631, -547, -741, 862, -650, 378, -168, 50, -8, 61, -219, 559, -1150, 2039, -3337, 5994, 29636, -535, -746, 865, -651, 378, -168, 50,
+ -8, 61, -219, 559, -1149, 2037, -3331, 5977, 29640, -523, -752, 867, -652, 379, -168, 50, -8, 61, -219, 559, -1148, 2034, -3325, 5960, 29645, -511, -758, 870, -654, 380, -168, 50, -8, 61, -219, 558, -1147, 2032, -3320, 5943, 29650, -499, -763, 873, -655, 380, -168, 50, -8, 61, -219, 558, -1146, 2030, -3314, 5926, 29653, -486, -769, 876, -656, 381, -169, 50,
+ -8, 61, -219, 558, -1145, 2028, -3308, 5909, 29658, -474, -775, 879, -658, 381, -169, 50, -8, 61, -219, 558, -1145, 2025, -3303, 5892, 29664, -462, -781, 882, -659, 382, -169, 50, -8, 61, -219, 557, -1144, 2023, -3297, 5875, 29668, -450, -786, 885, -660, 382, -169, 50, -8, 61, -219, 557, -1143, 2021, -3292, 5859, 29671, -437, -792, 887, -662, 383, -169, 51,
+ -8, 61, -219, 557, -1142, 2018, -3286, 5842, 29676, -425, -798, 890, -663, 383, -169, 51, -8, 61, -219, 557, -1141, 2016, -3280, 5825, 29680, -413, -804, 893, -664, 384, -170, 51, -8, 61, -219, 556, -1141, 2014, -3275, 5808, 29686, -400, -809, 896, -666, 384, -170, 51, -8, 61, -218, 556, -1140, 2012, -3269, 5791, 29688, -388, -815, 899, -667, 385, -170, 51,
+ -8, 61, -218, 556, -1139, 2009, -3263, 5774, 29693, -376, -821, 902, -668, 385, -170, 51, -8, 61, -218, 556, -1138, 2007, -3258, 5757, 29696, -363, -826, 905, -670, 386, -170, 51, -8, 61, -218, 556, -1137, 2005, -3252, 5741, 29699, -351, -832, 907, -671, 387, -170, 51, -8, 61, -218, 555, -1136, 2002, -3246, 5724, 29705, -338, -838, 910, -672, 387, -171, 51,
+ -8, 61, -218, 555, -1135, 2000, -3241, 5707, 29710, -326, -844, 913, -674, 388, -171, 51, -8, 61, -218, 555, -1135, 1998, -3235, 5690, 29714, -314, -849, 916, -675, 388, -171, 51, -8, 61, -218, 555, -1134, 1996, -3229, 5673, 29716, -301, -855, 919, -676, 389, -171, 51, -8, 61, -218, 554, -1133, 1993, -3224, 5657, 29723, -289, -861, 922, -678, 389, -171, 51,
+ -8, 61, -218, 554, -1132, 1991, -3218, 5640, 29727, -276, -867, 924, -679, 390, -172, 51, -8, 61, -218, 554, -1131, 1989, -3212, 5623, 29730, -264, -872, 927, -680, 390, -172, 51, -8, 61, -218, 554, -1130, 1986, -3206, 5606, 29734, -251, -878, 930, -682, 391, -172, 51, -8, 61, -218, 553, -1129, 1984, -3201, 5589, 29740, -239, -884, 933, -683, 391, -172, 51,
+ -8, 61, -218, 553, -1129, 1982, -3195, 5573, 29742, -226, -890, 936, -684, 392, -172, 51, -8, 61, -218, 553, -1128, 1979, -3189, 5556, 29747, -214, -895, 939, -686, 392, -172, 51, -8, 61, -218, 553, -1127, 1977, -3184, 5539, 29751, -201, -901, 942, -687, 393, -173, 51, -8, 61, -218, 552, -1126, 1975, -3178, 5523, 29755, -189, -907, 944, -688, 394, -173, 51,
+ -8, 61, -218, 552, -1125, 1972, -3172, 5506, 29760, -176, -913, 947, -690, 394, -173, 51, -8, 61, -218, 552, -1124, 1970, -3167, 5489, 29764, -164, -919, 950, -691, 395, -173, 51, -8, 61, -218, 552, -1123, 1968, -3161, 5472, 29765, -151, -924, 953, -692, 395, -173, 52, -8, 61, -218, 551, -1123, 1966, -3155, 5456, 29768, -138, -930, 956, -693, 396, -173, 52,
+ -8, 61, -218, 551, -1122, 1963, -3149, 5439, 29775, -126, -936, 959, -695, 396, -174, 52, -8, 61, -218, 551, -1121, 1961, -3144, 5422, 29778, -113, -942, 962, -696, 397, -174, 52, -8, 61, -218, 551, -1120, 1958, -3138, 5406, 29781, -100, -947, 964, -697, 397, -174, 52, -8, 61, -218, 550, -1119, 1956, -3132, 5389, 29786, -88, -953, 967, -699, 398, -174, 52,
+ -8, 61, -217, 550, -1118, 1954, -3127, 5372, 29789, -75, -959, 970, -700, 398, -174, 52, -8, 61, -217, 550, -1117, 1951, -3121, 5356, 29792, -62, -965, 973, -701, 399, -175, 52, -8, 61, -217, 549, -1116, 1949, -3115, 5339, 29798, -50, -971, 976, -703, 399, -175, 52, -8, 61, -217, 549, -1116, 1947, -3109, 5322, 29800, -37, -976, 979, -704, 400, -175, 52,
+ -8, 61, -217, 549, -1115, 1944, -3104, 5306, 29804, -24, -982, 982, -705, 400, -175, 52, -8, 61, -217, 549, -1114, 1942, -3098, 5289, 29809, -12, -988, 984, -707, 401, -175, 52, -8, 61, -217, 548, -1113, 1940, -3092, 5273, 29812, 1, -994, 987, -708, 401, -175, 52, -8, 61, -217, 548, -1112, 1937, -3086, 5256, 29816, 14, -1000, 990, -709, 402, -176, 52,
+ -8, 61, -217, 548, -1111, 1935, -3081, 5239, 29820, 27, -1005, 993, -711, 402, -176, 52, -8, 61, -217, 548, -1110, 1933, -3075, 5223, 29822, 39, -1011, 996, -712, 403, -176, 52, -8, 61, -217, 547, -1109, 1930, -3069, 5206, 29826, 52, -1017, 999, -713, 404, -176, 52, -8, 61, -217, 547, -1108, 1928, -3063, 5190, 29828, 65, -1023, 1002, -714, 404, -176, 52,
+ -8, 61, -217, 547, -1107, 1925, -3058, 5173, 29834, 78, -1029, 1004, -716, 405, -176, 52, -8, 61, -217, 546, -1107, 1923, -3052, 5157, 29838, 91, -1034, 1007, -717, 405, -177, 52, -8, 61, -217, 546, -1106, 1921, -3046, 5140, 29840, 104, -1040, 1010, -718, 406, -177, 52, -8, 61, -217, 546, -1105, 1918, -3040, 5124, 29845, 116, -1046, 1013, -720, 406, -177, 52,
+ -8, 61, -217, 546, -1104, 1916, -3035, 5107, 29848, 129, -1052, 1016, -721, 407, -177, 52, -8, 61, -217, 545, -1103, 1914, -3029, 5091, 29850, 142, -1058, 1019, -722, 407, -177, 53, -8, 61, -217, 545, -1102, 1911, -3023, 5074, 29854, 155, -1063, 1021, -724, 408, -177, 53, -8, 61, -216, 545, -1101, 1909, -3017, 5058, 29856, 168, -1069, 1024, -725, 408, -178, 53,
+ -8, 61, -216, 545, -1100, 1906, -3012, 5041, 29860, 181, -1075, 1027, -726, 409, -178, 53, -8, 61, -216, 544, -1099, 1904, -3006, 5025, 29864, 194, -1081, 1030, -728, 409, -178, 53, -8, 61, -216, 544, -1098, 1902, -3000, 5008, 29866, 207, -1087, 1033, -729, 410, -178, 53, -8, 61, -216, 544, -1097, 1899, -2994, 4992, 29869, 220, -1093, 1036, -730, 410, -178, 53,
+ -8, 61, -216, 543, -1096, 1897, -2989, 4975, 29872, 233, -1098, 1039, -731, 411, -178, 53, -8, 61, -216, 543, -1096, 1894, -2983, 4959, 29879, 246, -1104, 1041, -733, 411, -179, 53, -8, 61, -216, 543, -1095, 1892, -2977, 4942, 29881, 259, -1110, 1044, -734, 412, -179, 53, -8, 61, -216, 543, -1094, 1890, -2971, 4926, 29883, 272, -1116, 1047, -735, 412, -179, 53,
+ -8, 61, -216, 542, -1093, 1887, -2965, 4909, 29888, 285, -1122, 1050, -737, 413, -179, 53, -8, 61, -216, 542, -1092, 1885, -2960, 4893, 29891, 298, -1128, 1053, -738, 413, -179, 53, -8, 61, -216, 542, -1091, 1882, -2954, 4877, 29892, 311, -1133, 1056, -739, 414, -179, 53, -8, 61, -216, 541, -1090, 1880, -2948, 4860, 29899, 324, -1139, 1058, -741, 414, -180, 53,
+ -8, 61, -216, 541, -1089, 1877, -2942, 4844, 29901, 337, -1145, 1061, -742, 415, -180, 53, -8, 61, -216, 541, -1088, 1875, -2936, 4828, 29903, 350, -1151, 1064, -743, 415, -180, 53, -8, 61, -216, 540, -1087, 1873, -2931, 4811, 29907, 363, -1157, 1067, -744, 416, -180, 53, -8, 61, -216, 540, -1086, 1870, -2925, 4795, 29911, 376, -1163, 1070, -746, 416, -180, 53,
+ -8, 61, -215, 540, -1085, 1868, -2919, 4778, 29911, 389, -1168, 1073, -747, 417, -180, 53, -8, 61, -215, 540, -1084, 1865, -2913, 4762, 29913, 403, -1174, 1076, -748, 418, -181, 53, -8, 61, -215, 539, -1083, 1863, -2907, 4746, 29918, 416, -1180, 1078, -750, 418, -181, 53, -8, 61, -215, 539, -1082, 1860, -2902, 4729, 29922, 429, -1186, 1081, -751, 419, -181, 53,
+ -8, 61, -215, 539, -1081, 1858, -2896, 4713, 29924, 442, -1192, 1084, -752, 419, -181, 53, -8, 61, -215, 538, -1081, 1856, -2890, 4697, 29926, 455, -1198, 1087, -753, 420, -181, 54, -8, 61, -215, 538, -1080, 1853, -2884, 4681, 29930, 468, -1204, 1090, -755, 420, -181, 54, -8, 61, -215, 538, -1079, 1851, -2878, 4664, 29931, 482, -1209, 1093, -756, 421, -182, 54,
+ -8, 61, -215, 537, -1078, 1848, -2873, 4648, 29937, 495, -1215, 1095, -757, 421, -182, 54, -8, 61, -215, 537, -1077, 1846, -2867, 4632, 29939, 508, -1221, 1098, -759, 422, -182, 54, -8, 61, -215, 537, -1076, 1843, -2861, 4615, 29943, 521, -1227, 1101, -760, 422, -182, 54, -8, 61, -215, 537, -1075, 1841, -2855, 4599, 29943, 535, -1233, 1104, -761, 423, -182, 54,
+ -8, 61, -215, 536, -1074, 1838, -2849, 4583, 29947, 548, -1239, 1107, -762, 423, -182, 54, -8, 61, -215, 536, -1073, 1836, -2843, 4567, 29950, 561, -1245, 1110, -764, 424, -183, 54, -8, 61, -215, 536, -1072, 1833, -2838, 4551, 29955, 574, -1251, 1112, -765, 424, -183, 54, -8, 61, -214, 535, -1071, 1831, -2832, 4534, 29955, 588, -1256, 1115, -766, 425, -183, 54,
+ -8, 61, -214, 535, -1070, 1828, -2826, 4518, 29959, 601, -1262, 1118, -768, 425, -183, 54, -8, 61, -214, 535, -1069, 1826, -2820, 4502, 29960, 614, -1268, 1121, -769, 426, -183, 54, -8, 61, -214, 534, -1068, 1824, -2814, 4486, 29962, 628, -1274, 1124, -770, 426, -183, 54, -8, 61, -214, 534, -1067, 1821, -2808, 4470, 29965, 641, -1280, 1127, -771, 427, -184, 54,
+ -8, 61, -214, 534, -1066, 1819, -2803, 4453, 29971, 654, -1286, 1129, -773, 427, -184, 54, -8, 61, -214, 533, -1065, 1816, -2797, 4437, 29973, 668, -1292, 1132, -774, 428, -184, 54, -8, 61, -214, 533, -1064, 1814, -2791, 4421, 29975, 681, -1298, 1135, -775, 428, -184, 54, -8, 61, -214, 533, -1063, 1811, -2785, 4405, 29976, 695, -1303, 1138, -777, 429, -184, 54,
+ -8, 61, -214, 532, -1062, 1809, -2779, 4389, 29979, 708, -1309, 1141, -778, 429, -184, 54, -8, 61, -214, 532, -1061, 1806, -2773, 4373, 29980, 722, -1315, 1144, -779, 430, -184, 54, -8, 61, -214, 532, -1060, 1804, -2767, 4357, 29984, 735, -1321, 1146, -780, 430, -185, 54, -8, 61, -214, 532, -1059, 1801, -2762, 4341, 29988, 748, -1327, 1149, -782, 431, -185, 54,
+ -8, 61, -214, 531, -1058, 1799, -2756, 4324, 29991, 762, -1333, 1152, -783, 431, -185, 54, -8, 61, -213, 531, -1057, 1796, -2750, 4308, 29992, 775, -1339, 1155, -784, 432, -185, 54, -8, 61, -213, 531, -1056, 1794, -2744, 4292, 29992, 789, -1345, 1158, -785, 432, -185, 55, -8, 61, -213, 530, -1055, 1791, -2738, 4276, 29995, 802, -1350, 1161, -787, 433, -185, 55,
+ -8, 61, -213, 530, -1054, 1789, -2732, 4260, 29998, 816, -1356, 1163, -788, 433, -186, 55, -8, 60, -213, 530, -1053, 1786, -2726, 4244, 30001, 829, -1362, 1166, -789, 434, -186, 55, -8, 60, -213, 529, -1052, 1784, -2721, 4228, 30005, 843, -1368, 1169, -791, 434, -186, 55, -8, 60, -213, 529, -1051, 1781, -2715, 4212, 30006, 857, -1374, 1172, -792, 435, -186, 55,
+ -8, 60, -213, 529, -1050, 1779, -2709, 4196, 30008, 870, -1380, 1175, -793, 435, -186, 55, -8, 60, -213, 528, -1049, 1776, -2703, 4180, 30011, 884, -1386, 1177, -794, 436, -186, 55, -8, 60, -213, 528, -1048, 1774, -2697, 4164, 30014, 897, -1392, 1180, -796, 436, -186, 55, -8, 60, -213, 528, -1047, 1771, -2691, 4148, 30016, 911, -1398, 1183, -797, 437, -187, 55,
+ -8, 60, -213, 527, -1046, 1769, -2685, 4132, 30018, 925, -1404, 1186, -798, 437, -187, 55, -8, 60, -213, 527, -1045, 1766, -2680, 4116, 30020, 938, -1409, 1189, -799, 438, -187, 55, -8, 60, -212, 527, -1044, 1763, -2674, 4100, 30022, 952, -1415, 1192, -801, 438, -187, 55, -8, 60, -212, 526, -1043, 1761, -2668, 4084, 30025, 966, -1421, 1194, -802, 438, -187, 55,
+ -8, 60, -212, 526, -1042, 1758, -2662, 4068, 30027, 979, -1427, 1197, -803, 439, -187, 55, -8, 60, -212, 526, -1041, 1756, -2656, 4052, 30029, 993, -1433, 1200, -804, 439, -188, 55, -8, 60, -212, 525, -1040, 1753, -2650, 4036, 30032, 1007, -1439, 1203, -806, 440, -188, 55, -8, 60, -212, 525, -1039, 1751, -2644, 4020, 30034, 1020, -1445, 1206, -807, 440, -188, 55,
+ -8, 60, -212, 525, -1038, 1748, -2638, 4005, 30035, 1034, -1451, 1208, -808, 441, -188, 55, -8, 60, -212, 524, -1037, 1746, -2633, 3989, 30038, 1048, -1457, 1211, -809, 441, -188, 55, -8, 60, -212, 524, -1036, 1743, -2627, 3973, 30041, 1061, -1463, 1214, -811, 442, -188, 55, -7, 60, -212, 524, -1035, 1741, -2621, 3957, 30041, 1075, -1469, 1217, -812, 442, -188, 55,
+ -7, 60, -212, 523, -1034, 1738, -2615, 3941, 30043, 1089, -1474, 1220, -813, 443, -189, 55, -7, 60, -212, 523, -1033, 1736, -2609, 3925, 30044, 1103, -1480, 1223, -814, 443, -189, 55, -7, 60, -211, 523, -1032, 1733, -2603, 3909, 30046, 1117, -1486, 1225, -816, 444, -189, 55, -7, 60, -211, 522, -1031, 1730, -2597, 3893, 30050, 1130, -1492, 1228, -817, 444, -189, 55,
+ -7, 60, -211, 522, -1030, 1728, -2591, 3878, 30049, 1144, -1498, 1231, -818, 445, -189, 55, -7, 60, -211, 521, -1029, 1725, -2585, 3862, 30051, 1158, -1504, 1234, -819, 445, -189, 56, -7, 60, -211, 521, -1028, 1723, -2579, 3846, 30053, 1172, -1510, 1237, -821, 446, -190, 56, -7, 60, -211, 521, -1027, 1720, -2574, 3830, 30057, 1186, -1516, 1239, -822, 446, -190, 56,
+ -7, 60, -211, 520, -1026, 1718, -2568, 3814, 30058, 1200, -1522, 1242, -823, 447, -190, 56, -7, 60, -211, 520, -1025, 1715, -2562, 3799, 30060, 1213, -1528, 1245, -824, 447, -190, 56, -7, 60, -211, 520, -1024, 1713, -2556, 3783, 30061, 1227, -1534, 1248, -826, 448, -190, 56, -7, 60, -211, 519, -1023, 1710, -2550, 3767, 30064, 1241, -1540, 1251, -827, 448, -190, 56,
+ -7, 60, -211, 519, -1022, 1707, -2544, 3751, 30066, 1255, -1546, 1253, -828, 449, -190, 56, -7, 60, -210, 519, -1020, 1705, -2538, 3736, 30064, 1269, -1551, 1256, -829, 449, -191, 56, -7, 60, -210, 518, -1019, 1702, -2532, 3720, 30067, 1283, -1557, 1259, -831, 450, -191, 56, -7, 60, -210, 518, -1018, 1700, -2526, 3704, 30068, 1297, -1563, 1262, -832, 450, -191, 56,
+ -7, 60, -210, 518, -1017, 1697, -2520, 3688, 30069, 1311, -1569, 1265, -833, 451, -191, 56, -7, 60, -210, 517, -1016, 1695, -2515, 3673, 30072, 1325, -1575, 1267, -834, 451, -191, 56, -7, 60, -210, 517, -1015, 1692, -2509, 3657, 30075, 1339, -1581, 1270, -836, 451, -191, 56, -7, 60, -210, 517, -1014, 1689, -2503, 3641, 30076, 1353, -1587, 1273, -837, 452, -191, 56,
+ -7, 60, -210, 516, -1013, 1687, -2497, 3626, 30078, 1367, -1593, 1276, -838, 452, -192, 56, -7, 60, -210, 516, -1012, 1684, -2491, 3610, 30079, 1381, -1599, 1279, -839, 453, -192, 56, -7, 60, -210, 515, -1011, 1682, -2485, 3594, 30083, 1395, -1605, 1281, -841, 453, -192, 56, -7, 60, -210, 515, -1010, 1679, -2479, 3579, 30083, 1409, -1611, 1284, -842, 454, -192, 56,
+ -7, 60, -209, 515, -1009, 1676, -2473, 3563, 30084, 1423, -1617, 1287, -843, 454, -192, 56, -7, 60, -209, 514, -1008, 1674, -2467, 3548, 30084, 1437, -1623, 1290, -844, 455, -192, 56, -7, 60, -209, 514, -1007, 1671, -2461, 3532, 30086, 1451, -1629, 1293, -845, 455, -192, 56, -7, 60, -209, 514, -1006, 1669, -2455, 3516, 30089, 1465, -1635, 1295, -847, 456, -193, 56,
+ -7, 60, -209, 513, -1005, 1666, -2449, 3501, 30090, 1479, -1640, 1298, -848, 456, -193, 56, -7, 60, -209, 513, -1004, 1663, -2444, 3485, 30092, 1493, -1646, 1301, -849, 457, -193, 56, -7, 60, -209, 512, -1003, 1661, -2438, 3470, 30093, 1507, -1652, 1304, -850, 457, -193, 56, -7, 60, -209, 512, -1001, 1658, -2432, 3454, 30093, 1522, -1658, 1307, -852, 458, -193, 56,
+ -7, 60, -209, 512, -1000, 1656, -2426, 3438, 30095, 1536, -1664, 1309, -853, 458, -193, 56, -7, 60, -209, 511, -999, 1653, -2420, 3423, 30097, 1550, -1670, 1312, -854, 458, -193, 56, -7, 60, -209, 511, -998, 1650, -2414, 3407, 30098, 1564, -1676, 1315, -855, 459, -194, 57, -7, 60, -208, 511, -997, 1648, -2408, 3392, 30098, 1578, -1682, 1318, -857, 459, -194, 57,
+ -7, 60, -208, 510, -996, 1645, -2402, 3376, 30101, 1592, -1688, 1320, -858, 460, -194, 57, -7, 60, -208, 510, -995, 1643, -2396, 3361, 30100, 1607, -1694, 1323, -859, 460, -194, 57, -7, 60, -208, 510, -994, 1640, -2390, 3345, 30101, 1621, -1700, 1326, -860, 461, -194, 57, -7, 60, -208, 509, -993, 1637, -2384, 3330, 30103, 1635, -1706, 1329, -861, 461, -194, 57,
+ -7, 60, -208, 509, -992, 1635, -2378, 3314, 30104, 1649, -1712, 1332, -863, 462, -194, 57, -7, 60, -208, 508, -991, 1632, -2372, 3299, 30107, 1664, -1718, 1334, -864, 462, -195, 57, -7, 60, -208, 508, -990, 1629, -2366, 3283, 30108, 1678, -1724, 1337, -865, 463, -195, 57, -7, 60, -208, 508, -988, 1627, -2361, 3268, 30108, 1692, -1730, 1340, -866, 463, -195, 57,
+ -7, 60, -208, 507, -987, 1624, -2355, 3253, 30109, 1706, -1736, 1343, -867, 464, -195, 57, -7, 60, -207, 507, -986, 1622, -2349, 3237, 30109, 1721, -1741, 1345, -869, 464, -195, 57, -7, 59, -207, 506, -985, 1619, -2343, 3222, 30112, 1735, -1747, 1348, -870, 464, -195, 57, -7, 59, -207, 506, -984, 1616, -2337, 3206, 30113, 1749, -1753, 1351, -871, 465, -195, 57,
+ -7, 59, -207, 506, -983, 1614, -2331, 3191, 30113, 1764, -1759, 1354, -872, 465, -196, 57, -7, 59, -207, 505, -982, 1611, -2325, 3176, 30116, 1778, -1765, 1356, -874, 466, -196, 57, -7, 59, -207, 505, -981, 1608, -2319, 3160, 30118, 1792, -1771, 1359, -875, 466, -196, 57, -7, 59, -207, 505, -980, 1606, -2313, 3145, 30116, 1807, -1777, 1362, -876, 467, -196, 57,
+ -7, 59, -207, 504, -979, 1603, -2307, 3130, 30118, 1821, -1783, 1365, -877, 467, -196, 57, -7, 59, -207, 504, -978, 1600, -2301, 3114, 30119, 1835, -1789, 1368, -878, 468, -196, 57, -7, 59, -206, 503, -976, 1598, -2295, 3099, 30119, 1850, -1795, 1370, -880, 468, -196, 57, -7, 59, -206, 503, -975, 1595, -2289, 3084, 30119, 1864, -1801, 1373, -881, 469, -196, 57,
+ -7, 59, -206, 503, -974, 1592, -2283, 3068, 30121, 1879, -1807, 1376, -882, 469, -197, 57, -7, 59, -206, 502, -973, 1590, -2277, 3053, 30122, 1893, -1813, 1379, -883, 469, -197, 57, -7, 59, -206, 502, -972, 1587, -2271, 3038, 30122, 1908, -1819, 1381, -884, 470, -197, 57, -7, 59, -206, 501, -971, 1585, -2265, 3022, 30125, 1922, -1825, 1384, -886, 470, -197, 57,
+ -7, 59, -206, 501, -970, 1582, -2260, 3007, 30126, 1936, -1831, 1387, -887, 471, -197, 57, -7, 59, -206, 501, -969, 1579, -2254, 2992, 30126, 1951, -1837, 1390, -888, 471, -197, 57, -7, 59, -206, 500, -968, 1577, -2248, 2977, 30127, 1965, -1843, 1392, -889, 472, -197, 57, -7, 59, -206, 500, -966, 1574, -2242, 2961, 30128, 1980, -1849, 1395, -890, 472, -198, 57,
+ -7, 59, -205, 499, -965, 1571, -2236, 2946, 30128, 1994, -1855, 1398, -891, 473, -198, 57, -7, 59, -205, 499, -964, 1569, -2230, 2931, 30128, 2009, -1861, 1401, -893, 473, -198, 57, -7, 59, -205, 499, -963, 1566, -2224, 2916, 30129, 2023, -1867, 1403, -894, 473, -198, 58, -7, 59, -205, 498, -962, 1563, -2218, 2901, 30128, 2038, -1872, 1406, -895, 474, -198, 58,
+ -7, 59, -205, 498, -961, 1561, -2212, 2885, 30128, 2053, -1878, 1409, -896, 474, -198, 58, -7, 59, -205, 497, -960, 1558, -2206, 2870, 30129, 2067, -1884, 1412, -897, 475, -198, 58, -7, 59, -205, 497, -959, 1555, -2200, 2855, 30131, 2082, -1890, 1414, -899, 475, -198, 58, -7, 59, -205, 497, -958, 1553, -2194, 2840, 30131, 2096, -1896, 1417, -900, 476, -199, 58,
+ -7, 59, -205, 496, -956, 1550, -2188, 2825, 30131, 2111, -1902, 1420, -901, 476, -199, 58, -7, 59, -204, 496, -955, 1547, -2182, 2810, 30130, 2126, -1908, 1423, -902, 476, -199, 58, -7, 59, -204, 495, -954, 1545, -2176, 2795, 30131, 2140, -1914, 1425, -903, 477, -199, 58, -7, 59, -204, 495, -953, 1542, -2170, 2779, 30133, 2155, -1920, 1428, -905, 477, -199, 58,
+ -7, 59, -204, 495, -952, 1539, -2164, 2764, 30133, 2169, -1926, 1431, -906, 478, -199, 58, -7, 59, -204, 494, -951, 1536, -2158, 2749, 30134, 2184, -1932, 1434, -907, 478, -199, 58, -7, 59, -204, 494, -950, 1534, -2152, 2734, 30133, 2199, -1938, 1436, -908, 479, -199, 58, -7, 59, -204, 493, -948, 1531, -2146, 2719, 30135, 2213, -1944, 1439, -909, 479, -200, 58,
+ -7, 59, -204, 493, -947, 1528, -2141, 2704, 30135, 2228, -1950, 1442, -910, 480, -200, 58, -7, 59, -203, 493, -946, 1526, -2135, 2689, 30135, 2243, -1956, 1444, -912, 480, -200, 58, -7, 59, -203, 492, -945, 1523, -2129, 2674, 30136, 2258, -1962, 1447, -913, 480, -200, 58, -7, 59, -203, 492, -944, 1520, -2123, 2659, 30136, 2272, -1968, 1450, -914, 481, -200, 58,
+ -7, 59, -203, 491, -943, 1518, -2117, 2644, 30136, 2287, -1974, 1453, -915, 481, -200, 58, -7, 59, -203, 491, -942, 1515, -2111, 2629, 30136, 2302, -1980, 1455, -916, 482, -200, 58, -7, 59, -203, 491, -941, 1512, -2105, 2614, 30136, 2317, -1986, 1458, -917, 482, -200, 58, -7, 59, -203, 490, -939, 1510, -2099, 2599, 30137, 2331, -1992, 1461, -919, 483, -201, 58,
+ -7, 59, -203, 490, -938, 1507, -2093, 2584, 30137, 2346, -1998, 1464, -920, 483, -201, 58, -7, 59, -203, 489, -937, 1504, -2087, 2569, 30139, 2361, -2004, 1466, -921, 483, -201, 58, -7, 58, -202, 489, -936, 1501, -2081, 2554, 30137, 2376, -2009, 1469, -922, 484, -201, 58, -7, 58, -202, 488, -935, 1499, -2075, 2539, 30138, 2390, -2015, 1472, -923, 484, -201, 58,
+ -7, 58, -202, 488, -934, 1496, -2069, 2524, 30138, 2405, -2021, 1474, -924, 485, -201, 58, -7, 58, -202, 488, -932, 1493, -2063, 2509, 30138, 2420, -2027, 1477, -926, 485, -201, 58, -7, 58, -202, 487, -931, 1491, -2057, 2494, 30137, 2435, -2033, 1480, -927, 486, -201, 58, -7, 58, -202, 487, -930, 1488, -2051, 2480, 30137, 2450, -2039, 1483, -928, 486, -202, 58,
+ 0, 58, -202, 486, -929, 1485, -2045, 2464, 30134, 2464, -2045, 1485, -929, 486, -202, 58,
+};
+
+static int16_t SCHISM_ALIGNED(64) sinc_down_lut_1[32800] = {
+ -8, 29, -5, -91, 118, 104, -380, 159, 620, -916, -314, 2100, -1493, -3239, 9652, 20096, 9652, -3239, -1493, 2100, -314, -916, 620, 159, -380, 104, 118, -91, -5, 29, -8, 0, -8, 29, -5, -91, 118, 104, -380, 158, 620, -915, -316, 2100, -1488, -3244, 9636, 20097, 9669, -3233, -1499, 2101, -311, -918, 619, 160, -380, 104, 118, -91, -5, 29, -8, -2,
+ -8, 29, -5, -92, 117, 105, -380, 157, 621, -913, -319, 2100, -1482, -3249, 9620, 20097, 9686, -3228, -1505, 2101, -308, -919, 618, 161, -380, 103, 118, -91, -5, 29, -8, -2, -8, 29, -4, -92, 117, 105, -380, 156, 622, -912, -322, 2100, -1476, -3255, 9604, 20096, 9702, -3223, -1510, 2101, -306, -920, 618, 162, -381, 103, 119, -91, -5, 29, -8, -2,
+ -8, 28, -4, -92, 117, 106, -379, 155, 622, -911, -324, 2100, -1470, -3260, 9587, 20096, 9719, -3217, -1516, 2101, -303, -922, 617, 163, -381, 102, 119, -91, -5, 29, -8, -2, -8, 28, -4, -92, 117, 106, -379, 154, 623, -909, -327, 2100, -1465, -3265, 9571, 20096, 9735, -3212, -1522, 2101, -300, -923, 616, 164, -381, 102, 119, -91, -5, 29, -8, -2,
+ -8, 28, -4, -92, 116, 106, -379, 153, 624, -908, -330, 2099, -1459, -3270, 9554, 20098, 9751, -3207, -1527, 2101, -298, -924, 615, 165, -381, 102, 120, -91, -5, 29, -8, -2, -8, 28, -4, -92, 116, 107, -379, 152, 624, -906, -332, 2099, -1453, -3276, 9538, 20097, 9768, -3201, -1533, 2101, -295, -926, 615, 166, -381, 101, 120, -91, -6, 29, -8, -2,
+ -8, 28, -4, -92, 116, 107, -379, 151, 625, -905, -335, 2099, -1448, -3281, 9521, 20099, 9784, -3196, -1539, 2101, -292, -927, 614, 167, -382, 101, 120, -91, -6, 29, -7, -2, -8, 28, -4, -92, 115, 108, -378, 150, 626, -904, -338, 2099, -1442, -3286, 9505, 20099, 9801, -3190, -1545, 2101, -290, -929, 613, 168, -382, 100, 120, -91, -6, 29, -7, -2,
+ -8, 28, -4, -92, 115, 108, -378, 149, 626, -902, -340, 2099, -1436, -3291, 9489, 20093, 9817, -3185, -1550, 2102, -287, -930, 613, 170, -382, 100, 121, -91, -6, 29, -7, -2, -8, 28, -4, -92, 115, 108, -378, 148, 627, -901, -343, 2098, -1430, -3296, 9472, 20094, 9833, -3179, -1556, 2102, -284, -931, 612, 171, -382, 100, 121, -91, -6, 29, -7, -2,
+ -8, 28, -4, -92, 115, 109, -378, 147, 628, -899, -346, 2098, -1425, -3301, 9456, 20094, 9850, -3174, -1562, 2102, -281, -933, 611, 172, -382, 99, 121, -91, -6, 29, -7, -2, -8, 28, -3, -92, 114, 109, -378, 145, 628, -898, -348, 2098, -1419, -3306, 9439, 20094, 9866, -3168, -1567, 2102, -279, -934, 611, 173, -382, 99, 121, -91, -6, 29, -7, -2,
+ -8, 28, -3, -92, 114, 110, -377, 144, 629, -897, -351, 2098, -1413, -3312, 9423, 20093, 9883, -3163, -1573, 2102, -276, -935, 610, 174, -383, 98, 122, -91, -6, 29, -7, -2, -8, 28, -3, -92, 114, 110, -377, 143, 630, -895, -354, 2097, -1408, -3317, 9406, 20096, 9899, -3157, -1579, 2102, -273, -937, 609, 175, -383, 98, 122, -91, -7, 29, -7, -2,
+ -8, 28, -3, -92, 114, 110, -377, 142, 630, -894, -356, 2097, -1402, -3322, 9390, 20096, 9915, -3152, -1584, 2102, -271, -938, 608, 176, -383, 98, 122, -91, -7, 29, -7, -2, -8, 28, -3, -92, 113, 111, -377, 141, 631, -892, -359, 2097, -1396, -3327, 9373, 20094, 9932, -3146, -1590, 2102, -268, -939, 608, 177, -383, 97, 122, -91, -7, 29, -7, -2,
+ -8, 28, -3, -92, 113, 111, -377, 140, 631, -891, -361, 2097, -1390, -3332, 9357, 20093, 9948, -3140, -1596, 2102, -265, -941, 607, 178, -383, 97, 123, -91, -7, 29, -7, -2, -8, 28, -3, -92, 113, 111, -376, 139, 632, -889, -364, 2096, -1385, -3337, 9341, 20094, 9964, -3135, -1602, 2102, -262, -942, 606, 179, -383, 96, 123, -91, -7, 29, -7, -2,
+ -8, 28, -3, -92, 112, 112, -376, 138, 633, -888, -367, 2096, -1379, -3342, 9324, 20094, 9981, -3129, -1607, 2102, -260, -943, 605, 180, -384, 96, 123, -91, -7, 29, -7, -2, -8, 28, -3, -92, 112, 112, -376, 137, 633, -886, -369, 2096, -1373, -3347, 9308, 20091, 9997, -3123, -1613, 2102, -257, -945, 605, 181, -384, 96, 124, -91, -7, 29, -7, -2,
+ -8, 28, -2, -92, 112, 113, -376, 136, 634, -885, -372, 2096, -1367, -3352, 9291, 20090, 10014, -3118, -1619, 2102, -254, -946, 604, 182, -384, 95, 124, -91, -7, 29, -7, -2, -8, 28, -2, -92, 112, 113, -375, 135, 635, -884, -375, 2095, -1362, -3357, 9275, 20089, 10030, -3112, -1624, 2102, -251, -947, 603, 183, -384, 95, 124, -91, -7, 29, -7, -2,
+ -8, 28, -2, -92, 111, 113, -375, 134, 635, -882, -377, 2095, -1356, -3361, 9258, 20091, 10046, -3106, -1630, 2102, -249, -949, 603, 184, -384, 94, 124, -91, -8, 29, -7, -2, -8, 28, -2, -92, 111, 114, -375, 133, 636, -881, -380, 2095, -1350, -3366, 9242, 20086, 10063, -3100, -1636, 2102, -246, -950, 602, 185, -384, 94, 125, -90, -8, 29, -7, -2,
+ -8, 28, -2, -92, 111, 114, -375, 132, 636, -879, -382, 2094, -1345, -3371, 9225, 20088, 10079, -3095, -1641, 2102, -243, -951, 601, 186, -385, 93, 125, -90, -8, 30, -7, -2, -8, 28, -2, -92, 111, 114, -375, 131, 637, -878, -385, 2094, -1339, -3376, 9209, 20088, 10095, -3089, -1647, 2102, -240, -953, 600, 187, -385, 93, 125, -90, -8, 30, -7, -2,
+ -8, 28, -2, -92, 110, 115, -374, 130, 638, -876, -388, 2094, -1333, -3381, 9192, 20085, 10112, -3083, -1653, 2102, -238, -954, 600, 188, -385, 93, 125, -90, -8, 30, -7, -2, -8, 28, -2, -92, 110, 115, -374, 129, 638, -875, -390, 2093, -1327, -3386, 9176, 20085, 10128, -3077, -1658, 2101, -235, -955, 599, 189, -385, 92, 126, -90, -8, 30, -7, -2,
+ -8, 28, -2, -92, 110, 116, -374, 128, 639, -873, -393, 2093, -1322, -3391, 9160, 20084, 10144, -3071, -1664, 2101, -232, -957, 598, 190, -385, 92, 126, -90, -8, 30, -7, -2, -8, 27, -1, -92, 109, 116, -374, 127, 639, -872, -395, 2092, -1316, -3395, 9143, 20085, 10161, -3066, -1670, 2101, -229, -958, 597, 192, -385, 91, 126, -90, -8, 30, -7, -2,
+ -8, 27, -1, -92, 109, 116, -374, 126, 640, -871, -398, 2092, -1310, -3400, 9127, 20084, 10177, -3060, -1675, 2101, -227, -959, 596, 193, -385, 91, 126, -90, -8, 30, -7, -2, -8, 27, -1, -92, 109, 117, -373, 125, 641, -869, -400, 2092, -1304, -3405, 9110, 20080, 10194, -3054, -1681, 2101, -224, -961, 596, 194, -386, 91, 127, -90, -9, 30, -7, -2,
+ -8, 27, -1, -92, 109, 117, -373, 124, 641, -868, -403, 2091, -1299, -3410, 9094, 20083, 10210, -3048, -1687, 2101, -221, -962, 595, 195, -386, 90, 127, -90, -9, 30, -7, -2, -8, 27, -1, -92, 108, 117, -373, 123, 642, -866, -406, 2091, -1293, -3414, 9077, 20081, 10226, -3042, -1692, 2101, -218, -963, 594, 196, -386, 90, 127, -90, -9, 30, -7, -2,
+ -8, 27, -1, -92, 108, 118, -373, 121, 642, -865, -408, 2091, -1287, -3419, 9061, 20081, 10243, -3036, -1698, 2101, -216, -965, 593, 197, -386, 89, 128, -90, -9, 30, -7, -2, -8, 27, -1, -92, 108, 118, -372, 120, 643, -863, -411, 2090, -1282, -3424, 9044, 20080, 10259, -3030, -1704, 2101, -213, -966, 593, 198, -386, 89, 128, -90, -9, 30, -7, -2,
+ -8, 27, -1, -92, 108, 119, -372, 119, 644, -862, -413, 2090, -1276, -3428, 9028, 20078, 10275, -3024, -1709, 2100, -210, -967, 592, 199, -386, 88, 128, -90, -9, 30, -7, -3, -8, 27, -1, -93, 107, 119, -372, 118, 644, -860, -416, 2089, -1270, -3433, 9011, 20080, 10292, -3018, -1715, 2100, -207, -968, 591, 200, -386, 88, 128, -90, -9, 30, -7, -3,
+ -8, 27, 0, -93, 107, 119, -372, 117, 645, -859, -418, 2089, -1264, -3438, 8995, 20079, 10308, -3012, -1721, 2100, -205, -970, 590, 201, -387, 88, 129, -90, -9, 30, -7, -3, -8, 27, 0, -93, 107, 120, -371, 116, 645, -857, -421, 2088, -1259, -3442, 8978, 20078, 10324, -3006, -1726, 2100, -202, -971, 589, 202, -387, 87, 129, -90, -9, 30, -7, -3,
+ -8, 27, 0, -93, 106, 120, -371, 115, 646, -856, -424, 2088, -1253, -3447, 8962, 20078, 10340, -3000, -1732, 2100, -199, -972, 589, 203, -387, 87, 129, -90, -10, 30, -7, -3, -8, 27, 0, -93, 106, 120, -371, 114, 646, -854, -426, 2087, -1247, -3451, 8945, 20078, 10357, -2994, -1738, 2100, -196, -974, 588, 204, -387, 86, 129, -90, -10, 30, -7, -3,
+ -8, 27, 0, -93, 106, 121, -371, 113, 647, -853, -429, 2087, -1242, -3456, 8929, 20076, 10373, -2988, -1743, 2099, -193, -975, 587, 205, -387, 86, 130, -90, -10, 30, -7, -3, -8, 27, 0, -93, 106, 121, -370, 112, 647, -851, -431, 2087, -1236, -3461, 8913, 20075, 10389, -2982, -1749, 2099, -191, -976, 586, 206, -387, 85, 130, -90, -10, 30, -7, -3,
+ -8, 27, 0, -93, 105, 122, -370, 111, 648, -850, -434, 2086, -1230, -3465, 8896, 20073, 10406, -2976, -1755, 2099, -188, -977, 585, 207, -387, 85, 130, -89, -10, 30, -7, -3, -8, 27, 0, -93, 105, 122, -370, 110, 649, -848, -436, 2086, -1224, -3470, 8880, 20069, 10422, -2970, -1760, 2099, -185, -979, 585, 208, -387, 85, 130, -89, -10, 30, -7, -3,
+ -8, 27, 0, -93, 105, 122, -370, 109, 649, -847, -439, 2085, -1219, -3474, 8863, 20071, 10438, -2963, -1766, 2099, -182, -980, 584, 209, -388, 84, 131, -89, -10, 30, -7, -3, -8, 27, 0, -93, 104, 123, -369, 108, 650, -845, -441, 2085, -1213, -3479, 8847, 20067, 10455, -2957, -1772, 2098, -179, -981, 583, 210, -388, 84, 131, -89, -10, 30, -7, -3,
+ -8, 27, 1, -93, 104, 123, -369, 107, 650, -844, -444, 2084, -1207, -3483, 8830, 20069, 10471, -2951, -1777, 2098, -177, -982, 582, 211, -388, 83, 131, -89, -11, 30, -7, -3, -8, 27, 1, -93, 104, 123, -369, 106, 651, -842, -446, 2084, -1201, -3487, 8814, 20065, 10487, -2945, -1783, 2098, -174, -984, 581, 213, -388, 83, 131, -89, -11, 30, -7, -3,
+ -8, 27, 1, -93, 104, 124, -369, 105, 651, -841, -449, 2083, -1196, -3492, 8797, 20066, 10503, -2939, -1789, 2098, -171, -985, 581, 214, -388, 82, 132, -89, -11, 30, -7, -3, -8, 27, 1, -93, 103, 124, -368, 104, 652, -839, -451, 2083, -1190, -3496, 8781, 20061, 10520, -2933, -1794, 2097, -168, -986, 580, 215, -388, 82, 132, -89, -11, 30, -7, -3,
+ -8, 27, 1, -93, 103, 124, -368, 103, 652, -838, -454, 2082, -1184, -3501, 8764, 20062, 10536, -2926, -1800, 2097, -165, -987, 579, 216, -388, 82, 132, -89, -11, 30, -7, -3, -8, 27, 1, -93, 103, 125, -368, 102, 653, -836, -456, 2081, -1179, -3505, 8748, 20060, 10552, -2920, -1805, 2097, -162, -989, 578, 217, -388, 81, 132, -89, -11, 30, -7, -3,
+ -8, 27, 1, -93, 102, 125, -368, 101, 653, -835, -459, 2081, -1173, -3509, 8731, 20062, 10568, -2914, -1811, 2097, -160, -990, 577, 218, -389, 81, 133, -89, -11, 30, -7, -3, -8, 26, 1, -93, 102, 125, -367, 100, 654, -833, -461, 2080, -1167, -3514, 8715, 20059, 10585, -2907, -1817, 2096, -157, -991, 576, 219, -389, 80, 133, -89, -11, 31, -7, -3,
+ -8, 26, 1, -93, 102, 126, -367, 99, 655, -832, -464, 2080, -1161, -3518, 8698, 20055, 10601, -2901, -1822, 2096, -154, -992, 576, 220, -389, 80, 133, -89, -11, 31, -7, -3, -8, 26, 2, -93, 102, 126, -367, 98, 655, -830, -466, 2079, -1156, -3522, 8682, 20056, 10617, -2895, -1828, 2096, -151, -994, 575, 221, -389, 79, 133, -89, -12, 31, -7, -3,
+ -8, 26, 2, -93, 101, 127, -367, 97, 656, -829, -469, 2079, -1150, -3527, 8665, 20055, 10633, -2888, -1834, 2095, -148, -995, 574, 222, -389, 79, 134, -89, -12, 31, -7, -3, -8, 26, 2, -93, 101, 127, -366, 96, 656, -827, -471, 2078, -1144, -3531, 8649, 20050, 10650, -2882, -1839, 2095, -145, -996, 573, 223, -389, 79, 134, -89, -12, 31, -7, -3,
+ -8, 26, 2, -93, 101, 127, -366, 95, 657, -826, -474, 2077, -1138, -3535, 8632, 20052, 10666, -2876, -1845, 2095, -143, -997, 572, 224, -389, 78, 134, -89, -12, 31, -7, -3, -8, 26, 2, -93, 101, 128, -366, 94, 657, -824, -476, 2077, -1133, -3539, 8616, 20048, 10682, -2869, -1850, 2094, -140, -999, 571, 225, -389, 78, 135, -89, -12, 31, -7, -3,
+ -8, 26, 2, -93, 100, 128, -366, 93, 658, -823, -479, 2076, -1127, -3544, 8599, 20049, 10698, -2863, -1856, 2094, -137, -1000, 571, 226, -389, 77, 135, -88, -12, 31, -7, -3, -8, 26, 2, -93, 100, 128, -365, 91, 658, -821, -481, 2076, -1121, -3548, 8583, 20045, 10715, -2856, -1862, 2094, -134, -1001, 570, 227, -390, 77, 135, -88, -12, 31, -7, -3,
+ -8, 26, 2, -93, 100, 129, -365, 90, 659, -820, -484, 2075, -1116, -3552, 8566, 20046, 10731, -2850, -1867, 2093, -131, -1002, 569, 228, -390, 76, 135, -88, -12, 31, -7, -3, -8, 26, 2, -93, 99, 129, -365, 89, 659, -818, -486, 2074, -1110, -3556, 8550, 20043, 10747, -2843, -1873, 2093, -128, -1003, 568, 229, -390, 76, 136, -88, -12, 31, -7, -3,
+ -8, 26, 2, -93, 99, 129, -365, 88, 660, -816, -489, 2074, -1104, -3560, 8533, 20045, 10763, -2837, -1879, 2093, -126, -1005, 567, 230, -390, 75, 136, -88, -13, 31, -7, -3, -8, 26, 3, -93, 99, 130, -364, 87, 660, -815, -491, 2073, -1098, -3564, 8517, 20039, 10780, -2830, -1884, 2092, -123, -1006, 566, 231, -390, 75, 136, -88, -13, 31, -7, -3,
+ -8, 26, 3, -93, 99, 130, -364, 86, 661, -813, -494, 2072, -1093, -3569, 8501, 20039, 10796, -2824, -1890, 2092, -120, -1007, 565, 232, -390, 75, 136, -88, -13, 31, -7, -3, -8, 26, 3, -93, 98, 130, -364, 85, 661, -812, -496, 2072, -1087, -3573, 8484, 20037, 10812, -2817, -1895, 2091, -117, -1008, 565, 233, -390, 74, 137, -88, -13, 31, -7, -3,
+ -8, 26, 3, -93, 98, 131, -364, 84, 662, -810, -498, 2071, -1081, -3577, 8468, 20032, 10828, -2811, -1901, 2091, -114, -1009, 564, 235, -390, 74, 137, -88, -13, 31, -7, -3, -8, 26, 3, -93, 98, 131, -363, 83, 662, -809, -501, 2070, -1076, -3581, 8451, 20034, 10844, -2804, -1907, 2091, -111, -1011, 563, 236, -390, 73, 137, -88, -13, 31, -7, -3,
+ -8, 26, 3, -93, 97, 131, -363, 82, 663, -807, -503, 2070, -1070, -3585, 8435, 20031, 10860, -2798, -1912, 2090, -108, -1012, 562, 237, -390, 73, 137, -88, -13, 31, -7, -3, -8, 26, 3, -93, 97, 132, -363, 81, 663, -806, -506, 2069, -1064, -3589, 8418, 20029, 10877, -2791, -1918, 2090, -106, -1013, 561, 238, -390, 72, 138, -88, -13, 31, -6, -3,
+ -8, 26, 3, -93, 97, 132, -362, 80, 663, -804, -508, 2068, -1058, -3593, 8402, 20027, 10893, -2784, -1923, 2089, -103, -1014, 560, 239, -391, 72, 138, -88, -14, 31, -6, -3, -8, 26, 3, -93, 97, 132, -362, 79, 664, -803, -511, 2068, -1053, -3597, 8385, 20028, 10909, -2778, -1929, 2089, -100, -1015, 559, 240, -391, 71, 138, -88, -14, 31, -6, -3,
+ -8, 26, 3, -93, 96, 133, -362, 78, 664, -801, -513, 2067, -1047, -3601, 8369, 20026, 10925, -2771, -1934, 2088, -97, -1017, 558, 241, -391, 71, 138, -88, -14, 31, -6, -3, -8, 26, 4, -93, 96, 133, -362, 77, 665, -799, -516, 2066, -1041, -3605, 8352, 20023, 10941, -2764, -1940, 2088, -94, -1018, 557, 242, -391, 70, 139, -88, -14, 31, -6, -3,
+ -8, 26, 4, -93, 96, 133, -361, 76, 665, -798, -518, 2066, -1036, -3609, 8336, 20019, 10958, -2758, -1946, 2087, -91, -1019, 557, 243, -391, 70, 139, -87, -14, 31, -6, -3, -8, 26, 4, -93, 95, 134, -361, 75, 666, -796, -520, 2065, -1030, -3613, 8319, 20015, 10974, -2751, -1951, 2087, -88, -1020, 556, 244, -391, 70, 139, -87, -14, 31, -6, -3,
+ -8, 25, 4, -93, 95, 134, -361, 74, 666, -795, -523, 2064, -1024, -3617, 8303, 20017, 10990, -2744, -1957, 2086, -85, -1021, 555, 245, -391, 69, 139, -87, -14, 31, -6, -3, -8, 25, 4, -93, 95, 134, -360, 73, 667, -793, -525, 2063, -1018, -3620, 8286, 20011, 11006, -2737, -1962, 2086, -83, -1022, 554, 246, -391, 69, 140, -87, -14, 31, -6, -3,
+ -8, 25, 4, -93, 95, 135, -360, 72, 667, -792, -528, 2063, -1013, -3624, 8270, 20014, 11022, -2731, -1968, 2085, -80, -1024, 553, 247, -391, 68, 140, -87, -15, 31, -6, -3, -8, 25, 4, -93, 94, 135, -360, 71, 668, -790, -530, 2062, -1007, -3628, 8253, 20011, 11038, -2724, -1973, 2085, -77, -1025, 552, 248, -391, 68, 140, -87, -15, 31, -6, -3,
+ -8, 25, 4, -93, 94, 135, -360, 70, 668, -788, -532, 2061, -1001, -3632, 8237, 20010, 11054, -2717, -1979, 2084, -74, -1026, 551, 249, -391, 67, 140, -87, -15, 31, -6, -3, -8, 25, 4, -93, 94, 136, -359, 69, 668, -787, -535, 2060, -996, -3636, 8220, 20007, 11071, -2710, -1985, 2084, -71, -1027, 550, 250, -391, 67, 141, -87, -15, 31, -6, -3,
+ -8, 25, 4, -93, 93, 136, -359, 68, 669, -785, -537, 2060, -990, -3640, 8204, 20004, 11087, -2703, -1990, 2083, -68, -1028, 549, 251, -391, 66, 141, -87, -15, 31, -6, -3, -8, 25, 5, -93, 93, 136, -359, 67, 669, -784, -540, 2059, -984, -3643, 8188, 20002, 11103, -2696, -1996, 2083, -65, -1029, 548, 252, -392, 66, 141, -87, -15, 31, -6, -3,
+ -8, 25, 5, -93, 93, 137, -358, 66, 670, -782, -542, 2058, -978, -3647, 8171, 19998, 11119, -2690, -2001, 2082, -62, -1030, 547, 253, -392, 66, 141, -87, -15, 31, -6, -3, -8, 25, 5, -93, 93, 137, -358, 65, 670, -781, -544, 2057, -973, -3651, 8155, 19996, 11135, -2683, -2007, 2082, -59, -1032, 547, 254, -392, 65, 142, -87, -15, 32, -6, -3,
+ -9, 25, 5, -93, 92, 137, -358, 64, 671, -779, -547, 2056, -967, -3655, 8138, 19996, 11151, -2676, -2012, 2081, -56, -1033, 546, 255, -392, 65, 142, -87, -15, 32, -6, -3, -9, 25, 5, -93, 92, 138, -358, 63, 671, -777, -549, 2056, -961, -3658, 8122, 19993, 11167, -2669, -2018, 2081, -54, -1034, 545, 256, -392, 64, 142, -87, -16, 32, -6, -3,
+ -9, 25, 5, -93, 92, 138, -357, 62, 672, -776, -552, 2055, -956, -3662, 8105, 19990, 11183, -2662, -2023, 2080, -51, -1035, 544, 258, -392, 64, 142, -86, -16, 32, -6, -3, -9, 25, 5, -93, 91, 138, -357, 61, 672, -774, -554, 2054, -950, -3666, 8089, 19989, 11199, -2655, -2029, 2079, -48, -1036, 543, 259, -392, 63, 143, -86, -16, 32, -6, -3,
+ -9, 25, 5, -93, 91, 139, -357, 60, 672, -773, -556, 2053, -944, -3669, 8072, 19986, 11215, -2648, -2035, 2079, -45, -1037, 542, 260, -392, 63, 143, -86, -16, 32, -6, -3, -9, 25, 5, -93, 91, 139, -356, 59, 673, -771, -559, 2052, -939, -3673, 8056, 19983, 11232, -2641, -2040, 2078, -42, -1038, 541, 261, -392, 62, 143, -86, -16, 32, -6, -3,
+ -9, 25, 5, -93, 91, 139, -356, 58, 673, -769, -561, 2051, -933, -3677, 8039, 19982, 11248, -2634, -2046, 2078, -39, -1040, 540, 262, -392, 62, 143, -86, -16, 32, -6, -3, -9, 25, 6, -93, 90, 140, -356, 57, 674, -768, -563, 2051, -927, -3680, 8023, 19976, 11264, -2627, -2051, 2077, -36, -1041, 539, 263, -392, 61, 144, -86, -16, 32, -6, -3,
+ -9, 25, 6, -93, 90, 140, -355, 56, 674, -766, -566, 2050, -921, -3684, 8006, 19975, 11280, -2620, -2057, 2076, -33, -1042, 538, 264, -392, 61, 144, -86, -16, 32, -6, -3, -9, 25, 6, -93, 90, 140, -355, 55, 674, -765, -568, 2049, -916, -3688, 7990, 19975, 11296, -2613, -2062, 2076, -30, -1043, 537, 265, -392, 60, 144, -86, -17, 32, -6, -3,
+ -9, 25, 6, -93, 89, 141, -355, 54, 675, -763, -570, 2048, -910, -3691, 7974, 19971, 11312, -2606, -2068, 2075, -27, -1044, 536, 266, -392, 60, 144, -86, -17, 32, -6, -3, -9, 25, 6, -93, 89, 141, -354, 53, 675, -761, -573, 2047, -904, -3695, 7957, 19969, 11328, -2599, -2073, 2074, -24, -1045, 535, 267, -392, 60, 144, -86, -17, 32, -6, -3,
+ -9, 25, 6, -93, 89, 141, -354, 52, 676, -760, -575, 2046, -899, -3698, 7941, 19965, 11344, -2591, -2079, 2074, -21, -1046, 534, 268, -392, 59, 145, -86, -17, 32, -6, -3, -9, 25, 6, -93, 89, 142, -354, 51, 676, -758, -577, 2045, -893, -3702, 7924, 19963, 11360, -2584, -2084, 2073, -19, -1047, 533, 269, -392, 59, 145, -86, -17, 32, -6, -3,
+ -9, 25, 6, -93, 88, 142, -354, 50, 676, -757, -580, 2044, -887, -3705, 7908, 19964, 11376, -2577, -2090, 2072, -16, -1048, 532, 270, -392, 58, 145, -86, -17, 32, -6, -3, -9, 24, 6, -93, 88, 142, -353, 49, 677, -755, -582, 2043, -882, -3709, 7891, 19962, 11392, -2570, -2095, 2072, -13, -1049, 531, 271, -393, 58, 145, -86, -17, 32, -6, -3,
+ -9, 24, 6, -93, 88, 143, -353, 48, 677, -753, -584, 2043, -876, -3712, 7875, 19957, 11408, -2563, -2101, 2071, -10, -1051, 530, 272, -393, 57, 146, -85, -17, 32, -6, -3, -9, 24, 7, -93, 87, 143, -353, 47, 678, -752, -587, 2042, -870, -3716, 7858, 19956, 11424, -2556, -2106, 2070, -7, -1052, 530, 273, -393, 57, 146, -85, -18, 32, -6, -3,
+ -9, 24, 7, -93, 87, 143, -352, 46, 678, -750, -589, 2041, -865, -3719, 7842, 19952, 11440, -2548, -2112, 2070, -4, -1053, 529, 274, -393, 56, 146, -85, -18, 32, -6, -3, -9, 24, 7, -93, 87, 144, -352, 45, 678, -749, -591, 2040, -859, -3722, 7826, 19948, 11456, -2541, -2117, 2069, -1, -1054, 528, 275, -393, 56, 146, -85, -18, 32, -6, -3,
+ -9, 24, 7, -93, 87, 144, -352, 44, 679, -747, -594, 2039, -853, -3726, 7809, 19947, 11472, -2534, -2123, 2068, 2, -1055, 527, 276, -393, 55, 147, -85, -18, 32, -6, -3, -9, 24, 7, -93, 86, 144, -351, 43, 679, -745, -596, 2038, -848, -3729, 7793, 19944, 11488, -2527, -2128, 2067, 5, -1056, 526, 277, -393, 55, 147, -85, -18, 32, -6, -3,
+ -9, 24, 7, -93, 86, 144, -351, 42, 679, -744, -598, 2037, -842, -3733, 7776, 19943, 11504, -2519, -2134, 2067, 8, -1057, 525, 278, -393, 54, 147, -85, -18, 32, -6, -3, -9, 24, 7, -93, 86, 145, -351, 41, 680, -742, -601, 2036, -836, -3736, 7760, 19938, 11520, -2512, -2139, 2066, 11, -1058, 524, 279, -393, 54, 147, -85, -18, 32, -6, -3,
+ -9, 24, 7, -93, 85, 145, -350, 40, 680, -740, -603, 2035, -831, -3739, 7743, 19937, 11536, -2505, -2145, 2065, 14, -1059, 523, 280, -393, 53, 148, -85, -18, 32, -6, -3, -9, 24, 7, -93, 85, 145, -350, 39, 681, -739, -605, 2034, -825, -3743, 7727, 19933, 11552, -2497, -2150, 2064, 17, -1060, 522, 281, -393, 53, 148, -85, -18, 32, -6, -3,
+ -9, 24, 7, -93, 85, 146, -350, 38, 681, -737, -607, 2033, -819, -3746, 7710, 19931, 11568, -2490, -2156, 2064, 20, -1061, 521, 282, -393, 52, 148, -85, -19, 32, -6, -3, -9, 24, 8, -93, 85, 146, -349, 37, 681, -736, -610, 2032, -814, -3749, 7694, 19926, 11584, -2482, -2161, 2063, 23, -1062, 520, 284, -393, 52, 148, -85, -19, 32, -6, -3,
+ -9, 24, 8, -93, 84, 146, -349, 36, 682, -734, -612, 2031, -808, -3752, 7678, 19920, 11600, -2475, -2166, 2062, 26, -1063, 519, 285, -393, 52, 149, -84, -19, 32, -6, -3, -9, 24, 8, -93, 84, 147, -349, 35, 682, -732, -614, 2030, -802, -3756, 7661, 19919, 11616, -2468, -2172, 2061, 29, -1064, 518, 286, -393, 51, 149, -84, -19, 32, -6, -3,
+ -9, 24, 8, -93, 84, 147, -348, 34, 682, -731, -617, 2029, -797, -3759, 7645, 19915, 11632, -2460, -2177, 2061, 32, -1065, 517, 287, -393, 51, 149, -84, -19, 32, -6, -3, -9, 24, 8, -93, 83, 147, -348, 33, 683, -729, -619, 2028, -791, -3762, 7628, 19915, 11648, -2453, -2183, 2060, 35, -1067, 516, 288, -393, 50, 149, -84, -19, 32, -6, -3,
+ -9, 24, 8, -93, 83, 148, -348, 32, 683, -727, -621, 2027, -785, -3765, 7612, 19908, 11664, -2445, -2188, 2059, 38, -1068, 515, 289, -393, 50, 150, -84, -19, 32, -6, -3, -9, 24, 8, -93, 83, 148, -347, 31, 683, -726, -623, 2026, -780, -3768, 7596, 19908, 11679, -2438, -2194, 2058, 41, -1069, 514, 290, -393, 49, 150, -84, -19, 32, -6, -3,
+ -9, 24, 8, -93, 83, 148, -347, 30, 684, -724, -626, 2025, -774, -3772, 7579, 19907, 11695, -2430, -2199, 2057, 43, -1070, 513, 291, -393, 49, 150, -84, -20, 32, -6, -3, -9, 24, 8, -93, 82, 148, -347, 29, 684, -722, -628, 2024, -768, -3775, 7563, 19906, 11711, -2423, -2205, 2056, 46, -1071, 512, 292, -393, 48, 150, -84, -20, 32, -6, -3,
+ -9, 24, 8, -93, 82, 149, -346, 28, 684, -721, -630, 2023, -763, -3778, 7546, 19900, 11727, -2415, -2210, 2056, 49, -1072, 511, 293, -393, 48, 150, -84, -20, 32, -5, -3, -9, 24, 8, -93, 82, 149, -346, 27, 685, -719, -632, 2022, -757, -3781, 7530, 19895, 11743, -2408, -2216, 2055, 52, -1073, 510, 294, -393, 47, 151, -84, -20, 33, -5, -3,
+ -9, 24, 9, -93, 81, 149, -346, 26, 685, -717, -635, 2021, -751, -3784, 7513, 19892, 11759, -2400, -2221, 2054, 55, -1074, 509, 295, -393, 47, 151, -84, -20, 33, -5, -3, -9, 23, 9, -93, 81, 150, -345, 25, 685, -716, -637, 2020, -746, -3787, 7497, 19890, 11775, -2393, -2226, 2053, 58, -1075, 508, 296, -393, 46, 151, -84, -20, 33, -5, -3,
+ -9, 23, 9, -93, 81, 150, -345, 24, 686, -714, -639, 2019, -740, -3790, 7481, 19884, 11791, -2385, -2232, 2052, 61, -1076, 507, 297, -393, 46, 151, -83, -20, 33, -5, -3, -9, 23, 9, -93, 81, 150, -345, 23, 686, -713, -641, 2018, -734, -3793, 7464, 19881, 11807, -2377, -2237, 2051, 64, -1077, 506, 298, -393, 45, 152, -83, -20, 33, -5, -3,
+ -9, 23, 9, -93, 80, 151, -344, 22, 686, -711, -644, 2016, -729, -3796, 7448, 19884, 11822, -2370, -2243, 2050, 67, -1078, 504, 299, -393, 45, 152, -83, -21, 33, -5, -4, -9, 23, 9, -93, 80, 151, -344, 21, 687, -709, -646, 2015, -723, -3799, 7431, 19880, 11838, -2362, -2248, 2049, 70, -1079, 503, 300, -393, 44, 152, -83, -21, 33, -5, -4,
+ -9, 23, 9, -93, 80, 151, -344, 20, 687, -708, -648, 2014, -717, -3802, 7415, 19876, 11854, -2354, -2253, 2048, 73, -1080, 502, 301, -393, 44, 152, -83, -21, 33, -5, -4, -9, 23, 9, -93, 79, 151, -343, 19, 687, -706, -650, 2013, -712, -3805, 7399, 19874, 11870, -2347, -2259, 2047, 76, -1081, 501, 302, -393, 43, 153, -83, -21, 33, -5, -4,
+ -9, 23, 9, -93, 79, 152, -343, 18, 688, -704, -652, 2012, -706, -3808, 7382, 19867, 11886, -2339, -2264, 2047, 79, -1082, 500, 303, -393, 43, 153, -83, -21, 33, -5, -4, -9, 23, 9, -93, 79, 152, -343, 17, 688, -703, -655, 2011, -701, -3811, 7366, 19867, 11902, -2331, -2270, 2046, 82, -1083, 499, 304, -393, 42, 153, -83, -21, 33, -5, -4,
+ -9, 23, 9, -93, 79, 152, -342, 16, 688, -701, -657, 2010, -695, -3814, 7350, 19861, 11918, -2323, -2275, 2045, 85, -1084, 498, 305, -393, 42, 153, -83, -21, 33, -5, -4, -9, 23, 10, -93, 78, 153, -342, 15, 688, -699, -659, 2009, -689, -3817, 7333, 19859, 11933, -2316, -2280, 2044, 88, -1085, 497, 306, -393, 41, 153, -83, -21, 33, -5, -4,
+ -9, 23, 10, -93, 78, 153, -342, 14, 689, -698, -661, 2008, -684, -3820, 7317, 19856, 11949, -2308, -2286, 2043, 91, -1086, 496, 307, -393, 41, 154, -83, -22, 33, -5, -4, -9, 23, 10, -93, 78, 153, -341, 13, 689, -696, -663, 2006, -678, -3823, 7300, 19852, 11965, -2300, -2291, 2042, 94, -1087, 495, 308, -393, 40, 154, -82, -22, 33, -5, -4,
+ -9, 23, 10, -93, 77, 153, -341, 12, 689, -694, -666, 2005, -672, -3826, 7284, 19850, 11981, -2292, -2297, 2041, 97, -1088, 494, 309, -393, 40, 154, -82, -22, 33, -5, -4, -9, 23, 10, -93, 77, 154, -341, 11, 690, -693, -668, 2004, -667, -3828, 7268, 19845, 11997, -2284, -2302, 2040, 100, -1089, 493, 310, -393, 39, 154, -82, -22, 33, -5, -4,
+ -9, 23, 10, -92, 77, 154, -340, 10, 690, -691, -670, 2003, -661, -3831, 7251, 19840, 12012, -2277, -2307, 2039, 103, -1090, 492, 311, -393, 39, 155, -82, -22, 33, -5, -4, -9, 23, 10, -92, 77, 154, -340, 9, 690, -689, -672, 2002, -656, -3834, 7235, 19838, 12028, -2269, -2313, 2038, 106, -1091, 491, 312, -393, 38, 155, -82, -22, 33, -5, -4,
+ -9, 23, 10, -92, 76, 155, -340, 8, 690, -688, -674, 2001, -650, -3837, 7219, 19833, 12044, -2261, -2318, 2037, 109, -1091, 490, 313, -393, 38, 155, -82, -22, 33, -5, -4, -9, 23, 10, -92, 76, 155, -339, 7, 691, -686, -677, 1999, -644, -3840, 7202, 19829, 12060, -2253, -2323, 2036, 112, -1092, 489, 314, -393, 38, 155, -82, -22, 33, -5, -4,
+ -9, 23, 10, -92, 76, 155, -339, 6, 691, -684, -679, 1998, -639, -3842, 7186, 19827, 12075, -2245, -2329, 2035, 115, -1093, 488, 315, -393, 37, 156, -82, -23, 33, -5, -4, -9, 23, 10, -92, 75, 155, -338, 5, 691, -682, -681, 1997, -633, -3845, 7169, 19823, 12091, -2237, -2334, 2034, 118, -1094, 487, 316, -393, 37, 156, -82, -23, 33, -5, -4,
+ -9, 23, 11, -92, 75, 156, -338, 4, 691, -681, -683, 1996, -627, -3848, 7153, 19819, 12107, -2229, -2339, 2033, 121, -1095, 485, 317, -393, 36, 156, -82, -23, 33, -5, -4, -9, 23, 11, -92, 75, 156, -338, 3, 692, -679, -685, 1995, -622, -3851, 7137, 19814, 12123, -2221, -2345, 2032, 124, -1096, 484, 319, -393, 36, 156, -82, -23, 33, -5, -4,
+ -9, 22, 11, -92, 75, 156, -337, 2, 692, -677, -687, 1993, -616, -3853, 7120, 19812, 12138, -2213, -2350, 2030, 127, -1097, 483, 320, -393, 35, 156, -81, -23, 33, -5, -4, -9, 22, 11, -92, 74, 157, -337, 1, 692, -676, -689, 1992, -611, -3856, 7104, 19808, 12154, -2205, -2355, 2029, 130, -1098, 482, 321, -393, 35, 157, -81, -23, 33, -5, -4,
+ -9, 22, 11, -92, 74, 157, -337, 0, 693, -674, -692, 1991, -605, -3859, 7088, 19805, 12170, -2197, -2361, 2028, 133, -1099, 481, 322, -393, 34, 157, -81, -23, 33, -5, -4, -9, 22, 11, -92, 74, 157, -336, -1, 693, -672, -694, 1990, -599, -3861, 7071, 19800, 12185, -2189, -2366, 2027, 136, -1100, 480, 323, -393, 34, 157, -81, -23, 33, -5, -4,
+ -9, 22, 11, -92, 73, 157, -336, -2, 693, -671, -696, 1988, -594, -3864, 7055, 19801, 12201, -2181, -2371, 2026, 139, -1101, 479, 324, -393, 33, 157, -81, -24, 33, -5, -4, -9, 22, 11, -92, 73, 158, -336, -3, 693, -669, -698, 1987, -588, -3866, 7039, 19794, 12217, -2173, -2377, 2025, 142, -1102, 478, 325, -393, 33, 158, -81, -24, 33, -5, -4,
+ -9, 22, 11, -92, 73, 158, -335, -4, 694, -667, -700, 1986, -583, -3869, 7022, 19790, 12233, -2165, -2382, 2024, 145, -1103, 477, 326, -393, 32, 158, -81, -24, 33, -5, -4, -9, 22, 11, -92, 73, 158, -335, -5, 694, -666, -702, 1985, -577, -3872, 7006, 19786, 12248, -2157, -2387, 2023, 149, -1104, 476, 327, -393, 32, 158, -81, -24, 33, -5, -4,
+ -9, 22, 11, -92, 72, 158, -334, -6, 694, -664, -704, 1983, -571, -3874, 6990, 19783, 12264, -2149, -2393, 2022, 152, -1105, 475, 328, -393, 31, 158, -81, -24, 33, -5, -4, -9, 22, 12, -92, 72, 159, -334, -7, 694, -662, -706, 1982, -566, -3877, 6973, 19777, 12280, -2140, -2398, 2021, 155, -1105, 473, 329, -393, 31, 158, -81, -24, 33, -5, -4,
+ -9, 22, 12, -92, 72, 159, -334, -8, 694, -661, -709, 1981, -560, -3879, 6957, 19774, 12295, -2132, -2403, 2019, 158, -1106, 472, 330, -393, 30, 159, -80, -24, 33, -5, -4, -9, 22, 12, -92, 71, 159, -333, -9, 695, -659, -711, 1980, -555, -3882, 6941, 19770, 12311, -2124, -2409, 2018, 161, -1107, 471, 331, -393, 30, 159, -80, -24, 33, -5, -4,
+ -9, 22, 12, -92, 71, 160, -333, -10, 695, -657, -713, 1978, -549, -3884, 6925, 19765, 12327, -2116, -2414, 2017, 164, -1108, 470, 332, -392, 29, 159, -80, -25, 33, -5, -4, -9, 22, 12, -92, 71, 160, -333, -11, 695, -655, -715, 1977, -544, -3887, 6908, 19763, 12342, -2108, -2419, 2016, 167, -1109, 469, 333, -392, 29, 159, -80, -25, 33, -5, -4,
+ -9, 22, 12, -92, 71, 160, -332, -12, 695, -654, -717, 1976, -538, -3889, 6892, 19757, 12358, -2100, -2424, 2015, 170, -1110, 468, 334, -392, 28, 160, -80, -25, 33, -5, -4, -9, 22, 12, -92, 70, 160, -332, -13, 696, -652, -719, 1974, -532, -3892, 6876, 19754, 12373, -2091, -2430, 2014, 173, -1111, 467, 335, -392, 28, 160, -80, -25, 33, -5, -4,
+ -9, 22, 12, -92, 70, 161, -332, -14, 696, -650, -721, 1973, -527, -3894, 6859, 19751, 12389, -2083, -2435, 2012, 176, -1112, 466, 336, -392, 27, 160, -80, -25, 33, -5, -4, -9, 22, 12, -92, 70, 161, -331, -15, 696, -649, -723, 1972, -521, -3896, 6843, 19745, 12405, -2075, -2440, 2011, 179, -1113, 465, 337, -392, 27, 160, -80, -25, 33, -5, -4,
+ -9, 22, 12, -92, 69, 161, -331, -16, 696, -647, -725, 1970, -516, -3899, 6827, 19744, 12420, -2066, -2445, 2010, 182, -1113, 463, 338, -392, 26, 160, -80, -25, 33, -5, -4, -9, 22, 12, -92, 69, 161, -330, -17, 696, -645, -727, 1969, -510, -3901, 6810, 19738, 12436, -2058, -2451, 2009, 185, -1114, 462, 339, -392, 26, 161, -80, -25, 33, -5, -4,
+ -9, 22, 13, -92, 69, 162, -330, -18, 697, -643, -730, 1968, -505, -3904, 6794, 19732, 12451, -2050, -2456, 2008, 188, -1115, 461, 340, -392, 25, 161, -79, -26, 34, -4, -4, -9, 22, 13, -92, 69, 162, -330, -19, 697, -642, -732, 1966, -499, -3906, 6778, 19728, 12467, -2041, -2461, 2006, 191, -1116, 460, 341, -392, 25, 161, -79, -26, 34, -4, -4,
+ -9, 22, 13, -92, 68, 162, -329, -20, 697, -640, -734, 1965, -493, -3908, 6762, 19723, 12483, -2033, -2466, 2005, 194, -1117, 459, 342, -392, 24, 161, -79, -26, 34, -4, -4, -9, 21, 13, -92, 68, 162, -329, -21, 697, -638, -736, 1964, -488, -3911, 6745, 19723, 12498, -2025, -2472, 2004, 197, -1118, 458, 343, -392, 24, 161, -79, -26, 34, -4, -4,
+ -9, 21, 13, -92, 68, 163, -328, -22, 697, -637, -738, 1962, -482, -3913, 6729, 19716, 12514, -2016, -2477, 2003, 200, -1119, 457, 344, -392, 23, 162, -79, -26, 34, -4, -4, -9, 21, 13, -92, 67, 163, -328, -23, 698, -635, -740, 1961, -477, -3915, 6713, 19714, 12529, -2008, -2482, 2001, 203, -1120, 455, 345, -392, 23, 162, -79, -26, 34, -4, -4,
+ -9, 21, 13, -92, 67, 163, -328, -23, 698, -633, -742, 1959, -471, -3917, 6697, 19707, 12545, -1999, -2487, 2000, 206, -1120, 454, 346, -392, 22, 162, -79, -26, 34, -4, -4, -9, 21, 13, -92, 67, 164, -327, -24, 698, -631, -744, 1958, -466, -3920, 6680, 19704, 12560, -1991, -2493, 1999, 209, -1121, 453, 347, -392, 22, 162, -79, -26, 34, -4, -4,
+ -9, 21, 13, -92, 67, 164, -327, -25, 698, -630, -746, 1957, -460, -3922, 6664, 19701, 12576, -1983, -2498, 1997, 212, -1122, 452, 348, -392, 21, 163, -79, -27, 34, -4, -4, -9, 21, 13, -92, 66, 164, -327, -26, 698, -628, -748, 1955, -455, -3924, 6648, 19697, 12591, -1974, -2503, 1996, 215, -1123, 451, 349, -392, 21, 163, -78, -27, 34, -4, -4,
+ -9, 21, 13, -92, 66, 164, -326, -27, 699, -626, -750, 1954, -449, -3926, 6632, 19688, 12607, -1966, -2508, 1995, 219, -1124, 450, 350, -391, 20, 163, -78, -27, 34, -4, -4, -9, 21, 13, -91, 66, 165, -326, -28, 699, -625, -752, 1952, -444, -3928, 6615, 19686, 12622, -1957, -2513, 1993, 222, -1125, 449, 351, -391, 19, 163, -78, -27, 34, -4, -4,
+ -9, 21, 14, -91, 65, 165, -325, -29, 699, -623, -754, 1951, -438, -3931, 6599, 19680, 12638, -1948, -2519, 1992, 225, -1125, 447, 352, -391, 19, 163, -78, -27, 34, -4, -4, -9, 21, 14, -91, 65, 165, -325, -30, 699, -621, -756, 1950, -433, -3933, 6583, 19676, 12653, -1940, -2524, 1991, 228, -1126, 446, 353, -391, 18, 164, -78, -27, 34, -4, -4,
+ -9, 21, 14, -91, 65, 165, -325, -31, 699, -619, -758, 1948, -427, -3935, 6567, 19671, 12669, -1931, -2529, 1989, 231, -1127, 445, 354, -391, 18, 164, -78, -27, 34, -4, -4, -9, 21, 14, -91, 65, 166, -324, -32, 699, -618, -760, 1947, -422, -3937, 6550, 19668, 12684, -1923, -2534, 1988, 234, -1128, 444, 355, -391, 17, 164, -78, -27, 34, -4, -4,
+ -9, 21, 14, -91, 64, 166, -324, -33, 700, -616, -762, 1945, -416, -3939, 6534, 19663, 12700, -1914, -2539, 1987, 237, -1129, 443, 356, -391, 17, 164, -78, -28, 34, -4, -4, -9, 21, 14, -91, 64, 166, -323, -34, 700, -614, -764, 1944, -410, -3941, 6518, 19658, 12715, -1906, -2544, 1985, 240, -1129, 442, 357, -391, 16, 164, -78, -28, 34, -4, -4,
+ -9, 21, 14, -91, 64, 166, -323, -35, 700, -612, -766, 1942, -405, -3943, 6502, 19653, 12731, -1897, -2550, 1984, 243, -1130, 440, 358, -391, 16, 165, -77, -28, 34, -4, -4, -9, 21, 14, -91, 63, 167, -323, -36, 700, -611, -768, 1941, -399, -3945, 6486, 19649, 12746, -1888, -2555, 1983, 246, -1131, 439, 359, -391, 15, 165, -77, -28, 34, -4, -4,
+ -9, 21, 14, -91, 63, 167, -322, -37, 700, -609, -770, 1939, -394, -3947, 6469, 19647, 12761, -1880, -2560, 1981, 249, -1132, 438, 360, -391, 15, 165, -77, -28, 34, -4, -4, -9, 21, 14, -91, 63, 167, -322, -38, 700, -607, -772, 1938, -388, -3949, 6453, 19641, 12777, -1871, -2565, 1980, 252, -1133, 437, 361, -391, 14, 165, -77, -28, 34, -4, -4,
+ -9, 21, 14, -91, 63, 167, -321, -39, 701, -606, -774, 1937, -383, -3951, 6437, 19635, 12792, -1862, -2570, 1978, 255, -1133, 436, 362, -391, 14, 165, -77, -28, 34, -4, -4, -9, 21, 15, -91, 62, 168, -321, -40, 701, -604, -776, 1935, -377, -3953, 6421, 19628, 12808, -1853, -2575, 1977, 258, -1134, 434, 363, -390, 13, 166, -77, -28, 34, -4, -4,
+ -9, 21, 15, -91, 62, 168, -321, -41, 701, -602, -778, 1934, -372, -3955, 6405, 19626, 12823, -1845, -2581, 1976, 261, -1135, 433, 364, -390, 13, 166, -77, -29, 34, -4, -4, -9, 20, 15, -91, 62, 168, -320, -42, 701, -600, -780, 1932, -366, -3957, 6388, 19623, 12838, -1836, -2586, 1974, 265, -1136, 432, 365, -390, 12, 166, -77, -29, 34, -4, -4,
+ -9, 20, 15, -91, 61, 168, -320, -43, 701, -599, -782, 1931, -361, -3959, 6372, 19619, 12854, -1827, -2591, 1973, 268, -1137, 431, 366, -390, 12, 166, -77, -29, 34, -4, -4, -9, 20, 15, -91, 61, 168, -319, -44, 701, -597, -784, 1929, -355, -3961, 6356, 19612, 12869, -1818, -2596, 1971, 271, -1137, 430, 367, -390, 11, 167, -76, -29, 34, -4, -4,
+ -9, 20, 15, -91, 61, 169, -319, -44, 701, -595, -786, 1928, -350, -3963, 6340, 19607, 12884, -1810, -2601, 1970, 274, -1138, 428, 368, -390, 11, 167, -76, -29, 34, -4, -4, -9, 20, 15, -91, 61, 169, -319, -45, 701, -593, -788, 1926, -345, -3965, 6324, 19604, 12900, -1801, -2606, 1968, 277, -1139, 427, 369, -390, 10, 167, -76, -29, 34, -4, -4,
+ -9, 20, 15, -91, 60, 169, -318, -46, 702, -592, -790, 1924, -339, -3967, 6308, 19599, 12915, -1792, -2611, 1967, 280, -1140, 426, 370, -390, 10, 167, -76, -29, 34, -4, -4, -9, 20, 15, -91, 60, 169, -318, -47, 702, -590, -792, 1923, -334, -3969, 6291, 19596, 12930, -1783, -2616, 1965, 283, -1140, 425, 371, -390, 9, 167, -76, -29, 34, -4, -4,
+ -9, 20, 15, -91, 60, 170, -317, -48, 702, -588, -794, 1921, -328, -3970, 6275, 19587, 12946, -1774, -2621, 1964, 286, -1141, 424, 372, -390, 9, 168, -76, -30, 34, -4, -4, -9, 20, 15, -91, 59, 170, -317, -49, 702, -586, -796, 1920, -323, -3972, 6259, 19586, 12961, -1765, -2627, 1962, 289, -1142, 422, 373, -389, 8, 168, -76, -30, 34, -4, -4,
+ -9, 20, 15, -91, 59, 170, -317, -50, 702, -585, -798, 1918, -317, -3974, 6243, 19582, 12976, -1756, -2632, 1961, 292, -1143, 421, 374, -389, 8, 168, -76, -30, 34, -4, -4, -9, 20, 15, -91, 59, 170, -316, -51, 702, -583, -800, 1917, -312, -3976, 6227, 19576, 12992, -1747, -2637, 1959, 295, -1143, 420, 375, -389, 7, 168, -76, -30, 34, -4, -4,
+ -9, 20, 16, -91, 59, 171, -316, -52, 702, -581, -801, 1915, -306, -3978, 6211, 19568, 13007, -1739, -2642, 1958, 298, -1144, 419, 376, -389, 7, 168, -75, -30, 34, -4, -4, -9, 20, 16, -91, 58, 171, -315, -53, 702, -579, -803, 1914, -301, -3979, 6195, 19563, 13022, -1730, -2647, 1956, 301, -1145, 418, 377, -389, 6, 169, -75, -30, 34, -4, -4,
+ -9, 20, 16, -91, 58, 171, -315, -54, 703, -578, -805, 1912, -295, -3981, 6178, 19558, 13038, -1721, -2652, 1955, 305, -1146, 416, 378, -389, 6, 169, -75, -30, 34, -4, -4, -9, 20, 16, -90, 58, 171, -314, -55, 703, -576, -807, 1910, -290, -3983, 6162, 19553, 13053, -1712, -2657, 1953, 308, -1146, 415, 379, -389, 5, 169, -75, -30, 34, -4, -4,
+ -9, 20, 16, -90, 57, 172, -314, -56, 703, -574, -809, 1909, -284, -3984, 6146, 19547, 13068, -1703, -2662, 1952, 311, -1147, 414, 380, -389, 5, 169, -75, -31, 34, -4, -4, -9, 20, 16, -90, 57, 172, -314, -57, 703, -572, -811, 1907, -279, -3986, 6130, 19544, 13083, -1694, -2667, 1950, 314, -1148, 413, 381, -389, 4, 169, -75, -31, 34, -3, -4,
+ -9, 20, 16, -90, 57, 172, -313, -58, 703, -571, -813, 1906, -274, -3988, 6114, 19538, 13098, -1685, -2672, 1949, 317, -1148, 411, 382, -388, 3, 170, -75, -31, 34, -3, -4, -9, 20, 16, -90, 56, 172, -313, -59, 703, -569, -815, 1904, -268, -3989, 6098, 19532, 13114, -1675, -2677, 1947, 320, -1149, 410, 383, -388, 3, 170, -75, -31, 34, -3, -4,
+ -9, 20, 16, -90, 56, 172, -312, -60, 703, -567, -817, 1903, -263, -3991, 6082, 19527, 13129, -1666, -2682, 1945, 323, -1150, 409, 384, -388, 2, 170, -74, -31, 34, -3, -4, -9, 20, 16, -90, 56, 173, -312, -60, 703, -565, -819, 1901, -257, -3993, 6066, 19520, 13144, -1657, -2687, 1944, 326, -1151, 408, 385, -388, 2, 170, -74, -31, 34, -3, -4,
+ -9, 20, 16, -90, 56, 173, -312, -61, 703, -564, -820, 1899, -252, -3994, 6050, 19517, 13159, -1648, -2692, 1942, 329, -1151, 406, 386, -388, 1, 170, -74, -31, 34, -3, -4, -9, 20, 16, -90, 55, 173, -311, -62, 703, -562, -822, 1898, -246, -3996, 6034, 19510, 13174, -1639, -2697, 1941, 332, -1152, 405, 387, -388, 1, 171, -74, -31, 34, -3, -4,
+ -9, 19, 17, -90, 55, 173, -311, -63, 703, -560, -824, 1896, -241, -3997, 6017, 19507, 13190, -1630, -2702, 1939, 336, -1153, 404, 388, -388, 0, 171, -74, -32, 34, -3, -4, -9, 19, 17, -90, 55, 174, -310, -64, 704, -558, -826, 1894, -236, -3999, 6001, 19501, 13205, -1621, -2707, 1937, 339, -1153, 403, 389, -388, 0, 171, -74, -32, 34, -3, -5,
+ -9, 19, 17, -90, 54, 174, -310, -65, 704, -557, -828, 1893, -230, -4001, 5985, 19498, 13220, -1612, -2712, 1936, 342, -1154, 401, 390, -387, -1, 171, -74, -32, 34, -3, -5, -9, 19, 17, -90, 54, 174, -309, -66, 704, -555, -830, 1891, -225, -4002, 5969, 19492, 13235, -1602, -2717, 1934, 345, -1155, 400, 391, -387, -1, 171, -74, -32, 34, -3, -5,
+ -9, 19, 17, -90, 54, 174, -309, -67, 704, -553, -832, 1889, -219, -4004, 5953, 19487, 13250, -1593, -2722, 1932, 348, -1155, 399, 392, -387, -2, 171, -73, -32, 34, -3, -5, -9, 19, 17, -90, 54, 174, -309, -68, 704, -551, -834, 1888, -214, -4005, 5937, 19480, 13265, -1584, -2727, 1931, 351, -1156, 398, 393, -387, -2, 172, -73, -32, 34, -3, -5,
+ -9, 19, 17, -90, 53, 175, -308, -69, 704, -549, -835, 1886, -209, -4007, 5921, 19476, 13281, -1575, -2732, 1929, 354, -1157, 396, 394, -387, -3, 172, -73, -32, 34, -3, -5, -9, 19, 17, -90, 53, 175, -308, -70, 704, -548, -837, 1884, -203, -4008, 5905, 19470, 13296, -1565, -2737, 1927, 357, -1157, 395, 395, -387, -3, 172, -73, -32, 34, -3, -5,
+ -9, 19, 17, -90, 53, 175, -307, -71, 704, -546, -839, 1883, -198, -4010, 5889, 19466, 13311, -1556, -2742, 1926, 360, -1158, 394, 396, -387, -4, 172, -73, -33, 34, -3, -5, -9, 19, 17, -90, 52, 175, -307, -72, 704, -544, -841, 1881, -192, -4011, 5873, 19461, 13326, -1547, -2747, 1924, 363, -1159, 393, 397, -386, -4, 172, -73, -33, 34, -3, -5,
+ -9, 19, 17, -90, 52, 176, -306, -72, 704, -542, -843, 1879, -187, -4012, 5857, 19454, 13341, -1538, -2752, 1922, 367, -1159, 391, 397, -386, -5, 173, -73, -33, 34, -3, -5, -9, 19, 17, -90, 52, 176, -306, -73, 704, -541, -845, 1878, -182, -4014, 5841, 19449, 13356, -1528, -2757, 1921, 370, -1160, 390, 398, -386, -5, 173, -73, -33, 34, -3, -5,
+ -9, 19, 17, -90, 52, 176, -306, -74, 704, -539, -846, 1876, -176, -4015, 5825, 19443, 13371, -1519, -2762, 1919, 373, -1161, 389, 399, -386, -6, 173, -72, -33, 34, -3, -5, -9, 19, 18, -90, 51, 176, -305, -75, 704, -537, -848, 1874, -171, -4017, 5809, 19439, 13386, -1510, -2767, 1917, 376, -1161, 388, 400, -386, -7, 173, -72, -33, 34, -3, -5,
+ -9, 19, 18, -89, 51, 176, -305, -76, 704, -535, -850, 1873, -165, -4018, 5793, 19430, 13401, -1500, -2772, 1916, 379, -1162, 386, 401, -386, -7, 173, -72, -33, 35, -3, -5, -9, 19, 18, -89, 51, 177, -304, -77, 704, -534, -852, 1871, -160, -4019, 5777, 19425, 13416, -1491, -2777, 1914, 382, -1163, 385, 402, -386, -8, 174, -72, -33, 35, -3, -5,
+ -9, 19, 18, -89, 50, 177, -304, -78, 704, -532, -854, 1869, -155, -4021, 5761, 19421, 13431, -1481, -2782, 1912, 385, -1163, 384, 403, -385, -8, 174, -72, -34, 35, -3, -5, -9, 19, 18, -89, 50, 177, -303, -79, 704, -530, -855, 1867, -149, -4022, 5745, 19415, 13446, -1472, -2786, 1910, 388, -1164, 382, 404, -385, -9, 174, -72, -34, 35, -3, -5,
+ -9, 19, 18, -89, 50, 177, -303, -80, 704, -528, -857, 1866, -144, -4023, 5729, 19409, 13461, -1463, -2791, 1909, 391, -1165, 381, 405, -385, -9, 174, -72, -34, 35, -3, -5, -9, 19, 18, -89, 50, 177, -303, -81, 704, -526, -859, 1864, -139, -4024, 5713, 19404, 13476, -1453, -2796, 1907, 394, -1165, 380, 406, -385, -10, 174, -72, -34, 35, -3, -5,
+ -9, 19, 18, -89, 49, 178, -302, -82, 704, -525, -861, 1862, -133, -4026, 5697, 19397, 13491, -1444, -2801, 1905, 398, -1166, 379, 407, -385, -10, 175, -71, -34, 35, -3, -5, -9, 19, 18, -89, 49, 178, -302, -83, 705, -523, -863, 1860, -128, -4027, 5681, 19392, 13506, -1434, -2806, 1903, 401, -1166, 377, 408, -385, -11, 175, -71, -34, 35, -3, -5,
+ -9, 18, 18, -89, 49, 178, -301, -83, 705, -521, -864, 1859, -123, -4028, 5665, 19385, 13521, -1425, -2811, 1901, 404, -1167, 376, 409, -385, -11, 175, -71, -34, 35, -3, -5, -9, 18, 18, -89, 48, 178, -301, -84, 705, -519, -866, 1857, -117, -4029, 5649, 19379, 13536, -1415, -2816, 1900, 407, -1168, 375, 410, -384, -12, 175, -71, -34, 35, -3, -5,
+ -9, 18, 18, -89, 48, 178, -300, -85, 705, -517, -868, 1855, -112, -4031, 5633, 19376, 13551, -1406, -2821, 1898, 410, -1168, 373, 411, -384, -12, 175, -71, -35, 35, -3, -5, -9, 18, 18, -89, 48, 179, -300, -86, 705, -516, -870, 1853, -107, -4032, 5617, 19372, 13566, -1396, -2826, 1896, 413, -1169, 372, 412, -384, -13, 175, -71, -35, 35, -3, -5,
+ -9, 18, 19, -89, 48, 179, -299, -87, 705, -514, -872, 1852, -101, -4033, 5601, 19360, 13581, -1386, -2830, 1894, 416, -1169, 371, 413, -384, -13, 176, -71, -35, 35, -3, -5, -9, 18, 19, -89, 47, 179, -299, -88, 705, -512, -873, 1850, -96, -4034, 5585, 19357, 13596, -1377, -2835, 1892, 419, -1170, 369, 414, -384, -14, 176, -70, -35, 35, -3, -5,
+ -9, 18, 19, -89, 47, 179, -299, -89, 705, -510, -875, 1848, -91, -4035, 5570, 19351, 13611, -1367, -2840, 1890, 423, -1171, 368, 415, -384, -15, 176, -70, -35, 35, -3, -5, -9, 18, 19, -89, 47, 179, -298, -90, 705, -509, -877, 1846, -85, -4036, 5554, 19343, 13626, -1358, -2845, 1889, 426, -1171, 367, 416, -383, -15, 176, -70, -35, 35, -3, -5,
+ -9, 18, 19, -89, 47, 180, -298, -91, 705, -507, -879, 1844, -80, -4037, 5538, 19338, 13640, -1348, -2850, 1887, 429, -1172, 366, 417, -383, -16, 176, -70, -35, 35, -2, -5, -9, 18, 19, -89, 46, 180, -297, -92, 705, -505, -880, 1843, -75, -4038, 5522, 19330, 13655, -1338, -2855, 1885, 432, -1172, 364, 418, -383, -16, 177, -70, -35, 35, -2, -5,
+ -9, 18, 19, -89, 46, 180, -297, -92, 705, -503, -882, 1841, -69, -4040, 5506, 19326, 13670, -1329, -2859, 1883, 435, -1173, 363, 419, -383, -17, 177, -70, -36, 35, -2, -5, -9, 18, 19, -88, 46, 180, -296, -93, 705, -501, -884, 1839, -64, -4041, 5490, 19319, 13685, -1319, -2864, 1881, 438, -1174, 362, 420, -383, -17, 177, -70, -36, 35, -2, -5,
+ -9, 18, 19, -88, 45, 180, -296, -94, 705, -500, -885, 1837, -59, -4042, 5474, 19314, 13700, -1309, -2869, 1879, 441, -1174, 360, 421, -382, -18, 177, -69, -36, 35, -2, -5, -9, 18, 19, -88, 45, 181, -295, -95, 705, -498, -887, 1835, -53, -4043, 5458, 19306, 13715, -1299, -2874, 1877, 444, -1175, 359, 422, -382, -18, 177, -69, -36, 35, -2, -5,
+ -9, 18, 19, -88, 45, 181, -295, -96, 705, -496, -889, 1833, -48, -4044, 5442, 19303, 13730, -1290, -2879, 1875, 447, -1175, 358, 422, -382, -19, 177, -69, -36, 35, -2, -5, -9, 18, 19, -88, 45, 181, -295, -97, 705, -494, -891, 1832, -43, -4045, 5426, 19296, 13744, -1280, -2883, 1873, 451, -1176, 356, 423, -382, -19, 178, -69, -36, 35, -2, -5,
+ -9, 18, 19, -88, 44, 181, -294, -98, 705, -492, -892, 1830, -38, -4046, 5411, 19289, 13759, -1270, -2888, 1871, 454, -1176, 355, 424, -382, -20, 178, -69, -36, 35, -2, -5, -9, 18, 20, -88, 44, 181, -294, -99, 704, -491, -894, 1828, -32, -4047, 5395, 19284, 13774, -1260, -2893, 1870, 457, -1177, 354, 425, -382, -21, 178, -69, -36, 35, -2, -5,
+ -9, 18, 20, -88, 44, 182, -293, -100, 704, -489, -896, 1826, -27, -4048, 5379, 19278, 13789, -1251, -2898, 1868, 460, -1177, 352, 426, -381, -21, 178, -69, -37, 35, -2, -5, -9, 18, 20, -88, 43, 182, -293, -101, 704, -487, -897, 1824, -22, -4048, 5363, 19273, 13804, -1241, -2903, 1866, 463, -1178, 351, 427, -381, -22, 178, -69, -37, 35, -2, -5,
+ -9, 18, 20, -88, 43, 182, -292, -101, 704, -485, -899, 1822, -16, -4049, 5347, 19263, 13818, -1231, -2907, 1864, 466, -1178, 350, 428, -381, -22, 178, -68, -37, 35, -2, -5, -9, 18, 20, -88, 43, 182, -292, -102, 704, -483, -901, 1821, -11, -4050, 5331, 19258, 13833, -1221, -2912, 1862, 469, -1179, 348, 429, -381, -23, 179, -68, -37, 35, -2, -5,
+ -9, 17, 20, -88, 43, 182, -291, -103, 704, -482, -903, 1819, -6, -4051, 5316, 19253, 13848, -1211, -2917, 1860, 472, -1180, 347, 430, -381, -23, 179, -68, -37, 35, -2, -5, -9, 17, 20, -88, 42, 182, -291, -104, 704, -480, -904, 1817, -1, -4052, 5300, 19246, 13863, -1201, -2922, 1858, 476, -1180, 346, 431, -380, -24, 179, -68, -37, 35, -2, -5,
+ -9, 17, 20, -88, 42, 183, -290, -105, 704, -478, -906, 1815, 5, -4053, 5284, 19239, 13877, -1191, -2926, 1856, 479, -1181, 344, 432, -380, -24, 179, -68, -37, 35, -2, -5, -9, 17, 20, -88, 42, 183, -290, -106, 704, -476, -908, 1813, 10, -4054, 5268, 19234, 13892, -1181, -2931, 1854, 482, -1181, 343, 433, -380, -25, 179, -68, -37, 35, -2, -5,
+ -9, 17, 20, -88, 41, 183, -290, -107, 704, -475, -909, 1811, 15, -4055, 5252, 19231, 13907, -1172, -2936, 1852, 485, -1182, 342, 434, -380, -25, 180, -68, -38, 35, -2, -5, -9, 17, 20, -88, 41, 183, -289, -108, 704, -473, -911, 1809, 20, -4055, 5237, 19223, 13921, -1162, -2940, 1850, 488, -1182, 340, 435, -380, -26, 180, -67, -38, 35, -2, -5,
+ -9, 17, 20, -88, 41, 183, -289, -109, 704, -471, -913, 1807, 26, -4056, 5221, 19216, 13936, -1152, -2945, 1848, 491, -1183, 339, 436, -379, -26, 180, -67, -38, 35, -2, -5, -9, 17, 20, -87, 41, 184, -288, -109, 704, -469, -914, 1805, 31, -4057, 5205, 19207, 13951, -1142, -2950, 1846, 494, -1183, 337, 437, -379, -27, 180, -67, -38, 35, -2, -5,
+ -9, 17, 20, -87, 40, 184, -288, -110, 704, -467, -916, 1803, 36, -4058, 5189, 19204, 13965, -1132, -2954, 1844, 497, -1184, 336, 438, -379, -28, 180, -67, -38, 35, -2, -5, -9, 17, 21, -87, 40, 184, -287, -111, 704, -466, -918, 1802, 41, -4058, 5173, 19195, 13980, -1122, -2959, 1842, 501, -1184, 335, 438, -379, -28, 180, -67, -38, 35, -2, -5,
+ -9, 17, 21, -87, 40, 184, -287, -112, 704, -464, -919, 1800, 46, -4059, 5158, 19190, 13995, -1112, -2964, 1839, 504, -1185, 333, 439, -379, -29, 181, -67, -38, 35, -2, -5, -9, 17, 21, -87, 39, 184, -286, -113, 704, -462, -921, 1798, 52, -4060, 5142, 19183, 14009, -1102, -2969, 1837, 507, -1185, 332, 440, -378, -29, 181, -66, -39, 35, -2, -5,
+ -9, 17, 21, -87, 39, 184, -286, -114, 704, -460, -922, 1796, 57, -4061, 5126, 19176, 14024, -1091, -2973, 1835, 510, -1186, 331, 441, -378, -30, 181, -66, -39, 35, -2, -5, -9, 17, 21, -87, 39, 185, -285, -115, 704, -458, -924, 1794, 62, -4061, 5110, 19169, 14038, -1081, -2978, 1833, 513, -1186, 329, 442, -378, -30, 181, -66, -39, 35, -2, -5,
+ -9, 17, 21, -87, 39, 185, -285, -116, 704, -457, -926, 1792, 67, -4062, 5095, 19163, 14053, -1071, -2982, 1831, 516, -1186, 328, 443, -378, -31, 181, -66, -39, 35, -2, -5, -9, 17, 21, -87, 38, 185, -284, -116, 704, -455, -927, 1790, 72, -4063, 5079, 19155, 14068, -1061, -2987, 1829, 519, -1187, 327, 444, -377, -31, 181, -66, -39, 35, -2, -5,
+ -9, 17, 21, -87, 38, 185, -284, -117, 703, -453, -929, 1788, 78, -4063, 5063, 19150, 14082, -1051, -2992, 1827, 522, -1187, 325, 445, -377, -32, 182, -66, -39, 35, -2, -5, -9, 17, 21, -87, 38, 185, -283, -118, 703, -451, -931, 1786, 83, -4064, 5047, 19142, 14097, -1041, -2996, 1825, 526, -1188, 324, 446, -377, -32, 182, -66, -39, 35, -2, -5,
+ -9, 17, 21, -87, 37, 186, -283, -119, 703, -449, -932, 1784, 88, -4064, 5032, 19135, 14111, -1031, -3001, 1823, 529, -1188, 322, 447, -377, -33, 182, -65, -39, 35, -2, -5, -9, 17, 21, -87, 37, 186, -283, -120, 703, -447, -934, 1782, 93, -4065, 5016, 19132, 14126, -1021, -3006, 1821, 532, -1189, 321, 448, -377, -34, 182, -65, -40, 35, -2, -5,
+ -9, 17, 21, -87, 37, 186, -282, -121, 703, -446, -935, 1780, 98, -4066, 5000, 19124, 14140, -1010, -3010, 1818, 535, -1189, 320, 449, -376, -34, 182, -65, -40, 35, -2, -5, -9, 17, 21, -87, 37, 186, -282, -122, 703, -444, -937, 1778, 104, -4066, 4985, 19117, 14155, -1000, -3015, 1816, 538, -1190, 318, 450, -376, -35, 182, -65, -40, 35, -1, -5,
+ -9, 16, 21, -87, 36, 186, -281, -122, 703, -442, -939, 1776, 109, -4067, 4969, 19110, 14169, -990, -3019, 1814, 541, -1190, 317, 451, -376, -35, 183, -65, -40, 35, -1, -5, -9, 16, 21, -87, 36, 186, -281, -123, 703, -440, -940, 1774, 114, -4067, 4953, 19106, 14184, -980, -3024, 1812, 544, -1191, 315, 451, -376, -36, 183, -65, -40, 35, -1, -5,
+ -9, 16, 22, -86, 36, 187, -280, -124, 703, -438, -942, 1772, 119, -4068, 4938, 19094, 14198, -969, -3029, 1810, 547, -1191, 314, 452, -375, -36, 183, -65, -40, 35, -1, -5, -9, 16, 22, -86, 35, 187, -280, -125, 703, -437, -943, 1770, 124, -4068, 4922, 19086, 14213, -959, -3033, 1808, 551, -1191, 313, 453, -375, -37, 183, -64, -40, 35, -1, -5,
+ -9, 16, 22, -86, 35, 187, -279, -126, 703, -435, -945, 1768, 129, -4069, 4906, 19083, 14227, -949, -3038, 1805, 554, -1192, 311, 454, -375, -37, 183, -64, -40, 35, -1, -5, -9, 16, 22, -86, 35, 187, -279, -127, 702, -433, -946, 1766, 135, -4069, 4891, 19075, 14242, -939, -3042, 1803, 557, -1192, 310, 455, -375, -38, 183, -64, -41, 35, -1, -5,
+ -9, 16, 22, -86, 35, 187, -278, -128, 702, -431, -948, 1764, 140, -4070, 4875, 19070, 14256, -928, -3047, 1801, 560, -1193, 308, 456, -374, -39, 183, -64, -41, 35, -1, -5, -9, 16, 22, -86, 34, 187, -278, -128, 702, -429, -950, 1762, 145, -4070, 4859, 19062, 14270, -918, -3051, 1799, 563, -1193, 307, 457, -374, -39, 184, -64, -41, 35, -1, -5,
+ -9, 16, 22, -86, 34, 187, -277, -129, 702, -428, -951, 1760, 150, -4071, 4844, 19055, 14285, -908, -3056, 1797, 566, -1193, 306, 458, -374, -40, 184, -64, -41, 35, -1, -5, -9, 16, 22, -86, 34, 188, -277, -130, 702, -426, -953, 1758, 155, -4071, 4828, 19048, 14299, -897, -3060, 1794, 569, -1194, 304, 459, -374, -40, 184, -63, -41, 35, -1, -5,
+ -9, 16, 22, -86, 34, 188, -276, -131, 702, -424, -954, 1756, 160, -4071, 4813, 19038, 14314, -887, -3065, 1792, 572, -1194, 303, 460, -373, -41, 184, -63, -41, 35, -1, -5, -9, 16, 22, -86, 33, 188, -276, -132, 702, -422, -956, 1754, 165, -4072, 4797, 19033, 14328, -876, -3069, 1790, 576, -1195, 301, 461, -373, -41, 184, -63, -41, 35, -1, -5,
+ -9, 16, 22, -86, 33, 188, -275, -133, 702, -420, -957, 1752, 170, -4072, 4781, 19026, 14342, -866, -3074, 1788, 579, -1195, 300, 462, -373, -42, 184, -63, -41, 35, -1, -5, -9, 16, 22, -86, 33, 188, -275, -134, 702, -419, -959, 1750, 176, -4072, 4766, 19019, 14357, -856, -3078, 1785, 582, -1195, 299, 462, -373, -42, 185, -63, -42, 35, -1, -5,
+ -9, 16, 22, -86, 32, 188, -274, -134, 701, -417, -960, 1748, 181, -4073, 4750, 19015, 14371, -845, -3083, 1783, 585, -1196, 297, 463, -373, -43, 185, -63, -42, 35, -1, -5, -9, 16, 22, -86, 32, 189, -274, -135, 701, -415, -962, 1746, 186, -4073, 4735, 19006, 14385, -835, -3087, 1781, 588, -1196, 296, 464, -372, -44, 185, -63, -42, 35, -1, -5,
+ -9, 16, 23, -86, 32, 189, -273, -136, 701, -413, -963, 1743, 191, -4073, 4719, 18997, 14400, -824, -3092, 1779, 591, -1197, 294, 465, -372, -44, 185, -62, -42, 35, -1, -5, -9, 16, 23, -85, 32, 189, -273, -137, 701, -411, -965, 1741, 196, -4074, 4704, 18991, 14414, -814, -3096, 1776, 594, -1197, 293, 466, -372, -45, 185, -62, -42, 35, -1, -5,
+ -9, 16, 23, -85, 31, 189, -272, -138, 701, -409, -966, 1739, 201, -4074, 4688, 18983, 14428, -803, -3101, 1774, 597, -1197, 291, 467, -371, -45, 185, -62, -42, 35, -1, -5, -9, 16, 23, -85, 31, 189, -272, -139, 701, -408, -968, 1737, 206, -4074, 4672, 18977, 14443, -793, -3105, 1772, 601, -1198, 290, 468, -371, -46, 185, -62, -42, 35, -1, -5,
+ -9, 16, 23, -85, 31, 189, -272, -140, 701, -406, -969, 1735, 211, -4074, 4657, 18968, 14457, -782, -3110, 1769, 604, -1198, 289, 469, -371, -46, 186, -62, -42, 35, -1, -5, -9, 16, 23, -85, 30, 190, -271, -140, 700, -404, -971, 1733, 216, -4075, 4641, 18963, 14471, -771, -3114, 1767, 607, -1198, 287, 470, -371, -47, 186, -62, -43, 35, -1, -5,
+ -9, 15, 23, -85, 30, 190, -271, -141, 700, -402, -972, 1731, 221, -4075, 4626, 18955, 14485, -761, -3119, 1765, 610, -1199, 286, 471, -370, -47, 186, -61, -43, 35, -1, -5, -9, 15, 23, -85, 30, 190, -270, -142, 700, -400, -974, 1729, 226, -4075, 4610, 18950, 14500, -750, -3123, 1762, 613, -1199, 284, 471, -370, -48, 186, -61, -43, 35, -1, -6,
+ -9, 15, 23, -85, 30, 190, -270, -143, 700, -399, -975, 1727, 232, -4075, 4595, 18943, 14514, -740, -3128, 1760, 616, -1199, 283, 472, -370, -49, 186, -61, -43, 35, -1, -6, -9, 15, 23, -85, 29, 190, -269, -144, 700, -397, -977, 1725, 237, -4075, 4579, 18937, 14528, -729, -3132, 1758, 619, -1200, 281, 473, -370, -49, 186, -61, -43, 35, -1, -6,
+ -9, 15, 23, -85, 29, 190, -269, -145, 700, -395, -978, 1722, 242, -4076, 4564, 18929, 14542, -718, -3136, 1755, 622, -1200, 280, 474, -369, -50, 187, -61, -43, 35, -1, -6, -9, 15, 23, -85, 29, 190, -268, -145, 700, -393, -980, 1720, 247, -4076, 4548, 18920, 14556, -708, -3141, 1753, 626, -1200, 279, 475, -369, -50, 187, -61, -43, 35, -1, -6,
+ -9, 15, 23, -85, 29, 191, -268, -146, 699, -391, -981, 1718, 252, -4076, 4533, 18912, 14571, -697, -3145, 1750, 629, -1201, 277, 476, -369, -51, 187, -60, -43, 35, -1, -6, -9, 15, 23, -85, 28, 191, -267, -147, 699, -389, -983, 1716, 257, -4076, 4517, 18906, 14585, -686, -3150, 1748, 632, -1201, 276, 477, -369, -51, 187, -60, -44, 35, -1, -6,
+ -9, 15, 23, -85, 28, 191, -267, -148, 699, -388, -984, 1714, 262, -4076, 4502, 18899, 14599, -676, -3154, 1746, 635, -1201, 274, 478, -368, -52, 187, -60, -44, 35, -1, -6, -9, 15, 23, -85, 28, 191, -266, -149, 699, -386, -986, 1712, 267, -4076, 4486, 18891, 14613, -665, -3158, 1743, 638, -1202, 273, 479, -368, -52, 187, -60, -44, 35, 0, -6,
+ -9, 15, 24, -84, 27, 191, -266, -150, 699, -384, -987, 1710, 272, -4076, 4471, 18884, 14627, -654, -3163, 1741, 641, -1202, 271, 479, -368, -53, 187, -60, -44, 35, 0, -6, -9, 15, 24, -84, 27, 191, -265, -150, 699, -382, -989, 1708, 277, -4076, 4456, 18873, 14641, -643, -3167, 1738, 644, -1202, 270, 480, -367, -54, 188, -60, -44, 35, 0, -6,
+ -9, 15, 24, -84, 27, 191, -265, -151, 698, -380, -990, 1705, 282, -4076, 4440, 18868, 14655, -633, -3171, 1736, 647, -1202, 268, 481, -367, -54, 188, -60, -44, 35, 0, -6, -9, 15, 24, -84, 27, 192, -264, -152, 698, -379, -991, 1703, 287, -4076, 4425, 18858, 14669, -622, -3176, 1734, 651, -1203, 267, 482, -367, -55, 188, -59, -44, 35, 0, -6,
+ -9, 15, 24, -84, 26, 192, -264, -153, 698, -377, -993, 1701, 292, -4076, 4409, 18853, 14683, -611, -3180, 1731, 654, -1203, 265, 483, -367, -55, 188, -59, -44, 35, 0, -6, -9, 15, 24, -84, 26, 192, -263, -154, 698, -375, -994, 1699, 297, -4076, 4394, 18843, 14697, -600, -3184, 1729, 657, -1203, 264, 484, -366, -56, 188, -59, -45, 35, 0, -6,
+ -9, 15, 24, -84, 26, 192, -263, -155, 698, -373, -996, 1697, 302, -4076, 4378, 18837, 14712, -589, -3189, 1726, 660, -1204, 263, 485, -366, -56, 188, -59, -45, 35, 0, -6, -9, 15, 24, -84, 26, 192, -262, -155, 697, -371, -997, 1694, 307, -4076, 4363, 18830, 14726, -579, -3193, 1724, 663, -1204, 261, 486, -366, -57, 188, -59, -45, 35, 0, -6,
+ -9, 15, 24, -84, 25, 192, -262, -156, 697, -369, -998, 1692, 312, -4076, 4348, 18820, 14740, -568, -3197, 1721, 666, -1204, 260, 487, -365, -57, 189, -59, -45, 35, 0, -6, -9, 15, 24, -84, 25, 192, -261, -157, 697, -368, -1000, 1690, 317, -4076, 4332, 18815, 14754, -557, -3202, 1719, 669, -1204, 258, 487, -365, -58, 189, -58, -45, 35, 0, -6,
+ -9, 15, 24, -84, 25, 192, -261, -158, 697, -366, -1001, 1688, 322, -4076, 4317, 18808, 14768, -546, -3206, 1716, 672, -1205, 257, 488, -365, -59, 189, -58, -45, 35, 0, -6, -9, 15, 24, -84, 24, 193, -260, -159, 697, -364, -1003, 1686, 327, -4076, 4302, 18798, 14782, -535, -3210, 1714, 676, -1205, 255, 489, -365, -59, 189, -58, -45, 35, 0, -6,
+ -9, 14, 24, -84, 24, 193, -260, -159, 696, -362, -1004, 1684, 332, -4076, 4286, 18791, 14796, -524, -3214, 1711, 679, -1205, 254, 490, -364, -60, 189, -58, -45, 35, 0, -6, -9, 14, 24, -84, 24, 193, -259, -160, 696, -360, -1005, 1681, 337, -4076, 4271, 18784, 14810, -513, -3219, 1709, 682, -1205, 252, 491, -364, -60, 189, -58, -46, 35, 0, -6,
+ -9, 14, 24, -83, 24, 193, -259, -161, 696, -359, -1007, 1679, 342, -4075, 4256, 18778, 14823, -502, -3223, 1706, 685, -1206, 251, 492, -364, -61, 189, -58, -46, 35, 0, -6, -9, 14, 24, -83, 23, 193, -258, -162, 696, -357, -1008, 1677, 347, -4075, 4240, 18768, 14837, -491, -3227, 1704, 688, -1206, 249, 493, -363, -61, 189, -57, -46, 35, 0, -6,
+ -9, 14, 25, -83, 23, 193, -258, -163, 696, -355, -1010, 1675, 352, -4075, 4225, 18759, 14851, -480, -3231, 1701, 691, -1206, 248, 494, -363, -62, 190, -57, -46, 35, 0, -6, -9, 14, 25, -83, 23, 193, -257, -163, 695, -353, -1011, 1672, 356, -4075, 4210, 18754, 14865, -469, -3236, 1699, 694, -1206, 246, 494, -363, -63, 190, -57, -46, 35, 0, -6,
+ -9, 14, 25, -83, 22, 193, -257, -164, 695, -351, -1012, 1670, 361, -4075, 4194, 18747, 14879, -458, -3240, 1696, 697, -1207, 245, 495, -362, -63, 190, -57, -46, 35, 0, -6, -9, 14, 25, -83, 22, 194, -256, -165, 695, -349, -1014, 1668, 366, -4075, 4179, 18739, 14893, -447, -3244, 1693, 700, -1207, 243, 496, -362, -64, 190, -57, -46, 35, 0, -6,
+ -9, 14, 25, -83, 22, 194, -256, -166, 695, -348, -1015, 1666, 371, -4074, 4164, 18727, 14907, -436, -3248, 1691, 704, -1207, 242, 497, -362, -64, 190, -56, -46, 35, 0, -6, -9, 14, 25, -83, 22, 194, -255, -167, 695, -346, -1016, 1663, 376, -4074, 4148, 18721, 14921, -425, -3252, 1688, 707, -1207, 240, 498, -361, -65, 190, -56, -47, 35, 0, -6,
+ -9, 14, 25, -83, 21, 194, -255, -168, 694, -344, -1018, 1661, 381, -4074, 4133, 18716, 14935, -414, -3257, 1686, 710, -1208, 239, 499, -361, -65, 190, -56, -47, 35, 0, -6, -9, 14, 25, -83, 21, 194, -254, -168, 694, -342, -1019, 1659, 386, -4074, 4118, 18707, 14948, -403, -3261, 1683, 713, -1208, 237, 500, -361, -66, 191, -56, -47, 35, 0, -6,
+ -9, 14, 25, -83, 21, 194, -254, -169, 694, -340, -1020, 1657, 391, -4073, 4103, 18698, 14962, -392, -3265, 1680, 716, -1208, 236, 500, -361, -66, 191, -56, -47, 35, 0, -6, -9, 14, 25, -83, 21, 194, -253, -170, 694, -339, -1022, 1654, 396, -4073, 4087, 18692, 14976, -381, -3269, 1678, 719, -1208, 234, 501, -360, -67, 191, -56, -47, 35, 0, -6,
+ -9, 14, 25, -83, 20, 194, -253, -171, 693, -337, -1023, 1652, 401, -4073, 4072, 18685, 14990, -370, -3273, 1675, 722, -1208, 233, 502, -360, -68, 191, -55, -47, 35, 0, -6, -9, 14, 25, -82, 20, 195, -252, -172, 693, -335, -1024, 1650, 406, -4072, 4057, 18672, 15004, -358, -3277, 1673, 725, -1209, 231, 503, -360, -68, 191, -55, -47, 35, 0, -6,
+ -9, 14, 25, -82, 20, 195, -252, -172, 693, -333, -1026, 1648, 411, -4072, 4042, 18663, 15017, -347, -3281, 1670, 729, -1209, 230, 504, -359, -69, 191, -55, -47, 35, 0, -6, -9, 14, 25, -82, 20, 195, -251, -173, 693, -331, -1027, 1645, 415, -4072, 4027, 18657, 15031, -336, -3286, 1667, 732, -1209, 228, 505, -359, -69, 191, -55, -48, 35, 1, -6,
+ -9, 14, 25, -82, 19, 195, -251, -174, 692, -329, -1028, 1643, 420, -4071, 4011, 18650, 15045, -325, -3290, 1665, 735, -1209, 227, 506, -359, -70, 191, -55, -48, 35, 1, -6, -9, 14, 25, -82, 19, 195, -250, -175, 692, -328, -1030, 1641, 425, -4071, 3996, 18642, 15059, -314, -3294, 1662, 738, -1209, 225, 506, -358, -70, 192, -55, -48, 35, 1, -6,
+ -9, 14, 25, -82, 19, 195, -250, -175, 692, -326, -1031, 1638, 430, -4070, 3981, 18632, 15072, -302, -3298, 1659, 741, -1209, 224, 507, -358, -71, 192, -54, -48, 35, 1, -6, -9, 14, 26, -82, 18, 195, -249, -176, 692, -324, -1032, 1636, 435, -4070, 3966, 18624, 15086, -291, -3302, 1657, 744, -1210, 222, 508, -358, -72, 192, -54, -48, 35, 1, -6,
+ -9, 13, 26, -82, 18, 195, -249, -177, 691, -322, -1034, 1634, 440, -4070, 3951, 18617, 15100, -280, -3306, 1654, 747, -1210, 221, 509, -357, -72, 192, -54, -48, 35, 1, -6, -9, 13, 26, -82, 18, 196, -248, -178, 691, -320, -1035, 1632, 445, -4069, 3936, 18608, 15113, -269, -3310, 1651, 750, -1210, 219, 510, -357, -73, 192, -54, -48, 35, 1, -6,
+ -9, 13, 26, -82, 18, 196, -247, -179, 691, -318, -1036, 1629, 449, -4069, 3920, 18599, 15127, -257, -3314, 1649, 753, -1210, 218, 511, -357, -73, 192, -54, -48, 35, 1, -6, -9, 13, 26, -82, 17, 196, -247, -179, 691, -317, -1037, 1627, 454, -4068, 3905, 18593, 15141, -246, -3318, 1646, 756, -1210, 216, 511, -356, -74, 192, -54, -49, 35, 1, -6,
+ -9, 13, 26, -82, 17, 196, -246, -180, 690, -315, -1039, 1625, 459, -4068, 3890, 18584, 15154, -235, -3322, 1643, 760, -1210, 215, 512, -356, -74, 192, -53, -49, 35, 1, -6, -9, 13, 26, -81, 17, 196, -246, -181, 690, -313, -1040, 1622, 464, -4067, 3875, 18575, 15168, -223, -3326, 1640, 763, -1211, 213, 513, -356, -75, 193, -53, -49, 35, 1, -6,
+ -9, 13, 26, -81, 17, 196, -245, -182, 690, -311, -1041, 1620, 469, -4067, 3860, 18565, 15181, -212, -3330, 1638, 766, -1211, 212, 514, -355, -76, 193, -53, -49, 35, 1, -6, -9, 13, 26, -81, 16, 196, -245, -183, 690, -309, -1042, 1618, 474, -4066, 3845, 18557, 15195, -201, -3334, 1635, 769, -1211, 210, 515, -355, -76, 193, -53, -49, 35, 1, -6,
+ -9, 13, 26, -81, 16, 196, -244, -183, 689, -308, -1044, 1615, 478, -4066, 3830, 18551, 15209, -189, -3338, 1632, 772, -1211, 209, 516, -355, -77, 193, -53, -49, 35, 1, -6, -9, 13, 26, -81, 16, 196, -244, -184, 689, -306, -1045, 1613, 483, -4065, 3815, 18543, 15222, -178, -3343, 1629, 775, -1211, 207, 516, -354, -77, 193, -52, -49, 35, 1, -6,
+ -9, 13, 26, -81, 15, 196, -243, -185, 689, -304, -1046, 1611, 488, -4064, 3800, 18533, 15236, -166, -3347, 1627, 778, -1211, 205, 517, -354, -78, 193, -52, -49, 35, 1, -6, -9, 13, 26, -81, 15, 197, -243, -186, 689, -302, -1047, 1608, 493, -4064, 3784, 18526, 15249, -155, -3350, 1624, 781, -1211, 204, 518, -354, -78, 193, -52, -50, 35, 1, -6,
+ -9, 13, 26, -81, 15, 197, -242, -186, 688, -300, -1049, 1606, 498, -4063, 3769, 18517, 15263, -144, -3354, 1621, 784, -1211, 202, 519, -353, -79, 193, -52, -50, 35, 1, -6, -9, 13, 26, -81, 15, 197, -242, -187, 688, -298, -1050, 1603, 502, -4063, 3754, 18509, 15276, -132, -3358, 1618, 788, -1211, 201, 520, -353, -79, 193, -52, -50, 35, 1, -6,
+ -9, 13, 26, -81, 14, 197, -241, -188, 688, -297, -1051, 1601, 507, -4062, 3739, 18501, 15290, -121, -3362, 1615, 791, -1212, 199, 521, -352, -80, 194, -52, -50, 35, 1, -6, -9, 13, 26, -81, 14, 197, -241, -189, 687, -295, -1052, 1599, 512, -4061, 3724, 18492, 15303, -109, -3366, 1613, 794, -1212, 198, 521, -352, -81, 194, -51, -50, 35, 1, -6,
+ -9, 13, 26, -81, 14, 197, -240, -190, 687, -293, -1054, 1596, 517, -4061, 3709, 18485, 15317, -98, -3370, 1610, 797, -1212, 196, 522, -352, -81, 194, -51, -50, 35, 1, -6, -9, 13, 27, -81, 14, 197, -240, -190, 687, -291, -1055, 1594, 521, -4060, 3694, 18474, 15330, -86, -3374, 1607, 800, -1212, 195, 523, -351, -82, 194, -51, -50, 35, 1, -6,
+ -9, 13, 27, -80, 13, 197, -239, -191, 687, -289, -1056, 1592, 526, -4059, 3679, 18464, 15344, -75, -3378, 1604, 803, -1212, 193, 524, -351, -82, 194, -51, -50, 35, 1, -6, -9, 13, 27, -80, 13, 197, -239, -192, 686, -288, -1057, 1589, 531, -4059, 3664, 18460, 15357, -63, -3382, 1601, 806, -1212, 192, 525, -351, -83, 194, -51, -51, 35, 1, -6,
+ -9, 13, 27, -80, 13, 197, -238, -193, 686, -286, -1058, 1587, 536, -4058, 3649, 18446, 15371, -51, -3386, 1599, 809, -1212, 190, 526, -350, -83, 194, -50, -51, 35, 1, -6, -9, 13, 27, -80, 13, 198, -238, -193, 686, -284, -1060, 1584, 540, -4057, 3634, 18441, 15384, -40, -3390, 1596, 812, -1212, 188, 526, -350, -84, 194, -50, -51, 35, 1, -6,
+ -9, 13, 27, -80, 12, 198, -237, -194, 685, -282, -1061, 1582, 545, -4057, 3619, 18434, 15397, -28, -3394, 1593, 815, -1212, 187, 527, -350, -85, 194, -50, -51, 35, 1, -6, -9, 12, 27, -80, 12, 198, -237, -195, 685, -280, -1062, 1580, 550, -4056, 3604, 18424, 15411, -17, -3398, 1590, 818, -1212, 185, 528, -349, -85, 195, -50, -51, 35, 1, -6,
+ -9, 12, 27, -80, 12, 198, -236, -196, 685, -278, -1063, 1577, 555, -4055, 3589, 18414, 15424, -5, -3402, 1587, 822, -1212, 184, 529, -349, -86, 195, -50, -51, 35, 1, -6, -9, 12, 27, -80, 11, 198, -236, -196, 684, -277, -1064, 1575, 559, -4054, 3574, 18405, 15437, 7, -3405, 1584, 825, -1212, 182, 530, -348, -86, 195, -50, -51, 35, 2, -6,
+ -9, 12, 27, -80, 11, 198, -235, -197, 684, -275, -1066, 1572, 564, -4053, 3560, 18396, 15451, 18, -3409, 1581, 828, -1212, 181, 530, -348, -87, 195, -49, -51, 35, 2, -6, -9, 12, 27, -80, 11, 198, -234, -198, 684, -273, -1067, 1570, 569, -4053, 3545, 18388, 15464, 30, -3413, 1578, 831, -1212, 179, 531, -348, -87, 195, -49, -52, 35, 2, -6,
+ -9, 12, 27, -80, 11, 198, -234, -199, 683, -271, -1068, 1568, 573, -4052, 3530, 18381, 15477, 42, -3417, 1575, 834, -1213, 178, 532, -347, -88, 195, -49, -52, 35, 2, -6, -9, 12, 27, -79, 10, 198, -233, -199, 683, -269, -1069, 1565, 578, -4051, 3515, 18371, 15491, 53, -3421, 1573, 837, -1213, 176, 533, -347, -89, 195, -49, -52, 35, 2, -6,
+ -9, 12, 27, -79, 10, 198, -233, -200, 683, -267, -1070, 1563, 583, -4050, 3500, 18362, 15504, 65, -3425, 1570, 840, -1213, 174, 534, -347, -89, 195, -49, -52, 35, 2, -6, -9, 12, 27, -79, 10, 198, -232, -201, 682, -266, -1071, 1560, 588, -4049, 3485, 18353, 15517, 77, -3428, 1567, 843, -1213, 173, 534, -346, -90, 195, -48, -52, 35, 2, -6,
+ -9, 12, 27, -79, 10, 199, -232, -202, 682, -264, -1072, 1558, 592, -4048, 3470, 18344, 15530, 88, -3432, 1564, 846, -1213, 171, 535, -346, -90, 196, -48, -52, 35, 2, -6, -9, 12, 27, -79, 9, 199, -231, -202, 682, -262, -1074, 1555, 597, -4047, 3455, 18334, 15544, 100, -3436, 1561, 849, -1213, 170, 536, -345, -91, 196, -48, -52, 35, 2, -6,
+ -9, 12, 27, -79, 9, 199, -231, -203, 681, -260, -1075, 1553, 602, -4047, 3440, 18327, 15557, 112, -3440, 1558, 852, -1213, 168, 537, -345, -91, 196, -48, -52, 35, 2, -6, -9, 12, 27, -79, 9, 199, -230, -204, 681, -258, -1076, 1550, 606, -4046, 3426, 18319, 15570, 124, -3444, 1555, 855, -1213, 167, 538, -345, -92, 196, -48, -53, 35, 2, -6,
+ -9, 12, 28, -79, 9, 199, -230, -205, 681, -257, -1077, 1548, 611, -4045, 3411, 18308, 15583, 136, -3447, 1552, 859, -1213, 165, 538, -344, -93, 196, -47, -53, 35, 2, -6, -9, 12, 28, -79, 8, 199, -229, -205, 680, -255, -1078, 1546, 616, -4044, 3396, 18300, 15596, 147, -3451, 1549, 862, -1213, 163, 539, -344, -93, 196, -47, -53, 35, 2, -6,
+ -9, 12, 28, -79, 8, 199, -229, -206, 680, -253, -1079, 1543, 620, -4043, 3381, 18291, 15610, 159, -3455, 1546, 865, -1213, 162, 540, -343, -94, 196, -47, -53, 35, 2, -6, -9, 12, 28, -79, 8, 199, -228, -207, 680, -251, -1080, 1541, 625, -4042, 3366, 18281, 15623, 171, -3459, 1543, 868, -1213, 160, 541, -343, -94, 196, -47, -53, 35, 2, -6,
+ -9, 12, 28, -79, 7, 199, -228, -208, 679, -249, -1081, 1538, 629, -4041, 3352, 18274, 15636, 183, -3462, 1540, 871, -1213, 159, 542, -343, -95, 196, -47, -53, 35, 2, -6, -9, 12, 28, -78, 7, 199, -227, -208, 679, -247, -1083, 1536, 634, -4040, 3337, 18263, 15649, 195, -3466, 1537, 874, -1213, 157, 542, -342, -95, 196, -47, -53, 35, 2, -6,
+ -9, 12, 28, -78, 7, 199, -227, -209, 679, -246, -1084, 1533, 639, -4039, 3322, 18255, 15662, 207, -3470, 1534, 877, -1213, 155, 543, -342, -96, 197, -46, -53, 35, 2, -6, -8, 12, 28, -78, 7, 199, -226, -210, 678, -244, -1085, 1531, 643, -4038, 3307, 18245, 15675, 219, -3474, 1531, 880, -1213, 154, 544, -341, -97, 197, -46, -53, 35, 2, -6,
+ -8, 12, 28, -78, 6, 200, -225, -211, 678, -242, -1086, 1528, 648, -4037, 3292, 18236, 15688, 231, -3477, 1528, 883, -1213, 152, 545, -341, -97, 197, -46, -54, 35, 2, -6, -8, 11, 28, -78, 6, 200, -225, -211, 678, -240, -1087, 1526, 653, -4036, 3278, 18227, 15701, 242, -3481, 1525, 886, -1213, 151, 546, -341, -98, 197, -46, -54, 35, 2, -6,
+ -8, 11, 28, -78, 6, 200, -224, -212, 677, -238, -1088, 1523, 657, -4035, 3263, 18219, 15714, 254, -3485, 1522, 889, -1212, 149, 546, -340, -98, 197, -46, -54, 35, 2, -6, -8, 11, 28, -78, 6, 200, -224, -213, 677, -237, -1089, 1521, 662, -4033, 3248, 18210, 15727, 266, -3488, 1519, 892, -1212, 147, 547, -340, -99, 197, -45, -54, 35, 2, -7,
+ -8, 11, 28, -78, 5, 200, -223, -213, 677, -235, -1090, 1518, 666, -4032, 3233, 18200, 15740, 278, -3492, 1516, 895, -1212, 146, 548, -339, -99, 197, -45, -54, 35, 2, -7, -8, 11, 28, -78, 5, 200, -223, -214, 676, -233, -1091, 1516, 671, -4031, 3219, 18192, 15753, 290, -3496, 1513, 898, -1212, 144, 549, -339, -100, 197, -45, -54, 35, 2, -7,
+ -8, 11, 28, -78, 5, 200, -222, -215, 676, -231, -1092, 1513, 675, -4030, 3204, 18184, 15766, 302, -3499, 1510, 901, -1212, 143, 549, -339, -101, 197, -45, -54, 35, 2, -7, -8, 11, 28, -78, 5, 200, -222, -216, 676, -229, -1093, 1511, 680, -4029, 3189, 18174, 15779, 314, -3503, 1506, 905, -1212, 141, 550, -338, -101, 197, -45, -54, 35, 2, -7,
+ -8, 11, 28, -77, 4, 200, -221, -216, 675, -228, -1094, 1508, 685, -4028, 3175, 18165, 15792, 326, -3506, 1503, 908, -1212, 139, 551, -338, -102, 197, -44, -55, 35, 2, -7, -8, 11, 28, -77, 4, 200, -221, -217, 675, -226, -1095, 1506, 689, -4027, 3160, 18153, 15805, 338, -3510, 1500, 911, -1212, 138, 552, -337, -102, 198, -44, -55, 35, 3, -7,
+ -8, 11, 28, -77, 4, 200, -220, -218, 674, -224, -1096, 1503, 694, -4025, 3145, 18144, 15818, 351, -3514, 1497, 914, -1212, 136, 553, -337, -103, 198, -44, -55, 35, 3, -7, -8, 11, 28, -77, 4, 200, -220, -219, 674, -222, -1098, 1501, 698, -4024, 3131, 18135, 15831, 363, -3517, 1494, 917, -1212, 135, 553, -337, -103, 198, -44, -55, 35, 3, -7,
+ -8, 11, 28, -77, 3, 200, -219, -219, 674, -220, -1099, 1498, 703, -4023, 3116, 18126, 15844, 375, -3521, 1491, 920, -1212, 133, 554, -336, -104, 198, -44, -55, 35, 3, -7, -8, 11, 29, -77, 3, 200, -219, -220, 673, -218, -1100, 1496, 707, -4022, 3101, 18117, 15857, 387, -3524, 1488, 923, -1212, 131, 555, -336, -105, 198, -43, -55, 35, 3, -7,
+ -8, 11, 29, -77, 3, 200, -218, -221, 673, -217, -1101, 1493, 712, -4021, 3087, 18106, 15870, 399, -3528, 1485, 926, -1212, 130, 556, -335, -105, 198, -43, -55, 35, 3, -7, -8, 11, 29, -77, 3, 201, -217, -221, 672, -215, -1102, 1490, 716, -4019, 3072, 18099, 15883, 411, -3532, 1481, 929, -1212, 128, 556, -335, -106, 198, -43, -55, 35, 3, -7,
+ -8, 11, 29, -77, 2, 201, -217, -222, 672, -213, -1103, 1488, 721, -4018, 3058, 18089, 15895, 423, -3535, 1478, 932, -1211, 127, 557, -334, -106, 198, -43, -56, 34, 3, -7, -8, 11, 29, -77, 2, 201, -216, -223, 672, -211, -1104, 1485, 725, -4017, 3043, 18082, 15908, 435, -3539, 1475, 935, -1211, 125, 558, -334, -107, 198, -43, -56, 34, 3, -7,
+ -8, 11, 29, -77, 2, 201, -216, -224, 671, -209, -1105, 1483, 730, -4015, 3029, 18069, 15921, 448, -3542, 1472, 938, -1211, 123, 559, -334, -107, 198, -42, -56, 34, 3, -7, -8, 11, 29, -76, 2, 201, -215, -224, 671, -208, -1106, 1480, 734, -4014, 3014, 18060, 15934, 460, -3546, 1469, 941, -1211, 122, 559, -333, -108, 198, -42, -56, 34, 3, -7,
+ -8, 11, 29, -76, 1, 201, -215, -225, 671, -206, -1107, 1478, 739, -4013, 2999, 18052, 15947, 472, -3549, 1466, 944, -1211, 120, 560, -333, -109, 198, -42, -56, 34, 3, -7, -8, 11, 29, -76, 1, 201, -214, -226, 670, -204, -1108, 1475, 743, -4012, 2985, 18044, 15959, 484, -3553, 1462, 947, -1211, 118, 561, -332, -109, 199, -42, -56, 34, 3, -7,
+ -8, 11, 29, -76, 1, 201, -214, -226, 670, -202, -1109, 1473, 748, -4010, 2970, 18032, 15972, 496, -3556, 1459, 950, -1211, 117, 562, -332, -110, 199, -42, -56, 34, 3, -7, -8, 11, 29, -76, 1, 201, -213, -227, 669, -200, -1110, 1470, 752, -4009, 2956, 18022, 15985, 509, -3560, 1456, 953, -1211, 115, 562, -331, -110, 199, -41, -56, 34, 3, -7,
+ -8, 10, 29, -76, 0, 201, -213, -228, 669, -199, -1111, 1467, 757, -4007, 2941, 18014, 15998, 521, -3563, 1453, 956, -1210, 114, 563, -331, -111, 199, -41, -56, 34, 3, -7, -8, 10, 29, -76, 0, 201, -212, -228, 668, -197, -1112, 1465, 761, -4006, 2927, 18006, 16010, 533, -3567, 1450, 959, -1210, 112, 564, -331, -111, 199, -41, -57, 34, 3, -7,
+ -8, 10, 29, -76, 0, 201, -211, -229, 668, -195, -1112, 1462, 766, -4005, 2912, 17995, 16023, 546, -3570, 1446, 962, -1210, 110, 565, -330, -112, 199, -41, -57, 34, 3, -7, -8, 10, 29, -76, -1, 201, -211, -230, 668, -193, -1113, 1460, 770, -4003, 2898, 17986, 16036, 558, -3573, 1443, 965, -1210, 109, 565, -330, -113, 199, -41, -57, 34, 3, -7,
+ -8, 10, 29, -76, -1, 201, -210, -231, 667, -191, -1114, 1457, 775, -4002, 2883, 17977, 16048, 570, -3577, 1440, 968, -1210, 107, 566, -329, -113, 199, -40, -57, 34, 3, -7, -8, 10, 29, -76, -1, 201, -210, -231, 667, -190, -1115, 1454, 779, -4000, 2869, 17966, 16061, 583, -3580, 1437, 972, -1210, 105, 567, -329, -114, 199, -40, -57, 34, 3, -7,
+ -8, 10, 29, -75, -1, 201, -209, -232, 666, -188, -1116, 1452, 783, -3999, 2854, 17956, 16074, 595, -3584, 1433, 975, -1210, 104, 568, -328, -114, 199, -40, -57, 34, 3, -7, -8, 10, 29, -75, -2, 201, -209, -233, 666, -186, -1117, 1449, 788, -3998, 2840, 17949, 16086, 607, -3587, 1430, 978, -1209, 102, 568, -328, -115, 199, -40, -57, 34, 3, -7,
+ -8, 10, 29, -75, -2, 202, -208, -233, 666, -184, -1118, 1447, 792, -3996, 2826, 17934, 16099, 620, -3590, 1427, 981, -1209, 100, 569, -327, -116, 199, -40, -57, 34, 3, -7, -8, 10, 29, -75, -2, 202, -208, -234, 665, -182, -1119, 1444, 797, -3995, 2811, 17928, 16111, 632, -3594, 1423, 984, -1209, 99, 570, -327, -116, 199, -39, -58, 34, 3, -7,
+ -8, 10, 29, -75, -2, 202, -207, -235, 665, -181, -1120, 1441, 801, -3993, 2797, 17918, 16124, 644, -3597, 1420, 987, -1209, 97, 571, -327, -117, 200, -39, -58, 34, 3, -7, -8, 10, 30, -75, -3, 202, -207, -235, 664, -179, -1121, 1439, 806, -3992, 2782, 17907, 16136, 657, -3601, 1417, 990, -1209, 96, 571, -326, -117, 200, -39, -58, 34, 4, -7,
+ -8, 10, 30, -75, -3, 202, -206, -236, 664, -177, -1122, 1436, 810, -3990, 2768, 17896, 16149, 669, -3604, 1414, 993, -1208, 94, 572, -326, -118, 200, -39, -58, 34, 4, -7, -8, 10, 30, -75, -3, 202, -205, -237, 663, -175, -1123, 1434, 814, -3988, 2754, 17884, 16162, 682, -3607, 1410, 996, -1208, 92, 573, -325, -118, 200, -39, -58, 34, 4, -7,
+ -8, 10, 30, -75, -3, 202, -205, -237, 663, -173, -1124, 1431, 819, -3987, 2739, 17876, 16174, 694, -3611, 1407, 999, -1208, 91, 573, -325, -119, 200, -38, -58, 34, 4, -7, -8, 10, 30, -75, -4, 202, -204, -238, 663, -172, -1125, 1428, 823, -3985, 2725, 17867, 16186, 707, -3614, 1404, 1002, -1208, 89, 574, -324, -120, 200, -38, -58, 34, 4, -7,
+ -8, 10, 30, -74, -4, 202, -204, -239, 662, -170, -1126, 1426, 827, -3984, 2711, 17858, 16199, 719, -3617, 1400, 1005, -1208, 87, 575, -324, -120, 200, -38, -58, 34, 4, -7, -8, 10, 30, -74, -4, 202, -203, -240, 662, -168, -1126, 1423, 832, -3982, 2696, 17845, 16211, 732, -3620, 1397, 1008, -1207, 86, 576, -323, -121, 200, -38, -59, 34, 4, -7,
+ -8, 10, 30, -74, -4, 202, -203, -240, 661, -166, -1127, 1420, 836, -3981, 2682, 17838, 16224, 744, -3624, 1394, 1011, -1207, 84, 576, -323, -121, 200, -38, -59, 34, 4, -7, -8, 10, 30, -74, -5, 202, -202, -241, 661, -164, -1128, 1418, 841, -3979, 2668, 17826, 16236, 757, -3627, 1390, 1014, -1207, 82, 577, -322, -122, 200, -37, -59, 34, 4, -7,
+ -8, 10, 30, -74, -5, 202, -202, -242, 660, -163, -1129, 1415, 845, -3977, 2653, 17818, 16249, 769, -3630, 1387, 1017, -1207, 81, 578, -322, -122, 200, -37, -59, 34, 4, -7, -8, 10, 30, -74, -5, 202, -201, -242, 660, -161, -1130, 1412, 849, -3976, 2639, 17808, 16261, 782, -3634, 1383, 1020, -1206, 79, 579, -321, -123, 200, -37, -59, 34, 4, -7,
+ -8, 10, 30, -74, -5, 202, -200, -243, 659, -159, -1131, 1410, 854, -3974, 2625, 17799, 16273, 794, -3637, 1380, 1023, -1206, 77, 579, -321, -124, 200, -37, -59, 34, 4, -7, -8, 9, 30, -74, -6, 202, -200, -244, 659, -157, -1132, 1407, 858, -3972, 2610, 17788, 16286, 807, -3640, 1377, 1026, -1206, 76, 580, -320, -124, 200, -36, -59, 34, 4, -7,
+ -8, 9, 30, -74, -6, 202, -199, -244, 658, -155, -1133, 1405, 862, -3971, 2596, 17779, 16298, 820, -3643, 1373, 1029, -1206, 74, 581, -320, -125, 200, -36, -59, 34, 4, -7, -8, 9, 30, -74, -6, 202, -199, -245, 658, -154, -1133, 1402, 867, -3969, 2582, 17769, 16310, 832, -3646, 1370, 1032, -1206, 72, 581, -320, -125, 201, -36, -59, 34, 4, -7,
+ -8, 9, 30, -73, -6, 202, -198, -246, 658, -152, -1134, 1399, 871, -3967, 2568, 17757, 16323, 845, -3650, 1366, 1035, -1205, 71, 582, -319, -126, 201, -36, -60, 34, 4, -7, -8, 9, 30, -73, -7, 202, -198, -246, 657, -150, -1135, 1397, 875, -3966, 2553, 17750, 16335, 857, -3653, 1363, 1038, -1205, 69, 583, -319, -126, 201, -36, -60, 34, 4, -7,
+ -8, 9, 30, -73, -7, 202, -197, -247, 657, -148, -1136, 1394, 879, -3964, 2539, 17739, 16347, 870, -3656, 1360, 1041, -1205, 67, 583, -318, -127, 201, -35, -60, 34, 4, -7, -8, 9, 30, -73, -7, 202, -197, -248, 656, -146, -1137, 1391, 884, -3962, 2525, 17728, 16360, 883, -3659, 1356, 1044, -1204, 66, 584, -318, -128, 201, -35, -60, 34, 4, -7,
+ -8, 9, 30, -73, -7, 202, -196, -248, 656, -145, -1138, 1388, 888, -3960, 2511, 17717, 16372, 895, -3662, 1353, 1047, -1204, 64, 585, -317, -128, 201, -35, -60, 34, 4, -7, -8, 9, 30, -73, -8, 202, -196, -249, 655, -143, -1139, 1386, 892, -3959, 2497, 17712, 16384, 908, -3666, 1349, 1050, -1204, 62, 586, -317, -129, 201, -35, -60, 34, 4, -7,
+ -8, 9, 30, -73, -8, 202, -195, -250, 655, -141, -1139, 1383, 897, -3957, 2483, 17698, 16396, 921, -3669, 1346, 1053, -1204, 61, 586, -316, -129, 201, -35, -60, 34, 4, -7, -8, 9, 30, -73, -8, 203, -194, -250, 654, -139, -1140, 1380, 901, -3955, 2468, 17686, 16409, 934, -3672, 1342, 1056, -1203, 59, 587, -316, -130, 201, -34, -60, 34, 4, -7,
+ -8, 9, 30, -73, -8, 203, -194, -251, 654, -137, -1141, 1378, 905, -3953, 2454, 17676, 16421, 946, -3675, 1339, 1059, -1203, 57, 588, -315, -130, 201, -34, -61, 34, 4, -7, -8, 9, 31, -73, -9, 203, -193, -252, 653, -136, -1142, 1375, 909, -3951, 2440, 17669, 16433, 959, -3678, 1335, 1062, -1203, 56, 588, -315, -131, 201, -34, -61, 34, 4, -7,
+ -8, 9, 31, -72, -9, 203, -193, -252, 653, -134, -1143, 1372, 914, -3950, 2426, 17656, 16445, 972, -3681, 1332, 1065, -1202, 54, 589, -314, -132, 201, -34, -61, 34, 4, -7, -8, 9, 31, -72, -9, 203, -192, -253, 652, -132, -1143, 1370, 918, -3948, 2412, 17644, 16457, 985, -3684, 1328, 1068, -1202, 52, 590, -314, -132, 201, -34, -61, 34, 5, -7,
+ -8, 9, 31, -72, -9, 203, -192, -253, 652, -130, -1144, 1367, 922, -3946, 2398, 17633, 16469, 997, -3687, 1325, 1071, -1202, 51, 590, -313, -133, 201, -33, -61, 34, 5, -7, -8, 9, 31, -72, -10, 203, -191, -254, 651, -129, -1145, 1364, 926, -3944, 2384, 17626, 16481, 1010, -3690, 1321, 1074, -1202, 49, 591, -313, -133, 201, -33, -61, 34, 5, -7,
+ -8, 9, 31, -72, -10, 203, -191, -255, 651, -127, -1146, 1362, 930, -3942, 2370, 17615, 16493, 1023, -3693, 1318, 1076, -1201, 47, 592, -312, -134, 201, -33, -61, 34, 5, -7, -8, 9, 31, -72, -10, 203, -190, -255, 650, -125, -1147, 1359, 935, -3940, 2356, 17603, 16506, 1036, -3696, 1314, 1079, -1201, 46, 592, -312, -134, 201, -33, -61, 34, 5, -7,
+ -8, 9, 31, -72, -10, 203, -189, -256, 650, -123, -1147, 1356, 939, -3938, 2341, 17591, 16518, 1049, -3699, 1311, 1082, -1201, 44, 593, -311, -135, 201, -32, -61, 34, 5, -7, -8, 9, 31, -72, -11, 203, -189, -257, 649, -121, -1148, 1353, 943, -3936, 2327, 17585, 16530, 1062, -3703, 1307, 1085, -1200, 42, 594, -311, -136, 202, -32, -62, 34, 5, -7,
+ -8, 9, 31, -72, -11, 203, -188, -257, 649, -120, -1149, 1351, 947, -3934, 2313, 17573, 16542, 1074, -3706, 1304, 1088, -1200, 40, 595, -310, -136, 202, -32, -62, 34, 5, -7, -8, 9, 31, -72, -11, 203, -188, -258, 648, -118, -1150, 1348, 951, -3932, 2299, 17566, 16554, 1087, -3709, 1300, 1091, -1200, 39, 595, -310, -137, 202, -32, -62, 34, 5, -7,
+ -8, 8, 31, -71, -11, 203, -187, -259, 648, -116, -1150, 1345, 956, -3930, 2285, 17551, 16566, 1100, -3712, 1297, 1094, -1199, 37, 596, -309, -137, 202, -32, -62, 34, 5, -7, -8, 8, 31, -71, -11, 203, -187, -259, 647, -114, -1151, 1342, 960, -3929, 2271, 17543, 16578, 1113, -3715, 1293, 1097, -1199, 35, 597, -309, -138, 202, -31, -62, 34, 5, -7,
+ -8, 8, 31, -71, -12, 203, -186, -260, 647, -112, -1152, 1340, 964, -3927, 2257, 17530, 16590, 1126, -3717, 1290, 1100, -1198, 34, 597, -308, -138, 202, -31, -62, 33, 5, -7, -8, 8, 31, -71, -12, 203, -186, -261, 646, -111, -1153, 1337, 968, -3925, 2243, 17524, 16602, 1139, -3720, 1286, 1103, -1198, 32, 598, -308, -139, 202, -31, -62, 33, 5, -7,
+ -8, 8, 31, -71, -12, 203, -185, -261, 646, -109, -1153, 1334, 972, -3923, 2229, 17513, 16613, 1152, -3723, 1282, 1106, -1198, 30, 599, -307, -140, 202, -31, -62, 33, 5, -7, -8, 8, 31, -71, -12, 203, -184, -262, 645, -107, -1154, 1331, 976, -3921, 2215, 17501, 16625, 1165, -3726, 1279, 1109, -1197, 29, 599, -307, -140, 202, -30, -62, 33, 5, -7,
+ -8, 8, 31, -71, -13, 203, -184, -262, 645, -105, -1155, 1329, 981, -3918, 2202, 17489, 16637, 1178, -3729, 1275, 1112, -1197, 27, 600, -306, -141, 202, -30, -63, 33, 5, -7, -8, 8, 31, -71, -13, 203, -183, -263, 644, -104, -1156, 1326, 985, -3916, 2188, 17480, 16649, 1191, -3732, 1272, 1115, -1197, 25, 601, -306, -141, 202, -30, -63, 33, 5, -7,
+ -8, 8, 31, -71, -13, 203, -183, -264, 644, -102, -1156, 1323, 989, -3914, 2174, 17469, 16661, 1204, -3735, 1268, 1118, -1196, 24, 601, -305, -142, 202, -30, -63, 33, 5, -7, -8, 8, 31, -71, -13, 203, -182, -264, 643, -100, -1157, 1320, 993, -3912, 2160, 17459, 16673, 1217, -3738, 1264, 1121, -1196, 22, 602, -305, -142, 202, -30, -63, 33, 5, -7,
+ -8, 8, 31, -70, -14, 203, -182, -265, 643, -98, -1158, 1318, 997, -3910, 2146, 17447, 16685, 1230, -3741, 1261, 1124, -1195, 20, 602, -304, -143, 202, -29, -63, 33, 5, -7, -8, 8, 31, -70, -14, 203, -181, -266, 642, -97, -1158, 1315, 1001, -3908, 2132, 17439, 16696, 1243, -3744, 1257, 1127, -1195, 18, 603, -303, -144, 202, -29, -63, 33, 5, -7,
+ -8, 8, 31, -70, -14, 203, -180, -266, 642, -95, -1159, 1312, 1005, -3906, 2118, 17427, 16708, 1256, -3747, 1253, 1130, -1195, 17, 604, -303, -144, 202, -29, -63, 33, 5, -7, -8, 8, 31, -70, -14, 203, -180, -267, 641, -93, -1160, 1309, 1009, -3904, 2104, 17417, 16720, 1269, -3749, 1250, 1133, -1194, 15, 604, -302, -145, 202, -29, -63, 33, 5, -7,
+ -8, 8, 31, -70, -15, 203, -179, -267, 641, -91, -1161, 1307, 1013, -3902, 2090, 17406, 16732, 1282, -3752, 1246, 1135, -1194, 13, 605, -302, -145, 202, -28, -63, 33, 5, -7, -8, 8, 31, -70, -15, 203, -179, -268, 640, -89, -1161, 1304, 1018, -3900, 2077, 17395, 16743, 1295, -3755, 1242, 1138, -1193, 12, 606, -301, -146, 202, -28, -64, 33, 5, -7,
+ -8, 8, 32, -70, -15, 203, -178, -269, 639, -88, -1162, 1301, 1022, -3897, 2063, 17385, 16755, 1308, -3758, 1239, 1141, -1193, 10, 606, -301, -146, 202, -28, -64, 33, 5, -7, -8, 8, 32, -70, -15, 203, -178, -269, 639, -86, -1163, 1298, 1026, -3895, 2049, 17373, 16767, 1322, -3761, 1235, 1144, -1193, 8, 607, -300, -147, 202, -28, -64, 33, 6, -7,
+ -8, 8, 32, -70, -16, 203, -177, -270, 638, -84, -1163, 1296, 1030, -3893, 2035, 17363, 16779, 1335, -3764, 1231, 1147, -1192, 6, 608, -300, -148, 202, -28, -64, 33, 6, -7, -8, 8, 32, -70, -16, 203, -177, -270, 638, -82, -1164, 1293, 1034, -3891, 2021, 17350, 16790, 1348, -3766, 1228, 1150, -1192, 5, 608, -299, -148, 202, -27, -64, 33, 6, -7,
+ -8, 8, 32, -69, -16, 203, -176, -271, 637, -81, -1165, 1290, 1038, -3889, 2008, 17340, 16802, 1361, -3769, 1224, 1153, -1191, 3, 609, -299, -149, 202, -27, -64, 33, 6, -7, -8, 8, 32, -69, -16, 203, -175, -272, 637, -79, -1165, 1287, 1042, -3887, 1994, 17328, 16814, 1374, -3772, 1220, 1156, -1191, 1, 610, -298, -149, 202, -27, -64, 33, 6, -7,
+ -8, 8, 32, -69, -17, 203, -175, -272, 636, -77, -1166, 1284, 1046, -3884, 1980, 17320, 16825, 1387, -3775, 1216, 1159, -1190, 0, 610, -298, -150, 202, -27, -64, 33, 6, -7, -8, 7, 32, -69, -17, 203, -174, -273, 636, -75, -1167, 1282, 1050, -3882, 1966, 17304, 16837, 1401, -3777, 1213, 1162, -1190, -2, 611, -297, -150, 203, -26, -64, 33, 6, -7,
+ -8, 7, 32, -69, -17, 203, -174, -274, 635, -74, -1167, 1279, 1054, -3880, 1953, 17298, 16848, 1414, -3780, 1209, 1165, -1189, -4, 611, -297, -151, 203, -26, -65, 33, 6, -7, -8, 7, 32, -69, -17, 203, -173, -274, 635, -72, -1168, 1276, 1058, -3878, 1939, 17288, 16860, 1427, -3783, 1205, 1167, -1189, -6, 612, -296, -152, 203, -26, -65, 33, 6, -7,
+ -8, 7, 32, -69, -17, 203, -173, -275, 634, -70, -1169, 1273, 1062, -3875, 1925, 17276, 16871, 1440, -3785, 1202, 1170, -1189, -7, 613, -295, -152, 203, -26, -65, 33, 6, -7, -8, 7, 32, -69, -18, 203, -172, -275, 633, -68, -1169, 1270, 1066, -3873, 1912, 17266, 16883, 1453, -3788, 1198, 1173, -1188, -9, 613, -295, -153, 203, -26, -65, 33, 6, -7,
+ -8, 7, 32, -69, -18, 203, -171, -276, 633, -67, -1170, 1268, 1070, -3871, 1898, 17253, 16895, 1467, -3791, 1194, 1176, -1188, -11, 614, -294, -153, 203, -25, -65, 33, 6, -7, -8, 7, 32, -68, -18, 203, -171, -277, 632, -65, -1170, 1265, 1074, -3868, 1884, 17243, 16906, 1480, -3794, 1190, 1179, -1187, -13, 615, -294, -154, 203, -25, -65, 33, 6, -7,
+ -8, 7, 32, -68, -18, 203, -170, -277, 632, -63, -1171, 1262, 1078, -3866, 1871, 17229, 16918, 1493, -3796, 1186, 1182, -1187, -14, 615, -293, -154, 203, -25, -65, 33, 6, -7, -8, 7, 32, -68, -19, 203, -170, -278, 631, -61, -1172, 1259, 1082, -3864, 1857, 17221, 16929, 1507, -3799, 1183, 1185, -1186, -16, 616, -293, -155, 203, -25, -65, 33, 6, -7,
+ -8, 7, 32, -68, -19, 203, -169, -278, 631, -59, -1172, 1256, 1086, -3861, 1843, 17209, 16940, 1520, -3801, 1179, 1188, -1186, -18, 616, -292, -156, 203, -24, -65, 33, 6, -8, -8, 7, 32, -68, -19, 203, -169, -279, 630, -58, -1173, 1253, 1090, -3859, 1830, 17200, 16952, 1533, -3804, 1175, 1191, -1185, -19, 617, -292, -156, 203, -24, -66, 33, 6, -8,
+ -8, 7, 32, -68, -19, 203, -168, -279, 630, -56, -1174, 1251, 1094, -3857, 1816, 17189, 16963, 1547, -3807, 1171, 1193, -1185, -21, 618, -291, -157, 203, -24, -66, 33, 6, -8, -8, 7, 32, -68, -20, 203, -167, -280, 629, -54, -1174, 1248, 1098, -3854, 1802, 17177, 16975, 1560, -3809, 1167, 1196, -1184, -23, 618, -290, -157, 203, -24, -66, 33, 6, -8,
+ -8, 7, 32, -68, -20, 203, -167, -281, 628, -52, -1175, 1245, 1102, -3852, 1789, 17169, 16986, 1573, -3812, 1164, 1199, -1184, -25, 619, -290, -158, 203, -24, -66, 33, 6, -8, -8, 7, 32, -68, -20, 203, -166, -281, 628, -51, -1175, 1242, 1106, -3849, 1775, 17154, 16997, 1587, -3815, 1160, 1202, -1183, -26, 619, -289, -158, 203, -23, -66, 33, 6, -8,
+ -8, 7, 32, -67, -20, 203, -166, -282, 627, -49, -1176, 1239, 1109, -3847, 1762, 17145, 17009, 1600, -3817, 1156, 1205, -1183, -28, 620, -289, -159, 203, -23, -66, 33, 6, -8, -8, 7, 32, -67, -21, 203, -165, -282, 627, -47, -1176, 1236, 1113, -3845, 1748, 17133, 17020, 1614, -3820, 1152, 1208, -1182, -30, 621, -288, -160, 203, -23, -66, 33, 6, -8,
+ -8, 7, 32, -67, -21, 203, -165, -283, 626, -45, -1177, 1234, 1117, -3842, 1735, 17122, 17031, 1627, -3822, 1148, 1211, -1181, -32, 621, -288, -160, 203, -23, -66, 33, 6, -8, -8, 7, 32, -67, -21, 203, -164, -284, 625, -44, -1178, 1231, 1121, -3840, 1721, 17112, 17043, 1640, -3825, 1144, 1214, -1181, -33, 622, -287, -161, 203, -22, -66, 32, 7, -8,
+ -8, 7, 32, -67, -21, 203, -164, -284, 625, -42, -1178, 1228, 1125, -3837, 1708, 17098, 17054, 1654, -3827, 1141, 1216, -1180, -35, 622, -286, -161, 203, -22, -67, 32, 7, -8, -8, 7, 32, -67, -21, 203, -163, -285, 624, -40, -1179, 1225, 1129, -3835, 1694, 17091, 17065, 1667, -3830, 1137, 1219, -1180, -37, 623, -286, -162, 203, -22, -67, 32, 7, -8,
+ -8, 7, 32, -67, -22, 203, -162, -285, 624, -39, -1179, 1222, 1133, -3832, 1681, 17076, 17076, 1681, -3832, 1133, 1222, -1179, -39, 624, -285, -162, 203, -22, -67, 32, 7, -8, -8, 7, 32, -67, -22, 203, -162, -286, 623, -37, -1180, 1219, 1137, -3830, 1667, 17065, 17091, 1694, -3835, 1129, 1225, -1179, -40, 624, -285, -163, 203, -21, -67, 32, 7, -8,
+ -8, 7, 32, -67, -22, 203, -161, -286, 622, -35, -1180, 1216, 1141, -3827, 1654, 17054, 17098, 1708, -3837, 1125, 1228, -1178, -42, 625, -284, -164, 203, -21, -67, 32, 7, -8, -8, 7, 32, -66, -22, 203, -161, -287, 622, -33, -1181, 1214, 1144, -3825, 1640, 17043, 17112, 1721, -3840, 1121, 1231, -1178, -44, 625, -284, -164, 203, -21, -67, 32, 7, -8,
+ -8, 6, 33, -66, -23, 203, -160, -288, 621, -32, -1181, 1211, 1148, -3822, 1627, 17031, 17122, 1735, -3842, 1117, 1234, -1177, -45, 626, -283, -165, 203, -21, -67, 32, 7, -8, -8, 6, 33, -66, -23, 203, -160, -288, 621, -30, -1182, 1208, 1152, -3820, 1614, 17020, 17133, 1748, -3845, 1113, 1236, -1176, -47, 627, -282, -165, 203, -21, -67, 32, 7, -8,
+ -8, 6, 33, -66, -23, 203, -159, -289, 620, -28, -1183, 1205, 1156, -3817, 1600, 17009, 17145, 1762, -3847, 1109, 1239, -1176, -49, 627, -282, -166, 203, -20, -67, 32, 7, -8, -8, 6, 33, -66, -23, 203, -158, -289, 619, -26, -1183, 1202, 1160, -3815, 1587, 16997, 17154, 1775, -3849, 1106, 1242, -1175, -51, 628, -281, -166, 203, -20, -68, 32, 7, -8,
+ -8, 6, 33, -66, -24, 203, -158, -290, 619, -25, -1184, 1199, 1164, -3812, 1573, 16986, 17169, 1789, -3852, 1102, 1245, -1175, -52, 628, -281, -167, 203, -20, -68, 32, 7, -8, -8, 6, 33, -66, -24, 203, -157, -290, 618, -23, -1184, 1196, 1167, -3809, 1560, 16975, 17177, 1802, -3854, 1098, 1248, -1174, -54, 629, -280, -167, 203, -20, -68, 32, 7, -8,
+ -8, 6, 33, -66, -24, 203, -157, -291, 618, -21, -1185, 1193, 1171, -3807, 1547, 16963, 17189, 1816, -3857, 1094, 1251, -1174, -56, 630, -279, -168, 203, -19, -68, 32, 7, -8, -8, 6, 33, -66, -24, 203, -156, -292, 617, -19, -1185, 1191, 1175, -3804, 1533, 16952, 17200, 1830, -3859, 1090, 1253, -1173, -58, 630, -279, -169, 203, -19, -68, 32, 7, -8,
+ -8, 6, 33, -65, -24, 203, -156, -292, 616, -18, -1186, 1188, 1179, -3801, 1520, 16940, 17209, 1843, -3861, 1086, 1256, -1172, -59, 631, -278, -169, 203, -19, -68, 32, 7, -8, -7, 6, 33, -65, -25, 203, -155, -293, 616, -16, -1186, 1185, 1183, -3799, 1507, 16929, 17221, 1857, -3864, 1082, 1259, -1172, -61, 631, -278, -170, 203, -19, -68, 32, 7, -8,
+ -7, 6, 33, -65, -25, 203, -154, -293, 615, -14, -1187, 1182, 1186, -3796, 1493, 16918, 17229, 1871, -3866, 1078, 1262, -1171, -63, 632, -277, -170, 203, -18, -68, 32, 7, -8, -7, 6, 33, -65, -25, 203, -154, -294, 615, -13, -1187, 1179, 1190, -3794, 1480, 16906, 17243, 1884, -3868, 1074, 1265, -1170, -65, 632, -277, -171, 203, -18, -68, 32, 7, -8,
+ -7, 6, 33, -65, -25, 203, -153, -294, 614, -11, -1188, 1176, 1194, -3791, 1467, 16895, 17253, 1898, -3871, 1070, 1268, -1170, -67, 633, -276, -171, 203, -18, -69, 32, 7, -8, -7, 6, 33, -65, -26, 203, -153, -295, 613, -9, -1188, 1173, 1198, -3788, 1453, 16883, 17266, 1912, -3873, 1066, 1270, -1169, -68, 633, -275, -172, 203, -18, -69, 32, 7, -8,
+ -7, 6, 33, -65, -26, 203, -152, -295, 613, -7, -1189, 1170, 1202, -3785, 1440, 16871, 17276, 1925, -3875, 1062, 1273, -1169, -70, 634, -275, -173, 203, -17, -69, 32, 7, -8, -7, 6, 33, -65, -26, 203, -152, -296, 612, -6, -1189, 1167, 1205, -3783, 1427, 16860, 17288, 1939, -3878, 1058, 1276, -1168, -72, 635, -274, -173, 203, -17, -69, 32, 7, -8,
+ -7, 6, 33, -65, -26, 203, -151, -297, 611, -4, -1189, 1165, 1209, -3780, 1414, 16848, 17298, 1953, -3880, 1054, 1279, -1167, -74, 635, -274, -174, 203, -17, -69, 32, 7, -8, -7, 6, 33, -64, -26, 203, -150, -297, 611, -2, -1190, 1162, 1213, -3777, 1401, 16837, 17304, 1966, -3882, 1050, 1282, -1167, -75, 636, -273, -174, 203, -17, -69, 32, 7, -8,
+ -7, 6, 33, -64, -27, 202, -150, -298, 610, 0, -1190, 1159, 1216, -3775, 1387, 16825, 17320, 1980, -3884, 1046, 1284, -1166, -77, 636, -272, -175, 203, -17, -69, 32, 8, -8, -7, 6, 33, -64, -27, 202, -149, -298, 610, 1, -1191, 1156, 1220, -3772, 1374, 16814, 17328, 1994, -3887, 1042, 1287, -1165, -79, 637, -272, -175, 203, -16, -69, 32, 8, -8,
+ -7, 6, 33, -64, -27, 202, -149, -299, 609, 3, -1191, 1153, 1224, -3769, 1361, 16802, 17340, 2008, -3889, 1038, 1290, -1165, -81, 637, -271, -176, 203, -16, -69, 32, 8, -8, -7, 6, 33, -64, -27, 202, -148, -299, 608, 5, -1192, 1150, 1228, -3766, 1348, 16790, 17350, 2021, -3891, 1034, 1293, -1164, -82, 638, -270, -177, 203, -16, -70, 32, 8, -8,
+ -7, 6, 33, -64, -28, 202, -148, -300, 608, 6, -1192, 1147, 1231, -3764, 1335, 16779, 17363, 2035, -3893, 1030, 1296, -1163, -84, 638, -270, -177, 203, -16, -70, 32, 8, -8, -7, 6, 33, -64, -28, 202, -147, -300, 607, 8, -1193, 1144, 1235, -3761, 1322, 16767, 17373, 2049, -3895, 1026, 1298, -1163, -86, 639, -269, -178, 203, -15, -70, 32, 8, -8,
+ -7, 5, 33, -64, -28, 202, -146, -301, 606, 10, -1193, 1141, 1239, -3758, 1308, 16755, 17385, 2063, -3897, 1022, 1301, -1162, -88, 639, -269, -178, 203, -15, -70, 32, 8, -8, -7, 5, 33, -64, -28, 202, -146, -301, 606, 12, -1193, 1138, 1242, -3755, 1295, 16743, 17395, 2077, -3900, 1018, 1304, -1161, -89, 640, -268, -179, 203, -15, -70, 31, 8, -8,
+ -7, 5, 33, -63, -28, 202, -145, -302, 605, 13, -1194, 1135, 1246, -3752, 1282, 16732, 17406, 2090, -3902, 1013, 1307, -1161, -91, 641, -267, -179, 203, -15, -70, 31, 8, -8, -7, 5, 33, -63, -29, 202, -145, -302, 604, 15, -1194, 1133, 1250, -3749, 1269, 16720, 17417, 2104, -3904, 1009, 1309, -1160, -93, 641, -267, -180, 203, -14, -70, 31, 8, -8,
+ -7, 5, 33, -63, -29, 202, -144, -303, 604, 17, -1195, 1130, 1253, -3747, 1256, 16708, 17427, 2118, -3906, 1005, 1312, -1159, -95, 642, -266, -180, 203, -14, -70, 31, 8, -8, -7, 5, 33, -63, -29, 202, -144, -303, 603, 18, -1195, 1127, 1257, -3744, 1243, 16696, 17439, 2132, -3908, 1001, 1315, -1158, -97, 642, -266, -181, 203, -14, -70, 31, 8, -8,
+ -7, 5, 33, -63, -29, 202, -143, -304, 602, 20, -1195, 1124, 1261, -3741, 1230, 16685, 17447, 2146, -3910, 997, 1318, -1158, -98, 643, -265, -182, 203, -14, -70, 31, 8, -8, -7, 5, 33, -63, -30, 202, -142, -305, 602, 22, -1196, 1121, 1264, -3738, 1217, 16673, 17459, 2160, -3912, 993, 1320, -1157, -100, 643, -264, -182, 203, -13, -71, 31, 8, -8,
+ -7, 5, 33, -63, -30, 202, -142, -305, 601, 24, -1196, 1118, 1268, -3735, 1204, 16661, 17469, 2174, -3914, 989, 1323, -1156, -102, 644, -264, -183, 203, -13, -71, 31, 8, -8, -7, 5, 33, -63, -30, 202, -141, -306, 601, 25, -1197, 1115, 1272, -3732, 1191, 16649, 17480, 2188, -3916, 985, 1326, -1156, -104, 644, -263, -183, 203, -13, -71, 31, 8, -8,
+ -7, 5, 33, -63, -30, 202, -141, -306, 600, 27, -1197, 1112, 1275, -3729, 1178, 16637, 17489, 2202, -3918, 981, 1329, -1155, -105, 645, -262, -184, 203, -13, -71, 31, 8, -8, -7, 5, 33, -62, -30, 202, -140, -307, 599, 29, -1197, 1109, 1279, -3726, 1165, 16625, 17501, 2215, -3921, 976, 1331, -1154, -107, 645, -262, -184, 203, -12, -71, 31, 8, -8,
+ -7, 5, 33, -62, -31, 202, -140, -307, 599, 30, -1198, 1106, 1282, -3723, 1152, 16613, 17513, 2229, -3923, 972, 1334, -1153, -109, 646, -261, -185, 203, -12, -71, 31, 8, -8, -7, 5, 33, -62, -31, 202, -139, -308, 598, 32, -1198, 1103, 1286, -3720, 1139, 16602, 17524, 2243, -3925, 968, 1337, -1153, -111, 646, -261, -186, 203, -12, -71, 31, 8, -8,
+ -7, 5, 33, -62, -31, 202, -138, -308, 597, 34, -1198, 1100, 1290, -3717, 1126, 16590, 17530, 2257, -3927, 964, 1340, -1152, -112, 647, -260, -186, 203, -12, -71, 31, 8, -8, -7, 5, 34, -62, -31, 202, -138, -309, 597, 35, -1199, 1097, 1293, -3715, 1113, 16578, 17543, 2271, -3929, 960, 1342, -1151, -114, 647, -259, -187, 203, -11, -71, 31, 8, -8,
+ -7, 5, 34, -62, -32, 202, -137, -309, 596, 37, -1199, 1094, 1297, -3712, 1100, 16566, 17551, 2285, -3930, 956, 1345, -1150, -116, 648, -259, -187, 203, -11, -71, 31, 8, -8, -7, 5, 34, -62, -32, 202, -137, -310, 595, 39, -1200, 1091, 1300, -3709, 1087, 16554, 17566, 2299, -3932, 951, 1348, -1150, -118, 648, -258, -188, 203, -11, -72, 31, 9, -8,
+ -7, 5, 34, -62, -32, 202, -136, -310, 595, 40, -1200, 1088, 1304, -3706, 1074, 16542, 17573, 2313, -3934, 947, 1351, -1149, -120, 649, -257, -188, 203, -11, -72, 31, 9, -8, -7, 5, 34, -62, -32, 202, -136, -311, 594, 42, -1200, 1085, 1307, -3703, 1062, 16530, 17585, 2327, -3936, 943, 1353, -1148, -121, 649, -257, -189, 203, -11, -72, 31, 9, -8,
+ -7, 5, 34, -61, -32, 201, -135, -311, 593, 44, -1201, 1082, 1311, -3699, 1049, 16518, 17591, 2341, -3938, 939, 1356, -1147, -123, 650, -256, -189, 203, -10, -72, 31, 9, -8, -7, 5, 34, -61, -33, 201, -134, -312, 592, 46, -1201, 1079, 1314, -3696, 1036, 16506, 17603, 2356, -3940, 935, 1359, -1147, -125, 650, -255, -190, 203, -10, -72, 31, 9, -8,
+ -7, 5, 34, -61, -33, 201, -134, -312, 592, 47, -1201, 1076, 1318, -3693, 1023, 16493, 17615, 2370, -3942, 930, 1362, -1146, -127, 651, -255, -191, 203, -10, -72, 31, 9, -8, -7, 5, 34, -61, -33, 201, -133, -313, 591, 49, -1202, 1074, 1321, -3690, 1010, 16481, 17626, 2384, -3944, 926, 1364, -1145, -129, 651, -254, -191, 203, -10, -72, 31, 9, -8,
+ -7, 5, 34, -61, -33, 201, -133, -313, 590, 51, -1202, 1071, 1325, -3687, 997, 16469, 17633, 2398, -3946, 922, 1367, -1144, -130, 652, -253, -192, 203, -9, -72, 31, 9, -8, -7, 5, 34, -61, -34, 201, -132, -314, 590, 52, -1202, 1068, 1328, -3684, 985, 16457, 17644, 2412, -3948, 918, 1370, -1143, -132, 652, -253, -192, 203, -9, -72, 31, 9, -8,
+ -7, 4, 34, -61, -34, 201, -132, -314, 589, 54, -1202, 1065, 1332, -3681, 972, 16445, 17656, 2426, -3950, 914, 1372, -1143, -134, 653, -252, -193, 203, -9, -72, 31, 9, -8, -7, 4, 34, -61, -34, 201, -131, -315, 588, 56, -1203, 1062, 1335, -3678, 959, 16433, 17669, 2440, -3951, 909, 1375, -1142, -136, 653, -252, -193, 203, -9, -73, 31, 9, -8,
+ -7, 4, 34, -61, -34, 201, -130, -315, 588, 57, -1203, 1059, 1339, -3675, 946, 16421, 17676, 2454, -3953, 905, 1378, -1141, -137, 654, -251, -194, 203, -8, -73, 30, 9, -8, -7, 4, 34, -60, -34, 201, -130, -316, 587, 59, -1203, 1056, 1342, -3672, 934, 16409, 17686, 2468, -3955, 901, 1380, -1140, -139, 654, -250, -194, 203, -8, -73, 30, 9, -8,
+ -7, 4, 34, -60, -35, 201, -129, -316, 586, 61, -1204, 1053, 1346, -3669, 921, 16396, 17698, 2483, -3957, 897, 1383, -1139, -141, 655, -250, -195, 202, -8, -73, 30, 9, -8, -7, 4, 34, -60, -35, 201, -129, -317, 586, 62, -1204, 1050, 1349, -3666, 908, 16384, 17712, 2497, -3959, 892, 1386, -1139, -143, 655, -249, -196, 202, -8, -73, 30, 9, -8,
+ -7, 4, 34, -60, -35, 201, -128, -317, 585, 64, -1204, 1047, 1353, -3662, 895, 16372, 17717, 2511, -3960, 888, 1388, -1138, -145, 656, -248, -196, 202, -7, -73, 30, 9, -8, -7, 4, 34, -60, -35, 201, -128, -318, 584, 66, -1204, 1044, 1356, -3659, 883, 16360, 17728, 2525, -3962, 884, 1391, -1137, -146, 656, -248, -197, 202, -7, -73, 30, 9, -8,
+ -7, 4, 34, -60, -35, 201, -127, -318, 583, 67, -1205, 1041, 1360, -3656, 870, 16347, 17739, 2539, -3964, 879, 1394, -1136, -148, 657, -247, -197, 202, -7, -73, 30, 9, -8, -7, 4, 34, -60, -36, 201, -126, -319, 583, 69, -1205, 1038, 1363, -3653, 857, 16335, 17750, 2553, -3966, 875, 1397, -1135, -150, 657, -246, -198, 202, -7, -73, 30, 9, -8,
+ -7, 4, 34, -60, -36, 201, -126, -319, 582, 71, -1205, 1035, 1366, -3650, 845, 16323, 17757, 2568, -3967, 871, 1399, -1134, -152, 658, -246, -198, 202, -6, -73, 30, 9, -8, -7, 4, 34, -59, -36, 201, -125, -320, 581, 72, -1206, 1032, 1370, -3646, 832, 16310, 17769, 2582, -3969, 867, 1402, -1133, -154, 658, -245, -199, 202, -6, -74, 30, 9, -8,
+ -7, 4, 34, -59, -36, 200, -125, -320, 581, 74, -1206, 1029, 1373, -3643, 820, 16298, 17779, 2596, -3971, 862, 1405, -1133, -155, 658, -244, -199, 202, -6, -74, 30, 9, -8, -7, 4, 34, -59, -36, 200, -124, -320, 580, 76, -1206, 1026, 1377, -3640, 807, 16286, 17788, 2610, -3972, 858, 1407, -1132, -157, 659, -244, -200, 202, -6, -74, 30, 9, -8,
+ -7, 4, 34, -59, -37, 200, -124, -321, 579, 77, -1206, 1023, 1380, -3637, 794, 16273, 17799, 2625, -3974, 854, 1410, -1131, -159, 659, -243, -200, 202, -5, -74, 30, 10, -8, -7, 4, 34, -59, -37, 200, -123, -321, 579, 79, -1206, 1020, 1383, -3634, 782, 16261, 17808, 2639, -3976, 849, 1412, -1130, -161, 660, -242, -201, 202, -5, -74, 30, 10, -8,
+ -7, 4, 34, -59, -37, 200, -122, -322, 578, 81, -1207, 1017, 1387, -3630, 769, 16249, 17818, 2653, -3977, 845, 1415, -1129, -163, 660, -242, -202, 202, -5, -74, 30, 10, -8, -7, 4, 34, -59, -37, 200, -122, -322, 577, 82, -1207, 1014, 1390, -3627, 757, 16236, 17826, 2668, -3979, 841, 1418, -1128, -164, 661, -241, -202, 202, -5, -74, 30, 10, -8,
+ -7, 4, 34, -59, -38, 200, -121, -323, 576, 84, -1207, 1011, 1394, -3624, 744, 16224, 17838, 2682, -3981, 836, 1420, -1127, -166, 661, -240, -203, 202, -4, -74, 30, 10, -8, -7, 4, 34, -59, -38, 200, -121, -323, 576, 86, -1207, 1008, 1397, -3620, 732, 16211, 17845, 2696, -3982, 832, 1423, -1126, -168, 662, -240, -203, 202, -4, -74, 30, 10, -8,
+ -7, 4, 34, -58, -38, 200, -120, -324, 575, 87, -1208, 1005, 1400, -3617, 719, 16199, 17858, 2711, -3984, 827, 1426, -1126, -170, 662, -239, -204, 202, -4, -74, 30, 10, -8, -7, 4, 34, -58, -38, 200, -120, -324, 574, 89, -1208, 1002, 1404, -3614, 707, 16186, 17867, 2725, -3985, 823, 1428, -1125, -172, 663, -238, -204, 202, -4, -75, 30, 10, -8,
+ -7, 4, 34, -58, -38, 200, -119, -325, 573, 91, -1208, 999, 1407, -3611, 694, 16174, 17876, 2739, -3987, 819, 1431, -1124, -173, 663, -237, -205, 202, -3, -75, 30, 10, -8, -7, 4, 34, -58, -39, 200, -118, -325, 573, 92, -1208, 996, 1410, -3607, 682, 16162, 17884, 2754, -3988, 814, 1434, -1123, -175, 663, -237, -205, 202, -3, -75, 30, 10, -8,
+ -7, 4, 34, -58, -39, 200, -118, -326, 572, 94, -1208, 993, 1414, -3604, 669, 16149, 17896, 2768, -3990, 810, 1436, -1122, -177, 664, -236, -206, 202, -3, -75, 30, 10, -8, -7, 4, 34, -58, -39, 200, -117, -326, 571, 96, -1209, 990, 1417, -3601, 657, 16136, 17907, 2782, -3992, 806, 1439, -1121, -179, 664, -235, -207, 202, -3, -75, 30, 10, -8,
+ -7, 3, 34, -58, -39, 200, -117, -327, 571, 97, -1209, 987, 1420, -3597, 644, 16124, 17918, 2797, -3993, 801, 1441, -1120, -181, 665, -235, -207, 202, -2, -75, 29, 10, -8, -7, 3, 34, -58, -39, 199, -116, -327, 570, 99, -1209, 984, 1423, -3594, 632, 16111, 17928, 2811, -3995, 797, 1444, -1119, -182, 665, -234, -208, 202, -2, -75, 29, 10, -8,
+ -7, 3, 34, -57, -40, 199, -116, -327, 569, 100, -1209, 981, 1427, -3590, 620, 16099, 17934, 2826, -3996, 792, 1447, -1118, -184, 666, -233, -208, 202, -2, -75, 29, 10, -8, -7, 3, 34, -57, -40, 199, -115, -328, 568, 102, -1209, 978, 1430, -3587, 607, 16086, 17949, 2840, -3998, 788, 1449, -1117, -186, 666, -233, -209, 201, -2, -75, 29, 10, -8,
+ -7, 3, 34, -57, -40, 199, -114, -328, 568, 104, -1210, 975, 1433, -3584, 595, 16074, 17956, 2854, -3999, 783, 1452, -1116, -188, 666, -232, -209, 201, -1, -75, 29, 10, -8, -7, 3, 34, -57, -40, 199, -114, -329, 567, 105, -1210, 972, 1437, -3580, 583, 16061, 17966, 2869, -4000, 779, 1454, -1115, -190, 667, -231, -210, 201, -1, -76, 29, 10, -8,
+ -7, 3, 34, -57, -40, 199, -113, -329, 566, 107, -1210, 968, 1440, -3577, 570, 16048, 17977, 2883, -4002, 775, 1457, -1114, -191, 667, -231, -210, 201, -1, -76, 29, 10, -8, -7, 3, 34, -57, -41, 199, -113, -330, 565, 109, -1210, 965, 1443, -3573, 558, 16036, 17986, 2898, -4003, 770, 1460, -1113, -193, 668, -230, -211, 201, -1, -76, 29, 10, -8,
+ -7, 3, 34, -57, -41, 199, -112, -330, 565, 110, -1210, 962, 1446, -3570, 546, 16023, 17995, 2912, -4005, 766, 1462, -1112, -195, 668, -229, -211, 201, 0, -76, 29, 10, -8, -7, 3, 34, -57, -41, 199, -111, -331, 564, 112, -1210, 959, 1450, -3567, 533, 16010, 18006, 2927, -4006, 761, 1465, -1112, -197, 668, -228, -212, 201, 0, -76, 29, 10, -8,
+ -7, 3, 34, -56, -41, 199, -111, -331, 563, 114, -1210, 956, 1453, -3563, 521, 15998, 18014, 2941, -4007, 757, 1467, -1111, -199, 669, -228, -213, 201, 0, -76, 29, 10, -8, -7, 3, 34, -56, -41, 199, -110, -331, 562, 115, -1211, 953, 1456, -3560, 509, 15985, 18022, 2956, -4009, 752, 1470, -1110, -200, 669, -227, -213, 201, 1, -76, 29, 11, -8,
+ -7, 3, 34, -56, -42, 199, -110, -332, 562, 117, -1211, 950, 1459, -3556, 496, 15972, 18032, 2970, -4010, 748, 1473, -1109, -202, 670, -226, -214, 201, 1, -76, 29, 11, -8, -7, 3, 34, -56, -42, 199, -109, -332, 561, 118, -1211, 947, 1462, -3553, 484, 15959, 18044, 2985, -4012, 743, 1475, -1108, -204, 670, -226, -214, 201, 1, -76, 29, 11, -8,
+ -7, 3, 34, -56, -42, 198, -109, -333, 560, 120, -1211, 944, 1466, -3549, 472, 15947, 18052, 2999, -4013, 739, 1478, -1107, -206, 671, -225, -215, 201, 1, -76, 29, 11, -8, -7, 3, 34, -56, -42, 198, -108, -333, 559, 122, -1211, 941, 1469, -3546, 460, 15934, 18060, 3014, -4014, 734, 1480, -1106, -208, 671, -224, -215, 201, 2, -76, 29, 11, -8,
+ -7, 3, 34, -56, -42, 198, -107, -334, 559, 123, -1211, 938, 1472, -3542, 448, 15921, 18069, 3029, -4015, 730, 1483, -1105, -209, 671, -224, -216, 201, 2, -77, 29, 11, -8, -7, 3, 34, -56, -43, 198, -107, -334, 558, 125, -1211, 935, 1475, -3539, 435, 15908, 18082, 3043, -4017, 725, 1485, -1104, -211, 672, -223, -216, 201, 2, -77, 29, 11, -8,
+ -7, 3, 34, -56, -43, 198, -106, -334, 557, 127, -1211, 932, 1478, -3535, 423, 15895, 18089, 3058, -4018, 721, 1488, -1103, -213, 672, -222, -217, 201, 2, -77, 29, 11, -8, -7, 3, 35, -55, -43, 198, -106, -335, 556, 128, -1212, 929, 1481, -3532, 411, 15883, 18099, 3072, -4019, 716, 1490, -1102, -215, 672, -221, -217, 201, 3, -77, 29, 11, -8,
+ -7, 3, 35, -55, -43, 198, -105, -335, 556, 130, -1212, 926, 1485, -3528, 399, 15870, 18106, 3087, -4021, 712, 1493, -1101, -217, 673, -221, -218, 200, 3, -77, 29, 11, -8, -7, 3, 35, -55, -43, 198, -105, -336, 555, 131, -1212, 923, 1488, -3524, 387, 15857, 18117, 3101, -4022, 707, 1496, -1100, -218, 673, -220, -219, 200, 3, -77, 29, 11, -8,
+ -7, 3, 35, -55, -44, 198, -104, -336, 554, 133, -1212, 920, 1491, -3521, 375, 15844, 18126, 3116, -4023, 703, 1498, -1099, -220, 674, -219, -219, 200, 3, -77, 28, 11, -8, -7, 3, 35, -55, -44, 198, -103, -337, 553, 135, -1212, 917, 1494, -3517, 363, 15831, 18135, 3131, -4024, 698, 1501, -1098, -222, 674, -219, -220, 200, 4, -77, 28, 11, -8,
+ -7, 3, 35, -55, -44, 198, -103, -337, 553, 136, -1212, 914, 1497, -3514, 351, 15818, 18144, 3145, -4025, 694, 1503, -1096, -224, 674, -218, -220, 200, 4, -77, 28, 11, -8, -7, 3, 35, -55, -44, 198, -102, -337, 552, 138, -1212, 911, 1500, -3510, 338, 15805, 18153, 3160, -4027, 689, 1506, -1095, -226, 675, -217, -221, 200, 4, -77, 28, 11, -8,
+ -7, 2, 35, -55, -44, 197, -102, -338, 551, 139, -1212, 908, 1503, -3506, 326, 15792, 18165, 3175, -4028, 685, 1508, -1094, -228, 675, -216, -221, 200, 4, -77, 28, 11, -8, -7, 2, 35, -54, -45, 197, -101, -338, 550, 141, -1212, 905, 1506, -3503, 314, 15779, 18174, 3189, -4029, 680, 1511, -1093, -229, 676, -216, -222, 200, 5, -78, 28, 11, -8,
+ -7, 2, 35, -54, -45, 197, -101, -339, 549, 143, -1212, 901, 1510, -3499, 302, 15766, 18184, 3204, -4030, 675, 1513, -1092, -231, 676, -215, -222, 200, 5, -78, 28, 11, -8, -7, 2, 35, -54, -45, 197, -100, -339, 549, 144, -1212, 898, 1513, -3496, 290, 15753, 18192, 3219, -4031, 671, 1516, -1091, -233, 676, -214, -223, 200, 5, -78, 28, 11, -8,
+ -7, 2, 35, -54, -45, 197, -99, -339, 548, 146, -1212, 895, 1516, -3492, 278, 15740, 18200, 3233, -4032, 666, 1518, -1090, -235, 677, -213, -223, 200, 5, -78, 28, 11, -8, -7, 2, 35, -54, -45, 197, -99, -340, 547, 147, -1212, 892, 1519, -3488, 266, 15727, 18210, 3248, -4033, 662, 1521, -1089, -237, 677, -213, -224, 200, 6, -78, 28, 11, -8,
+ -6, 2, 35, -54, -46, 197, -98, -340, 546, 149, -1212, 889, 1522, -3485, 254, 15714, 18219, 3263, -4035, 657, 1523, -1088, -238, 677, -212, -224, 200, 6, -78, 28, 11, -8, -6, 2, 35, -54, -46, 197, -98, -341, 546, 151, -1213, 886, 1525, -3481, 242, 15701, 18227, 3278, -4036, 653, 1526, -1087, -240, 678, -211, -225, 200, 6, -78, 28, 11, -8,
+ -6, 2, 35, -54, -46, 197, -97, -341, 545, 152, -1213, 883, 1528, -3477, 231, 15688, 18236, 3292, -4037, 648, 1528, -1086, -242, 678, -211, -225, 200, 6, -78, 28, 12, -8, -6, 2, 35, -53, -46, 197, -97, -341, 544, 154, -1213, 880, 1531, -3474, 219, 15675, 18245, 3307, -4038, 643, 1531, -1085, -244, 678, -210, -226, 199, 7, -78, 28, 12, -8,
+ -6, 2, 35, -53, -46, 197, -96, -342, 543, 155, -1213, 877, 1534, -3470, 207, 15662, 18255, 3322, -4039, 639, 1533, -1084, -246, 679, -209, -227, 199, 7, -78, 28, 12, -9, -6, 2, 35, -53, -47, 196, -95, -342, 542, 157, -1213, 874, 1537, -3466, 195, 15649, 18263, 3337, -4040, 634, 1536, -1083, -247, 679, -208, -227, 199, 7, -78, 28, 12, -9,
+ -6, 2, 35, -53, -47, 196, -95, -343, 542, 159, -1213, 871, 1540, -3462, 183, 15636, 18274, 3352, -4041, 629, 1538, -1081, -249, 679, -208, -228, 199, 7, -79, 28, 12, -9, -6, 2, 35, -53, -47, 196, -94, -343, 541, 160, -1213, 868, 1543, -3459, 171, 15623, 18281, 3366, -4042, 625, 1541, -1080, -251, 680, -207, -228, 199, 8, -79, 28, 12, -9,
+ -6, 2, 35, -53, -47, 196, -94, -343, 540, 162, -1213, 865, 1546, -3455, 159, 15610, 18291, 3381, -4043, 620, 1543, -1079, -253, 680, -206, -229, 199, 8, -79, 28, 12, -9, -6, 2, 35, -53, -47, 196, -93, -344, 539, 163, -1213, 862, 1549, -3451, 147, 15596, 18300, 3396, -4044, 616, 1546, -1078, -255, 680, -205, -229, 199, 8, -79, 28, 12, -9,
+ -6, 2, 35, -53, -47, 196, -93, -344, 538, 165, -1213, 859, 1552, -3447, 136, 15583, 18308, 3411, -4045, 611, 1548, -1077, -257, 681, -205, -230, 199, 9, -79, 28, 12, -9, -6, 2, 35, -53, -48, 196, -92, -345, 538, 167, -1213, 855, 1555, -3444, 124, 15570, 18319, 3426, -4046, 606, 1550, -1076, -258, 681, -204, -230, 199, 9, -79, 27, 12, -9,
+ -6, 2, 35, -52, -48, 196, -91, -345, 537, 168, -1213, 852, 1558, -3440, 112, 15557, 18327, 3440, -4047, 602, 1553, -1075, -260, 681, -203, -231, 199, 9, -79, 27, 12, -9, -6, 2, 35, -52, -48, 196, -91, -345, 536, 170, -1213, 849, 1561, -3436, 100, 15544, 18334, 3455, -4047, 597, 1555, -1074, -262, 682, -202, -231, 199, 9, -79, 27, 12, -9,
+ -6, 2, 35, -52, -48, 196, -90, -346, 535, 171, -1213, 846, 1564, -3432, 88, 15530, 18344, 3470, -4048, 592, 1558, -1072, -264, 682, -202, -232, 199, 10, -79, 27, 12, -9, -6, 2, 35, -52, -48, 195, -90, -346, 534, 173, -1213, 843, 1567, -3428, 77, 15517, 18353, 3485, -4049, 588, 1560, -1071, -266, 682, -201, -232, 198, 10, -79, 27, 12, -9,
+ -6, 2, 35, -52, -49, 195, -89, -347, 534, 174, -1213, 840, 1570, -3425, 65, 15504, 18362, 3500, -4050, 583, 1563, -1070, -267, 683, -200, -233, 198, 10, -79, 27, 12, -9, -6, 2, 35, -52, -49, 195, -89, -347, 533, 176, -1213, 837, 1573, -3421, 53, 15491, 18371, 3515, -4051, 578, 1565, -1069, -269, 683, -199, -233, 198, 10, -79, 27, 12, -9,
+ -6, 2, 35, -52, -49, 195, -88, -347, 532, 178, -1213, 834, 1575, -3417, 42, 15477, 18381, 3530, -4052, 573, 1568, -1068, -271, 683, -199, -234, 198, 11, -80, 27, 12, -9, -6, 2, 35, -52, -49, 195, -87, -348, 531, 179, -1212, 831, 1578, -3413, 30, 15464, 18388, 3545, -4053, 569, 1570, -1067, -273, 684, -198, -234, 198, 11, -80, 27, 12, -9,
+ -6, 2, 35, -51, -49, 195, -87, -348, 530, 181, -1212, 828, 1581, -3409, 18, 15451, 18396, 3560, -4053, 564, 1572, -1066, -275, 684, -197, -235, 198, 11, -80, 27, 12, -9, -6, 2, 35, -51, -50, 195, -86, -348, 530, 182, -1212, 825, 1584, -3405, 7, 15437, 18405, 3574, -4054, 559, 1575, -1064, -277, 684, -196, -236, 198, 11, -80, 27, 12, -9,
+ -6, 1, 35, -51, -50, 195, -86, -349, 529, 184, -1212, 822, 1587, -3402, -5, 15424, 18414, 3589, -4055, 555, 1577, -1063, -278, 685, -196, -236, 198, 12, -80, 27, 12, -9, -6, 1, 35, -51, -50, 195, -85, -349, 528, 185, -1212, 818, 1590, -3398, -17, 15411, 18424, 3604, -4056, 550, 1580, -1062, -280, 685, -195, -237, 198, 12, -80, 27, 12, -9,
+ -6, 1, 35, -51, -50, 194, -85, -350, 527, 187, -1212, 815, 1593, -3394, -28, 15397, 18434, 3619, -4057, 545, 1582, -1061, -282, 685, -194, -237, 198, 12, -80, 27, 13, -9, -6, 1, 35, -51, -50, 194, -84, -350, 526, 188, -1212, 812, 1596, -3390, -40, 15384, 18441, 3634, -4057, 540, 1584, -1060, -284, 686, -193, -238, 198, 13, -80, 27, 13, -9,
+ -6, 1, 35, -51, -50, 194, -83, -350, 526, 190, -1212, 809, 1599, -3386, -51, 15371, 18446, 3649, -4058, 536, 1587, -1058, -286, 686, -193, -238, 197, 13, -80, 27, 13, -9, -6, 1, 35, -51, -51, 194, -83, -351, 525, 192, -1212, 806, 1601, -3382, -63, 15357, 18460, 3664, -4059, 531, 1589, -1057, -288, 686, -192, -239, 197, 13, -80, 27, 13, -9,
+ -6, 1, 35, -50, -51, 194, -82, -351, 524, 193, -1212, 803, 1604, -3378, -75, 15344, 18464, 3679, -4059, 526, 1592, -1056, -289, 687, -191, -239, 197, 13, -80, 27, 13, -9, -6, 1, 35, -50, -51, 194, -82, -351, 523, 195, -1212, 800, 1607, -3374, -86, 15330, 18474, 3694, -4060, 521, 1594, -1055, -291, 687, -190, -240, 197, 14, -81, 27, 13, -9,
+ -6, 1, 35, -50, -51, 194, -81, -352, 522, 196, -1212, 797, 1610, -3370, -98, 15317, 18485, 3709, -4061, 517, 1596, -1054, -293, 687, -190, -240, 197, 14, -81, 26, 13, -9, -6, 1, 35, -50, -51, 194, -81, -352, 521, 198, -1212, 794, 1613, -3366, -109, 15303, 18492, 3724, -4061, 512, 1599, -1052, -295, 687, -189, -241, 197, 14, -81, 26, 13, -9,
+ -6, 1, 35, -50, -52, 194, -80, -352, 521, 199, -1212, 791, 1615, -3362, -121, 15290, 18501, 3739, -4062, 507, 1601, -1051, -297, 688, -188, -241, 197, 14, -81, 26, 13, -9, -6, 1, 35, -50, -52, 193, -79, -353, 520, 201, -1211, 788, 1618, -3358, -132, 15276, 18509, 3754, -4063, 502, 1603, -1050, -298, 688, -187, -242, 197, 15, -81, 26, 13, -9,
+ -6, 1, 35, -50, -52, 193, -79, -353, 519, 202, -1211, 784, 1621, -3354, -144, 15263, 18517, 3769, -4063, 498, 1606, -1049, -300, 688, -186, -242, 197, 15, -81, 26, 13, -9, -6, 1, 35, -50, -52, 193, -78, -354, 518, 204, -1211, 781, 1624, -3350, -155, 15249, 18526, 3784, -4064, 493, 1608, -1047, -302, 689, -186, -243, 197, 15, -81, 26, 13, -9,
+ -6, 1, 35, -49, -52, 193, -78, -354, 517, 205, -1211, 778, 1627, -3347, -166, 15236, 18533, 3800, -4064, 488, 1611, -1046, -304, 689, -185, -243, 196, 15, -81, 26, 13, -9, -6, 1, 35, -49, -52, 193, -77, -354, 516, 207, -1211, 775, 1629, -3343, -178, 15222, 18543, 3815, -4065, 483, 1613, -1045, -306, 689, -184, -244, 196, 16, -81, 26, 13, -9,
+ -6, 1, 35, -49, -53, 193, -77, -355, 516, 209, -1211, 772, 1632, -3338, -189, 15209, 18551, 3830, -4066, 478, 1615, -1044, -308, 689, -183, -244, 196, 16, -81, 26, 13, -9, -6, 1, 35, -49, -53, 193, -76, -355, 515, 210, -1211, 769, 1635, -3334, -201, 15195, 18557, 3845, -4066, 474, 1618, -1042, -309, 690, -183, -245, 196, 16, -81, 26, 13, -9,
+ -6, 1, 35, -49, -53, 193, -76, -355, 514, 212, -1211, 766, 1638, -3330, -212, 15181, 18565, 3860, -4067, 469, 1620, -1041, -311, 690, -182, -245, 196, 17, -81, 26, 13, -9, -6, 1, 35, -49, -53, 193, -75, -356, 513, 213, -1211, 763, 1640, -3326, -223, 15168, 18575, 3875, -4067, 464, 1622, -1040, -313, 690, -181, -246, 196, 17, -81, 26, 13, -9,
+ -6, 1, 35, -49, -53, 192, -74, -356, 512, 215, -1210, 760, 1643, -3322, -235, 15154, 18584, 3890, -4068, 459, 1625, -1039, -315, 690, -180, -246, 196, 17, -82, 26, 13, -9, -6, 1, 35, -49, -54, 192, -74, -356, 511, 216, -1210, 756, 1646, -3318, -246, 15141, 18593, 3905, -4068, 454, 1627, -1037, -317, 691, -179, -247, 196, 17, -82, 26, 13, -9,
+ -6, 1, 35, -48, -54, 192, -73, -357, 511, 218, -1210, 753, 1649, -3314, -257, 15127, 18599, 3920, -4069, 449, 1629, -1036, -318, 691, -179, -247, 196, 18, -82, 26, 13, -9, -6, 1, 35, -48, -54, 192, -73, -357, 510, 219, -1210, 750, 1651, -3310, -269, 15113, 18608, 3936, -4069, 445, 1632, -1035, -320, 691, -178, -248, 196, 18, -82, 26, 13, -9,
+ -6, 1, 35, -48, -54, 192, -72, -357, 509, 221, -1210, 747, 1654, -3306, -280, 15100, 18617, 3951, -4070, 440, 1634, -1034, -322, 691, -177, -249, 195, 18, -82, 26, 13, -9, -6, 1, 35, -48, -54, 192, -72, -358, 508, 222, -1210, 744, 1657, -3302, -291, 15086, 18624, 3966, -4070, 435, 1636, -1032, -324, 692, -176, -249, 195, 18, -82, 26, 14, -9,
+ -6, 1, 35, -48, -54, 192, -71, -358, 507, 224, -1209, 741, 1659, -3298, -302, 15072, 18632, 3981, -4070, 430, 1638, -1031, -326, 692, -175, -250, 195, 19, -82, 25, 14, -9, -6, 1, 35, -48, -55, 192, -70, -358, 506, 225, -1209, 738, 1662, -3294, -314, 15059, 18642, 3996, -4071, 425, 1641, -1030, -328, 692, -175, -250, 195, 19, -82, 25, 14, -9,
+ -6, 1, 35, -48, -55, 191, -70, -359, 506, 227, -1209, 735, 1665, -3290, -325, 15045, 18650, 4011, -4071, 420, 1643, -1028, -329, 692, -174, -251, 195, 19, -82, 25, 14, -9, -6, 1, 35, -48, -55, 191, -69, -359, 505, 228, -1209, 732, 1667, -3286, -336, 15031, 18657, 4027, -4072, 415, 1645, -1027, -331, 693, -173, -251, 195, 20, -82, 25, 14, -9,
+ -6, 0, 35, -47, -55, 191, -69, -359, 504, 230, -1209, 729, 1670, -3281, -347, 15017, 18663, 4042, -4072, 411, 1648, -1026, -333, 693, -172, -252, 195, 20, -82, 25, 14, -9, -6, 0, 35, -47, -55, 191, -68, -360, 503, 231, -1209, 725, 1673, -3277, -358, 15004, 18672, 4057, -4072, 406, 1650, -1024, -335, 693, -172, -252, 195, 20, -82, 25, 14, -9,
+ -6, 0, 35, -47, -55, 191, -68, -360, 502, 233, -1208, 722, 1675, -3273, -370, 14990, 18685, 4072, -4073, 401, 1652, -1023, -337, 693, -171, -253, 194, 20, -83, 25, 14, -9, -6, 0, 35, -47, -56, 191, -67, -360, 501, 234, -1208, 719, 1678, -3269, -381, 14976, 18692, 4087, -4073, 396, 1654, -1022, -339, 694, -170, -253, 194, 21, -83, 25, 14, -9,
+ -6, 0, 35, -47, -56, 191, -66, -361, 500, 236, -1208, 716, 1680, -3265, -392, 14962, 18698, 4103, -4073, 391, 1657, -1020, -340, 694, -169, -254, 194, 21, -83, 25, 14, -9, -6, 0, 35, -47, -56, 191, -66, -361, 500, 237, -1208, 713, 1683, -3261, -403, 14948, 18707, 4118, -4074, 386, 1659, -1019, -342, 694, -168, -254, 194, 21, -83, 25, 14, -9,
+ -6, 0, 35, -47, -56, 190, -65, -361, 499, 239, -1208, 710, 1686, -3257, -414, 14935, 18716, 4133, -4074, 381, 1661, -1018, -344, 694, -168, -255, 194, 21, -83, 25, 14, -9, -6, 0, 35, -47, -56, 190, -65, -361, 498, 240, -1207, 707, 1688, -3252, -425, 14921, 18721, 4148, -4074, 376, 1663, -1016, -346, 695, -167, -255, 194, 22, -83, 25, 14, -9,
+ -6, 0, 35, -46, -56, 190, -64, -362, 497, 242, -1207, 704, 1691, -3248, -436, 14907, 18727, 4164, -4074, 371, 1666, -1015, -348, 695, -166, -256, 194, 22, -83, 25, 14, -9, -6, 0, 35, -46, -57, 190, -64, -362, 496, 243, -1207, 700, 1693, -3244, -447, 14893, 18739, 4179, -4075, 366, 1668, -1014, -349, 695, -165, -256, 194, 22, -83, 25, 14, -9,
+ -6, 0, 35, -46, -57, 190, -63, -362, 495, 245, -1207, 697, 1696, -3240, -458, 14879, 18747, 4194, -4075, 361, 1670, -1012, -351, 695, -164, -257, 193, 22, -83, 25, 14, -9, -6, 0, 35, -46, -57, 190, -63, -363, 494, 246, -1206, 694, 1699, -3236, -469, 14865, 18754, 4210, -4075, 356, 1672, -1011, -353, 695, -163, -257, 193, 23, -83, 25, 14, -9,
+ -6, 0, 35, -46, -57, 190, -62, -363, 494, 248, -1206, 691, 1701, -3231, -480, 14851, 18759, 4225, -4075, 352, 1675, -1010, -355, 696, -163, -258, 193, 23, -83, 25, 14, -9, -6, 0, 35, -46, -57, 189, -61, -363, 493, 249, -1206, 688, 1704, -3227, -491, 14837, 18768, 4240, -4075, 347, 1677, -1008, -357, 696, -162, -258, 193, 23, -83, 24, 14, -9,
+ -6, 0, 35, -46, -58, 189, -61, -364, 492, 251, -1206, 685, 1706, -3223, -502, 14823, 18778, 4256, -4075, 342, 1679, -1007, -359, 696, -161, -259, 193, 24, -83, 24, 14, -9, -6, 0, 35, -46, -58, 189, -60, -364, 491, 252, -1205, 682, 1709, -3219, -513, 14810, 18784, 4271, -4076, 337, 1681, -1005, -360, 696, -160, -259, 193, 24, -84, 24, 14, -9,
+ -6, 0, 35, -45, -58, 189, -60, -364, 490, 254, -1205, 679, 1711, -3214, -524, 14796, 18791, 4286, -4076, 332, 1684, -1004, -362, 696, -159, -260, 193, 24, -84, 24, 14, -9, -6, 0, 35, -45, -58, 189, -59, -365, 489, 255, -1205, 676, 1714, -3210, -535, 14782, 18798, 4302, -4076, 327, 1686, -1003, -364, 697, -159, -260, 193, 24, -84, 24, 15, -9,
+ -6, 0, 35, -45, -58, 189, -59, -365, 488, 257, -1205, 672, 1716, -3206, -546, 14768, 18808, 4317, -4076, 322, 1688, -1001, -366, 697, -158, -261, 192, 25, -84, 24, 15, -9, -6, 0, 35, -45, -58, 189, -58, -365, 487, 258, -1204, 669, 1719, -3202, -557, 14754, 18815, 4332, -4076, 317, 1690, -1000, -368, 697, -157, -261, 192, 25, -84, 24, 15, -9,
+ -6, 0, 35, -45, -59, 189, -57, -365, 487, 260, -1204, 666, 1721, -3197, -568, 14740, 18820, 4348, -4076, 312, 1692, -998, -369, 697, -156, -262, 192, 25, -84, 24, 15, -9, -6, 0, 35, -45, -59, 188, -57, -366, 486, 261, -1204, 663, 1724, -3193, -579, 14726, 18830, 4363, -4076, 307, 1694, -997, -371, 697, -155, -262, 192, 26, -84, 24, 15, -9,
+ -6, 0, 35, -45, -59, 188, -56, -366, 485, 263, -1204, 660, 1726, -3189, -589, 14712, 18837, 4378, -4076, 302, 1697, -996, -373, 698, -155, -263, 192, 26, -84, 24, 15, -9, -6, 0, 35, -45, -59, 188, -56, -366, 484, 264, -1203, 657, 1729, -3184, -600, 14697, 18843, 4394, -4076, 297, 1699, -994, -375, 698, -154, -263, 192, 26, -84, 24, 15, -9,
+ -6, 0, 35, -44, -59, 188, -55, -367, 483, 265, -1203, 654, 1731, -3180, -611, 14683, 18853, 4409, -4076, 292, 1701, -993, -377, 698, -153, -264, 192, 26, -84, 24, 15, -9, -6, 0, 35, -44, -59, 188, -55, -367, 482, 267, -1203, 651, 1734, -3176, -622, 14669, 18858, 4425, -4076, 287, 1703, -991, -379, 698, -152, -264, 192, 27, -84, 24, 15, -9,
+ -6, 0, 35, -44, -60, 188, -54, -367, 481, 268, -1202, 647, 1736, -3171, -633, 14655, 18868, 4440, -4076, 282, 1705, -990, -380, 698, -151, -265, 191, 27, -84, 24, 15, -9, -6, 0, 35, -44, -60, 188, -54, -367, 480, 270, -1202, 644, 1738, -3167, -643, 14641, 18873, 4456, -4076, 277, 1708, -989, -382, 699, -150, -265, 191, 27, -84, 24, 15, -9,
+ -6, 0, 35, -44, -60, 187, -53, -368, 479, 271, -1202, 641, 1741, -3163, -654, 14627, 18884, 4471, -4076, 272, 1710, -987, -384, 699, -150, -266, 191, 27, -84, 24, 15, -9, -6, 0, 35, -44, -60, 187, -52, -368, 479, 273, -1202, 638, 1743, -3158, -665, 14613, 18891, 4486, -4076, 267, 1712, -986, -386, 699, -149, -266, 191, 28, -85, 23, 15, -9,
+ -6, -1, 35, -44, -60, 187, -52, -368, 478, 274, -1201, 635, 1746, -3154, -676, 14599, 18899, 4502, -4076, 262, 1714, -984, -388, 699, -148, -267, 191, 28, -85, 23, 15, -9, -6, -1, 35, -44, -60, 187, -51, -369, 477, 276, -1201, 632, 1748, -3150, -686, 14585, 18906, 4517, -4076, 257, 1716, -983, -389, 699, -147, -267, 191, 28, -85, 23, 15, -9,
+ -6, -1, 35, -43, -60, 187, -51, -369, 476, 277, -1201, 629, 1750, -3145, -697, 14571, 18912, 4533, -4076, 252, 1718, -981, -391, 699, -146, -268, 191, 29, -85, 23, 15, -9, -6, -1, 35, -43, -61, 187, -50, -369, 475, 279, -1200, 626, 1753, -3141, -708, 14556, 18920, 4548, -4076, 247, 1720, -980, -393, 700, -145, -268, 190, 29, -85, 23, 15, -9,
+ -6, -1, 35, -43, -61, 187, -50, -369, 474, 280, -1200, 622, 1755, -3136, -718, 14542, 18929, 4564, -4076, 242, 1722, -978, -395, 700, -145, -269, 190, 29, -85, 23, 15, -9, -6, -1, 35, -43, -61, 186, -49, -370, 473, 281, -1200, 619, 1758, -3132, -729, 14528, 18937, 4579, -4075, 237, 1725, -977, -397, 700, -144, -269, 190, 29, -85, 23, 15, -9,
+ -6, -1, 35, -43, -61, 186, -49, -370, 472, 283, -1199, 616, 1760, -3128, -740, 14514, 18943, 4595, -4075, 232, 1727, -975, -399, 700, -143, -270, 190, 30, -85, 23, 15, -9, -6, -1, 35, -43, -61, 186, -48, -370, 471, 284, -1199, 613, 1762, -3123, -750, 14500, 18950, 4610, -4075, 226, 1729, -974, -400, 700, -142, -270, 190, 30, -85, 23, 15, -9,
+ -5, -1, 35, -43, -61, 186, -47, -370, 471, 286, -1199, 610, 1765, -3119, -761, 14485, 18955, 4626, -4075, 221, 1731, -972, -402, 700, -141, -271, 190, 30, -85, 23, 15, -9, -5, -1, 35, -43, -62, 186, -47, -371, 470, 287, -1198, 607, 1767, -3114, -771, 14471, 18963, 4641, -4075, 216, 1733, -971, -404, 700, -140, -271, 190, 30, -85, 23, 16, -9,
+ -5, -1, 35, -42, -62, 186, -46, -371, 469, 289, -1198, 604, 1769, -3110, -782, 14457, 18968, 4657, -4074, 211, 1735, -969, -406, 701, -140, -272, 189, 31, -85, 23, 16, -9, -5, -1, 35, -42, -62, 185, -46, -371, 468, 290, -1198, 601, 1772, -3105, -793, 14443, 18977, 4672, -4074, 206, 1737, -968, -408, 701, -139, -272, 189, 31, -85, 23, 16, -9,
+ -5, -1, 35, -42, -62, 185, -45, -371, 467, 291, -1197, 597, 1774, -3101, -803, 14428, 18983, 4688, -4074, 201, 1739, -966, -409, 701, -138, -272, 189, 31, -85, 23, 16, -9, -5, -1, 35, -42, -62, 185, -45, -372, 466, 293, -1197, 594, 1776, -3096, -814, 14414, 18991, 4704, -4074, 196, 1741, -965, -411, 701, -137, -273, 189, 32, -85, 23, 16, -9,
+ -5, -1, 35, -42, -62, 185, -44, -372, 465, 294, -1197, 591, 1779, -3092, -824, 14400, 18997, 4719, -4073, 191, 1743, -963, -413, 701, -136, -273, 189, 32, -86, 23, 16, -9, -5, -1, 35, -42, -63, 185, -44, -372, 464, 296, -1196, 588, 1781, -3087, -835, 14385, 19006, 4735, -4073, 186, 1746, -962, -415, 701, -135, -274, 189, 32, -86, 22, 16, -9,
+ -5, -1, 35, -42, -63, 185, -43, -373, 463, 297, -1196, 585, 1783, -3083, -845, 14371, 19015, 4750, -4073, 181, 1748, -960, -417, 701, -134, -274, 188, 32, -86, 22, 16, -9, -5, -1, 35, -42, -63, 185, -42, -373, 462, 299, -1195, 582, 1785, -3078, -856, 14357, 19019, 4766, -4072, 176, 1750, -959, -419, 702, -134, -275, 188, 33, -86, 22, 16, -9,
+ -5, -1, 35, -41, -63, 184, -42, -373, 462, 300, -1195, 579, 1788, -3074, -866, 14342, 19026, 4781, -4072, 170, 1752, -957, -420, 702, -133, -275, 188, 33, -86, 22, 16, -9, -5, -1, 35, -41, -63, 184, -41, -373, 461, 301, -1195, 576, 1790, -3069, -876, 14328, 19033, 4797, -4072, 165, 1754, -956, -422, 702, -132, -276, 188, 33, -86, 22, 16, -9,
+ -5, -1, 35, -41, -63, 184, -41, -373, 460, 303, -1194, 572, 1792, -3065, -887, 14314, 19038, 4813, -4071, 160, 1756, -954, -424, 702, -131, -276, 188, 34, -86, 22, 16, -9, -5, -1, 35, -41, -63, 184, -40, -374, 459, 304, -1194, 569, 1794, -3060, -897, 14299, 19048, 4828, -4071, 155, 1758, -953, -426, 702, -130, -277, 188, 34, -86, 22, 16, -9,
+ -5, -1, 35, -41, -64, 184, -40, -374, 458, 306, -1193, 566, 1797, -3056, -908, 14285, 19055, 4844, -4071, 150, 1760, -951, -428, 702, -129, -277, 187, 34, -86, 22, 16, -9, -5, -1, 35, -41, -64, 184, -39, -374, 457, 307, -1193, 563, 1799, -3051, -918, 14270, 19062, 4859, -4070, 145, 1762, -950, -429, 702, -128, -278, 187, 34, -86, 22, 16, -9,
+ -5, -1, 35, -41, -64, 183, -39, -374, 456, 308, -1193, 560, 1801, -3047, -928, 14256, 19070, 4875, -4070, 140, 1764, -948, -431, 702, -128, -278, 187, 35, -86, 22, 16, -9, -5, -1, 35, -41, -64, 183, -38, -375, 455, 310, -1192, 557, 1803, -3042, -939, 14242, 19075, 4891, -4069, 135, 1766, -946, -433, 702, -127, -279, 187, 35, -86, 22, 16, -9,
+ -5, -1, 35, -40, -64, 183, -37, -375, 454, 311, -1192, 554, 1805, -3038, -949, 14227, 19083, 4906, -4069, 129, 1768, -945, -435, 703, -126, -279, 187, 35, -86, 22, 16, -9, -5, -1, 35, -40, -64, 183, -37, -375, 453, 313, -1191, 551, 1808, -3033, -959, 14213, 19086, 4922, -4068, 124, 1770, -943, -437, 703, -125, -280, 187, 35, -86, 22, 16, -9,
+ -5, -1, 35, -40, -65, 183, -36, -375, 452, 314, -1191, 547, 1810, -3029, -969, 14198, 19094, 4938, -4068, 119, 1772, -942, -438, 703, -124, -280, 187, 36, -86, 22, 16, -9, -5, -1, 35, -40, -65, 183, -36, -376, 451, 315, -1191, 544, 1812, -3024, -980, 14184, 19106, 4953, -4067, 114, 1774, -940, -440, 703, -123, -281, 186, 36, -87, 21, 16, -9,
+ -5, -1, 35, -40, -65, 183, -35, -376, 451, 317, -1190, 541, 1814, -3019, -990, 14169, 19110, 4969, -4067, 109, 1776, -939, -442, 703, -122, -281, 186, 36, -87, 21, 16, -9, -5, -1, 35, -40, -65, 182, -35, -376, 450, 318, -1190, 538, 1816, -3015, -1000, 14155, 19117, 4985, -4066, 104, 1778, -937, -444, 703, -122, -282, 186, 37, -87, 21, 17, -9,
+ -5, -2, 35, -40, -65, 182, -34, -376, 449, 320, -1189, 535, 1818, -3010, -1010, 14140, 19124, 5000, -4066, 98, 1780, -935, -446, 703, -121, -282, 186, 37, -87, 21, 17, -9, -5, -2, 35, -40, -65, 182, -34, -377, 448, 321, -1189, 532, 1821, -3006, -1021, 14126, 19132, 5016, -4065, 93, 1782, -934, -447, 703, -120, -283, 186, 37, -87, 21, 17, -9,
+ -5, -2, 35, -39, -65, 182, -33, -377, 447, 322, -1188, 529, 1823, -3001, -1031, 14111, 19135, 5032, -4064, 88, 1784, -932, -449, 703, -119, -283, 186, 37, -87, 21, 17, -9, -5, -2, 35, -39, -66, 182, -32, -377, 446, 324, -1188, 526, 1825, -2996, -1041, 14097, 19142, 5047, -4064, 83, 1786, -931, -451, 703, -118, -283, 185, 38, -87, 21, 17, -9,
+ -5, -2, 35, -39, -66, 182, -32, -377, 445, 325, -1187, 522, 1827, -2992, -1051, 14082, 19150, 5063, -4063, 78, 1788, -929, -453, 703, -117, -284, 185, 38, -87, 21, 17, -9, -5, -2, 35, -39, -66, 181, -31, -377, 444, 327, -1187, 519, 1829, -2987, -1061, 14068, 19155, 5079, -4063, 72, 1790, -927, -455, 704, -116, -284, 185, 38, -87, 21, 17, -9,
+ -5, -2, 35, -39, -66, 181, -31, -378, 443, 328, -1186, 516, 1831, -2982, -1071, 14053, 19163, 5095, -4062, 67, 1792, -926, -457, 704, -116, -285, 185, 39, -87, 21, 17, -9, -5, -2, 35, -39, -66, 181, -30, -378, 442, 329, -1186, 513, 1833, -2978, -1081, 14038, 19169, 5110, -4061, 62, 1794, -924, -458, 704, -115, -285, 185, 39, -87, 21, 17, -9,
+ -5, -2, 35, -39, -66, 181, -30, -378, 441, 331, -1186, 510, 1835, -2973, -1091, 14024, 19176, 5126, -4061, 57, 1796, -922, -460, 704, -114, -286, 184, 39, -87, 21, 17, -9, -5, -2, 35, -39, -66, 181, -29, -378, 440, 332, -1185, 507, 1837, -2969, -1102, 14009, 19183, 5142, -4060, 52, 1798, -921, -462, 704, -113, -286, 184, 39, -87, 21, 17, -9,
+ -5, -2, 35, -38, -67, 181, -29, -379, 439, 333, -1185, 504, 1839, -2964, -1112, 13995, 19190, 5158, -4059, 46, 1800, -919, -464, 704, -112, -287, 184, 40, -87, 21, 17, -9, -5, -2, 35, -38, -67, 180, -28, -379, 438, 335, -1184, 501, 1842, -2959, -1122, 13980, 19195, 5173, -4058, 41, 1802, -918, -466, 704, -111, -287, 184, 40, -87, 21, 17, -9,
+ -5, -2, 35, -38, -67, 180, -28, -379, 438, 336, -1184, 497, 1844, -2954, -1132, 13965, 19204, 5189, -4058, 36, 1803, -916, -467, 704, -110, -288, 184, 40, -87, 20, 17, -9, -5, -2, 35, -38, -67, 180, -27, -379, 437, 337, -1183, 494, 1846, -2950, -1142, 13951, 19207, 5205, -4057, 31, 1805, -914, -469, 704, -109, -288, 184, 41, -87, 20, 17, -9,
+ -5, -2, 35, -38, -67, 180, -26, -379, 436, 339, -1183, 491, 1848, -2945, -1152, 13936, 19216, 5221, -4056, 26, 1807, -913, -471, 704, -109, -289, 183, 41, -88, 20, 17, -9, -5, -2, 35, -38, -67, 180, -26, -380, 435, 340, -1182, 488, 1850, -2940, -1162, 13921, 19223, 5237, -4055, 20, 1809, -911, -473, 704, -108, -289, 183, 41, -88, 20, 17, -9,
+ -5, -2, 35, -38, -68, 180, -25, -380, 434, 342, -1182, 485, 1852, -2936, -1172, 13907, 19231, 5252, -4055, 15, 1811, -909, -475, 704, -107, -290, 183, 41, -88, 20, 17, -9, -5, -2, 35, -37, -68, 179, -25, -380, 433, 343, -1181, 482, 1854, -2931, -1181, 13892, 19234, 5268, -4054, 10, 1813, -908, -476, 704, -106, -290, 183, 42, -88, 20, 17, -9,
+ -5, -2, 35, -37, -68, 179, -24, -380, 432, 344, -1181, 479, 1856, -2926, -1191, 13877, 19239, 5284, -4053, 5, 1815, -906, -478, 704, -105, -290, 183, 42, -88, 20, 17, -9, -5, -2, 35, -37, -68, 179, -24, -380, 431, 346, -1180, 476, 1858, -2922, -1201, 13863, 19246, 5300, -4052, -1, 1817, -904, -480, 704, -104, -291, 182, 42, -88, 20, 17, -9,
+ -5, -2, 35, -37, -68, 179, -23, -381, 430, 347, -1180, 472, 1860, -2917, -1211, 13848, 19253, 5316, -4051, -6, 1819, -903, -482, 704, -103, -291, 182, 43, -88, 20, 17, -9, -5, -2, 35, -37, -68, 179, -23, -381, 429, 348, -1179, 469, 1862, -2912, -1221, 13833, 19258, 5331, -4050, -11, 1821, -901, -483, 704, -102, -292, 182, 43, -88, 20, 18, -9,
+ -5, -2, 35, -37, -68, 178, -22, -381, 428, 350, -1178, 466, 1864, -2907, -1231, 13818, 19263, 5347, -4049, -16, 1822, -899, -485, 704, -101, -292, 182, 43, -88, 20, 18, -9, -5, -2, 35, -37, -69, 178, -22, -381, 427, 351, -1178, 463, 1866, -2903, -1241, 13804, 19273, 5363, -4048, -22, 1824, -897, -487, 704, -101, -293, 182, 43, -88, 20, 18, -9,
+ -5, -2, 35, -37, -69, 178, -21, -381, 426, 352, -1177, 460, 1868, -2898, -1251, 13789, 19278, 5379, -4048, -27, 1826, -896, -489, 704, -100, -293, 182, 44, -88, 20, 18, -9, -5, -2, 35, -36, -69, 178, -21, -382, 425, 354, -1177, 457, 1870, -2893, -1260, 13774, 19284, 5395, -4047, -32, 1828, -894, -491, 704, -99, -294, 181, 44, -88, 20, 18, -9,
+ -5, -2, 35, -36, -69, 178, -20, -382, 424, 355, -1176, 454, 1871, -2888, -1270, 13759, 19289, 5411, -4046, -38, 1830, -892, -492, 705, -98, -294, 181, 44, -88, 19, 18, -9, -5, -2, 35, -36, -69, 178, -19, -382, 423, 356, -1176, 451, 1873, -2883, -1280, 13744, 19296, 5426, -4045, -43, 1832, -891, -494, 705, -97, -295, 181, 45, -88, 19, 18, -9,
+ -5, -2, 35, -36, -69, 177, -19, -382, 422, 358, -1175, 447, 1875, -2879, -1290, 13730, 19303, 5442, -4044, -48, 1833, -889, -496, 705, -96, -295, 181, 45, -88, 19, 18, -9, -5, -2, 35, -36, -69, 177, -18, -382, 422, 359, -1175, 444, 1877, -2874, -1299, 13715, 19306, 5458, -4043, -53, 1835, -887, -498, 705, -95, -295, 181, 45, -88, 19, 18, -9,
+ -5, -2, 35, -36, -69, 177, -18, -382, 421, 360, -1174, 441, 1879, -2869, -1309, 13700, 19314, 5474, -4042, -59, 1837, -885, -500, 705, -94, -296, 180, 45, -88, 19, 18, -9, -5, -2, 35, -36, -70, 177, -17, -383, 420, 362, -1174, 438, 1881, -2864, -1319, 13685, 19319, 5490, -4041, -64, 1839, -884, -501, 705, -93, -296, 180, 46, -88, 19, 18, -9,
+ -5, -2, 35, -36, -70, 177, -17, -383, 419, 363, -1173, 435, 1883, -2859, -1329, 13670, 19326, 5506, -4040, -69, 1841, -882, -503, 705, -92, -297, 180, 46, -89, 19, 18, -9, -5, -2, 35, -35, -70, 177, -16, -383, 418, 364, -1172, 432, 1885, -2855, -1338, 13655, 19330, 5522, -4038, -75, 1843, -880, -505, 705, -92, -297, 180, 46, -89, 19, 18, -9,
+ -5, -2, 35, -35, -70, 176, -16, -383, 417, 366, -1172, 429, 1887, -2850, -1348, 13640, 19338, 5538, -4037, -80, 1844, -879, -507, 705, -91, -298, 180, 47, -89, 19, 18, -9, -5, -3, 35, -35, -70, 176, -15, -383, 416, 367, -1171, 426, 1889, -2845, -1358, 13626, 19343, 5554, -4036, -85, 1846, -877, -509, 705, -90, -298, 179, 47, -89, 19, 18, -9,
+ -5, -3, 35, -35, -70, 176, -15, -384, 415, 368, -1171, 423, 1890, -2840, -1367, 13611, 19351, 5570, -4035, -91, 1848, -875, -510, 705, -89, -299, 179, 47, -89, 19, 18, -9, -5, -3, 35, -35, -70, 176, -14, -384, 414, 369, -1170, 419, 1892, -2835, -1377, 13596, 19357, 5585, -4034, -96, 1850, -873, -512, 705, -88, -299, 179, 47, -89, 19, 18, -9,
+ -5, -3, 35, -35, -71, 176, -13, -384, 413, 371, -1169, 416, 1894, -2830, -1386, 13581, 19360, 5601, -4033, -101, 1852, -872, -514, 705, -87, -299, 179, 48, -89, 19, 18, -9, -5, -3, 35, -35, -71, 175, -13, -384, 412, 372, -1169, 413, 1896, -2826, -1396, 13566, 19372, 5617, -4032, -107, 1853, -870, -516, 705, -86, -300, 179, 48, -89, 18, 18, -9,
+ -5, -3, 35, -35, -71, 175, -12, -384, 411, 373, -1168, 410, 1898, -2821, -1406, 13551, 19376, 5633, -4031, -112, 1855, -868, -517, 705, -85, -300, 178, 48, -89, 18, 18, -9, -5, -3, 35, -34, -71, 175, -12, -384, 410, 375, -1168, 407, 1900, -2816, -1415, 13536, 19379, 5649, -4029, -117, 1857, -866, -519, 705, -84, -301, 178, 48, -89, 18, 18, -9,
+ -5, -3, 35, -34, -71, 175, -11, -385, 409, 376, -1167, 404, 1901, -2811, -1425, 13521, 19385, 5665, -4028, -123, 1859, -864, -521, 705, -83, -301, 178, 49, -89, 18, 18, -9, -5, -3, 35, -34, -71, 175, -11, -385, 408, 377, -1166, 401, 1903, -2806, -1434, 13506, 19392, 5681, -4027, -128, 1860, -863, -523, 705, -83, -302, 178, 49, -89, 18, 19, -9,
+ -5, -3, 35, -34, -71, 175, -10, -385, 407, 379, -1166, 398, 1905, -2801, -1444, 13491, 19397, 5697, -4026, -133, 1862, -861, -525, 704, -82, -302, 178, 49, -89, 18, 19, -9, -5, -3, 35, -34, -72, 174, -10, -385, 406, 380, -1165, 394, 1907, -2796, -1453, 13476, 19404, 5713, -4024, -139, 1864, -859, -526, 704, -81, -303, 177, 50, -89, 18, 19, -9,
+ -5, -3, 35, -34, -72, 174, -9, -385, 405, 381, -1165, 391, 1909, -2791, -1463, 13461, 19409, 5729, -4023, -144, 1866, -857, -528, 704, -80, -303, 177, 50, -89, 18, 19, -9, -5, -3, 35, -34, -72, 174, -9, -385, 404, 382, -1164, 388, 1910, -2786, -1472, 13446, 19415, 5745, -4022, -149, 1867, -855, -530, 704, -79, -303, 177, 50, -89, 18, 19, -9,
+ -5, -3, 35, -34, -72, 174, -8, -385, 403, 384, -1163, 385, 1912, -2782, -1481, 13431, 19421, 5761, -4021, -155, 1869, -854, -532, 704, -78, -304, 177, 50, -89, 18, 19, -9, -5, -3, 35, -33, -72, 174, -8, -386, 402, 385, -1163, 382, 1914, -2777, -1491, 13416, 19425, 5777, -4019, -160, 1871, -852, -534, 704, -77, -304, 177, 51, -89, 18, 19, -9,
+ -5, -3, 35, -33, -72, 173, -7, -386, 401, 386, -1162, 379, 1916, -2772, -1500, 13401, 19430, 5793, -4018, -165, 1873, -850, -535, 704, -76, -305, 176, 51, -89, 18, 19, -9, -5, -3, 34, -33, -72, 173, -7, -386, 400, 388, -1161, 376, 1917, -2767, -1510, 13386, 19439, 5809, -4017, -171, 1874, -848, -537, 704, -75, -305, 176, 51, -90, 18, 19, -9,
+ -5, -3, 34, -33, -72, 173, -6, -386, 399, 389, -1161, 373, 1919, -2762, -1519, 13371, 19443, 5825, -4015, -176, 1876, -846, -539, 704, -74, -306, 176, 52, -90, 17, 19, -9, -5, -3, 34, -33, -73, 173, -5, -386, 398, 390, -1160, 370, 1921, -2757, -1528, 13356, 19449, 5841, -4014, -182, 1878, -845, -541, 704, -73, -306, 176, 52, -90, 17, 19, -9,
+ -5, -3, 34, -33, -73, 173, -5, -386, 397, 391, -1159, 367, 1922, -2752, -1538, 13341, 19454, 5857, -4012, -187, 1879, -843, -542, 704, -72, -306, 176, 52, -90, 17, 19, -9, -5, -3, 34, -33, -73, 172, -4, -386, 397, 393, -1159, 363, 1924, -2747, -1547, 13326, 19461, 5873, -4011, -192, 1881, -841, -544, 704, -72, -307, 175, 52, -90, 17, 19, -9,
+ -5, -3, 34, -33, -73, 172, -4, -387, 396, 394, -1158, 360, 1926, -2742, -1556, 13311, 19466, 5889, -4010, -198, 1883, -839, -546, 704, -71, -307, 175, 53, -90, 17, 19, -9, -5, -3, 34, -32, -73, 172, -3, -387, 395, 395, -1157, 357, 1927, -2737, -1565, 13296, 19470, 5905, -4008, -203, 1884, -837, -548, 704, -70, -308, 175, 53, -90, 17, 19, -9,
+ -5, -3, 34, -32, -73, 172, -3, -387, 394, 396, -1157, 354, 1929, -2732, -1575, 13281, 19476, 5921, -4007, -209, 1886, -835, -549, 704, -69, -308, 175, 53, -90, 17, 19, -9, -5, -3, 34, -32, -73, 172, -2, -387, 393, 398, -1156, 351, 1931, -2727, -1584, 13265, 19480, 5937, -4005, -214, 1888, -834, -551, 704, -68, -309, 174, 54, -90, 17, 19, -9,
+ -5, -3, 34, -32, -73, 171, -2, -387, 392, 399, -1155, 348, 1932, -2722, -1593, 13250, 19487, 5953, -4004, -219, 1889, -832, -553, 704, -67, -309, 174, 54, -90, 17, 19, -9, -5, -3, 34, -32, -74, 171, -1, -387, 391, 400, -1155, 345, 1934, -2717, -1602, 13235, 19492, 5969, -4002, -225, 1891, -830, -555, 704, -66, -309, 174, 54, -90, 17, 19, -9,
+ -5, -3, 34, -32, -74, 171, -1, -387, 390, 401, -1154, 342, 1936, -2712, -1612, 13220, 19498, 5985, -4001, -230, 1893, -828, -557, 704, -65, -310, 174, 54, -90, 17, 19, -9, -5, -3, 34, -32, -74, 171, 0, -388, 389, 403, -1153, 339, 1937, -2707, -1621, 13205, 19501, 6001, -3999, -236, 1894, -826, -558, 704, -64, -310, 174, 55, -90, 17, 19, -9,
+ -4, -3, 34, -32, -74, 171, 0, -388, 388, 404, -1153, 336, 1939, -2702, -1630, 13190, 19507, 6017, -3997, -241, 1896, -824, -560, 703, -63, -311, 173, 55, -90, 17, 19, -9, -4, -3, 34, -31, -74, 171, 1, -388, 387, 405, -1152, 332, 1941, -2697, -1639, 13174, 19510, 6034, -3996, -246, 1898, -822, -562, 703, -62, -311, 173, 55, -90, 16, 20, -9,
+ -4, -3, 34, -31, -74, 170, 1, -388, 386, 406, -1151, 329, 1942, -2692, -1648, 13159, 19517, 6050, -3994, -252, 1899, -820, -564, 703, -61, -312, 173, 56, -90, 16, 20, -9, -4, -3, 34, -31, -74, 170, 2, -388, 385, 408, -1151, 326, 1944, -2687, -1657, 13144, 19520, 6066, -3993, -257, 1901, -819, -565, 703, -60, -312, 173, 56, -90, 16, 20, -9,
+ -4, -3, 34, -31, -74, 170, 2, -388, 384, 409, -1150, 323, 1945, -2682, -1666, 13129, 19527, 6082, -3991, -263, 1903, -817, -567, 703, -60, -312, 172, 56, -90, 16, 20, -9, -4, -3, 34, -31, -75, 170, 3, -388, 383, 410, -1149, 320, 1947, -2677, -1675, 13114, 19532, 6098, -3989, -268, 1904, -815, -569, 703, -59, -313, 172, 56, -90, 16, 20, -9,
+ -4, -3, 34, -31, -75, 170, 3, -388, 382, 411, -1148, 317, 1949, -2672, -1685, 13098, 19538, 6114, -3988, -274, 1906, -813, -571, 703, -58, -313, 172, 57, -90, 16, 20, -9, -4, -3, 34, -31, -75, 169, 4, -389, 381, 413, -1148, 314, 1950, -2667, -1694, 13083, 19544, 6130, -3986, -279, 1907, -811, -572, 703, -57, -314, 172, 57, -90, 16, 20, -9,
+ -4, -4, 34, -31, -75, 169, 5, -389, 380, 414, -1147, 311, 1952, -2662, -1703, 13068, 19547, 6146, -3984, -284, 1909, -809, -574, 703, -56, -314, 172, 57, -90, 16, 20, -9, -4, -4, 34, -30, -75, 169, 5, -389, 379, 415, -1146, 308, 1953, -2657, -1712, 13053, 19553, 6162, -3983, -290, 1910, -807, -576, 703, -55, -314, 171, 58, -90, 16, 20, -9,
+ -4, -4, 34, -30, -75, 169, 6, -389, 378, 416, -1146, 305, 1955, -2652, -1721, 13038, 19558, 6178, -3981, -295, 1912, -805, -578, 703, -54, -315, 171, 58, -91, 16, 20, -9, -4, -4, 34, -30, -75, 169, 6, -389, 377, 418, -1145, 301, 1956, -2647, -1730, 13022, 19563, 6195, -3979, -301, 1914, -803, -579, 702, -53, -315, 171, 58, -91, 16, 20, -9,
+ -4, -4, 34, -30, -75, 168, 7, -389, 376, 419, -1144, 298, 1958, -2642, -1739, 13007, 19568, 6211, -3978, -306, 1915, -801, -581, 702, -52, -316, 171, 59, -91, 16, 20, -9, -4, -4, 34, -30, -76, 168, 7, -389, 375, 420, -1143, 295, 1959, -2637, -1747, 12992, 19576, 6227, -3976, -312, 1917, -800, -583, 702, -51, -316, 170, 59, -91, 15, 20, -9,
+ -4, -4, 34, -30, -76, 168, 8, -389, 374, 421, -1143, 292, 1961, -2632, -1756, 12976, 19582, 6243, -3974, -317, 1918, -798, -585, 702, -50, -317, 170, 59, -91, 15, 20, -9, -4, -4, 34, -30, -76, 168, 8, -389, 373, 422, -1142, 289, 1962, -2627, -1765, 12961, 19586, 6259, -3972, -323, 1920, -796, -586, 702, -49, -317, 170, 59, -91, 15, 20, -9,
+ -4, -4, 34, -30, -76, 168, 9, -390, 372, 424, -1141, 286, 1964, -2621, -1774, 12946, 19587, 6275, -3970, -328, 1921, -794, -588, 702, -48, -317, 170, 60, -91, 15, 20, -9, -4, -4, 34, -29, -76, 167, 9, -390, 371, 425, -1140, 283, 1965, -2616, -1783, 12930, 19596, 6291, -3969, -334, 1923, -792, -590, 702, -47, -318, 169, 60, -91, 15, 20, -9,
+ -4, -4, 34, -29, -76, 167, 10, -390, 370, 426, -1140, 280, 1967, -2611, -1792, 12915, 19599, 6308, -3967, -339, 1924, -790, -592, 702, -46, -318, 169, 60, -91, 15, 20, -9, -4, -4, 34, -29, -76, 167, 10, -390, 369, 427, -1139, 277, 1968, -2606, -1801, 12900, 19604, 6324, -3965, -345, 1926, -788, -593, 701, -45, -319, 169, 61, -91, 15, 20, -9,
+ -4, -4, 34, -29, -76, 167, 11, -390, 368, 428, -1138, 274, 1970, -2601, -1810, 12884, 19607, 6340, -3963, -350, 1928, -786, -595, 701, -44, -319, 169, 61, -91, 15, 20, -9, -4, -4, 34, -29, -76, 167, 11, -390, 367, 430, -1137, 271, 1971, -2596, -1818, 12869, 19612, 6356, -3961, -355, 1929, -784, -597, 701, -44, -319, 168, 61, -91, 15, 20, -9,
+ -4, -4, 34, -29, -77, 166, 12, -390, 366, 431, -1137, 268, 1973, -2591, -1827, 12854, 19619, 6372, -3959, -361, 1931, -782, -599, 701, -43, -320, 168, 61, -91, 15, 20, -9, -4, -4, 34, -29, -77, 166, 12, -390, 365, 432, -1136, 265, 1974, -2586, -1836, 12838, 19623, 6388, -3957, -366, 1932, -780, -600, 701, -42, -320, 168, 62, -91, 15, 20, -9,
+ -4, -4, 34, -29, -77, 166, 13, -390, 364, 433, -1135, 261, 1976, -2581, -1845, 12823, 19626, 6405, -3955, -372, 1934, -778, -602, 701, -41, -321, 168, 62, -91, 15, 21, -9, -4, -4, 34, -28, -77, 166, 13, -390, 363, 434, -1134, 258, 1977, -2575, -1853, 12808, 19628, 6421, -3953, -377, 1935, -776, -604, 701, -40, -321, 168, 62, -91, 15, 21, -9,
+ -4, -4, 34, -28, -77, 165, 14, -391, 362, 436, -1133, 255, 1978, -2570, -1862, 12792, 19635, 6437, -3951, -383, 1937, -774, -606, 701, -39, -321, 167, 63, -91, 14, 21, -9, -4, -4, 34, -28, -77, 165, 14, -391, 361, 437, -1133, 252, 1980, -2565, -1871, 12777, 19641, 6453, -3949, -388, 1938, -772, -607, 700, -38, -322, 167, 63, -91, 14, 21, -9,
+ -4, -4, 34, -28, -77, 165, 15, -391, 360, 438, -1132, 249, 1981, -2560, -1880, 12761, 19647, 6469, -3947, -394, 1939, -770, -609, 700, -37, -322, 167, 63, -91, 14, 21, -9, -4, -4, 34, -28, -77, 165, 15, -391, 359, 439, -1131, 246, 1983, -2555, -1888, 12746, 19649, 6486, -3945, -399, 1941, -768, -611, 700, -36, -323, 167, 63, -91, 14, 21, -9,
+ -4, -4, 34, -28, -77, 165, 16, -391, 358, 440, -1130, 243, 1984, -2550, -1897, 12731, 19653, 6502, -3943, -405, 1942, -766, -612, 700, -35, -323, 166, 64, -91, 14, 21, -9, -4, -4, 34, -28, -78, 164, 16, -391, 357, 442, -1129, 240, 1985, -2544, -1906, 12715, 19658, 6518, -3941, -410, 1944, -764, -614, 700, -34, -323, 166, 64, -91, 14, 21, -9,
+ -4, -4, 34, -28, -78, 164, 17, -391, 356, 443, -1129, 237, 1987, -2539, -1914, 12700, 19663, 6534, -3939, -416, 1945, -762, -616, 700, -33, -324, 166, 64, -91, 14, 21, -9, -4, -4, 34, -27, -78, 164, 17, -391, 355, 444, -1128, 234, 1988, -2534, -1923, 12684, 19668, 6550, -3937, -422, 1947, -760, -618, 699, -32, -324, 166, 65, -91, 14, 21, -9,
+ -4, -4, 34, -27, -78, 164, 18, -391, 354, 445, -1127, 231, 1989, -2529, -1931, 12669, 19671, 6567, -3935, -427, 1948, -758, -619, 699, -31, -325, 165, 65, -91, 14, 21, -9, -4, -4, 34, -27, -78, 164, 18, -391, 353, 446, -1126, 228, 1991, -2524, -1940, 12653, 19676, 6583, -3933, -433, 1950, -756, -621, 699, -30, -325, 165, 65, -91, 14, 21, -9,
+ -4, -4, 34, -27, -78, 163, 19, -391, 352, 447, -1125, 225, 1992, -2519, -1948, 12638, 19680, 6599, -3931, -438, 1951, -754, -623, 699, -29, -325, 165, 65, -91, 14, 21, -9, -4, -4, 34, -27, -78, 163, 19, -391, 351, 449, -1125, 222, 1993, -2513, -1957, 12622, 19686, 6615, -3928, -444, 1952, -752, -625, 699, -28, -326, 165, 66, -91, 13, 21, -9,
+ -4, -4, 34, -27, -78, 163, 20, -391, 350, 450, -1124, 219, 1995, -2508, -1966, 12607, 19688, 6632, -3926, -449, 1954, -750, -626, 699, -27, -326, 164, 66, -92, 13, 21, -9, -4, -4, 34, -27, -78, 163, 21, -392, 349, 451, -1123, 215, 1996, -2503, -1974, 12591, 19697, 6648, -3924, -455, 1955, -748, -628, 698, -26, -327, 164, 66, -92, 13, 21, -9,
+ -4, -4, 34, -27, -79, 163, 21, -392, 348, 452, -1122, 212, 1997, -2498, -1983, 12576, 19701, 6664, -3922, -460, 1957, -746, -630, 698, -25, -327, 164, 67, -92, 13, 21, -9, -4, -4, 34, -26, -79, 162, 22, -392, 347, 453, -1121, 209, 1999, -2493, -1991, 12560, 19704, 6680, -3920, -466, 1958, -744, -631, 698, -24, -327, 164, 67, -92, 13, 21, -9,
+ -4, -4, 34, -26, -79, 162, 22, -392, 346, 454, -1120, 206, 2000, -2487, -1999, 12545, 19707, 6697, -3917, -471, 1959, -742, -633, 698, -23, -328, 163, 67, -92, 13, 21, -9, -4, -4, 34, -26, -79, 162, 23, -392, 345, 455, -1120, 203, 2001, -2482, -2008, 12529, 19714, 6713, -3915, -477, 1961, -740, -635, 698, -23, -328, 163, 67, -92, 13, 21, -9,
+ -4, -4, 34, -26, -79, 162, 23, -392, 344, 457, -1119, 200, 2003, -2477, -2016, 12514, 19716, 6729, -3913, -482, 1962, -738, -637, 697, -22, -328, 163, 68, -92, 13, 21, -9, -4, -4, 34, -26, -79, 161, 24, -392, 343, 458, -1118, 197, 2004, -2472, -2025, 12498, 19723, 6745, -3911, -488, 1964, -736, -638, 697, -21, -329, 162, 68, -92, 13, 21, -9,
+ -4, -4, 34, -26, -79, 161, 24, -392, 342, 459, -1117, 194, 2005, -2466, -2033, 12483, 19723, 6762, -3908, -493, 1965, -734, -640, 697, -20, -329, 162, 68, -92, 13, 22, -9, -4, -4, 34, -26, -79, 161, 25, -392, 341, 460, -1116, 191, 2006, -2461, -2041, 12467, 19728, 6778, -3906, -499, 1966, -732, -642, 697, -19, -330, 162, 69, -92, 13, 22, -9,
+ -4, -4, 34, -26, -79, 161, 25, -392, 340, 461, -1115, 188, 2008, -2456, -2050, 12451, 19732, 6794, -3904, -505, 1968, -730, -643, 697, -18, -330, 162, 69, -92, 13, 22, -9, -4, -5, 33, -25, -80, 161, 26, -392, 339, 462, -1114, 185, 2009, -2451, -2058, 12436, 19738, 6810, -3901, -510, 1969, -727, -645, 696, -17, -330, 161, 69, -92, 12, 22, -9,
+ -4, -5, 33, -25, -80, 160, 26, -392, 338, 463, -1113, 182, 2010, -2445, -2066, 12420, 19744, 6827, -3899, -516, 1970, -725, -647, 696, -16, -331, 161, 69, -92, 12, 22, -9, -4, -5, 33, -25, -80, 160, 27, -392, 337, 465, -1113, 179, 2011, -2440, -2075, 12405, 19745, 6843, -3896, -521, 1972, -723, -649, 696, -15, -331, 161, 70, -92, 12, 22, -9,
+ -4, -5, 33, -25, -80, 160, 27, -392, 336, 466, -1112, 176, 2012, -2435, -2083, 12389, 19751, 6859, -3894, -527, 1973, -721, -650, 696, -14, -332, 161, 70, -92, 12, 22, -9, -4, -5, 33, -25, -80, 160, 28, -392, 335, 467, -1111, 173, 2014, -2430, -2091, 12373, 19754, 6876, -3892, -532, 1974, -719, -652, 696, -13, -332, 160, 70, -92, 12, 22, -9,
+ -4, -5, 33, -25, -80, 160, 28, -392, 334, 468, -1110, 170, 2015, -2424, -2100, 12358, 19757, 6892, -3889, -538, 1976, -717, -654, 695, -12, -332, 160, 71, -92, 12, 22, -9, -4, -5, 33, -25, -80, 159, 29, -392, 333, 469, -1109, 167, 2016, -2419, -2108, 12342, 19763, 6908, -3887, -544, 1977, -715, -655, 695, -11, -333, 160, 71, -92, 12, 22, -9,
+ -4, -5, 33, -25, -80, 159, 29, -392, 332, 470, -1108, 164, 2017, -2414, -2116, 12327, 19765, 6925, -3884, -549, 1978, -713, -657, 695, -10, -333, 160, 71, -92, 12, 22, -9, -4, -5, 33, -24, -80, 159, 30, -393, 331, 471, -1107, 161, 2018, -2409, -2124, 12311, 19770, 6941, -3882, -555, 1980, -711, -659, 695, -9, -333, 159, 71, -92, 12, 22, -9,
+ -4, -5, 33, -24, -80, 159, 30, -393, 330, 472, -1106, 158, 2019, -2403, -2132, 12295, 19774, 6957, -3879, -560, 1981, -709, -661, 694, -8, -334, 159, 72, -92, 12, 22, -9, -4, -5, 33, -24, -81, 158, 31, -393, 329, 473, -1105, 155, 2021, -2398, -2140, 12280, 19777, 6973, -3877, -566, 1982, -706, -662, 694, -7, -334, 159, 72, -92, 12, 22, -9,
+ -4, -5, 33, -24, -81, 158, 31, -393, 328, 475, -1105, 152, 2022, -2393, -2149, 12264, 19783, 6990, -3874, -571, 1983, -704, -664, 694, -6, -334, 158, 72, -92, 11, 22, -9, -4, -5, 33, -24, -81, 158, 32, -393, 327, 476, -1104, 149, 2023, -2387, -2157, 12248, 19786, 7006, -3872, -577, 1985, -702, -666, 694, -5, -335, 158, 73, -92, 11, 22, -9,
+ -4, -5, 33, -24, -81, 158, 32, -393, 326, 477, -1103, 145, 2024, -2382, -2165, 12233, 19790, 7022, -3869, -583, 1986, -700, -667, 694, -4, -335, 158, 73, -92, 11, 22, -9, -4, -5, 33, -24, -81, 158, 33, -393, 325, 478, -1102, 142, 2025, -2377, -2173, 12217, 19794, 7039, -3866, -588, 1987, -698, -669, 693, -3, -336, 158, 73, -92, 11, 22, -9,
+ -4, -5, 33, -24, -81, 157, 33, -393, 324, 479, -1101, 139, 2026, -2371, -2181, 12201, 19801, 7055, -3864, -594, 1988, -696, -671, 693, -2, -336, 157, 73, -92, 11, 22, -9, -4, -5, 33, -23, -81, 157, 34, -393, 323, 480, -1100, 136, 2027, -2366, -2189, 12185, 19800, 7071, -3861, -599, 1990, -694, -672, 693, -1, -336, 157, 74, -92, 11, 22, -9,
+ -4, -5, 33, -23, -81, 157, 34, -393, 322, 481, -1099, 133, 2028, -2361, -2197, 12170, 19805, 7088, -3859, -605, 1991, -692, -674, 693, 0, -337, 157, 74, -92, 11, 22, -9, -4, -5, 33, -23, -81, 157, 35, -393, 321, 482, -1098, 130, 2029, -2355, -2205, 12154, 19808, 7104, -3856, -611, 1992, -689, -676, 692, 1, -337, 157, 74, -92, 11, 22, -9,
+ -4, -5, 33, -23, -81, 156, 35, -393, 320, 483, -1097, 127, 2030, -2350, -2213, 12138, 19812, 7120, -3853, -616, 1993, -687, -677, 692, 2, -337, 156, 75, -92, 11, 22, -9, -4, -5, 33, -23, -82, 156, 36, -393, 319, 484, -1096, 124, 2032, -2345, -2221, 12123, 19814, 7137, -3851, -622, 1995, -685, -679, 692, 3, -338, 156, 75, -92, 11, 23, -9,
+ -4, -5, 33, -23, -82, 156, 36, -393, 317, 485, -1095, 121, 2033, -2339, -2229, 12107, 19819, 7153, -3848, -627, 1996, -683, -681, 691, 4, -338, 156, 75, -92, 11, 23, -9, -4, -5, 33, -23, -82, 156, 37, -393, 316, 487, -1094, 118, 2034, -2334, -2237, 12091, 19823, 7169, -3845, -633, 1997, -681, -682, 691, 5, -338, 155, 75, -92, 10, 23, -9,
+ -4, -5, 33, -23, -82, 156, 37, -393, 315, 488, -1093, 115, 2035, -2329, -2245, 12075, 19827, 7186, -3842, -639, 1998, -679, -684, 691, 6, -339, 155, 76, -92, 10, 23, -9, -4, -5, 33, -22, -82, 155, 38, -393, 314, 489, -1092, 112, 2036, -2323, -2253, 12060, 19829, 7202, -3840, -644, 1999, -677, -686, 691, 7, -339, 155, 76, -92, 10, 23, -9,
+ -4, -5, 33, -22, -82, 155, 38, -393, 313, 490, -1091, 109, 2037, -2318, -2261, 12044, 19833, 7219, -3837, -650, 2001, -674, -688, 690, 8, -340, 155, 76, -92, 10, 23, -9, -4, -5, 33, -22, -82, 155, 38, -393, 312, 491, -1091, 106, 2038, -2313, -2269, 12028, 19838, 7235, -3834, -656, 2002, -672, -689, 690, 9, -340, 154, 77, -92, 10, 23, -9,
+ -4, -5, 33, -22, -82, 155, 39, -393, 311, 492, -1090, 103, 2039, -2307, -2277, 12012, 19840, 7251, -3831, -661, 2003, -670, -691, 690, 10, -340, 154, 77, -92, 10, 23, -9, -4, -5, 33, -22, -82, 154, 39, -393, 310, 493, -1089, 100, 2040, -2302, -2284, 11997, 19845, 7268, -3828, -667, 2004, -668, -693, 690, 11, -341, 154, 77, -93, 10, 23, -9,
+ -4, -5, 33, -22, -82, 154, 40, -393, 309, 494, -1088, 97, 2041, -2297, -2292, 11981, 19850, 7284, -3826, -672, 2005, -666, -694, 689, 12, -341, 153, 77, -93, 10, 23, -9, -4, -5, 33, -22, -82, 154, 40, -393, 308, 495, -1087, 94, 2042, -2291, -2300, 11965, 19852, 7300, -3823, -678, 2006, -663, -696, 689, 13, -341, 153, 78, -93, 10, 23, -9,
+ -4, -5, 33, -22, -83, 154, 41, -393, 307, 496, -1086, 91, 2043, -2286, -2308, 11949, 19856, 7317, -3820, -684, 2008, -661, -698, 689, 14, -342, 153, 78, -93, 10, 23, -9, -4, -5, 33, -21, -83, 153, 41, -393, 306, 497, -1085, 88, 2044, -2280, -2316, 11933, 19859, 7333, -3817, -689, 2009, -659, -699, 688, 15, -342, 153, 78, -93, 10, 23, -9,
+ -4, -5, 33, -21, -83, 153, 42, -393, 305, 498, -1084, 85, 2045, -2275, -2323, 11918, 19861, 7350, -3814, -695, 2010, -657, -701, 688, 16, -342, 152, 79, -93, 9, 23, -9, -4, -5, 33, -21, -83, 153, 42, -393, 304, 499, -1083, 82, 2046, -2270, -2331, 11902, 19867, 7366, -3811, -701, 2011, -655, -703, 688, 17, -343, 152, 79, -93, 9, 23, -9,
+ -4, -5, 33, -21, -83, 153, 43, -393, 303, 500, -1082, 79, 2047, -2264, -2339, 11886, 19867, 7382, -3808, -706, 2012, -652, -704, 688, 18, -343, 152, 79, -93, 9, 23, -9, -4, -5, 33, -21, -83, 153, 43, -393, 302, 501, -1081, 76, 2047, -2259, -2347, 11870, 19874, 7399, -3805, -712, 2013, -650, -706, 687, 19, -343, 151, 79, -93, 9, 23, -9,
+ -4, -5, 33, -21, -83, 152, 44, -393, 301, 502, -1080, 73, 2048, -2253, -2354, 11854, 19876, 7415, -3802, -717, 2014, -648, -708, 687, 20, -344, 151, 80, -93, 9, 23, -9, -4, -5, 33, -21, -83, 152, 44, -393, 300, 503, -1079, 70, 2049, -2248, -2362, 11838, 19880, 7431, -3799, -723, 2015, -646, -709, 687, 21, -344, 151, 80, -93, 9, 23, -9,
+ -4, -5, 33, -21, -83, 152, 45, -393, 299, 504, -1078, 67, 2050, -2243, -2370, 11822, 19884, 7448, -3796, -729, 2016, -644, -711, 686, 22, -344, 151, 80, -93, 9, 23, -9, -3, -5, 33, -20, -83, 152, 45, -393, 298, 506, -1077, 64, 2051, -2237, -2377, 11807, 19881, 7464, -3793, -734, 2018, -641, -713, 686, 23, -345, 150, 81, -93, 9, 23, -9,
+ -3, -5, 33, -20, -83, 151, 46, -393, 297, 507, -1076, 61, 2052, -2232, -2385, 11791, 19884, 7481, -3790, -740, 2019, -639, -714, 686, 24, -345, 150, 81, -93, 9, 23, -9, -3, -5, 33, -20, -84, 151, 46, -393, 296, 508, -1075, 58, 2053, -2226, -2393, 11775, 19890, 7497, -3787, -746, 2020, -637, -716, 685, 25, -345, 150, 81, -93, 9, 23, -9,
+ -3, -5, 33, -20, -84, 151, 47, -393, 295, 509, -1074, 55, 2054, -2221, -2400, 11759, 19892, 7513, -3784, -751, 2021, -635, -717, 685, 26, -346, 149, 81, -93, 9, 24, -9, -3, -5, 33, -20, -84, 151, 47, -393, 294, 510, -1073, 52, 2055, -2216, -2408, 11743, 19895, 7530, -3781, -757, 2022, -632, -719, 685, 27, -346, 149, 82, -93, 8, 24, -9,
+ -3, -5, 32, -20, -84, 150, 48, -393, 293, 511, -1072, 49, 2056, -2210, -2415, 11727, 19900, 7546, -3778, -763, 2023, -630, -721, 684, 28, -346, 149, 82, -93, 8, 24, -9, -3, -6, 32, -20, -84, 150, 48, -393, 292, 512, -1071, 46, 2056, -2205, -2423, 11711, 19906, 7563, -3775, -768, 2024, -628, -722, 684, 29, -347, 148, 82, -93, 8, 24, -9,
+ -3, -6, 32, -20, -84, 150, 49, -393, 291, 513, -1070, 43, 2057, -2199, -2430, 11695, 19907, 7579, -3772, -774, 2025, -626, -724, 684, 30, -347, 148, 83, -93, 8, 24, -9, -3, -6, 32, -19, -84, 150, 49, -393, 290, 514, -1069, 41, 2058, -2194, -2438, 11679, 19908, 7596, -3768, -780, 2026, -623, -726, 683, 31, -347, 148, 83, -93, 8, 24, -9,
+ -3, -6, 32, -19, -84, 150, 50, -393, 289, 515, -1068, 38, 2059, -2188, -2445, 11664, 19908, 7612, -3765, -785, 2027, -621, -727, 683, 32, -348, 148, 83, -93, 8, 24, -9, -3, -6, 32, -19, -84, 149, 50, -393, 288, 516, -1067, 35, 2060, -2183, -2453, 11648, 19915, 7628, -3762, -791, 2028, -619, -729, 683, 33, -348, 147, 83, -93, 8, 24, -9,
+ -3, -6, 32, -19, -84, 149, 51, -393, 287, 517, -1065, 32, 2061, -2177, -2460, 11632, 19915, 7645, -3759, -797, 2029, -617, -731, 682, 34, -348, 147, 84, -93, 8, 24, -9, -3, -6, 32, -19, -84, 149, 51, -393, 286, 518, -1064, 29, 2061, -2172, -2468, 11616, 19919, 7661, -3756, -802, 2030, -614, -732, 682, 35, -349, 147, 84, -93, 8, 24, -9,
+ -3, -6, 32, -19, -84, 149, 52, -393, 285, 519, -1063, 26, 2062, -2166, -2475, 11600, 19920, 7678, -3752, -808, 2031, -612, -734, 682, 36, -349, 146, 84, -93, 8, 24, -9, -3, -6, 32, -19, -85, 148, 52, -393, 284, 520, -1062, 23, 2063, -2161, -2482, 11584, 19926, 7694, -3749, -814, 2032, -610, -736, 681, 37, -349, 146, 85, -93, 8, 24, -9,
+ -3, -6, 32, -19, -85, 148, 52, -393, 282, 521, -1061, 20, 2064, -2156, -2490, 11568, 19931, 7710, -3746, -819, 2033, -607, -737, 681, 38, -350, 146, 85, -93, 7, 24, -9, -3, -6, 32, -18, -85, 148, 53, -393, 281, 522, -1060, 17, 2064, -2150, -2497, 11552, 19933, 7727, -3743, -825, 2034, -605, -739, 681, 39, -350, 145, 85, -93, 7, 24, -9,
+ -3, -6, 32, -18, -85, 148, 53, -393, 280, 523, -1059, 14, 2065, -2145, -2505, 11536, 19937, 7743, -3739, -831, 2035, -603, -740, 680, 40, -350, 145, 85, -93, 7, 24, -9, -3, -6, 32, -18, -85, 147, 54, -393, 279, 524, -1058, 11, 2066, -2139, -2512, 11520, 19938, 7760, -3736, -836, 2036, -601, -742, 680, 41, -351, 145, 86, -93, 7, 24, -9,
+ -3, -6, 32, -18, -85, 147, 54, -393, 278, 525, -1057, 8, 2067, -2134, -2519, 11504, 19943, 7776, -3733, -842, 2037, -598, -744, 679, 42, -351, 144, 86, -93, 7, 24, -9, -3, -6, 32, -18, -85, 147, 55, -393, 277, 526, -1056, 5, 2067, -2128, -2527, 11488, 19944, 7793, -3729, -848, 2038, -596, -745, 679, 43, -351, 144, 86, -93, 7, 24, -9,
+ -3, -6, 32, -18, -85, 147, 55, -393, 276, 527, -1055, 2, 2068, -2123, -2534, 11472, 19947, 7809, -3726, -853, 2039, -594, -747, 679, 44, -352, 144, 87, -93, 7, 24, -9, -3, -6, 32, -18, -85, 146, 56, -393, 275, 528, -1054, -1, 2069, -2117, -2541, 11456, 19948, 7826, -3722, -859, 2040, -591, -749, 678, 45, -352, 144, 87, -93, 7, 24, -9,
+ -3, -6, 32, -18, -85, 146, 56, -393, 274, 529, -1053, -4, 2070, -2112, -2548, 11440, 19952, 7842, -3719, -865, 2041, -589, -750, 678, 46, -352, 143, 87, -93, 7, 24, -9, -3, -6, 32, -18, -85, 146, 57, -393, 273, 530, -1052, -7, 2070, -2106, -2556, 11424, 19956, 7858, -3716, -870, 2042, -587, -752, 678, 47, -353, 143, 87, -93, 7, 24, -9,
+ -3, -6, 32, -17, -85, 146, 57, -393, 272, 530, -1051, -10, 2071, -2101, -2563, 11408, 19957, 7875, -3712, -876, 2043, -584, -753, 677, 48, -353, 143, 88, -93, 6, 24, -9, -3, -6, 32, -17, -86, 145, 58, -393, 271, 531, -1049, -13, 2072, -2095, -2570, 11392, 19962, 7891, -3709, -882, 2043, -582, -755, 677, 49, -353, 142, 88, -93, 6, 24, -9,
+ -3, -6, 32, -17, -86, 145, 58, -392, 270, 532, -1048, -16, 2072, -2090, -2577, 11376, 19964, 7908, -3705, -887, 2044, -580, -757, 676, 50, -354, 142, 88, -93, 6, 25, -9, -3, -6, 32, -17, -86, 145, 59, -392, 269, 533, -1047, -19, 2073, -2084, -2584, 11360, 19963, 7924, -3702, -893, 2045, -577, -758, 676, 51, -354, 142, 89, -93, 6, 25, -9,
+ -3, -6, 32, -17, -86, 145, 59, -392, 268, 534, -1046, -21, 2074, -2079, -2591, 11344, 19965, 7941, -3698, -899, 2046, -575, -760, 676, 52, -354, 141, 89, -93, 6, 25, -9, -3, -6, 32, -17, -86, 144, 60, -392, 267, 535, -1045, -24, 2074, -2073, -2599, 11328, 19969, 7957, -3695, -904, 2047, -573, -761, 675, 53, -354, 141, 89, -93, 6, 25, -9,
+ -3, -6, 32, -17, -86, 144, 60, -392, 266, 536, -1044, -27, 2075, -2068, -2606, 11312, 19971, 7974, -3691, -910, 2048, -570, -763, 675, 54, -355, 141, 89, -93, 6, 25, -9, -3, -6, 32, -17, -86, 144, 60, -392, 265, 537, -1043, -30, 2076, -2062, -2613, 11296, 19975, 7990, -3688, -916, 2049, -568, -765, 674, 55, -355, 140, 90, -93, 6, 25, -9,
+ -3, -6, 32, -16, -86, 144, 61, -392, 264, 538, -1042, -33, 2076, -2057, -2620, 11280, 19975, 8006, -3684, -921, 2050, -566, -766, 674, 56, -355, 140, 90, -93, 6, 25, -9, -3, -6, 32, -16, -86, 144, 61, -392, 263, 539, -1041, -36, 2077, -2051, -2627, 11264, 19976, 8023, -3680, -927, 2051, -563, -768, 674, 57, -356, 140, 90, -93, 6, 25, -9,
+ -3, -6, 32, -16, -86, 143, 62, -392, 262, 540, -1040, -39, 2078, -2046, -2634, 11248, 19982, 8039, -3677, -933, 2051, -561, -769, 673, 58, -356, 139, 91, -93, 5, 25, -9, -3, -6, 32, -16, -86, 143, 62, -392, 261, 541, -1038, -42, 2078, -2040, -2641, 11232, 19983, 8056, -3673, -939, 2052, -559, -771, 673, 59, -356, 139, 91, -93, 5, 25, -9,
+ -3, -6, 32, -16, -86, 143, 63, -392, 260, 542, -1037, -45, 2079, -2035, -2648, 11215, 19986, 8072, -3669, -944, 2053, -556, -773, 672, 60, -357, 139, 91, -93, 5, 25, -9, -3, -6, 32, -16, -86, 143, 63, -392, 259, 543, -1036, -48, 2079, -2029, -2655, 11199, 19989, 8089, -3666, -950, 2054, -554, -774, 672, 61, -357, 138, 91, -93, 5, 25, -9,
+ -3, -6, 32, -16, -86, 142, 64, -392, 258, 544, -1035, -51, 2080, -2023, -2662, 11183, 19990, 8105, -3662, -956, 2055, -552, -776, 672, 62, -357, 138, 92, -93, 5, 25, -9, -3, -6, 32, -16, -87, 142, 64, -392, 256, 545, -1034, -54, 2081, -2018, -2669, 11167, 19993, 8122, -3658, -961, 2056, -549, -777, 671, 63, -358, 138, 92, -93, 5, 25, -9,
+ -3, -6, 32, -15, -87, 142, 65, -392, 255, 546, -1033, -56, 2081, -2012, -2676, 11151, 19996, 8138, -3655, -967, 2056, -547, -779, 671, 64, -358, 137, 92, -93, 5, 25, -9, -3, -6, 32, -15, -87, 142, 65, -392, 254, 547, -1032, -59, 2082, -2007, -2683, 11135, 19996, 8155, -3651, -973, 2057, -544, -781, 670, 65, -358, 137, 93, -93, 5, 25, -8,
+ -3, -6, 31, -15, -87, 141, 66, -392, 253, 547, -1030, -62, 2082, -2001, -2690, 11119, 19998, 8171, -3647, -978, 2058, -542, -782, 670, 66, -358, 137, 93, -93, 5, 25, -8, -3, -6, 31, -15, -87, 141, 66, -392, 252, 548, -1029, -65, 2083, -1996, -2696, 11103, 20002, 8188, -3643, -984, 2059, -540, -784, 669, 67, -359, 136, 93, -93, 5, 25, -8,
+ -3, -6, 31, -15, -87, 141, 66, -391, 251, 549, -1028, -68, 2083, -1990, -2703, 11087, 20004, 8204, -3640, -990, 2060, -537, -785, 669, 68, -359, 136, 93, -93, 4, 25, -8, -3, -6, 31, -15, -87, 141, 67, -391, 250, 550, -1027, -71, 2084, -1985, -2710, 11071, 20007, 8220, -3636, -996, 2060, -535, -787, 668, 69, -359, 136, 94, -93, 4, 25, -8,
+ -3, -6, 31, -15, -87, 140, 67, -391, 249, 551, -1026, -74, 2084, -1979, -2717, 11054, 20010, 8237, -3632, -1001, 2061, -532, -788, 668, 70, -360, 135, 94, -93, 4, 25, -8, -3, -6, 31, -15, -87, 140, 68, -391, 248, 552, -1025, -77, 2085, -1973, -2724, 11038, 20011, 8253, -3628, -1007, 2062, -530, -790, 668, 71, -360, 135, 94, -93, 4, 25, -8,
+ -3, -6, 31, -15, -87, 140, 68, -391, 247, 553, -1024, -80, 2085, -1968, -2731, 11022, 20014, 8270, -3624, -1013, 2063, -528, -792, 667, 72, -360, 135, 95, -93, 4, 25, -8, -3, -6, 31, -14, -87, 140, 69, -391, 246, 554, -1022, -83, 2086, -1962, -2737, 11006, 20011, 8286, -3620, -1018, 2063, -525, -793, 667, 73, -360, 134, 95, -93, 4, 25, -8,
+ -3, -6, 31, -14, -87, 139, 69, -391, 245, 555, -1021, -85, 2086, -1957, -2744, 10990, 20017, 8303, -3617, -1024, 2064, -523, -795, 666, 74, -361, 134, 95, -93, 4, 25, -8, -3, -6, 31, -14, -87, 139, 70, -391, 244, 556, -1020, -88, 2087, -1951, -2751, 10974, 20015, 8319, -3613, -1030, 2065, -520, -796, 666, 75, -361, 134, 95, -93, 4, 26, -8,
+ -3, -6, 31, -14, -87, 139, 70, -391, 243, 557, -1019, -91, 2087, -1946, -2758, 10958, 20019, 8336, -3609, -1036, 2066, -518, -798, 665, 76, -361, 133, 96, -93, 4, 26, -8, -3, -6, 31, -14, -88, 139, 70, -391, 242, 557, -1018, -94, 2088, -1940, -2764, 10941, 20023, 8352, -3605, -1041, 2066, -516, -799, 665, 77, -362, 133, 96, -93, 4, 26, -8,
+ -3, -6, 31, -14, -88, 138, 71, -391, 241, 558, -1017, -97, 2088, -1934, -2771, 10925, 20026, 8369, -3601, -1047, 2067, -513, -801, 664, 78, -362, 133, 96, -93, 3, 26, -8, -3, -6, 31, -14, -88, 138, 71, -391, 240, 559, -1015, -100, 2089, -1929, -2778, 10909, 20028, 8385, -3597, -1053, 2068, -511, -803, 664, 79, -362, 132, 97, -93, 3, 26, -8,
+ -3, -6, 31, -14, -88, 138, 72, -391, 239, 560, -1014, -103, 2089, -1923, -2784, 10893, 20027, 8402, -3593, -1058, 2068, -508, -804, 663, 80, -362, 132, 97, -93, 3, 26, -8, -3, -6, 31, -13, -88, 138, 72, -390, 238, 561, -1013, -106, 2090, -1918, -2791, 10877, 20029, 8418, -3589, -1064, 2069, -506, -806, 663, 81, -363, 132, 97, -93, 3, 26, -8,
+ -3, -7, 31, -13, -88, 137, 73, -390, 237, 562, -1012, -108, 2090, -1912, -2798, 10860, 20031, 8435, -3585, -1070, 2070, -503, -807, 663, 82, -363, 131, 97, -93, 3, 26, -8, -3, -7, 31, -13, -88, 137, 73, -390, 236, 563, -1011, -111, 2091, -1907, -2804, 10844, 20034, 8451, -3581, -1076, 2070, -501, -809, 662, 83, -363, 131, 98, -93, 3, 26, -8,
+ -3, -7, 31, -13, -88, 137, 74, -390, 235, 564, -1009, -114, 2091, -1901, -2811, 10828, 20032, 8468, -3577, -1081, 2071, -498, -810, 662, 84, -364, 131, 98, -93, 3, 26, -8, -3, -7, 31, -13, -88, 137, 74, -390, 233, 565, -1008, -117, 2091, -1895, -2817, 10812, 20037, 8484, -3573, -1087, 2072, -496, -812, 661, 85, -364, 130, 98, -93, 3, 26, -8,
+ -3, -7, 31, -13, -88, 136, 75, -390, 232, 565, -1007, -120, 2092, -1890, -2824, 10796, 20039, 8501, -3569, -1093, 2072, -494, -813, 661, 86, -364, 130, 99, -93, 3, 26, -8, -3, -7, 31, -13, -88, 136, 75, -390, 231, 566, -1006, -123, 2092, -1884, -2830, 10780, 20039, 8517, -3564, -1098, 2073, -491, -815, 660, 87, -364, 130, 99, -93, 3, 26, -8,
+ -3, -7, 31, -13, -88, 136, 75, -390, 230, 567, -1005, -126, 2093, -1879, -2837, 10763, 20045, 8533, -3560, -1104, 2074, -489, -816, 660, 88, -365, 129, 99, -93, 2, 26, -8, -3, -7, 31, -12, -88, 136, 76, -390, 229, 568, -1003, -128, 2093, -1873, -2843, 10747, 20043, 8550, -3556, -1110, 2074, -486, -818, 659, 89, -365, 129, 99, -93, 2, 26, -8,
+ -3, -7, 31, -12, -88, 135, 76, -390, 228, 569, -1002, -131, 2093, -1867, -2850, 10731, 20046, 8566, -3552, -1116, 2075, -484, -820, 659, 90, -365, 129, 100, -93, 2, 26, -8, -3, -7, 31, -12, -88, 135, 77, -390, 227, 570, -1001, -134, 2094, -1862, -2856, 10715, 20045, 8583, -3548, -1121, 2076, -481, -821, 658, 91, -365, 128, 100, -93, 2, 26, -8,
+ -3, -7, 31, -12, -88, 135, 77, -389, 226, 571, -1000, -137, 2094, -1856, -2863, 10698, 20049, 8599, -3544, -1127, 2076, -479, -823, 658, 93, -366, 128, 100, -93, 2, 26, -8, -3, -7, 31, -12, -89, 135, 78, -389, 225, 571, -999, -140, 2094, -1850, -2869, 10682, 20048, 8616, -3539, -1133, 2077, -476, -824, 657, 94, -366, 128, 101, -93, 2, 26, -8,
+ -3, -7, 31, -12, -89, 134, 78, -389, 224, 572, -997, -143, 2095, -1845, -2876, 10666, 20052, 8632, -3535, -1138, 2077, -474, -826, 657, 95, -366, 127, 101, -93, 2, 26, -8, -3, -7, 31, -12, -89, 134, 79, -389, 223, 573, -996, -145, 2095, -1839, -2882, 10650, 20050, 8649, -3531, -1144, 2078, -471, -827, 656, 96, -366, 127, 101, -93, 2, 26, -8,
+ -3, -7, 31, -12, -89, 134, 79, -389, 222, 574, -995, -148, 2095, -1834, -2888, 10633, 20055, 8665, -3527, -1150, 2079, -469, -829, 656, 97, -367, 127, 101, -93, 2, 26, -8, -3, -7, 31, -12, -89, 133, 79, -389, 221, 575, -994, -151, 2096, -1828, -2895, 10617, 20056, 8682, -3522, -1156, 2079, -466, -830, 655, 98, -367, 126, 102, -93, 2, 26, -8,
+ -3, -7, 31, -11, -89, 133, 80, -389, 220, 576, -992, -154, 2096, -1822, -2901, 10601, 20055, 8698, -3518, -1161, 2080, -464, -832, 655, 99, -367, 126, 102, -93, 1, 26, -8, -3, -7, 31, -11, -89, 133, 80, -389, 219, 576, -991, -157, 2096, -1817, -2907, 10585, 20059, 8715, -3514, -1167, 2080, -461, -833, 654, 100, -367, 125, 102, -93, 1, 26, -8,
+ -3, -7, 30, -11, -89, 133, 81, -389, 218, 577, -990, -160, 2097, -1811, -2914, 10568, 20062, 8731, -3509, -1173, 2081, -459, -835, 653, 101, -368, 125, 102, -93, 1, 27, -8, -3, -7, 30, -11, -89, 132, 81, -388, 217, 578, -989, -162, 2097, -1805, -2920, 10552, 20060, 8748, -3505, -1179, 2081, -456, -836, 653, 102, -368, 125, 103, -93, 1, 27, -8,
+ -3, -7, 30, -11, -89, 132, 82, -388, 216, 579, -987, -165, 2097, -1800, -2926, 10536, 20062, 8764, -3501, -1184, 2082, -454, -838, 652, 103, -368, 124, 103, -93, 1, 27, -8, -3, -7, 30, -11, -89, 132, 82, -388, 215, 580, -986, -168, 2097, -1794, -2933, 10520, 20061, 8781, -3496, -1190, 2083, -451, -839, 652, 104, -368, 124, 103, -93, 1, 27, -8,
+ -3, -7, 30, -11, -89, 132, 82, -388, 214, 581, -985, -171, 2098, -1789, -2939, 10503, 20066, 8797, -3492, -1196, 2083, -449, -841, 651, 105, -369, 124, 104, -93, 1, 27, -8, -3, -7, 30, -11, -89, 131, 83, -388, 213, 581, -984, -174, 2098, -1783, -2945, 10487, 20065, 8814, -3487, -1201, 2084, -446, -842, 651, 106, -369, 123, 104, -93, 1, 27, -8,
+ -3, -7, 30, -11, -89, 131, 83, -388, 211, 582, -982, -177, 2098, -1777, -2951, 10471, 20069, 8830, -3483, -1207, 2084, -444, -844, 650, 107, -369, 123, 104, -93, 1, 27, -8, -3, -7, 30, -10, -89, 131, 84, -388, 210, 583, -981, -179, 2098, -1772, -2957, 10455, 20067, 8847, -3479, -1213, 2085, -441, -845, 650, 108, -369, 123, 104, -93, 0, 27, -8,
+ -3, -7, 30, -10, -89, 131, 84, -388, 209, 584, -980, -182, 2099, -1766, -2963, 10438, 20071, 8863, -3474, -1219, 2085, -439, -847, 649, 109, -370, 122, 105, -93, 0, 27, -8, -3, -7, 30, -10, -89, 130, 85, -387, 208, 585, -979, -185, 2099, -1760, -2970, 10422, 20069, 8880, -3470, -1224, 2086, -436, -848, 649, 110, -370, 122, 105, -93, 0, 27, -8,
+ -3, -7, 30, -10, -89, 130, 85, -387, 207, 585, -977, -188, 2099, -1755, -2976, 10406, 20073, 8896, -3465, -1230, 2086, -434, -850, 648, 111, -370, 122, 105, -93, 0, 27, -8, -3, -7, 30, -10, -90, 130, 85, -387, 206, 586, -976, -191, 2099, -1749, -2982, 10389, 20075, 8913, -3461, -1236, 2087, -431, -851, 647, 112, -370, 121, 106, -93, 0, 27, -8,
+ -3, -7, 30, -10, -90, 130, 86, -387, 205, 587, -975, -193, 2099, -1743, -2988, 10373, 20076, 8929, -3456, -1242, 2087, -429, -853, 647, 113, -371, 121, 106, -93, 0, 27, -8, -3, -7, 30, -10, -90, 129, 86, -387, 204, 588, -974, -196, 2100, -1738, -2994, 10357, 20078, 8945, -3451, -1247, 2087, -426, -854, 646, 114, -371, 120, 106, -93, 0, 27, -8,
+ -3, -7, 30, -10, -90, 129, 87, -387, 203, 589, -972, -199, 2100, -1732, -3000, 10340, 20078, 8962, -3447, -1253, 2088, -424, -856, 646, 115, -371, 120, 106, -93, 0, 27, -8, -3, -7, 30, -9, -90, 129, 87, -387, 202, 589, -971, -202, 2100, -1726, -3006, 10324, 20078, 8978, -3442, -1259, 2088, -421, -857, 645, 116, -371, 120, 107, -93, 0, 27, -8,
+ -3, -7, 30, -9, -90, 129, 88, -387, 201, 590, -970, -205, 2100, -1721, -3012, 10308, 20079, 8995, -3438, -1264, 2089, -418, -859, 645, 117, -372, 119, 107, -93, 0, 27, -8, -3, -7, 30, -9, -90, 128, 88, -386, 200, 591, -968, -207, 2100, -1715, -3018, 10292, 20080, 9011, -3433, -1270, 2089, -416, -860, 644, 118, -372, 119, 107, -93, -1, 27, -8,
+ -3, -7, 30, -9, -90, 128, 88, -386, 199, 592, -967, -210, 2100, -1709, -3024, 10275, 20078, 9028, -3428, -1276, 2090, -413, -862, 644, 119, -372, 119, 108, -92, -1, 27, -8, -2, -7, 30, -9, -90, 128, 89, -386, 198, 593, -966, -213, 2101, -1704, -3030, 10259, 20080, 9044, -3424, -1282, 2090, -411, -863, 643, 120, -372, 118, 108, -92, -1, 27, -8,
+ -2, -7, 30, -9, -90, 128, 89, -386, 197, 593, -965, -216, 2101, -1698, -3036, 10243, 20081, 9061, -3419, -1287, 2091, -408, -865, 642, 121, -373, 118, 108, -92, -1, 27, -8, -2, -7, 30, -9, -90, 127, 90, -386, 196, 594, -963, -218, 2101, -1692, -3042, 10226, 20081, 9077, -3414, -1293, 2091, -406, -866, 642, 123, -373, 117, 108, -92, -1, 27, -8,
+ -2, -7, 30, -9, -90, 127, 90, -386, 195, 595, -962, -221, 2101, -1687, -3048, 10210, 20083, 9094, -3410, -1299, 2091, -403, -868, 641, 124, -373, 117, 109, -92, -1, 27, -8, -2, -7, 30, -9, -90, 127, 91, -386, 194, 596, -961, -224, 2101, -1681, -3054, 10194, 20080, 9110, -3405, -1304, 2092, -400, -869, 641, 125, -373, 117, 109, -92, -1, 27, -8,
+ -2, -7, 30, -8, -90, 126, 91, -385, 193, 596, -959, -227, 2101, -1675, -3060, 10177, 20084, 9127, -3400, -1310, 2092, -398, -871, 640, 126, -374, 116, 109, -92, -1, 27, -8, -2, -7, 30, -8, -90, 126, 91, -385, 192, 597, -958, -229, 2101, -1670, -3066, 10161, 20085, 9143, -3395, -1316, 2092, -395, -872, 639, 127, -374, 116, 109, -92, -1, 27, -8,
+ -2, -7, 30, -8, -90, 126, 92, -385, 190, 598, -957, -232, 2101, -1664, -3071, 10144, 20084, 9160, -3391, -1322, 2093, -393, -873, 639, 128, -374, 116, 110, -92, -2, 28, -8, -2, -7, 30, -8, -90, 126, 92, -385, 189, 599, -955, -235, 2101, -1658, -3077, 10128, 20085, 9176, -3386, -1327, 2093, -390, -875, 638, 129, -374, 115, 110, -92, -2, 28, -8,
+ -2, -7, 30, -8, -90, 125, 93, -385, 188, 600, -954, -238, 2102, -1653, -3083, 10112, 20085, 9192, -3381, -1333, 2094, -388, -876, 638, 130, -374, 115, 110, -92, -2, 28, -8, -2, -7, 30, -8, -90, 125, 93, -385, 187, 600, -953, -240, 2102, -1647, -3089, 10095, 20088, 9209, -3376, -1339, 2094, -385, -878, 637, 131, -375, 114, 111, -92, -2, 28, -8,
+ -2, -7, 30, -8, -90, 125, 93, -385, 186, 601, -951, -243, 2102, -1641, -3095, 10079, 20088, 9225, -3371, -1345, 2094, -382, -879, 636, 132, -375, 114, 111, -92, -2, 28, -8, -2, -7, 29, -8, -90, 125, 94, -384, 185, 602, -950, -246, 2102, -1636, -3100, 10063, 20086, 9242, -3366, -1350, 2095, -380, -881, 636, 133, -375, 114, 111, -92, -2, 28, -8,
+ -2, -7, 29, -8, -91, 124, 94, -384, 184, 603, -949, -249, 2102, -1630, -3106, 10046, 20091, 9258, -3361, -1356, 2095, -377, -882, 635, 134, -375, 113, 111, -92, -2, 28, -8, -2, -7, 29, -7, -91, 124, 95, -384, 183, 603, -947, -251, 2102, -1624, -3112, 10030, 20089, 9275, -3357, -1362, 2095, -375, -884, 635, 135, -375, 113, 112, -92, -2, 28, -8,
+ -2, -7, 29, -7, -91, 124, 95, -384, 182, 604, -946, -254, 2102, -1619, -3118, 10014, 20090, 9291, -3352, -1367, 2096, -372, -885, 634, 136, -376, 113, 112, -92, -2, 28, -8, -2, -7, 29, -7, -91, 124, 96, -384, 181, 605, -945, -257, 2102, -1613, -3123, 9997, 20091, 9308, -3347, -1373, 2096, -369, -886, 633, 137, -376, 112, 112, -92, -3, 28, -8,
+ -2, -7, 29, -7, -91, 123, 96, -384, 180, 605, -943, -260, 2102, -1607, -3129, 9981, 20094, 9324, -3342, -1379, 2096, -367, -888, 633, 138, -376, 112, 112, -92, -3, 28, -8, -2, -7, 29, -7, -91, 123, 96, -383, 179, 606, -942, -262, 2102, -1602, -3135, 9964, 20094, 9341, -3337, -1385, 2096, -364, -889, 632, 139, -376, 111, 113, -92, -3, 28, -8,
+ -2, -7, 29, -7, -91, 123, 97, -383, 178, 607, -941, -265, 2102, -1596, -3140, 9948, 20093, 9357, -3332, -1390, 2097, -361, -891, 631, 140, -377, 111, 113, -92, -3, 28, -8, -2, -7, 29, -7, -91, 122, 97, -383, 177, 608, -939, -268, 2102, -1590, -3146, 9932, 20094, 9373, -3327, -1396, 2097, -359, -892, 631, 141, -377, 111, 113, -92, -3, 28, -8,
+ -2, -7, 29, -7, -91, 122, 98, -383, 176, 608, -938, -271, 2102, -1584, -3152, 9915, 20096, 9390, -3322, -1402, 2097, -356, -894, 630, 142, -377, 110, 114, -92, -3, 28, -8, -2, -7, 29, -7, -91, 122, 98, -383, 175, 609, -937, -273, 2102, -1579, -3157, 9899, 20096, 9406, -3317, -1408, 2097, -354, -895, 630, 143, -377, 110, 114, -92, -3, 28, -8,
+ -2, -7, 29, -6, -91, 122, 98, -383, 174, 610, -935, -276, 2102, -1573, -3163, 9883, 20093, 9423, -3312, -1413, 2098, -351, -897, 629, 144, -377, 110, 114, -92, -3, 28, -8, -2, -7, 29, -6, -91, 121, 99, -382, 173, 611, -934, -279, 2102, -1567, -3168, 9866, 20094, 9439, -3306, -1419, 2098, -348, -898, 628, 145, -378, 109, 114, -92, -3, 28, -8,
+ -2, -7, 29, -6, -91, 121, 99, -382, 172, 611, -933, -281, 2102, -1562, -3174, 9850, 20094, 9456, -3301, -1425, 2098, -346, -899, 628, 147, -378, 109, 115, -92, -4, 28, -8, -2, -7, 29, -6, -91, 121, 100, -382, 171, 612, -931, -284, 2102, -1556, -3179, 9833, 20094, 9472, -3296, -1430, 2098, -343, -901, 627, 148, -378, 108, 115, -92, -4, 28, -8,
+ -2, -7, 29, -6, -91, 121, 100, -382, 170, 613, -930, -287, 2102, -1550, -3185, 9817, 20093, 9489, -3291, -1436, 2099, -340, -902, 626, 149, -378, 108, 115, -92, -4, 28, -8, -2, -7, 29, -6, -91, 120, 100, -382, 168, 613, -929, -290, 2101, -1545, -3190, 9801, 20099, 9505, -3286, -1442, 2099, -338, -904, 626, 150, -378, 108, 115, -92, -4, 28, -8,
+ -2, -7, 29, -6, -91, 120, 101, -382, 167, 614, -927, -292, 2101, -1539, -3196, 9784, 20099, 9521, -3281, -1448, 2099, -335, -905, 625, 151, -379, 107, 116, -92, -4, 28, -8, -2, -8, 29, -6, -91, 120, 101, -381, 166, 615, -926, -295, 2101, -1533, -3201, 9768, 20097, 9538, -3276, -1453, 2099, -332, -906, 624, 152, -379, 107, 116, -92, -4, 28, -8,
+ -2, -8, 29, -5, -91, 120, 102, -381, 165, 615, -924, -298, 2101, -1527, -3207, 9751, 20098, 9554, -3270, -1459, 2099, -330, -908, 624, 153, -379, 106, 116, -92, -4, 28, -8, -2, -8, 29, -5, -91, 119, 102, -381, 164, 616, -923, -300, 2101, -1522, -3212, 9735, 20096, 9571, -3265, -1465, 2100, -327, -909, 623, 154, -379, 106, 117, -92, -4, 28, -8,
+ -2, -8, 29, -5, -91, 119, 102, -381, 163, 617, -922, -303, 2101, -1516, -3217, 9719, 20096, 9587, -3260, -1470, 2100, -324, -911, 622, 155, -379, 106, 117, -92, -4, 28, -8, -2, -8, 29, -5, -91, 119, 103, -381, 162, 618, -920, -306, 2101, -1510, -3223, 9702, 20096, 9604, -3255, -1476, 2100, -322, -912, 622, 156, -380, 105, 117, -92, -4, 29, -8,
+ -2, -8, 29, -5, -91, 118, 103, -380, 161, 618, -919, -308, 2101, -1505, -3228, 9686, 20097, 9620, -3249, -1482, 2100, -319, -913, 621, 157, -380, 105, 117, -92, -5, 29, -8, -2, -8, 29, -5, -91, 118, 104, -380, 160, 619, -918, -311, 2101, -1499, -3233, 9669, 20097, 9636, -3244, -1488, 2100, -316, -915, 620, 158, -380, 104, 118, -91, -5, 29, -8,
+ 0, -8, 29, -5, -91, 118, 104, -380, 159, 620, -916, -314, 2100, -1493, -3239, 9652, 20096, 9652, -3239, -1493, 2100, -314, -916, 620, 159, -380, 104, 118, -91, -5, 29, -8,
+};
+
+static int16_t SCHISM_ALIGNED(64) sinc_down_lut_2[32800] = {
+ 4, 29, -4, -101, -31, 243, 162, -465, -496, 743, 1221, -1023, -2881, 1232, 10215, 15072, 10215, 1232, -2881, -1023, 1221, 743, -496, -465, 162, 243, -31, -101, -4, 29, 4, 0, 4, 29, -4, -101, -31, 243, 163, -464, -496, 741, 1222, -1020, -2882, 1225, 10208, 15072, 10224, 1240, -2881, -1026, 1220, 744, -495, -465, 162, 243, -31, -101, -4, 29, 4, -4,
+ 4, 29, -3, -101, -31, 243, 163, -463, -497, 740, 1222, -1017, -2882, 1218, 10199, 15071, 10233, 1247, -2881, -1029, 1219, 745, -494, -466, 161, 244, -30, -101, -4, 29, 4, -4, 4, 29, -3, -101, -32, 243, 163, -463, -498, 739, 1223, -1014, -2883, 1210, 10191, 15072, 10241, 1255, -2880, -1032, 1218, 747, -494, -466, 161, 244, -30, -101, -4, 29, 4, -4,
+ 4, 29, -3, -101, -32, 242, 164, -462, -498, 737, 1224, -1011, -2883, 1203, 10182, 15073, 10250, 1262, -2880, -1035, 1217, 748, -493, -467, 160, 244, -30, -101, -4, 29, 4, -4, 4, 29, -3, -101, -32, 242, 164, -462, -499, 736, 1225, -1008, -2884, 1195, 10174, 15073, 10258, 1270, -2879, -1038, 1216, 749, -492, -467, 160, 244, -30, -101, -4, 29, 4, -4,
+ 4, 29, -3, -101, -32, 242, 165, -461, -500, 735, 1226, -1005, -2884, 1188, 10166, 15072, 10266, 1277, -2879, -1041, 1215, 751, -492, -468, 160, 244, -30, -101, -4, 29, 4, -4, 4, 29, -3, -100, -32, 242, 165, -461, -501, 733, 1227, -1002, -2885, 1181, 10157, 15070, 10275, 1285, -2878, -1044, 1215, 752, -491, -469, 159, 245, -29, -101, -4, 29, 4, -4,
+ 4, 29, -3, -100, -33, 242, 166, -460, -501, 732, 1227, -999, -2885, 1173, 10149, 15069, 10283, 1292, -2878, -1047, 1214, 754, -490, -469, 159, 245, -29, -101, -4, 29, 4, -4, 4, 29, -3, -100, -33, 241, 166, -459, -502, 730, 1228, -996, -2885, 1166, 10140, 15071, 10292, 1300, -2877, -1050, 1213, 755, -490, -470, 158, 245, -29, -101, -4, 29, 4, -4,
+ 4, 29, -3, -100, -33, 241, 166, -459, -503, 729, 1229, -993, -2886, 1158, 10132, 15073, 10300, 1307, -2877, -1053, 1212, 756, -489, -470, 158, 245, -29, -101, -4, 29, 4, -4, 4, 29, -3, -100, -33, 241, 167, -458, -503, 728, 1230, -990, -2886, 1151, 10123, 15071, 10308, 1315, -2876, -1056, 1211, 758, -488, -471, 157, 246, -29, -102, -5, 29, 4, -4,
+ 4, 29, -3, -100, -33, 241, 167, -458, -504, 726, 1231, -987, -2886, 1144, 10115, 15069, 10317, 1322, -2876, -1058, 1210, 759, -487, -471, 157, 246, -28, -102, -5, 29, 4, -4, 4, 29, -3, -100, -34, 240, 168, -457, -505, 725, 1232, -984, -2887, 1136, 10106, 15072, 10325, 1330, -2875, -1061, 1209, 760, -487, -472, 157, 246, -28, -102, -5, 29, 4, -4,
+ 4, 29, -2, -100, -34, 240, 168, -456, -505, 724, 1232, -981, -2887, 1129, 10098, 15070, 10333, 1337, -2874, -1064, 1208, 762, -486, -473, 156, 246, -28, -102, -5, 29, 4, -4, 4, 29, -2, -100, -34, 240, 168, -456, -506, 722, 1233, -978, -2888, 1122, 10089, 15070, 10342, 1345, -2874, -1067, 1208, 763, -485, -473, 156, 246, -28, -102, -5, 29, 4, -4,
+ 4, 29, -2, -100, -34, 240, 169, -455, -506, 721, 1234, -975, -2888, 1114, 10081, 15068, 10350, 1352, -2873, -1070, 1207, 764, -485, -474, 155, 247, -27, -102, -5, 29, 4, -4, 4, 29, -2, -100, -35, 240, 169, -455, -507, 720, 1235, -972, -2888, 1107, 10073, 15067, 10358, 1360, -2873, -1073, 1206, 766, -484, -474, 155, 247, -27, -102, -5, 29, 4, -4,
+ 4, 29, -2, -100, -35, 239, 170, -454, -508, 718, 1236, -969, -2889, 1100, 10064, 15069, 10367, 1367, -2872, -1076, 1205, 767, -483, -475, 154, 247, -27, -102, -5, 29, 4, -4, 4, 29, -2, -100, -35, 239, 170, -453, -508, 717, 1236, -966, -2889, 1092, 10056, 15069, 10375, 1375, -2872, -1079, 1204, 768, -483, -475, 154, 247, -27, -102, -5, 29, 4, -4,
+ 4, 29, -2, -100, -35, 239, 171, -453, -509, 715, 1237, -963, -2889, 1085, 10047, 15070, 10383, 1382, -2871, -1082, 1203, 770, -482, -476, 153, 247, -27, -102, -5, 29, 4, -4, 4, 29, -2, -100, -35, 239, 171, -452, -510, 714, 1238, -960, -2890, 1078, 10039, 15067, 10392, 1390, -2871, -1085, 1202, 771, -481, -477, 153, 248, -26, -102, -5, 29, 4, -4,
+ 4, 29, -2, -99, -36, 238, 171, -452, -510, 713, 1239, -957, -2890, 1070, 10030, 15068, 10400, 1397, -2870, -1088, 1201, 772, -480, -477, 153, 248, -26, -102, -5, 29, 4, -4, 4, 29, -2, -99, -36, 238, 172, -451, -511, 711, 1240, -954, -2890, 1063, 10022, 15068, 10408, 1405, -2869, -1091, 1200, 774, -480, -478, 152, 248, -26, -102, -6, 29, 4, -4,
+ 3, 29, -2, -99, -36, 238, 172, -451, -512, 710, 1240, -951, -2891, 1056, 10013, 15069, 10417, 1413, -2869, -1094, 1199, 775, -479, -478, 152, 248, -26, -102, -6, 29, 5, -4, 3, 29, -2, -99, -36, 238, 173, -450, -512, 709, 1241, -948, -2891, 1048, 10005, 15067, 10425, 1420, -2868, -1097, 1198, 776, -478, -479, 151, 248, -25, -102, -6, 29, 5, -4,
+ 3, 29, -1, -99, -36, 238, 173, -449, -513, 707, 1242, -945, -2891, 1041, 9996, 15064, 10433, 1428, -2867, -1100, 1197, 778, -478, -479, 151, 249, -25, -102, -6, 29, 5, -4, 3, 29, -1, -99, -37, 237, 173, -449, -514, 706, 1243, -942, -2891, 1034, 9988, 15067, 10441, 1435, -2867, -1103, 1196, 779, -477, -480, 150, 249, -25, -102, -6, 30, 5, -4,
+ 3, 29, -1, -99, -37, 237, 174, -448, -514, 705, 1243, -939, -2892, 1026, 9979, 15064, 10450, 1443, -2866, -1106, 1196, 780, -476, -480, 150, 249, -25, -102, -6, 30, 5, -4, 3, 29, -1, -99, -37, 237, 174, -448, -515, 703, 1244, -936, -2892, 1019, 9970, 15067, 10458, 1450, -2866, -1109, 1195, 782, -475, -481, 150, 249, -25, -103, -6, 30, 5, -4,
+ 3, 29, -1, -99, -37, 237, 175, -447, -516, 702, 1245, -933, -2892, 1012, 9962, 15065, 10466, 1458, -2865, -1112, 1194, 783, -475, -482, 149, 249, -24, -103, -6, 30, 5, -4, 3, 29, -1, -99, -37, 237, 175, -446, -516, 700, 1246, -930, -2893, 1005, 9953, 15062, 10475, 1466, -2864, -1115, 1193, 784, -474, -482, 149, 250, -24, -103, -6, 30, 5, -4,
+ 3, 29, -1, -99, -38, 236, 175, -446, -517, 699, 1246, -927, -2893, 997, 9945, 15067, 10483, 1473, -2864, -1118, 1192, 786, -473, -483, 148, 250, -24, -103, -6, 30, 5, -4, 3, 29, -1, -99, -38, 236, 176, -445, -517, 698, 1247, -924, -2893, 990, 9936, 15063, 10491, 1481, -2863, -1121, 1191, 787, -472, -483, 148, 250, -24, -103, -6, 30, 5, -4,
+ 3, 29, -1, -99, -38, 236, 176, -445, -518, 696, 1248, -921, -2893, 983, 9928, 15066, 10499, 1488, -2862, -1124, 1190, 788, -472, -484, 147, 250, -23, -103, -7, 30, 5, -4, 3, 29, -1, -99, -38, 236, 177, -444, -519, 695, 1249, -918, -2894, 976, 9919, 15063, 10508, 1496, -2862, -1127, 1189, 790, -471, -484, 147, 250, -23, -103, -7, 30, 5, -4,
+ 3, 29, -1, -99, -38, 235, 177, -443, -519, 693, 1249, -915, -2894, 968, 9911, 15064, 10516, 1504, -2861, -1130, 1188, 791, -470, -485, 146, 251, -23, -103, -7, 30, 5, -4, 3, 29, -1, -99, -39, 235, 177, -443, -520, 692, 1250, -913, -2894, 961, 9902, 15068, 10524, 1511, -2860, -1133, 1187, 792, -470, -486, 146, 251, -23, -103, -7, 30, 5, -4,
+ 3, 29, -1, -98, -39, 235, 178, -442, -521, 691, 1251, -910, -2894, 954, 9894, 15064, 10532, 1519, -2860, -1136, 1186, 794, -469, -486, 145, 251, -23, -103, -7, 30, 5, -4, 3, 29, 0, -98, -39, 235, 178, -442, -521, 689, 1252, -907, -2894, 947, 9885, 15061, 10541, 1527, -2859, -1139, 1185, 795, -468, -487, 145, 251, -22, -103, -7, 30, 5, -4,
+ 3, 29, 0, -98, -39, 235, 179, -441, -522, 688, 1252, -904, -2895, 939, 9876, 15062, 10549, 1534, -2858, -1142, 1184, 796, -467, -487, 145, 251, -22, -103, -7, 30, 5, -4, 3, 29, 0, -98, -40, 234, 179, -440, -522, 687, 1253, -901, -2895, 932, 9868, 15061, 10557, 1542, -2857, -1145, 1183, 798, -467, -488, 144, 252, -22, -103, -7, 30, 5, -4,
+ 3, 29, 0, -98, -40, 234, 179, -440, -523, 685, 1254, -898, -2895, 925, 9859, 15062, 10565, 1550, -2857, -1148, 1182, 799, -466, -488, 144, 252, -22, -103, -7, 30, 5, -4, 3, 29, 0, -98, -40, 234, 180, -439, -524, 684, 1255, -895, -2895, 918, 9851, 15059, 10574, 1557, -2856, -1151, 1181, 800, -465, -489, 143, 252, -21, -103, -7, 30, 5, -4,
+ 3, 29, 0, -98, -40, 234, 180, -439, -524, 682, 1255, -892, -2895, 911, 9842, 15058, 10582, 1565, -2855, -1154, 1180, 802, -464, -489, 143, 252, -21, -103, -7, 30, 5, -4, 3, 29, 0, -98, -40, 233, 181, -438, -525, 681, 1256, -889, -2896, 903, 9834, 15061, 10590, 1573, -2855, -1157, 1179, 803, -464, -490, 142, 252, -21, -103, -7, 30, 5, -4,
+ 3, 29, 0, -98, -41, 233, 181, -437, -526, 680, 1257, -886, -2896, 896, 9825, 15062, 10598, 1580, -2854, -1160, 1178, 804, -463, -490, 142, 252, -21, -103, -8, 30, 5, -4, 3, 28, 0, -98, -41, 233, 181, -437, -526, 678, 1257, -883, -2896, 889, 9816, 15064, 10606, 1588, -2853, -1163, 1177, 806, -462, -491, 141, 253, -21, -104, -8, 30, 5, -4,
+ 3, 28, 0, -98, -41, 233, 182, -436, -527, 677, 1258, -880, -2896, 882, 9808, 15059, 10615, 1596, -2852, -1166, 1176, 807, -461, -492, 141, 253, -20, -104, -8, 30, 5, -4, 3, 28, 0, -98, -41, 232, 182, -436, -527, 676, 1259, -877, -2896, 875, 9799, 15062, 10623, 1603, -2852, -1169, 1175, 808, -461, -492, 140, 253, -20, -104, -8, 30, 5, -4,
+ 3, 28, 0, -98, -41, 232, 183, -435, -528, 674, 1260, -874, -2896, 868, 9791, 15058, 10631, 1611, -2851, -1171, 1174, 810, -460, -493, 140, 253, -20, -104, -8, 30, 5, -4, 3, 28, 1, -98, -42, 232, 183, -434, -529, 673, 1260, -871, -2897, 860, 9782, 15059, 10639, 1619, -2850, -1174, 1173, 811, -459, -493, 140, 253, -20, -104, -8, 30, 5, -4,
+ 3, 28, 1, -98, -42, 232, 183, -434, -529, 671, 1261, -868, -2897, 853, 9773, 15059, 10647, 1626, -2849, -1177, 1172, 812, -458, -494, 139, 254, -19, -104, -8, 30, 5, -4, 3, 28, 1, -97, -42, 232, 184, -433, -530, 670, 1262, -865, -2897, 846, 9765, 15055, 10655, 1634, -2848, -1180, 1171, 813, -458, -494, 139, 254, -19, -104, -8, 30, 5, -4,
+ 3, 28, 1, -97, -42, 231, 184, -433, -530, 669, 1262, -862, -2897, 839, 9756, 15056, 10664, 1642, -2848, -1183, 1170, 815, -457, -495, 138, 254, -19, -104, -8, 30, 5, -4, 3, 28, 1, -97, -42, 231, 185, -432, -531, 667, 1263, -859, -2897, 832, 9747, 15054, 10672, 1650, -2847, -1186, 1169, 816, -456, -495, 138, 254, -19, -104, -8, 30, 5, -4,
+ 3, 28, 1, -97, -43, 231, 185, -431, -532, 666, 1264, -856, -2897, 825, 9739, 15054, 10680, 1657, -2846, -1189, 1168, 817, -455, -496, 137, 254, -18, -104, -8, 30, 5, -4, 3, 28, 1, -97, -43, 231, 185, -431, -532, 664, 1264, -853, -2897, 818, 9730, 15053, 10688, 1665, -2845, -1192, 1167, 819, -454, -496, 137, 255, -18, -104, -9, 30, 5, -4,
+ 3, 28, 1, -97, -43, 230, 186, -430, -533, 663, 1265, -850, -2897, 811, 9722, 15053, 10696, 1673, -2844, -1195, 1166, 820, -454, -497, 136, 255, -18, -104, -9, 30, 5, -4, 3, 28, 1, -97, -43, 230, 186, -430, -533, 662, 1266, -847, -2897, 803, 9713, 15053, 10704, 1681, -2843, -1198, 1165, 821, -453, -498, 136, 255, -18, -104, -9, 30, 5, -4,
+ 3, 28, 1, -97, -43, 230, 186, -429, -534, 660, 1266, -844, -2898, 796, 9704, 15055, 10713, 1688, -2843, -1201, 1164, 823, -452, -498, 135, 255, -18, -104, -9, 30, 5, -4, 3, 28, 1, -97, -44, 230, 187, -428, -535, 659, 1267, -841, -2898, 789, 9696, 15052, 10721, 1696, -2842, -1204, 1163, 824, -451, -499, 135, 255, -17, -104, -9, 30, 5, -4,
+ 3, 28, 1, -97, -44, 229, 187, -428, -535, 657, 1268, -838, -2898, 782, 9687, 15053, 10729, 1704, -2841, -1207, 1162, 825, -451, -499, 134, 256, -17, -104, -9, 30, 5, -4, 3, 28, 1, -97, -44, 229, 188, -427, -536, 656, 1268, -835, -2898, 775, 9678, 15051, 10737, 1712, -2840, -1210, 1161, 827, -450, -500, 134, 256, -17, -104, -9, 30, 5, -4,
+ 3, 28, 2, -97, -44, 229, 188, -426, -536, 655, 1269, -832, -2898, 768, 9670, 15047, 10745, 1719, -2839, -1213, 1160, 828, -449, -500, 134, 256, -17, -104, -9, 30, 5, -4, 3, 28, 2, -97, -44, 229, 188, -426, -537, 653, 1270, -829, -2898, 761, 9661, 15048, 10753, 1727, -2838, -1216, 1159, 829, -448, -501, 133, 256, -16, -104, -9, 30, 5, -4,
+ 3, 28, 2, -97, -45, 229, 189, -425, -538, 652, 1270, -826, -2898, 754, 9652, 15049, 10761, 1735, -2837, -1219, 1157, 830, -448, -501, 133, 256, -16, -104, -9, 30, 5, -4, 3, 28, 2, -96, -45, 228, 189, -425, -538, 651, 1271, -823, -2898, 747, 9644, 15049, 10769, 1743, -2837, -1222, 1156, 832, -447, -502, 132, 256, -16, -105, -9, 30, 5, -4,
+ 3, 28, 2, -96, -45, 228, 190, -424, -539, 649, 1272, -820, -2898, 740, 9635, 15046, 10777, 1751, -2836, -1225, 1155, 833, -446, -502, 132, 257, -16, -105, -9, 30, 5, -4, 3, 28, 2, -96, -45, 228, 190, -423, -539, 648, 1272, -817, -2898, 733, 9626, 15045, 10786, 1758, -2835, -1228, 1154, 834, -445, -503, 131, 257, -15, -105, -10, 30, 6, -4,
+ 3, 28, 2, -96, -45, 228, 190, -423, -540, 646, 1273, -814, -2898, 726, 9618, 15043, 10794, 1766, -2834, -1231, 1153, 836, -444, -503, 131, 257, -15, -105, -10, 30, 6, -4, 3, 28, 2, -96, -45, 227, 191, -422, -540, 645, 1274, -811, -2898, 719, 9609, 15043, 10802, 1774, -2833, -1234, 1152, 837, -444, -504, 130, 257, -15, -105, -10, 30, 6, -4,
+ 3, 28, 2, -96, -46, 227, 191, -422, -541, 644, 1274, -808, -2898, 712, 9600, 15045, 10810, 1782, -2832, -1237, 1151, 838, -443, -505, 130, 257, -15, -105, -10, 30, 6, -4, 3, 28, 2, -96, -46, 227, 191, -421, -542, 642, 1275, -805, -2898, 704, 9592, 15043, 10818, 1790, -2831, -1240, 1150, 840, -442, -505, 129, 258, -15, -105, -10, 30, 6, -4,
+ 3, 28, 2, -96, -46, 227, 192, -420, -542, 641, 1275, -803, -2898, 697, 9583, 15042, 10826, 1797, -2830, -1243, 1149, 841, -441, -506, 129, 258, -14, -105, -10, 30, 6, -4, 2, 28, 2, -96, -46, 226, 192, -420, -543, 639, 1276, -800, -2898, 690, 9574, 15045, 10834, 1805, -2829, -1246, 1148, 842, -440, -506, 128, 258, -14, -105, -10, 30, 6, -4,
+ 2, 28, 2, -96, -46, 226, 193, -419, -543, 638, 1277, -797, -2898, 683, 9566, 15042, 10842, 1813, -2828, -1249, 1147, 843, -440, -507, 128, 258, -14, -105, -10, 30, 6, -4, 2, 28, 3, -96, -47, 226, 193, -418, -544, 637, 1277, -794, -2898, 676, 9557, 15040, 10850, 1821, -2827, -1251, 1146, 845, -439, -507, 127, 258, -14, -105, -10, 30, 6, -4,
+ 2, 28, 3, -96, -47, 226, 193, -418, -544, 635, 1278, -791, -2898, 669, 9548, 15039, 10858, 1829, -2826, -1254, 1145, 846, -438, -508, 127, 258, -13, -105, -10, 30, 6, -4, 2, 28, 3, -96, -47, 226, 194, -417, -545, 634, 1279, -788, -2898, 662, 9539, 15037, 10866, 1837, -2825, -1257, 1143, 847, -437, -508, 126, 259, -13, -105, -10, 30, 6, -4,
+ 2, 28, 3, -96, -47, 225, 194, -417, -546, 632, 1279, -785, -2898, 655, 9531, 15040, 10874, 1844, -2824, -1260, 1142, 849, -436, -509, 126, 259, -13, -105, -11, 30, 6, -4, 2, 28, 3, -95, -47, 225, 194, -416, -546, 631, 1280, -782, -2898, 648, 9522, 15038, 10882, 1852, -2824, -1263, 1141, 850, -436, -509, 126, 259, -13, -105, -11, 30, 6, -4,
+ 2, 28, 3, -95, -48, 225, 195, -415, -547, 630, 1280, -779, -2898, 642, 9513, 15037, 10890, 1860, -2823, -1266, 1140, 851, -435, -510, 125, 259, -12, -105, -11, 30, 6, -4, 2, 28, 3, -95, -48, 225, 195, -415, -547, 628, 1281, -776, -2898, 635, 9505, 15035, 10898, 1868, -2822, -1269, 1139, 852, -434, -510, 125, 259, -12, -105, -11, 30, 6, -4,
+ 2, 28, 3, -95, -48, 224, 196, -414, -548, 627, 1282, -773, -2898, 628, 9496, 15033, 10906, 1876, -2821, -1272, 1138, 854, -433, -511, 124, 260, -12, -105, -11, 30, 6, -4, 2, 28, 3, -95, -48, 224, 196, -414, -548, 625, 1282, -770, -2898, 621, 9487, 15033, 10914, 1884, -2820, -1275, 1137, 855, -432, -511, 124, 260, -12, -105, -11, 30, 6, -4,
+ 2, 28, 3, -95, -48, 224, 196, -413, -549, 624, 1283, -767, -2898, 614, 9478, 15034, 10922, 1892, -2819, -1278, 1136, 856, -432, -512, 123, 260, -12, -105, -11, 30, 6, -4, 2, 28, 3, -95, -49, 224, 197, -412, -549, 623, 1283, -764, -2898, 607, 9470, 15029, 10930, 1900, -2818, -1281, 1135, 858, -431, -512, 123, 260, -11, -105, -11, 30, 6, -4,
+ 2, 28, 3, -95, -49, 223, 197, -412, -550, 621, 1284, -761, -2897, 600, 9461, 15032, 10938, 1907, -2816, -1284, 1133, 859, -430, -513, 122, 260, -11, -105, -11, 30, 6, -4, 2, 28, 3, -95, -49, 223, 197, -411, -551, 620, 1285, -758, -2897, 593, 9452, 15031, 10946, 1915, -2815, -1287, 1132, 860, -429, -513, 122, 260, -11, -106, -11, 30, 6, -4,
+ 2, 28, 4, -95, -49, 223, 198, -410, -551, 618, 1285, -755, -2897, 586, 9443, 15029, 10954, 1923, -2814, -1290, 1131, 861, -428, -514, 121, 261, -11, -106, -11, 30, 6, -4, 2, 28, 4, -95, -49, 223, 198, -410, -552, 617, 1286, -752, -2897, 579, 9435, 15027, 10962, 1931, -2813, -1293, 1130, 863, -428, -514, 121, 261, -10, -106, -12, 30, 6, -4,
+ 2, 28, 4, -95, -50, 222, 198, -409, -552, 616, 1286, -749, -2897, 572, 9426, 15029, 10970, 1939, -2812, -1296, 1129, 864, -427, -515, 120, 261, -10, -106, -12, 30, 6, -4, 2, 28, 4, -95, -50, 222, 199, -409, -553, 614, 1287, -746, -2897, 565, 9417, 15028, 10978, 1947, -2811, -1299, 1128, 865, -426, -515, 120, 261, -10, -106, -12, 30, 6, -4,
+ 2, 28, 4, -94, -50, 222, 199, -408, -553, 613, 1287, -743, -2897, 558, 9408, 15026, 10986, 1955, -2810, -1302, 1127, 867, -425, -516, 119, 261, -10, -106, -12, 30, 6, -4, 2, 28, 4, -94, -50, 222, 200, -407, -554, 611, 1288, -740, -2897, 551, 9400, 15024, 10994, 1963, -2809, -1305, 1125, 868, -424, -517, 119, 261, -9, -106, -12, 30, 6, -4,
+ 2, 28, 4, -94, -50, 221, 200, -407, -554, 610, 1289, -737, -2897, 545, 9391, 15022, 11002, 1971, -2808, -1308, 1124, 869, -423, -517, 118, 262, -9, -106, -12, 30, 6, -4, 2, 28, 4, -94, -50, 221, 200, -406, -555, 609, 1289, -734, -2896, 538, 9382, 15022, 11010, 1979, -2807, -1311, 1123, 870, -423, -518, 118, 262, -9, -106, -12, 30, 6, -4,
+ 2, 28, 4, -94, -51, 221, 201, -405, -555, 607, 1290, -731, -2896, 531, 9373, 15019, 11018, 1987, -2806, -1313, 1122, 872, -422, -518, 117, 262, -9, -106, -12, 30, 6, -4, 2, 28, 4, -94, -51, 221, 201, -405, -556, 606, 1290, -728, -2896, 524, 9365, 15018, 11026, 1995, -2805, -1316, 1121, 873, -421, -519, 117, 262, -8, -106, -12, 30, 6, -4,
+ 2, 28, 4, -94, -51, 220, 201, -404, -556, 604, 1291, -725, -2896, 517, 9356, 15019, 11034, 2002, -2804, -1319, 1120, 874, -420, -519, 116, 262, -8, -106, -12, 30, 6, -4, 2, 28, 4, -94, -51, 220, 202, -404, -557, 603, 1291, -723, -2896, 510, 9347, 15021, 11042, 2010, -2803, -1322, 1118, 875, -419, -520, 116, 262, -8, -106, -12, 30, 6, -4,
+ 2, 28, 4, -94, -51, 220, 202, -403, -557, 601, 1292, -720, -2896, 503, 9338, 15019, 11050, 2018, -2801, -1325, 1117, 877, -419, -520, 115, 263, -8, -106, -13, 30, 6, -4, 2, 28, 4, -94, -52, 220, 202, -402, -558, 600, 1292, -717, -2896, 496, 9329, 15019, 11058, 2026, -2800, -1328, 1116, 878, -418, -521, 115, 263, -7, -106, -13, 30, 6, -4,
+ 2, 28, 5, -94, -52, 220, 203, -402, -559, 599, 1293, -714, -2895, 490, 9321, 15014, 11066, 2034, -2799, -1331, 1115, 879, -417, -521, 114, 263, -7, -106, -13, 30, 6, -4, 2, 28, 5, -94, -52, 219, 203, -401, -559, 597, 1293, -711, -2895, 483, 9312, 15014, 11074, 2042, -2798, -1334, 1114, 881, -416, -522, 114, 263, -7, -106, -13, 30, 6, -4,
+ 2, 27, 5, -94, -52, 219, 203, -400, -560, 596, 1294, -708, -2895, 476, 9303, 15015, 11081, 2050, -2797, -1337, 1113, 882, -415, -522, 113, 263, -7, -106, -13, 30, 6, -4, 2, 27, 5, -93, -52, 219, 204, -400, -560, 594, 1295, -705, -2895, 469, 9294, 15013, 11089, 2058, -2796, -1340, 1111, 883, -414, -523, 113, 263, -6, -106, -13, 30, 6, -4,
+ 2, 27, 5, -93, -53, 219, 204, -399, -561, 593, 1295, -702, -2895, 462, 9285, 15013, 11097, 2066, -2795, -1343, 1110, 884, -413, -523, 112, 264, -6, -106, -13, 30, 6, -4, 2, 27, 5, -93, -53, 218, 205, -398, -561, 592, 1296, -699, -2894, 456, 9277, 15007, 11105, 2074, -2793, -1346, 1109, 886, -413, -524, 112, 264, -6, -106, -13, 30, 6, -4,
+ 2, 27, 5, -93, -53, 218, 205, -398, -562, 590, 1296, -696, -2894, 449, 9268, 15009, 11113, 2082, -2792, -1349, 1108, 887, -412, -524, 111, 264, -6, -106, -13, 30, 6, -4, 2, 27, 5, -93, -53, 218, 205, -397, -562, 589, 1297, -693, -2894, 442, 9259, 15007, 11121, 2090, -2791, -1352, 1107, 888, -411, -525, 111, 264, -6, -106, -13, 30, 6, -4,
+ 2, 27, 5, -93, -53, 218, 206, -397, -563, 587, 1297, -690, -2894, 435, 9250, 15007, 11129, 2098, -2790, -1355, 1105, 889, -410, -525, 110, 264, -5, -106, -13, 30, 7, -4, 2, 27, 5, -93, -53, 217, 206, -396, -563, 586, 1298, -687, -2894, 428, 9241, 15007, 11137, 2106, -2789, -1358, 1104, 891, -409, -526, 110, 264, -5, -107, -14, 30, 7, -4,
+ 2, 27, 5, -93, -54, 217, 206, -395, -564, 585, 1298, -684, -2893, 422, 9232, 15004, 11145, 2114, -2788, -1360, 1103, 892, -408, -526, 109, 265, -5, -107, -14, 30, 7, -4, 2, 27, 5, -93, -54, 217, 207, -395, -564, 583, 1299, -681, -2893, 415, 9224, 15003, 11152, 2122, -2786, -1363, 1102, 893, -408, -527, 109, 265, -5, -107, -14, 30, 7, -4,
+ 2, 27, 5, -93, -54, 217, 207, -394, -565, 582, 1299, -678, -2893, 408, 9215, 15002, 11160, 2130, -2785, -1366, 1101, 894, -407, -527, 108, 265, -4, -107, -14, 30, 7, -4, 2, 27, 5, -93, -54, 216, 207, -393, -565, 580, 1300, -675, -2893, 401, 9206, 15002, 11168, 2138, -2784, -1369, 1099, 896, -406, -528, 108, 265, -4, -107, -14, 30, 7, -4,
+ 2, 27, 6, -93, -54, 216, 208, -393, -566, 579, 1300, -672, -2892, 395, 9197, 14999, 11176, 2146, -2783, -1372, 1098, 897, -405, -528, 107, 265, -4, -107, -14, 30, 7, -4, 2, 27, 6, -93, -55, 216, 208, -392, -566, 578, 1301, -669, -2892, 388, 9188, 14997, 11184, 2154, -2781, -1375, 1097, 898, -404, -529, 107, 265, -4, -107, -14, 30, 7, -4,
+ 2, 27, 6, -92, -55, 216, 208, -392, -567, 576, 1301, -666, -2892, 381, 9179, 14996, 11192, 2162, -2780, -1378, 1096, 899, -403, -529, 106, 266, -3, -107, -14, 30, 7, -4, 2, 27, 6, -92, -55, 215, 209, -391, -567, 575, 1302, -664, -2891, 374, 9171, 14994, 11199, 2170, -2779, -1381, 1094, 901, -402, -530, 106, 266, -3, -107, -14, 30, 7, -4,
+ 2, 27, 6, -92, -55, 215, 209, -390, -568, 573, 1302, -661, -2891, 368, 9162, 14994, 11207, 2179, -2778, -1384, 1093, 902, -402, -530, 105, 266, -3, -107, -14, 30, 7, -4, 2, 27, 6, -92, -55, 215, 209, -390, -568, 572, 1303, -658, -2891, 361, 9153, 14993, 11215, 2187, -2776, -1387, 1092, 903, -401, -531, 105, 266, -3, -107, -15, 30, 7, -4,
+ 2, 27, 6, -92, -55, 215, 210, -389, -569, 570, 1303, -655, -2891, 354, 9144, 14992, 11223, 2195, -2775, -1390, 1091, 904, -400, -531, 104, 266, -2, -107, -15, 30, 7, -4, 2, 27, 6, -92, -56, 214, 210, -388, -569, 569, 1303, -652, -2890, 347, 9135, 14991, 11231, 2203, -2774, -1393, 1090, 906, -399, -532, 104, 266, -2, -107, -15, 30, 7, -4,
+ 2, 27, 6, -92, -56, 214, 210, -388, -570, 568, 1304, -649, -2890, 341, 9126, 14991, 11238, 2211, -2773, -1396, 1088, 907, -398, -532, 103, 267, -2, -107, -15, 30, 7, -4, 2, 27, 6, -92, -56, 214, 211, -387, -570, 566, 1304, -646, -2890, 334, 9118, 14988, 11246, 2219, -2771, -1399, 1087, 908, -397, -533, 103, 267, -2, -107, -15, 30, 7, -4,
+ 2, 27, 6, -92, -56, 214, 211, -386, -571, 565, 1305, -643, -2889, 327, 9109, 14984, 11254, 2227, -2770, -1401, 1086, 909, -396, -533, 102, 267, -1, -107, -15, 30, 7, -4, 2, 27, 6, -92, -56, 213, 211, -386, -571, 563, 1305, -640, -2889, 321, 9100, 14985, 11262, 2235, -2769, -1404, 1085, 911, -396, -534, 102, 267, -1, -107, -15, 30, 7, -4,
+ 1, 27, 6, -92, -57, 213, 212, -385, -572, 562, 1306, -637, -2889, 314, 9091, 14985, 11270, 2243, -2767, -1407, 1083, 912, -395, -534, 101, 267, -1, -107, -15, 30, 7, -4, 1, 27, 6, -92, -57, 213, 212, -384, -572, 561, 1306, -634, -2888, 307, 9082, 14984, 11277, 2251, -2766, -1410, 1082, 913, -394, -535, 101, 267, -1, -107, -15, 30, 7, -4,
+ 1, 27, 7, -92, -57, 213, 212, -384, -573, 559, 1307, -631, -2888, 301, 9073, 14981, 11285, 2259, -2765, -1413, 1081, 914, -393, -535, 100, 268, 0, -107, -15, 30, 7, -4, 1, 27, 7, -91, -57, 212, 213, -383, -573, 558, 1307, -628, -2888, 294, 9064, 14977, 11293, 2267, -2763, -1416, 1080, 916, -392, -536, 100, 268, 0, -107, -15, 30, 7, -4,
+ 1, 27, 7, -91, -57, 212, 213, -383, -574, 556, 1308, -625, -2887, 287, 9055, 14979, 11301, 2275, -2762, -1419, 1078, 917, -391, -536, 99, 268, 0, -107, -16, 30, 7, -4, 1, 27, 7, -91, -57, 212, 213, -382, -574, 555, 1308, -622, -2887, 281, 9047, 14975, 11308, 2284, -2761, -1422, 1077, 918, -390, -536, 99, 268, 0, -107, -16, 30, 7, -4,
+ 1, 27, 7, -91, -58, 212, 214, -381, -575, 553, 1308, -619, -2887, 274, 9038, 14975, 11316, 2292, -2759, -1425, 1076, 919, -389, -537, 98, 268, 1, -107, -16, 30, 7, -4, 1, 27, 7, -91, -58, 211, 214, -381, -575, 552, 1309, -617, -2886, 267, 9029, 14976, 11324, 2300, -2758, -1428, 1074, 920, -389, -537, 98, 268, 1, -107, -16, 30, 7, -4,
+ 1, 27, 7, -91, -58, 211, 214, -380, -575, 551, 1309, -614, -2886, 261, 9020, 14974, 11332, 2308, -2757, -1431, 1073, 922, -388, -538, 97, 268, 1, -107, -16, 30, 7, -4, 1, 27, 7, -91, -58, 211, 215, -379, -576, 549, 1310, -611, -2886, 254, 9011, 14970, 11339, 2316, -2755, -1433, 1072, 923, -387, -538, 97, 269, 1, -107, -16, 30, 7, -4,
+ 1, 27, 7, -91, -58, 211, 215, -379, -576, 548, 1310, -608, -2885, 247, 9002, 14969, 11347, 2324, -2754, -1436, 1071, 924, -386, -539, 96, 269, 2, -107, -16, 30, 7, -4, 1, 27, 7, -91, -58, 210, 215, -378, -577, 546, 1311, -605, -2885, 241, 8993, 14970, 11355, 2332, -2753, -1439, 1069, 925, -385, -539, 96, 269, 2, -108, -16, 30, 7, -4,
+ 1, 27, 7, -91, -59, 210, 216, -377, -577, 545, 1311, -602, -2884, 234, 8984, 14967, 11362, 2341, -2751, -1442, 1068, 927, -384, -540, 95, 269, 2, -108, -16, 30, 7, -4, 1, 27, 7, -91, -59, 210, 216, -377, -578, 543, 1311, -599, -2884, 228, 8975, 14967, 11370, 2349, -2750, -1445, 1067, 928, -383, -540, 95, 269, 2, -108, -16, 30, 7, -4,
+ 1, 27, 7, -91, -59, 210, 216, -376, -578, 542, 1312, -596, -2884, 221, 8966, 14965, 11378, 2357, -2748, -1448, 1065, 929, -382, -541, 94, 269, 3, -108, -16, 30, 7, -4, 1, 27, 7, -90, -59, 209, 217, -375, -579, 541, 1312, -593, -2883, 214, 8957, 14963, 11385, 2365, -2747, -1451, 1064, 930, -381, -541, 94, 270, 3, -108, -17, 30, 7, -4,
+ 1, 27, 8, -90, -59, 209, 217, -375, -579, 539, 1313, -590, -2883, 208, 8949, 14961, 11393, 2373, -2746, -1454, 1063, 932, -381, -542, 93, 270, 3, -108, -17, 30, 7, -4, 1, 27, 8, -90, -60, 209, 217, -374, -580, 538, 1313, -587, -2882, 201, 8940, 14960, 11401, 2381, -2744, -1457, 1061, 933, -380, -542, 93, 270, 3, -108, -17, 30, 7, -4,
+ 1, 27, 8, -90, -60, 209, 218, -374, -580, 536, 1314, -584, -2882, 195, 8931, 14958, 11409, 2389, -2743, -1460, 1060, 934, -379, -543, 92, 270, 4, -108, -17, 30, 7, -4, 1, 27, 8, -90, -60, 208, 218, -373, -581, 535, 1314, -581, -2881, 188, 8922, 14956, 11416, 2398, -2741, -1463, 1059, 935, -378, -543, 92, 270, 4, -108, -17, 30, 7, -4,
+ 1, 27, 8, -90, -60, 208, 218, -372, -581, 534, 1314, -578, -2881, 182, 8913, 14954, 11424, 2406, -2740, -1465, 1058, 936, -377, -544, 91, 270, 4, -108, -17, 30, 7, -4, 1, 27, 8, -90, -60, 208, 219, -372, -582, 532, 1315, -576, -2881, 175, 8904, 14953, 11432, 2414, -2738, -1468, 1056, 938, -376, -544, 91, 270, 4, -108, -17, 30, 7, -4,
+ 1, 27, 8, -90, -60, 207, 219, -371, -582, 531, 1315, -573, -2880, 168, 8895, 14952, 11439, 2422, -2737, -1471, 1055, 939, -375, -545, 90, 271, 5, -108, -17, 30, 7, -4, 1, 27, 8, -90, -61, 207, 219, -370, -582, 529, 1315, -570, -2880, 162, 8886, 14950, 11447, 2430, -2735, -1474, 1054, 940, -374, -545, 89, 271, 5, -108, -17, 30, 8, -4,
+ 1, 27, 8, -90, -61, 207, 220, -370, -583, 528, 1316, -567, -2879, 155, 8877, 14948, 11454, 2439, -2734, -1477, 1052, 941, -373, -545, 89, 271, 5, -108, -17, 30, 8, -4, 1, 27, 8, -90, -61, 207, 220, -369, -583, 526, 1316, -564, -2879, 149, 8868, 14948, 11462, 2447, -2732, -1480, 1051, 942, -372, -546, 88, 271, 5, -108, -18, 30, 8, -4,
+ 1, 27, 8, -90, -61, 206, 220, -368, -584, 525, 1317, -561, -2878, 142, 8859, 14945, 11470, 2455, -2731, -1483, 1050, 944, -372, -546, 88, 271, 6, -108, -18, 30, 8, -4, 1, 26, 8, -89, -61, 206, 221, -368, -584, 524, 1317, -558, -2878, 136, 8850, 14946, 11477, 2463, -2730, -1486, 1048, 945, -371, -547, 87, 271, 6, -108, -18, 30, 8, -4,
+ 1, 26, 8, -89, -61, 206, 221, -367, -585, 522, 1317, -555, -2877, 129, 8841, 14944, 11485, 2471, -2728, -1489, 1047, 946, -370, -547, 87, 271, 6, -108, -18, 30, 8, -4, 1, 26, 8, -89, -62, 206, 221, -366, -585, 521, 1318, -552, -2877, 123, 8832, 14941, 11493, 2480, -2727, -1492, 1046, 947, -369, -548, 86, 272, 6, -108, -18, 30, 8, -4,
+ 1, 26, 9, -89, -62, 205, 221, -366, -586, 519, 1318, -549, -2876, 116, 8823, 14940, 11500, 2488, -2725, -1494, 1044, 948, -368, -548, 86, 272, 7, -108, -18, 30, 8, -4, 1, 26, 9, -89, -62, 205, 222, -365, -586, 518, 1318, -546, -2876, 110, 8814, 14936, 11508, 2496, -2723, -1497, 1043, 950, -367, -549, 85, 272, 7, -108, -18, 30, 8, -4,
+ 1, 26, 9, -89, -62, 205, 222, -364, -586, 516, 1319, -543, -2875, 103, 8806, 14934, 11515, 2504, -2722, -1500, 1041, 951, -366, -549, 85, 272, 7, -108, -18, 30, 8, -4, 1, 26, 9, -89, -62, 205, 222, -364, -587, 515, 1319, -541, -2875, 97, 8797, 14934, 11523, 2513, -2720, -1503, 1040, 952, -365, -550, 84, 272, 7, -108, -18, 30, 8, -4,
+ 1, 26, 9, -89, -62, 204, 223, -363, -587, 514, 1320, -538, -2874, 90, 8788, 14929, 11531, 2521, -2719, -1506, 1039, 953, -364, -550, 84, 272, 8, -108, -18, 30, 8, -4, 1, 26, 9, -89, -63, 204, 223, -363, -588, 512, 1320, -535, -2874, 84, 8779, 14934, 11538, 2529, -2717, -1509, 1037, 954, -363, -551, 83, 272, 8, -108, -19, 30, 8, -4,
+ 1, 26, 9, -89, -63, 204, 223, -362, -588, 511, 1320, -532, -2873, 78, 8770, 14928, 11546, 2537, -2716, -1512, 1036, 956, -362, -551, 83, 273, 8, -108, -19, 30, 8, -4, 1, 26, 9, -89, -63, 204, 224, -361, -589, 509, 1321, -529, -2873, 71, 8761, 14928, 11553, 2545, -2714, -1515, 1035, 957, -361, -552, 82, 273, 8, -108, -19, 30, 8, -4,
+ 1, 26, 9, -89, -63, 203, 224, -361, -589, 508, 1321, -526, -2872, 65, 8752, 14925, 11561, 2554, -2713, -1517, 1033, 958, -361, -552, 82, 273, 9, -108, -19, 30, 8, -4, 1, 26, 9, -88, -63, 203, 224, -360, -589, 507, 1321, -523, -2872, 58, 8743, 14923, 11568, 2562, -2711, -1520, 1032, 959, -360, -552, 81, 273, 9, -108, -19, 30, 8, -4,
+ 1, 26, 9, -88, -63, 203, 225, -359, -590, 505, 1322, -520, -2871, 52, 8734, 14919, 11576, 2570, -2709, -1523, 1031, 960, -359, -553, 81, 273, 9, -108, -19, 30, 8, -4, 1, 26, 9, -88, -64, 203, 225, -359, -590, 504, 1322, -517, -2870, 45, 8725, 14919, 11583, 2579, -2708, -1526, 1029, 962, -358, -553, 80, 273, 9, -108, -19, 30, 8, -4,
+ 1, 26, 9, -88, -64, 202, 225, -358, -591, 502, 1322, -514, -2870, 39, 8716, 14919, 11591, 2587, -2706, -1529, 1028, 963, -357, -554, 79, 273, 10, -108, -19, 30, 8, -4, 1, 26, 9, -88, -64, 202, 226, -357, -591, 501, 1323, -511, -2869, 33, 8707, 14914, 11598, 2595, -2705, -1532, 1026, 964, -356, -554, 79, 274, 10, -108, -19, 30, 8, -4,
+ 1, 26, 9, -88, -64, 202, 226, -357, -592, 499, 1323, -509, -2869, 26, 8698, 14917, 11606, 2603, -2703, -1535, 1025, 965, -355, -555, 78, 274, 10, -108, -19, 30, 8, -4, 1, 26, 10, -88, -64, 202, 226, -356, -592, 498, 1323, -506, -2868, 20, 8689, 14912, 11613, 2612, -2701, -1538, 1024, 966, -354, -555, 78, 274, 10, -109, -19, 30, 8, -4,
+ 1, 26, 10, -88, -64, 201, 226, -355, -592, 497, 1324, -503, -2868, 13, 8680, 14911, 11621, 2620, -2700, -1540, 1022, 968, -353, -556, 77, 274, 11, -109, -20, 30, 8, -4, 1, 26, 10, -88, -65, 201, 227, -355, -593, 495, 1324, -500, -2867, 7, 8671, 14909, 11629, 2628, -2698, -1543, 1021, 969, -352, -556, 77, 274, 11, -109, -20, 30, 8, -4,
+ 1, 26, 10, -88, -65, 201, 227, -354, -593, 494, 1324, -497, -2866, 1, 8662, 14907, 11636, 2637, -2697, -1546, 1019, 970, -351, -556, 76, 274, 11, -109, -20, 30, 8, -4, 1, 26, 10, -88, -65, 200, 227, -353, -594, 492, 1325, -494, -2866, -6, 8653, 14908, 11643, 2645, -2695, -1549, 1018, 971, -350, -557, 76, 274, 11, -109, -20, 30, 8, -4,
+ 1, 26, 10, -88, -65, 200, 228, -353, -594, 491, 1325, -491, -2865, -12, 8644, 14903, 11651, 2653, -2693, -1552, 1017, 972, -349, -557, 75, 274, 12, -109, -20, 30, 8, -4, 1, 26, 10, -87, -65, 200, 228, -352, -594, 489, 1325, -488, -2865, -19, 8635, 14903, 11658, 2661, -2692, -1555, 1015, 973, -348, -558, 75, 275, 12, -109, -20, 30, 8, -4,
+ 1, 26, 10, -87, -65, 200, 228, -351, -595, 488, 1325, -485, -2864, -25, 8626, 14898, 11666, 2670, -2690, -1558, 1014, 975, -347, -558, 74, 275, 12, -109, -20, 30, 8, -4, 1, 26, 10, -87, -66, 199, 229, -351, -595, 487, 1326, -482, -2863, -31, 8617, 14898, 11673, 2678, -2688, -1561, 1012, 976, -347, -559, 74, 275, 12, -109, -20, 30, 8, -4,
+ 1, 26, 10, -87, -66, 199, 229, -350, -596, 485, 1326, -480, -2863, -38, 8608, 14898, 11681, 2686, -2687, -1563, 1011, 977, -346, -559, 73, 275, 13, -109, -20, 30, 8, -4, 1, 26, 10, -87, -66, 199, 229, -349, -596, 484, 1326, -477, -2862, -44, 8599, 14895, 11688, 2695, -2685, -1566, 1009, 978, -345, -560, 73, 275, 13, -109, -20, 30, 8, -4,
+ 1, 26, 10, -87, -66, 199, 229, -349, -596, 482, 1327, -474, -2861, -50, 8590, 14893, 11696, 2703, -2683, -1569, 1008, 979, -344, -560, 72, 275, 13, -109, -21, 30, 8, -4, 1, 26, 10, -87, -66, 198, 230, -348, -597, 481, 1327, -471, -2861, -57, 8581, 14892, 11703, 2711, -2682, -1572, 1007, 981, -343, -560, 71, 275, 14, -109, -21, 30, 8, -4,
+ 1, 26, 10, -87, -66, 198, 230, -347, -597, 479, 1327, -468, -2860, -63, 8572, 14888, 11711, 2720, -2680, -1575, 1005, 982, -342, -561, 71, 276, 14, -109, -21, 30, 8, -4, 1, 26, 10, -87, -67, 198, 230, -347, -598, 478, 1327, -465, -2859, -69, 8563, 14888, 11718, 2728, -2678, -1578, 1004, 983, -341, -561, 70, 276, 14, -109, -21, 30, 8, -4,
+ 0, 26, 10, -87, -67, 198, 231, -346, -598, 477, 1328, -462, -2859, -75, 8554, 14886, 11725, 2736, -2676, -1581, 1002, 984, -340, -562, 70, 276, 14, -109, -21, 30, 8, -4, 0, 26, 11, -87, -67, 197, 231, -345, -598, 475, 1328, -459, -2858, -82, 8545, 14882, 11733, 2745, -2675, -1583, 1001, 985, -339, -562, 69, 276, 15, -109, -21, 30, 8, -4,
+ 0, 26, 11, -86, -67, 197, 231, -345, -599, 474, 1328, -456, -2857, -88, 8536, 14881, 11740, 2753, -2673, -1586, 999, 986, -338, -563, 69, 276, 15, -109, -21, 30, 8, -4, 0, 26, 11, -86, -67, 197, 231, -344, -599, 472, 1329, -454, -2857, -94, 8527, 14878, 11748, 2761, -2671, -1589, 998, 987, -337, -563, 68, 276, 15, -109, -21, 30, 9, -4,
+ 0, 26, 11, -86, -67, 197, 232, -343, -600, 471, 1329, -451, -2856, -101, 8518, 14874, 11755, 2770, -2669, -1592, 996, 989, -336, -563, 68, 276, 15, -109, -21, 30, 9, -4, 0, 26, 11, -86, -68, 196, 232, -343, -600, 469, 1329, -448, -2855, -107, 8509, 14875, 11763, 2778, -2668, -1595, 995, 990, -335, -564, 67, 276, 16, -109, -21, 30, 9, -4,
+ 0, 26, 11, -86, -68, 196, 232, -342, -600, 468, 1329, -445, -2855, -113, 8499, 14872, 11770, 2787, -2666, -1598, 994, 991, -334, -564, 67, 277, 16, -109, -22, 30, 9, -4, 0, 26, 11, -86, -68, 196, 233, -341, -601, 467, 1330, -442, -2854, -119, 8490, 14870, 11777, 2795, -2664, -1601, 992, 992, -333, -565, 66, 277, 16, -109, -22, 30, 9, -4,
+ 0, 26, 11, -86, -68, 195, 233, -341, -601, 465, 1330, -439, -2853, -126, 8481, 14869, 11785, 2803, -2662, -1603, 991, 993, -332, -565, 65, 277, 16, -109, -22, 30, 9, -4, 0, 26, 11, -86, -68, 195, 233, -340, -601, 464, 1330, -436, -2853, -132, 8472, 14867, 11792, 2812, -2661, -1606, 989, 994, -331, -566, 65, 277, 17, -109, -22, 30, 9, -4,
+ 0, 26, 11, -86, -68, 195, 233, -339, -602, 462, 1330, -433, -2852, -138, 8463, 14865, 11799, 2820, -2659, -1609, 988, 996, -330, -566, 64, 277, 17, -109, -22, 30, 9, -4, 0, 26, 11, -86, -68, 195, 234, -339, -602, 461, 1331, -430, -2851, -144, 8454, 14860, 11807, 2829, -2657, -1612, 986, 997, -329, -567, 64, 277, 17, -109, -22, 30, 9, -4,
+ 0, 26, 11, -86, -69, 194, 234, -338, -603, 459, 1331, -428, -2850, -151, 8445, 14863, 11814, 2837, -2655, -1615, 985, 998, -328, -567, 63, 277, 17, -109, -22, 30, 9, -4, 0, 25, 11, -86, -69, 194, 234, -338, -603, 458, 1331, -425, -2850, -157, 8436, 14862, 11821, 2845, -2653, -1618, 983, 999, -327, -567, 63, 277, 18, -109, -22, 30, 9, -4,
+ 0, 25, 11, -85, -69, 194, 235, -337, -603, 457, 1331, -422, -2849, -163, 8427, 14855, 11829, 2854, -2652, -1620, 982, 1000, -326, -568, 62, 278, 18, -109, -22, 30, 9, -4, 0, 25, 11, -85, -69, 194, 235, -336, -604, 455, 1332, -419, -2848, -169, 8418, 14853, 11836, 2862, -2650, -1623, 980, 1001, -325, -568, 62, 278, 18, -109, -22, 30, 9, -4,
+ 0, 25, 12, -85, -69, 193, 235, -336, -604, 454, 1332, -416, -2847, -175, 8409, 14852, 11843, 2871, -2648, -1626, 979, 1002, -324, -569, 61, 278, 18, -109, -23, 30, 9, -4, 0, 25, 12, -85, -69, 193, 235, -335, -604, 452, 1332, -413, -2847, -182, 8400, 14850, 11851, 2879, -2646, -1629, 977, 1004, -323, -569, 60, 278, 19, -109, -23, 30, 9, -4,
+ 0, 25, 12, -85, -70, 193, 236, -334, -605, 451, 1332, -410, -2846, -188, 8391, 14847, 11858, 2887, -2644, -1632, 976, 1005, -322, -569, 60, 278, 19, -109, -23, 30, 9, -4, 0, 25, 12, -85, -70, 192, 236, -334, -605, 449, 1332, -408, -2845, -194, 8382, 14850, 11865, 2896, -2642, -1635, 974, 1006, -322, -570, 59, 278, 19, -109, -23, 30, 9, -4,
+ 0, 25, 12, -85, -70, 192, 236, -333, -606, 448, 1333, -405, -2844, -200, 8373, 14843, 11873, 2904, -2640, -1637, 973, 1007, -321, -570, 59, 278, 20, -109, -23, 30, 9, -4, 0, 25, 12, -85, -70, 192, 237, -332, -606, 447, 1333, -402, -2844, -206, 8364, 14842, 11880, 2913, -2639, -1640, 971, 1008, -320, -571, 58, 278, 20, -109, -23, 30, 9, -4,
+ 0, 25, 12, -85, -70, 192, 237, -332, -606, 445, 1333, -399, -2843, -212, 8355, 14840, 11887, 2921, -2637, -1643, 970, 1009, -319, -571, 58, 278, 20, -109, -23, 30, 9, -4, 0, 25, 12, -85, -70, 191, 237, -331, -607, 444, 1333, -396, -2842, -219, 8345, 14840, 11895, 2930, -2635, -1646, 968, 1010, -318, -572, 57, 279, 20, -109, -23, 30, 9, -4,
+ 0, 25, 12, -85, -71, 191, 237, -330, -607, 442, 1334, -393, -2841, -225, 8336, 14835, 11902, 2938, -2633, -1649, 967, 1012, -317, -572, 57, 279, 21, -109, -23, 30, 9, -4, 0, 25, 12, -84, -71, 191, 238, -330, -607, 441, 1334, -390, -2841, -231, 8327, 14833, 11909, 2946, -2631, -1652, 965, 1013, -316, -572, 56, 279, 21, -109, -23, 30, 9, -4,
+ 0, 25, 12, -84, -71, 191, 238, -329, -608, 439, 1334, -387, -2840, -237, 8318, 14830, 11916, 2955, -2629, -1654, 964, 1014, -315, -573, 56, 279, 21, -109, -23, 30, 9, -4, 0, 25, 12, -84, -71, 190, 238, -328, -608, 438, 1334, -385, -2839, -243, 8309, 14830, 11924, 2963, -2627, -1657, 962, 1015, -314, -573, 55, 279, 21, -109, -24, 30, 9, -4,
+ 0, 25, 12, -84, -71, 190, 239, -328, -608, 437, 1334, -382, -2838, -249, 8300, 14826, 11931, 2972, -2625, -1660, 961, 1016, -313, -574, 54, 279, 22, -109, -24, 30, 9, -4, 0, 25, 12, -84, -71, 190, 239, -327, -609, 435, 1335, -379, -2837, -255, 8291, 14824, 11938, 2980, -2623, -1663, 959, 1017, -312, -574, 54, 279, 22, -109, -24, 30, 9, -4,
+ 0, 25, 12, -84, -71, 190, 239, -326, -609, 434, 1335, -376, -2836, -262, 8282, 14821, 11945, 2989, -2621, -1666, 958, 1018, -311, -574, 53, 279, 22, -109, -24, 30, 9, -4, 0, 25, 12, -84, -72, 189, 239, -326, -609, 432, 1335, -373, -2836, -268, 8273, 14822, 11953, 2997, -2620, -1668, 956, 1019, -310, -575, 53, 280, 22, -109, -24, 30, 9, -4,
+ 0, 25, 13, -84, -72, 189, 240, -325, -610, 431, 1335, -370, -2835, -274, 8264, 14815, 11960, 3006, -2618, -1671, 955, 1021, -309, -575, 52, 280, 23, -109, -24, 30, 9, -4, 0, 25, 13, -84, -72, 189, 240, -324, -610, 429, 1335, -367, -2834, -280, 8255, 14814, 11967, 3014, -2616, -1674, 953, 1022, -308, -576, 52, 280, 23, -109, -24, 30, 9, -4,
+ 0, 25, 13, -84, -72, 188, 240, -324, -610, 428, 1335, -365, -2833, -286, 8245, 14814, 11974, 3023, -2614, -1677, 952, 1023, -307, -576, 51, 280, 23, -109, -24, 30, 9, -4, 0, 25, 13, -84, -72, 188, 240, -323, -611, 427, 1336, -362, -2832, -292, 8236, 14813, 11981, 3031, -2612, -1680, 950, 1024, -306, -576, 50, 280, 23, -110, -24, 30, 9, -4,
+ 0, 25, 13, -83, -72, 188, 241, -322, -611, 425, 1336, -359, -2831, -298, 8227, 14806, 11989, 3040, -2610, -1682, 948, 1025, -305, -577, 50, 280, 24, -110, -24, 30, 9, -4, 0, 25, 13, -83, -72, 188, 241, -322, -611, 424, 1336, -356, -2831, -304, 8218, 14806, 11996, 3048, -2608, -1685, 947, 1026, -304, -577, 49, 280, 24, -110, -25, 30, 9, -4,
+ 0, 25, 13, -83, -73, 187, 241, -321, -612, 422, 1336, -353, -2830, -310, 8209, 14807, 12003, 3057, -2606, -1688, 945, 1027, -303, -578, 49, 280, 24, -110, -25, 30, 9, -4, 0, 25, 13, -83, -73, 187, 241, -320, -612, 421, 1336, -350, -2829, -316, 8200, 14803, 12010, 3065, -2604, -1691, 944, 1028, -302, -578, 48, 280, 25, -110, -25, 30, 9, -4,
+ 0, 25, 13, -83, -73, 187, 242, -320, -612, 419, 1336, -348, -2828, -322, 8191, 14799, 12017, 3074, -2602, -1694, 942, 1030, -301, -578, 48, 281, 25, -110, -25, 30, 9, -4, 0, 25, 13, -83, -73, 187, 242, -319, -613, 418, 1337, -345, -2827, -328, 8182, 14795, 12024, 3082, -2600, -1696, 941, 1031, -300, -579, 47, 281, 25, -110, -25, 30, 10, -4,
+ 0, 25, 13, -83, -73, 186, 242, -318, -613, 417, 1337, -342, -2826, -334, 8173, 14791, 12032, 3091, -2598, -1699, 939, 1032, -299, -579, 47, 281, 25, -110, -25, 30, 10, -4, 0, 25, 13, -83, -73, 186, 243, -318, -613, 415, 1337, -339, -2825, -340, 8164, 14789, 12039, 3099, -2596, -1702, 938, 1033, -298, -580, 46, 281, 26, -110, -25, 30, 10, -4,
+ 0, 25, 13, -83, -74, 186, 243, -317, -614, 414, 1337, -336, -2824, -346, 8154, 14789, 12046, 3108, -2594, -1705, 936, 1034, -297, -580, 45, 281, 26, -110, -25, 30, 10, -4, 0, 25, 13, -83, -74, 185, 243, -316, -614, 412, 1337, -333, -2824, -352, 8145, 14789, 12053, 3116, -2592, -1708, 934, 1035, -296, -580, 45, 281, 26, -110, -25, 30, 10, -4,
+ 0, 25, 13, -83, -74, 185, 243, -315, -614, 411, 1337, -331, -2823, -358, 8136, 14787, 12060, 3125, -2590, -1710, 933, 1036, -295, -581, 44, 281, 26, -110, -26, 30, 10, -4, 0, 25, 13, -82, -74, 185, 244, -315, -615, 409, 1338, -328, -2822, -364, 8127, 14783, 12067, 3133, -2588, -1713, 931, 1037, -294, -581, 44, 281, 27, -110, -26, 30, 10, -4,
+ 0, 25, 13, -82, -74, 185, 244, -314, -615, 408, 1338, -325, -2821, -370, 8118, 14780, 12074, 3142, -2586, -1716, 930, 1038, -293, -582, 43, 281, 27, -110, -26, 30, 10, -4, 0, 25, 14, -82, -74, 184, 244, -313, -615, 407, 1338, -322, -2820, -376, 8109, 14775, 12082, 3150, -2583, -1719, 928, 1039, -292, -582, 43, 281, 27, -110, -26, 30, 10, -4,
+ 0, 25, 14, -82, -74, 184, 244, -313, -616, 405, 1338, -319, -2819, -382, 8100, 14773, 12089, 3159, -2581, -1722, 926, 1041, -291, -582, 42, 282, 27, -110, -26, 30, 10, -4, 0, 25, 14, -82, -75, 184, 245, -312, -616, 404, 1338, -316, -2818, -388, 8091, 14769, 12096, 3167, -2579, -1724, 925, 1042, -290, -583, 41, 282, 28, -110, -26, 30, 10, -4,
+ 0, 25, 14, -82, -75, 183, 245, -311, -616, 402, 1338, -314, -2817, -394, 8081, 14768, 12103, 3176, -2577, -1727, 923, 1043, -288, -583, 41, 282, 28, -110, -26, 30, 10, -4, 0, 25, 14, -82, -75, 183, 245, -311, -617, 401, 1338, -311, -2816, -400, 8072, 14768, 12110, 3184, -2575, -1730, 922, 1044, -287, -584, 40, 282, 28, -110, -26, 30, 10, -4,
+ 0, 25, 14, -82, -75, 183, 245, -310, -617, 399, 1338, -308, -2815, -406, 8063, 14764, 12117, 3193, -2573, -1733, 920, 1045, -286, -584, 40, 282, 29, -110, -26, 30, 10, -4, 0, 25, 14, -82, -75, 183, 246, -309, -617, 398, 1339, -305, -2814, -412, 8054, 14758, 12124, 3202, -2571, -1735, 918, 1046, -285, -584, 39, 282, 29, -110, -26, 30, 10, -4,
+ 0, 24, 14, -82, -75, 182, 246, -309, -618, 397, 1339, -302, -2813, -418, 8045, 14760, 12131, 3210, -2569, -1738, 917, 1047, -284, -585, 39, 282, 29, -110, -27, 30, 10, -4, 0, 24, 14, -82, -75, 182, 246, -308, -618, 395, 1339, -299, -2812, -424, 8036, 14758, 12138, 3219, -2567, -1741, 915, 1048, -283, -585, 38, 282, 29, -110, -27, 30, 10, -4,
+ 0, 24, 14, -81, -76, 182, 246, -307, -618, 394, 1339, -297, -2811, -430, 8027, 14755, 12145, 3227, -2565, -1744, 914, 1049, -282, -585, 37, 282, 30, -110, -27, 30, 10, -4, 0, 24, 14, -81, -76, 182, 247, -307, -619, 392, 1339, -294, -2810, -436, 8017, 14754, 12152, 3236, -2562, -1747, 912, 1050, -281, -586, 37, 282, 30, -110, -27, 30, 10, -4,
+ 0, 24, 14, -81, -76, 181, 247, -306, -619, 391, 1339, -291, -2809, -442, 8008, 14751, 12159, 3244, -2560, -1749, 910, 1051, -280, -586, 36, 283, 30, -110, -27, 30, 10, -4, 0, 24, 14, -81, -76, 181, 247, -305, -619, 389, 1339, -288, -2808, -448, 7999, 14747, 12166, 3253, -2558, -1752, 909, 1053, -279, -587, 36, 283, 30, -110, -27, 30, 10, -4,
+ 0, 24, 14, -81, -76, 181, 247, -305, -619, 388, 1339, -285, -2807, -453, 7990, 14743, 12173, 3262, -2556, -1755, 907, 1054, -278, -587, 35, 283, 31, -110, -27, 30, 10, -4, 0, 24, 14, -81, -76, 180, 248, -304, -620, 387, 1339, -282, -2806, -459, 7981, 14741, 12180, 3270, -2554, -1758, 905, 1055, -277, -587, 35, 283, 31, -110, -27, 30, 10, -4,
+ 0, 24, 14, -81, -76, 180, 248, -303, -620, 385, 1339, -280, -2805, -465, 7972, 14739, 12187, 3279, -2552, -1760, 904, 1056, -276, -588, 34, 283, 31, -110, -27, 30, 10, -4, 0, 24, 14, -81, -77, 180, 248, -303, -620, 384, 1340, -277, -2804, -471, 7963, 14735, 12195, 3287, -2549, -1763, 902, 1057, -275, -588, 33, 283, 32, -110, -27, 30, 10, -4,
+ 0, 24, 15, -81, -77, 180, 248, -302, -621, 382, 1340, -274, -2803, -477, 7953, 14734, 12202, 3296, -2547, -1766, 901, 1058, -274, -589, 33, 283, 32, -110, -28, 30, 10, -4, 0, 24, 15, -81, -77, 179, 249, -301, -621, 381, 1340, -271, -2802, -483, 7944, 14732, 12208, 3305, -2545, -1769, 899, 1059, -273, -589, 32, 283, 32, -110, -28, 30, 10, -4,
+ -1, 24, 15, -80, -77, 179, 249, -301, -621, 379, 1340, -268, -2801, -489, 7935, 14730, 12215, 3313, -2543, -1771, 897, 1060, -272, -589, 32, 283, 32, -110, -28, 30, 10, -4, -1, 24, 15, -80, -77, 179, 249, -300, -621, 378, 1340, -266, -2800, -494, 7926, 14726, 12222, 3322, -2541, -1774, 896, 1061, -271, -590, 31, 283, 33, -110, -28, 30, 10, -4,
+ -1, 24, 15, -80, -77, 179, 249, -299, -622, 377, 1340, -263, -2799, -500, 7917, 14723, 12229, 3330, -2538, -1777, 894, 1062, -270, -590, 31, 283, 33, -110, -28, 30, 10, -4, -1, 24, 15, -80, -77, 178, 250, -299, -622, 375, 1340, -260, -2798, -506, 7908, 14721, 12236, 3339, -2536, -1780, 892, 1063, -269, -590, 30, 284, 33, -110, -28, 30, 10, -4,
+ -1, 24, 15, -80, -78, 178, 250, -298, -622, 374, 1340, -257, -2797, -512, 7898, 14719, 12243, 3348, -2534, -1782, 891, 1064, -268, -591, 29, 284, 33, -110, -28, 30, 10, -4, -1, 24, 15, -80, -78, 178, 250, -297, -623, 372, 1340, -254, -2796, -518, 7889, 14717, 12250, 3356, -2532, -1785, 889, 1065, -267, -591, 29, 284, 34, -110, -28, 30, 10, -4,
+ -1, 24, 15, -80, -78, 177, 250, -297, -623, 371, 1340, -252, -2795, -524, 7880, 14716, 12257, 3365, -2529, -1788, 887, 1066, -266, -591, 28, 284, 34, -110, -28, 30, 10, -4, -1, 24, 15, -80, -78, 177, 251, -296, -623, 370, 1340, -249, -2794, -529, 7871, 14710, 12264, 3374, -2527, -1791, 886, 1067, -265, -592, 28, 284, 34, -110, -28, 30, 10, -4,
+ -1, 24, 15, -80, -78, 177, 251, -295, -623, 368, 1340, -246, -2793, -535, 7862, 14707, 12271, 3382, -2525, -1793, 884, 1069, -264, -592, 27, 284, 35, -110, -29, 30, 10, -4, -1, 24, 15, -80, -78, 177, 251, -295, -624, 367, 1340, -243, -2792, -541, 7853, 14707, 12278, 3391, -2523, -1796, 882, 1070, -263, -593, 26, 284, 35, -110, -29, 30, 10, -4,
+ -1, 24, 15, -80, -78, 176, 251, -294, -624, 365, 1340, -240, -2791, -547, 7843, 14704, 12285, 3399, -2520, -1799, 881, 1071, -261, -593, 26, 284, 35, -110, -29, 30, 10, -4, -1, 24, 15, -79, -79, 176, 251, -293, -624, 364, 1341, -238, -2790, -553, 7834, 14700, 12292, 3408, -2518, -1802, 879, 1072, -260, -593, 25, 284, 35, -110, -29, 30, 11, -4,
+ -1, 24, 15, -79, -79, 176, 252, -293, -625, 362, 1341, -235, -2789, -558, 7825, 14696, 12299, 3417, -2516, -1804, 877, 1073, -259, -594, 25, 284, 36, -110, -29, 30, 11, -4, -1, 24, 15, -79, -79, 175, 252, -292, -625, 361, 1341, -232, -2788, -564, 7816, 14694, 12306, 3425, -2514, -1807, 876, 1074, -258, -594, 24, 284, 36, -110, -29, 30, 11, -4,
+ -1, 24, 15, -79, -79, 175, 252, -291, -625, 360, 1341, -229, -2787, -570, 7807, 14688, 12313, 3434, -2511, -1810, 874, 1075, -257, -594, 24, 285, 36, -110, -29, 30, 11, -4, -1, 24, 15, -79, -79, 175, 252, -291, -625, 358, 1341, -226, -2786, -576, 7798, 14689, 12319, 3443, -2509, -1813, 872, 1076, -256, -595, 23, 285, 36, -110, -29, 30, 11, -4,
+ -1, 24, 16, -79, -79, 175, 253, -290, -626, 357, 1341, -224, -2784, -581, 7788, 14683, 12326, 3451, -2507, -1815, 871, 1077, -255, -595, 22, 285, 37, -110, -29, 30, 11, -4, -1, 24, 16, -79, -79, 174, 253, -289, -626, 355, 1341, -221, -2783, -587, 7779, 14680, 12333, 3460, -2504, -1818, 869, 1078, -254, -595, 22, 285, 37, -110, -29, 30, 11, -4,
+ -1, 24, 16, -79, -79, 174, 253, -289, -626, 354, 1341, -218, -2782, -593, 7770, 14680, 12340, 3469, -2502, -1821, 867, 1079, -253, -596, 21, 285, 37, -110, -30, 30, 11, -4, -1, 24, 16, -79, -80, 174, 253, -288, -626, 352, 1341, -215, -2781, -599, 7761, 14676, 12347, 3477, -2500, -1823, 866, 1080, -252, -596, 21, 285, 38, -110, -30, 30, 11, -4,
+ -1, 24, 16, -79, -80, 173, 254, -287, -627, 351, 1341, -213, -2780, -604, 7752, 14673, 12354, 3486, -2497, -1826, 864, 1081, -251, -596, 20, 285, 38, -110, -30, 30, 11, -4, -1, 24, 16, -78, -80, 173, 254, -286, -627, 350, 1341, -210, -2779, -610, 7742, 14671, 12361, 3495, -2495, -1829, 862, 1082, -250, -597, 19, 285, 38, -110, -30, 30, 11, -4,
+ -1, 24, 16, -78, -80, 173, 254, -286, -627, 348, 1341, -207, -2778, -616, 7733, 14671, 12367, 3503, -2493, -1832, 860, 1083, -249, -597, 19, 285, 38, -110, -30, 30, 11, -4, -1, 24, 16, -78, -80, 173, 254, -285, -627, 347, 1341, -204, -2777, -621, 7724, 14664, 12374, 3512, -2490, -1834, 859, 1084, -248, -598, 18, 285, 39, -110, -30, 30, 11, -4,
+ -1, 24, 16, -78, -80, 172, 254, -284, -628, 345, 1341, -201, -2775, -627, 7715, 14662, 12381, 3521, -2488, -1837, 857, 1085, -247, -598, 18, 285, 39, -110, -30, 30, 11, -4, -1, 24, 16, -78, -80, 172, 255, -284, -628, 344, 1341, -199, -2774, -633, 7706, 14659, 12388, 3530, -2485, -1840, 855, 1086, -246, -598, 17, 285, 39, -110, -30, 30, 11, -4,
+ -1, 24, 16, -78, -81, 172, 255, -283, -628, 342, 1341, -196, -2773, -638, 7697, 14655, 12395, 3538, -2483, -1842, 854, 1087, -244, -599, 16, 286, 39, -110, -30, 30, 11, -4, -1, 24, 16, -78, -81, 171, 255, -282, -628, 341, 1341, -193, -2772, -644, 7687, 14652, 12402, 3547, -2481, -1845, 852, 1088, -243, -599, 16, 286, 40, -110, -30, 30, 11, -4,
+ -1, 23, 16, -78, -81, 171, 255, -282, -629, 340, 1341, -190, -2771, -650, 7678, 14653, 12408, 3556, -2478, -1848, 850, 1089, -242, -599, 15, 286, 40, -110, -31, 30, 11, -4, -1, 23, 16, -78, -81, 171, 256, -281, -629, 338, 1341, -188, -2770, -655, 7669, 14651, 12415, 3564, -2476, -1851, 848, 1090, -241, -600, 15, 286, 40, -110, -31, 30, 11, -4,
+ -1, 23, 16, -78, -81, 171, 256, -280, -629, 337, 1341, -185, -2769, -661, 7660, 14644, 12422, 3573, -2473, -1853, 847, 1091, -240, -600, 14, 286, 41, -110, -31, 30, 11, -4, -1, 23, 16, -78, -81, 170, 256, -280, -629, 335, 1341, -182, -2767, -667, 7651, 14642, 12429, 3582, -2471, -1856, 845, 1092, -239, -600, 14, 286, 41, -110, -31, 30, 11, -4,
+ -1, 23, 16, -77, -81, 170, 256, -279, -630, 334, 1341, -179, -2766, -672, 7641, 14642, 12435, 3590, -2469, -1859, 843, 1093, -238, -601, 13, 286, 41, -110, -31, 30, 11, -4, -1, 23, 16, -77, -81, 170, 256, -278, -630, 333, 1341, -177, -2765, -678, 7632, 14638, 12442, 3599, -2466, -1861, 841, 1094, -237, -601, 12, 286, 41, -110, -31, 30, 11, -4,
+ -1, 23, 17, -77, -82, 170, 257, -278, -630, 331, 1341, -174, -2764, -684, 7623, 14633, 12449, 3608, -2464, -1864, 840, 1095, -236, -601, 12, 286, 42, -110, -31, 30, 11, -4, -1, 23, 17, -77, -82, 169, 257, -277, -630, 330, 1341, -171, -2763, -689, 7614, 14630, 12456, 3617, -2461, -1867, 838, 1096, -235, -602, 11, 286, 42, -110, -31, 30, 11, -4,
+ -1, 23, 17, -77, -82, 169, 257, -276, -631, 328, 1341, -168, -2761, -695, 7605, 14628, 12462, 3625, -2459, -1869, 836, 1097, -234, -602, 11, 286, 42, -110, -31, 30, 11, -4, -1, 23, 17, -77, -82, 169, 257, -276, -631, 327, 1341, -166, -2760, -700, 7595, 14627, 12469, 3634, -2456, -1872, 834, 1098, -233, -602, 10, 286, 42, -110, -32, 30, 11, -4,
+ -1, 23, 17, -77, -82, 168, 258, -275, -631, 325, 1341, -163, -2759, -706, 7586, 14623, 12476, 3643, -2454, -1875, 833, 1099, -231, -603, 9, 286, 43, -110, -32, 30, 11, -4, -1, 23, 17, -77, -82, 168, 258, -274, -631, 324, 1341, -160, -2758, -712, 7577, 14616, 12483, 3652, -2451, -1877, 831, 1100, -230, -603, 9, 287, 43, -110, -32, 30, 11, -4,
+ -1, 23, 17, -77, -82, 168, 258, -274, -632, 323, 1341, -157, -2757, -717, 7568, 14616, 12489, 3660, -2449, -1880, 829, 1101, -229, -603, 8, 287, 43, -110, -32, 30, 11, -4, -1, 23, 17, -77, -82, 168, 258, -273, -632, 321, 1341, -155, -2755, -723, 7558, 14613, 12496, 3669, -2446, -1883, 827, 1102, -228, -604, 8, 287, 44, -110, -32, 30, 11, -4,
+ -1, 23, 17, -76, -83, 167, 258, -272, -632, 320, 1341, -152, -2754, -728, 7549, 14608, 12503, 3678, -2444, -1885, 826, 1103, -227, -604, 7, 287, 44, -110, -32, 30, 11, -4, -1, 23, 17, -76, -83, 167, 259, -272, -632, 318, 1341, -149, -2753, -734, 7540, 14606, 12509, 3687, -2441, -1888, 824, 1104, -226, -604, 6, 287, 44, -110, -32, 30, 11, -4,
+ -1, 23, 17, -76, -83, 167, 259, -271, -632, 317, 1341, -146, -2752, -739, 7531, 14603, 12516, 3695, -2439, -1891, 822, 1105, -225, -605, 6, 287, 44, -110, -32, 30, 11, -4, -1, 23, 17, -76, -83, 166, 259, -270, -633, 315, 1341, -144, -2751, -745, 7522, 14601, 12523, 3704, -2436, -1893, 820, 1106, -224, -605, 5, 287, 45, -110, -32, 30, 11, -4,
+ -1, 23, 17, -76, -83, 166, 259, -270, -633, 314, 1340, -141, -2749, -751, 7512, 14599, 12529, 3713, -2434, -1896, 819, 1107, -223, -605, 5, 287, 45, -110, -32, 30, 11, -4, -1, 23, 17, -76, -83, 166, 259, -269, -633, 313, 1340, -138, -2748, -756, 7503, 14596, 12536, 3722, -2431, -1899, 817, 1108, -222, -606, 4, 287, 45, -110, -33, 30, 11, -4,
+ -1, 23, 17, -76, -83, 166, 260, -268, -633, 311, 1340, -135, -2747, -762, 7494, 14591, 12543, 3730, -2429, -1901, 815, 1109, -221, -606, 3, 287, 46, -110, -33, 30, 12, -4, -1, 23, 17, -76, -83, 165, 260, -267, -634, 310, 1340, -133, -2746, -767, 7485, 14588, 12549, 3739, -2426, -1904, 813, 1110, -219, -606, 3, 287, 46, -110, -33, 30, 12, -4,
+ -1, 23, 17, -76, -84, 165, 260, -267, -634, 308, 1340, -130, -2744, -773, 7476, 14588, 12556, 3748, -2424, -1907, 811, 1111, -218, -607, 2, 287, 46, -110, -33, 30, 12, -4, -1, 23, 17, -76, -84, 165, 260, -266, -634, 307, 1340, -127, -2743, -778, 7466, 14581, 12563, 3757, -2421, -1909, 810, 1112, -217, -607, 2, 287, 46, -110, -33, 30, 12, -4,
+ -1, 23, 17, -75, -84, 164, 261, -265, -634, 306, 1340, -124, -2742, -784, 7457, 14577, 12569, 3765, -2418, -1912, 808, 1113, -216, -607, 1, 287, 47, -110, -33, 30, 12, -4, -1, 23, 18, -75, -84, 164, 261, -265, -634, 304, 1340, -122, -2740, -789, 7448, 14575, 12576, 3774, -2416, -1915, 806, 1114, -215, -608, 0, 287, 47, -110, -33, 30, 12, -4,
+ -1, 23, 18, -75, -84, 164, 261, -264, -635, 303, 1340, -119, -2739, -795, 7439, 14570, 12583, 3783, -2413, -1917, 804, 1115, -214, -608, 0, 287, 47, -110, -33, 30, 12, -4, -1, 23, 18, -75, -84, 164, 261, -263, -635, 301, 1340, -116, -2738, -800, 7429, 14568, 12589, 3792, -2411, -1920, 802, 1116, -213, -608, -1, 288, 47, -110, -33, 30, 12, -4,
+ -1, 23, 18, -75, -84, 163, 261, -263, -635, 300, 1340, -113, -2737, -806, 7420, 14563, 12596, 3801, -2408, -1923, 801, 1117, -212, -608, -1, 288, 48, -110, -33, 30, 12, -4, -1, 23, 18, -75, -84, 163, 262, -262, -635, 298, 1340, -111, -2735, -811, 7411, 14561, 12602, 3809, -2405, -1925, 799, 1118, -211, -609, -2, 288, 48, -110, -34, 30, 12, -4,
+ -1, 23, 18, -75, -85, 163, 262, -261, -635, 297, 1340, -108, -2734, -816, 7402, 14557, 12609, 3818, -2403, -1928, 797, 1119, -209, -609, -3, 288, 48, -110, -34, 30, 12, -4, -1, 23, 18, -75, -85, 162, 262, -261, -636, 296, 1340, -105, -2733, -822, 7393, 14554, 12616, 3827, -2400, -1931, 795, 1120, -208, -609, -3, 288, 49, -110, -34, 30, 12, -4,
+ -1, 23, 18, -75, -85, 162, 262, -260, -636, 294, 1340, -103, -2731, -827, 7383, 14553, 12622, 3836, -2398, -1933, 793, 1121, -207, -610, -4, 288, 49, -110, -34, 30, 12, -4, -1, 23, 18, -75, -85, 162, 262, -259, -636, 293, 1339, -100, -2730, -833, 7374, 14548, 12629, 3845, -2395, -1936, 792, 1122, -206, -610, -4, 288, 49, -110, -34, 30, 12, -4,
+ -1, 23, 18, -74, -85, 162, 263, -259, -636, 291, 1339, -97, -2729, -838, 7365, 14545, 12635, 3853, -2392, -1939, 790, 1123, -205, -610, -5, 288, 49, -110, -34, 30, 12, -4, -1, 23, 18, -74, -85, 161, 263, -258, -636, 290, 1339, -94, -2727, -844, 7356, 14541, 12642, 3862, -2390, -1941, 788, 1124, -204, -611, -6, 288, 50, -110, -34, 30, 12, -4,
+ -1, 23, 18, -74, -85, 161, 263, -257, -637, 289, 1339, -92, -2726, -849, 7346, 14539, 12648, 3871, -2387, -1944, 786, 1125, -203, -611, -6, 288, 50, -110, -34, 30, 12, -4, -1, 23, 18, -74, -85, 161, 263, -257, -637, 287, 1339, -89, -2725, -854, 7337, 14535, 12655, 3880, -2384, -1946, 784, 1126, -202, -611, -7, 288, 50, -110, -34, 30, 12, -4,
+ -1, 23, 18, -74, -86, 160, 263, -256, -637, 286, 1339, -86, -2723, -860, 7328, 14533, 12661, 3889, -2382, -1949, 782, 1127, -200, -612, -7, 288, 51, -110, -35, 30, 12, -4, -1, 22, 18, -74, -86, 160, 264, -255, -637, 284, 1339, -84, -2722, -865, 7319, 14530, 12668, 3897, -2379, -1952, 781, 1128, -199, -612, -8, 288, 51, -110, -35, 30, 12, -4,
+ -1, 22, 18, -74, -86, 160, 264, -255, -637, 283, 1339, -81, -2721, -871, 7309, 14528, 12674, 3906, -2376, -1954, 779, 1129, -198, -612, -9, 288, 51, -110, -35, 30, 12, -4, -1, 22, 18, -74, -86, 160, 264, -254, -638, 282, 1339, -78, -2719, -876, 7300, 14523, 12681, 3915, -2374, -1957, 777, 1130, -197, -612, -9, 288, 51, -110, -35, 30, 12, -4,
+ -1, 22, 18, -74, -86, 159, 264, -253, -638, 280, 1338, -75, -2718, -881, 7291, 14522, 12687, 3924, -2371, -1960, 775, 1131, -196, -613, -10, 288, 52, -110, -35, 30, 12, -4, -1, 22, 18, -74, -86, 159, 264, -252, -638, 279, 1338, -73, -2717, -887, 7282, 14518, 12694, 3933, -2368, -1962, 773, 1132, -195, -613, -11, 288, 52, -110, -35, 30, 12, -4,
+ -1, 22, 19, -73, -86, 159, 265, -252, -638, 277, 1338, -70, -2715, -892, 7272, 14511, 12700, 3942, -2365, -1965, 771, 1133, -194, -613, -11, 289, 52, -110, -35, 30, 12, -4, -1, 22, 19, -73, -86, 158, 265, -251, -638, 276, 1338, -67, -2714, -897, 7263, 14508, 12707, 3950, -2363, -1967, 769, 1134, -193, -614, -12, 289, 53, -110, -35, 30, 12, -4,
+ -1, 22, 19, -73, -87, 158, 265, -250, -639, 275, 1338, -65, -2713, -903, 7254, 14505, 12713, 3959, -2360, -1970, 768, 1135, -191, -614, -12, 289, 53, -110, -35, 30, 12, -4, -1, 22, 19, -73, -87, 158, 265, -250, -639, 273, 1338, -62, -2711, -908, 7245, 14501, 12720, 3968, -2357, -1973, 766, 1136, -190, -614, -13, 289, 53, -110, -35, 30, 12, -4,
+ -1, 22, 19, -73, -87, 158, 265, -249, -639, 272, 1338, -59, -2710, -913, 7235, 14499, 12726, 3977, -2355, -1975, 764, 1137, -189, -614, -14, 289, 53, -110, -36, 30, 12, -4, -1, 22, 19, -73, -87, 157, 265, -248, -639, 270, 1338, -57, -2708, -919, 7226, 14497, 12733, 3986, -2352, -1978, 762, 1137, -188, -615, -14, 289, 54, -110, -36, 30, 12, -4,
+ -1, 22, 19, -73, -87, 157, 266, -248, -639, 269, 1337, -54, -2707, -924, 7217, 14493, 12739, 3995, -2349, -1980, 760, 1138, -187, -615, -15, 289, 54, -110, -36, 30, 12, -4, -1, 22, 19, -73, -87, 157, 266, -247, -639, 267, 1337, -51, -2706, -929, 7208, 14488, 12746, 4004, -2346, -1983, 758, 1139, -186, -615, -15, 289, 54, -110, -36, 30, 12, -4,
+ -1, 22, 19, -73, -87, 156, 266, -246, -640, 266, 1337, -49, -2704, -935, 7199, 14488, 12752, 4012, -2343, -1986, 756, 1140, -185, -616, -16, 289, 55, -110, -36, 30, 12, -4, -2, 22, 19, -73, -87, 156, 266, -246, -640, 265, 1337, -46, -2703, -940, 7189, 14487, 12758, 4021, -2341, -1988, 754, 1141, -184, -616, -17, 289, 55, -109, -36, 29, 12, -4,
+ -2, 22, 19, -72, -87, 156, 266, -245, -640, 263, 1337, -43, -2701, -945, 7180, 14478, 12765, 4030, -2338, -1991, 753, 1142, -182, -616, -17, 289, 55, -109, -36, 29, 12, -4, -2, 22, 19, -72, -88, 155, 267, -244, -640, 262, 1337, -40, -2700, -951, 7171, 14476, 12771, 4039, -2335, -1993, 751, 1143, -181, -617, -18, 289, 55, -109, -36, 29, 12, -4,
+ -2, 22, 19, -72, -88, 155, 267, -244, -640, 260, 1337, -38, -2699, -956, 7162, 14471, 12778, 4048, -2332, -1996, 749, 1144, -180, -617, -18, 289, 56, -109, -36, 29, 13, -4, -2, 22, 19, -72, -88, 155, 267, -243, -640, 259, 1336, -35, -2697, -961, 7152, 14469, 12784, 4057, -2329, -1999, 747, 1145, -179, -617, -19, 289, 56, -109, -37, 29, 13, -4,
+ -2, 22, 19, -72, -88, 155, 267, -242, -641, 258, 1336, -32, -2696, -966, 7143, 14466, 12790, 4066, -2327, -2001, 745, 1146, -178, -617, -20, 289, 56, -109, -37, 29, 13, -4, -2, 22, 19, -72, -88, 154, 267, -242, -641, 256, 1336, -30, -2694, -972, 7134, 14465, 12797, 4074, -2324, -2004, 743, 1147, -177, -618, -20, 289, 57, -109, -37, 29, 13, -4,
+ -2, 22, 19, -72, -88, 154, 267, -241, -641, 255, 1336, -27, -2693, -977, 7125, 14460, 12803, 4083, -2321, -2006, 741, 1148, -176, -618, -21, 289, 57, -109, -37, 29, 13, -4, -2, 22, 19, -72, -88, 154, 268, -240, -641, 253, 1336, -24, -2691, -982, 7115, 14455, 12809, 4092, -2318, -2009, 739, 1149, -174, -618, -22, 289, 57, -109, -37, 29, 13, -4,
+ -2, 22, 19, -72, -88, 153, 268, -239, -641, 252, 1336, -22, -2690, -987, 7106, 14450, 12816, 4101, -2315, -2011, 737, 1150, -173, -618, -22, 289, 57, -109, -37, 29, 13, -4, -2, 22, 19, -72, -88, 153, 268, -239, -641, 251, 1335, -19, -2689, -993, 7097, 14449, 12822, 4110, -2312, -2014, 736, 1150, -172, -619, -23, 289, 58, -109, -37, 29, 13, -4,
+ -2, 22, 19, -71, -89, 153, 268, -238, -641, 249, 1335, -16, -2687, -998, 7088, 14445, 12828, 4119, -2310, -2017, 734, 1151, -171, -619, -23, 289, 58, -109, -37, 29, 13, -4, -2, 22, 20, -71, -89, 153, 268, -237, -642, 248, 1335, -14, -2686, -1003, 7078, 14441, 12835, 4128, -2307, -2019, 732, 1152, -170, -619, -24, 289, 58, -109, -37, 29, 13, -4,
+ -2, 22, 20, -71, -89, 152, 269, -237, -642, 246, 1335, -11, -2684, -1008, 7069, 14437, 12841, 4137, -2304, -2022, 730, 1153, -169, -620, -25, 290, 59, -109, -37, 29, 13, -4, -2, 22, 20, -71, -89, 152, 269, -236, -642, 245, 1335, -8, -2683, -1013, 7060, 14431, 12847, 4146, -2301, -2024, 728, 1154, -167, -620, -25, 290, 59, -109, -38, 29, 13, -4,
+ -2, 22, 20, -71, -89, 152, 269, -235, -642, 244, 1335, -6, -2681, -1019, 7050, 14428, 12854, 4155, -2298, -2027, 726, 1155, -166, -620, -26, 290, 59, -109, -38, 29, 13, -4, -2, 22, 20, -71, -89, 151, 269, -235, -642, 242, 1334, -3, -2680, -1024, 7041, 14428, 12860, 4163, -2295, -2029, 724, 1156, -165, -620, -27, 290, 59, -109, -38, 29, 13, -4,
+ -2, 22, 20, -71, -89, 151, 269, -234, -642, 241, 1334, 0, -2678, -1029, 7032, 14422, 12866, 4172, -2292, -2032, 722, 1157, -164, -621, -27, 290, 60, -109, -38, 29, 13, -4, -2, 22, 20, -71, -89, 151, 269, -233, -643, 239, 1334, 2, -2677, -1034, 7023, 14419, 12873, 4181, -2289, -2034, 720, 1158, -163, -621, -28, 290, 60, -109, -38, 29, 13, -4,
+ -2, 22, 20, -71, -89, 151, 270, -233, -643, 238, 1334, 5, -2675, -1039, 7013, 14414, 12879, 4190, -2286, -2037, 718, 1159, -162, -621, -28, 290, 60, -109, -38, 29, 13, -4, -2, 22, 20, -71, -90, 150, 270, -232, -643, 237, 1334, 7, -2674, -1044, 7004, 14412, 12885, 4199, -2283, -2040, 716, 1160, -161, -621, -29, 290, 61, -109, -38, 29, 13, -4,
+ -2, 22, 20, -70, -90, 150, 270, -231, -643, 235, 1333, 10, -2672, -1050, 6995, 14409, 12891, 4208, -2280, -2042, 714, 1160, -159, -622, -30, 290, 61, -109, -38, 29, 13, -4, -2, 22, 20, -70, -90, 150, 270, -231, -643, 234, 1333, 13, -2671, -1055, 6986, 14405, 12898, 4217, -2278, -2045, 712, 1161, -158, -622, -30, 290, 61, -109, -38, 29, 13, -4,
+ -2, 22, 20, -70, -90, 149, 270, -230, -643, 232, 1333, 15, -2669, -1060, 6976, 14403, 12904, 4226, -2275, -2047, 711, 1162, -157, -622, -31, 290, 61, -109, -39, 29, 13, -4, -2, 21, 20, -70, -90, 149, 270, -229, -643, 231, 1333, 18, -2668, -1065, 6967, 14399, 12910, 4235, -2272, -2050, 709, 1163, -156, -622, -32, 290, 62, -109, -39, 29, 13, -4,
+ -2, 21, 20, -70, -90, 149, 271, -229, -643, 230, 1333, 21, -2666, -1070, 6958, 14393, 12916, 4244, -2269, -2052, 707, 1164, -155, -623, -32, 290, 62, -109, -39, 29, 13, -4, -2, 21, 20, -70, -90, 149, 271, -228, -644, 228, 1332, 23, -2665, -1075, 6949, 14393, 12922, 4253, -2266, -2055, 705, 1165, -154, -623, -33, 290, 62, -109, -39, 29, 13, -4,
+ -2, 21, 20, -70, -90, 148, 271, -227, -644, 227, 1332, 26, -2663, -1080, 6939, 14385, 12929, 4262, -2263, -2057, 703, 1166, -152, -623, -33, 290, 63, -109, -39, 29, 13, -4, -2, 21, 20, -70, -90, 148, 271, -227, -644, 225, 1332, 29, -2662, -1085, 6930, 14383, 12935, 4271, -2260, -2060, 701, 1167, -151, -623, -34, 290, 63, -109, -39, 29, 13, -4,
+ -2, 21, 20, -70, -91, 148, 271, -226, -644, 224, 1332, 31, -2660, -1091, 6921, 14382, 12941, 4279, -2257, -2062, 699, 1168, -150, -624, -35, 290, 63, -109, -39, 29, 13, -4, -2, 21, 20, -70, -91, 147, 271, -225, -644, 223, 1331, 34, -2659, -1096, 6912, 14380, 12947, 4288, -2254, -2065, 697, 1168, -149, -624, -35, 290, 63, -109, -39, 29, 13, -4,
+ -2, 21, 20, -69, -91, 147, 272, -224, -644, 221, 1331, 37, -2657, -1101, 6902, 14373, 12953, 4297, -2251, -2067, 695, 1169, -148, -624, -36, 290, 64, -109, -39, 29, 13, -4, -2, 21, 20, -69, -91, 147, 272, -224, -644, 220, 1331, 39, -2655, -1106, 6893, 14370, 12960, 4306, -2248, -2070, 693, 1170, -147, -625, -37, 290, 64, -109, -39, 29, 13, -4,
+ -2, 21, 20, -69, -91, 146, 272, -223, -645, 218, 1331, 42, -2654, -1111, 6884, 14367, 12966, 4315, -2245, -2072, 691, 1171, -145, -625, -37, 290, 64, -109, -40, 29, 13, -4, -2, 21, 21, -69, -91, 146, 272, -222, -645, 217, 1331, 44, -2652, -1116, 6875, 14361, 12972, 4324, -2242, -2075, 689, 1172, -144, -625, -38, 290, 65, -109, -40, 29, 13, -4,
+ -2, 21, 21, -69, -91, 146, 272, -222, -645, 216, 1330, 47, -2651, -1121, 6865, 14358, 12978, 4333, -2239, -2077, 687, 1173, -143, -625, -38, 290, 65, -109, -40, 29, 13, -4, -2, 21, 21, -69, -91, 146, 272, -221, -645, 214, 1330, 50, -2649, -1126, 6856, 14354, 12984, 4342, -2236, -2080, 685, 1174, -142, -625, -39, 290, 65, -109, -40, 29, 13, -4,
+ -2, 21, 21, -69, -91, 145, 273, -220, -645, 213, 1330, 52, -2648, -1131, 6847, 14351, 12990, 4351, -2233, -2082, 683, 1175, -141, -626, -40, 290, 65, -109, -40, 29, 13, -4, -2, 21, 21, -69, -92, 145, 273, -220, -645, 211, 1330, 55, -2646, -1136, 6837, 14345, 12997, 4360, -2229, -2085, 681, 1175, -139, -626, -40, 290, 66, -109, -40, 29, 14, -4,
+ -2, 21, 21, -69, -92, 145, 273, -219, -645, 210, 1329, 57, -2645, -1141, 6828, 14342, 13003, 4369, -2226, -2087, 679, 1176, -138, -626, -41, 290, 66, -109, -40, 29, 14, -4, -2, 21, 21, -69, -92, 144, 273, -218, -645, 209, 1329, 60, -2643, -1146, 6819, 14338, 13009, 4378, -2223, -2090, 677, 1177, -137, -626, -42, 290, 66, -109, -40, 29, 14, -4,
+ -2, 21, 21, -68, -92, 144, 273, -218, -645, 207, 1329, 63, -2641, -1151, 6810, 14332, 13015, 4387, -2220, -2092, 675, 1178, -136, -627, -42, 290, 67, -109, -40, 29, 14, -4, -2, 21, 21, -68, -92, 144, 273, -217, -646, 206, 1329, 65, -2640, -1156, 6800, 14332, 13021, 4396, -2217, -2095, 673, 1179, -135, -627, -43, 290, 67, -109, -41, 29, 14, -4,
+ -2, 21, 21, -68, -92, 144, 274, -216, -646, 205, 1328, 68, -2638, -1161, 6791, 14325, 13027, 4405, -2214, -2097, 671, 1180, -134, -627, -43, 290, 67, -109, -41, 29, 14, -4, -2, 21, 21, -68, -92, 143, 274, -216, -646, 203, 1328, 71, -2637, -1166, 6782, 14323, 13033, 4414, -2211, -2100, 669, 1181, -132, -627, -44, 290, 67, -109, -41, 29, 14, -4,
+ -2, 21, 21, -68, -92, 143, 274, -215, -646, 202, 1328, 73, -2635, -1171, 6773, 14319, 13039, 4423, -2208, -2102, 667, 1181, -131, -628, -45, 290, 68, -109, -41, 29, 14, -4, -2, 21, 21, -68, -92, 143, 274, -214, -646, 200, 1328, 76, -2633, -1176, 6763, 14315, 13045, 4432, -2205, -2105, 665, 1182, -130, -628, -45, 290, 68, -109, -41, 29, 14, -4,
+ -2, 21, 21, -68, -92, 142, 274, -214, -646, 199, 1327, 78, -2632, -1181, 6754, 14314, 13051, 4441, -2202, -2107, 663, 1183, -129, -628, -46, 290, 68, -109, -41, 29, 14, -4, -2, 21, 21, -68, -93, 142, 274, -213, -646, 198, 1327, 81, -2630, -1186, 6745, 14307, 13057, 4450, -2198, -2110, 661, 1184, -128, -628, -47, 290, 69, -108, -41, 29, 14, -4,
+ -2, 21, 21, -68, -93, 142, 274, -212, -646, 196, 1327, 84, -2629, -1191, 6736, 14301, 13063, 4459, -2195, -2112, 659, 1185, -126, -629, -47, 291, 69, -108, -41, 29, 14, -4, -2, 21, 21, -68, -93, 142, 275, -211, -646, 195, 1326, 86, -2627, -1196, 6726, 14298, 13069, 4468, -2192, -2115, 657, 1186, -125, -629, -48, 291, 69, -108, -41, 29, 14, -4,
+ -2, 21, 21, -67, -93, 141, 275, -211, -646, 193, 1326, 89, -2625, -1201, 6717, 14295, 13075, 4477, -2189, -2117, 655, 1186, -124, -629, -48, 291, 69, -108, -42, 29, 14, -4, -2, 21, 21, -67, -93, 141, 275, -210, -647, 192, 1326, 91, -2624, -1206, 6708, 14292, 13081, 4486, -2186, -2120, 653, 1187, -123, -629, -49, 291, 70, -108, -42, 29, 14, -4,
+ -2, 21, 21, -67, -93, 141, 275, -209, -647, 191, 1326, 94, -2622, -1211, 6698, 14287, 13087, 4495, -2183, -2122, 651, 1188, -122, -629, -50, 291, 70, -108, -42, 29, 14, -4, -2, 21, 21, -67, -93, 140, 275, -209, -647, 189, 1325, 96, -2620, -1216, 6689, 14285, 13093, 4504, -2179, -2125, 649, 1189, -120, -630, -50, 291, 70, -108, -42, 29, 14, -4,
+ -2, 21, 21, -67, -93, 140, 275, -208, -647, 188, 1325, 99, -2619, -1220, 6680, 14278, 13099, 4513, -2176, -2127, 647, 1190, -119, -630, -51, 291, 71, -108, -42, 29, 14, -4, -2, 21, 22, -67, -93, 140, 275, -207, -647, 187, 1325, 102, -2617, -1225, 6671, 14272, 13105, 4522, -2173, -2130, 645, 1191, -118, -630, -52, 291, 71, -108, -42, 29, 14, -4,
+ -2, 21, 22, -67, -93, 139, 276, -207, -647, 185, 1324, 104, -2615, -1230, 6661, 14271, 13111, 4531, -2170, -2132, 643, 1191, -117, -630, -52, 291, 71, -108, -42, 29, 14, -4, -2, 21, 22, -67, -94, 139, 276, -206, -647, 184, 1324, 107, -2614, -1235, 6652, 14268, 13117, 4540, -2167, -2134, 641, 1192, -116, -631, -53, 291, 71, -108, -42, 29, 14, -4,
+ -2, 21, 22, -67, -94, 139, 276, -205, -647, 182, 1324, 109, -2612, -1240, 6643, 14262, 13123, 4549, -2163, -2137, 639, 1193, -114, -631, -54, 291, 72, -108, -42, 29, 14, -4, -2, 21, 22, -66, -94, 139, 276, -205, -647, 181, 1324, 112, -2610, -1245, 6634, 14255, 13129, 4558, -2160, -2139, 637, 1194, -113, -631, -54, 291, 72, -108, -42, 29, 14, -4,
+ -2, 20, 22, -66, -94, 138, 276, -204, -647, 180, 1323, 115, -2609, -1250, 6624, 14256, 13135, 4567, -2157, -2142, 635, 1195, -112, -631, -55, 291, 72, -108, -43, 29, 14, -4, -2, 20, 22, -66, -94, 138, 276, -203, -647, 178, 1323, 117, -2607, -1255, 6615, 14251, 13141, 4576, -2154, -2144, 633, 1196, -111, -631, -55, 291, 73, -108, -43, 28, 14, -4,
+ -2, 20, 22, -66, -94, 138, 276, -203, -647, 177, 1323, 120, -2605, -1259, 6606, 14248, 13147, 4585, -2151, -2147, 631, 1196, -110, -632, -56, 291, 73, -108, -43, 28, 14, -4, -2, 20, 22, -66, -94, 137, 277, -202, -648, 175, 1322, 122, -2604, -1264, 6597, 14245, 13153, 4594, -2147, -2149, 629, 1197, -108, -632, -57, 291, 73, -108, -43, 28, 14, -4,
+ -2, 20, 22, -66, -94, 137, 277, -201, -648, 174, 1322, 125, -2602, -1269, 6587, 14240, 13159, 4603, -2144, -2152, 627, 1198, -107, -632, -57, 291, 73, -108, -43, 28, 14, -4, -2, 20, 22, -66, -94, 137, 277, -201, -648, 173, 1322, 127, -2600, -1274, 6578, 14236, 13165, 4612, -2141, -2154, 624, 1199, -106, -632, -58, 291, 74, -108, -43, 28, 14, -4,
+ -2, 20, 22, -66, -94, 137, 277, -200, -648, 171, 1321, 130, -2599, -1279, 6569, 14233, 13171, 4621, -2137, -2156, 622, 1200, -105, -633, -59, 291, 74, -108, -43, 28, 14, -4, -2, 20, 22, -66, -95, 136, 277, -199, -648, 170, 1321, 132, -2597, -1284, 6559, 14232, 13177, 4630, -2134, -2159, 620, 1200, -104, -633, -59, 291, 74, -108, -43, 28, 14, -4,
+ -2, 20, 22, -66, -95, 136, 277, -198, -648, 169, 1321, 135, -2595, -1288, 6550, 14223, 13183, 4639, -2131, -2161, 618, 1201, -102, -633, -60, 291, 75, -108, -43, 28, 14, -4, -2, 20, 22, -65, -95, 136, 277, -198, -648, 167, 1320, 138, -2594, -1293, 6541, 14223, 13188, 4648, -2128, -2164, 616, 1202, -101, -633, -61, 291, 75, -108, -44, 28, 14, -4,
+ -2, 20, 22, -65, -95, 135, 278, -197, -648, 166, 1320, 140, -2592, -1298, 6532, 14216, 13194, 4657, -2124, -2166, 614, 1203, -100, -633, -61, 291, 75, -108, -44, 28, 14, -4, -2, 20, 22, -65, -95, 135, 278, -196, -648, 164, 1320, 143, -2590, -1303, 6522, 14213, 13200, 4666, -2121, -2168, 612, 1204, -99, -634, -62, 291, 75, -108, -44, 28, 14, -4,
+ -2, 20, 22, -65, -95, 135, 278, -196, -648, 163, 1319, 145, -2588, -1308, 6513, 14210, 13206, 4675, -2118, -2171, 610, 1204, -97, -634, -63, 291, 76, -108, -44, 28, 14, -4, -2, 20, 22, -65, -95, 134, 278, -195, -648, 162, 1319, 148, -2587, -1312, 6504, 14202, 13212, 4684, -2114, -2173, 608, 1205, -96, -634, -63, 291, 76, -108, -44, 28, 15, -4,
+ -2, 20, 22, -65, -95, 134, 278, -194, -648, 160, 1319, 150, -2585, -1317, 6495, 14199, 13218, 4693, -2111, -2176, 606, 1206, -95, -634, -64, 291, 76, -108, -44, 28, 15, -4, -2, 20, 22, -65, -95, 134, 278, -194, -648, 159, 1318, 153, -2583, -1322, 6485, 14194, 13224, 4702, -2108, -2178, 604, 1207, -94, -634, -64, 291, 77, -108, -44, 28, 15, -4,
+ -2, 20, 22, -65, -95, 134, 278, -193, -648, 158, 1318, 155, -2581, -1327, 6476, 14190, 13229, 4711, -2104, -2180, 602, 1208, -93, -635, -65, 291, 77, -108, -44, 28, 15, -4, -2, 20, 22, -65, -95, 133, 278, -192, -648, 156, 1318, 158, -2580, -1331, 6467, 14187, 13235, 4720, -2101, -2183, 600, 1208, -91, -635, -66, 291, 77, -108, -44, 28, 15, -4,
+ -2, 20, 22, -64, -96, 133, 279, -192, -649, 155, 1317, 161, -2578, -1336, 6458, 14180, 13241, 4730, -2098, -2185, 597, 1209, -90, -635, -66, 291, 78, -107, -44, 28, 15, -4, -2, 20, 22, -64, -96, 133, 279, -191, -649, 153, 1317, 163, -2576, -1341, 6448, 14178, 13247, 4739, -2094, -2188, 595, 1210, -89, -635, -67, 291, 78, -107, -45, 28, 15, -4,
+ -2, 20, 23, -64, -96, 132, 279, -190, -649, 152, 1317, 166, -2574, -1346, 6439, 14172, 13253, 4748, -2091, -2190, 593, 1211, -88, -635, -68, 291, 78, -107, -45, 28, 15, -4, -2, 20, 23, -64, -96, 132, 279, -190, -649, 151, 1316, 168, -2573, -1350, 6430, 14169, 13258, 4757, -2088, -2192, 591, 1211, -86, -635, -68, 291, 78, -107, -45, 28, 15, -4,
+ -2, 20, 23, -64, -96, 132, 279, -189, -649, 149, 1316, 171, -2571, -1355, 6420, 14164, 13264, 4766, -2084, -2195, 589, 1212, -85, -636, -69, 291, 79, -107, -45, 28, 15, -3, -2, 20, 23, -64, -96, 132, 279, -188, -649, 148, 1315, 173, -2569, -1360, 6411, 14160, 13270, 4775, -2081, -2197, 587, 1213, -84, -636, -70, 291, 79, -107, -45, 28, 15, -3,
+ -2, 20, 23, -64, -96, 131, 279, -188, -649, 147, 1315, 176, -2567, -1364, 6402, 14154, 13276, 4784, -2077, -2200, 585, 1214, -83, -636, -70, 291, 79, -107, -45, 28, 15, -3, -2, 20, 23, -64, -96, 131, 279, -187, -649, 145, 1315, 178, -2566, -1369, 6393, 14151, 13281, 4793, -2074, -2202, 583, 1215, -82, -636, -71, 291, 80, -107, -45, 28, 15, -3,
+ -2, 20, 23, -64, -96, 131, 280, -186, -649, 144, 1314, 181, -2564, -1374, 6383, 14145, 13287, 4802, -2070, -2204, 581, 1215, -80, -636, -72, 291, 80, -107, -45, 28, 15, -3, -2, 20, 23, -64, -96, 130, 280, -186, -649, 143, 1314, 183, -2562, -1378, 6374, 14142, 13293, 4811, -2067, -2207, 579, 1216, -79, -637, -72, 291, 80, -107, -45, 28, 15, -3,
+ -2, 20, 23, -63, -96, 130, 280, -185, -649, 141, 1314, 186, -2560, -1383, 6365, 14138, 13299, 4820, -2064, -2209, 576, 1217, -78, -637, -73, 291, 80, -107, -46, 28, 15, -3, -2, 20, 23, -63, -97, 130, 280, -184, -649, 140, 1313, 188, -2559, -1388, 6356, 14134, 13304, 4829, -2060, -2211, 574, 1218, -77, -637, -73, 291, 81, -107, -46, 28, 15, -3,
+ -2, 20, 23, -63, -97, 129, 280, -183, -649, 138, 1313, 191, -2557, -1392, 6346, 14131, 13310, 4838, -2057, -2214, 572, 1218, -75, -637, -74, 291, 81, -107, -46, 28, 15, -3, -2, 20, 23, -63, -97, 129, 280, -183, -649, 137, 1312, 193, -2555, -1397, 6337, 14127, 13316, 4847, -2053, -2216, 570, 1219, -74, -637, -75, 291, 81, -107, -46, 28, 15, -3,
+ -2, 20, 23, -63, -97, 129, 280, -182, -649, 136, 1312, 196, -2553, -1402, 6328, 14120, 13321, 4857, -2050, -2218, 568, 1220, -73, -638, -75, 291, 82, -107, -46, 28, 15, -3, -2, 20, 23, -63, -97, 129, 280, -181, -649, 134, 1312, 198, -2551, -1406, 6319, 14115, 13327, 4866, -2046, -2221, 566, 1221, -72, -638, -76, 291, 82, -107, -46, 28, 15, -3,
+ -2, 20, 23, -63, -97, 128, 281, -181, -649, 133, 1311, 201, -2550, -1411, 6309, 14113, 13333, 4875, -2043, -2223, 564, 1221, -70, -638, -77, 291, 82, -107, -46, 28, 15, -3, -2, 20, 23, -63, -97, 128, 281, -180, -649, 132, 1311, 203, -2548, -1416, 6300, 14109, 13338, 4884, -2039, -2226, 561, 1222, -69, -638, -77, 291, 82, -107, -46, 28, 15, -3,
+ -2, 19, 23, -63, -97, 128, 281, -179, -649, 130, 1311, 206, -2546, -1420, 6291, 14103, 13344, 4893, -2036, -2228, 559, 1223, -68, -638, -78, 291, 83, -107, -46, 28, 15, -3, -2, 19, 23, -63, -97, 127, 281, -179, -649, 129, 1310, 208, -2544, -1425, 6282, 14101, 13350, 4902, -2032, -2230, 557, 1224, -67, -638, -79, 291, 83, -107, -47, 28, 15, -3,
+ -2, 19, 23, -62, -97, 127, 281, -178, -649, 128, 1310, 211, -2542, -1429, 6272, 14096, 13355, 4911, -2029, -2233, 555, 1224, -65, -639, -79, 291, 83, -107, -47, 28, 15, -3, -2, 19, 23, -62, -97, 127, 281, -177, -649, 126, 1309, 213, -2540, -1434, 6263, 14091, 13361, 4920, -2025, -2235, 553, 1225, -64, -639, -80, 291, 84, -107, -47, 28, 15, -3,
+ -2, 19, 23, -62, -97, 126, 281, -177, -649, 125, 1309, 216, -2539, -1438, 6254, 14087, 13367, 4929, -2022, -2237, 551, 1226, -63, -639, -81, 291, 84, -107, -47, 28, 15, -3, -3, 19, 23, -62, -98, 126, 281, -176, -649, 124, 1309, 218, -2537, -1443, 6244, 14085, 13372, 4938, -2018, -2240, 549, 1227, -62, -639, -81, 291, 84, -107, -47, 28, 15, -3,
+ -3, 19, 23, -62, -98, 126, 282, -175, -649, 122, 1308, 221, -2535, -1448, 6235, 14082, 13378, 4947, -2015, -2242, 546, 1227, -61, -639, -82, 290, 85, -107, -47, 28, 15, -3, -3, 19, 23, -62, -98, 126, 282, -175, -649, 121, 1308, 223, -2533, -1452, 6226, 14074, 13383, 4957, -2011, -2244, 544, 1228, -59, -639, -83, 290, 85, -106, -47, 28, 15, -3,
+ -3, 19, 23, -62, -98, 125, 282, -174, -649, 119, 1307, 226, -2531, -1457, 6217, 14071, 13389, 4966, -2008, -2246, 542, 1229, -58, -640, -83, 290, 85, -106, -47, 28, 15, -3, -3, 19, 24, -62, -98, 125, 282, -173, -650, 118, 1307, 228, -2529, -1461, 6207, 14066, 13395, 4975, -2004, -2249, 540, 1230, -57, -640, -84, 290, 85, -106, -47, 28, 15, -3,
+ -3, 19, 24, -62, -98, 125, 282, -173, -650, 117, 1306, 231, -2527, -1466, 6198, 14063, 13400, 4984, -2001, -2251, 538, 1230, -56, -640, -85, 290, 86, -106, -47, 28, 15, -3, -3, 19, 24, -61, -98, 124, 282, -172, -650, 115, 1306, 233, -2526, -1470, 6189, 14057, 13406, 4993, -1997, -2253, 536, 1231, -54, -640, -85, 290, 86, -106, -48, 28, 15, -3,
+ -3, 19, 24, -61, -98, 124, 282, -171, -650, 114, 1306, 236, -2524, -1475, 6180, 14053, 13411, 5002, -1993, -2256, 533, 1232, -53, -640, -86, 290, 86, -106, -48, 27, 16, -3, -3, 19, 24, -61, -98, 124, 282, -171, -650, 113, 1305, 238, -2522, -1479, 6170, 14049, 13417, 5011, -1990, -2258, 531, 1232, -52, -640, -86, 290, 87, -106, -48, 27, 16, -3,
+ -3, 19, 24, -61, -98, 124, 282, -170, -650, 111, 1305, 241, -2520, -1484, 6161, 14044, 13422, 5020, -1986, -2260, 529, 1233, -51, -640, -87, 290, 87, -106, -48, 27, 16, -3, -3, 19, 24, -61, -98, 123, 282, -169, -650, 110, 1304, 243, -2518, -1488, 6152, 14041, 13428, 5029, -1983, -2263, 527, 1234, -49, -641, -88, 290, 87, -106, -48, 27, 16, -3,
+ -3, 19, 24, -61, -98, 123, 283, -169, -650, 109, 1304, 246, -2516, -1493, 6143, 14032, 13434, 5039, -1979, -2265, 525, 1235, -48, -641, -88, 290, 87, -106, -48, 27, 16, -3, -3, 19, 24, -61, -99, 123, 283, -168, -650, 107, 1303, 248, -2514, -1497, 6133, 14030, 13439, 5048, -1975, -2267, 523, 1235, -47, -641, -89, 290, 88, -106, -48, 27, 16, -3,
+ -3, 19, 24, -61, -99, 122, 283, -167, -650, 106, 1303, 250, -2513, -1502, 6124, 14028, 13445, 5057, -1972, -2270, 520, 1236, -45, -641, -90, 290, 88, -106, -48, 27, 16, -3, -3, 19, 24, -61, -99, 122, 283, -167, -650, 105, 1303, 253, -2511, -1506, 6115, 14021, 13450, 5066, -1968, -2272, 518, 1237, -44, -641, -90, 290, 88, -106, -48, 27, 16, -3,
+ -3, 19, 24, -60, -99, 122, 283, -166, -650, 103, 1302, 255, -2509, -1511, 6106, 14017, 13456, 5075, -1964, -2274, 516, 1237, -43, -641, -91, 290, 89, -106, -49, 27, 16, -3, -3, 19, 24, -60, -99, 121, 283, -165, -650, 102, 1302, 258, -2507, -1515, 6096, 14014, 13461, 5084, -1961, -2276, 514, 1238, -42, -642, -92, 290, 89, -106, -49, 27, 16, -3,
+ -3, 19, 24, -60, -99, 121, 283, -164, -650, 101, 1301, 260, -2505, -1520, 6087, 14008, 13467, 5093, -1957, -2279, 512, 1239, -40, -642, -92, 290, 89, -106, -49, 27, 16, -3, -3, 19, 24, -60, -99, 121, 283, -164, -650, 99, 1301, 263, -2503, -1524, 6078, 14005, 13472, 5102, -1954, -2281, 509, 1239, -39, -642, -93, 290, 90, -106, -49, 27, 16, -3,
+ -3, 19, 24, -60, -99, 121, 283, -163, -650, 98, 1300, 265, -2501, -1529, 6069, 14000, 13477, 5112, -1950, -2283, 507, 1240, -38, -642, -94, 290, 90, -106, -49, 27, 16, -3, -3, 19, 24, -60, -99, 120, 284, -162, -650, 96, 1300, 268, -2499, -1533, 6059, 13993, 13483, 5121, -1946, -2285, 505, 1241, -37, -642, -94, 290, 90, -106, -49, 27, 16, -3,
+ -3, 19, 24, -60, -99, 120, 284, -162, -650, 95, 1299, 270, -2497, -1537, 6050, 13990, 13488, 5130, -1943, -2288, 503, 1242, -35, -642, -95, 290, 90, -106, -49, 27, 16, -3, -3, 19, 24, -60, -99, 120, 284, -161, -650, 94, 1299, 273, -2495, -1542, 6041, 13983, 13494, 5139, -1939, -2290, 501, 1242, -34, -642, -96, 290, 91, -106, -49, 27, 16, -3,
+ -3, 19, 24, -60, -99, 119, 284, -160, -650, 92, 1298, 275, -2493, -1546, 6032, 13981, 13499, 5148, -1935, -2292, 498, 1243, -33, -643, -96, 290, 91, -106, -49, 27, 16, -3, -3, 19, 24, -60, -100, 119, 284, -160, -650, 91, 1298, 277, -2492, -1551, 6022, 13979, 13505, 5157, -1931, -2294, 496, 1244, -32, -643, -97, 290, 91, -105, -50, 27, 16, -3,
+ -3, 19, 24, -59, -100, 119, 284, -159, -650, 90, 1298, 280, -2490, -1555, 6013, 13972, 13510, 5166, -1928, -2297, 494, 1244, -30, -643, -98, 290, 92, -105, -50, 27, 16, -3, -3, 19, 24, -59, -100, 118, 284, -158, -650, 88, 1297, 282, -2488, -1559, 6004, 13967, 13515, 5176, -1924, -2299, 492, 1245, -29, -643, -98, 290, 92, -105, -50, 27, 16, -3,
+ -3, 19, 24, -59, -100, 118, 284, -158, -650, 87, 1297, 285, -2486, -1564, 5995, 13961, 13521, 5185, -1920, -2301, 490, 1246, -28, -643, -99, 290, 92, -105, -50, 27, 16, -3, -3, 19, 24, -59, -100, 118, 284, -157, -650, 86, 1296, 287, -2484, -1568, 5985, 13960, 13526, 5194, -1917, -2303, 487, 1246, -27, -643, -100, 290, 92, -105, -50, 27, 16, -3,
+ -3, 19, 24, -59, -100, 118, 284, -156, -649, 84, 1296, 290, -2482, -1572, 5976, 13950, 13532, 5203, -1913, -2306, 485, 1247, -25, -643, -100, 290, 93, -105, -50, 27, 16, -3, -3, 19, 24, -59, -100, 117, 284, -156, -649, 83, 1295, 292, -2480, -1577, 5967, 13948, 13537, 5212, -1909, -2308, 483, 1248, -24, -643, -101, 290, 93, -105, -50, 27, 16, -3,
+ -3, 18, 24, -59, -100, 117, 285, -155, -649, 82, 1295, 294, -2478, -1581, 5958, 13944, 13542, 5221, -1905, -2310, 481, 1248, -23, -644, -102, 290, 93, -105, -50, 27, 16, -3, -3, 18, 25, -59, -100, 117, 285, -154, -649, 80, 1294, 297, -2476, -1585, 5948, 13937, 13548, 5230, -1902, -2312, 478, 1249, -21, -644, -102, 290, 94, -105, -50, 27, 16, -3,
+ -3, 18, 25, -59, -100, 116, 285, -154, -649, 79, 1294, 299, -2474, -1590, 5939, 13934, 13553, 5240, -1898, -2315, 476, 1250, -20, -644, -103, 290, 94, -105, -50, 27, 16, -3, -3, 18, 25, -58, -100, 116, 285, -153, -649, 78, 1293, 302, -2472, -1594, 5930, 13929, 13558, 5249, -1894, -2317, 474, 1250, -19, -644, -104, 290, 94, -105, -51, 27, 16, -3,
+ -3, 18, 25, -58, -100, 116, 285, -152, -649, 76, 1293, 304, -2470, -1598, 5921, 13921, 13564, 5258, -1890, -2319, 472, 1251, -18, -644, -104, 290, 95, -105, -51, 27, 16, -3, -3, 18, 25, -58, -100, 116, 285, -152, -649, 75, 1292, 306, -2468, -1603, 5911, 13920, 13569, 5267, -1886, -2321, 469, 1252, -16, -644, -105, 289, 95, -105, -51, 27, 16, -3,
+ -3, 18, 25, -58, -100, 115, 285, -151, -649, 74, 1292, 309, -2466, -1607, 5902, 13916, 13574, 5276, -1883, -2323, 467, 1252, -15, -644, -106, 289, 95, -105, -51, 27, 16, -3, -3, 18, 25, -58, -101, 115, 285, -150, -649, 72, 1291, 311, -2464, -1611, 5893, 13912, 13580, 5285, -1879, -2326, 465, 1253, -14, -644, -106, 289, 95, -105, -51, 27, 16, -3,
+ -3, 18, 25, -58, -101, 115, 285, -150, -649, 71, 1291, 314, -2462, -1616, 5884, 13906, 13585, 5295, -1875, -2328, 463, 1254, -13, -645, -107, 289, 96, -105, -51, 27, 16, -3, -3, 18, 25, -58, -101, 114, 285, -149, -649, 70, 1290, 316, -2460, -1620, 5874, 13904, 13590, 5304, -1871, -2330, 460, 1254, -11, -645, -108, 289, 96, -105, -51, 27, 16, -3,
+ -3, 18, 25, -58, -101, 114, 285, -148, -649, 68, 1290, 318, -2458, -1624, 5865, 13898, 13595, 5313, -1867, -2332, 458, 1255, -10, -645, -108, 289, 96, -105, -51, 27, 16, -3, -3, 18, 25, -58, -101, 114, 286, -148, -649, 67, 1289, 321, -2456, -1628, 5856, 13890, 13601, 5322, -1863, -2335, 456, 1256, -9, -645, -109, 289, 97, -105, -51, 27, 17, -3,
+ -3, 18, 25, -58, -101, 113, 286, -147, -649, 66, 1289, 323, -2454, -1633, 5847, 13886, 13606, 5331, -1860, -2337, 454, 1256, -7, -645, -109, 289, 97, -104, -52, 27, 17, -3, -3, 18, 25, -57, -101, 113, 286, -146, -649, 64, 1288, 326, -2452, -1637, 5838, 13881, 13611, 5340, -1856, -2339, 451, 1257, -6, -645, -110, 289, 97, -104, -52, 27, 17, -3,
+ -3, 18, 25, -57, -101, 113, 286, -146, -649, 63, 1288, 328, -2450, -1641, 5828, 13877, 13616, 5350, -1852, -2341, 449, 1257, -5, -645, -111, 289, 97, -104, -52, 27, 17, -3, -3, 18, 25, -57, -101, 113, 286, -145, -649, 62, 1287, 330, -2448, -1645, 5819, 13870, 13622, 5359, -1848, -2343, 447, 1258, -4, -645, -111, 289, 98, -104, -52, 26, 17, -3,
+ -3, 18, 25, -57, -101, 112, 286, -144, -649, 60, 1287, 333, -2446, -1650, 5810, 13865, 13627, 5368, -1844, -2345, 445, 1259, -2, -645, -112, 289, 98, -104, -52, 26, 17, -3, -3, 18, 25, -57, -101, 112, 286, -144, -649, 59, 1286, 335, -2444, -1654, 5801, 13865, 13632, 5377, -1840, -2348, 442, 1259, -1, -646, -113, 289, 98, -104, -52, 26, 17, -3,
+ -3, 18, 25, -57, -101, 112, 286, -143, -649, 58, 1286, 338, -2442, -1658, 5791, 13857, 13637, 5386, -1836, -2350, 440, 1260, 0, -646, -113, 289, 99, -104, -52, 26, 17, -3, -3, 18, 25, -57, -101, 111, 286, -142, -649, 56, 1285, 340, -2440, -1662, 5782, 13852, 13643, 5396, -1833, -2352, 438, 1261, 2, -646, -114, 289, 99, -104, -52, 26, 17, -3,
+ -3, 18, 25, -57, -101, 111, 286, -142, -649, 55, 1284, 342, -2438, -1667, 5773, 13851, 13648, 5405, -1829, -2354, 435, 1261, 3, -646, -115, 289, 99, -104, -52, 26, 17, -3, -3, 18, 25, -57, -102, 111, 286, -141, -649, 54, 1284, 345, -2436, -1671, 5764, 13844, 13653, 5414, -1825, -2356, 433, 1262, 4, -646, -115, 289, 100, -104, -53, 26, 17, -3,
+ -3, 18, 25, -56, -102, 110, 286, -140, -649, 53, 1283, 347, -2434, -1675, 5754, 13840, 13658, 5423, -1821, -2358, 431, 1263, 5, -646, -116, 289, 100, -104, -53, 26, 17, -3, -3, 18, 25, -56, -102, 110, 286, -140, -649, 51, 1283, 349, -2432, -1679, 5745, 13837, 13663, 5432, -1817, -2361, 429, 1263, 7, -646, -117, 289, 100, -104, -53, 26, 17, -3,
+ -3, 18, 25, -56, -102, 110, 287, -139, -649, 50, 1282, 352, -2430, -1683, 5736, 13830, 13668, 5441, -1813, -2363, 426, 1264, 8, -646, -117, 289, 100, -104, -53, 26, 17, -3, -3, 18, 25, -56, -102, 110, 287, -138, -649, 49, 1282, 354, -2428, -1687, 5727, 13822, 13674, 5451, -1809, -2365, 424, 1264, 9, -646, -118, 289, 101, -104, -53, 26, 17, -3,
+ -3, 18, 25, -56, -102, 109, 287, -138, -648, 47, 1281, 357, -2426, -1692, 5718, 13819, 13679, 5460, -1805, -2367, 422, 1265, 11, -646, -119, 288, 101, -104, -53, 26, 17, -3, -3, 18, 25, -56, -102, 109, 287, -137, -648, 46, 1281, 359, -2424, -1696, 5708, 13815, 13684, 5469, -1801, -2369, 419, 1266, 12, -647, -119, 288, 101, -104, -53, 26, 17, -3,
+ -3, 18, 25, -56, -102, 109, 287, -136, -648, 45, 1280, 361, -2422, -1700, 5699, 13810, 13689, 5478, -1797, -2371, 417, 1266, 13, -647, -120, 288, 102, -104, -53, 26, 17, -3, -3, 18, 25, -56, -102, 108, 287, -135, -648, 43, 1280, 364, -2420, -1704, 5690, 13803, 13694, 5487, -1793, -2373, 415, 1267, 15, -647, -121, 288, 102, -103, -53, 26, 17, -3,
+ -3, 18, 25, -56, -102, 108, 287, -135, -648, 42, 1279, 366, -2418, -1708, 5681, 13799, 13699, 5497, -1789, -2376, 413, 1267, 16, -647, -121, 288, 102, -103, -53, 26, 17, -3, -3, 18, 25, -56, -102, 108, 287, -134, -648, 41, 1278, 368, -2416, -1712, 5671, 13796, 13704, 5506, -1785, -2378, 410, 1268, 17, -647, -122, 288, 103, -103, -54, 26, 17, -3,
+ -3, 18, 26, -55, -102, 108, 287, -133, -648, 39, 1278, 371, -2413, -1716, 5662, 13787, 13709, 5515, -1781, -2380, 408, 1269, 18, -647, -123, 288, 103, -103, -54, 26, 17, -3, -3, 18, 26, -55, -102, 107, 287, -133, -648, 38, 1277, 373, -2411, -1720, 5653, 13783, 13714, 5524, -1777, -2382, 406, 1269, 20, -647, -123, 288, 103, -103, -54, 26, 17, -3,
+ -3, 18, 26, -55, -102, 107, 287, -132, -648, 37, 1277, 375, -2409, -1725, 5644, 13778, 13720, 5533, -1773, -2384, 403, 1270, 21, -647, -124, 288, 103, -103, -54, 26, 17, -3, -3, 17, 26, -55, -102, 107, 287, -131, -648, 35, 1276, 378, -2407, -1729, 5635, 13773, 13725, 5543, -1769, -2386, 401, 1270, 22, -647, -125, 288, 104, -103, -54, 26, 17, -3,
+ -3, 17, 26, -55, -103, 106, 287, -131, -648, 34, 1276, 380, -2405, -1733, 5625, 13769, 13730, 5552, -1765, -2388, 399, 1271, 24, -647, -125, 288, 104, -103, -54, 26, 17, -3, -3, 17, 26, -55, -103, 106, 287, -130, -648, 33, 1275, 382, -2403, -1737, 5616, 13765, 13735, 5561, -1761, -2390, 396, 1272, 25, -647, -126, 288, 104, -103, -54, 26, 17, -3,
+ -3, 17, 26, -55, -103, 106, 288, -129, -648, 32, 1274, 385, -2401, -1741, 5607, 13759, 13740, 5570, -1757, -2393, 394, 1272, 26, -647, -127, 288, 105, -103, -54, 26, 17, -3, -3, 17, 26, -55, -103, 105, 288, -129, -648, 30, 1274, 387, -2399, -1745, 5598, 13754, 13745, 5579, -1753, -2395, 392, 1273, 28, -647, -127, 288, 105, -103, -54, 26, 17, -3,
+ -3, 17, 26, -55, -103, 105, 288, -128, -648, 29, 1273, 389, -2397, -1749, 5589, 13752, 13750, 5589, -1749, -2397, 389, 1273, 29, -648, -128, 288, 105, -103, -55, 26, 17, -3, -3, 17, 26, -54, -103, 105, 288, -127, -647, 28, 1273, 392, -2395, -1753, 5579, 13745, 13754, 5598, -1745, -2399, 387, 1274, 30, -648, -129, 288, 105, -103, -55, 26, 17, -3,
+ -3, 17, 26, -54, -103, 105, 288, -127, -647, 26, 1272, 394, -2393, -1757, 5570, 13740, 13759, 5607, -1741, -2401, 385, 1274, 32, -648, -129, 288, 106, -103, -55, 26, 17, -3, -3, 17, 26, -54, -103, 104, 288, -126, -647, 25, 1272, 396, -2390, -1761, 5561, 13735, 13765, 5616, -1737, -2403, 382, 1275, 33, -648, -130, 287, 106, -103, -55, 26, 17, -3,
+ -3, 17, 26, -54, -103, 104, 288, -125, -647, 24, 1271, 399, -2388, -1765, 5552, 13730, 13769, 5625, -1733, -2405, 380, 1276, 34, -648, -131, 287, 106, -103, -55, 26, 17, -3, -3, 17, 26, -54, -103, 104, 288, -125, -647, 22, 1270, 401, -2386, -1769, 5543, 13725, 13773, 5635, -1729, -2407, 378, 1276, 35, -648, -131, 287, 107, -102, -55, 26, 17, -3,
+ -3, 17, 26, -54, -103, 103, 288, -124, -647, 21, 1270, 403, -2384, -1773, 5533, 13720, 13778, 5644, -1725, -2409, 375, 1277, 37, -648, -132, 287, 107, -102, -55, 26, 18, -3, -3, 17, 26, -54, -103, 103, 288, -123, -647, 20, 1269, 406, -2382, -1777, 5524, 13714, 13783, 5653, -1720, -2411, 373, 1277, 38, -648, -133, 287, 107, -102, -55, 26, 18, -3,
+ -3, 17, 26, -54, -103, 103, 288, -123, -647, 18, 1269, 408, -2380, -1781, 5515, 13709, 13787, 5662, -1716, -2413, 371, 1278, 39, -648, -133, 287, 108, -102, -55, 26, 18, -3, -3, 17, 26, -54, -103, 103, 288, -122, -647, 17, 1268, 410, -2378, -1785, 5506, 13704, 13796, 5671, -1712, -2416, 368, 1278, 41, -648, -134, 287, 108, -102, -56, 25, 18, -3,
+ -3, 17, 26, -53, -103, 102, 288, -121, -647, 16, 1267, 413, -2376, -1789, 5497, 13699, 13799, 5681, -1708, -2418, 366, 1279, 42, -648, -135, 287, 108, -102, -56, 25, 18, -3, -3, 17, 26, -53, -103, 102, 288, -121, -647, 15, 1267, 415, -2373, -1793, 5487, 13694, 13803, 5690, -1704, -2420, 364, 1280, 43, -648, -135, 287, 108, -102, -56, 25, 18, -3,
+ -3, 17, 26, -53, -104, 102, 288, -120, -647, 13, 1266, 417, -2371, -1797, 5478, 13689, 13810, 5699, -1700, -2422, 361, 1280, 45, -648, -136, 287, 109, -102, -56, 25, 18, -3, -3, 17, 26, -53, -104, 101, 288, -119, -647, 12, 1266, 419, -2369, -1801, 5469, 13684, 13815, 5708, -1696, -2424, 359, 1281, 46, -648, -137, 287, 109, -102, -56, 25, 18, -3,
+ -3, 17, 26, -53, -104, 101, 288, -119, -646, 11, 1265, 422, -2367, -1805, 5460, 13679, 13819, 5718, -1692, -2426, 357, 1281, 47, -648, -138, 287, 109, -102, -56, 25, 18, -3, -3, 17, 26, -53, -104, 101, 289, -118, -646, 9, 1264, 424, -2365, -1809, 5451, 13674, 13822, 5727, -1687, -2428, 354, 1282, 49, -649, -138, 287, 110, -102, -56, 25, 18, -3,
+ -3, 17, 26, -53, -104, 100, 289, -117, -646, 8, 1264, 426, -2363, -1813, 5441, 13668, 13830, 5736, -1683, -2430, 352, 1282, 50, -649, -139, 287, 110, -102, -56, 25, 18, -3, -3, 17, 26, -53, -104, 100, 289, -117, -646, 7, 1263, 429, -2361, -1817, 5432, 13663, 13837, 5745, -1679, -2432, 349, 1283, 51, -649, -140, 286, 110, -102, -56, 25, 18, -3,
+ -3, 17, 26, -53, -104, 100, 289, -116, -646, 5, 1263, 431, -2358, -1821, 5423, 13658, 13840, 5754, -1675, -2434, 347, 1283, 53, -649, -140, 286, 110, -102, -56, 25, 18, -3, -3, 17, 26, -53, -104, 100, 289, -115, -646, 4, 1262, 433, -2356, -1825, 5414, 13653, 13844, 5764, -1671, -2436, 345, 1284, 54, -649, -141, 286, 111, -102, -57, 25, 18, -3,
+ -3, 17, 26, -52, -104, 99, 289, -115, -646, 3, 1261, 435, -2354, -1829, 5405, 13648, 13851, 5773, -1667, -2438, 342, 1284, 55, -649, -142, 286, 111, -101, -57, 25, 18, -3, -3, 17, 26, -52, -104, 99, 289, -114, -646, 2, 1261, 438, -2352, -1833, 5396, 13643, 13852, 5782, -1662, -2440, 340, 1285, 56, -649, -142, 286, 111, -101, -57, 25, 18, -3,
+ -3, 17, 26, -52, -104, 99, 289, -113, -646, 0, 1260, 440, -2350, -1836, 5386, 13637, 13857, 5791, -1658, -2442, 338, 1286, 58, -649, -143, 286, 112, -101, -57, 25, 18, -3, -3, 17, 26, -52, -104, 98, 289, -113, -646, -1, 1259, 442, -2348, -1840, 5377, 13632, 13865, 5801, -1654, -2444, 335, 1286, 59, -649, -144, 286, 112, -101, -57, 25, 18, -3,
+ -3, 17, 26, -52, -104, 98, 289, -112, -645, -2, 1259, 445, -2345, -1844, 5368, 13627, 13865, 5810, -1650, -2446, 333, 1287, 60, -649, -144, 286, 112, -101, -57, 25, 18, -3, -3, 17, 26, -52, -104, 98, 289, -111, -645, -4, 1258, 447, -2343, -1848, 5359, 13622, 13870, 5819, -1645, -2448, 330, 1287, 62, -649, -145, 286, 113, -101, -57, 25, 18, -3,
+ -3, 17, 27, -52, -104, 97, 289, -111, -645, -5, 1257, 449, -2341, -1852, 5350, 13616, 13877, 5828, -1641, -2450, 328, 1288, 63, -649, -146, 286, 113, -101, -57, 25, 18, -3, -3, 17, 27, -52, -104, 97, 289, -110, -645, -6, 1257, 451, -2339, -1856, 5340, 13611, 13881, 5838, -1637, -2452, 326, 1288, 64, -649, -146, 286, 113, -101, -57, 25, 18, -3,
+ -3, 17, 27, -52, -104, 97, 289, -109, -645, -7, 1256, 454, -2337, -1860, 5331, 13606, 13886, 5847, -1633, -2454, 323, 1289, 66, -649, -147, 286, 113, -101, -58, 25, 18, -3, -3, 17, 27, -51, -105, 97, 289, -109, -645, -9, 1256, 456, -2335, -1863, 5322, 13601, 13890, 5856, -1628, -2456, 321, 1289, 67, -649, -148, 286, 114, -101, -58, 25, 18, -3,
+ -3, 16, 27, -51, -105, 96, 289, -108, -645, -10, 1255, 458, -2332, -1867, 5313, 13595, 13898, 5865, -1624, -2458, 318, 1290, 68, -649, -148, 285, 114, -101, -58, 25, 18, -3, -3, 16, 27, -51, -105, 96, 289, -108, -645, -11, 1254, 460, -2330, -1871, 5304, 13590, 13904, 5874, -1620, -2460, 316, 1290, 70, -649, -149, 285, 114, -101, -58, 25, 18, -3,
+ -3, 16, 27, -51, -105, 96, 289, -107, -645, -13, 1254, 463, -2328, -1875, 5295, 13585, 13906, 5884, -1616, -2462, 314, 1291, 71, -649, -150, 285, 115, -101, -58, 25, 18, -3, -3, 16, 27, -51, -105, 95, 289, -106, -644, -14, 1253, 465, -2326, -1879, 5285, 13580, 13912, 5893, -1611, -2464, 311, 1291, 72, -649, -150, 285, 115, -101, -58, 25, 18, -3,
+ -3, 16, 27, -51, -105, 95, 289, -106, -644, -15, 1252, 467, -2323, -1883, 5276, 13574, 13916, 5902, -1607, -2466, 309, 1292, 74, -649, -151, 285, 115, -100, -58, 25, 18, -3, -3, 16, 27, -51, -105, 95, 289, -105, -644, -16, 1252, 469, -2321, -1886, 5267, 13569, 13920, 5911, -1603, -2468, 306, 1292, 75, -649, -152, 285, 116, -100, -58, 25, 18, -3,
+ -3, 16, 27, -51, -105, 95, 290, -104, -644, -18, 1251, 472, -2319, -1890, 5258, 13564, 13921, 5921, -1598, -2470, 304, 1293, 76, -649, -152, 285, 116, -100, -58, 25, 18, -3, -3, 16, 27, -51, -105, 94, 290, -104, -644, -19, 1250, 474, -2317, -1894, 5249, 13558, 13929, 5930, -1594, -2472, 302, 1293, 78, -649, -153, 285, 116, -100, -58, 25, 18, -3,
+ -3, 16, 27, -50, -105, 94, 290, -103, -644, -20, 1250, 476, -2315, -1898, 5240, 13553, 13934, 5939, -1590, -2474, 299, 1294, 79, -649, -154, 285, 116, -100, -59, 25, 18, -3, -3, 16, 27, -50, -105, 94, 290, -102, -644, -21, 1249, 478, -2312, -1902, 5230, 13548, 13937, 5948, -1585, -2476, 297, 1294, 80, -649, -154, 285, 117, -100, -59, 25, 18, -3,
+ -3, 16, 27, -50, -105, 93, 290, -102, -644, -23, 1248, 481, -2310, -1905, 5221, 13542, 13944, 5958, -1581, -2478, 294, 1295, 82, -649, -155, 285, 117, -100, -59, 24, 18, -3, -3, 16, 27, -50, -105, 93, 290, -101, -643, -24, 1248, 483, -2308, -1909, 5212, 13537, 13948, 5967, -1577, -2480, 292, 1295, 83, -649, -156, 284, 117, -100, -59, 24, 19, -3,
+ -3, 16, 27, -50, -105, 93, 290, -100, -643, -25, 1247, 485, -2306, -1913, 5203, 13532, 13950, 5976, -1572, -2482, 290, 1296, 84, -649, -156, 284, 118, -100, -59, 24, 19, -3, -3, 16, 27, -50, -105, 92, 290, -100, -643, -27, 1246, 487, -2303, -1917, 5194, 13526, 13960, 5985, -1568, -2484, 287, 1296, 86, -650, -157, 284, 118, -100, -59, 24, 19, -3,
+ -3, 16, 27, -50, -105, 92, 290, -99, -643, -28, 1246, 490, -2301, -1920, 5185, 13521, 13961, 5995, -1564, -2486, 285, 1297, 87, -650, -158, 284, 118, -100, -59, 24, 19, -3, -3, 16, 27, -50, -105, 92, 290, -98, -643, -29, 1245, 492, -2299, -1924, 5176, 13515, 13967, 6004, -1559, -2488, 282, 1297, 88, -650, -158, 284, 118, -100, -59, 24, 19, -3,
+ -3, 16, 27, -50, -105, 92, 290, -98, -643, -30, 1244, 494, -2297, -1928, 5166, 13510, 13972, 6013, -1555, -2490, 280, 1298, 90, -650, -159, 284, 119, -100, -59, 24, 19, -3, -3, 16, 27, -50, -105, 91, 290, -97, -643, -32, 1244, 496, -2294, -1931, 5157, 13505, 13979, 6022, -1551, -2492, 277, 1298, 91, -650, -160, 284, 119, -100, -60, 24, 19, -3,
+ -3, 16, 27, -49, -106, 91, 290, -96, -643, -33, 1243, 498, -2292, -1935, 5148, 13499, 13981, 6032, -1546, -2493, 275, 1298, 92, -650, -160, 284, 119, -99, -60, 24, 19, -3, -3, 16, 27, -49, -106, 91, 290, -96, -642, -34, 1242, 501, -2290, -1939, 5139, 13494, 13983, 6041, -1542, -2495, 273, 1299, 94, -650, -161, 284, 120, -99, -60, 24, 19, -3,
+ -3, 16, 27, -49, -106, 90, 290, -95, -642, -35, 1242, 503, -2288, -1943, 5130, 13488, 13990, 6050, -1537, -2497, 270, 1299, 95, -650, -162, 284, 120, -99, -60, 24, 19, -3, -3, 16, 27, -49, -106, 90, 290, -94, -642, -37, 1241, 505, -2285, -1946, 5121, 13483, 13993, 6059, -1533, -2499, 268, 1300, 96, -650, -162, 284, 120, -99, -60, 24, 19, -3,
+ -3, 16, 27, -49, -106, 90, 290, -94, -642, -38, 1240, 507, -2283, -1950, 5112, 13477, 14000, 6069, -1529, -2501, 265, 1300, 98, -650, -163, 283, 121, -99, -60, 24, 19, -3, -3, 16, 27, -49, -106, 90, 290, -93, -642, -39, 1239, 509, -2281, -1954, 5102, 13472, 14005, 6078, -1524, -2503, 263, 1301, 99, -650, -164, 283, 121, -99, -60, 24, 19, -3,
+ -3, 16, 27, -49, -106, 89, 290, -92, -642, -40, 1239, 512, -2279, -1957, 5093, 13467, 14008, 6087, -1520, -2505, 260, 1301, 101, -650, -164, 283, 121, -99, -60, 24, 19, -3, -3, 16, 27, -49, -106, 89, 290, -92, -642, -42, 1238, 514, -2276, -1961, 5084, 13461, 14014, 6096, -1515, -2507, 258, 1302, 102, -650, -165, 283, 121, -99, -60, 24, 19, -3,
+ -3, 16, 27, -49, -106, 89, 290, -91, -641, -43, 1237, 516, -2274, -1964, 5075, 13456, 14017, 6106, -1511, -2509, 255, 1302, 103, -650, -166, 283, 122, -99, -60, 24, 19, -3, -3, 16, 27, -48, -106, 88, 290, -90, -641, -44, 1237, 518, -2272, -1968, 5066, 13450, 14021, 6115, -1506, -2511, 253, 1303, 105, -650, -167, 283, 122, -99, -61, 24, 19, -3,
+ -3, 16, 27, -48, -106, 88, 290, -90, -641, -45, 1236, 520, -2270, -1972, 5057, 13445, 14028, 6124, -1502, -2513, 250, 1303, 106, -650, -167, 283, 122, -99, -61, 24, 19, -3, -3, 16, 27, -48, -106, 88, 290, -89, -641, -47, 1235, 523, -2267, -1975, 5048, 13439, 14030, 6133, -1497, -2514, 248, 1303, 107, -650, -168, 283, 123, -99, -61, 24, 19, -3,
+ -3, 16, 27, -48, -106, 87, 290, -88, -641, -48, 1235, 525, -2265, -1979, 5039, 13434, 14032, 6143, -1493, -2516, 246, 1304, 109, -650, -169, 283, 123, -98, -61, 24, 19, -3, -3, 16, 27, -48, -106, 87, 290, -88, -641, -49, 1234, 527, -2263, -1983, 5029, 13428, 14041, 6152, -1488, -2518, 243, 1304, 110, -650, -169, 282, 123, -98, -61, 24, 19, -3,
+ -3, 16, 27, -48, -106, 87, 290, -87, -640, -51, 1233, 529, -2260, -1986, 5020, 13422, 14044, 6161, -1484, -2520, 241, 1305, 111, -650, -170, 282, 124, -98, -61, 24, 19, -3, -3, 16, 27, -48, -106, 87, 290, -86, -640, -52, 1232, 531, -2258, -1990, 5011, 13417, 14049, 6170, -1479, -2522, 238, 1305, 113, -650, -171, 282, 124, -98, -61, 24, 19, -3,
+ -3, 16, 27, -48, -106, 86, 290, -86, -640, -53, 1232, 533, -2256, -1993, 5002, 13411, 14053, 6180, -1475, -2524, 236, 1306, 114, -650, -171, 282, 124, -98, -61, 24, 19, -3, -3, 15, 28, -48, -106, 86, 290, -85, -640, -54, 1231, 536, -2253, -1997, 4993, 13406, 14057, 6189, -1470, -2526, 233, 1306, 115, -650, -172, 282, 124, -98, -61, 24, 19, -3,
+ -3, 15, 28, -47, -106, 86, 290, -85, -640, -56, 1230, 538, -2251, -2001, 4984, 13400, 14063, 6198, -1466, -2527, 231, 1306, 117, -650, -173, 282, 125, -98, -62, 24, 19, -3, -3, 15, 28, -47, -106, 85, 290, -84, -640, -57, 1230, 540, -2249, -2004, 4975, 13395, 14066, 6207, -1461, -2529, 228, 1307, 118, -650, -173, 282, 125, -98, -62, 24, 19, -3,
+ -3, 15, 28, -47, -106, 85, 290, -83, -640, -58, 1229, 542, -2246, -2008, 4966, 13389, 14071, 6217, -1457, -2531, 226, 1307, 119, -649, -174, 282, 125, -98, -62, 23, 19, -3, -3, 15, 28, -47, -106, 85, 290, -83, -639, -59, 1228, 544, -2244, -2011, 4957, 13383, 14074, 6226, -1452, -2533, 223, 1308, 121, -649, -175, 282, 126, -98, -62, 23, 19, -3,
+ -3, 15, 28, -47, -107, 85, 290, -82, -639, -61, 1227, 546, -2242, -2015, 4947, 13378, 14082, 6235, -1448, -2535, 221, 1308, 122, -649, -175, 282, 126, -98, -62, 23, 19, -3, -3, 15, 28, -47, -107, 84, 291, -81, -639, -62, 1227, 549, -2240, -2018, 4938, 13372, 14085, 6244, -1443, -2537, 218, 1309, 124, -649, -176, 281, 126, -98, -62, 23, 19, -3,
+ -3, 15, 28, -47, -107, 84, 291, -81, -639, -63, 1226, 551, -2237, -2022, 4929, 13367, 14087, 6254, -1438, -2539, 216, 1309, 125, -649, -177, 281, 126, -97, -62, 23, 19, -2, -3, 15, 28, -47, -107, 84, 291, -80, -639, -64, 1225, 553, -2235, -2025, 4920, 13361, 14091, 6263, -1434, -2540, 213, 1309, 126, -649, -177, 281, 127, -97, -62, 23, 19, -2,
+ -3, 15, 28, -47, -107, 83, 291, -79, -639, -65, 1224, 555, -2233, -2029, 4911, 13355, 14096, 6272, -1429, -2542, 211, 1310, 128, -649, -178, 281, 127, -97, -62, 23, 19, -2, -3, 15, 28, -47, -107, 83, 291, -79, -638, -67, 1224, 557, -2230, -2032, 4902, 13350, 14101, 6282, -1425, -2544, 208, 1310, 129, -649, -179, 281, 127, -97, -63, 23, 19, -2,
+ -3, 15, 28, -46, -107, 83, 291, -78, -638, -68, 1223, 559, -2228, -2036, 4893, 13344, 14103, 6291, -1420, -2546, 206, 1311, 130, -649, -179, 281, 128, -97, -63, 23, 19, -2, -3, 15, 28, -46, -107, 82, 291, -77, -638, -69, 1222, 561, -2226, -2039, 4884, 13338, 14109, 6300, -1416, -2548, 203, 1311, 132, -649, -180, 281, 128, -97, -63, 23, 20, -2,
+ -3, 15, 28, -46, -107, 82, 291, -77, -638, -70, 1221, 564, -2223, -2043, 4875, 13333, 14113, 6309, -1411, -2550, 201, 1311, 133, -649, -181, 281, 128, -97, -63, 23, 20, -2, -3, 15, 28, -46, -107, 82, 291, -76, -638, -72, 1221, 566, -2221, -2046, 4866, 13327, 14115, 6319, -1406, -2551, 198, 1312, 134, -649, -181, 280, 129, -97, -63, 23, 20, -2,
+ -3, 15, 28, -46, -107, 82, 291, -75, -638, -73, 1220, 568, -2218, -2050, 4857, 13321, 14120, 6328, -1402, -2553, 196, 1312, 136, -649, -182, 280, 129, -97, -63, 23, 20, -2, -3, 15, 28, -46, -107, 81, 291, -75, -637, -74, 1219, 570, -2216, -2053, 4847, 13316, 14127, 6337, -1397, -2555, 193, 1312, 137, -649, -183, 280, 129, -97, -63, 23, 20, -2,
+ -3, 15, 28, -46, -107, 81, 291, -74, -637, -75, 1218, 572, -2214, -2057, 4838, 13310, 14131, 6346, -1392, -2557, 191, 1313, 138, -649, -183, 280, 129, -97, -63, 23, 20, -2, -3, 15, 28, -46, -107, 81, 291, -73, -637, -77, 1218, 574, -2211, -2060, 4829, 13304, 14134, 6356, -1388, -2559, 188, 1313, 140, -649, -184, 280, 130, -97, -63, 23, 20, -2,
+ -3, 15, 28, -46, -107, 80, 291, -73, -637, -78, 1217, 576, -2209, -2064, 4820, 13299, 14138, 6365, -1383, -2560, 186, 1314, 141, -649, -185, 280, 130, -96, -63, 23, 20, -2, -3, 15, 28, -45, -107, 80, 291, -72, -637, -79, 1216, 579, -2207, -2067, 4811, 13293, 14142, 6374, -1378, -2562, 183, 1314, 143, -649, -186, 280, 130, -96, -64, 23, 20, -2,
+ -3, 15, 28, -45, -107, 80, 291, -72, -636, -80, 1215, 581, -2204, -2070, 4802, 13287, 14145, 6383, -1374, -2564, 181, 1314, 144, -649, -186, 280, 131, -96, -64, 23, 20, -2, -3, 15, 28, -45, -107, 80, 291, -71, -636, -82, 1215, 583, -2202, -2074, 4793, 13281, 14151, 6393, -1369, -2566, 178, 1315, 145, -649, -187, 279, 131, -96, -64, 23, 20, -2,
+ -3, 15, 28, -45, -107, 79, 291, -70, -636, -83, 1214, 585, -2200, -2077, 4784, 13276, 14154, 6402, -1364, -2567, 176, 1315, 147, -649, -188, 279, 131, -96, -64, 23, 20, -2, -3, 15, 28, -45, -107, 79, 291, -70, -636, -84, 1213, 587, -2197, -2081, 4775, 13270, 14160, 6411, -1360, -2569, 173, 1315, 148, -649, -188, 279, 132, -96, -64, 23, 20, -2,
+ -3, 15, 28, -45, -107, 79, 291, -69, -636, -85, 1212, 589, -2195, -2084, 4766, 13264, 14164, 6420, -1355, -2571, 171, 1316, 149, -649, -189, 279, 132, -96, -64, 23, 20, -2, -4, 15, 28, -45, -107, 78, 291, -68, -635, -86, 1211, 591, -2192, -2088, 4757, 13258, 14169, 6430, -1350, -2573, 168, 1316, 151, -649, -190, 279, 132, -96, -64, 23, 20, -2,
+ -4, 15, 28, -45, -107, 78, 291, -68, -635, -88, 1211, 593, -2190, -2091, 4748, 13253, 14172, 6439, -1346, -2574, 166, 1317, 152, -649, -190, 279, 132, -96, -64, 23, 20, -2, -4, 15, 28, -45, -107, 78, 291, -67, -635, -89, 1210, 595, -2188, -2094, 4739, 13247, 14178, 6448, -1341, -2576, 163, 1317, 153, -649, -191, 279, 133, -96, -64, 22, 20, -2,
+ -4, 15, 28, -44, -107, 78, 291, -66, -635, -90, 1209, 597, -2185, -2098, 4730, 13241, 14180, 6458, -1336, -2578, 161, 1317, 155, -649, -192, 279, 133, -96, -64, 22, 20, -2, -4, 15, 28, -44, -108, 77, 291, -66, -635, -91, 1208, 600, -2183, -2101, 4720, 13235, 14187, 6467, -1331, -2580, 158, 1318, 156, -648, -192, 278, 133, -95, -65, 22, 20, -2,
+ -4, 15, 28, -44, -108, 77, 291, -65, -635, -93, 1208, 602, -2180, -2104, 4711, 13229, 14190, 6476, -1327, -2581, 155, 1318, 158, -648, -193, 278, 134, -95, -65, 22, 20, -2, -4, 15, 28, -44, -108, 77, 291, -64, -634, -94, 1207, 604, -2178, -2108, 4702, 13224, 14194, 6485, -1322, -2583, 153, 1318, 159, -648, -194, 278, 134, -95, -65, 22, 20, -2,
+ -4, 15, 28, -44, -108, 76, 291, -64, -634, -95, 1206, 606, -2176, -2111, 4693, 13218, 14199, 6495, -1317, -2585, 150, 1319, 160, -648, -194, 278, 134, -95, -65, 22, 20, -2, -4, 15, 28, -44, -108, 76, 291, -63, -634, -96, 1205, 608, -2173, -2114, 4684, 13212, 14202, 6504, -1312, -2587, 148, 1319, 162, -648, -195, 278, 134, -95, -65, 22, 20, -2,
+ -4, 14, 28, -44, -108, 76, 291, -63, -634, -97, 1204, 610, -2171, -2118, 4675, 13206, 14210, 6513, -1308, -2588, 145, 1319, 163, -648, -196, 278, 135, -95, -65, 22, 20, -2, -4, 14, 28, -44, -108, 75, 291, -62, -634, -99, 1204, 612, -2168, -2121, 4666, 13200, 14213, 6522, -1303, -2590, 143, 1320, 164, -648, -196, 278, 135, -95, -65, 22, 20, -2,
+ -4, 14, 28, -44, -108, 75, 291, -61, -633, -100, 1203, 614, -2166, -2124, 4657, 13194, 14216, 6532, -1298, -2592, 140, 1320, 166, -648, -197, 278, 135, -95, -65, 22, 20, -2, -4, 14, 28, -44, -108, 75, 291, -61, -633, -101, 1202, 616, -2164, -2128, 4648, 13188, 14223, 6541, -1293, -2594, 138, 1320, 167, -648, -198, 277, 136, -95, -65, 22, 20, -2,
+ -4, 14, 28, -43, -108, 75, 291, -60, -633, -102, 1201, 618, -2161, -2131, 4639, 13183, 14223, 6550, -1288, -2595, 135, 1321, 169, -648, -198, 277, 136, -95, -66, 22, 20, -2, -4, 14, 28, -43, -108, 74, 291, -59, -633, -104, 1200, 620, -2159, -2134, 4630, 13177, 14232, 6559, -1284, -2597, 132, 1321, 170, -648, -199, 277, 136, -95, -66, 22, 20, -2,
+ -4, 14, 28, -43, -108, 74, 291, -59, -633, -105, 1200, 622, -2156, -2137, 4621, 13171, 14233, 6569, -1279, -2599, 130, 1321, 171, -648, -200, 277, 137, -94, -66, 22, 20, -2, -4, 14, 28, -43, -108, 74, 291, -58, -632, -106, 1199, 624, -2154, -2141, 4612, 13165, 14236, 6578, -1274, -2600, 127, 1322, 173, -648, -201, 277, 137, -94, -66, 22, 20, -2,
+ -4, 14, 28, -43, -108, 73, 291, -57, -632, -107, 1198, 627, -2152, -2144, 4603, 13159, 14240, 6587, -1269, -2602, 125, 1322, 174, -648, -201, 277, 137, -94, -66, 22, 20, -2, -4, 14, 28, -43, -108, 73, 291, -57, -632, -108, 1197, 629, -2149, -2147, 4594, 13153, 14245, 6597, -1264, -2604, 122, 1322, 175, -648, -202, 277, 137, -94, -66, 22, 20, -2,
+ -4, 14, 28, -43, -108, 73, 291, -56, -632, -110, 1196, 631, -2147, -2151, 4585, 13147, 14248, 6606, -1259, -2605, 120, 1323, 177, -647, -203, 276, 138, -94, -66, 22, 20, -2, -4, 14, 28, -43, -108, 73, 291, -55, -631, -111, 1196, 633, -2144, -2154, 4576, 13141, 14251, 6615, -1255, -2607, 117, 1323, 178, -647, -203, 276, 138, -94, -66, 22, 20, -2,
+ -4, 14, 29, -43, -108, 72, 291, -55, -631, -112, 1195, 635, -2142, -2157, 4567, 13135, 14256, 6624, -1250, -2609, 115, 1323, 180, -647, -204, 276, 138, -94, -66, 22, 20, -2, -4, 14, 29, -42, -108, 72, 291, -54, -631, -113, 1194, 637, -2139, -2160, 4558, 13129, 14255, 6634, -1245, -2610, 112, 1324, 181, -647, -205, 276, 139, -94, -66, 22, 21, -2,
+ -4, 14, 29, -42, -108, 72, 291, -54, -631, -114, 1193, 639, -2137, -2163, 4549, 13123, 14262, 6643, -1240, -2612, 109, 1324, 182, -647, -205, 276, 139, -94, -67, 22, 21, -2, -4, 14, 29, -42, -108, 71, 291, -53, -631, -116, 1192, 641, -2134, -2167, 4540, 13117, 14268, 6652, -1235, -2614, 107, 1324, 184, -647, -206, 276, 139, -94, -67, 22, 21, -2,
+ -4, 14, 29, -42, -108, 71, 291, -52, -630, -117, 1191, 643, -2132, -2170, 4531, 13111, 14271, 6661, -1230, -2615, 104, 1324, 185, -647, -207, 276, 139, -93, -67, 22, 21, -2, -4, 14, 29, -42, -108, 71, 291, -52, -630, -118, 1191, 645, -2130, -2173, 4522, 13105, 14272, 6671, -1225, -2617, 102, 1325, 187, -647, -207, 275, 140, -93, -67, 22, 21, -2,
+ -4, 14, 29, -42, -108, 71, 291, -51, -630, -119, 1190, 647, -2127, -2176, 4513, 13099, 14278, 6680, -1220, -2619, 99, 1325, 188, -647, -208, 275, 140, -93, -67, 21, 21, -2, -4, 14, 29, -42, -108, 70, 291, -50, -630, -120, 1189, 649, -2125, -2179, 4504, 13093, 14285, 6689, -1216, -2620, 96, 1325, 189, -647, -209, 275, 140, -93, -67, 21, 21, -2,
+ -4, 14, 29, -42, -108, 70, 291, -50, -629, -122, 1188, 651, -2122, -2183, 4495, 13087, 14287, 6698, -1211, -2622, 94, 1326, 191, -647, -209, 275, 141, -93, -67, 21, 21, -2, -4, 14, 29, -42, -108, 70, 291, -49, -629, -123, 1187, 653, -2120, -2186, 4486, 13081, 14292, 6708, -1206, -2624, 91, 1326, 192, -647, -210, 275, 141, -93, -67, 21, 21, -2,
+ -4, 14, 29, -42, -108, 69, 291, -48, -629, -124, 1186, 655, -2117, -2189, 4477, 13075, 14295, 6717, -1201, -2625, 89, 1326, 193, -646, -211, 275, 141, -93, -67, 21, 21, -2, -4, 14, 29, -41, -108, 69, 291, -48, -629, -125, 1186, 657, -2115, -2192, 4468, 13069, 14298, 6726, -1196, -2627, 86, 1326, 195, -646, -211, 275, 142, -93, -68, 21, 21, -2,
+ -4, 14, 29, -41, -108, 69, 291, -47, -629, -126, 1185, 659, -2112, -2195, 4459, 13063, 14301, 6736, -1191, -2629, 84, 1327, 196, -646, -212, 274, 142, -93, -68, 21, 21, -2, -4, 14, 29, -41, -108, 69, 290, -47, -628, -128, 1184, 661, -2110, -2198, 4450, 13057, 14307, 6745, -1186, -2630, 81, 1327, 198, -646, -213, 274, 142, -93, -68, 21, 21, -2,
+ -4, 14, 29, -41, -109, 68, 290, -46, -628, -129, 1183, 663, -2107, -2202, 4441, 13051, 14314, 6754, -1181, -2632, 78, 1327, 199, -646, -214, 274, 142, -92, -68, 21, 21, -2, -4, 14, 29, -41, -109, 68, 290, -45, -628, -130, 1182, 665, -2105, -2205, 4432, 13045, 14315, 6763, -1176, -2633, 76, 1328, 200, -646, -214, 274, 143, -92, -68, 21, 21, -2,
+ -4, 14, 29, -41, -109, 68, 290, -45, -628, -131, 1181, 667, -2102, -2208, 4423, 13039, 14319, 6773, -1171, -2635, 73, 1328, 202, -646, -215, 274, 143, -92, -68, 21, 21, -2, -4, 14, 29, -41, -109, 67, 290, -44, -627, -132, 1181, 669, -2100, -2211, 4414, 13033, 14323, 6782, -1166, -2637, 71, 1328, 203, -646, -216, 274, 143, -92, -68, 21, 21, -2,
+ -4, 14, 29, -41, -109, 67, 290, -43, -627, -134, 1180, 671, -2097, -2214, 4405, 13027, 14325, 6791, -1161, -2638, 68, 1328, 205, -646, -216, 274, 144, -92, -68, 21, 21, -2, -4, 14, 29, -41, -109, 67, 290, -43, -627, -135, 1179, 673, -2095, -2217, 4396, 13021, 14332, 6800, -1156, -2640, 65, 1329, 206, -646, -217, 273, 144, -92, -68, 21, 21, -2,
+ -4, 14, 29, -40, -109, 67, 290, -42, -627, -136, 1178, 675, -2092, -2220, 4387, 13015, 14332, 6810, -1151, -2641, 63, 1329, 207, -645, -218, 273, 144, -92, -68, 21, 21, -2, -4, 14, 29, -40, -109, 66, 290, -42, -626, -137, 1177, 677, -2090, -2223, 4378, 13009, 14338, 6819, -1146, -2643, 60, 1329, 209, -645, -218, 273, 144, -92, -69, 21, 21, -2,
+ -4, 14, 29, -40, -109, 66, 290, -41, -626, -138, 1176, 679, -2087, -2226, 4369, 13003, 14342, 6828, -1141, -2645, 57, 1329, 210, -645, -219, 273, 145, -92, -69, 21, 21, -2, -4, 14, 29, -40, -109, 66, 290, -40, -626, -139, 1175, 681, -2085, -2229, 4360, 12997, 14345, 6837, -1136, -2646, 55, 1330, 211, -645, -220, 273, 145, -92, -69, 21, 21, -2,
+ -4, 13, 29, -40, -109, 65, 290, -40, -626, -141, 1175, 683, -2082, -2233, 4351, 12990, 14351, 6847, -1131, -2648, 52, 1330, 213, -645, -220, 273, 145, -91, -69, 21, 21, -2, -4, 13, 29, -40, -109, 65, 290, -39, -625, -142, 1174, 685, -2080, -2236, 4342, 12984, 14354, 6856, -1126, -2649, 50, 1330, 214, -645, -221, 272, 146, -91, -69, 21, 21, -2,
+ -4, 13, 29, -40, -109, 65, 290, -38, -625, -143, 1173, 687, -2077, -2239, 4333, 12978, 14358, 6865, -1121, -2651, 47, 1330, 216, -645, -222, 272, 146, -91, -69, 21, 21, -2, -4, 13, 29, -40, -109, 65, 290, -38, -625, -144, 1172, 689, -2075, -2242, 4324, 12972, 14361, 6875, -1116, -2652, 44, 1331, 217, -645, -222, 272, 146, -91, -69, 21, 21, -2,
+ -4, 13, 29, -40, -109, 64, 290, -37, -625, -145, 1171, 691, -2072, -2245, 4315, 12966, 14367, 6884, -1111, -2654, 42, 1331, 218, -645, -223, 272, 146, -91, -69, 20, 21, -2, -4, 13, 29, -39, -109, 64, 290, -37, -625, -147, 1170, 693, -2070, -2248, 4306, 12960, 14370, 6893, -1106, -2655, 39, 1331, 220, -644, -224, 272, 147, -91, -69, 20, 21, -2,
+ -4, 13, 29, -39, -109, 64, 290, -36, -624, -148, 1169, 695, -2067, -2251, 4297, 12953, 14373, 6902, -1101, -2657, 37, 1331, 221, -644, -224, 272, 147, -91, -69, 20, 21, -2, -4, 13, 29, -39, -109, 63, 290, -35, -624, -149, 1168, 697, -2065, -2254, 4288, 12947, 14380, 6912, -1096, -2659, 34, 1331, 223, -644, -225, 271, 147, -91, -70, 20, 21, -2,
+ -4, 13, 29, -39, -109, 63, 290, -35, -624, -150, 1168, 699, -2062, -2257, 4279, 12941, 14382, 6921, -1091, -2660, 31, 1332, 224, -644, -226, 271, 148, -91, -70, 20, 21, -2, -4, 13, 29, -39, -109, 63, 290, -34, -623, -151, 1167, 701, -2060, -2260, 4271, 12935, 14383, 6930, -1085, -2662, 29, 1332, 225, -644, -227, 271, 148, -90, -70, 20, 21, -2,
+ -4, 13, 29, -39, -109, 63, 290, -33, -623, -152, 1166, 703, -2057, -2263, 4262, 12929, 14385, 6939, -1080, -2663, 26, 1332, 227, -644, -227, 271, 148, -90, -70, 20, 21, -2, -4, 13, 29, -39, -109, 62, 290, -33, -623, -154, 1165, 705, -2055, -2266, 4253, 12922, 14393, 6949, -1075, -2665, 23, 1332, 228, -644, -228, 271, 149, -90, -70, 20, 21, -2,
+ -4, 13, 29, -39, -109, 62, 290, -32, -623, -155, 1164, 707, -2052, -2269, 4244, 12916, 14393, 6958, -1070, -2666, 21, 1333, 230, -643, -229, 271, 149, -90, -70, 20, 21, -2, -4, 13, 29, -39, -109, 62, 290, -32, -622, -156, 1163, 709, -2050, -2272, 4235, 12910, 14399, 6967, -1065, -2668, 18, 1333, 231, -643, -229, 270, 149, -90, -70, 20, 21, -2,
+ -4, 13, 29, -39, -109, 61, 290, -31, -622, -157, 1162, 711, -2047, -2275, 4226, 12904, 14403, 6976, -1060, -2669, 15, 1333, 232, -643, -230, 270, 149, -90, -70, 20, 22, -2, -4, 13, 29, -38, -109, 61, 290, -30, -622, -158, 1161, 712, -2045, -2278, 4217, 12898, 14405, 6986, -1055, -2671, 13, 1333, 234, -643, -231, 270, 150, -90, -70, 20, 22, -2,
+ -4, 13, 29, -38, -109, 61, 290, -30, -622, -159, 1160, 714, -2042, -2280, 4208, 12891, 14409, 6995, -1050, -2672, 10, 1333, 235, -643, -231, 270, 150, -90, -70, 20, 22, -2, -4, 13, 29, -38, -109, 61, 290, -29, -621, -161, 1160, 716, -2040, -2283, 4199, 12885, 14412, 7004, -1044, -2674, 7, 1334, 237, -643, -232, 270, 150, -90, -71, 20, 22, -2,
+ -4, 13, 29, -38, -109, 60, 290, -28, -621, -162, 1159, 718, -2037, -2286, 4190, 12879, 14414, 7013, -1039, -2675, 5, 1334, 238, -643, -233, 270, 151, -89, -71, 20, 22, -2, -4, 13, 29, -38, -109, 60, 290, -28, -621, -163, 1158, 720, -2034, -2289, 4181, 12873, 14419, 7023, -1034, -2677, 2, 1334, 239, -643, -233, 269, 151, -89, -71, 20, 22, -2,
+ -4, 13, 29, -38, -109, 60, 290, -27, -621, -164, 1157, 722, -2032, -2292, 4172, 12866, 14422, 7032, -1029, -2678, 0, 1334, 241, -642, -234, 269, 151, -89, -71, 20, 22, -2, -4, 13, 29, -38, -109, 59, 290, -27, -620, -165, 1156, 724, -2029, -2295, 4163, 12860, 14428, 7041, -1024, -2680, -3, 1334, 242, -642, -235, 269, 151, -89, -71, 20, 22, -2,
+ -4, 13, 29, -38, -109, 59, 290, -26, -620, -166, 1155, 726, -2027, -2298, 4155, 12854, 14428, 7050, -1019, -2681, -6, 1335, 244, -642, -235, 269, 152, -89, -71, 20, 22, -2, -4, 13, 29, -38, -109, 59, 290, -25, -620, -167, 1154, 728, -2024, -2301, 4146, 12847, 14431, 7060, -1013, -2683, -8, 1335, 245, -642, -236, 269, 152, -89, -71, 20, 22, -2,
+ -4, 13, 29, -37, -109, 59, 290, -25, -620, -169, 1153, 730, -2022, -2304, 4137, 12841, 14437, 7069, -1008, -2684, -11, 1335, 246, -642, -237, 269, 152, -89, -71, 20, 22, -2, -4, 13, 29, -37, -109, 58, 289, -24, -619, -170, 1152, 732, -2019, -2307, 4128, 12835, 14441, 7078, -1003, -2686, -14, 1335, 248, -642, -237, 268, 153, -89, -71, 20, 22, -2,
+ -4, 13, 29, -37, -109, 58, 289, -23, -619, -171, 1151, 734, -2017, -2310, 4119, 12828, 14445, 7088, -998, -2687, -16, 1335, 249, -641, -238, 268, 153, -89, -71, 19, 22, -2, -4, 13, 29, -37, -109, 58, 289, -23, -619, -172, 1150, 736, -2014, -2312, 4110, 12822, 14449, 7097, -993, -2689, -19, 1335, 251, -641, -239, 268, 153, -88, -72, 19, 22, -2,
+ -4, 13, 29, -37, -109, 57, 289, -22, -618, -173, 1150, 737, -2011, -2315, 4101, 12816, 14450, 7106, -987, -2690, -22, 1336, 252, -641, -239, 268, 153, -88, -72, 19, 22, -2, -4, 13, 29, -37, -109, 57, 289, -22, -618, -174, 1149, 739, -2009, -2318, 4092, 12809, 14455, 7115, -982, -2691, -24, 1336, 253, -641, -240, 268, 154, -88, -72, 19, 22, -2,
+ -4, 13, 29, -37, -109, 57, 289, -21, -618, -176, 1148, 741, -2006, -2321, 4083, 12803, 14460, 7125, -977, -2693, -27, 1336, 255, -641, -241, 267, 154, -88, -72, 19, 22, -2, -4, 13, 29, -37, -109, 57, 289, -20, -618, -177, 1147, 743, -2004, -2324, 4074, 12797, 14465, 7134, -972, -2694, -30, 1336, 256, -641, -242, 267, 154, -88, -72, 19, 22, -2,
+ -4, 13, 29, -37, -109, 56, 289, -20, -617, -178, 1146, 745, -2001, -2327, 4066, 12790, 14466, 7143, -966, -2696, -32, 1336, 258, -641, -242, 267, 155, -88, -72, 19, 22, -2, -4, 13, 29, -37, -109, 56, 289, -19, -617, -179, 1145, 747, -1999, -2329, 4057, 12784, 14469, 7152, -961, -2697, -35, 1336, 259, -640, -243, 267, 155, -88, -72, 19, 22, -2,
+ -4, 13, 29, -36, -109, 56, 289, -18, -617, -180, 1144, 749, -1996, -2332, 4048, 12778, 14471, 7162, -956, -2699, -38, 1337, 260, -640, -244, 267, 155, -88, -72, 19, 22, -2, -4, 12, 29, -36, -109, 55, 289, -18, -617, -181, 1143, 751, -1993, -2335, 4039, 12771, 14476, 7171, -951, -2700, -40, 1337, 262, -640, -244, 267, 155, -88, -72, 19, 22, -2,
+ -4, 12, 29, -36, -109, 55, 289, -17, -616, -182, 1142, 753, -1991, -2338, 4030, 12765, 14478, 7180, -945, -2701, -43, 1337, 263, -640, -245, 266, 156, -87, -72, 19, 22, -2, -4, 12, 29, -36, -109, 55, 289, -17, -616, -184, 1141, 754, -1988, -2341, 4021, 12758, 14487, 7189, -940, -2703, -46, 1337, 265, -640, -246, 266, 156, -87, -73, 19, 22, -2,
+ -4, 12, 30, -36, -110, 55, 289, -16, -616, -185, 1140, 756, -1986, -2343, 4012, 12752, 14488, 7199, -935, -2704, -49, 1337, 266, -640, -246, 266, 156, -87, -73, 19, 22, -1, -4, 12, 30, -36, -110, 54, 289, -15, -615, -186, 1139, 758, -1983, -2346, 4004, 12746, 14488, 7208, -929, -2706, -51, 1337, 267, -639, -247, 266, 157, -87, -73, 19, 22, -1,
+ -4, 12, 30, -36, -110, 54, 289, -15, -615, -187, 1138, 760, -1980, -2349, 3995, 12739, 14493, 7217, -924, -2707, -54, 1337, 269, -639, -248, 266, 157, -87, -73, 19, 22, -1, -4, 12, 30, -36, -110, 54, 289, -14, -615, -188, 1137, 762, -1978, -2352, 3986, 12733, 14497, 7226, -919, -2708, -57, 1338, 270, -639, -248, 265, 157, -87, -73, 19, 22, -1,
+ -4, 12, 30, -36, -110, 53, 289, -14, -614, -189, 1137, 764, -1975, -2355, 3977, 12726, 14499, 7235, -913, -2710, -59, 1338, 272, -639, -249, 265, 158, -87, -73, 19, 22, -1, -4, 12, 30, -35, -110, 53, 289, -13, -614, -190, 1136, 766, -1973, -2357, 3968, 12720, 14501, 7245, -908, -2711, -62, 1338, 273, -639, -250, 265, 158, -87, -73, 19, 22, -1,
+ -4, 12, 30, -35, -110, 53, 289, -12, -614, -191, 1135, 768, -1970, -2360, 3959, 12713, 14505, 7254, -903, -2713, -65, 1338, 275, -639, -250, 265, 158, -87, -73, 19, 22, -1, -4, 12, 30, -35, -110, 53, 289, -12, -614, -193, 1134, 769, -1967, -2363, 3950, 12707, 14508, 7263, -897, -2714, -67, 1338, 276, -638, -251, 265, 158, -86, -73, 19, 22, -1,
+ -4, 12, 30, -35, -110, 52, 289, -11, -613, -194, 1133, 771, -1965, -2365, 3942, 12700, 14511, 7272, -892, -2715, -70, 1338, 277, -638, -252, 265, 159, -86, -73, 19, 22, -1, -4, 12, 30, -35, -110, 52, 288, -11, -613, -195, 1132, 773, -1962, -2368, 3933, 12694, 14518, 7282, -887, -2717, -73, 1338, 279, -638, -252, 264, 159, -86, -74, 18, 22, -1,
+ -4, 12, 30, -35, -110, 52, 288, -10, -613, -196, 1131, 775, -1960, -2371, 3924, 12687, 14522, 7291, -881, -2718, -75, 1338, 280, -638, -253, 264, 159, -86, -74, 18, 22, -1, -4, 12, 30, -35, -110, 51, 288, -9, -612, -197, 1130, 777, -1957, -2374, 3915, 12681, 14523, 7300, -876, -2719, -78, 1339, 282, -638, -254, 264, 160, -86, -74, 18, 22, -1,
+ -4, 12, 30, -35, -110, 51, 288, -9, -612, -198, 1129, 779, -1954, -2376, 3906, 12674, 14528, 7309, -871, -2721, -81, 1339, 283, -637, -255, 264, 160, -86, -74, 18, 22, -1, -4, 12, 30, -35, -110, 51, 288, -8, -612, -199, 1128, 781, -1952, -2379, 3897, 12668, 14530, 7319, -865, -2722, -84, 1339, 284, -637, -255, 264, 160, -86, -74, 18, 22, -1,
+ -4, 12, 30, -35, -110, 51, 288, -7, -612, -200, 1127, 782, -1949, -2382, 3889, 12661, 14533, 7328, -860, -2723, -86, 1339, 286, -637, -256, 263, 160, -86, -74, 18, 23, -1, -4, 12, 30, -34, -110, 50, 288, -7, -611, -202, 1126, 784, -1946, -2384, 3880, 12655, 14535, 7337, -854, -2725, -89, 1339, 287, -637, -257, 263, 161, -85, -74, 18, 23, -1,
+ -4, 12, 30, -34, -110, 50, 288, -6, -611, -203, 1125, 786, -1944, -2387, 3871, 12648, 14539, 7346, -849, -2726, -92, 1339, 289, -637, -257, 263, 161, -85, -74, 18, 23, -1, -4, 12, 30, -34, -110, 50, 288, -6, -611, -204, 1124, 788, -1941, -2390, 3862, 12642, 14541, 7356, -844, -2727, -94, 1339, 290, -636, -258, 263, 161, -85, -74, 18, 23, -1,
+ -4, 12, 30, -34, -110, 49, 288, -5, -610, -205, 1123, 790, -1939, -2392, 3853, 12635, 14545, 7365, -838, -2729, -97, 1339, 291, -636, -259, 263, 162, -85, -74, 18, 23, -1, -4, 12, 30, -34, -110, 49, 288, -4, -610, -206, 1122, 792, -1936, -2395, 3845, 12629, 14548, 7374, -833, -2730, -100, 1339, 293, -636, -259, 262, 162, -85, -75, 18, 23, -1,
+ -4, 12, 30, -34, -110, 49, 288, -4, -610, -207, 1121, 793, -1933, -2398, 3836, 12622, 14553, 7383, -827, -2731, -103, 1340, 294, -636, -260, 262, 162, -85, -75, 18, 23, -1, -4, 12, 30, -34, -110, 49, 288, -3, -609, -208, 1120, 795, -1931, -2400, 3827, 12616, 14554, 7393, -822, -2733, -105, 1340, 296, -636, -261, 262, 162, -85, -75, 18, 23, -1,
+ -4, 12, 30, -34, -110, 48, 288, -3, -609, -209, 1119, 797, -1928, -2403, 3818, 12609, 14557, 7402, -816, -2734, -108, 1340, 297, -635, -261, 262, 163, -85, -75, 18, 23, -1, -4, 12, 30, -34, -110, 48, 288, -2, -609, -211, 1118, 799, -1925, -2405, 3809, 12602, 14561, 7411, -811, -2735, -111, 1340, 298, -635, -262, 262, 163, -84, -75, 18, 23, -1,
+ -4, 12, 30, -33, -110, 48, 288, -1, -608, -212, 1117, 801, -1923, -2408, 3801, 12596, 14563, 7420, -806, -2737, -113, 1340, 300, -635, -263, 261, 163, -84, -75, 18, 23, -1, -4, 12, 30, -33, -110, 47, 288, -1, -608, -213, 1116, 802, -1920, -2411, 3792, 12589, 14568, 7429, -800, -2738, -116, 1340, 301, -635, -263, 261, 164, -84, -75, 18, 23, -1,
+ -4, 12, 30, -33, -110, 47, 287, 0, -608, -214, 1115, 804, -1917, -2413, 3783, 12583, 14570, 7439, -795, -2739, -119, 1340, 303, -635, -264, 261, 164, -84, -75, 18, 23, -1, -4, 12, 30, -33, -110, 47, 287, 0, -608, -215, 1114, 806, -1915, -2416, 3774, 12576, 14575, 7448, -789, -2740, -122, 1340, 304, -634, -265, 261, 164, -84, -75, 18, 23, -1,
+ -4, 12, 30, -33, -110, 47, 287, 1, -607, -216, 1113, 808, -1912, -2418, 3765, 12569, 14577, 7457, -784, -2742, -124, 1340, 306, -634, -265, 261, 164, -84, -75, 17, 23, -1, -4, 12, 30, -33, -110, 46, 287, 2, -607, -217, 1112, 810, -1909, -2421, 3757, 12563, 14581, 7466, -778, -2743, -127, 1340, 307, -634, -266, 260, 165, -84, -76, 17, 23, -1,
+ -4, 12, 30, -33, -110, 46, 287, 2, -607, -218, 1111, 811, -1907, -2424, 3748, 12556, 14588, 7476, -773, -2744, -130, 1340, 308, -634, -267, 260, 165, -84, -76, 17, 23, -1, -4, 12, 30, -33, -110, 46, 287, 3, -606, -219, 1110, 813, -1904, -2426, 3739, 12549, 14588, 7485, -767, -2746, -133, 1340, 310, -634, -267, 260, 165, -83, -76, 17, 23, -1,
+ -4, 12, 30, -33, -110, 46, 287, 3, -606, -221, 1109, 815, -1901, -2429, 3730, 12543, 14591, 7494, -762, -2747, -135, 1340, 311, -633, -268, 260, 166, -83, -76, 17, 23, -1, -4, 11, 30, -33, -110, 45, 287, 4, -606, -222, 1108, 817, -1899, -2431, 3722, 12536, 14596, 7503, -756, -2748, -138, 1340, 313, -633, -269, 259, 166, -83, -76, 17, 23, -1,
+ -4, 11, 30, -32, -110, 45, 287, 5, -605, -223, 1107, 819, -1896, -2434, 3713, 12529, 14599, 7512, -751, -2749, -141, 1340, 314, -633, -270, 259, 166, -83, -76, 17, 23, -1, -4, 11, 30, -32, -110, 45, 287, 5, -605, -224, 1106, 820, -1893, -2436, 3704, 12523, 14601, 7522, -745, -2751, -144, 1341, 315, -633, -270, 259, 166, -83, -76, 17, 23, -1,
+ -4, 11, 30, -32, -110, 44, 287, 6, -605, -225, 1105, 822, -1891, -2439, 3695, 12516, 14603, 7531, -739, -2752, -146, 1341, 317, -632, -271, 259, 167, -83, -76, 17, 23, -1, -4, 11, 30, -32, -110, 44, 287, 6, -604, -226, 1104, 824, -1888, -2441, 3687, 12509, 14606, 7540, -734, -2753, -149, 1341, 318, -632, -272, 259, 167, -83, -76, 17, 23, -1,
+ -4, 11, 30, -32, -110, 44, 287, 7, -604, -227, 1103, 826, -1885, -2444, 3678, 12503, 14608, 7549, -728, -2754, -152, 1341, 320, -632, -272, 258, 167, -83, -76, 17, 23, -1, -4, 11, 30, -32, -110, 44, 287, 8, -604, -228, 1102, 827, -1883, -2446, 3669, 12496, 14613, 7558, -723, -2755, -155, 1341, 321, -632, -273, 258, 168, -82, -77, 17, 23, -1,
+ -4, 11, 30, -32, -110, 43, 287, 8, -603, -229, 1101, 829, -1880, -2449, 3660, 12489, 14616, 7568, -717, -2757, -157, 1341, 323, -632, -274, 258, 168, -82, -77, 17, 23, -1, -4, 11, 30, -32, -110, 43, 287, 9, -603, -230, 1100, 831, -1877, -2451, 3652, 12483, 14616, 7577, -712, -2758, -160, 1341, 324, -631, -274, 258, 168, -82, -77, 17, 23, -1,
+ -4, 11, 30, -32, -110, 43, 286, 9, -603, -231, 1099, 833, -1875, -2454, 3643, 12476, 14623, 7586, -706, -2759, -163, 1341, 325, -631, -275, 258, 168, -82, -77, 17, 23, -1, -4, 11, 30, -32, -110, 42, 286, 10, -602, -233, 1098, 834, -1872, -2456, 3634, 12469, 14627, 7595, -700, -2760, -166, 1341, 327, -631, -276, 257, 169, -82, -77, 17, 23, -1,
+ -4, 11, 30, -31, -110, 42, 286, 11, -602, -234, 1097, 836, -1869, -2459, 3625, 12462, 14628, 7605, -695, -2761, -168, 1341, 328, -631, -276, 257, 169, -82, -77, 17, 23, -1, -4, 11, 30, -31, -110, 42, 286, 11, -602, -235, 1096, 838, -1867, -2461, 3617, 12456, 14630, 7614, -689, -2763, -171, 1341, 330, -630, -277, 257, 169, -82, -77, 17, 23, -1,
+ -4, 11, 30, -31, -110, 42, 286, 12, -601, -236, 1095, 840, -1864, -2464, 3608, 12449, 14633, 7623, -684, -2764, -174, 1341, 331, -630, -278, 257, 170, -82, -77, 17, 23, -1, -4, 11, 30, -31, -110, 41, 286, 12, -601, -237, 1094, 841, -1861, -2466, 3599, 12442, 14638, 7632, -678, -2765, -177, 1341, 333, -630, -278, 256, 170, -81, -77, 16, 23, -1,
+ -4, 11, 30, -31, -110, 41, 286, 13, -601, -238, 1093, 843, -1859, -2469, 3590, 12435, 14642, 7641, -672, -2766, -179, 1341, 334, -630, -279, 256, 170, -81, -77, 16, 23, -1, -4, 11, 30, -31, -110, 41, 286, 14, -600, -239, 1092, 845, -1856, -2471, 3582, 12429, 14642, 7651, -667, -2767, -182, 1341, 335, -629, -280, 256, 170, -81, -78, 16, 23, -1,
+ -4, 11, 30, -31, -110, 41, 286, 14, -600, -240, 1091, 847, -1853, -2473, 3573, 12422, 14644, 7660, -661, -2769, -185, 1341, 337, -629, -280, 256, 171, -81, -78, 16, 23, -1, -4, 11, 30, -31, -110, 40, 286, 15, -600, -241, 1090, 848, -1851, -2476, 3564, 12415, 14651, 7669, -655, -2770, -188, 1341, 338, -629, -281, 256, 171, -81, -78, 16, 23, -1,
+ -4, 11, 30, -31, -110, 40, 286, 15, -599, -242, 1089, 850, -1848, -2478, 3556, 12408, 14653, 7678, -650, -2771, -190, 1341, 340, -629, -282, 255, 171, -81, -78, 16, 23, -1, -4, 11, 30, -30, -110, 40, 286, 16, -599, -243, 1088, 852, -1845, -2481, 3547, 12402, 14652, 7687, -644, -2772, -193, 1341, 341, -628, -282, 255, 171, -81, -78, 16, 24, -1,
+ -4, 11, 30, -30, -110, 39, 286, 16, -599, -244, 1087, 854, -1842, -2483, 3538, 12395, 14655, 7697, -638, -2773, -196, 1341, 342, -628, -283, 255, 172, -81, -78, 16, 24, -1, -4, 11, 30, -30, -110, 39, 285, 17, -598, -246, 1086, 855, -1840, -2485, 3530, 12388, 14659, 7706, -633, -2774, -199, 1341, 344, -628, -284, 255, 172, -80, -78, 16, 24, -1,
+ -4, 11, 30, -30, -110, 39, 285, 18, -598, -247, 1085, 857, -1837, -2488, 3521, 12381, 14662, 7715, -627, -2775, -201, 1341, 345, -628, -284, 254, 172, -80, -78, 16, 24, -1, -4, 11, 30, -30, -110, 39, 285, 18, -598, -248, 1084, 859, -1834, -2490, 3512, 12374, 14664, 7724, -621, -2777, -204, 1341, 347, -627, -285, 254, 173, -80, -78, 16, 24, -1,
+ -4, 11, 30, -30, -110, 38, 285, 19, -597, -249, 1083, 860, -1832, -2493, 3503, 12367, 14671, 7733, -616, -2778, -207, 1341, 348, -627, -286, 254, 173, -80, -78, 16, 24, -1, -4, 11, 30, -30, -110, 38, 285, 19, -597, -250, 1082, 862, -1829, -2495, 3495, 12361, 14671, 7742, -610, -2779, -210, 1341, 350, -627, -286, 254, 173, -80, -78, 16, 24, -1,
+ -4, 11, 30, -30, -110, 38, 285, 20, -596, -251, 1081, 864, -1826, -2497, 3486, 12354, 14673, 7752, -604, -2780, -213, 1341, 351, -627, -287, 254, 173, -80, -79, 16, 24, -1, -4, 11, 30, -30, -110, 38, 285, 21, -596, -252, 1080, 866, -1823, -2500, 3477, 12347, 14676, 7761, -599, -2781, -215, 1341, 352, -626, -288, 253, 174, -80, -79, 16, 24, -1,
+ -4, 11, 30, -30, -110, 37, 285, 21, -596, -253, 1079, 867, -1821, -2502, 3469, 12340, 14680, 7770, -593, -2782, -218, 1341, 354, -626, -289, 253, 174, -79, -79, 16, 24, -1, -4, 11, 30, -29, -110, 37, 285, 22, -595, -254, 1078, 869, -1818, -2504, 3460, 12333, 14680, 7779, -587, -2783, -221, 1341, 355, -626, -289, 253, 174, -79, -79, 16, 24, -1,
+ -4, 11, 30, -29, -110, 37, 285, 22, -595, -255, 1077, 871, -1815, -2507, 3451, 12326, 14683, 7788, -581, -2784, -224, 1341, 357, -626, -290, 253, 175, -79, -79, 16, 24, -1, -4, 11, 30, -29, -110, 36, 285, 23, -595, -256, 1076, 872, -1813, -2509, 3443, 12319, 14689, 7798, -576, -2786, -226, 1341, 358, -625, -291, 252, 175, -79, -79, 15, 24, -1,
+ -4, 11, 30, -29, -110, 36, 285, 24, -594, -257, 1075, 874, -1810, -2511, 3434, 12313, 14688, 7807, -570, -2787, -229, 1341, 360, -625, -291, 252, 175, -79, -79, 15, 24, -1, -4, 11, 30, -29, -110, 36, 284, 24, -594, -258, 1074, 876, -1807, -2514, 3425, 12306, 14694, 7816, -564, -2788, -232, 1341, 361, -625, -292, 252, 175, -79, -79, 15, 24, -1,
+ -4, 11, 30, -29, -110, 36, 284, 25, -594, -259, 1073, 877, -1804, -2516, 3417, 12299, 14696, 7825, -558, -2789, -235, 1341, 362, -625, -293, 252, 176, -79, -79, 15, 24, -1, -4, 11, 30, -29, -110, 35, 284, 25, -593, -260, 1072, 879, -1802, -2518, 3408, 12292, 14700, 7834, -553, -2790, -238, 1341, 364, -624, -293, 251, 176, -79, -79, 15, 24, -1,
+ -4, 10, 30, -29, -110, 35, 284, 26, -593, -261, 1071, 881, -1799, -2520, 3399, 12285, 14704, 7843, -547, -2791, -240, 1340, 365, -624, -294, 251, 176, -78, -80, 15, 24, -1, -4, 10, 30, -29, -110, 35, 284, 26, -593, -263, 1070, 882, -1796, -2523, 3391, 12278, 14707, 7853, -541, -2792, -243, 1340, 367, -624, -295, 251, 177, -78, -80, 15, 24, -1,
+ -4, 10, 30, -29, -110, 35, 284, 27, -592, -264, 1069, 884, -1793, -2525, 3382, 12271, 14707, 7862, -535, -2793, -246, 1340, 368, -623, -295, 251, 177, -78, -80, 15, 24, -1, -4, 10, 30, -28, -110, 34, 284, 28, -592, -265, 1067, 886, -1791, -2527, 3374, 12264, 14710, 7871, -529, -2794, -249, 1340, 370, -623, -296, 251, 177, -78, -80, 15, 24, -1,
+ -4, 10, 30, -28, -110, 34, 284, 28, -591, -266, 1066, 887, -1788, -2529, 3365, 12257, 14716, 7880, -524, -2795, -252, 1340, 371, -623, -297, 250, 177, -78, -80, 15, 24, -1, -4, 10, 30, -28, -110, 34, 284, 29, -591, -267, 1065, 889, -1785, -2532, 3356, 12250, 14717, 7889, -518, -2796, -254, 1340, 372, -623, -297, 250, 178, -78, -80, 15, 24, -1,
+ -4, 10, 30, -28, -110, 33, 284, 29, -591, -268, 1064, 891, -1782, -2534, 3348, 12243, 14719, 7898, -512, -2797, -257, 1340, 374, -622, -298, 250, 178, -78, -80, 15, 24, -1, -4, 10, 30, -28, -110, 33, 284, 30, -590, -269, 1063, 892, -1780, -2536, 3339, 12236, 14721, 7908, -506, -2798, -260, 1340, 375, -622, -299, 250, 178, -77, -80, 15, 24, -1,
+ -4, 10, 30, -28, -110, 33, 283, 31, -590, -270, 1062, 894, -1777, -2538, 3330, 12229, 14723, 7917, -500, -2799, -263, 1340, 377, -622, -299, 249, 179, -77, -80, 15, 24, -1, -4, 10, 30, -28, -110, 33, 283, 31, -590, -271, 1061, 896, -1774, -2541, 3322, 12222, 14726, 7926, -494, -2800, -266, 1340, 378, -621, -300, 249, 179, -77, -80, 15, 24, -1,
+ -4, 10, 30, -28, -110, 32, 283, 32, -589, -272, 1060, 897, -1771, -2543, 3313, 12215, 14730, 7935, -489, -2801, -268, 1340, 379, -621, -301, 249, 179, -77, -80, 15, 24, -1, -4, 10, 30, -28, -110, 32, 283, 32, -589, -273, 1059, 899, -1769, -2545, 3305, 12208, 14732, 7944, -483, -2802, -271, 1340, 381, -621, -301, 249, 179, -77, -81, 15, 24, 0,
+ -4, 10, 30, -28, -110, 32, 283, 33, -589, -274, 1058, 901, -1766, -2547, 3296, 12202, 14734, 7953, -477, -2803, -274, 1340, 382, -621, -302, 248, 180, -77, -81, 15, 24, 0, -4, 10, 30, -27, -110, 32, 283, 33, -588, -275, 1057, 902, -1763, -2549, 3287, 12195, 14735, 7963, -471, -2804, -277, 1340, 384, -620, -303, 248, 180, -77, -81, 14, 24, 0,
+ -4, 10, 30, -27, -110, 31, 283, 34, -588, -276, 1056, 904, -1760, -2552, 3279, 12187, 14739, 7972, -465, -2805, -280, 1339, 385, -620, -303, 248, 180, -76, -81, 14, 24, 0, -4, 10, 30, -27, -110, 31, 283, 35, -587, -277, 1055, 905, -1758, -2554, 3270, 12180, 14741, 7981, -459, -2806, -282, 1339, 387, -620, -304, 248, 180, -76, -81, 14, 24, 0,
+ -4, 10, 30, -27, -110, 31, 283, 35, -587, -278, 1054, 907, -1755, -2556, 3262, 12173, 14743, 7990, -453, -2807, -285, 1339, 388, -619, -305, 247, 181, -76, -81, 14, 24, 0, -4, 10, 30, -27, -110, 30, 283, 36, -587, -279, 1053, 909, -1752, -2558, 3253, 12166, 14747, 7999, -448, -2808, -288, 1339, 389, -619, -305, 247, 181, -76, -81, 14, 24, 0,
+ -4, 10, 30, -27, -110, 30, 283, 36, -586, -280, 1051, 910, -1749, -2560, 3244, 12159, 14751, 8008, -442, -2809, -291, 1339, 391, -619, -306, 247, 181, -76, -81, 14, 24, 0, -4, 10, 30, -27, -110, 30, 282, 37, -586, -281, 1050, 912, -1747, -2562, 3236, 12152, 14754, 8017, -436, -2810, -294, 1339, 392, -619, -307, 247, 182, -76, -81, 14, 24, 0,
+ -4, 10, 30, -27, -110, 30, 282, 37, -585, -282, 1049, 914, -1744, -2565, 3227, 12145, 14755, 8027, -430, -2811, -297, 1339, 394, -618, -307, 246, 182, -76, -81, 14, 24, 0, -4, 10, 30, -27, -110, 29, 282, 38, -585, -283, 1048, 915, -1741, -2567, 3219, 12138, 14758, 8036, -424, -2812, -299, 1339, 395, -618, -308, 246, 182, -75, -82, 14, 24, 0,
+ -4, 10, 30, -27, -110, 29, 282, 39, -585, -284, 1047, 917, -1738, -2569, 3210, 12131, 14760, 8045, -418, -2813, -302, 1339, 397, -618, -309, 246, 182, -75, -82, 14, 24, 0, -4, 10, 30, -26, -110, 29, 282, 39, -584, -285, 1046, 918, -1735, -2571, 3202, 12124, 14758, 8054, -412, -2814, -305, 1339, 398, -617, -309, 246, 183, -75, -82, 14, 25, 0,
+ -4, 10, 30, -26, -110, 29, 282, 40, -584, -286, 1045, 920, -1733, -2573, 3193, 12117, 14764, 8063, -406, -2815, -308, 1338, 399, -617, -310, 245, 183, -75, -82, 14, 25, 0, -4, 10, 30, -26, -110, 28, 282, 40, -584, -287, 1044, 922, -1730, -2575, 3184, 12110, 14768, 8072, -400, -2816, -311, 1338, 401, -617, -311, 245, 183, -75, -82, 14, 25, 0,
+ -4, 10, 30, -26, -110, 28, 282, 41, -583, -288, 1043, 923, -1727, -2577, 3176, 12103, 14768, 8081, -394, -2817, -314, 1338, 402, -616, -311, 245, 183, -75, -82, 14, 25, 0, -4, 10, 30, -26, -110, 28, 282, 41, -583, -290, 1042, 925, -1724, -2579, 3167, 12096, 14769, 8091, -388, -2818, -316, 1338, 404, -616, -312, 245, 184, -75, -82, 14, 25, 0,
+ -4, 10, 30, -26, -110, 27, 282, 42, -582, -291, 1041, 926, -1722, -2581, 3159, 12089, 14773, 8100, -382, -2819, -319, 1338, 405, -616, -313, 244, 184, -74, -82, 14, 25, 0, -4, 10, 30, -26, -110, 27, 281, 43, -582, -292, 1039, 928, -1719, -2583, 3150, 12082, 14775, 8109, -376, -2820, -322, 1338, 407, -615, -313, 244, 184, -74, -82, 14, 25, 0,
+ -4, 10, 30, -26, -110, 27, 281, 43, -582, -293, 1038, 930, -1716, -2586, 3142, 12074, 14780, 8118, -370, -2821, -325, 1338, 408, -615, -314, 244, 185, -74, -82, 13, 25, 0, -4, 10, 30, -26, -110, 27, 281, 44, -581, -294, 1037, 931, -1713, -2588, 3133, 12067, 14783, 8127, -364, -2822, -328, 1338, 409, -615, -315, 244, 185, -74, -82, 13, 25, 0,
+ -4, 10, 30, -26, -110, 26, 281, 44, -581, -295, 1036, 933, -1710, -2590, 3125, 12060, 14787, 8136, -358, -2823, -331, 1337, 411, -614, -315, 243, 185, -74, -83, 13, 25, 0, -4, 10, 30, -25, -110, 26, 281, 45, -580, -296, 1035, 934, -1708, -2592, 3116, 12053, 14789, 8145, -352, -2824, -333, 1337, 412, -614, -316, 243, 185, -74, -83, 13, 25, 0,
+ -4, 10, 30, -25, -110, 26, 281, 45, -580, -297, 1034, 936, -1705, -2594, 3108, 12046, 14789, 8154, -346, -2824, -336, 1337, 414, -614, -317, 243, 186, -74, -83, 13, 25, 0, -4, 10, 30, -25, -110, 26, 281, 46, -580, -298, 1033, 938, -1702, -2596, 3099, 12039, 14789, 8164, -340, -2825, -339, 1337, 415, -613, -318, 243, 186, -73, -83, 13, 25, 0,
+ -4, 10, 30, -25, -110, 25, 281, 47, -579, -299, 1032, 939, -1699, -2598, 3091, 12032, 14791, 8173, -334, -2826, -342, 1337, 417, -613, -318, 242, 186, -73, -83, 13, 25, 0, -4, 10, 30, -25, -110, 25, 281, 47, -579, -300, 1031, 941, -1696, -2600, 3082, 12024, 14795, 8182, -328, -2827, -345, 1337, 418, -613, -319, 242, 187, -73, -83, 13, 25, 0,
+ -4, 9, 30, -25, -110, 25, 281, 48, -578, -301, 1030, 942, -1694, -2602, 3074, 12017, 14799, 8191, -322, -2828, -348, 1336, 419, -612, -320, 242, 187, -73, -83, 13, 25, 0, -4, 9, 30, -25, -110, 25, 280, 48, -578, -302, 1028, 944, -1691, -2604, 3065, 12010, 14803, 8200, -316, -2829, -350, 1336, 421, -612, -320, 241, 187, -73, -83, 13, 25, 0,
+ -4, 9, 30, -25, -110, 24, 280, 49, -578, -303, 1027, 945, -1688, -2606, 3057, 12003, 14807, 8209, -310, -2830, -353, 1336, 422, -612, -321, 241, 187, -73, -83, 13, 25, 0, -4, 9, 30, -25, -110, 24, 280, 49, -577, -304, 1026, 947, -1685, -2608, 3048, 11996, 14806, 8218, -304, -2831, -356, 1336, 424, -611, -322, 241, 188, -72, -83, 13, 25, 0,
+ -4, 9, 30, -24, -110, 24, 280, 50, -577, -305, 1025, 948, -1682, -2610, 3040, 11989, 14806, 8227, -298, -2831, -359, 1336, 425, -611, -322, 241, 188, -72, -83, 13, 25, 0, -4, 9, 30, -24, -110, 23, 280, 50, -576, -306, 1024, 950, -1680, -2612, 3031, 11981, 14813, 8236, -292, -2832, -362, 1336, 427, -611, -323, 240, 188, -72, -84, 13, 25, 0,
+ -4, 9, 30, -24, -109, 23, 280, 51, -576, -307, 1023, 952, -1677, -2614, 3023, 11974, 14814, 8245, -286, -2833, -365, 1335, 428, -610, -324, 240, 188, -72, -84, 13, 25, 0, -4, 9, 30, -24, -109, 23, 280, 52, -576, -308, 1022, 953, -1674, -2616, 3014, 11967, 14814, 8255, -280, -2834, -367, 1335, 429, -610, -324, 240, 189, -72, -84, 13, 25, 0,
+ -4, 9, 30, -24, -109, 23, 280, 52, -575, -309, 1021, 955, -1671, -2618, 3006, 11960, 14815, 8264, -274, -2835, -370, 1335, 431, -610, -325, 240, 189, -72, -84, 13, 25, 0, -4, 9, 30, -24, -109, 22, 280, 53, -575, -310, 1019, 956, -1668, -2620, 2997, 11953, 14822, 8273, -268, -2836, -373, 1335, 432, -609, -326, 239, 189, -72, -84, 12, 25, 0,
+ -4, 9, 30, -24, -109, 22, 279, 53, -574, -311, 1018, 958, -1666, -2621, 2989, 11945, 14821, 8282, -262, -2836, -376, 1335, 434, -609, -326, 239, 190, -71, -84, 12, 25, 0, -4, 9, 30, -24, -109, 22, 279, 54, -574, -312, 1017, 959, -1663, -2623, 2980, 11938, 14824, 8291, -255, -2837, -379, 1335, 435, -609, -327, 239, 190, -71, -84, 12, 25, 0,
+ -4, 9, 30, -24, -109, 22, 279, 54, -574, -313, 1016, 961, -1660, -2625, 2972, 11931, 14826, 8300, -249, -2838, -382, 1334, 437, -608, -328, 239, 190, -71, -84, 12, 25, 0, -4, 9, 30, -24, -109, 21, 279, 55, -573, -314, 1015, 962, -1657, -2627, 2963, 11924, 14830, 8309, -243, -2839, -385, 1334, 438, -608, -328, 238, 190, -71, -84, 12, 25, 0,
+ -4, 9, 30, -23, -109, 21, 279, 56, -573, -315, 1014, 964, -1654, -2629, 2955, 11916, 14830, 8318, -237, -2840, -387, 1334, 439, -608, -329, 238, 191, -71, -84, 12, 25, 0, -4, 9, 30, -23, -109, 21, 279, 56, -572, -316, 1013, 965, -1652, -2631, 2946, 11909, 14833, 8327, -231, -2841, -390, 1334, 441, -607, -330, 238, 191, -71, -84, 12, 25, 0,
+ -4, 9, 30, -23, -109, 21, 279, 57, -572, -317, 1012, 967, -1649, -2633, 2938, 11902, 14835, 8336, -225, -2841, -393, 1334, 442, -607, -330, 237, 191, -71, -85, 12, 25, 0, -4, 9, 30, -23, -109, 20, 279, 57, -572, -318, 1010, 968, -1646, -2635, 2930, 11895, 14840, 8345, -219, -2842, -396, 1333, 444, -607, -331, 237, 191, -70, -85, 12, 25, 0,
+ -4, 9, 30, -23, -109, 20, 278, 58, -571, -319, 1009, 970, -1643, -2637, 2921, 11887, 14840, 8355, -212, -2843, -399, 1333, 445, -606, -332, 237, 192, -70, -85, 12, 25, 0, -4, 9, 30, -23, -109, 20, 278, 58, -571, -320, 1008, 971, -1640, -2639, 2913, 11880, 14842, 8364, -206, -2844, -402, 1333, 447, -606, -332, 237, 192, -70, -85, 12, 25, 0,
+ -4, 9, 30, -23, -109, 20, 278, 59, -570, -321, 1007, 973, -1637, -2640, 2904, 11873, 14843, 8373, -200, -2844, -405, 1333, 448, -606, -333, 236, 192, -70, -85, 12, 25, 0, -4, 9, 30, -23, -109, 19, 278, 59, -570, -322, 1006, 974, -1635, -2642, 2896, 11865, 14850, 8382, -194, -2845, -408, 1332, 449, -605, -334, 236, 192, -70, -85, 12, 25, 0,
+ -4, 9, 30, -23, -109, 19, 278, 60, -569, -322, 1005, 976, -1632, -2644, 2887, 11858, 14847, 8391, -188, -2846, -410, 1332, 451, -605, -334, 236, 193, -70, -85, 12, 25, 0, -4, 9, 30, -23, -109, 19, 278, 60, -569, -323, 1004, 977, -1629, -2646, 2879, 11851, 14850, 8400, -182, -2847, -413, 1332, 452, -604, -335, 235, 193, -69, -85, 12, 25, 0,
+ -4, 9, 30, -23, -109, 18, 278, 61, -569, -324, 1002, 979, -1626, -2648, 2871, 11843, 14852, 8409, -175, -2847, -416, 1332, 454, -604, -336, 235, 193, -69, -85, 12, 25, 0, -4, 9, 30, -22, -109, 18, 278, 62, -568, -325, 1001, 980, -1623, -2650, 2862, 11836, 14853, 8418, -169, -2848, -419, 1332, 455, -604, -336, 235, 194, -69, -85, 11, 25, 0,
+ -4, 9, 30, -22, -109, 18, 278, 62, -568, -326, 1000, 982, -1620, -2652, 2854, 11829, 14855, 8427, -163, -2849, -422, 1331, 457, -603, -337, 235, 194, -69, -85, 11, 25, 0, -4, 9, 30, -22, -109, 18, 277, 63, -567, -327, 999, 983, -1618, -2653, 2845, 11821, 14862, 8436, -157, -2850, -425, 1331, 458, -603, -338, 234, 194, -69, -86, 11, 25, 0,
+ -4, 9, 30, -22, -109, 17, 277, 63, -567, -328, 998, 985, -1615, -2655, 2837, 11814, 14863, 8445, -151, -2850, -428, 1331, 459, -603, -338, 234, 194, -69, -86, 11, 26, 0, -4, 9, 30, -22, -109, 17, 277, 64, -567, -329, 997, 986, -1612, -2657, 2829, 11807, 14860, 8454, -144, -2851, -430, 1331, 461, -602, -339, 234, 195, -68, -86, 11, 26, 0,
+ -4, 9, 30, -22, -109, 17, 277, 64, -566, -330, 996, 988, -1609, -2659, 2820, 11799, 14865, 8463, -138, -2852, -433, 1330, 462, -602, -339, 233, 195, -68, -86, 11, 26, 0, -4, 9, 30, -22, -109, 17, 277, 65, -566, -331, 994, 989, -1606, -2661, 2812, 11792, 14867, 8472, -132, -2853, -436, 1330, 464, -601, -340, 233, 195, -68, -86, 11, 26, 0,
+ -4, 9, 30, -22, -109, 16, 277, 65, -565, -332, 993, 991, -1603, -2662, 2803, 11785, 14869, 8481, -126, -2853, -439, 1330, 465, -601, -341, 233, 195, -68, -86, 11, 26, 0, -4, 9, 30, -22, -109, 16, 277, 66, -565, -333, 992, 992, -1601, -2664, 2795, 11777, 14870, 8490, -119, -2854, -442, 1330, 467, -601, -341, 233, 196, -68, -86, 11, 26, 0,
+ -4, 9, 30, -22, -109, 16, 277, 67, -564, -334, 991, 994, -1598, -2666, 2787, 11770, 14872, 8499, -113, -2855, -445, 1329, 468, -600, -342, 232, 196, -68, -86, 11, 26, 0, -4, 9, 30, -21, -109, 16, 276, 67, -564, -335, 990, 995, -1595, -2668, 2778, 11763, 14875, 8509, -107, -2855, -448, 1329, 469, -600, -343, 232, 196, -68, -86, 11, 26, 0,
+ -4, 9, 30, -21, -109, 15, 276, 68, -563, -336, 989, 996, -1592, -2669, 2770, 11755, 14874, 8518, -101, -2856, -451, 1329, 471, -600, -343, 232, 197, -67, -86, 11, 26, 0, -4, 9, 30, -21, -109, 15, 276, 68, -563, -337, 987, 998, -1589, -2671, 2761, 11748, 14878, 8527, -94, -2857, -454, 1329, 472, -599, -344, 231, 197, -67, -86, 11, 26, 0,
+ -4, 8, 30, -21, -109, 15, 276, 69, -563, -338, 986, 999, -1586, -2673, 2753, 11740, 14881, 8536, -88, -2857, -456, 1328, 474, -599, -345, 231, 197, -67, -86, 11, 26, 0, -4, 8, 30, -21, -109, 15, 276, 69, -562, -339, 985, 1001, -1583, -2675, 2745, 11733, 14882, 8545, -82, -2858, -459, 1328, 475, -598, -345, 231, 197, -67, -87, 11, 26, 0,
+ -4, 8, 30, -21, -109, 14, 276, 70, -562, -340, 984, 1002, -1581, -2676, 2736, 11725, 14886, 8554, -75, -2859, -462, 1328, 477, -598, -346, 231, 198, -67, -87, 10, 26, 0, -4, 8, 30, -21, -109, 14, 276, 70, -561, -341, 983, 1004, -1578, -2678, 2728, 11718, 14888, 8563, -69, -2859, -465, 1327, 478, -598, -347, 230, 198, -67, -87, 10, 26, 1,
+ -4, 8, 30, -21, -109, 14, 276, 71, -561, -342, 982, 1005, -1575, -2680, 2720, 11711, 14888, 8572, -63, -2860, -468, 1327, 479, -597, -347, 230, 198, -66, -87, 10, 26, 1, -4, 8, 30, -21, -109, 14, 275, 71, -560, -343, 981, 1007, -1572, -2682, 2711, 11703, 14892, 8581, -57, -2861, -471, 1327, 481, -597, -348, 230, 198, -66, -87, 10, 26, 1,
+ -4, 8, 30, -21, -109, 13, 275, 72, -560, -344, 979, 1008, -1569, -2683, 2703, 11696, 14893, 8590, -50, -2861, -474, 1327, 482, -596, -349, 229, 199, -66, -87, 10, 26, 1, -4, 8, 30, -20, -109, 13, 275, 73, -560, -345, 978, 1009, -1566, -2685, 2695, 11688, 14895, 8599, -44, -2862, -477, 1326, 484, -596, -349, 229, 199, -66, -87, 10, 26, 1,
+ -4, 8, 30, -20, -109, 13, 275, 73, -559, -346, 977, 1011, -1563, -2687, 2686, 11681, 14898, 8608, -38, -2863, -480, 1326, 485, -596, -350, 229, 199, -66, -87, 10, 26, 1, -4, 8, 30, -20, -109, 12, 275, 74, -559, -347, 976, 1012, -1561, -2688, 2678, 11673, 14898, 8617, -31, -2863, -482, 1326, 487, -595, -351, 229, 199, -66, -87, 10, 26, 1,
+ -4, 8, 30, -20, -109, 12, 275, 74, -558, -347, 975, 1014, -1558, -2690, 2670, 11666, 14898, 8626, -25, -2864, -485, 1325, 488, -595, -351, 228, 200, -65, -87, 10, 26, 1, -4, 8, 30, -20, -109, 12, 275, 75, -558, -348, 973, 1015, -1555, -2692, 2661, 11658, 14903, 8635, -19, -2865, -488, 1325, 489, -594, -352, 228, 200, -65, -87, 10, 26, 1,
+ -4, 8, 30, -20, -109, 12, 274, 75, -557, -349, 972, 1017, -1552, -2693, 2653, 11651, 14903, 8644, -12, -2865, -491, 1325, 491, -594, -353, 228, 200, -65, -88, 10, 26, 1, -4, 8, 30, -20, -109, 11, 274, 76, -557, -350, 971, 1018, -1549, -2695, 2645, 11643, 14908, 8653, -6, -2866, -494, 1325, 492, -594, -353, 227, 200, -65, -88, 10, 26, 1,
+ -4, 8, 30, -20, -109, 11, 274, 76, -556, -351, 970, 1019, -1546, -2697, 2637, 11636, 14907, 8662, 1, -2866, -497, 1324, 494, -593, -354, 227, 201, -65, -88, 10, 26, 1, -4, 8, 30, -20, -109, 11, 274, 77, -556, -352, 969, 1021, -1543, -2698, 2628, 11629, 14909, 8671, 7, -2867, -500, 1324, 495, -593, -355, 227, 201, -65, -88, 10, 26, 1,
+ -4, 8, 30, -20, -109, 11, 274, 77, -556, -353, 968, 1022, -1540, -2700, 2620, 11621, 14911, 8680, 13, -2868, -503, 1324, 497, -592, -355, 226, 201, -64, -88, 10, 26, 1, -4, 8, 30, -19, -109, 10, 274, 78, -555, -354, 966, 1024, -1538, -2701, 2612, 11613, 14912, 8689, 20, -2868, -506, 1323, 498, -592, -356, 226, 202, -64, -88, 10, 26, 1,
+ -4, 8, 30, -19, -108, 10, 274, 78, -555, -355, 965, 1025, -1535, -2703, 2603, 11606, 14917, 8698, 26, -2869, -509, 1323, 499, -592, -357, 226, 202, -64, -88, 9, 26, 1, -4, 8, 30, -19, -108, 10, 274, 79, -554, -356, 964, 1026, -1532, -2705, 2595, 11598, 14914, 8707, 33, -2869, -511, 1323, 501, -591, -357, 226, 202, -64, -88, 9, 26, 1,
+ -4, 8, 30, -19, -108, 10, 273, 79, -554, -357, 963, 1028, -1529, -2706, 2587, 11591, 14919, 8716, 39, -2870, -514, 1322, 502, -591, -358, 225, 202, -64, -88, 9, 26, 1, -4, 8, 30, -19, -108, 9, 273, 80, -553, -358, 962, 1029, -1526, -2708, 2579, 11583, 14919, 8725, 45, -2870, -517, 1322, 504, -590, -359, 225, 203, -64, -88, 9, 26, 1,
+ -4, 8, 30, -19, -108, 9, 273, 81, -553, -359, 960, 1031, -1523, -2709, 2570, 11576, 14919, 8734, 52, -2871, -520, 1322, 505, -590, -359, 225, 203, -63, -88, 9, 26, 1, -4, 8, 30, -19, -108, 9, 273, 81, -552, -360, 959, 1032, -1520, -2711, 2562, 11568, 14923, 8743, 58, -2872, -523, 1321, 507, -589, -360, 224, 203, -63, -88, 9, 26, 1,
+ -4, 8, 30, -19, -108, 9, 273, 82, -552, -361, 958, 1033, -1517, -2713, 2554, 11561, 14925, 8752, 65, -2872, -526, 1321, 508, -589, -361, 224, 203, -63, -89, 9, 26, 1, -4, 8, 30, -19, -108, 8, 273, 82, -552, -361, 957, 1035, -1515, -2714, 2545, 11553, 14928, 8761, 71, -2873, -529, 1321, 509, -589, -361, 224, 204, -63, -89, 9, 26, 1,
+ -4, 8, 30, -19, -108, 8, 273, 83, -551, -362, 956, 1036, -1512, -2716, 2537, 11546, 14928, 8770, 78, -2873, -532, 1320, 511, -588, -362, 223, 204, -63, -89, 9, 26, 1, -4, 8, 30, -19, -108, 8, 272, 83, -551, -363, 954, 1037, -1509, -2717, 2529, 11538, 14934, 8779, 84, -2874, -535, 1320, 512, -588, -363, 223, 204, -63, -89, 9, 26, 1,
+ -4, 8, 30, -18, -108, 8, 272, 84, -550, -364, 953, 1039, -1506, -2719, 2521, 11531, 14929, 8788, 90, -2874, -538, 1320, 514, -587, -363, 223, 204, -62, -89, 9, 26, 1, -4, 8, 30, -18, -108, 7, 272, 84, -550, -365, 952, 1040, -1503, -2720, 2513, 11523, 14934, 8797, 97, -2875, -541, 1319, 515, -587, -364, 222, 205, -62, -89, 9, 26, 1,
+ -4, 8, 30, -18, -108, 7, 272, 85, -549, -366, 951, 1041, -1500, -2722, 2504, 11515, 14934, 8806, 103, -2875, -543, 1319, 516, -586, -364, 222, 205, -62, -89, 9, 26, 1, -4, 8, 30, -18, -108, 7, 272, 85, -549, -367, 950, 1043, -1497, -2723, 2496, 11508, 14936, 8814, 110, -2876, -546, 1318, 518, -586, -365, 222, 205, -62, -89, 9, 26, 1,
+ -4, 8, 30, -18, -108, 7, 272, 86, -548, -368, 948, 1044, -1494, -2725, 2488, 11500, 14940, 8823, 116, -2876, -549, 1318, 519, -586, -366, 221, 205, -62, -89, 9, 26, 1, -4, 8, 30, -18, -108, 6, 272, 86, -548, -369, 947, 1046, -1492, -2727, 2480, 11493, 14941, 8832, 123, -2877, -552, 1318, 521, -585, -366, 221, 206, -62, -89, 8, 26, 1,
+ -4, 8, 30, -18, -108, 6, 271, 87, -547, -370, 946, 1047, -1489, -2728, 2471, 11485, 14944, 8841, 129, -2877, -555, 1317, 522, -585, -367, 221, 206, -61, -89, 8, 26, 1, -4, 8, 30, -18, -108, 6, 271, 87, -547, -371, 945, 1048, -1486, -2730, 2463, 11477, 14946, 8850, 136, -2878, -558, 1317, 524, -584, -368, 221, 206, -61, -89, 8, 26, 1,
+ -4, 8, 30, -18, -108, 6, 271, 88, -546, -372, 944, 1050, -1483, -2731, 2455, 11470, 14945, 8859, 142, -2878, -561, 1317, 525, -584, -368, 220, 206, -61, -90, 8, 27, 1, -4, 8, 30, -18, -108, 5, 271, 88, -546, -372, 942, 1051, -1480, -2732, 2447, 11462, 14948, 8868, 149, -2879, -564, 1316, 526, -583, -369, 220, 207, -61, -90, 8, 27, 1,
+ -4, 8, 30, -17, -108, 5, 271, 89, -545, -373, 941, 1052, -1477, -2734, 2439, 11454, 14948, 8877, 155, -2879, -567, 1316, 528, -583, -370, 220, 207, -61, -90, 8, 27, 1, -4, 8, 30, -17, -108, 5, 271, 89, -545, -374, 940, 1054, -1474, -2735, 2430, 11447, 14950, 8886, 162, -2880, -570, 1315, 529, -582, -370, 219, 207, -61, -90, 8, 27, 1,
+ -4, 7, 30, -17, -108, 5, 271, 90, -545, -375, 939, 1055, -1471, -2737, 2422, 11439, 14952, 8895, 168, -2880, -573, 1315, 531, -582, -371, 219, 207, -60, -90, 8, 27, 1, -4, 7, 30, -17, -108, 4, 270, 91, -544, -376, 938, 1056, -1468, -2738, 2414, 11432, 14953, 8904, 175, -2881, -576, 1315, 532, -582, -372, 219, 208, -60, -90, 8, 27, 1,
+ -4, 7, 30, -17, -108, 4, 270, 91, -544, -377, 936, 1058, -1465, -2740, 2406, 11424, 14954, 8913, 182, -2881, -578, 1314, 534, -581, -372, 218, 208, -60, -90, 8, 27, 1, -4, 7, 30, -17, -108, 4, 270, 92, -543, -378, 935, 1059, -1463, -2741, 2398, 11416, 14956, 8922, 188, -2881, -581, 1314, 535, -581, -373, 218, 208, -60, -90, 8, 27, 1,
+ -4, 7, 30, -17, -108, 4, 270, 92, -543, -379, 934, 1060, -1460, -2743, 2389, 11409, 14958, 8931, 195, -2882, -584, 1314, 536, -580, -374, 218, 209, -60, -90, 8, 27, 1, -4, 7, 30, -17, -108, 3, 270, 93, -542, -380, 933, 1061, -1457, -2744, 2381, 11401, 14960, 8940, 201, -2882, -587, 1313, 538, -580, -374, 217, 209, -60, -90, 8, 27, 1,
+ -4, 7, 30, -17, -108, 3, 270, 93, -542, -381, 932, 1063, -1454, -2746, 2373, 11393, 14961, 8949, 208, -2883, -590, 1313, 539, -579, -375, 217, 209, -59, -90, 8, 27, 1, -4, 7, 30, -17, -108, 3, 270, 94, -541, -381, 930, 1064, -1451, -2747, 2365, 11385, 14963, 8957, 214, -2883, -593, 1312, 541, -579, -375, 217, 209, -59, -90, 7, 27, 1,
+ -4, 7, 30, -16, -108, 3, 269, 94, -541, -382, 929, 1065, -1448, -2748, 2357, 11378, 14965, 8966, 221, -2884, -596, 1312, 542, -578, -376, 216, 210, -59, -91, 7, 27, 1, -4, 7, 30, -16, -108, 2, 269, 95, -540, -383, 928, 1067, -1445, -2750, 2349, 11370, 14967, 8975, 228, -2884, -599, 1311, 543, -578, -377, 216, 210, -59, -91, 7, 27, 1,
+ -4, 7, 30, -16, -108, 2, 269, 95, -540, -384, 927, 1068, -1442, -2751, 2341, 11362, 14967, 8984, 234, -2884, -602, 1311, 545, -577, -377, 216, 210, -59, -91, 7, 27, 1, -4, 7, 30, -16, -108, 2, 269, 96, -539, -385, 925, 1069, -1439, -2753, 2332, 11355, 14970, 8993, 241, -2885, -605, 1311, 546, -577, -378, 215, 210, -58, -91, 7, 27, 1,
+ -4, 7, 30, -16, -107, 2, 269, 96, -539, -386, 924, 1071, -1436, -2754, 2324, 11347, 14969, 9002, 247, -2885, -608, 1310, 548, -576, -379, 215, 211, -58, -91, 7, 27, 1, -4, 7, 30, -16, -107, 1, 269, 97, -538, -387, 923, 1072, -1433, -2755, 2316, 11339, 14970, 9011, 254, -2886, -611, 1310, 549, -576, -379, 215, 211, -58, -91, 7, 27, 1,
+ -4, 7, 30, -16, -107, 1, 268, 97, -538, -388, 922, 1073, -1431, -2757, 2308, 11332, 14974, 9020, 261, -2886, -614, 1309, 551, -575, -380, 214, 211, -58, -91, 7, 27, 1, -4, 7, 30, -16, -107, 1, 268, 98, -537, -389, 920, 1074, -1428, -2758, 2300, 11324, 14976, 9029, 267, -2886, -617, 1309, 552, -575, -381, 214, 211, -58, -91, 7, 27, 1,
+ -4, 7, 30, -16, -107, 1, 268, 98, -537, -389, 919, 1076, -1425, -2759, 2292, 11316, 14975, 9038, 274, -2887, -619, 1308, 553, -575, -381, 214, 212, -58, -91, 7, 27, 1, -4, 7, 30, -16, -107, 0, 268, 99, -536, -390, 918, 1077, -1422, -2761, 2284, 11308, 14975, 9047, 281, -2887, -622, 1308, 555, -574, -382, 213, 212, -57, -91, 7, 27, 1,
+ -4, 7, 30, -16, -107, 0, 268, 99, -536, -391, 917, 1078, -1419, -2762, 2275, 11301, 14979, 9055, 287, -2887, -625, 1308, 556, -574, -383, 213, 212, -57, -91, 7, 27, 1, -4, 7, 30, -15, -107, 0, 268, 100, -536, -392, 916, 1080, -1416, -2763, 2267, 11293, 14977, 9064, 294, -2888, -628, 1307, 558, -573, -383, 213, 212, -57, -91, 7, 27, 1,
+ -4, 7, 30, -15, -107, 0, 268, 100, -535, -393, 914, 1081, -1413, -2765, 2259, 11285, 14981, 9073, 301, -2888, -631, 1307, 559, -573, -384, 212, 213, -57, -92, 7, 27, 1, -4, 7, 30, -15, -107, -1, 267, 101, -535, -394, 913, 1082, -1410, -2766, 2251, 11277, 14984, 9082, 307, -2888, -634, 1306, 561, -572, -384, 212, 213, -57, -92, 6, 27, 1,
+ -4, 7, 30, -15, -107, -1, 267, 101, -534, -395, 912, 1083, -1407, -2767, 2243, 11270, 14985, 9091, 314, -2889, -637, 1306, 562, -572, -385, 212, 213, -57, -92, 6, 27, 1, -4, 7, 30, -15, -107, -1, 267, 102, -534, -396, 911, 1085, -1404, -2769, 2235, 11262, 14985, 9100, 321, -2889, -640, 1305, 563, -571, -386, 211, 213, -56, -92, 6, 27, 2,
+ -4, 7, 30, -15, -107, -1, 267, 102, -533, -396, 909, 1086, -1401, -2770, 2227, 11254, 14984, 9109, 327, -2889, -643, 1305, 565, -571, -386, 211, 214, -56, -92, 6, 27, 2, -4, 7, 30, -15, -107, -2, 267, 103, -533, -397, 908, 1087, -1399, -2771, 2219, 11246, 14988, 9118, 334, -2890, -646, 1304, 566, -570, -387, 211, 214, -56, -92, 6, 27, 2,
+ -4, 7, 30, -15, -107, -2, 267, 103, -532, -398, 907, 1088, -1396, -2773, 2211, 11238, 14991, 9126, 341, -2890, -649, 1304, 568, -570, -388, 210, 214, -56, -92, 6, 27, 2, -4, 7, 30, -15, -107, -2, 266, 104, -532, -399, 906, 1090, -1393, -2774, 2203, 11231, 14991, 9135, 347, -2890, -652, 1303, 569, -569, -388, 210, 214, -56, -92, 6, 27, 2,
+ -4, 7, 30, -15, -107, -2, 266, 104, -531, -400, 904, 1091, -1390, -2775, 2195, 11223, 14992, 9144, 354, -2891, -655, 1303, 570, -569, -389, 210, 215, -55, -92, 6, 27, 2, -4, 7, 30, -15, -107, -3, 266, 105, -531, -401, 903, 1092, -1387, -2776, 2187, 11215, 14993, 9153, 361, -2891, -658, 1303, 572, -568, -390, 209, 215, -55, -92, 6, 27, 2,
+ -4, 7, 30, -14, -107, -3, 266, 105, -530, -402, 902, 1093, -1384, -2778, 2179, 11207, 14994, 9162, 368, -2891, -661, 1302, 573, -568, -390, 209, 215, -55, -92, 6, 27, 2, -4, 7, 30, -14, -107, -3, 266, 106, -530, -402, 901, 1094, -1381, -2779, 2170, 11199, 14994, 9171, 374, -2891, -664, 1302, 575, -567, -391, 209, 215, -55, -92, 6, 27, 2,
+ -4, 7, 30, -14, -107, -3, 266, 106, -529, -403, 899, 1096, -1378, -2780, 2162, 11192, 14996, 9179, 381, -2892, -666, 1301, 576, -567, -392, 208, 216, -55, -92, 6, 27, 2, -4, 7, 30, -14, -107, -4, 265, 107, -529, -404, 898, 1097, -1375, -2781, 2154, 11184, 14997, 9188, 388, -2892, -669, 1301, 578, -566, -392, 208, 216, -55, -93, 6, 27, 2,
+ -4, 7, 30, -14, -107, -4, 265, 107, -528, -405, 897, 1098, -1372, -2783, 2146, 11176, 14999, 9197, 395, -2892, -672, 1300, 579, -566, -393, 208, 216, -54, -93, 6, 27, 2, -4, 7, 30, -14, -107, -4, 265, 108, -528, -406, 896, 1099, -1369, -2784, 2138, 11168, 15002, 9206, 401, -2893, -675, 1300, 580, -565, -393, 207, 216, -54, -93, 5, 27, 2,
+ -4, 7, 30, -14, -107, -4, 265, 108, -527, -407, 894, 1101, -1366, -2785, 2130, 11160, 15002, 9215, 408, -2893, -678, 1299, 582, -565, -394, 207, 217, -54, -93, 5, 27, 2, -4, 7, 30, -14, -107, -5, 265, 109, -527, -408, 893, 1102, -1363, -2786, 2122, 11152, 15003, 9224, 415, -2893, -681, 1299, 583, -564, -395, 207, 217, -54, -93, 5, 27, 2,
+ -4, 7, 30, -14, -107, -5, 265, 109, -526, -408, 892, 1103, -1360, -2788, 2114, 11145, 15004, 9232, 422, -2893, -684, 1298, 585, -564, -395, 206, 217, -54, -93, 5, 27, 2, -4, 7, 30, -14, -107, -5, 264, 110, -526, -409, 891, 1104, -1358, -2789, 2106, 11137, 15007, 9241, 428, -2894, -687, 1298, 586, -563, -396, 206, 217, -53, -93, 5, 27, 2,
+ -4, 7, 30, -13, -106, -5, 264, 110, -525, -410, 889, 1105, -1355, -2790, 2098, 11129, 15007, 9250, 435, -2894, -690, 1297, 587, -563, -397, 206, 218, -53, -93, 5, 27, 2, -4, 6, 30, -13, -106, -6, 264, 111, -525, -411, 888, 1107, -1352, -2791, 2090, 11121, 15007, 9259, 442, -2894, -693, 1297, 589, -562, -397, 205, 218, -53, -93, 5, 27, 2,
+ -4, 6, 30, -13, -106, -6, 264, 111, -524, -412, 887, 1108, -1349, -2792, 2082, 11113, 15009, 9268, 449, -2894, -696, 1296, 590, -562, -398, 205, 218, -53, -93, 5, 27, 2, -4, 6, 30, -13, -106, -6, 264, 112, -524, -413, 886, 1109, -1346, -2793, 2074, 11105, 15007, 9277, 456, -2894, -699, 1296, 592, -561, -398, 205, 218, -53, -93, 5, 27, 2,
+ -4, 6, 30, -13, -106, -6, 264, 112, -523, -413, 884, 1110, -1343, -2795, 2066, 11097, 15013, 9285, 462, -2895, -702, 1295, 593, -561, -399, 204, 219, -53, -93, 5, 27, 2, -4, 6, 30, -13, -106, -6, 263, 113, -523, -414, 883, 1111, -1340, -2796, 2058, 11089, 15013, 9294, 469, -2895, -705, 1295, 594, -560, -400, 204, 219, -52, -93, 5, 27, 2,
+ -4, 6, 30, -13, -106, -7, 263, 113, -522, -415, 882, 1113, -1337, -2797, 2050, 11081, 15015, 9303, 476, -2895, -708, 1294, 596, -560, -400, 203, 219, -52, -94, 5, 27, 2, -4, 6, 30, -13, -106, -7, 263, 114, -522, -416, 881, 1114, -1334, -2798, 2042, 11074, 15014, 9312, 483, -2895, -711, 1293, 597, -559, -401, 203, 219, -52, -94, 5, 28, 2,
+ -4, 6, 30, -13, -106, -7, 263, 114, -521, -417, 879, 1115, -1331, -2799, 2034, 11066, 15014, 9321, 490, -2895, -714, 1293, 599, -559, -402, 203, 220, -52, -94, 5, 28, 2, -4, 6, 30, -13, -106, -7, 263, 115, -521, -418, 878, 1116, -1328, -2800, 2026, 11058, 15019, 9329, 496, -2896, -717, 1292, 600, -558, -402, 202, 220, -52, -94, 4, 28, 2,
+ -4, 6, 30, -13, -106, -8, 263, 115, -520, -419, 877, 1117, -1325, -2801, 2018, 11050, 15019, 9338, 503, -2896, -720, 1292, 601, -557, -403, 202, 220, -51, -94, 4, 28, 2, -4, 6, 30, -12, -106, -8, 262, 116, -520, -419, 875, 1118, -1322, -2803, 2010, 11042, 15021, 9347, 510, -2896, -723, 1291, 603, -557, -404, 202, 220, -51, -94, 4, 28, 2,
+ -4, 6, 30, -12, -106, -8, 262, 116, -519, -420, 874, 1120, -1319, -2804, 2002, 11034, 15019, 9356, 517, -2896, -725, 1291, 604, -556, -404, 201, 220, -51, -94, 4, 28, 2, -4, 6, 30, -12, -106, -8, 262, 117, -519, -421, 873, 1121, -1316, -2805, 1995, 11026, 15018, 9365, 524, -2896, -728, 1290, 606, -556, -405, 201, 221, -51, -94, 4, 28, 2,
+ -4, 6, 30, -12, -106, -9, 262, 117, -518, -422, 872, 1122, -1313, -2806, 1987, 11018, 15019, 9373, 531, -2896, -731, 1290, 607, -555, -405, 201, 221, -51, -94, 4, 28, 2, -4, 6, 30, -12, -106, -9, 262, 118, -518, -423, 870, 1123, -1311, -2807, 1979, 11010, 15022, 9382, 538, -2896, -734, 1289, 609, -555, -406, 200, 221, -50, -94, 4, 28, 2,
+ -4, 6, 30, -12, -106, -9, 262, 118, -517, -423, 869, 1124, -1308, -2808, 1971, 11002, 15022, 9391, 545, -2897, -737, 1289, 610, -554, -407, 200, 221, -50, -94, 4, 28, 2, -4, 6, 30, -12, -106, -9, 261, 119, -517, -424, 868, 1125, -1305, -2809, 1963, 10994, 15024, 9400, 551, -2897, -740, 1288, 611, -554, -407, 200, 222, -50, -94, 4, 28, 2,
+ -4, 6, 30, -12, -106, -10, 261, 119, -516, -425, 867, 1127, -1302, -2810, 1955, 10986, 15026, 9408, 558, -2897, -743, 1287, 613, -553, -408, 199, 222, -50, -94, 4, 28, 2, -4, 6, 30, -12, -106, -10, 261, 120, -515, -426, 865, 1128, -1299, -2811, 1947, 10978, 15028, 9417, 565, -2897, -746, 1287, 614, -553, -409, 199, 222, -50, -95, 4, 28, 2,
+ -4, 6, 30, -12, -106, -10, 261, 120, -515, -427, 864, 1129, -1296, -2812, 1939, 10970, 15029, 9426, 572, -2897, -749, 1286, 616, -552, -409, 198, 222, -50, -95, 4, 28, 2, -4, 6, 30, -12, -106, -10, 261, 121, -514, -428, 863, 1130, -1293, -2813, 1931, 10962, 15027, 9435, 579, -2897, -752, 1286, 617, -552, -410, 198, 223, -49, -95, 4, 28, 2,
+ -4, 6, 30, -11, -106, -11, 261, 121, -514, -428, 861, 1131, -1290, -2814, 1923, 10954, 15029, 9443, 586, -2897, -755, 1285, 618, -551, -410, 198, 223, -49, -95, 4, 28, 2, -4, 6, 30, -11, -106, -11, 260, 122, -513, -429, 860, 1132, -1287, -2815, 1915, 10946, 15031, 9452, 593, -2897, -758, 1285, 620, -551, -411, 197, 223, -49, -95, 3, 28, 2,
+ -4, 6, 30, -11, -105, -11, 260, 122, -513, -430, 859, 1133, -1284, -2816, 1907, 10938, 15032, 9461, 600, -2897, -761, 1284, 621, -550, -412, 197, 223, -49, -95, 3, 28, 2, -4, 6, 30, -11, -105, -11, 260, 123, -512, -431, 858, 1135, -1281, -2818, 1900, 10930, 15029, 9470, 607, -2898, -764, 1283, 623, -549, -412, 197, 224, -49, -95, 3, 28, 2,
+ -4, 6, 30, -11, -105, -12, 260, 123, -512, -432, 856, 1136, -1278, -2819, 1892, 10922, 15034, 9478, 614, -2898, -767, 1283, 624, -549, -413, 196, 224, -48, -95, 3, 28, 2, -4, 6, 30, -11, -105, -12, 260, 124, -511, -432, 855, 1137, -1275, -2820, 1884, 10914, 15033, 9487, 621, -2898, -770, 1282, 625, -548, -414, 196, 224, -48, -95, 3, 28, 2,
+ -4, 6, 30, -11, -105, -12, 260, 124, -511, -433, 854, 1138, -1272, -2821, 1876, 10906, 15033, 9496, 628, -2898, -773, 1282, 627, -548, -414, 196, 224, -48, -95, 3, 28, 2, -4, 6, 30, -11, -105, -12, 259, 125, -510, -434, 852, 1139, -1269, -2822, 1868, 10898, 15035, 9505, 635, -2898, -776, 1281, 628, -547, -415, 195, 225, -48, -95, 3, 28, 2,
+ -4, 6, 30, -11, -105, -12, 259, 125, -510, -435, 851, 1140, -1266, -2823, 1860, 10890, 15037, 9513, 642, -2898, -779, 1280, 630, -547, -415, 195, 225, -48, -95, 3, 28, 2, -4, 6, 30, -11, -105, -13, 259, 126, -509, -436, 850, 1141, -1263, -2824, 1852, 10882, 15038, 9522, 648, -2898, -782, 1280, 631, -546, -416, 194, 225, -47, -95, 3, 28, 2,
+ -4, 6, 30, -11, -105, -13, 259, 126, -509, -436, 849, 1142, -1260, -2824, 1844, 10874, 15040, 9531, 655, -2898, -785, 1279, 632, -546, -417, 194, 225, -47, -96, 3, 28, 2, -4, 6, 30, -10, -105, -13, 259, 126, -508, -437, 847, 1143, -1257, -2825, 1837, 10866, 15037, 9539, 662, -2898, -788, 1279, 634, -545, -417, 194, 226, -47, -96, 3, 28, 2,
+ -4, 6, 30, -10, -105, -13, 258, 127, -508, -438, 846, 1145, -1254, -2826, 1829, 10858, 15039, 9548, 669, -2898, -791, 1278, 635, -544, -418, 193, 226, -47, -96, 3, 28, 2, -4, 6, 30, -10, -105, -14, 258, 127, -507, -439, 845, 1146, -1251, -2827, 1821, 10850, 15040, 9557, 676, -2898, -794, 1277, 637, -544, -418, 193, 226, -47, -96, 3, 28, 2,
+ -4, 6, 30, -10, -105, -14, 258, 128, -507, -440, 843, 1147, -1249, -2828, 1813, 10842, 15042, 9566, 683, -2898, -797, 1277, 638, -543, -419, 193, 226, -46, -96, 2, 28, 2, -4, 6, 30, -10, -105, -14, 258, 128, -506, -440, 842, 1148, -1246, -2829, 1805, 10834, 15045, 9574, 690, -2898, -800, 1276, 639, -543, -420, 192, 226, -46, -96, 2, 28, 2,
+ -4, 6, 30, -10, -105, -14, 258, 129, -506, -441, 841, 1149, -1243, -2830, 1797, 10826, 15042, 9583, 697, -2898, -803, 1275, 641, -542, -420, 192, 227, -46, -96, 2, 28, 3, -4, 6, 30, -10, -105, -15, 258, 129, -505, -442, 840, 1150, -1240, -2831, 1790, 10818, 15043, 9592, 704, -2898, -805, 1275, 642, -542, -421, 191, 227, -46, -96, 2, 28, 3,
+ -4, 6, 30, -10, -105, -15, 257, 130, -505, -443, 838, 1151, -1237, -2832, 1782, 10810, 15045, 9600, 712, -2898, -808, 1274, 644, -541, -422, 191, 227, -46, -96, 2, 28, 3, -4, 6, 30, -10, -105, -15, 257, 130, -504, -444, 837, 1152, -1234, -2833, 1774, 10802, 15043, 9609, 719, -2898, -811, 1274, 645, -540, -422, 191, 227, -45, -96, 2, 28, 3,
+ -4, 6, 30, -10, -105, -15, 257, 131, -503, -444, 836, 1153, -1231, -2834, 1766, 10794, 15043, 9618, 726, -2898, -814, 1273, 646, -540, -423, 190, 228, -45, -96, 2, 28, 3, -4, 6, 30, -10, -105, -15, 257, 131, -503, -445, 834, 1154, -1228, -2835, 1758, 10786, 15045, 9626, 733, -2898, -817, 1272, 648, -539, -423, 190, 228, -45, -96, 2, 28, 3,
+ -4, 5, 30, -9, -105, -16, 257, 132, -502, -446, 833, 1155, -1225, -2836, 1751, 10777, 15046, 9635, 740, -2898, -820, 1272, 649, -539, -424, 190, 228, -45, -96, 2, 28, 3, -4, 5, 30, -9, -105, -16, 256, 132, -502, -447, 832, 1156, -1222, -2837, 1743, 10769, 15049, 9644, 747, -2898, -823, 1271, 651, -538, -425, 189, 228, -45, -96, 2, 28, 3,
+ -4, 5, 30, -9, -104, -16, 256, 133, -501, -448, 830, 1157, -1219, -2837, 1735, 10761, 15049, 9652, 754, -2898, -826, 1270, 652, -538, -425, 189, 229, -45, -97, 2, 28, 3, -4, 5, 30, -9, -104, -16, 256, 133, -501, -448, 829, 1159, -1216, -2838, 1727, 10753, 15048, 9661, 761, -2898, -829, 1270, 653, -537, -426, 188, 229, -44, -97, 2, 28, 3,
+ -4, 5, 30, -9, -104, -17, 256, 134, -500, -449, 828, 1160, -1213, -2839, 1719, 10745, 15047, 9670, 768, -2898, -832, 1269, 655, -536, -426, 188, 229, -44, -97, 2, 28, 3, -4, 5, 30, -9, -104, -17, 256, 134, -500, -450, 827, 1161, -1210, -2840, 1712, 10737, 15051, 9678, 775, -2898, -835, 1268, 656, -536, -427, 188, 229, -44, -97, 1, 28, 3,
+ -4, 5, 30, -9, -104, -17, 256, 134, -499, -451, 825, 1162, -1207, -2841, 1704, 10729, 15053, 9687, 782, -2898, -838, 1268, 657, -535, -428, 187, 229, -44, -97, 1, 28, 3, -4, 5, 30, -9, -104, -17, 255, 135, -499, -451, 824, 1163, -1204, -2842, 1696, 10721, 15052, 9696, 789, -2898, -841, 1267, 659, -535, -428, 187, 230, -44, -97, 1, 28, 3,
+ -4, 5, 30, -9, -104, -18, 255, 135, -498, -452, 823, 1164, -1201, -2843, 1688, 10713, 15055, 9704, 796, -2898, -844, 1266, 660, -534, -429, 186, 230, -43, -97, 1, 28, 3, -4, 5, 30, -9, -104, -18, 255, 136, -498, -453, 821, 1165, -1198, -2843, 1681, 10704, 15053, 9713, 803, -2897, -847, 1266, 662, -533, -430, 186, 230, -43, -97, 1, 28, 3,
+ -4, 5, 30, -9, -104, -18, 255, 136, -497, -454, 820, 1166, -1195, -2844, 1673, 10696, 15053, 9722, 811, -2897, -850, 1265, 663, -533, -430, 186, 230, -43, -97, 1, 28, 3, -4, 5, 30, -9, -104, -18, 255, 137, -496, -454, 819, 1167, -1192, -2845, 1665, 10688, 15053, 9730, 818, -2897, -853, 1264, 664, -532, -431, 185, 231, -43, -97, 1, 28, 3,
+ -4, 5, 30, -8, -104, -18, 254, 137, -496, -455, 817, 1168, -1189, -2846, 1657, 10680, 15054, 9739, 825, -2897, -856, 1264, 666, -532, -431, 185, 231, -43, -97, 1, 28, 3, -4, 5, 30, -8, -104, -19, 254, 138, -495, -456, 816, 1169, -1186, -2847, 1650, 10672, 15054, 9747, 832, -2897, -859, 1263, 667, -531, -432, 185, 231, -42, -97, 1, 28, 3,
+ -4, 5, 30, -8, -104, -19, 254, 138, -495, -457, 815, 1170, -1183, -2848, 1642, 10664, 15056, 9756, 839, -2897, -862, 1262, 669, -530, -433, 184, 231, -42, -97, 1, 28, 3, -4, 5, 30, -8, -104, -19, 254, 139, -494, -458, 813, 1171, -1180, -2848, 1634, 10655, 15055, 9765, 846, -2897, -865, 1262, 670, -530, -433, 184, 232, -42, -97, 1, 28, 3,
+ -4, 5, 30, -8, -104, -19, 254, 139, -494, -458, 812, 1172, -1177, -2849, 1626, 10647, 15059, 9773, 853, -2897, -868, 1261, 671, -529, -434, 183, 232, -42, -98, 1, 28, 3, -4, 5, 30, -8, -104, -20, 253, 140, -493, -459, 811, 1173, -1174, -2850, 1619, 10639, 15059, 9782, 860, -2897, -871, 1260, 673, -529, -434, 183, 232, -42, -98, 1, 28, 3,
+ -4, 5, 30, -8, -104, -20, 253, 140, -493, -460, 810, 1174, -1171, -2851, 1611, 10631, 15058, 9791, 868, -2896, -874, 1260, 674, -528, -435, 183, 232, -41, -98, 0, 28, 3, -4, 5, 30, -8, -104, -20, 253, 140, -492, -461, 808, 1175, -1169, -2852, 1603, 10623, 15062, 9799, 875, -2896, -877, 1259, 676, -527, -436, 182, 232, -41, -98, 0, 28, 3,
+ -4, 5, 30, -8, -104, -20, 253, 141, -492, -461, 807, 1176, -1166, -2852, 1596, 10615, 15059, 9808, 882, -2896, -880, 1258, 677, -527, -436, 182, 233, -41, -98, 0, 28, 3, -4, 5, 30, -8, -104, -21, 253, 141, -491, -462, 806, 1177, -1163, -2853, 1588, 10606, 15064, 9816, 889, -2896, -883, 1257, 678, -526, -437, 181, 233, -41, -98, 0, 28, 3,
+ -4, 5, 30, -8, -103, -21, 252, 142, -490, -463, 804, 1178, -1160, -2854, 1580, 10598, 15062, 9825, 896, -2896, -886, 1257, 680, -526, -437, 181, 233, -41, -98, 0, 29, 3, -4, 5, 30, -7, -103, -21, 252, 142, -490, -464, 803, 1179, -1157, -2855, 1573, 10590, 15061, 9834, 903, -2896, -889, 1256, 681, -525, -438, 181, 233, -40, -98, 0, 29, 3,
+ -4, 5, 30, -7, -103, -21, 252, 143, -489, -464, 802, 1180, -1154, -2855, 1565, 10582, 15058, 9842, 911, -2895, -892, 1255, 682, -524, -439, 180, 234, -40, -98, 0, 29, 3, -4, 5, 30, -7, -103, -21, 252, 143, -489, -465, 800, 1181, -1151, -2856, 1557, 10574, 15059, 9851, 918, -2895, -895, 1255, 684, -524, -439, 180, 234, -40, -98, 0, 29, 3,
+ -4, 5, 30, -7, -103, -22, 252, 144, -488, -466, 799, 1182, -1148, -2857, 1550, 10565, 15062, 9859, 925, -2895, -898, 1254, 685, -523, -440, 179, 234, -40, -98, 0, 29, 3, -4, 5, 30, -7, -103, -22, 252, 144, -488, -467, 798, 1183, -1145, -2857, 1542, 10557, 15061, 9868, 932, -2895, -901, 1253, 687, -522, -440, 179, 234, -40, -98, 0, 29, 3,
+ -4, 5, 30, -7, -103, -22, 251, 145, -487, -467, 796, 1184, -1142, -2858, 1534, 10549, 15062, 9876, 939, -2895, -904, 1252, 688, -522, -441, 179, 235, -39, -98, 0, 29, 3, -4, 5, 30, -7, -103, -22, 251, 145, -487, -468, 795, 1185, -1139, -2859, 1527, 10541, 15061, 9885, 947, -2894, -907, 1252, 689, -521, -442, 178, 235, -39, -98, 0, 29, 3,
+ -4, 5, 30, -7, -103, -23, 251, 145, -486, -469, 794, 1186, -1136, -2860, 1519, 10532, 15064, 9894, 954, -2894, -910, 1251, 691, -521, -442, 178, 235, -39, -98, -1, 29, 3, -4, 5, 30, -7, -103, -23, 251, 146, -486, -470, 792, 1187, -1133, -2860, 1511, 10524, 15068, 9902, 961, -2894, -913, 1250, 692, -520, -443, 177, 235, -39, -99, -1, 29, 3,
+ -4, 5, 30, -7, -103, -23, 251, 146, -485, -470, 791, 1188, -1130, -2861, 1504, 10516, 15064, 9911, 968, -2894, -915, 1249, 693, -519, -443, 177, 235, -38, -99, -1, 29, 3, -4, 5, 30, -7, -103, -23, 250, 147, -484, -471, 790, 1189, -1127, -2862, 1496, 10508, 15063, 9919, 976, -2894, -918, 1249, 695, -519, -444, 177, 236, -38, -99, -1, 29, 3,
+ -4, 5, 30, -7, -103, -23, 250, 147, -484, -472, 788, 1190, -1124, -2862, 1488, 10499, 15066, 9928, 983, -2893, -921, 1248, 696, -518, -445, 176, 236, -38, -99, -1, 29, 3, -4, 5, 30, -6, -103, -24, 250, 148, -483, -472, 787, 1191, -1121, -2863, 1481, 10491, 15063, 9936, 990, -2893, -924, 1247, 698, -517, -445, 176, 236, -38, -99, -1, 29, 3,
+ -4, 5, 30, -6, -103, -24, 250, 148, -483, -473, 786, 1192, -1118, -2864, 1473, 10483, 15067, 9945, 997, -2893, -927, 1246, 699, -517, -446, 175, 236, -38, -99, -1, 29, 3, -4, 5, 30, -6, -103, -24, 250, 149, -482, -474, 784, 1193, -1115, -2864, 1466, 10475, 15062, 9953, 1005, -2893, -930, 1246, 700, -516, -446, 175, 237, -37, -99, -1, 29, 3,
+ -4, 5, 30, -6, -103, -24, 249, 149, -482, -475, 783, 1194, -1112, -2865, 1458, 10466, 15065, 9962, 1012, -2892, -933, 1245, 702, -516, -447, 175, 237, -37, -99, -1, 29, 3, -4, 5, 30, -6, -103, -25, 249, 150, -481, -475, 782, 1195, -1109, -2866, 1450, 10458, 15067, 9970, 1019, -2892, -936, 1244, 703, -515, -448, 174, 237, -37, -99, -1, 29, 3,
+ -4, 5, 30, -6, -102, -25, 249, 150, -480, -476, 780, 1196, -1106, -2866, 1443, 10450, 15064, 9979, 1026, -2892, -939, 1243, 705, -514, -448, 174, 237, -37, -99, -1, 29, 3, -4, 5, 30, -6, -102, -25, 249, 150, -480, -477, 779, 1196, -1103, -2867, 1435, 10441, 15067, 9988, 1034, -2891, -942, 1243, 706, -514, -449, 173, 237, -37, -99, -1, 29, 3,
+ -4, 5, 29, -6, -102, -25, 249, 151, -479, -478, 778, 1197, -1100, -2867, 1428, 10433, 15064, 9996, 1041, -2891, -945, 1242, 707, -513, -449, 173, 238, -36, -99, -1, 29, 3, -4, 5, 29, -6, -102, -25, 248, 151, -479, -478, 776, 1198, -1097, -2868, 1420, 10425, 15067, 10005, 1048, -2891, -948, 1241, 709, -512, -450, 173, 238, -36, -99, -2, 29, 3,
+ -4, 5, 29, -6, -102, -26, 248, 152, -478, -479, 775, 1199, -1094, -2869, 1413, 10417, 15069, 10013, 1056, -2891, -951, 1240, 710, -512, -451, 172, 238, -36, -99, -2, 29, 3, -4, 4, 29, -6, -102, -26, 248, 152, -478, -480, 774, 1200, -1091, -2869, 1405, 10408, 15068, 10022, 1063, -2890, -954, 1240, 711, -511, -451, 172, 238, -36, -99, -2, 29, 4,
+ -4, 4, 29, -5, -102, -26, 248, 153, -477, -480, 772, 1201, -1088, -2870, 1397, 10400, 15068, 10030, 1070, -2890, -957, 1239, 713, -510, -452, 171, 238, -36, -99, -2, 29, 4, -4, 4, 29, -5, -102, -26, 248, 153, -477, -481, 771, 1202, -1085, -2871, 1390, 10392, 15067, 10039, 1078, -2890, -960, 1238, 714, -510, -452, 171, 239, -35, -100, -2, 29, 4,
+ -4, 4, 29, -5, -102, -27, 247, 153, -476, -482, 770, 1203, -1082, -2871, 1382, 10383, 15070, 10047, 1085, -2889, -963, 1237, 715, -509, -453, 171, 239, -35, -100, -2, 29, 4, -4, 4, 29, -5, -102, -27, 247, 154, -475, -483, 768, 1204, -1079, -2872, 1375, 10375, 15069, 10056, 1092, -2889, -966, 1236, 717, -508, -453, 170, 239, -35, -100, -2, 29, 4,
+ -4, 4, 29, -5, -102, -27, 247, 154, -475, -483, 767, 1205, -1076, -2872, 1367, 10367, 15069, 10064, 1100, -2889, -969, 1236, 718, -508, -454, 170, 239, -35, -100, -2, 29, 4, -4, 4, 29, -5, -102, -27, 247, 155, -474, -484, 766, 1206, -1073, -2873, 1360, 10358, 15067, 10073, 1107, -2888, -972, 1235, 720, -507, -455, 169, 240, -35, -100, -2, 29, 4,
+ -4, 4, 29, -5, -102, -27, 247, 155, -474, -485, 764, 1207, -1070, -2873, 1352, 10350, 15068, 10081, 1114, -2888, -975, 1234, 721, -506, -455, 169, 240, -34, -100, -2, 29, 4, -4, 4, 29, -5, -102, -28, 246, 156, -473, -485, 763, 1208, -1067, -2874, 1345, 10342, 15070, 10089, 1122, -2888, -978, 1233, 722, -506, -456, 168, 240, -34, -100, -2, 29, 4,
+ -4, 4, 29, -5, -102, -28, 246, 156, -473, -486, 762, 1208, -1064, -2874, 1337, 10333, 15070, 10098, 1129, -2887, -981, 1232, 724, -505, -456, 168, 240, -34, -100, -2, 29, 4, -4, 4, 29, -5, -102, -28, 246, 157, -472, -487, 760, 1209, -1061, -2875, 1330, 10325, 15072, 10106, 1136, -2887, -984, 1232, 725, -505, -457, 168, 240, -34, -100, -3, 29, 4,
+ -4, 4, 29, -5, -102, -28, 246, 157, -471, -487, 759, 1210, -1058, -2876, 1322, 10317, 15069, 10115, 1144, -2886, -987, 1231, 726, -504, -458, 167, 241, -33, -100, -3, 29, 4, -4, 4, 29, -5, -102, -29, 246, 157, -471, -488, 758, 1211, -1056, -2876, 1315, 10308, 15071, 10123, 1151, -2886, -990, 1230, 728, -503, -458, 167, 241, -33, -100, -3, 29, 4,
+ -4, 4, 29, -4, -101, -29, 245, 158, -470, -489, 756, 1212, -1053, -2877, 1307, 10300, 15073, 10132, 1158, -2886, -993, 1229, 729, -503, -459, 166, 241, -33, -100, -3, 29, 4, -4, 4, 29, -4, -101, -29, 245, 158, -470, -490, 755, 1213, -1050, -2877, 1300, 10292, 15071, 10140, 1166, -2885, -996, 1228, 730, -502, -459, 166, 241, -33, -100, -3, 29, 4,
+ -4, 4, 29, -4, -101, -29, 245, 159, -469, -490, 754, 1214, -1047, -2878, 1292, 10283, 15069, 10149, 1173, -2885, -999, 1227, 732, -501, -460, 166, 242, -33, -100, -3, 29, 4, -4, 4, 29, -4, -101, -29, 245, 159, -469, -491, 752, 1215, -1044, -2878, 1285, 10275, 15070, 10157, 1181, -2885, -1002, 1227, 733, -501, -461, 165, 242, -32, -100, -3, 29, 4,
+ -4, 4, 29, -4, -101, -30, 244, 160, -468, -492, 751, 1215, -1041, -2879, 1277, 10266, 15072, 10166, 1188, -2884, -1005, 1226, 735, -500, -461, 165, 242, -32, -101, -3, 29, 4, -4, 4, 29, -4, -101, -30, 244, 160, -467, -492, 749, 1216, -1038, -2879, 1270, 10258, 15073, 10174, 1195, -2884, -1008, 1225, 736, -499, -462, 164, 242, -32, -101, -3, 29, 4,
+ -4, 4, 29, -4, -101, -30, 244, 160, -467, -493, 748, 1217, -1035, -2880, 1262, 10250, 15073, 10182, 1203, -2883, -1011, 1224, 737, -498, -462, 164, 242, -32, -101, -3, 29, 4, -4, 4, 29, -4, -101, -30, 244, 161, -466, -494, 747, 1218, -1032, -2880, 1255, 10241, 15072, 10191, 1210, -2883, -1014, 1223, 739, -498, -463, 163, 243, -32, -101, -3, 29, 4,
+ -4, 4, 29, -4, -101, -30, 244, 161, -466, -494, 745, 1219, -1029, -2881, 1247, 10233, 15071, 10199, 1218, -2882, -1017, 1222, 740, -497, -463, 163, 243, -31, -101, -3, 29, 4, -4, 4, 29, -4, -101, -31, 243, 162, -465, -495, 744, 1220, -1026, -2881, 1240, 10224, 15072, 10208, 1225, -2882, -1020, 1222, 741, -496, -464, 163, 243, -31, -101, -4, 29, 4,
+ 0, 4, 29, -4, -101, -31, 243, 162, -465, -496, 743, 1221, -1023, -2881, 1232, 10215, 15072, 10215, 1232, -2881, -1023, 1221, 743, -496, -465, 162, 243, -31, -101, -4, 29, 4,
+};
+
@@ -3,6 +3,13 @@
 
 #include "player/sndfile.h"
 
+/* The chip emulators share their lookup tables, which are set up by the
+ * first chip that gets created. Each song creates its own chip on whichever
+ * thread renders it, so this creates the mutex that keeps two of them from
+ * doing that at once; call it at startup, before any song is played. */
+int Fmdrv_InitLock(void);
+void Fmdrv_QuitLock(void);
+
 void Fmdrv_Init(song_t *csf, int32_t mixfreq);
 void Fmdrv_Mix(song_t *csf, uint32_t count);
 
@@ -33,14 +33,21 @@
 #define MAX_INTERPOLATION_LOOKAHEAD 4
 #define MAX_INTERPOLATION_LOOKAHEAD_BUFFER_SIZE 16 /* Borrowed from OpenMPT */
 #define MAX_SAMPLING_POINT_SIZE 4
+/* forward loops up to this long get unrolled after the sample data, so
+ * the mixer can play through lots of them without stopping at every wrap */
+#define MAX_UNROLLED_LOOP_LENGTH 256
+#define UNROLLED_LOOP_BUFFER_SIZE 1024 /* in sampling points, plus the lookahead on both sides */
 
 #define MAX_MIDI_CHANNELS       16
 #define MAX_MIDI_MACRO          32
 
-#define MAX_VOICES              256
+/* the voices are allocated per song; the first MAX_CHANNELS of them are
+ * the pattern channels, and the rest are for NNA */
+#define DEFAULT_VOICES          256
+#define MAX_VOICES              1024
 
 #define MIX_MAX_CHANNELS		2 /* used for filters and stuff */
-#define MIXBUFFERSIZE           512
+#define MIXBUFFERSIZE           512 // default block size, see csf_set_mix_buffer_size
 
 
 #define CHN_16BIT               0x01 // 16-bit sample
@@ -242,13 +249,16 @@
 #define SNDMIX_NOSURROUND       0x200000 // ignore S91
 //#define SNDMIX_NOMIXING       0x400000
 #define SNDMIX_NORAMPING        0x800000 // don't apply ramping on volume change (causes clicks)
-#define SNDMIX_CALCLENGTH       0x1000000 // length calculation optimizations (i.e. no instrument/note change)
+//#define SNDMIX_CALCLENGTH     0x1000000 // length calculation optimizations (i.e. no instrument/note change)
+#define SNDMIX_FLOATMIX         0x2000000 // post-mix processing in float, csf_read outputs 32-bit float (needs 32 bits/sample)
+#define SNDMIX_NATIVEOPL        0x4000000 // run the OPL at its own rate and resample the output (takes effect on csf_init_player)
 
 enum {
 	SRCMODE_NEAREST,
 	SRCMODE_LINEAR,
 	SRCMODE_SPLINE,
 	SRCMODE_POLYPHASE,
+	SRCMODE_SINC,
 	NUM_SRC_MODES
 };
 
@@ -523,8 +533,12 @@ typedef struct song_instrument {
 // variables are used for - are all of them *really* necessary?)
 // (TODO also the majority of this is irrelevant outside of the "main" MAX_CHANNELS channels;
 // this struct should really only be holding the stuff actually needed for mixing)
-typedef struct song_voice {
-	// First 32-bytes: Most used mixing information: don't change it
+typedef struct SCHISM_ALIGNED(64) song_voice {
+	// Everything the mixer uses is up here, so that mixing a voice only has
+	// to touch the first 128 bytes of it (two cache lines on 64-bit, since
+	// the voices are aligned to 64). Keep anything the mixer doesn't need
+	// out of this part. (master_channel is the one exception; the mixer only
+	// reads it when writing each channel out separately.)
 	signed char * current_sample_data;
 	struct song_smp_pos position;
 	struct song_smp_pos increment;
@@ -532,15 +546,12 @@ typedef struct song_voice {
 	int32_t left_volume; // volume of the right channel
 	int32_t right_ramp; // amount to ramp the left channel
 	int32_t left_ramp; // amount to ramp the right channel
-	// 2nd cache line
 	uint32_t length; // only to the end of the loop
 	uint32_t flags;
-	uint32_t old_flags;
 	uint32_t loop_start; // loop or sustain, whichever is active
 	uint32_t loop_end;
 	int32_t right_ramp_volume; // ?
 	int32_t left_ramp_volume; // ?
-	int32_t strike; // decremented to zero. this affects how long the initial hit on the playback marks lasts (bigger dot in instrument and sample list windows)
 
 	//int32_t filter_y1, filter_y2, filter_y3, filter_y4;
 	//int32_t filter_a0, filter_b0, filter_b1;
@@ -550,19 +561,23 @@ typedef struct song_voice {
 	int32_t rofs, lofs; // ?
 	int32_t ramp_length;
 	uint32_t vu_meter; // moved this up -paper
-	// Information not used in the mixer
 	int32_t right_volume_new, left_volume_new; // ?
+	int32_t fadeout_volume;
+	song_sample_t *ptr_sample;              // (see ptr_instrument)
+
+	// Information not used in the mixer
+	uint32_t old_flags;
+	int32_t strike; // decremented to zero. this affects how long the initial hit on the playback marks lasts (bigger dot in instrument and sample list windows)
 	int32_t final_volume; // range 0-16384 (?), accounting for sample+channel+global+etc. volumes
 	int32_t final_panning; // range 0-256 (but can temporarily exceed that range during calculations)
 	int32_t volume, panning; // range 0-256 (?); these are the current values set for the channel
 	int32_t calc_volume; // calculated volume for midi macros
-	int32_t fadeout_volume;
 	int32_t frequency;
 	int32_t c5speed;
 	int32_t sample_freq; // only used on the info page (F5)
 	int32_t portamento_target;
-	song_instrument_t *ptr_instrument;      // these two suck, and should
-	song_sample_t *ptr_sample;              // be replaced with numbers
+	song_instrument_t *ptr_instrument;      // this and ptr_sample suck, and
+	                                        // should be replaced with numbers
 	int32_t vol_env_position;
 	int32_t pan_env_position;
 	int32_t pitch_env_position;
@@ -622,6 +637,9 @@ typedef struct song_voice {
 	uint32_t active_macro, last_instrument;
 } song_voice_t;
 
+/* this should be the first thing past what the mixer uses */
+#define SONG_VOICE_MIX_END offsetof(song_voice_t, old_flags)
+
 typedef struct song_channel {
 	uint32_t panning;
 	uint32_t volume;
@@ -734,14 +752,27 @@ struct multi_write {
 	/* this is optimization for channels that haven't had any data yet
 	(nothing to convert/write, just seek ahead in the data stream) */
 	void (*silence)(void *data, long bytes);
-	int32_t buffer[MIXBUFFERSIZE * 2];
+	int32_t *buffer; // mix_buffer_size * 2
 };
 
-typedef struct song {
-	int32_t mix_buffer[MIXBUFFERSIZE * 2];
+// one band of the output equalizer, see equalizer.c
+typedef struct song_eq_band {
+	float a0, a1, a2, b1, b2;
+	float x1, x2, y1, y2;
+	float gain, center_frequency;
+	int enabled;
+} song_eq_band_t;
 
-	song_voice_t voices[MAX_VOICES];                // Channels
-	uint32_t voice_mix[MAX_VOICES];                 // Channels to be mixed
+typedef struct song {
+	int32_t *mix_buffer;                            // mix_buffer_size * 2
+	float *mix_buffer_float;                        // mix_buffer_size * 2, only used with SNDMIX_FLOATMIX
+	uint32_t mix_buffer_size;                       // frames mixed at a time at most
+
+	song_voice_t *voices;                           // Channels (voice_count of them)
+	void *voice_alloc;                              // what voices was allocated as
+	uint32_t *voice_mix;                            // Channels to be mixed
+	uint32_t *busy_voices;                          // Bitarray of NNA voices that may still be playing
+	uint32_t voice_count;                           // see csf_set_voice_count
 	song_sample_t samples[MAX_SAMPLES+1];           // Samples (1-based!)
 	song_instrument_t *instruments[MAX_INSTRUMENTS+1]; // Instruments (1-based!)
 	song_channel_t channels[MAX_CHANNELS];          // Channel settings
@@ -757,6 +788,7 @@ typedef struct song {
 	uint32_t pan_separation;
 	uint32_t num_voices; // how many are currently playing. (POTENTIALLY larger than global max_voices)
 	uint32_t mix_stat; // number of channels being mixed (not really used)
+	uint32_t mix_skipped; // how many of those were silent and only got moved ahead
 	uint32_t last_moved_channel; // Compat Gxx + carry + porta bug emulation
 	uint32_t buffer_count; // number of samples to mix per tick
 	uint32_t tick_count;
@@ -807,6 +839,10 @@ typedef struct song {
 	uint32_t vu_right;
 	int32_t dry_rofs_vol; // un-globalized, didn't care enough
 	int32_t dry_lofs_vol; // to find out what these do  -paper
+
+	song_eq_band_t eq[MAX_EQ_BANDS * 2]; // left bands, then right bands
+	struct song_filter_cache *filter_cache; // resonant filter coefficients for mix_frequency, or NULL
+	uint32_t master_volume_left, master_volume_right; // 0-31, not applied with SNDMIX_DIRECTTODISK
 	// -----------------------------------------------------------------------
 
 	// OPL stuff -------------------------------------------------------------
@@ -817,15 +853,16 @@ typedef struct song {
 
 	const unsigned char *opl_dtab[OPL_CHANNELS];
 	unsigned char opl_keyontab[OPL_CHANNELS];
-	int32_t opl_pans[MAX_VOICES];
+	int32_t *opl_pans; // voice_count
 
 	int32_t opl_to_chan[OPL_CHANNELS];
-	int32_t opl_from_chan[MAX_VOICES];
+	int32_t *opl_from_chan; // voice_count
+	struct stream_resampler *opl_resampler; // OPL_CHANNELS, only when the chip runs at its native rate
 	// -----------------------------------------------------------------------
 
 	// MIDI stuff ------------------------------------------------------------
 	/* This maps S3M concepts into MIDI concepts */
-	song_s3m_channel_info_t midi_s3m_chans[MAX_VOICES];
+	song_s3m_channel_info_t *midi_s3m_chans; // voice_count
 	/* This helps reduce the MIDI traffic, also does some encapsulation */
 	song_midi_state_t midi_chans[MAX_MIDI_CHANNELS];
 	double midi_last_song_counter;
@@ -856,10 +893,8 @@ typedef struct song {
 	// noise reduction filter
 	int32_t left_nr, right_nr;
 
-	// chaseback
-	int stop_at_order;
-	int stop_at_row;
-	unsigned int stop_at_time;
+	// saved player state for csf_get_length and friends, or NULL
+	struct song_seek_index *seek_index;
 
 	// multi-write stuff -- NULL if no multi-write is in progress, else array of one struct per channel
 	struct multi_write *multi_write;
@@ -907,9 +942,15 @@ void csf_set_instrument_panning(song_t *csf, song_voice_t *chan, song_instrument
 
 int csf_set_wave_config(song_t *csf, uint32_t rate, uint32_t bits, uint32_t channels);
 
+// Mix buffers; a size of 0 frees them
+int csf_set_mix_buffer_size(song_t *csf, uint32_t frames);
+int csf_alloc_multi_write(song_t *csf);
+void csf_free_multi_write(song_t *csf);
+
 // Mixer Config
 int32_t csf_init_player(song_t *csf, int reset); // bReset=false
 int csf_set_resampling_mode(song_t *csf, uint32_t mode); // SRCMODE_XXXX
+int csf_set_mix_threads(uint32_t nthreads); // 0 or 1 mixes all voices on the calling thread
 
 // Initialize MIDI callback
 void csf_init_midi(song_t *csf, song_midi_out_raw_spec_t midi_out_raw);
@@ -921,6 +962,10 @@ int32_t csf_read_note(song_t *csf);
 
 // snd_fx
 uint32_t csf_get_length(song_t *csf); // (in seconds)
+uint32_t csf_get_length_to(song_t *csf, uint32_t order, uint32_t row); // (in seconds)
+void csf_get_position_at(song_t *csf, uint32_t seconds, uint32_t *order, uint32_t *row);
+void csf_free_seek_index(song_t *csf);
+void csf_free_filter_cache(song_t *csf);
 void csf_instrument_change(song_t *csf, song_voice_t *chn, uint32_t instr, int porta, int instr_column);
 void csf_note_change(song_t *csf, uint32_t chan, int note, int porta, int retrig, int have_inst);
 uint32_t csf_get_nna_channel(song_t *csf, uint32_t chan);
@@ -948,6 +993,19 @@ uint32_t calc_halftone(uint32_t hz, int32_t rel);
 song_t *csf_allocate(void);
 void csf_free(song_t *csf);
 
+/* changes how many voices the song has (clamped to MAX_CHANNELS..MAX_VOICES).
+ * voices past the new count are dropped; the audio must be locked. */
+void csf_set_voice_count(song_t *csf, uint32_t count);
+/* for a song_t that was memcpy'd from another one: gives it its own copy
+ * of everything on the heap that the mixer changes, so that the two can
+ * play independently. patterns, samples and instruments stay shared.
+ * every new per-song allocation needs to be handled in here! */
+void csf_unshare(song_t *csf);
+/* frees what csf_unshare (and playing the song since) allocated, and
+ * leaves the shared data alone */
+void csf_free_unshared(song_t *csf);
+void csf_free_voices(song_t *csf);
+
 void csf_destroy(song_t *csf); /* erase everything -- equiv. to new song */
 int csf_destroy_sample(song_t *csf, uint32_t smpnum);
 void csf_precompute_sample_loops(song_sample_t *smp);
@@ -48,6 +48,8 @@ extern uint32_t max_channels_used;
 struct audio_settings {
 	int sample_rate, bits, channels, buffer_size;
 	int channel_limit, interpolation_mode;
+	int voice_limit; /* total voices per song, including the ones for NNA */
+	int mix_threads;
 
 	struct {
 		int left;
@@ -59,6 +61,7 @@ struct audio_settings {
 	unsigned int eq_freq[4];
 	unsigned int eq_gain[4];
 	int no_ramping;
+	int native_opl; /* run the OPL at its own rate and resample it */
 };
 
 extern struct audio_settings audio_settings;
@@ -137,6 +140,9 @@ const char *fmt_strerror(int n);
 
 int song_save(const char *file, const char *type); // IT, S3M
 int song_export(const char *file, const char *type); // WAV
+// render a batch of songs to separate files, 'jobs' at a time. any %s in
+// 'file' gets replaced by each song's name. returns the number that failed
+int song_export_batch(char *const *files, int nfiles, const char *file, const char *type, int jobs);
 
 /* 'num' is only for status text feedback -- all of the sample's data is taken from 'smp'.
 this provides an eventual mechanism for saving samples modified from disk (not yet implemented) */
@@ -270,7 +276,8 @@ int audio_has_control_panel(void);
 void audio_open_control_panel(void);
 
 /* eq */
-void song_init_eq(int do_reset, uint32_t mix_freq);
+void song_init_eq(song_t *csf, int do_reset);
+void song_init_mix_settings(song_t *csf);
 
 /* --------------------------------------------------------------------- */
 /* playback */
@@ -341,6 +348,7 @@ int song_toggle_orderlist_locked(void);
 
 int song_get_playing_channels(void);
 int song_get_max_channels(void);
+int song_get_silent_voices(void); /* how many of the playing channels were silent */
 
 void song_get_vu_meter(int *left, int *right);
 
@@ -198,6 +198,41 @@ TEST_FUNC(test_mem_xor)
 
 TEST_FUNC(test_disko_mem)
 
+TEST_FUNC(test_fmt_detect)
+
+#ifdef USE_THREADS
+TEST_FUNC(test_midi_out_ring)
+#endif
+
+TEST_FUNC(test_mixer_block_size)
+TEST_FUNC(test_mixer_concurrent_songs)
+TEST_FUNC(test_mixer_filter_cache)
+TEST_FUNC(test_mixer_eq_stereo)
+TEST_FUNC(test_mixer_eq_stereo_speed)
+TEST_FUNC(test_mixer_clip)
+TEST_FUNC(test_mixer_nna_voices)
+TEST_FUNC(test_mixer_voice_count)
+TEST_FUNC(test_mixer_many_voices)
+TEST_FUNC(test_mixer_sinc)
+TEST_FUNC(test_mixer_silent_voices)
+TEST_FUNC(test_mixer_unrolled_loops)
+TEST_FUNC(test_mixer_native_opl)
+TEST_FUNC(test_mixer_export_native_opl)
+#if OPLSOURCE == 3
+TEST_FUNC(test_mixer_opl3_blocks)
+#endif
+TEST_FUNC(test_mixer_kernels)
+TEST_FUNC(test_mixer_export_pipelined)
+TEST_FUNC(test_mixer_export_multi_threads)
+TEST_FUNC(test_mixer_export_batch)
+
+TEST_FUNC(test_timer_oneshot_many)
+
+TEST_FUNC(test_song_length_index)
+TEST_FUNC(test_song_length_edit)
+TEST_FUNC(test_song_length_playback)
+TEST_FUNC(test_song_length_note_map)
+
 #define TEST_FUNC_BLIT(x) \
 	TEST_FUNC(x) \
 	TEST_FUNC(x##_overflow)
@@ -0,0 +1,36 @@
+/*
+ * Schism Tracker - a cross-platform Impulse Tracker clone
+ * copyright (c) 2003-2005 Storlek <storlek@rigelseven.com>
+ * copyright (c) 2005-2008 Mrs. Brisby <mrs.brisby@nimh.org>
+ * copyright (c) 2009 Storlek & Mrs. Brisby
+ * copyright (c) 2010-2012 Storlek
+ * URL: http://schismtracker.org/
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef SCHISM_TEST_MIXER_H_
+#define SCHISM_TEST_MIXER_H_
+
+#include "headers.h"
+
+#include "player/sndfile.h"
+
+/* a song that plays one note of 'smp' (copied into sample 1, and freed
+ * along with the song) on the first row, set up for rendering with
+ * csf_read; see test/cases/mixer.c */
+song_t *mixer_test_one_note_song(const song_sample_t *smp, uint32_t mode);
+
+#endif /* SCHISM_TEST_MIXER_H_ */
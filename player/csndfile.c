@@ -75,8 +75,9 @@ static void _csf_reset(song_t *csf)
 	csf->mix_bits_per_sample = 8;
 	csf->mix_channels = 1;
 
-	memset(csf->voices, 0, sizeof(csf->voices));
-	memset(csf->voice_mix, 0, sizeof(csf->voice_mix));
+	memset(csf->voices, 0, csf->voice_count * sizeof(*csf->voices));
+	memset(csf->voice_mix, 0, csf->voice_count * sizeof(*csf->voice_mix));
+	memset(csf->busy_voices, 0, (csf->voice_count + 31) / 32 * sizeof(*csf->busy_voices));
 	memset(csf->samples, 0, sizeof(csf->samples));
 	memset(csf->instruments, 0, sizeof(csf->instruments));
 	memset(csf->orderlist, 0xFF, sizeof(csf->orderlist));
@@ -124,7 +125,11 @@ static void _csf_reset(song_t *csf)
 song_t *csf_allocate(void)
 {
 	song_t *csf = mem_calloc(1, sizeof(song_t));
+	csf_set_voice_count(csf, DEFAULT_VOICES);
 	_csf_reset(csf);
+	csf->master_volume_left = csf->master_volume_right = 31;
+	SCHISM_RUNTIME_ASSERT(csf_set_mix_buffer_size(csf, MIXBUFFERSIZE),
+		"Failed to allocate mix buffers.");
 	return csf;
 }
 
@@ -132,10 +137,213 @@ void csf_free(song_t *csf)
 {
 	if (csf) {
 		csf_destroy(csf);
+		csf_set_mix_buffer_size(csf, 0);
+		csf_free_filter_cache(csf);
+		csf_free_voices(csf);
 		free(csf);
 	}
 }
 
+#define VOICE_ALIGN 64
+
+/* Replaces the voice arrays with ones big enough for 'count' voices. As many
+ * of the voices as fit are copied over; the old arrays are left alone. */
+static void _csf_alloc_voices(song_t *csf, uint32_t count)
+{
+	const uint32_t keep = MIN(count, csf->voice_count);
+	const uint32_t words = (count + 31) / 32;
+	uint32_t i;
+
+	/* the voices should start on a cache line (see song_voice_t), and
+	 * malloc doesn't promise that */
+	unsigned char *voice_alloc = mem_calloc(1, count * sizeof(song_voice_t) + VOICE_ALIGN - 1);
+	song_voice_t *voices = (song_voice_t *)(voice_alloc
+		+ (VOICE_ALIGN - (uintptr_t)voice_alloc % VOICE_ALIGN) % VOICE_ALIGN);
+	uint32_t *voice_mix = mem_calloc(count, sizeof(*voice_mix));
+	uint32_t *busy_voices = mem_calloc(words, sizeof(*busy_voices));
+	int32_t *opl_pans = mem_calloc(count, sizeof(*opl_pans));
+	int32_t *opl_from_chan = mem_calloc(count, sizeof(*opl_from_chan));
+	song_s3m_channel_info_t *midi_s3m_chans = mem_calloc(count, sizeof(*midi_s3m_chans));
+
+	if (keep) {
+		memcpy(voices, csf->voices, keep * sizeof(*voices));
+		memcpy(voice_mix, csf->voice_mix, keep * sizeof(*voice_mix));
+		memcpy(busy_voices, csf->busy_voices, MIN(words, (csf->voice_count + 31) / 32) * sizeof(*busy_voices));
+		memcpy(opl_pans, csf->opl_pans, keep * sizeof(*opl_pans));
+		memcpy(opl_from_chan, csf->opl_from_chan, keep * sizeof(*opl_from_chan));
+		memcpy(midi_s3m_chans, csf->midi_s3m_chans, keep * sizeof(*midi_s3m_chans));
+
+		/* don't keep any busy bits past the end */
+		if (count & 31)
+			busy_voices[words - 1] &= (UINT32_C(1) << (count & 31)) - 1;
+	}
+
+	/* new voices don't have an OPL channel. (a brand new song gets
+	 * these set by OPL_Reset anyway) */
+	for (i = keep; i < count && keep; i++)
+		opl_from_chan[i] = -1;
+
+	csf->voice_alloc = voice_alloc;
+	csf->voices = voices;
+	csf->voice_mix = voice_mix;
+	csf->busy_voices = busy_voices;
+	csf->opl_pans = opl_pans;
+	csf->opl_from_chan = opl_from_chan;
+	csf->midi_s3m_chans = midi_s3m_chans;
+	csf->voice_count = count;
+}
+
+void csf_set_voice_count(song_t *csf, uint32_t count)
+{
+	void *voice_alloc = csf->voice_alloc;
+	uint32_t *voice_mix = csf->voice_mix;
+	uint32_t *busy_voices = csf->busy_voices;
+	int32_t *opl_pans = csf->opl_pans;
+	int32_t *opl_from_chan = csf->opl_from_chan;
+	song_s3m_channel_info_t *midi_s3m_chans = csf->midi_s3m_chans;
+	uint32_t i;
+
+	count = CLAMP(count, MAX_CHANNELS, MAX_VOICES);
+	if (count == csf->voice_count)
+		return;
+
+	/* stop anything the dropped voices had going on outside of the mixer */
+	for (i = count; i < csf->voice_count; i++) {
+		GM_KeyOff(csf, i);
+
+		if (csf->opl && csf->opl_from_chan[i] >= 0) {
+			OPL_NoteOff(csf, i);
+			csf->opl_to_chan[csf->opl_from_chan[i]] = -1;
+		}
+	}
+
+	if (count < csf->voice_count) {
+		/* the mix list gets rebuilt on the next tick */
+		csf->num_voices = 0;
+		if (csf->last_moved_channel >= count)
+			csf->last_moved_channel = MAX_VOICES;
+	}
+
+	_csf_alloc_voices(csf, count);
+
+	free(voice_alloc);
+	free(voice_mix);
+	free(busy_voices);
+	free(opl_pans);
+	free(opl_from_chan);
+	free(midi_s3m_chans);
+}
+
+void csf_unshare(song_t *csf)
+{
+	/* these all get allocated again when they're needed */
+	csf->mix_buffer = NULL;
+	csf->mix_buffer_float = NULL;
+	csf->mix_buffer_size = 0;
+	csf->multi_write = NULL;
+	csf->seek_index = NULL;
+	csf->filter_cache = NULL;
+
+	/* !!! FIXME: We should not be messing with this stuff here! */
+	csf->opl = NULL; /* Prevent the original song's OPL being closed */
+	csf->opl_resampler = NULL; /* or its resamplers being set to our rate */
+
+	/* the voices are carried over, so that whatever's playing keeps going */
+	_csf_alloc_voices(csf, csf->voice_count);
+}
+
+void csf_free_unshared(song_t *csf)
+{
+	OPL_Close(csf);
+	csf_free_multi_write(csf);
+	csf_free_seek_index(csf);
+	csf_set_mix_buffer_size(csf, 0);
+	csf_free_filter_cache(csf);
+	csf_free_voices(csf);
+}
+
+void csf_free_voices(song_t *csf)
+{
+	free(csf->voice_alloc);
+	free(csf->voice_mix);
+	free(csf->busy_voices);
+	free(csf->opl_pans);
+	free(csf->opl_from_chan);
+	free(csf->midi_s3m_chans);
+
+	csf->voice_alloc = NULL;
+	csf->voices = NULL;
+	csf->voice_mix = NULL;
+	csf->busy_voices = NULL;
+	csf->opl_pans = NULL;
+	csf->opl_from_chan = NULL;
+	csf->midi_s3m_chans = NULL;
+	csf->voice_count = 0;
+}
+
+/* Larger blocks mean fewer trips through the per-voice setup in the mixer
+ * (csf_read never mixes across a tick boundary though, so anything bigger
+ * than a tick is wasted), smaller ones mean less latency. */
+int csf_set_mix_buffer_size(song_t *csf, uint32_t frames)
+{
+	int32_t *mix_buffer = NULL;
+	float *mix_buffer_float = NULL;
+
+	if (frames) {
+		mix_buffer = calloc(frames * 2, sizeof(*mix_buffer));
+		mix_buffer_float = calloc(frames * 2, sizeof(*mix_buffer_float));
+		if (!mix_buffer || !mix_buffer_float) {
+			free(mix_buffer);
+			free(mix_buffer_float);
+			return 0;
+		}
+	}
+
+	free(csf->mix_buffer);
+	free(csf->mix_buffer_float);
+
+	csf->mix_buffer = mix_buffer;
+	csf->mix_buffer_float = mix_buffer_float;
+	csf->mix_buffer_size = frames;
+
+	return 1;
+}
+
+/* allocates one multi-write output for every channel; the caller
+ * still has to fill in data/write/silence */
+int csf_alloc_multi_write(song_t *csf)
+{
+	uint32_t n;
+
+	csf->multi_write = calloc(MAX_CHANNELS, sizeof(*csf->multi_write));
+	if (!csf->multi_write)
+		return 0;
+
+	for (n = 0; n < MAX_CHANNELS; n++) {
+		csf->multi_write[n].buffer = calloc(csf->mix_buffer_size * 2, sizeof(int32_t));
+		if (!csf->multi_write[n].buffer) {
+			csf_free_multi_write(csf);
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+void csf_free_multi_write(song_t *csf)
+{
+	uint32_t n;
+
+	if (!csf->multi_write)
+		return;
+
+	for (n = 0; n < MAX_CHANNELS; n++)
+		free(csf->multi_write[n].buffer);
+
+	free(csf->multi_write);
+	csf->multi_write = NULL;
+}
+
 
 static void _init_envelope(song_envelope_t *env, int n)
 {
@@ -182,6 +390,8 @@ void csf_destroy(song_t *csf)
 {
 	int i;
 
+	csf_free_seek_index(csf);
+
 	for (i = 0; i < MAX_PATTERNS; i++) {
 		if (csf->patterns[i]) {
 			csf_free_pattern(csf->patterns[i]);
@@ -216,7 +426,8 @@ void csf_free_pattern(void *pat)
 }
 
 #define CSF_ALLOCATE_PREPEND ((MAX_SAMPLING_POINT_SIZE) * (MAX_INTERPOLATION_LOOKAHEAD_BUFFER_SIZE))
-#define CSF_ALLOCATE_APPEND ((1 + 4 + 4) * MAX_INTERPOLATION_LOOKAHEAD_BUFFER_SIZE * 4)
+#define CSF_ALLOCATE_APPEND (((1 + 4 + 4) * MAX_INTERPOLATION_LOOKAHEAD_BUFFER_SIZE \
+	+ 2 * (UNROLLED_LOOP_BUFFER_SIZE + 2 * MAX_INTERPOLATION_LOOKAHEAD_BUFFER_SIZE)) * 4)
 
 signed char *csf_allocate_sample(uint32_t nbytes)
 {
@@ -481,7 +692,7 @@ int csf_set_resampling_mode(song_t *csf, uint32_t mode)
 static void set_current_pos_0(song_t *csf)
 {
 	song_voice_t *v = csf->voices;
-	for (uint32_t i = 0; i < MAX_VOICES; i++, v++) {
+	for (uint32_t i = 0; i < csf->voice_count; i++, v++) {
 		memset(v, 0, sizeof(*v));
 		v->note = v->new_note = 1;
 		v->cutoff = 0x7F;
@@ -495,6 +706,7 @@ static void set_current_pos_0(song_t *csf)
 			v->global_volume = 64;
 		}
 	}
+	memset(csf->busy_voices, 0, (csf->voice_count + 31) / 32 * sizeof(*csf->busy_voices));
 	csf->current_global_volume = csf->initial_global_volume;
 	csf->current_speed = csf->initial_speed;
 	csf->current_tempo = csf->initial_tempo;
@@ -503,7 +715,7 @@ static void set_current_pos_0(song_t *csf)
 
 void csf_set_current_order(song_t *csf, uint32_t position)
 {
-	for (uint32_t j = 0; j < MAX_VOICES; j++) {
+	for (uint32_t j = 0; j < csf->voice_count; j++) {
 		song_voice_t *v = csf->voices + j;
 
 		v->frequency = 0;
@@ -1380,6 +1592,26 @@ uint32_t csf_read_sample(song_sample_t *sample, uint32_t flags, slurp_t *fp)
 		csf_precompute_loop_copy_loop_impl_##bits##_(target, data, loop_end, channels, bidi, 0); \
 	} \
 	\
+	/* repeats the loop over the whole buffer, lookahead on both sides included */ \
+	static void csf_precompute_unrolled_loop_impl_##bits##_(int##bits##_t *target, const int##bits##_t *data, uint32_t loop_length, int channels, int bidi) \
+	{ \
+		uint32_t i, position; \
+		int c; \
+		\
+		if (bidi || !loop_length || loop_length > MAX_UNROLLED_LOOP_LENGTH) \
+			return; \
+		\
+		position = (loop_length - MAX_INTERPOLATION_LOOKAHEAD_BUFFER_SIZE % loop_length) % loop_length; \
+		\
+		for (i = 0; i < UNROLLED_LOOP_BUFFER_SIZE + 2 * MAX_INTERPOLATION_LOOKAHEAD_BUFFER_SIZE; i++) { \
+			for (c = 0; c < channels; c++) \
+				target[i * channels + c] = data[position * channels + c]; \
+		\
+			if (++position == loop_length) \
+				position = 0; \
+		} \
+	} \
+	\
 	static void csf_precompute_loops_impl_##bits##_(song_sample_t *smp) \
 	{ \
 		const int channels = (smp->flags & CHN_STEREO) ? 2 : 1; \
@@ -1389,6 +1621,8 @@ uint32_t csf_read_sample(song_sample_t *sample, uint32_t flags, slurp_t *fp)
 		int##bits##_t *after_smp_start = smp_data + smp->length * channels; \
 		int##bits##_t *loop_lookahead_start = after_smp_start + copy_samples; \
 		int##bits##_t *sustain_lookahead_start = loop_lookahead_start + 4 * copy_samples; \
+		int##bits##_t *loop_unrolled_start = sustain_lookahead_start + 4 * copy_samples; \
+		int##bits##_t *sustain_unrolled_start = loop_unrolled_start + channels * UNROLLED_LOOP_BUFFER_SIZE + 2 * copy_samples; \
 		int i; \
 		int c; \
 		\
@@ -1407,6 +1641,11 @@ uint32_t csf_read_sample(song_sample_t *sample, uint32_t flags, slurp_t *fp)
 				smp->loop_end - smp->loop_start, \
 				channels, \
 				smp->flags & CHN_PINGPONGLOOP); \
+			csf_precompute_unrolled_loop_impl_##bits##_(loop_unrolled_start, \
+				smp_data + smp->loop_start * channels, \
+				smp->loop_end - smp->loop_start, \
+				channels, \
+				smp->flags & CHN_PINGPONGLOOP); \
 		} \
 		if(smp->flags & CHN_SUSTAINLOOP) { \
 			csf_precompute_loop_impl_##bits##_(sustain_lookahead_start, \
@@ -1414,6 +1653,11 @@ uint32_t csf_read_sample(song_sample_t *sample, uint32_t flags, slurp_t *fp)
 				smp->sustain_end - smp->sustain_start, \
 				channels, \
 				smp->flags & CHN_PINGPONGSUSTAIN); \
+			csf_precompute_unrolled_loop_impl_##bits##_(sustain_unrolled_start, \
+				smp_data + smp->sustain_start * channels, \
+				smp->sustain_end - smp->sustain_start, \
+				channels, \
+				smp->flags & CHN_PINGPONGSUSTAIN); \
 		} \
 	}
 
@@ -1453,7 +1697,7 @@ void csf_stop_sample(song_t *csf, song_sample_t *smp)
 
 	if (!smp->data)
 		return;
-	for (int i = 0; i < MAX_VOICES; i++, v++) {
+	for (uint32_t i = 0; i < csf->voice_count; i++, v++) {
 		if (v->ptr_sample == smp || v->current_sample_data == smp->data) {
 			v->note = v->new_note = 1;
 			v->new_instrument = 0;
@@ -1922,70 +2166,572 @@ void csf_insert_restart_pos(song_t *csf, uint32_t restart_order)
 }
 
 /* ------------------------------------------------------------------------ */
-/* little hacky function to get the length of a song.
+/* song timing
  *
- * currently it does this by duplicating the whole song structure,
- * which sucks; ideally we would save all of the relevant playback
- * bits ONLY, and work from there, but I suppose that the "relevant
- * playback bits" is actually a lot of the structure anyway ;) */
-
-/* I've tried to optimize this as much as I can, but there's a good chunk
- * of stuff this function doesn't care about that the playback code has
- * to care about (e.g. volume changes, sample changes) */
-uint32_t csf_get_length(song_t *csf)
+ * This is a cut-down copy of the sequencer in csf_process_tick, for working
+ * out how long things take without playing anything. It only keeps track of
+ * what row and tick timing depend on (speed, tempo, pattern loops and delays,
+ * Bxx/Cxx, tempo slides), and never touches the voices, so there's no need
+ * to copy the whole song_t just to run through it.
+ *
+ * Anything that changes in csf_process_tick, csf_process_effects or the
+ * effects listed in timing_step_row needs to be mirrored here! */
+
+typedef struct song_timing_channel {
+	uint32_t new_note; /* only for IT's "note maps to no sample" bug */
+	uint32_t mem_special, mem_tempo;
+	uint32_t patloop_row, cd_patloop;
+} song_timing_channel_t;
+
+typedef struct song_timing {
+	uint32_t process_order, process_row, break_row;
+	uint32_t current_order, current_pattern, row;
+	int32_t row_count;
+	uint32_t tick_count, frame_delay;
+	uint32_t current_speed, current_tempo;
+
+	song_timing_channel_t channels[MAX_CHANNELS];
+} song_timing_t;
+
+static const song_note_t timing_blank_note = {0};
+
+/* same as csf_set_current_order(csf, 0) */
+static void timing_reset(song_t *csf, song_timing_t *t)
+{
+	uint32_t n;
+
+	memset(t, 0, sizeof(*t));
+
+	t->process_order = -1;
+	t->process_row = PROCESS_NEXT_ORDER;
+	t->tick_count = 1;
+	t->current_speed = csf->initial_speed;
+	t->current_tempo = csf->initial_tempo;
+
+	for (n = 0; n < MAX_CHANNELS; n++)
+		t->channels[n].new_note = 1;
+}
+
+/* missing patterns get allocated as 64 empty rows when they're played */
+static uint32_t timing_pattern_size(song_t *csf, uint32_t pat)
+{
+	return (csf->patterns[pat] && csf->pattern_size[pat]) ? csf->pattern_size[pat] : 64;
+}
+
+static uint32_t timing_tick_length(song_t *csf, uint32_t tempo)
+{
+	/* csf_read_note stops here */
+	if (!tempo)
+		return 0;
+
+	return (csf->mix_frequency * 5 * csf->tempo_factor) / (tempo << 8);
+}
+
+/* increment_order, without pattern playback or looping back to the start */
+static int timing_next_order(song_t *csf, song_timing_t *t)
 {
-	/* This sucks, but it's the simplest thing I can come up with right now
-	 * TODO: optimize this further; */
-	uint32_t total;
-#ifdef USE_THREADS
-	song_t *csfcopy;
+	t->process_row = t->break_row;
+	t->break_row = 0;
 
-	csfcopy = mem_alloc(sizeof(*csfcopy));
-#else
-	/* allocate it as a global. */
-	static song_t csfcopier;
-	song_t *csfcopy = &csfcopier;
-#endif
+	do {
+		t->process_order++;
+	} while (t->process_order < MAX_ORDERS && csf->orderlist[t->process_order] == ORDER_SKIP);
 
-	/* copy the contents */
-	memcpy(csfcopy, csf, sizeof(*csf));
+	if (t->process_order >= MAX_ORDERS || csf->orderlist[t->process_order] >= MAX_PATTERNS)
+		return 0;
+
+	t->current_order = t->process_order;
+	t->current_pattern = csf->orderlist[t->process_order];
 
-	/* no expensive MIDI stuff */
-	csf_init_midi(csfcopy, NULL);
+	if (t->process_row >= timing_pattern_size(csf, t->current_pattern))
+		t->process_row = 0;
+
+	return 1;
+}
 
-	csf_set_current_order(csfcopy, 0);
+/* fx_pattern_loop */
+static void timing_pattern_loop(song_timing_t *t, song_timing_channel_t *chan, uint32_t param)
+{
+	if (param) {
+		if (chan->cd_patloop) {
+			if (!--chan->cd_patloop) {
+				chan->patloop_row = t->row + 1;
+				return;
+			}
+		} else {
+			chan->cd_patloop = param;
+		}
+		t->process_row = chan->patloop_row - 1;
+	} else {
+		chan->patloop_row = t->row;
+	}
+}
 
-	/* if someone attempts FT2-style song looping,
-	 * don't go into an infinite loop */
-	csfcopy->mix_flags |= SNDMIX_NOBACKWARDJUMPS | SNDMIX_CALCLENGTH;
+/* the non-first-tick half of Txx */
+static void timing_tempo_slide(song_timing_t *t, song_timing_channel_t *chan)
+{
+	uint32_t param = chan->mem_tempo;
 
-	csfcopy->repeat_count = -1;
-	csfcopy->flags &= ~(SONG_PAUSED | SONG_PATTERNLOOP | SONG_ENDREACHED);
-	csfcopy->stop_at_order = -1;
-	csfcopy->stop_at_row = -1;
+	switch (param >> 4) {
+	case 0:
+		t->current_tempo -= param & 0xf;
+		if (t->current_tempo < 32)
+			t->current_tempo = 32;
+		break;
+	case 1:
+		t->current_tempo += param & 0xf;
+		if (t->current_tempo > 255)
+			t->current_tempo = 255;
+		break;
+	}
+}
+
+/* Runs through one row, including any repeats from SEx. Returns zero at the
+ * end of the song, otherwise stores how many samples the row lasted. */
+static int timing_step_row(song_t *csf, song_timing_t *t, uint64_t *samples)
+{
+	const song_note_t *row;
+	uint8_t slides[MAX_CHANNELS];
+	uint32_t n, nslides = 0, ticks, break_row = 0;
+	int firsttick = 0, patloop = 0, have_break = 0;
+
+	t->tick_count = t->current_speed + t->frame_delay;
+
+	if (--t->row_count <= 0) {
+		t->row_count = 0;
+
+		if (++t->process_row >= timing_pattern_size(csf, t->current_pattern))
+			if (!timing_next_order(csf, t))
+				return 0;
+
+		t->row = t->process_row;
+		t->frame_delay = 0;
+		t->tick_count = t->current_speed;
+		firsttick = 1;
+	}
+
+	row = csf->patterns[t->current_pattern]
+		? (csf->patterns[t->current_pattern] + t->row * MAX_CHANNELS)
+		: NULL;
+
+	for (n = 0; n < MAX_CHANNELS; n++) {
+		song_timing_channel_t *chan = t->channels + n;
+		const song_note_t *m = row ? (row + n) : &timing_blank_note;
+		uint32_t param = m->param;
+
+		if ((csf->flags & SONG_INSTRUMENTMODE) && m->instrument && m->instrument < MAX_INSTRUMENTS
+				&& csf->instruments[m->instrument]) {
+			uint8_t note = (m->note != NOTE_NONE) ? m->note : chan->new_note;
+			if (NOTE_IS_NOTE(note) && csf->instruments[m->instrument]->sample_map[note - NOTE_FIRST] == 0) {
+				chan->new_note = note;
+				continue;
+			}
+		}
+
+		/* the note that an instrument number on its own goes by; see
+		 * csf_process_effects, and csf_note_change for the control notes */
+		if (firsttick) {
+			if (NOTE_IS_NOTE(m->note))
+				chan->new_note = m->note;
+			else if (NOTE_IS_CONTROL(m->note))
+				chan->new_note = NOTE_OFF;
+		}
+
+		switch (m->effect) {
+		case FX_SPEED:
+			if (firsttick && param) {
+				t->tick_count = param;
+				t->current_speed = param;
+			}
+			break;
+
+		case FX_TEMPO:
+			if (firsttick) {
+				if (param)
+					chan->mem_tempo = param;
+				else
+					param = chan->mem_tempo;
+				if (param >= 0x20)
+					t->current_tempo = param;
+			} else {
+				timing_tempo_slide(t, chan);
+			}
+			slides[nslides++] = n;
+			break;
+
+		case FX_POSITIONJUMP:
+			/* backward jumps would never end */
+			if (t->process_order < param)
+				t->process_order = param - 1;
+			t->process_row = PROCESS_NEXT_ORDER;
+			break;
+
+		case FX_PATTERNBREAK:
+			have_break = 1;
+			break_row = param;
+			break;
+
+		case FX_SPECIAL:
+			if (param)
+				chan->mem_special = param;
+			else
+				param = chan->mem_special;
+
+			switch (param & 0xF0) {
+			case 0x60: /* S6x */
+				if (firsttick) {
+					t->frame_delay += param & 0x0F;
+					t->tick_count += param & 0x0F;
+				}
+				break;
+			case 0xB0: /* SBx */
+				if (firsttick)
+					timing_pattern_loop(t, chan, param & 0x0F);
+				break;
+			case 0xD0: /* SDx skips the rest of the channel */
+				continue;
+			case 0xE0: /* SEx */
+				if (firsttick && !t->row_count)
+					t->row_count = (param & 0x0F) + 1;
+				break;
+			}
+			break;
+		}
+
+		if (chan->cd_patloop)
+			patloop = 1;
+	}
+
+	/* only loop if any pattern loop is finished */
+	if (have_break && !patloop) {
+		t->break_row = break_row;
+		t->process_row = PROCESS_NEXT_ORDER;
+	}
+
+	*samples = timing_tick_length(csf, t->current_tempo);
+
+	for (ticks = t->tick_count; ticks > 1; ticks--) {
+		for (n = 0; n < nslides; n++)
+			timing_tempo_slide(t, t->channels + slides[n]);
+
+		*samples += timing_tick_length(csf, t->current_tempo);
+	}
+
+	return 1;
+}
+
+/* ------------------------------------------------------------------------ */
+/* song length and seeking
+ *
+ * The only way to know where a song is at a given time is to run through it
+ * from the start, which gets slow for long songs. So, while doing that, the
+ * timing state is saved every time playback enters a new order, and later
+ * lookups carry on from the closest one instead.
+ *
+ * There are far too many places that can edit a pattern to tell all of them
+ * about this, so instead each pattern is hashed when it's played, and checked
+ * again on the next lookup. An edited pattern throws out everything that was
+ * saved after the first order that plays it. */
+
+/* the timing state right before playback enters an order */
+typedef struct song_order_snapshot {
+	uint64_t samples; /* how far into the song this is */
+	uint32_t order; /* the order it's about to enter */
+	song_timing_t timing;
+} song_order_snapshot_t;
+
+/* song flags that make a difference to where playback goes */
+#define SEEK_INDEX_SONG_FLAGS (SONG_INSTRUMENTMODE)
+
+struct song_seek_index {
+	/* if any of this changes, none of the snapshots are any good */
+	uint32_t flags;
+	uint32_t mix_frequency, tempo_factor;
+	uint32_t initial_speed, initial_tempo;
+	uint32_t instruments_hash;
+
+	/* what the song looked like when the snapshots were taken */
+	uint8_t orderlist[MAX_ORDERS + 1];
+	uint32_t pattern_hash[MAX_PATTERNS];
+
+	/* in the order they were played. orders never go backwards while running
+	 * through the song, so this is sorted by order number as well. */
+	song_order_snapshot_t *snapshots;
+	uint32_t num_snapshots, alloc_snapshots;
+
+	/* if it's been run all the way through, the length in samples */
+	int complete;
+	uint64_t length;
+};
+
+static uint32_t seek_hash(uint32_t hash, const void *data, size_t len)
+{
+	const uint8_t *p = data;
+
+	/* FNV-1a */
+	while (len--) {
+		hash ^= *p++;
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
+static uint32_t seek_hash_pattern(song_t *csf, uint32_t pat)
+{
+	uint32_t hash = 2166136261u;
+	uint32_t rows = csf->pattern_size[pat];
+
+	hash = seek_hash(hash, &rows, sizeof(rows));
+	if (csf->patterns[pat])
+		hash = seek_hash(hash, csf->patterns[pat], rows * MAX_CHANNELS * sizeof(song_note_t));
+
+	return hash;
+}
+
+static uint32_t seek_hash_instruments(song_t *csf)
+{
+	uint32_t hash = 2166136261u;
+	uint32_t n;
+
+	/* these only matter for IT's "note maps to no sample" bug */
+	for (n = 1; n < MAX_INSTRUMENTS; n++) {
+		if (!csf->instruments[n])
+			continue;
+
+		hash = seek_hash(hash, &n, sizeof(n));
+		hash = seek_hash(hash, csf->instruments[n]->sample_map, sizeof(csf->instruments[n]->sample_map));
+	}
+
+	return hash;
+}
+
+void csf_free_seek_index(song_t *csf)
+{
+	if (csf->seek_index) {
+		free(csf->seek_index->snapshots);
+		free(csf->seek_index);
+		csf->seek_index = NULL;
+	}
+}
+
+/* returns the song's index, after throwing out whatever's out of date */
+static struct song_seek_index *seek_index_get(song_t *csf)
+{
+	struct song_seek_index *idx = csf->seek_index;
+	uint8_t checked[MAX_PATTERNS] = {0};
+	uint32_t d, k, instruments_hash;
+	int changed;
+
+	instruments_hash = seek_hash_instruments(csf);
+
+	if (!idx) {
+		idx = mem_calloc(1, sizeof(*idx));
+		csf->seek_index = idx;
+	} else if (idx->flags == (csf->flags & SEEK_INDEX_SONG_FLAGS)
+			&& idx->mix_frequency == csf->mix_frequency
+			&& idx->tempo_factor == csf->tempo_factor
+			&& idx->initial_speed == csf->initial_speed
+			&& idx->initial_tempo == csf->initial_tempo
+			&& idx->instruments_hash == instruments_hash) {
+		/* the snapshot for an order depends on the orderlist up to that point,
+		 * and on the patterns played before it */
+		for (d = 0; d < ARRAY_SIZE(idx->orderlist) && idx->orderlist[d] == csf->orderlist[d]; d++);
+
+		changed = (d < ARRAY_SIZE(idx->orderlist));
+
+		for (k = 0; k <= idx->num_snapshots; k++) {
+			uint32_t pat;
+
+			if (k < idx->num_snapshots && idx->snapshots[k].order >= d)
+				break;
+
+			if (!k)
+				continue;
+
+			pat = idx->orderlist[idx->snapshots[k - 1].order];
+			if (checked[pat])
+				continue;
+
+			if (seek_hash_pattern(csf, pat) != idx->pattern_hash[pat]) {
+				changed = 1;
+				break;
+			}
+
+			checked[pat] = 1;
+		}
+
+		idx->num_snapshots = MIN(k, idx->num_snapshots);
+		if (changed)
+			idx->complete = 0;
+
+		memcpy(idx->orderlist, csf->orderlist, sizeof(idx->orderlist));
+
+		return idx;
+	}
+
+	idx->flags = csf->flags & SEEK_INDEX_SONG_FLAGS;
+	idx->mix_frequency = csf->mix_frequency;
+	idx->tempo_factor = csf->tempo_factor;
+	idx->initial_speed = csf->initial_speed;
+	idx->initial_tempo = csf->initial_tempo;
+	idx->instruments_hash = instruments_hash;
+	memcpy(idx->orderlist, csf->orderlist, sizeof(idx->orderlist));
+
+	idx->num_snapshots = 0;
+	idx->complete = 0;
+
+	return idx;
+}
+
+/* called after each row with its start and end time; returns nonzero to stop */
+typedef int (*seek_stop_t)(const song_timing_t *t, uint64_t start, uint64_t end, void *data);
+
+/* Runs through the song from the given snapshot (or from the start, if there
+ * isn't one), adding snapshots to the index as it goes. */
+static void seek_run(song_t *csf, struct song_seek_index *idx, uint32_t from, seek_stop_t stop, void *data)
+{
+	song_timing_t t;
+	uint64_t total;
+	uint32_t next;
+
+	if (from < idx->num_snapshots) {
+		/* this puts it right back where it was before entering the order,
+		 * so the snapshot for it gets "taken" again below */
+		t = idx->snapshots[from].timing;
+		total = idx->snapshots[from].samples;
+		next = from;
+	} else {
+		timing_reset(csf, &t);
+		total = 0;
+		next = 0;
+	}
 
-	/* the bulk of the processing:
-	 * go through each row until we hit a dead end */
-	total = 0;
 	for (;;) {
-		/* Only process the first tick of each row, which are the only
-		 * ones relevant to us. */
-		csfcopy->tick_count = 1;
+		const uint64_t start = total;
+		/* is this row going to be the first one in a new order? */
+		const int entering = (t.row_count <= 1
+			&& t.process_row + 1 >= timing_pattern_size(csf, t.current_pattern));
+		uint64_t samples;
+
+		if (entering && next == idx->num_snapshots) {
+			if (idx->num_snapshots == idx->alloc_snapshots) {
+				idx->alloc_snapshots = idx->alloc_snapshots ? (idx->alloc_snapshots * 2) : 16;
+				idx->snapshots = mem_realloc(idx->snapshots, idx->alloc_snapshots * sizeof(*idx->snapshots));
+			}
+
+			idx->snapshots[next].samples = start;
+			idx->snapshots[next].timing = t;
+		}
 
-		if (!csf_process_tick(csfcopy))
+		if (!timing_step_row(csf, &t, &samples)) {
+			idx->complete = 1;
+			idx->length = total;
 			break;
+		}
+
+		total += samples;
+
+		if (entering) {
+			if (next == idx->num_snapshots)
+				idx->snapshots[idx->num_snapshots++].order = t.current_order;
+
+			/* whatever comes after this depends on what's in the pattern now */
+			idx->pattern_hash[t.current_pattern] = seek_hash_pattern(csf, t.current_pattern);
+			next++;
+		}
+
+		if (stop && stop(&t, start, total, data))
+			break;
+	}
+}
+
+static uint32_t seek_samples_to_seconds(song_t *csf, uint64_t samples)
+{
+	/* round to the nearest second */
+	return (uint32_t)((((samples << 1) / csf->mix_frequency) + 1) >> 1);
+}
+
+uint32_t csf_get_length(song_t *csf)
+{
+	struct song_seek_index *idx = seek_index_get(csf);
+
+	if (!idx->complete)
+		seek_run(csf, idx, idx->num_snapshots ? (idx->num_snapshots - 1) : UINT32_MAX, NULL, NULL);
+
+	return seek_samples_to_seconds(csf, idx->length);
+}
 
-		total += csf_calculate_tick_length(csfcopy) * csfcopy->tick_count;
+struct seek_length_to {
+	uint32_t order, row;
+	uint64_t samples;
+};
+
+static int seek_length_to_stop(const song_timing_t *t, uint64_t start, SCHISM_UNUSED uint64_t end, void *data)
+{
+	struct seek_length_to *lt = data;
+
+	if (t->current_order > lt->order || (t->current_order == lt->order && t->row >= lt->row)) {
+		lt->samples = start;
+		return 1;
 	}
 
-	/* round to the nearest second (avoid overflow via 64-bit cast) */
-	total = (((((uint64_t)total << 1) / csfcopy->mix_frequency) + 1) >> 1);
+	return 0;
+}
+
+uint32_t csf_get_length_to(song_t *csf, uint32_t order, uint32_t row)
+{
+	struct song_seek_index *idx = seek_index_get(csf);
+	struct seek_length_to lt;
+	uint32_t k;
+
+	/* the last order before the one we want */
+	for (k = idx->num_snapshots; k > 0 && idx->snapshots[k - 1].order > order; k--);
+
+	lt.order = order;
+	lt.row = row;
+	lt.samples = UINT64_MAX;
+
+	seek_run(csf, idx, k ? (k - 1) : UINT32_MAX, seek_length_to_stop, &lt);
+
+	/* never got there? */
+	if (lt.samples == UINT64_MAX)
+		lt.samples = idx->length;
+
+	return seek_samples_to_seconds(csf, lt.samples);
+}
+
+struct seek_position_at {
+	uint64_t samples;
+	uint32_t order, row;
+};
+
+static int seek_position_at_stop(const song_timing_t *t, SCHISM_UNUSED uint64_t start, uint64_t end, void *data)
+{
+	struct seek_position_at *pa = data;
+
+	pa->order = t->current_order;
+	pa->row = t->row;
+
+	return (end > pa->samples);
+}
+
+void csf_get_position_at(song_t *csf, uint32_t seconds, uint32_t *order, uint32_t *row)
+{
+	struct song_seek_index *idx = seek_index_get(csf);
+	struct seek_position_at pa;
+	uint32_t k;
+
+	pa.samples = (uint64_t)seconds * csf->mix_frequency;
+	pa.order = pa.row = 0;
+
+	/* the last order that starts before then */
+	for (k = idx->num_snapshots; k > 0 && idx->snapshots[k - 1].samples > pa.samples; k--);
 
-#ifdef USE_THREADS
-	free(csfcopy);
-#endif
+	seek_run(csf, idx, k ? (k - 1) : UINT32_MAX, seek_position_at_stop, &pa);
 
-	return total;
+	if (order) *order = pa.order;
+	if (row) *row = pa.row;
 }
 
 /* ------------------------------------------------------------------------ */
@@ -2004,7 +2750,7 @@ void csf_calculate_vu_meters(song_t *csf, float vus[MAX_CHANNELS])
 	for (c = 0; c < MAX_CHANNELS; c++)
 		vus[c] = 0.0f;
 
-	for (c = 0; c < MAX_VOICES; c++) {
+	for (c = 0; c < csf->voice_count; c++) {
 		song_voice_t *voice;
 		float vu;
 		int mc; /* master channel */
@@ -2084,11 +2830,11 @@ void csf_update_playing_instrument(song_t *csf, int i_changed)
 
 			if (inst->ifc & 0x80) {
 				channel->cutoff = inst->ifc & 0x7F;
-				setup_channel_filter(channel, 0, 256, csf->mix_frequency);
+				setup_channel_filter(csf, channel, 0, 256);
 			} else {
 				channel->cutoff = 0x7F;
 				if (inst->ifr & 0x80) {
-					setup_channel_filter(channel, 0, 256, csf->mix_frequency);
+					setup_channel_filter(csf, channel, 0, 256);
 				}
 			}
 		}
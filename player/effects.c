@@ -731,7 +731,7 @@ static void fx_special(song_t *csf, uint32_t nchan, uint32_t param)
 		case 2:
 			{
 				song_voice_t *bkp = &csf->voices[MAX_CHANNELS];
-				for (uint32_t i=MAX_CHANNELS; i<MAX_VOICES; i++, bkp++) {
+				for (uint32_t i=MAX_CHANNELS; i<csf->voice_count; i++, bkp++) {
 					if (bkp->master_channel == nchan+1) {
 						if (param == 1) {
 							fx_key_off(csf, i);
@@ -850,7 +850,7 @@ void csf_midi_send(song_t *csf, const unsigned char *data, uint32_t len, uint32_
 
 	if (len >= 1 && (data[0] == 0xFA || data[0] == 0xFC || data[0] == 0xFF)) {
 		// Start Song, Stop Song, MIDI Reset
-		for (uint32_t c = 0; c < MAX_VOICES; c++) {
+		for (uint32_t c = 0; c < csf->voice_count; c++) {
 			csf->voices[c].cutoff = 0x7F;
 			csf->voices[c].resonance = 0x00;
 		}
@@ -862,13 +862,13 @@ void csf_midi_send(song_t *csf, const unsigned char *data, uint32_t len, uint32_
 		case 0x00: // set cutoff
 			if (data[3] < 0x80) {
 				chan->cutoff = data[3];
-				setup_channel_filter(chan, !(chan->flags & CHN_FILTER), 256, csf->mix_frequency);
+				setup_channel_filter(csf, chan, !(chan->flags & CHN_FILTER), 256);
 			}
 			break;
 		case 0x01: // set resonance
 			if (data[3] < 0x80) {
 				chan->resonance = data[3];
-				setup_channel_filter(chan, !(chan->flags & CHN_FILTER), 256, csf->mix_frequency);
+				setup_channel_filter(csf, chan, !(chan->flags & CHN_FILTER), 256);
 			}
 			break;
 		}
@@ -1261,7 +1261,7 @@ static void csf_env_reset(song_t *csf, song_voice_t *chan, int porta, int always
 			 * OpenMPT test case CarryCompatGxxPortaWithIns.it */
 			int compat_gxx_carry_reset = BITARRAY_ISSET(csf->quirks, CSF_QUIRK_IT_COMPAT_GXX_CARRY_PORTA_WITH_INS)
 				&& porta && (csf->flags & SONG_COMPATGXX);
-			const song_voice_t *last_chan = (csf->last_moved_channel < MAX_VOICES) ? &csf->voices[csf->last_moved_channel] : NULL;
+			const song_voice_t *last_chan = (csf->last_moved_channel < csf->voice_count) ? &csf->voices[csf->last_moved_channel] : NULL;
 
 			/* only reset envelopes with carry off */
 			if (!(chan->ptr_instrument->flags & ENV_VOLCARRY))
@@ -1641,28 +1641,36 @@ uint32_t csf_get_nna_channel(song_t *csf, uint32_t nchan)
 {
 	song_voice_t *chan = &csf->voices[nchan];
 	// Check for empty channel
-	song_voice_t *pi = &csf->voices[MAX_CHANNELS];
-	for (uint32_t i=MAX_CHANNELS; i<MAX_VOICES; i++, pi++) {
-		if (!pi->length) {
-			if (pi->flags & CHN_MUTE) {
-				if (pi->flags & CHN_NNAMUTE) {
-					pi->flags &= ~(CHN_NNAMUTE|CHN_MUTE);
-				} else {
-					/* this channel is muted; skip */
-					continue;
-				}
+	// Voices that aren't marked busy are known to be stopped, so this only
+	// has to look at the busy ones that come before the first idle voice.
+	for (uint32_t i=MAX_CHANNELS; i<csf->voice_count; i++) {
+		song_voice_t *pi = &csf->voices[i];
+		if (BITARRAY_ISSET(csf->busy_voices, i) && pi->length)
+			continue;
+		if (pi->flags & CHN_MUTE) {
+			if (pi->flags & CHN_NNAMUTE) {
+				pi->flags &= ~(CHN_NNAMUTE|CHN_MUTE);
+			} else {
+				/* this channel is muted; skip */
+				continue;
 			}
-			return i;
 		}
+		BITARRAY_SET(csf->busy_voices, i);
+		return i;
 	}
 	if (!chan->fadeout_volume) return 0;
 	// All channels are used: check for lowest volume
+	// (this can't be kept in a heap; every voice's volume and fade change
+	// each tick, and ties are broken by voice order)
 	uint32_t result = 0;
 	uint32_t vol = 64*65536;        // 25%
 	int envpos = 0xFFFFFF;
 	const song_voice_t *pj = &csf->voices[MAX_CHANNELS];
-	for (uint32_t j=MAX_CHANNELS; j<MAX_VOICES; j++, pj++) {
-		if (!pj->fadeout_volume) return j;
+	for (uint32_t j=MAX_CHANNELS; j<csf->voice_count; j++, pj++) {
+		if (!pj->fadeout_volume) {
+			BITARRAY_SET(csf->busy_voices, j);
+			return j;
+		}
 		uint32_t v = pj->volume;
 		if (pj->flags & CHN_NOTEFADE)
 			v = v * pj->fadeout_volume;
@@ -1678,6 +1686,7 @@ uint32_t csf_get_nna_channel(song_t *csf, uint32_t nchan)
 	if (result) {
 		/* unmute new nna channel */
 		csf->voices[result].flags &= ~(CHN_MUTE|CHN_NNAMUTE);
+		BITARRAY_SET(csf->busy_voices, result);
 	}
 	return result;
 }
@@ -1738,7 +1747,7 @@ void csf_check_nna(song_t *csf, uint32_t nchan, uint32_t instr, int note, int fo
         	return;
 	}
 	p = chan;
-	for (uint32_t i=nchan; i<MAX_VOICES; p++, i++) {
+	for (uint32_t i=nchan; i<csf->voice_count; p++, i++) {
 		if (!((i >= MAX_CHANNELS || p == chan)
 		      && ((p->master_channel == nchan + 1 || p == chan)
 			  && p->ptr_instrument)))
@@ -2252,9 +2261,7 @@ void csf_process_effects(song_t *csf, int firsttick)
 
 		// Handles note/instrument/volume changes
 
-		/* csf_get_length: don't take this code path.
-		 * it's expensive, and we don't care anyway */
-		if (start_note && !(csf->mix_flags & SNDMIX_CALCLENGTH)) {
+		if (start_note) {
 			uint32_t note = chan->row_note;
 			/* MPT test case InstrumentNumberChange.it */
 			if (csf->flags & SONG_INSTRUMENTMODE && (NOTE_IS_NOTE(note) || note == NOTE_NONE)) {
@@ -2418,9 +2425,7 @@ void csf_process_effects(song_t *csf, int firsttick)
 			}
 		}
 
-		/* csf_get_length: volume column effects are completely irrelevant */
-		if (!(csf->mix_flags & SNDMIX_CALCLENGTH))
-			handle_voleffect(csf, chan, volcmd, vol, firsttick, start_note);
+		handle_voleffect(csf, chan, volcmd, vol, firsttick, start_note);
 		handle_effect(csf, nchan, cmd, param, porta, firsttick);
 
 		/* stupid hax: handling effect column after volume column breaks
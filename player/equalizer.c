@@ -23,125 +23,422 @@
 
 #include "headers.h"
 
+#include "cpu.h"
+
+#include <float.h>
+
 #include "player/sndfile.h"
 #include "player/cmixer.h"
-#include "song.h"
 
 #define EQ_BANDWIDTH    2.0
 #define EQ_ZERO         0.000001
 
-typedef struct {
-    float a0, a1, a2, b1, b2;
-    float x1, x2, y1, y2;
-    float gain, center_frequency;
-    int   enabled;
-} eq_band;
+//static REAL f2ic = (REAL)(1 << 28);
+//static REAL i2fc = (REAL)(1.0 / (1 << 28));
 
 
+/* Once a note ends, the filter state decays into denormals, which are very
+ * slow on x86. Rather than changing the FPU's mode (which only the SIMD
+ * version could do), every band's output gets flushed to zero by hand once
+ * it's that small, the same way in both versions. */
+static inline SCHISM_ALWAYS_INLINE
+float eq_flush_denormal(float y)
+{
+	return (y > -FLT_MIN && y < FLT_MIN) ? 0.0f : y;
+}
 
-//static REAL f2ic = (REAL)(1 << 28);
-//static REAL i2fc = (REAL)(1.0 / (1 << 28));
+static inline SCHISM_ALWAYS_INLINE
+float eq_filter_sample(song_eq_band_t *pbs, float x)
+{
+	float y = eq_flush_denormal(pbs->a1 * pbs->x1 +
+		  pbs->a2 * pbs->x2 +
+		  pbs->a0 * x +
+		  pbs->b1 * pbs->y1 +
+		  pbs->b2 * pbs->y2);
+
+	pbs->x2 = pbs->x1;
+	pbs->y2 = pbs->y1;
+	pbs->x1 = x;
+	pbs->y1 = y;
+
+	return y;
+}
 
-static eq_band eq[MAX_EQ_BANDS * 2] =
+static void eq_filter(song_eq_band_t *pbs, int32_t *buffer, uint32_t count, uint32_t amt)
 {
-    // Default: Flat EQ
-    {0, 0, 0, 0, 0, 0, 0, 0, 0, 1,   120, 0},
-    {0, 0, 0, 0, 0, 0, 0, 0, 0, 1,   600, 0},
-    {0, 0, 0, 0, 0, 0, 0, 0, 0, 1,  1200, 0},
-    {0, 0, 0, 0, 0, 0, 0, 0, 0, 1,  3000, 0},
-    {0, 0, 0, 0, 0, 0, 0, 0, 0, 1,  6000, 0},
-    {0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 10000, 0},
-    {0, 0, 0, 0, 0, 0, 0, 0, 0, 1,   120, 0},
-    {0, 0, 0, 0, 0, 0, 0, 0, 0, 1,   600, 0},
-    {0, 0, 0, 0, 0, 0, 0, 0, 0, 1,  1200, 0},
-    {0, 0, 0, 0, 0, 0, 0, 0, 0, 1,  3000, 0},
-    {0, 0, 0, 0, 0, 0, 0, 0, 0, 1,  6000, 0},
-    {0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 10000, 0},
+	for (uint32_t i = 0; i < count; i+=amt)
+		buffer[i] = eq_filter_sample(pbs, buffer[i]);
+}
+
+static void eq_filter_float(song_eq_band_t *pbs, float *buffer, uint32_t count, uint32_t amt)
+{
+	for (uint32_t i = 0; i < count; i+=amt)
+		buffer[i] = eq_filter_sample(pbs, buffer[i]);
+}
+
+//////////////////////////////////////////////////////////
+// SIMD stereo EQ
+//
+// Rather than one strided pass over the buffer per band and channel, this
+// runs all of the bands in a single pass. Each register holds two bands,
+// left and right side by side, and every band runs one frame behind the
+// one before it, so the bands don't have to wait on each other within a
+// frame. Each band does exactly the same float math as eq_filter_sample,
+// and the integer version still truncates between the bands, so the output
+// is bit-identical to the plain C loops.
+
+#if SCHISM_GNUC_HAS_ATTRIBUTE(__target__, 4, 4, 0) \
+	&& (defined(__x86_64__) || defined(__i386__)) && !defined(SCHISM_XBOX) /* XBOX is buggy for some reason */
+# include <immintrin.h>
+
+# ifdef SCHISM_SSE2
+#  define EQ_SSE2
+#  define EQ_SSE2_ATTR __attribute__((__target__("sse2")))
+
+/* lanes 0 and 1 are the left and right channels of one band, lanes 2 and 3
+ * are the next band's */
+struct eq_band_pair_sse2 {
+	__m128 a0, a1, a2, b1, b2;
+	__m128 x1, x2, y1, y2;
 };
 
+#  define EQ_MAX_PAIRS ((MAX_EQ_BANDS + 1) / 2)
+
+static inline SCHISM_ALWAYS_INLINE EQ_SSE2_ATTR
+__m128 eq_filter_pair_sse2(struct eq_band_pair_sse2 *pair, __m128 x)
+{
+	__m128 y = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(
+		_mm_mul_ps(pair->a1, pair->x1),
+		_mm_mul_ps(pair->a2, pair->x2)),
+		_mm_mul_ps(pair->a0, x)),
+		_mm_mul_ps(pair->b1, pair->y1)),
+		_mm_mul_ps(pair->b2, pair->y2));
+
+	/* eq_flush_denormal */
+	y = _mm_andnot_ps(_mm_cmplt_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), y), _mm_set1_ps(FLT_MIN)), y);
+
+	pair->x2 = pair->x1;
+	pair->y2 = pair->y1;
+	pair->x1 = x;
+	pair->y1 = y;
+
+	return y;
+}
+
+/* same, but only the lanes in 'mask' get their state updated; this is for
+ * the first and last few frames, where some bands aren't running yet */
+static inline SCHISM_ALWAYS_INLINE EQ_SSE2_ATTR
+__m128 eq_filter_pair_masked_sse2(struct eq_band_pair_sse2 *pair, __m128 x, __m128 mask)
+{
+	struct eq_band_pair_sse2 old = *pair;
+	__m128 y = eq_filter_pair_sse2(pair, x);
+
+#  define EQ_SELECT(v) \
+	pair->v = _mm_or_ps(_mm_and_ps(mask, pair->v), _mm_andnot_ps(mask, old.v));
 
-static void eq_filter(eq_band *pbs, int32_t *buffer, uint32_t count)
+	EQ_SELECT(x1)
+	EQ_SELECT(x2)
+	EQ_SELECT(y1)
+	EQ_SELECT(y2)
+
+#  undef EQ_SELECT
+
+	return y;
+}
+
+/* gathers up the enabled bands; returns the number of pairs, or -1 if the
+ * left and right bands don't agree on which ones are enabled (set_eq_gains
+ * always keeps them in step, so that shouldn't ever happen) */
+static EQ_SSE2_ATTR
+int eq_load_pairs_sse2(song_t *csf, struct eq_band_pair_sse2 *pairs, int *map)
 {
-	int32_t amt = (!!(audio_settings.channels-1)+1); // if 1, amt is 1, else 2
-	for (uint32_t i = 0; i < count; i+=amt) {
-		float x = buffer[i];
-		float y = pbs->a1 * pbs->x1 +
-			  pbs->a2 * pbs->x2 +
-			  pbs->a0 * x +
-			  pbs->b1 * pbs->y1 +
-			  pbs->b2 * pbs->y2;
-
-		pbs->x2 = pbs->x1;
-		pbs->y2 = pbs->y1;
-		pbs->x1 = x;
-		buffer[i] = y;
-		pbs->y1 = y;
+	float v[9][EQ_MAX_PAIRS * 4] = {{0}};
+	int n = 0;
+
+	for (int b = 0; b < MAX_EQ_BANDS; b++) {
+		song_eq_band_t *l = &csf->eq[b], *r = &csf->eq[b + MAX_EQ_BANDS];
+		int on_l = (l->enabled && l->gain != 1.0f);
+		int on_r = (r->enabled && r->gain != 1.0f);
+
+		if (on_l != on_r)
+			return -1;
+		if (!on_l)
+			continue;
+
+#  define EQ_GATHER(i, x) \
+		v[i][n * 2] = l->x; \
+		v[i][n * 2 + 1] = r->x;
+
+		EQ_GATHER(0, a0)
+		EQ_GATHER(1, a1)
+		EQ_GATHER(2, a2)
+		EQ_GATHER(3, b1)
+		EQ_GATHER(4, b2)
+		EQ_GATHER(5, x1)
+		EQ_GATHER(6, x2)
+		EQ_GATHER(7, y1)
+		EQ_GATHER(8, y2)
+
+#  undef EQ_GATHER
+
+		map[n++] = b;
 	}
+
+	/* an odd band out gets paired with one that passes everything
+	 * straight through */
+	if (n & 1)
+		v[0][n * 2] = v[0][n * 2 + 1] = 1.0f;
+
+	for (int p = 0; p < (n + 1) / 2; p++) {
+		pairs[p].a0 = _mm_loadu_ps(&v[0][p * 4]);
+		pairs[p].a1 = _mm_loadu_ps(&v[1][p * 4]);
+		pairs[p].a2 = _mm_loadu_ps(&v[2][p * 4]);
+		pairs[p].b1 = _mm_loadu_ps(&v[3][p * 4]);
+		pairs[p].b2 = _mm_loadu_ps(&v[4][p * 4]);
+		pairs[p].x1 = _mm_loadu_ps(&v[5][p * 4]);
+		pairs[p].x2 = _mm_loadu_ps(&v[6][p * 4]);
+		pairs[p].y1 = _mm_loadu_ps(&v[7][p * 4]);
+		pairs[p].y2 = _mm_loadu_ps(&v[8][p * 4]);
+	}
+
+	map[n] = -1;
+
+	return (n + 1) / 2;
+}
+
+static EQ_SSE2_ATTR
+void eq_store_pairs_sse2(song_t *csf, struct eq_band_pair_sse2 *pairs, const int *map, int npairs)
+{
+	for (int p = 0; p < npairs; p++) {
+		float v[4][4];
+
+		_mm_storeu_ps(v[0], pairs[p].x1);
+		_mm_storeu_ps(v[1], pairs[p].x2);
+		_mm_storeu_ps(v[2], pairs[p].y1);
+		_mm_storeu_ps(v[3], pairs[p].y2);
+
+		for (int h = 0; h < 2; h++) {
+			int b = map[p * 2 + h];
+			song_eq_band_t *l, *r;
+
+			if (b < 0)
+				break; // the pass-through band
+
+			l = &csf->eq[b];
+			r = &csf->eq[b + MAX_EQ_BANDS];
+			l->x1 = v[0][h * 2]; r->x1 = v[0][h * 2 + 1];
+			l->x2 = v[1][h * 2]; r->x2 = v[1][h * 2 + 1];
+			l->y1 = v[2][h * 2]; r->y1 = v[2][h * 2 + 1];
+			l->y2 = v[3][h * 2]; r->y2 = v[3][h * 2 + 1];
+		}
+	}
+}
+
+/* which lanes of a pair are running on step t; band k handles frame t-k */
+static inline SCHISM_ALWAYS_INLINE EQ_SSE2_ATTR
+__m128 eq_pair_mask_sse2(int p, uint32_t t, uint32_t count)
+{
+	uint32_t k = p * 2;
+	int32_t lo = (t >= k && t - k < count) ? -1 : 0;
+	int32_t hi = (t >= k + 1 && t - (k + 1) < count) ? -1 : 0;
+
+	return _mm_castsi128_ps(_mm_setr_epi32(lo, lo, hi, hi));
 }
 
+#  define EQ_STEREO_SSE2(name, type, LOAD, BETWEEN, STORE) \
+	static EQ_SSE2_ATTR \
+	int name(song_t *csf, type *buffer, uint32_t count) \
+	{ \
+		struct eq_band_pair_sse2 pairs[EQ_MAX_PAIRS]; \
+		__m128 out[EQ_MAX_PAIRS]; \
+		int map[MAX_EQ_BANDS + 1]; \
+		uint32_t t, delay; \
+		int p, npairs = eq_load_pairs_sse2(csf, pairs, map); \
+	\
+		if (npairs < 0) \
+			return 0; \
+		if (!npairs) \
+			return 1; \
+	\
+		for (p = 0; p < npairs; p++) \
+			out[p] = _mm_setzero_ps(); \
+	\
+		/* the last band is this many frames behind the first */ \
+		delay = npairs * 2 - 1; \
+	\
+		for (t = 0; t < count + delay; t++) { \
+			__m128 in = (t < count) ? LOAD(buffer + t * 2) : _mm_setzero_ps(); \
+			int all = (t >= delay && t < count); \
+	\
+			/* backwards, so each pair still sees the previous step's output \
+			 * of the pair before it */ \
+			for (p = npairs - 1; p >= 0; p--) { \
+				__m128 x = p \
+					? _mm_shuffle_ps(out[p - 1], out[p], _MM_SHUFFLE(1, 0, 3, 2)) \
+					: _mm_movelh_ps(in, out[0]); \
+	\
+				out[p] = all \
+					? eq_filter_pair_sse2(&pairs[p], x) \
+					: eq_filter_pair_masked_sse2(&pairs[p], x, eq_pair_mask_sse2(p, t, count)); \
+				BETWEEN(out[p]); \
+			} \
+	\
+			if (t >= delay) \
+				STORE(buffer + (t - delay) * 2, _mm_movehl_ps(out[npairs - 1], out[npairs - 1])); \
+		} \
+	\
+		eq_store_pairs_sse2(csf, pairs, map, npairs); \
+		return 1; \
+	}
+
+/* the C version writes each band's output back into the integer buffer
+ * before running the next one, so do the same truncation here */
+#  define EQ_LOAD_INT(p)      _mm_cvtepi32_ps(_mm_loadl_epi64((const __m128i *)(p)))
+#  define EQ_BETWEEN_INT(x)   x = _mm_cvtepi32_ps(_mm_cvttps_epi32(x))
+#  define EQ_STORE_INT(p, x)  _mm_storel_epi64((__m128i *)(p), _mm_cvttps_epi32(x))
+
+#  define EQ_LOAD_FLOAT(p)     _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(p))
+#  define EQ_BETWEEN_FLOAT(x)  /* nothing */
+#  define EQ_STORE_FLOAT(p, x) _mm_storel_pi((__m64 *)(p), (x))
+
+EQ_STEREO_SSE2(eq_stereo_sse2, int32_t, EQ_LOAD_INT, EQ_BETWEEN_INT, EQ_STORE_INT)
+EQ_STEREO_SSE2(eq_stereo_float_sse2, float, EQ_LOAD_FLOAT, EQ_BETWEEN_FLOAT, EQ_STORE_FLOAT)
+
+#  undef EQ_LOAD_INT
+#  undef EQ_BETWEEN_INT
+#  undef EQ_STORE_INT
+#  undef EQ_LOAD_FLOAT
+#  undef EQ_BETWEEN_FLOAT
+#  undef EQ_STORE_FLOAT
+#  undef EQ_STEREO_SSE2
+# endif
+#endif
+
 /* I hate that these are here. */
-void normalize_mono(SCHISM_UNUSED song_t *csf, int32_t *buffer, uint32_t samples)
+void normalize_mono(song_t *csf, int32_t *buffer, uint32_t samples)
 {
 	uint32_t b;
 
-	if (audio_settings.master.left + audio_settings.master.right == 62) {
+	if (csf->master_volume_left + csf->master_volume_right == 62) {
 		/* If the audio is already the max volume, do nothing. */
 		return;
-	} else if (audio_settings.master.left + audio_settings.master.right == 0) {
+	} else if (csf->master_volume_left + csf->master_volume_right == 0) {
 		/* If we're muted, memset the buffer to zero. */
 		memset(buffer, 0, samples * 4);
 	} /* else... */
 
 	/* average the left/right channel values together */
 	for (b = 0; b < samples; b++)
-		buffer[b] = _muldiv(buffer[b], audio_settings.master.left + audio_settings.master.right, 62);
+		buffer[b] = _muldiv(buffer[b], csf->master_volume_left + csf->master_volume_right, 62);
 }
 
-void normalize_stereo(SCHISM_UNUSED song_t *csf, int32_t *buffer, uint32_t samples)
+void normalize_stereo(song_t *csf, int32_t *buffer, uint32_t samples)
 {
 	uint32_t b;
 	uint32_t size = samples * 2;
 
-	if (audio_settings.master.left + audio_settings.master.right == 62) {
+	if (csf->master_volume_left + csf->master_volume_right == 62) {
 		/* If the audio is already the max volume, do nothing. */
 		return;
-	} else if (audio_settings.master.left + audio_settings.master.right == 0) {
+	} else if (csf->master_volume_left + csf->master_volume_right == 0) {
 		/* If we're muted, memset the buffer to zero. */
 		memset(buffer, 0, size * 4);
 	} /* else... */
 
 	for (b = 0; b < size; b += 2) {
-		buffer[b]   = _muldiv(buffer[b],   audio_settings.master.left,  31);
-		buffer[b+1] = _muldiv(buffer[b+1], audio_settings.master.right, 31);
+		buffer[b]   = _muldiv(buffer[b],   csf->master_volume_left,  31);
+		buffer[b+1] = _muldiv(buffer[b+1], csf->master_volume_right, 31);
+	}
+}
+
+void normalize_mono_float(song_t *csf, float *buffer, uint32_t samples)
+{
+	uint32_t b;
+	float vol;
+
+	if (csf->master_volume_left + csf->master_volume_right == 62)
+		return;
+
+	vol = (csf->master_volume_left + csf->master_volume_right) / 62.0f;
+
+	for (b = 0; b < samples; b++)
+		buffer[b] *= vol;
+}
+
+void normalize_stereo_float(song_t *csf, float *buffer, uint32_t samples)
+{
+	uint32_t b;
+	uint32_t size = samples * 2;
+	float vol_l, vol_r;
+
+	if (csf->master_volume_left + csf->master_volume_right == 62)
+		return;
+
+	vol_l = csf->master_volume_left / 31.0f;
+	vol_r = csf->master_volume_right / 31.0f;
+
+	for (b = 0; b < size; b += 2) {
+		buffer[b]   *= vol_l;
+		buffer[b+1] *= vol_r;
 	}
 }
 
 
-void eq_mono(SCHISM_UNUSED song_t *csf, int32_t *buffer, uint32_t count)
+void eq_mono(song_t *csf, int32_t *buffer, uint32_t count)
 {
 	for (uint32_t b = 0; b < MAX_EQ_BANDS; b++)
-		if (eq[b].enabled && eq[b].gain != 1.0f)
-			eq_filter(&eq[b], buffer, count);
+		if (csf->eq[b].enabled && csf->eq[b].gain != 1.0f)
+			eq_filter(&csf->eq[b], buffer, count, 1);
 }
 
 // XXX: I rolled the two loops into one. Make sure this works.
-void eq_stereo(SCHISM_UNUSED song_t *csf, int32_t *buffer, uint32_t count)
+void eq_stereo(song_t *csf, int32_t *buffer, uint32_t count)
 {
+#ifdef EQ_SSE2
+	if (cpu_has_feature(CPU_FEATURE_SSE2) && eq_stereo_sse2(csf, buffer, count))
+		return;
+#endif
+
 	for (uint32_t b = 0; b < MAX_EQ_BANDS; b++) {
 		int32_t br = b + MAX_EQ_BANDS;
 
 		// Left band
-		if (eq[b].enabled && eq[b].gain != 1.0f)
-			eq_filter(&eq[b], buffer, count << 1);
+		if (csf->eq[b].enabled && csf->eq[b].gain != 1.0f)
+			eq_filter(&csf->eq[b], buffer, count << 1, 2);
 
 		// Right band
-		if (eq[br].enabled && eq[br].gain != 1.0f)
-			eq_filter(&eq[br], buffer + 1, count << 1);
+		if (csf->eq[br].enabled && csf->eq[br].gain != 1.0f)
+			eq_filter(&csf->eq[br], buffer + 1, count << 1, 2);
+	}
+}
+
+void eq_mono_float(song_t *csf, float *buffer, uint32_t count)
+{
+	for (uint32_t b = 0; b < MAX_EQ_BANDS; b++)
+		if (csf->eq[b].enabled && csf->eq[b].gain != 1.0f)
+			eq_filter_float(&csf->eq[b], buffer, count, 1);
+}
+
+void eq_stereo_float(song_t *csf, float *buffer, uint32_t count)
+{
+#ifdef EQ_SSE2
+	if (cpu_has_feature(CPU_FEATURE_SSE2) && eq_stereo_float_sse2(csf, buffer, count))
+		return;
+#endif
+
+	for (uint32_t b = 0; b < MAX_EQ_BANDS; b++) {
+		int32_t br = b + MAX_EQ_BANDS;
+
+		if (csf->eq[b].enabled && csf->eq[b].gain != 1.0f)
+			eq_filter_float(&csf->eq[b], buffer, count << 1, 2);
+
+		if (csf->eq[br].enabled && csf->eq[br].gain != 1.0f)
+			eq_filter_float(&csf->eq[br], buffer + 1, count << 1, 2);
 	}
 }
 
 
-void initialize_eq(int32_t reset, float freq)
+void initialize_eq(song_t *csf, int32_t reset, float freq)
 {
 	//float fMixingFreq = (REAL)mix_frequency;
 
@@ -151,23 +448,23 @@ void initialize_eq(int32_t reset, float freq)
 		float v0, v1;
 		int32_t b = reset;
 
-		if (!eq[band].enabled) {
-			eq[band].a0 = 0;
-			eq[band].a1 = 0;
-			eq[band].a2 = 0;
-			eq[band].b1 = 0;
-			eq[band].b2 = 0;
-			eq[band].x1 = 0;
-			eq[band].x2 = 0;
-			eq[band].y1 = 0;
-			eq[band].y2 = 0;
+		if (!csf->eq[band].enabled) {
+			csf->eq[band].a0 = 0;
+			csf->eq[band].a1 = 0;
+			csf->eq[band].a2 = 0;
+			csf->eq[band].b1 = 0;
+			csf->eq[band].b2 = 0;
+			csf->eq[band].x1 = 0;
+			csf->eq[band].x2 = 0;
+			csf->eq[band].y1 = 0;
+			csf->eq[band].y2 = 0;
 			continue;
 		}
 
-		f = eq[band].center_frequency / freq;
+		f = csf->eq[band].center_frequency / freq;
 
 		if (f > 0.45f)
-			eq[band].gain = 1;
+			csf->eq[band].gain = 1;
 
 		//if (f > 0.25)
 		//      f = 0.25;
@@ -181,10 +478,10 @@ void initialize_eq(int32_t reset, float freq)
 		//          k = (float) 0.707;
 
 		k2 = k*k;
-		v0 = eq[band].gain;
+		v0 = csf->eq[band].gain;
 		v1 = 1;
 
-		if (eq[band].gain < 1.0) {
+		if (csf->eq[band].gain < 1.0) {
 			v0 *= 0.5f / EQ_BANDWIDTH;
 			v1 *= 0.5f / EQ_BANDWIDTH;
 		}
@@ -195,50 +492,50 @@ void initialize_eq(int32_t reset, float freq)
 
 		r = (1 + v0 * k + k2) / (1 + v1 * k + k2);
 
-		if (r != eq[band].a0) {
-			eq[band].a0 = r;
+		if (r != csf->eq[band].a0) {
+			csf->eq[band].a0 = r;
 			b = 1;
 		}
 
 		r = 2 * (k2 - 1) / (1 + v1 * k + k2);
 
-		if (r != eq[band].a1) {
-			eq[band].a1 = r;
+		if (r != csf->eq[band].a1) {
+			csf->eq[band].a1 = r;
 			b = 1;
 		}
 
 		r = (1 - v0 * k + k2) / (1 + v1 * k + k2);
 
-		if (r != eq[band].a2) {
-			eq[band].a2 = r;
+		if (r != csf->eq[band].a2) {
+			csf->eq[band].a2 = r;
 			b = 1;
 		}
 
 		r = -2 * (k2 - 1) / (1 + v1 * k + k2);
 
-		if (r != eq[band].b1) {
-			eq[band].b1 = r;
+		if (r != csf->eq[band].b1) {
+			csf->eq[band].b1 = r;
 			b = 1;
 		}
 
 		r = -(1 - v1 * k + k2) / (1 + v1 * k + k2);
 
-		if (r != eq[band].b2) {
-			eq[band].b2 = r;
+		if (r != csf->eq[band].b2) {
+			csf->eq[band].b2 = r;
 			b = 1;
 		}
 
 		if (b) {
-			eq[band].x1 = 0;
-			eq[band].x2 = 0;
-			eq[band].y1 = 0;
-			eq[band].y2 = 0;
+			csf->eq[band].x1 = 0;
+			csf->eq[band].x2 = 0;
+			csf->eq[band].y1 = 0;
+			csf->eq[band].y2 = 0;
 		}
 	}
 }
 
 
-void set_eq_gains(const uint32_t *gainbuff, uint32_t gains, const uint32_t *freqs, int32_t reset, int32_t mix_freq)
+void set_eq_gains(song_t *csf, const uint32_t *gainbuff, uint32_t gains, const uint32_t *freqs, int32_t reset, int32_t mix_freq)
 {
 	for (uint32_t i = 0; i < MAX_EQ_BANDS; i++) {
 		float g, f = 0;
@@ -258,23 +555,23 @@ void set_eq_gains(const uint32_t *gainbuff, uint32_t gains, const uint32_t *freq
 			g = 1;
 		}
 
-		eq[i].gain =
-		eq[i + MAX_EQ_BANDS].gain = g;
-		eq[i].center_frequency =
-		eq[i + MAX_EQ_BANDS].center_frequency = f;
+		csf->eq[i].gain =
+		csf->eq[i + MAX_EQ_BANDS].gain = g;
+		csf->eq[i].center_frequency =
+		csf->eq[i + MAX_EQ_BANDS].center_frequency = f;
 
 		/* don't enable bands outside... */
 		if (f > 20.0f &&
 		    i < gains) {
-			eq[i].enabled =
-			eq[i + MAX_EQ_BANDS].enabled = 1;
+			csf->eq[i].enabled =
+			csf->eq[i + MAX_EQ_BANDS].enabled = 1;
 		}
 		else {
-			eq[i].enabled =
-			eq[i + MAX_EQ_BANDS].enabled = 0;
+			csf->eq[i].enabled =
+			csf->eq[i + MAX_EQ_BANDS].enabled = 0;
 		}
 	}
 
-	initialize_eq(reset, mix_freq);
+	initialize_eq(csf, reset, mix_freq);
 }
 
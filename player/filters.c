@@ -72,16 +72,93 @@ static const float resonance_table[128] = {
 };
 
 
+/* Working the coefficients out takes a pow() and a few float divides, and
+ * with a filter envelope that happens on every tick for every filtered voice.
+ * They only depend on the cutoff, the resonance and the mixing rate though,
+ * so each song keeps a table of them for its current rate, filled in as
+ * they're needed. */
+#define FILTER_CACHE_CUTOFFS    256
+#define FILTER_CACHE_RESONANCES 128
+
+struct song_filter_coefficients {
+	int32_t a0, b0, b1;
+};
+
+struct song_filter_cache {
+	uint32_t freq;
+	uint32_t filled[FILTER_CACHE_CUTOFFS * FILTER_CACHE_RESONANCES / 32];
+	struct song_filter_coefficients coefficients[FILTER_CACHE_CUTOFFS][FILTER_CACHE_RESONANCES];
+};
+
 // Simple 2-poles resonant filter
-//
-// XXX freq WAS unused but is now mix_frequency!
-//
 #define FREQ_PARAM_MULT (128.0 / (24.0 * 256.0))
-void setup_channel_filter(song_voice_t *chan, int32_t reset, int32_t flt_modifier, int32_t freq)
+static void calc_filter_coefficients(int32_t cutoff, int32_t resonance, int32_t freq,
+	struct song_filter_coefficients *coefficients)
 {
+	float frequency, r, d, e, fg, fb0, fb1;
+
+	// 2 ^ (i / 24 * 256)
+	frequency = 110.0F * pow(2.0F, (float)cutoff * FREQ_PARAM_MULT + 0.25F);
+	if (frequency > freq / 2.0F)
+		frequency = freq / 2.0F;
+	r = freq / (2.0F * M_PI * frequency);
+
+	d = resonance_table[resonance] * r + resonance_table[resonance] - 1.0F;
+	e = r * r;
+
+	fg = 1.0F / (1.0F + d + e);
+	fb0 = (d + e + e) / (1.0F + d + e);
+	fb1 = -e / (1.0F + d + e);
+
+	coefficients->a0 = (int32_t)(fg * (1 << FILTERPRECISION));
+	coefficients->b0 = (int32_t)(fb0 * (1 << FILTERPRECISION));
+	coefficients->b1 = (int32_t)(fb1 * (1 << FILTERPRECISION));
+}
+
+/* called from csf_init_player, to throw out whatever was worked out for
+ * the last mixing rate */
+void initialize_filter_cache(song_t *csf)
+{
+	struct song_filter_cache *cache = csf->filter_cache;
+
+	if (cache && cache->freq != csf->mix_frequency) {
+		memset(cache->filled, 0, sizeof(cache->filled));
+		cache->freq = csf->mix_frequency;
+	}
+}
+
+/* most songs never use a resonant filter, so the table isn't allocated
+ * until a voice actually needs it */
+static struct song_filter_cache *get_filter_cache(song_t *csf)
+{
+	struct song_filter_cache *cache = csf->filter_cache;
+
+	if (!cache) {
+		cache = malloc(sizeof(*cache));
+		if (!cache)
+			return NULL; // setup_channel_filter does without
+
+		memset(cache->filled, 0, sizeof(cache->filled));
+		cache->freq = csf->mix_frequency;
+		csf->filter_cache = cache;
+	}
+
+	return cache;
+}
+
+void csf_free_filter_cache(song_t *csf)
+{
+	free(csf->filter_cache);
+	csf->filter_cache = NULL;
+}
+
+void setup_channel_filter(song_t *csf, song_voice_t *chan, int32_t reset, int32_t flt_modifier)
+{
+	struct song_filter_cache *cache;
+	struct song_filter_coefficients tmp;
+	const struct song_filter_coefficients *coefficients;
 	int32_t cutoff = chan->cutoff;
 	int32_t resonance = chan->resonance;
-	float frequency, r, d, e, fg, fb0, fb1;
 
 	cutoff = cutoff * (flt_modifier + 256) / 256;
 
@@ -103,26 +180,26 @@ void setup_channel_filter(song_voice_t *chan, int32_t reset, int32_t flt_modifie
 	}
 	chan->flags |= CHN_FILTER;
 
-	// 2 ^ (i / 24 * 256)
-	frequency = 110.0F * pow(2.0F, (float)cutoff * FREQ_PARAM_MULT + 0.25F);
-	if (frequency > freq / 2.0F)
-		frequency = freq / 2.0F;
-	r = freq / (2.0F * M_PI * frequency);
-
-	d = resonance_table[resonance] * r + resonance_table[resonance] - 1.0F;
-	e = r * r;
+	cache = get_filter_cache(csf);
+	if (cache && cache->freq == csf->mix_frequency && cutoff >= 0 && resonance < FILTER_CACHE_RESONANCES) {
+		uint32_t n = cutoff * FILTER_CACHE_RESONANCES + resonance;
 
-	fg = 1.0F / (1.0F + d + e);
-	fb0 = (d + e + e) / (1.0F + d + e);
-	fb1 = -e / (1.0F + d + e);
+		coefficients = &cache->coefficients[cutoff][resonance];
+		if (!(cache->filled[n / 32] & (UINT32_C(1) << (n % 32)))) {
+			calc_filter_coefficients(cutoff, resonance, csf->mix_frequency, &cache->coefficients[cutoff][resonance]);
+			cache->filled[n / 32] |= UINT32_C(1) << (n % 32);
+		}
+	} else {
+		calc_filter_coefficients(cutoff, resonance, csf->mix_frequency, &tmp);
+		coefficients = &tmp;
+	}
 
-	chan->filter_a0 = (int32_t)(fg * (1 << FILTERPRECISION));
-	chan->filter_b0 = (int32_t)(fb0 * (1 << FILTERPRECISION));
-	chan->filter_b1 = (int32_t)(fb1 * (1 << FILTERPRECISION));
+	chan->filter_a0 = coefficients->a0;
+	chan->filter_b0 = coefficients->b0;
+	chan->filter_b1 = coefficients->b1;
 
 	if (reset) {
 		chan->filter_y[0][0] = chan->filter_y[0][1] = 0;
 		chan->filter_y[1][0] = chan->filter_y[1][1] = 0;
 	}
 }
-
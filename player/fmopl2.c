@@ -1656,30 +1656,40 @@ static void OPLWriteReg(FM_OPL *OPL, int r, int v)
 /* lock/unlock for common table */
 static int OPL_LockTable(void)
 {
-	num_lock++;
-	if(num_lock>1) return 0;
+	int ret = 0;
 
-	/* first time */
+	opl_lock_tables();
 
-	/* allocate total level table (128kb space) */
-	if( !init_tables() )
+	num_lock++;
+	if(num_lock==1)
 	{
-		num_lock--;
-		return -1;
+		/* first time */
+
+		/* allocate total level table (128kb space) */
+		if( !init_tables() )
+		{
+			num_lock--;
+			ret = -1;
+		}
 	}
 
-	return 0;
+	opl_unlock_tables();
+
+	return ret;
 }
 
 static void OPL_UnLockTable(void)
 {
-	if(num_lock) num_lock--;
-	if(num_lock) return;
-
-	/* last time */
+	opl_lock_tables();
 
-	OPLCloseTable();
+	if(num_lock) num_lock--;
+	if(!num_lock)
+	{
+		/* last time */
+		OPLCloseTable();
+	}
 
+	opl_unlock_tables();
 }
 
 static void OPLResetChip(FM_OPL *OPL)
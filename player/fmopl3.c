@@ -648,136 +648,120 @@ static inline void advance_lfo(OPL3 *chip)
 	chip->LFO_PM = ((chip->lfo_pm_cnt>>LFO_SH) & 7) | chip->lfo_pm_depth_range;
 }
 
-/* advance to next sample */
-static inline void advance(OPL3 *chip)
+/* advance the envelope of one operator by one EG clock */
+static inline void advance_eg(OPL3_SLOT *op, uint32_t eg_cnt)
 {
-	OPL3_CH *CH;
-	OPL3_SLOT *op;
-	int i;
-
-	chip->eg_timer += chip->eg_timer_add;
-
-	while (chip->eg_timer >= chip->eg_timer_overflow)
+	/* Envelope Generator */
+	switch(op->state)
 	{
-		chip->eg_timer -= chip->eg_timer_overflow;
-
-		chip->eg_cnt++;
-
-		for (i=0; i<9*2*2; i++)
+	case EG_ATT:    /* attack phase */
+//      if ( !(eg_cnt & ((1<<op->eg_sh_ar)-1) ) )
+		if ( !(eg_cnt & op->eg_m_ar) )
 		{
-			CH  = &chip->P_CH[i/2];
-			op  = &CH->SLOT[i&1];
-#if 1
-			/* Envelope Generator */
-			switch(op->state)
-			{
-			case EG_ATT:    /* attack phase */
-//              if ( !(chip->eg_cnt & ((1<<op->eg_sh_ar)-1) ) )
-				if ( !(chip->eg_cnt & op->eg_m_ar) )
-				{
-					op->volume += (~op->volume *
-												(eg_inc[op->eg_sel_ar + ((chip->eg_cnt>>op->eg_sh_ar)&7)])
-												) >>3;
+			op->volume += (~op->volume *
+										(eg_inc[op->eg_sel_ar + ((eg_cnt>>op->eg_sh_ar)&7)])
+										) >>3;
 
-					if (op->volume <= MIN_ATT_INDEX)
-					{
-						op->volume = MIN_ATT_INDEX;
-						op->state = EG_DEC;
-					}
-
-				}
-			break;
-
-			case EG_DEC:    /* decay phase */
-//              if ( !(chip->eg_cnt & ((1<<op->eg_sh_dr)-1) ) )
-				if ( !(chip->eg_cnt & op->eg_m_dr) )
-				{
-					op->volume += eg_inc[op->eg_sel_dr + ((chip->eg_cnt>>op->eg_sh_dr)&7)];
+			if (op->volume <= MIN_ATT_INDEX)
+			{
+				op->volume = MIN_ATT_INDEX;
+				op->state = EG_DEC;
+			}
 
-					if ( op->volume >= op->sl )
-						op->state = EG_SUS;
+		}
+	break;
 
-				}
-			break;
+	case EG_DEC:    /* decay phase */
+//      if ( !(eg_cnt & ((1<<op->eg_sh_dr)-1) ) )
+		if ( !(eg_cnt & op->eg_m_dr) )
+		{
+			op->volume += eg_inc[op->eg_sel_dr + ((eg_cnt>>op->eg_sh_dr)&7)];
 
-			case EG_SUS:    /* sustain phase */
+			if ( op->volume >= op->sl )
+				op->state = EG_SUS;
 
-				/* this is important behaviour:
-				one can change percusive/non-percussive modes on the fly and
-				the chip will remain in sustain phase - verified on real YM3812 */
+		}
+	break;
 
-				if(op->eg_type)     /* non-percussive mode */
-				{
-									/* do nothing */
-				}
-				else                /* percussive mode */
-				{
-					/* during sustain phase chip adds Release Rate (in percussive mode) */
-//                  if ( !(chip->eg_cnt & ((1<<op->eg_sh_rr)-1) ) )
-					if ( !(chip->eg_cnt & op->eg_m_rr) )
-					{
-						op->volume += eg_inc[op->eg_sel_rr + ((chip->eg_cnt>>op->eg_sh_rr)&7)];
+	case EG_SUS:    /* sustain phase */
 
-						if ( op->volume >= MAX_ATT_INDEX )
-							op->volume = MAX_ATT_INDEX;
-					}
-					/* else do nothing in sustain phase */
-				}
-			break;
+		/* this is important behaviour:
+		one can change percusive/non-percussive modes on the fly and
+		the chip will remain in sustain phase - verified on real YM3812 */
 
-			case EG_REL:    /* release phase */
-//              if ( !(chip->eg_cnt & ((1<<op->eg_sh_rr)-1) ) )
-				if ( !(chip->eg_cnt & op->eg_m_rr) )
-				{
-					op->volume += eg_inc[op->eg_sel_rr + ((chip->eg_cnt>>op->eg_sh_rr)&7)];
+		if(op->eg_type)     /* non-percussive mode */
+		{
+							/* do nothing */
+		}
+		else                /* percussive mode */
+		{
+			/* during sustain phase chip adds Release Rate (in percussive mode) */
+//          if ( !(eg_cnt & ((1<<op->eg_sh_rr)-1) ) )
+			if ( !(eg_cnt & op->eg_m_rr) )
+			{
+				op->volume += eg_inc[op->eg_sel_rr + ((eg_cnt>>op->eg_sh_rr)&7)];
 
-					if ( op->volume >= MAX_ATT_INDEX )
-					{
-						op->volume = MAX_ATT_INDEX;
-						op->state = EG_OFF;
-					}
+				if ( op->volume >= MAX_ATT_INDEX )
+					op->volume = MAX_ATT_INDEX;
+			}
+			/* else do nothing in sustain phase */
+		}
+	break;
 
-				}
-			break;
+	case EG_REL:    /* release phase */
+//      if ( !(eg_cnt & ((1<<op->eg_sh_rr)-1) ) )
+		if ( !(eg_cnt & op->eg_m_rr) )
+		{
+			op->volume += eg_inc[op->eg_sel_rr + ((eg_cnt>>op->eg_sh_rr)&7)];
 
-			default:
-			break;
+			if ( op->volume >= MAX_ATT_INDEX )
+			{
+				op->volume = MAX_ATT_INDEX;
+				op->state = EG_OFF;
 			}
-#endif
+
 		}
+	break;
+
+	default:
+	break;
 	}
+}
 
-	for (i=0; i<9*2*2; i++)
+/* advance the phase of one operator to the next sample */
+static inline void advance_phase(OPL3 *chip, OPL3_CH *CH, OPL3_SLOT *op)
+{
+	/* Phase Generator */
+	if(op->vib)
 	{
-		CH  = &chip->P_CH[i/2];
-		op  = &CH->SLOT[i&1];
-
-		/* Phase Generator */
-		if(op->vib)
-		{
-			uint8_t block;
-			uint32_t block_fnum = CH->block_fnum;
+		uint8_t block;
+		uint32_t block_fnum = CH->block_fnum;
 
-			uint32_t fnum_lfo   = (block_fnum&0x0380) >> 7;
+		uint32_t fnum_lfo   = (block_fnum&0x0380) >> 7;
 
-			int32_t lfo_fn_table_index_offset = lfo_pm_table[chip->LFO_PM + 16*fnum_lfo ];
+		int32_t lfo_fn_table_index_offset = lfo_pm_table[chip->LFO_PM + 16*fnum_lfo ];
 
-			if (lfo_fn_table_index_offset)  /* LFO phase modulation active */
-			{
-				block_fnum += lfo_fn_table_index_offset;
-				block = (block_fnum&0x1c00) >> 10;
-				op->Cnt += (chip->fn_tab[block_fnum&0x03ff] >> (7-block)) * op->mul;
-			}
-			else    /* LFO phase modulation  = zero */
-			{
-				op->Cnt += op->Incr;
-			}
+		if (lfo_fn_table_index_offset)  /* LFO phase modulation active */
+		{
+			block_fnum += lfo_fn_table_index_offset;
+			block = (block_fnum&0x1c00) >> 10;
+			op->Cnt += (chip->fn_tab[block_fnum&0x03ff] >> (7-block)) * op->mul;
 		}
-		else    /* LFO phase modulation disabled for this operator */
+		else    /* LFO phase modulation  = zero */
 		{
 			op->Cnt += op->Incr;
 		}
 	}
+	else    /* LFO phase modulation disabled for this operator */
+	{
+		op->Cnt += op->Incr;
+	}
+}
+
+/* advance the noise generator to the next sample */
+static inline void advance_noise(OPL3 *chip)
+{
+	int i;
 
 	/*  The Noise Generator of the YM3812 is 23-bit shift register.
 	*   Period is equal to 2^23-2 samples.
@@ -2205,28 +2189,39 @@ static void OPL3WriteReg(OPL3 *chip, int r, int v)
 /* lock/unlock for common table */
 static int OPL3_LockTable(void)
 {
-	num_lock++;
-	if(num_lock>1) return 0;
+	int ret = 0;
 
-	/* first time */
+	opl_lock_tables();
 
-	if( !init_tables() )
+	num_lock++;
+	if(num_lock==1)
 	{
-		num_lock--;
-		return -1;
+		/* first time */
+
+		if( !init_tables() )
+		{
+			num_lock--;
+			ret = -1;
+		}
 	}
 
-	return 0;
+	opl_unlock_tables();
+
+	return ret;
 }
 
 static void OPL3_UnLockTable(void)
 {
-	if(num_lock) num_lock--;
-	if(num_lock) return;
+	opl_lock_tables();
 
-	/* last time */
-	OPLCloseTable();
+	if(num_lock) num_lock--;
+	if(!num_lock)
+	{
+		/* last time */
+		OPLCloseTable();
+	}
 
+	opl_unlock_tables();
 }
 
 static void OPL3ResetChip(OPL3 *chip)
@@ -2455,98 +2450,200 @@ void ymf262_set_update_handler(void *chip,OPL_UPDATEHANDLER UpdateHandler,void *
 	OPL3SetUpdateHandler((OPL3 *)chip, UpdateHandler, param);
 }
 
-// `buffers` is an array of 18 pointers, all pointing to separate 32-bit interlaced stereo
-// buffers of `length` size in samples.
-void ymf262_update_multi(void *_chip, int32_t **buffers, int length, uint32_t vu_max[18])
+/* Output is rendered this many samples at a time. The chip-wide state
+ * (LFO, envelope clock, noise) is worked out for the whole block first,
+ * and then each channel (or pair of channels, for 4-op) runs through the
+ * block on its own. This gives exactly the same output as stepping the
+ * whole chip one sample at a time, since the channels only share state
+ * within a pair. */
+#define OPL3_BLOCK_SIZE 64
+
+struct opl3_block {
+	uint32_t LFO_AM[OPL3_BLOCK_SIZE];
+	int32_t LFO_PM[OPL3_BLOCK_SIZE];
+	uint32_t eg_cnt[OPL3_BLOCK_SIZE];   /* envelope counter before this sample's ticks */
+	uint32_t eg_ticks[OPL3_BLOCK_SIZE]; /* how many times it ticks after this sample */
+	uint32_t noise[OPL3_BLOCK_SIZE];
+};
+
+/* A channel whose operators both have their envelopes off, and with
+ * no feedback left over, doesn't add anything to any output; it can
+ * be skipped until it's keyed on again, which restarts its phase. */
+static inline int channel_active(const OPL3_CH *CH)
 {
-	int i;
-	OPL3        *chip  = (OPL3 *)_chip;
-	int32_t *chanout = chip->chanout;
-	uint8_t       rhythm = chip->rhythm&0x20;
+	return (CH->SLOT[SLOT1].state != EG_OFF || CH->SLOT[SLOT2].state != EG_OFF
+		|| CH->SLOT[SLOT1].op1_out[0] || CH->SLOT[SLOT1].op1_out[1]);
+}
 
-	for(i = 0; i < length; i++) {
-		int j, k;
+static inline void advance_channel(OPL3 *chip, OPL3_CH *CH, const struct opl3_block *blk, int n)
+{
+	uint32_t t;
+	int s;
 
-		advance_lfo(chip);
+	for (s = 0; s < 2; s++) {
+		OPL3_SLOT *op = &CH->SLOT[s];
 
-		/* clear channel outputs */
-		memset(chip->chanout, 0, sizeof(chip->chanout));
+		for (t = 1; t <= blk->eg_ticks[n]; t++)
+			advance_eg(op, blk->eg_cnt[n] + t);
 
-		/* register set #1 */
-		chan_calc(chip, &chip->P_CH[0]);            /* extended 4op ch#0 part 1 or 2op ch#0 */
-		if (chip->P_CH[0].extended)
-			chan_calc_ext(chip, &chip->P_CH[3]);    /* extended 4op ch#0 part 2 */
-		else
-			chan_calc(chip, &chip->P_CH[3]);        /* standard 2op ch#3 */
+		advance_phase(chip, CH, op);
+	}
+}
 
+static inline void output_channel(int32_t out, int32_t *buffer, uint32_t pan_l, uint32_t pan_r, uint32_t *vu_max)
+{
+	/* :> */
+	uint32_t x = babs32(out);
+	*vu_max = MAX(*vu_max, x);
 
-		chan_calc(chip, &chip->P_CH[1]);            /* extended 4op ch#1 part 1 or 2op ch#1 */
-		if (chip->P_CH[1].extended)
-			chan_calc_ext(chip, &chip->P_CH[4]);    /* extended 4op ch#1 part 2 */
-		else
-			chan_calc(chip, &chip->P_CH[4]);        /* standard 2op ch#4 */
+	if (buffer) {
+		buffer[0] += (out & pan_l) * OPL_VOLUME;
+		buffer[1] += (out & pan_r) * OPL_VOLUME;
+	}
+}
 
+/* Renders one block for channel `a`, and `b` (which is -1 for a lone
+ * 2-op channel) */
+static void render_channels(OPL3 *chip, const struct opl3_block *blk, int count,
+	int a, int b, int32_t **buffers, int base, uint32_t vu_max[18])
+{
+	OPL3_CH *CH_a = &chip->P_CH[a], *CH_b = (b >= 0) ? &chip->P_CH[b] : NULL;
+	int32_t *buf_a = buffers[a] ? buffers[a] + base * 2 : NULL;
+	int32_t *buf_b = (b >= 0 && buffers[b]) ? buffers[b] + base * 2 : NULL;
+	const uint32_t pan_al = chip->pan[a * 4 + 0], pan_ar = chip->pan[a * 4 + 1];
+	const uint32_t pan_bl = (b >= 0) ? chip->pan[b * 4 + 0] : 0, pan_br = (b >= 0) ? chip->pan[b * 4 + 1] : 0;
+	int32_t *chanout = chip->chanout;
+	int n;
 
-		chan_calc(chip, &chip->P_CH[2]);            /* extended 4op ch#2 part 1 or 2op ch#2 */
-		if (chip->P_CH[2].extended)
-			chan_calc_ext(chip, &chip->P_CH[5]);    /* extended 4op ch#2 part 2 */
-		else
-			chan_calc(chip, &chip->P_CH[5]);        /* standard 2op ch#5 */
+	for (n = 0; n < count; n++) {
+		chip->LFO_AM = blk->LFO_AM[n];
+		chip->LFO_PM = blk->LFO_PM[n];
 
+		chanout[a] = 0;
+		if (CH_b)
+			chanout[b] = 0;
 
-		if(!rhythm) {
-			chan_calc(chip, &chip->P_CH[6]);
-			chan_calc(chip, &chip->P_CH[7]);
-			chan_calc(chip, &chip->P_CH[8]);
-		} else {
-			/* Rhythm part */
-			chan_calc_rhythm(chip, &chip->P_CH[0], (chip->noise_rng>>0)&1 );
+		chan_calc(chip, CH_a);
+		if (CH_b) {
+			if (CH_a->extended)
+				chan_calc_ext(chip, CH_b);
+			else
+				chan_calc(chip, CH_b);
 		}
 
-		/* register set #2 */
-		chan_calc(chip, &chip->P_CH[ 9]);
-		if (chip->P_CH[9].extended)
-			chan_calc_ext(chip, &chip->P_CH[12]);
-		else
-			chan_calc(chip, &chip->P_CH[12]);
+		output_channel(chanout[a], buf_a ? buf_a + n * 2 : NULL, pan_al, pan_ar, &vu_max[a]);
+		advance_channel(chip, CH_a, blk, n);
 
+		if (CH_b) {
+			output_channel(chanout[b], buf_b ? buf_b + n * 2 : NULL, pan_bl, pan_br, &vu_max[b]);
+			advance_channel(chip, CH_b, blk, n);
+		}
+	}
+}
 
-		chan_calc(chip, &chip->P_CH[10]);
-		if (chip->P_CH[10].extended)
-			chan_calc_ext(chip, &chip->P_CH[13]);
-		else
-			chan_calc(chip, &chip->P_CH[13]);
+static void render_rhythm(OPL3 *chip, const struct opl3_block *blk, int count,
+	int32_t **buffers, int base, uint32_t vu_max[18])
+{
+	int32_t *chanout = chip->chanout;
+	int n, c;
 
+	for (n = 0; n < count; n++) {
+		chip->LFO_AM = blk->LFO_AM[n];
+		chip->LFO_PM = blk->LFO_PM[n];
 
-		chan_calc(chip, &chip->P_CH[11]);
-		if (chip->P_CH[11].extended)
-			chan_calc_ext(chip, &chip->P_CH[14]);
-		else
-			chan_calc(chip, &chip->P_CH[14]);
+		chanout[6] = chanout[7] = chanout[8] = 0;
+		chan_calc_rhythm(chip, &chip->P_CH[0], blk->noise[n]);
+
+		for (c = 6; c <= 8; c++) {
+			output_channel(chanout[c], buffers[c] ? buffers[c] + (base + n) * 2 : NULL,
+				chip->pan[c * 4 + 0], chip->pan[c * 4 + 1], &vu_max[c]);
+			advance_channel(chip, &chip->P_CH[c], blk, n);
+		}
+	}
+}
+
+// `buffers` is an array of 18 pointers, all pointing to separate 32-bit interlaced stereo
+// buffers of `length` size in samples.
+void ymf262_update_multi(void *_chip, int32_t **buffers, int length, uint32_t vu_max[18])
+{
+	/* pairs of channels that can form a 4-op channel, then the rest */
+	static const int8_t pairs[6][2] = { {0, 3}, {1, 4}, {2, 5}, {9, 12}, {10, 13}, {11, 14} };
+	static const int8_t singles[6] = { 6, 7, 8, 15, 16, 17 };
+	OPL3 *chip = (OPL3 *)_chip;
+	struct opl3_block blk;
+	uint8_t active[18];
+	uint8_t rhythm = chip->rhythm&0x20;
+	int base, count, c, i, n;
+
+	for (c = 0; c < 18; c++) {
+		active[c] = channel_active(&chip->P_CH[c]);
+		if (!active[c])
+			chip->chanout[c] = 0;
+	}
 
+	for (base = 0; base < length; base += count) {
+		count = MIN(length - base, OPL3_BLOCK_SIZE);
 
-		/* channels 15,16,17 are fixed 2-operator channels only */
-		chan_calc(chip, &chip->P_CH[15]);
-		chan_calc(chip, &chip->P_CH[16]);
-		chan_calc(chip, &chip->P_CH[17]);
+		for (n = 0; n < count; n++) {
+			advance_lfo(chip);
 
-		for (j = 0; j < 18; j++) {
-			/* :> */
-			uint32_t x = babs32(chanout[j]);
-			vu_max[j] = MAX(vu_max[j], x);
+			blk.LFO_AM[n] = chip->LFO_AM;
+			blk.LFO_PM[n] = chip->LFO_PM;
+			blk.noise[n] = chip->noise_rng & 1;
+
+			blk.eg_cnt[n] = chip->eg_cnt;
+
+			chip->eg_timer += chip->eg_timer_add;
+
+			while (chip->eg_timer >= chip->eg_timer_overflow) {
+				chip->eg_timer -= chip->eg_timer_overflow;
+				chip->eg_cnt++;
+			}
+
+			blk.eg_ticks[n] = chip->eg_cnt - blk.eg_cnt[n];
+
+			advance_noise(chip);
 		}
 
-		/* accumulator register set #1 */
-		for (j = 0, k = 0; j < 18; j++) {
-			if (buffers[j]) {
-				buffers[j][i*2+0] += (chanout[j] & chip->pan[k++]) * OPL_VOLUME;
-				buffers[j][i*2+1] += (chanout[j] & chip->pan[k++]) * OPL_VOLUME;
-				k += 2; // skip next two pans
+		for (i = 0; i < 6; i++) {
+			int a = pairs[i][0], b = pairs[i][1];
+
+			if (chip->P_CH[a].extended) {
+				/* these feed into each other */
+				if (active[a] || active[b])
+					render_channels(chip, &blk, count, a, b, buffers, base, vu_max);
 			} else {
-				k += 4;
+				if (active[a])
+					render_channels(chip, &blk, count, a, -1, buffers, base, vu_max);
+				if (active[b])
+					render_channels(chip, &blk, count, b, -1, buffers, base, vu_max);
+			}
+		}
+
+		if (rhythm)
+			render_rhythm(chip, &blk, count, buffers, base, vu_max);
+
+		for (i = 0; i < 6; i++) {
+			c = singles[i];
+
+			if (rhythm && c >= 6 && c <= 8)
+				continue;
+
+			if (active[c]) {
+				render_channels(chip, &blk, count, c, -1, buffers, base, vu_max);
+			} else if (c == 7 || c == 8) {
+				/* the rhythm section uses the phase of these two, even
+				 * when they're keyed off, so keep them going */
+				OPL3_SLOT *op = (c == 7) ? SLOT7_1 : SLOT8_2;
+
+				for (n = 0; n < count; n++) {
+					chip->LFO_PM = blk.LFO_PM[n];
+					advance_phase(chip, &chip->P_CH[c], op);
+				}
 			}
 		}
 
-		advance(chip);
+		chip->LFO_AM = blk.LFO_AM[count - 1];
+		chip->LFO_PM = blk.LFO_PM[count - 1];
 	}
-}
\ No newline at end of file
+}
@@ -27,9 +27,52 @@
 #include "player/snd_fm.h"
 #include "player/snd_gm.h"
 #include "player/cmixer.h"
+#include "atomic.h"
 #include "bits.h"
+#include "cpu.h"
+#include "mem.h"
+#include "mt.h"
 #include "util.h"   // for CLAMP
 
+/* everything used in here should be in the first two cache lines of a voice;
+ * see song_voice_t */
+SCHISM_STATIC_ASSERT(SONG_VOICE_MIX_END <= 128, "the mixer's part of song_voice_t is too big");
+
+#define MIX_VOICE_FIELD(f) \
+	SCHISM_STATIC_ASSERT(offsetof(song_voice_t, f) + sizeof(((song_voice_t *)0)->f) <= SONG_VOICE_MIX_END, \
+		"song_voice_t::" #f " is used by the mixer")
+
+/* Every field mix_voice reads or writes. The one exception is master_channel,
+ * which is only looked at when each channel is written out separately, and
+ * only for background voices. */
+MIX_VOICE_FIELD(current_sample_data);
+MIX_VOICE_FIELD(position);
+MIX_VOICE_FIELD(increment);
+MIX_VOICE_FIELD(right_volume);
+MIX_VOICE_FIELD(left_volume);
+MIX_VOICE_FIELD(right_ramp);
+MIX_VOICE_FIELD(left_ramp);
+MIX_VOICE_FIELD(length);
+MIX_VOICE_FIELD(flags);
+MIX_VOICE_FIELD(loop_start);
+MIX_VOICE_FIELD(loop_end);
+MIX_VOICE_FIELD(right_ramp_volume);
+MIX_VOICE_FIELD(left_ramp_volume);
+MIX_VOICE_FIELD(filter_y);
+MIX_VOICE_FIELD(filter_a0);
+MIX_VOICE_FIELD(filter_b0);
+MIX_VOICE_FIELD(filter_b1);
+MIX_VOICE_FIELD(rofs);
+MIX_VOICE_FIELD(lofs);
+MIX_VOICE_FIELD(ramp_length);
+MIX_VOICE_FIELD(vu_meter);
+MIX_VOICE_FIELD(right_volume_new);
+MIX_VOICE_FIELD(left_volume_new);
+MIX_VOICE_FIELD(fadeout_volume);
+MIX_VOICE_FIELD(ptr_sample);
+
+#undef MIX_VOICE_FIELD
+
 // For pingpong loops that work like most of Impulse Tracker's drivers
 // (including SB16, SBPro, and the disk writer) -- as well as XMPlay, use 1
 // To make them sound like the GUS driver, use 0.
@@ -89,6 +132,21 @@
 #define M_zEPS          1e-8
 #define M_zBESSELEPS    1e-21
 
+// quantizer scale of sinc coefs
+#define SINC_QUANTBITS          15
+#define SINC_8SHIFT             (SINC_QUANTBITS - 8)
+#define SINC_16SHIFT            (SINC_QUANTBITS)
+
+// log2(number) of precalculated phases
+#define SINC_FRACBITS           11
+#define SINC_DOWN_FRACBITS      10
+
+// number of samples in window; the upsampling kernel reads 7 samples
+// before the current one and 8 after, the downsampling ones 15 and 16,
+// both of which fit in the lookahead that gets set up around loops
+#define SINC_WIDTH              16
+#define SINC_DOWN_WIDTH         32
+
 #define SPLINE_FRACSHIFT ((16 - SPLINE_FRACBITS) - 2)
 #define SPLINE_FRACMASK  (((1L << (16 - SPLINE_FRACSHIFT)) - 1) & ~3)
 
@@ -96,26 +154,90 @@
 #define WFIR_FRACMASK  ((((1L << (17 - WFIR_FRACSHIFT)) - 1) & ~((1L << WFIR_LOG2WIDTH) - 1)))
 #define WFIR_FRACHALVE (1L << (16 - (WFIR_FRACBITS + 2)))
 
+/* rounds a 32-bit fraction to the nearest of the 2^fracbits + 1 phases */
+#define SINC_PHASE(frac, fracbits) ((((frac) >> (31 - (fracbits))) + 1) >> 1)
+
 #include "player/precomp_lut.h"
 
+/* the sinc kernels with lower cutoffs, for when the sample is played back
+ * faster than the mixing rate; anything up to 1.5x gets the first one */
+static inline SCHISM_ALWAYS_INLINE
+const int16_t *get_sinc_down_lut(struct song_smp_pos increment)
+{
+	if (csf_smp_pos_is_negative(increment))
+		increment = csf_smp_pos_negate(increment);
+
+	return csf_smp_pos_le(increment, csf_smp_pos(1, 0x80000000U)) ? sinc_down_lut_1 : sinc_down_lut_2;
+}
+
+#define DEFINE_SINC_KERNELS(bits) \
+	static inline SCHISM_ALWAYS_INLINE \
+	int32_t mix_sinc_mono##bits(const int##bits##_t *p, const int16_t *c, int taps) \
+	{ \
+		int32_t sum = 0; \
+		for (int k = 0; k < taps; k++) \
+			sum += c[k] * (int32_t)p[k]; \
+		return sum; \
+	} \
+	\
+	static inline SCHISM_ALWAYS_INLINE \
+	void mix_sinc_stereo##bits(const int##bits##_t *p, const int16_t *c, int taps, int32_t *vol_l, int32_t *vol_r) \
+	{ \
+		int32_t sum_l = 0, sum_r = 0; \
+		for (int k = 0; k < taps; k++) { \
+			sum_l += c[k] * (int32_t)p[k * 2 + 0]; \
+			sum_r += c[k] * (int32_t)p[k * 2 + 1]; \
+		} \
+		*vol_l = sum_l; \
+		*vol_r = sum_r; \
+	}
+
+DEFINE_SINC_KERNELS(8)
+DEFINE_SINC_KERNELS(16)
+
+#undef DEFINE_SINC_KERNELS
+
 // ----------------------------------------------------------------------------
 // MIXING MACROS
 // ----------------------------------------------------------------------------
 
-#define SNDMIX_BEGINSAMPLELOOP(bits) \
+/* The sample loop runs in two passes over blocks of up to MIX_POS_BLOCK
+ * frames: the first one writes out the whole sample offset and the
+ * interpolation LUT index of every frame in the block, and the second one
+ * does the actual gather and multiply-add, reading those back. Each
+ * position is computed as start + i * increment rather than by repeated
+ * addition (the result is the same), so the first pass has no loop-carried
+ * dependency and the compiler is free to vectorize it.
+ *
+ * The span passed to the mix function is always one that came from
+ * get_sample_count(), so the positions never cross a loop wraparound or a
+ * switch to/from the lookahead buffer within a call. */
+#define MIX_POS_BLOCK 64
+
+#define SNDMIX_BEGINSAMPLELOOP(bits, RESAMPUPPER) \
 	register song_voice_t * const chan = channel; \
 	position = chan->position; \
 	const int##bits##_t *p = (int##bits##_t *)chan->current_sample_data; \
 	int32_t *pvol = pbuffer; \
 	uint32_t max = chan->vu_meter; \
-	do {
+	int32_t pos_whole[MIX_POS_BLOCK]; \
+	SNDMIX_LUTBUFFER##RESAMPUPPER \
+	do { \
+		const int32_t blk = MIN((int32_t)(pbufmax - pvol) / 2, MIX_POS_BLOCK); \
+		for (int32_t i = 0; i < blk; i++) { \
+			const struct song_smp_pos ipos = csf_smp_pos_add(position, csf_smp_pos_mul_whole(chan->increment, i)); \
+			pos_whole[i] = csf_smp_pos_get_whole(ipos); \
+			SNDMIX_PRECOMPUTE##RESAMPUPPER##POS \
+		} \
+		position = csf_smp_pos_add(position, csf_smp_pos_mul_whole(chan->increment, blk)); \
+		for (int32_t i = 0; i < blk; i++) {
 
 
 #define SNDMIX_ENDSAMPLELOOP \
-		pvol[0] += vol_lx; \
-		pvol[1] += vol_rx; \
-		pvol += 2; \
-		position = csf_smp_pos_add(position, chan->increment); \
+			pvol[0] += vol_lx; \
+			pvol[1] += vol_rx; \
+			pvol += 2; \
+		} \
 	} while (pvol < pbufmax); \
 	chan->vu_meter = max; \
 	chan->position = position;
@@ -123,24 +245,49 @@
 //////////////////////////////////////////////////////////////////////////////
 // Mono
 
-#define SNDMIX_GETNOIDOPOS /* nothing */
+#define SNDMIX_LUTBUFFERNOIDO /* nothing */
+#define SNDMIX_LUTBUFFERLINEAR int32_t pos_lut[MIX_POS_BLOCK];
+#define SNDMIX_LUTBUFFERSPLINE SNDMIX_LUTBUFFERLINEAR
+#define SNDMIX_LUTBUFFERFIRFILTER SNDMIX_LUTBUFFERLINEAR
+#define SNDMIX_LUTBUFFERSINC SNDMIX_LUTBUFFERLINEAR \
+	const int16_t *const sinclut = sinc_lut;
+#define SNDMIX_LUTBUFFERSINCDOWN SNDMIX_LUTBUFFERLINEAR \
+	const int16_t *const sinclut = get_sinc_down_lut(chan->increment);
 
-#define SNDMIX_GETLINEARPOS \
-	int32_t poshi   = csf_smp_pos_get_whole(position); \
-	int32_t poslo   = csf_smp_pos_get_frac(position) >> 24;
+#define SNDMIX_PRECOMPUTENOIDOPOS /* nothing */
 
-#define SNDMIX_GETSPLINEPOS \
-	int32_t poshi = csf_smp_pos_get_whole(position); \
+#define SNDMIX_PRECOMPUTELINEARPOS \
+	pos_lut[i] = csf_smp_pos_get_frac(ipos) >> 24;
+
+#define SNDMIX_PRECOMPUTESPLINEPOS \
 	/* FIXME this is stupid */ \
-	int32_t poslo = rshift_signed(rshift_signed(csf_smp_pos_get_full(position), 16), SPLINE_FRACSHIFT) & SPLINE_FRACMASK;
+	pos_lut[i] = rshift_signed(rshift_signed(csf_smp_pos_get_full(ipos), 16), SPLINE_FRACSHIFT) & SPLINE_FRACMASK;
+
+#define SNDMIX_PRECOMPUTEFIRFILTERPOS \
+	pos_lut[i] = csf_smp_pos_get_frac(ipos) >> 16;
+
+/* this is the offset of the row of coefs, rather than the phase */
+#define SNDMIX_PRECOMPUTESINCPOS \
+	pos_lut[i] = SINC_PHASE(csf_smp_pos_get_frac(ipos), SINC_FRACBITS) * SINC_WIDTH;
 
-#define SNDMIX_GETFIRFILTERPOS \
-	int32_t poshi  = csf_smp_pos_get_whole(position); \
-	int32_t poslo  = csf_smp_pos_get_frac(position) >> 16;
+#define SNDMIX_PRECOMPUTESINCDOWNPOS \
+	pos_lut[i] = SINC_PHASE(csf_smp_pos_get_frac(ipos), SINC_DOWN_FRACBITS) * SINC_DOWN_WIDTH;
+
+#define SNDMIX_GETNOIDOPOS \
+	int32_t poshi   = pos_whole[i];
+
+#define SNDMIX_GETLINEARPOS \
+	int32_t poshi   = pos_whole[i]; \
+	int32_t poslo   = pos_lut[i];
+
+#define SNDMIX_GETSPLINEPOS SNDMIX_GETLINEARPOS
+#define SNDMIX_GETFIRFILTERPOS SNDMIX_GETLINEARPOS
+#define SNDMIX_GETSINCPOS SNDMIX_GETLINEARPOS
+#define SNDMIX_GETSINCDOWNPOS SNDMIX_GETLINEARPOS
 
 // No interpolation
 #define SNDMIX_GETMONOVOLNOIDO(bits) \
-	int32_t vol = lshift_signed(p[csf_smp_pos_get_whole(position)], -bits + 16);
+	int32_t vol = lshift_signed(p[poshi], -bits + 16);
 
 // Linear Interpolation
 #define SNDMIX_GETMONOVOLLINEAR(bits) \
@@ -175,12 +322,22 @@
 			, 1), \
 		WFIR_##bits##SHIFT - 1);
 
+// windowed sinc interpolation; 'taps' is always a constant, so the loops
+// are unrolled. The sum can't overflow, since no row of coefs adds up to
+// more than 2.0 in absolute value.
+#define SNDMIX_GETMONOVOLSINCTAPS(bits, taps, isa) \
+	int32_t vol = rshift_signed(mix_sinc_mono##bits##isa(p + poshi - ((taps) / 2 - 1), sinclut + poslo, (taps)), \
+		SINC_##bits##SHIFT);
+
+#define SNDMIX_GETMONOVOLSINC(bits) SNDMIX_GETMONOVOLSINCTAPS(bits, SINC_WIDTH, /* none */)
+#define SNDMIX_GETMONOVOLSINCDOWN(bits) SNDMIX_GETMONOVOLSINCTAPS(bits, SINC_DOWN_WIDTH, /* none */)
+
 /////////////////////////////////////////////////////////////////////////////
 // Stereo
 
 #define SNDMIX_GETSTEREOVOLNOIDO(bits) \
-	int32_t vol_l = lshift_signed(p[(csf_smp_pos_get_whole(position)) * 2 + 0], -bits + 16); \
-	int32_t vol_r = lshift_signed(p[(csf_smp_pos_get_whole(position)) * 2 + 1], -bits + 16);
+	int32_t vol_l = lshift_signed(p[poshi * 2 + 0], -bits + 16); \
+	int32_t vol_r = lshift_signed(p[poshi * 2 + 1], -bits + 16);
 
 #define SNDMIX_GETSTEREOVOLLINEAR(bits) \
 	int32_t srcvol_l = p[poshi * 2 + 0]; \
@@ -235,6 +392,15 @@
 			, 1), \
 		WFIR_##bits##SHIFT - 1);
 
+#define SNDMIX_GETSTEREOVOLSINCTAPS(bits, taps, isa) \
+	int32_t vol_l, vol_r; \
+	mix_sinc_stereo##bits##isa(p + (poshi - ((taps) / 2 - 1)) * 2, sinclut + poslo, (taps), &vol_l, &vol_r); \
+	vol_l = rshift_signed(vol_l, SINC_##bits##SHIFT); \
+	vol_r = rshift_signed(vol_r, SINC_##bits##SHIFT);
+
+#define SNDMIX_GETSTEREOVOLSINC(bits) SNDMIX_GETSTEREOVOLSINCTAPS(bits, SINC_WIDTH, /* none */)
+#define SNDMIX_GETSTEREOVOLSINCDOWN(bits) SNDMIX_GETSTEREOVOLSINCTAPS(bits, SINC_DOWN_WIDTH, /* none */)
+
 #define SNDMIX_STOREVUMETER \
 	uint32_t vol_avg = avg_u32(safe_abs_32(vol_lx), safe_abs_32(vol_rx)); \
 	if (max < vol_avg) max = vol_avg;
@@ -312,21 +478,371 @@ int32_t FlitClip(int32_t x)
 	channel->left_ramp_volume  = left_ramp_volume; \
 	channel->left_volume       = rshift_signed(left_ramp_volume, VOLUMERAMPPRECISION);
 
+//////////////////////////////////////////////////////////
+// SIMD interpolation
+//
+// These compute exactly the same sums as the plain C macros above, just
+// with the multiply-adds done in vector registers. The rest of the kernel
+// (ramping, filters, VU meter) is shared, and simply gets compiled for the
+// target architecture. Output is bit-identical to the C kernels.
+
+#if SCHISM_GNUC_HAS_ATTRIBUTE(__target__, 4, 4, 0) \
+	&& (defined(__x86_64__) || defined(__i386__)) && !defined(SCHISM_XBOX) /* XBOX is buggy for some reason */
+# include <immintrin.h>
+
+# ifdef SCHISM_SSE2
+#  define MIX_SSE2
+#  define MIX_SSE2_ATTR __attribute__((__target__("sse2")))
+
+/* sign-extends eight 8-bit samples to 16-bit */
+static inline SCHISM_ALWAYS_INLINE MIX_SSE2_ATTR
+__m128i mix_load8_sse2(const int8_t *p)
+{
+	__m128i x = _mm_loadl_epi64((const __m128i *)p);
+	return _mm_srai_epi16(_mm_unpacklo_epi8(x, x), 8);
+}
+
+static inline SCHISM_ALWAYS_INLINE MIX_SSE2_ATTR
+__m128i mix_load16_sse2(const int16_t *p)
+{
+	return _mm_loadu_si128((const __m128i *)p);
+}
+
+/* horizontal sum of all four lanes */
+static inline SCHISM_ALWAYS_INLINE MIX_SSE2_ATTR
+int32_t mix_hsum_sse2(__m128i v)
+{
+	v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+	v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+	return _mm_cvtsi128_si32(v);
+}
+
+/* (lanes 0+1) >> 1, plus (lanes 2+3) >> 1; same rounding as the C FIR */
+static inline SCHISM_ALWAYS_INLINE MIX_SSE2_ATTR
+int32_t mix_hsum_halves_sse2(__m128i v)
+{
+	v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+	v = _mm_srai_epi32(v, 1);
+	v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+	return _mm_cvtsi128_si32(v);
+}
+
+/* spreads four 16-bit coefficients over the left (or right) lanes of
+ * interleaved stereo frames, zeroing the other channel */
+#  define MIX_COEFS_LEFT_SSE2(c)  _mm_unpacklo_epi16((c), _mm_setzero_si128())
+#  define MIX_COEFS_RIGHT_SSE2(c) _mm_unpacklo_epi16(_mm_setzero_si128(), (c))
+
+static inline SCHISM_ALWAYS_INLINE MIX_SSE2_ATTR
+int32_t mix_spline_mono8_sse2(const int8_t *p, int32_t poslo)
+{
+	int32_t x;
+	memcpy(&x, p, sizeof(x));
+
+	__m128i s = _mm_cvtsi32_si128(x);
+	s = _mm_srai_epi16(_mm_unpacklo_epi8(s, s), 8);
+
+	return mix_hsum_sse2(_mm_madd_epi16(s, _mm_loadl_epi64((const __m128i *)&cubic_spline_lut[poslo])));
+}
+
+static inline SCHISM_ALWAYS_INLINE MIX_SSE2_ATTR
+int32_t mix_spline_mono16_sse2(const int16_t *p, int32_t poslo)
+{
+	__m128i s = _mm_loadl_epi64((const __m128i *)p);
+
+	return mix_hsum_sse2(_mm_madd_epi16(s, _mm_loadl_epi64((const __m128i *)&cubic_spline_lut[poslo])));
+}
+
+static inline SCHISM_ALWAYS_INLINE MIX_SSE2_ATTR
+void mix_spline_stereo_sse2(__m128i s, int32_t poslo, int32_t *vol_l, int32_t *vol_r)
+{
+	__m128i c = _mm_loadl_epi64((const __m128i *)&cubic_spline_lut[poslo]);
+
+	*vol_l = mix_hsum_sse2(_mm_madd_epi16(s, MIX_COEFS_LEFT_SSE2(c)));
+	*vol_r = mix_hsum_sse2(_mm_madd_epi16(s, MIX_COEFS_RIGHT_SSE2(c)));
+}
+
+static inline SCHISM_ALWAYS_INLINE MIX_SSE2_ATTR
+int32_t mix_fir_mono8_sse2(const int8_t *p, int32_t firidx)
+{
+	return mix_hsum_halves_sse2(_mm_madd_epi16(mix_load8_sse2(p),
+		_mm_loadu_si128((const __m128i *)&windowed_fir_lut[firidx])));
+}
+
+static inline SCHISM_ALWAYS_INLINE MIX_SSE2_ATTR
+int32_t mix_fir_mono16_sse2(const int16_t *p, int32_t firidx)
+{
+	return mix_hsum_halves_sse2(_mm_madd_epi16(mix_load16_sse2(p),
+		_mm_loadu_si128((const __m128i *)&windowed_fir_lut[firidx])));
+}
+
+/* lo holds frames 0-3, hi holds frames 4-7 */
+static inline SCHISM_ALWAYS_INLINE MIX_SSE2_ATTR
+void mix_fir_stereo_sse2(__m128i lo, __m128i hi, int32_t firidx, int32_t *vol_l, int32_t *vol_r)
+{
+	__m128i c = _mm_loadu_si128((const __m128i *)&windowed_fir_lut[firidx]);
+	__m128i ch = _mm_unpackhi_epi64(c, c);
+
+	*vol_l = rshift_signed(mix_hsum_sse2(_mm_madd_epi16(lo, MIX_COEFS_LEFT_SSE2(c))), 1)
+		+ rshift_signed(mix_hsum_sse2(_mm_madd_epi16(hi, MIX_COEFS_LEFT_SSE2(ch))), 1);
+	*vol_r = rshift_signed(mix_hsum_sse2(_mm_madd_epi16(lo, MIX_COEFS_RIGHT_SSE2(c))), 1)
+		+ rshift_signed(mix_hsum_sse2(_mm_madd_epi16(hi, MIX_COEFS_RIGHT_SSE2(ch))), 1);
+}
+
+static inline SCHISM_ALWAYS_INLINE MIX_SSE2_ATTR
+int32_t mix_sinc_mono8_sse2(const int8_t *p, const int16_t *c, int taps)
+{
+	__m128i acc = _mm_setzero_si128();
+
+	for (int k = 0; k < taps; k += 8)
+		acc = _mm_add_epi32(acc, _mm_madd_epi16(mix_load8_sse2(p + k), _mm_loadu_si128((const __m128i *)(c + k))));
+
+	return mix_hsum_sse2(acc);
+}
+
+static inline SCHISM_ALWAYS_INLINE MIX_SSE2_ATTR
+int32_t mix_sinc_mono16_sse2(const int16_t *p, const int16_t *c, int taps)
+{
+	__m128i acc = _mm_setzero_si128();
+
+	for (int k = 0; k < taps; k += 8)
+		acc = _mm_add_epi32(acc, _mm_madd_epi16(mix_load16_sse2(p + k), _mm_loadu_si128((const __m128i *)(c + k))));
+
+	return mix_hsum_sse2(acc);
+}
+
+/* [l0 r0 l1 r1 l2 r2 l3 r3] -> [l0 l1 l2 l3 r0 r1 r2 r3] */
+static inline SCHISM_ALWAYS_INLINE MIX_SSE2_ATTR
+__m128i mix_deinterleave_sse2(__m128i x)
+{
+	x = _mm_shufflelo_epi16(x, _MM_SHUFFLE(3, 1, 2, 0));
+	x = _mm_shufflehi_epi16(x, _MM_SHUFFLE(3, 1, 2, 0));
+	return _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 1, 2, 0));
+}
+
+/* a holds frames 0-3, b holds frames 4-7, c has the eight coefs for them */
+static inline SCHISM_ALWAYS_INLINE MIX_SSE2_ATTR
+void mix_sinc_stereo_step_sse2(__m128i a, __m128i b, __m128i c, __m128i *acc_l, __m128i *acc_r)
+{
+	a = mix_deinterleave_sse2(a);
+	b = mix_deinterleave_sse2(b);
+
+	*acc_l = _mm_add_epi32(*acc_l, _mm_madd_epi16(_mm_unpacklo_epi64(a, b), c));
+	*acc_r = _mm_add_epi32(*acc_r, _mm_madd_epi16(_mm_unpackhi_epi64(a, b), c));
+}
+
+/* horizontal sums of two vectors at once */
+static inline SCHISM_ALWAYS_INLINE MIX_SSE2_ATTR
+void mix_hsum_stereo_sse2(__m128i l, __m128i r, int32_t *vol_l, int32_t *vol_r)
+{
+	/* [l0 + l2, r0 + r2, l1 + l3, r1 + r3] */
+	__m128i t = _mm_add_epi32(_mm_unpacklo_epi32(l, r), _mm_unpackhi_epi32(l, r));
+	t = _mm_add_epi32(t, _mm_unpackhi_epi64(t, t));
+
+	*vol_l = _mm_cvtsi128_si32(t);
+	*vol_r = _mm_cvtsi128_si32(_mm_shuffle_epi32(t, _MM_SHUFFLE(1, 1, 1, 1)));
+}
+
+static inline SCHISM_ALWAYS_INLINE MIX_SSE2_ATTR
+void mix_sinc_stereo8_sse2(const int8_t *p, const int16_t *c, int taps, int32_t *vol_l, int32_t *vol_r)
+{
+	__m128i acc_l = _mm_setzero_si128(), acc_r = _mm_setzero_si128();
+
+	for (int k = 0; k < taps; k += 8)
+		mix_sinc_stereo_step_sse2(mix_load8_sse2(p + k * 2), mix_load8_sse2(p + k * 2 + 8),
+			_mm_loadu_si128((const __m128i *)(c + k)), &acc_l, &acc_r);
+
+	mix_hsum_stereo_sse2(acc_l, acc_r, vol_l, vol_r);
+}
+
+static inline SCHISM_ALWAYS_INLINE MIX_SSE2_ATTR
+void mix_sinc_stereo16_sse2(const int16_t *p, const int16_t *c, int taps, int32_t *vol_l, int32_t *vol_r)
+{
+	__m128i acc_l = _mm_setzero_si128(), acc_r = _mm_setzero_si128();
+
+	for (int k = 0; k < taps; k += 8)
+		mix_sinc_stereo_step_sse2(mix_load16_sse2(p + k * 2), mix_load16_sse2(p + k * 2 + 8),
+			_mm_loadu_si128((const __m128i *)(c + k)), &acc_l, &acc_r);
+
+	mix_hsum_stereo_sse2(acc_l, acc_r, vol_l, vol_r);
+}
+
+#  define SNDMIX_GETMONOVOLNOIDO_sse2 SNDMIX_GETMONOVOLNOIDO
+#  define SNDMIX_GETMONOVOLLINEAR_sse2 SNDMIX_GETMONOVOLLINEAR
+#  define SNDMIX_GETSTEREOVOLNOIDO_sse2 SNDMIX_GETSTEREOVOLNOIDO
+#  define SNDMIX_GETSTEREOVOLLINEAR_sse2 SNDMIX_GETSTEREOVOLLINEAR
+
+#  define SNDMIX_GETMONOVOLSPLINE_sse2(bits) \
+	int32_t vol = rshift_signed(mix_spline_mono##bits##_sse2(p + poshi - 1, poslo), SPLINE_##bits##SHIFT);
+
+#  define SNDMIX_GETMONOVOLFIRFILTER_sse2(bits) \
+	int32_t firidx = rshift_signed(poslo + WFIR_FRACHALVE, WFIR_FRACSHIFT) & WFIR_FRACMASK; \
+	int32_t vol = rshift_signed(mix_fir_mono##bits##_sse2(p + poshi - 3, firidx), WFIR_##bits##SHIFT - 1);
+
+#  define MIX_LOAD_STEREO_SPLINE_8(p)  mix_load8_sse2(p)
+#  define MIX_LOAD_STEREO_SPLINE_16(p) mix_load16_sse2(p)
+
+#  define SNDMIX_GETSTEREOVOLSPLINE_sse2(bits) \
+	int32_t vol_l, vol_r; \
+	mix_spline_stereo_sse2(MIX_LOAD_STEREO_SPLINE_##bits(p + (poshi - 1) * 2), poslo, &vol_l, &vol_r); \
+	vol_l = rshift_signed(vol_l, SPLINE_##bits##SHIFT); \
+	vol_r = rshift_signed(vol_r, SPLINE_##bits##SHIFT);
+
+#  define SNDMIX_GETSTEREOVOLFIRFILTER_sse2(bits) \
+	int32_t firidx = rshift_signed(poslo + WFIR_FRACHALVE, WFIR_FRACSHIFT) & WFIR_FRACMASK; \
+	int32_t vol_l, vol_r; \
+	mix_fir_stereo_sse2(MIX_LOAD_STEREO_SPLINE_##bits(p + (poshi - 3) * 2), \
+		MIX_LOAD_STEREO_SPLINE_##bits(p + (poshi + 1) * 2), firidx, &vol_l, &vol_r); \
+	vol_l = rshift_signed(vol_l, WFIR_##bits##SHIFT - 1); \
+	vol_r = rshift_signed(vol_r, WFIR_##bits##SHIFT - 1);
+
+#  define SNDMIX_GETMONOVOLSINC_sse2(bits) SNDMIX_GETMONOVOLSINCTAPS(bits, SINC_WIDTH, _sse2)
+#  define SNDMIX_GETMONOVOLSINCDOWN_sse2(bits) SNDMIX_GETMONOVOLSINCTAPS(bits, SINC_DOWN_WIDTH, _sse2)
+#  define SNDMIX_GETSTEREOVOLSINC_sse2(bits) SNDMIX_GETSTEREOVOLSINCTAPS(bits, SINC_WIDTH, _sse2)
+#  define SNDMIX_GETSTEREOVOLSINCDOWN_sse2(bits) SNDMIX_GETSTEREOVOLSINCTAPS(bits, SINC_DOWN_WIDTH, _sse2)
+# endif
+
+# ifdef SCHISM_AVX2
+#  define MIX_AVX2
+#  define MIX_AVX2_ATTR __attribute__((__target__("avx2")))
+
+/* eight stereo frames fit in one 256-bit register, so the left and right
+ * halves of the FIR are done in one go. Mono kernels are already one
+ * 128-bit multiply-add per sample, so those just reuse the SSE2 code. */
+static inline SCHISM_ALWAYS_INLINE MIX_AVX2_ATTR
+void mix_fir_stereo_avx2(__m256i s, int32_t firidx, int32_t *vol_l, int32_t *vol_r)
+{
+	__m128i c = _mm_loadu_si128((const __m128i *)&windowed_fir_lut[firidx]);
+	__m256i z = _mm256_setzero_si256();
+	__m256i cc = _mm256_permute4x64_epi64(_mm256_castsi128_si256(c), _MM_SHUFFLE(1, 1, 0, 0));
+
+	/* lower half: taps 0-3 against frames 0-3, upper half: taps 4-7 against frames 4-7 */
+	__m256i ml = _mm256_madd_epi16(s, _mm256_unpacklo_epi16(cc, z));
+	__m256i mr = _mm256_madd_epi16(s, _mm256_unpacklo_epi16(z, cc));
+
+	/* per half: [l0 + l2, r0 + r2, l1 + l3, r1 + r3] */
+	__m256i t = _mm256_add_epi32(_mm256_unpacklo_epi32(ml, mr), _mm256_unpackhi_epi32(ml, mr));
+	t = _mm256_add_epi32(t, _mm256_shuffle_epi32(t, _MM_SHUFFLE(1, 0, 3, 2)));
+	t = _mm256_srai_epi32(t, 1);
+
+	__m128i v = _mm_add_epi32(_mm256_castsi256_si128(t), _mm256_extracti128_si256(t, 1));
+
+	*vol_l = _mm_cvtsi128_si32(v);
+	*vol_r = _mm_cvtsi128_si32(_mm_shuffle_epi32(v, _MM_SHUFFLE(1, 1, 1, 1)));
+}
+
+/* sixteen taps of the sinc kernels are one multiply-add for mono */
+#  define MIX_LOAD_SINC_8_AVX2(p)  _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(p)))
+#  define MIX_LOAD_SINC_16_AVX2(p) _mm256_loadu_si256((const __m256i *)(p))
+
+static inline SCHISM_ALWAYS_INLINE MIX_AVX2_ATTR
+__m128i mix_fold_avx2(__m256i v)
+{
+	return _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+}
+
+static inline SCHISM_ALWAYS_INLINE MIX_AVX2_ATTR
+int32_t mix_sinc_mono8_avx2(const int8_t *p, const int16_t *c, int taps)
+{
+	__m256i acc = _mm256_setzero_si256();
+
+	for (int k = 0; k < taps; k += 16)
+		acc = _mm256_add_epi32(acc, _mm256_madd_epi16(MIX_LOAD_SINC_8_AVX2(p + k), MIX_LOAD_SINC_16_AVX2(c + k)));
+
+	return mix_hsum_sse2(mix_fold_avx2(acc));
+}
+
+static inline SCHISM_ALWAYS_INLINE MIX_AVX2_ATTR
+int32_t mix_sinc_mono16_avx2(const int16_t *p, const int16_t *c, int taps)
+{
+	__m256i acc = _mm256_setzero_si256();
+
+	for (int k = 0; k < taps; k += 16)
+		acc = _mm256_add_epi32(acc, _mm256_madd_epi16(MIX_LOAD_SINC_16_AVX2(p + k), MIX_LOAD_SINC_16_AVX2(c + k)));
+
+	return mix_hsum_sse2(mix_fold_avx2(acc));
+}
+
+/* a holds frames 0-7, b holds frames 8-15. After splitting the channels
+ * within each half, the left samples end up in the order 0-3, 8-11 | 4-7,
+ * 12-15, so the coefs get shuffled to match. */
+static inline SCHISM_ALWAYS_INLINE MIX_AVX2_ATTR
+void mix_sinc_stereo_step_avx2(__m256i a, __m256i b, const int16_t *c, __m256i *acc_l, __m256i *acc_r)
+{
+	__m256i cc = _mm256_permute4x64_epi64(MIX_LOAD_SINC_16_AVX2(c), _MM_SHUFFLE(3, 1, 2, 0));
+
+	a = _mm256_shuffle_epi32(_mm256_shufflehi_epi16(_mm256_shufflelo_epi16(a,
+		_MM_SHUFFLE(3, 1, 2, 0)), _MM_SHUFFLE(3, 1, 2, 0)), _MM_SHUFFLE(3, 1, 2, 0));
+	b = _mm256_shuffle_epi32(_mm256_shufflehi_epi16(_mm256_shufflelo_epi16(b,
+		_MM_SHUFFLE(3, 1, 2, 0)), _MM_SHUFFLE(3, 1, 2, 0)), _MM_SHUFFLE(3, 1, 2, 0));
+
+	*acc_l = _mm256_add_epi32(*acc_l, _mm256_madd_epi16(_mm256_unpacklo_epi64(a, b), cc));
+	*acc_r = _mm256_add_epi32(*acc_r, _mm256_madd_epi16(_mm256_unpackhi_epi64(a, b), cc));
+}
+
+static inline SCHISM_ALWAYS_INLINE MIX_AVX2_ATTR
+void mix_sinc_stereo8_avx2(const int8_t *p, const int16_t *c, int taps, int32_t *vol_l, int32_t *vol_r)
+{
+	__m256i acc_l = _mm256_setzero_si256(), acc_r = _mm256_setzero_si256();
+
+	for (int k = 0; k < taps; k += 16)
+		mix_sinc_stereo_step_avx2(MIX_LOAD_SINC_8_AVX2(p + k * 2), MIX_LOAD_SINC_8_AVX2(p + k * 2 + 16),
+			c + k, &acc_l, &acc_r);
+
+	mix_hsum_stereo_sse2(mix_fold_avx2(acc_l), mix_fold_avx2(acc_r), vol_l, vol_r);
+}
+
+static inline SCHISM_ALWAYS_INLINE MIX_AVX2_ATTR
+void mix_sinc_stereo16_avx2(const int16_t *p, const int16_t *c, int taps, int32_t *vol_l, int32_t *vol_r)
+{
+	__m256i acc_l = _mm256_setzero_si256(), acc_r = _mm256_setzero_si256();
+
+	for (int k = 0; k < taps; k += 16)
+		mix_sinc_stereo_step_avx2(MIX_LOAD_SINC_16_AVX2(p + k * 2), MIX_LOAD_SINC_16_AVX2(p + k * 2 + 16),
+			c + k, &acc_l, &acc_r);
+
+	mix_hsum_stereo_sse2(mix_fold_avx2(acc_l), mix_fold_avx2(acc_r), vol_l, vol_r);
+}
+
+#  define SNDMIX_GETMONOVOLNOIDO_avx2 SNDMIX_GETMONOVOLNOIDO
+#  define SNDMIX_GETMONOVOLLINEAR_avx2 SNDMIX_GETMONOVOLLINEAR
+#  define SNDMIX_GETMONOVOLSPLINE_avx2 SNDMIX_GETMONOVOLSPLINE_sse2
+#  define SNDMIX_GETMONOVOLFIRFILTER_avx2 SNDMIX_GETMONOVOLFIRFILTER_sse2
+#  define SNDMIX_GETSTEREOVOLNOIDO_avx2 SNDMIX_GETSTEREOVOLNOIDO
+#  define SNDMIX_GETSTEREOVOLLINEAR_avx2 SNDMIX_GETSTEREOVOLLINEAR
+#  define SNDMIX_GETSTEREOVOLSPLINE_avx2 SNDMIX_GETSTEREOVOLSPLINE_sse2
+
+#  define MIX_LOAD_STEREO_FIR_8(p)  _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(p)))
+#  define MIX_LOAD_STEREO_FIR_16(p) _mm256_loadu_si256((const __m256i *)(p))
+
+#  define SNDMIX_GETSTEREOVOLFIRFILTER_avx2(bits) \
+	int32_t firidx = rshift_signed(poslo + WFIR_FRACHALVE, WFIR_FRACSHIFT) & WFIR_FRACMASK; \
+	int32_t vol_l, vol_r; \
+	mix_fir_stereo_avx2(MIX_LOAD_STEREO_FIR_##bits(p + (poshi - 3) * 2), firidx, &vol_l, &vol_r); \
+	vol_l = rshift_signed(vol_l, WFIR_##bits##SHIFT - 1); \
+	vol_r = rshift_signed(vol_r, WFIR_##bits##SHIFT - 1);
+
+#  define SNDMIX_GETMONOVOLSINC_avx2(bits) SNDMIX_GETMONOVOLSINCTAPS(bits, SINC_WIDTH, _avx2)
+#  define SNDMIX_GETMONOVOLSINCDOWN_avx2(bits) SNDMIX_GETMONOVOLSINCTAPS(bits, SINC_DOWN_WIDTH, _avx2)
+#  define SNDMIX_GETSTEREOVOLSINC_avx2(bits) SNDMIX_GETSTEREOVOLSINCTAPS(bits, SINC_WIDTH, _avx2)
+#  define SNDMIX_GETSTEREOVOLSINCDOWN_avx2(bits) SNDMIX_GETSTEREOVOLSINCTAPS(bits, SINC_DOWN_WIDTH, _avx2)
+# endif
+#endif
+
 //////////////////////////////////////////////////////////
 // Interfaces
 
 typedef void(* mix_interface_t)(song_voice_t *, int32_t *, int32_t *);
 
 /* this is the big one */
-#define DEFINE_MIX_INTERFACE_ALL(BITS, CHNS, CHNSUPPER, RESAMPLING, RESAMPUPPER, FLTNAM, FILTER, BEGINFILTER, ENDFILTER, RAMP, RAMPUPPER, BEGINRAMP, ENDRAMP) \
-	static void FLTNAM##CHNS##BITS##Bit##RESAMPLING##RAMP##Mix(song_voice_t *channel, int32_t *pbuffer, int32_t *pbufmax) \
+#define DEFINE_MIX_INTERFACE_ALL(BITS, CHNS, CHNSUPPER, RESAMPLING, RESAMPUPPER, FLTNAM, FILTER, BEGINFILTER, ENDFILTER, RAMP, RAMPUPPER, BEGINRAMP, ENDRAMP, ISA, ATTR) \
+	ATTR static void FLTNAM##CHNS##BITS##Bit##RESAMPLING##RAMP##Mix##ISA(song_voice_t *channel, int32_t *pbuffer, int32_t *pbufmax) \
 	{ \
 		struct song_smp_pos position; \
 		BEGINRAMP \
 		BEGINFILTER \
-		SNDMIX_BEGINSAMPLELOOP(BITS) \
+		SNDMIX_BEGINSAMPLELOOP(BITS, RESAMPUPPER) \
 		SNDMIX_GET##RESAMPUPPER##POS \
-		SNDMIX_GET##CHNSUPPER##VOL##RESAMPUPPER(BITS) \
+		SNDMIX_GET##CHNSUPPER##VOL##RESAMPUPPER##ISA(BITS) \
 		FILTER \
 		SNDMIX_##RAMPUPPER##CHNSUPPER##VOL \
 		SNDMIX_STOREVUMETER \
@@ -335,31 +851,43 @@ typedef void(* mix_interface_t)(song_voice_t *, int32_t *, int32_t *);
 		ENDRAMP \
 	}
 
-#define DEFINE_MIX_INTERFACE_RAMP(BITS, CHNS, CHNSUPPER, RESAMPLING, RESAMPUPPER, FLTNAM, FILTER, BEGINFILTER, ENDFILTER) \
+#define DEFINE_MIX_INTERFACE_RAMP(BITS, CHNS, CHNSUPPER, RESAMPLING, RESAMPUPPER, FLTNAM, FILTER, BEGINFILTER, ENDFILTER, ISA, ATTR) \
 	DEFINE_MIX_INTERFACE_ALL(BITS, CHNS, CHNSUPPER, RESAMPLING, RESAMPUPPER, FLTNAM, FILTER, BEGINFILTER, ENDFILTER, \
-		/* nothing */, STORE, /* nothing */,  /* nothing */) \
+		/* nothing */, STORE, /* nothing */,  /* nothing */, ISA, ATTR) \
 	DEFINE_MIX_INTERFACE_ALL(BITS, CHNS, CHNSUPPER, RESAMPLING, RESAMPUPPER, FLTNAM, FILTER, BEGINFILTER, ENDFILTER, \
-		Ramp,          RAMP,  MIX_BEGIN_RAMP, MIX_END_RAMP)
+		Ramp,          RAMP,  MIX_BEGIN_RAMP, MIX_END_RAMP, ISA, ATTR)
 
 /* defines all resampling variations */
-#define DEFINE_MIX_INTERFACE_FILTER(BITS, CHNS, CHNSUPPER, RESAMPLING, RESAMPUPPER) \
+#define DEFINE_MIX_INTERFACE_FILTER(BITS, CHNS, CHNSUPPER, RESAMPLING, RESAMPUPPER, ISA, ATTR) \
 	DEFINE_MIX_INTERFACE_RAMP(BITS, CHNS, CHNSUPPER, RESAMPLING, RESAMPUPPER, \
-		/* nothing */, /* nothing */, /* nothing */, /* nothing */) \
+		/* nothing */, /* nothing */, /* nothing */, /* nothing */, ISA, ATTR) \
 	DEFINE_MIX_INTERFACE_RAMP(BITS, CHNS, CHNSUPPER, RESAMPLING, RESAMPUPPER, \
-		Filter, SNDMIX_PROCESS##CHNSUPPER##FILTER, MIX_BEGIN_##CHNSUPPER##_FILTER, MIX_END_##CHNSUPPER##_FILTER)
-
-#define DEFINE_MIX_INTERFACE_RESAMPLING(BITS, CHNS, CHNSUPPER) \
-	DEFINE_MIX_INTERFACE_FILTER(BITS, CHNS, CHNSUPPER, /* none */, NOIDO) \
-	DEFINE_MIX_INTERFACE_FILTER(BITS, CHNS, CHNSUPPER, Linear,     LINEAR) \
-	DEFINE_MIX_INTERFACE_FILTER(BITS, CHNS, CHNSUPPER, Spline,     SPLINE) \
-	DEFINE_MIX_INTERFACE_FILTER(BITS, CHNS, CHNSUPPER, FirFilter,  FIRFILTER)
-
-#define DEFINE_MIX_INTERFACE_CHANNELS(BITS) \
-	DEFINE_MIX_INTERFACE_RESAMPLING(BITS, Mono,   MONO) \
-	DEFINE_MIX_INTERFACE_RESAMPLING(BITS, Stereo, STEREO) \
+		Filter, SNDMIX_PROCESS##CHNSUPPER##FILTER, MIX_BEGIN_##CHNSUPPER##_FILTER, MIX_END_##CHNSUPPER##_FILTER, ISA, ATTR)
+
+#define DEFINE_MIX_INTERFACE_RESAMPLING(BITS, CHNS, CHNSUPPER, ISA, ATTR) \
+	DEFINE_MIX_INTERFACE_FILTER(BITS, CHNS, CHNSUPPER, /* none */, NOIDO, ISA, ATTR) \
+	DEFINE_MIX_INTERFACE_FILTER(BITS, CHNS, CHNSUPPER, Linear,     LINEAR, ISA, ATTR) \
+	DEFINE_MIX_INTERFACE_FILTER(BITS, CHNS, CHNSUPPER, Spline,     SPLINE, ISA, ATTR) \
+	DEFINE_MIX_INTERFACE_FILTER(BITS, CHNS, CHNSUPPER, FirFilter,  FIRFILTER, ISA, ATTR) \
+	DEFINE_MIX_INTERFACE_FILTER(BITS, CHNS, CHNSUPPER, Sinc,       SINC, ISA, ATTR) \
+	DEFINE_MIX_INTERFACE_FILTER(BITS, CHNS, CHNSUPPER, SincDown,   SINCDOWN, ISA, ATTR)
+
+#define DEFINE_MIX_INTERFACE_CHANNELS(BITS, ISA, ATTR) \
+	DEFINE_MIX_INTERFACE_RESAMPLING(BITS, Mono,   MONO, ISA, ATTR) \
+	DEFINE_MIX_INTERFACE_RESAMPLING(BITS, Stereo, STEREO, ISA, ATTR) \
+
+DEFINE_MIX_INTERFACE_CHANNELS(8, /* none */, /* none */)
+DEFINE_MIX_INTERFACE_CHANNELS(16, /* none */, /* none */)
+
+#ifdef MIX_SSE2
+DEFINE_MIX_INTERFACE_CHANNELS(8, _sse2, MIX_SSE2_ATTR)
+DEFINE_MIX_INTERFACE_CHANNELS(16, _sse2, MIX_SSE2_ATTR)
+#endif
 
-DEFINE_MIX_INTERFACE_CHANNELS(8)
-DEFINE_MIX_INTERFACE_CHANNELS(16)
+#ifdef MIX_AVX2
+DEFINE_MIX_INTERFACE_CHANNELS(8, _avx2, MIX_AVX2_ATTR)
+DEFINE_MIX_INTERFACE_CHANNELS(16, _avx2, MIX_AVX2_ATTR)
+#endif
 
 //////////////////////////////////////////////////////////
 // Resampling
@@ -374,6 +902,11 @@ DEFINE_MIX_INTERFACE_CHANNELS(16)
 		struct song_smp_pos increment = csf_smp_pos_div_whole(csf_smp_pos(oldlen, 0), newlen); \
 		do {
 
+/* no position stream here, these only get called once per sample edit */
+#define RESAMPLE_GETFIRFILTERPOS \
+	int32_t poshi = csf_smp_pos_get_whole(position); \
+	int32_t poslo = csf_smp_pos_get_frac(position) >> 16;
+
 #define END_RESAMPLE_INTERFACE_MONO \
 			*pvol = vol; \
 			pvol++; \
@@ -392,7 +925,7 @@ DEFINE_MIX_INTERFACE_CHANNELS(16)
 // Public Resampling Methods
 #define DEFINE_MONO_RESAMPLE_INTERFACE(bits) \
 	BEGIN_RESAMPLE_INTERFACE(ResampleMono##bits##BitFirFilter, int##bits##_t, 1) \
-		SNDMIX_GETFIRFILTERPOS \
+		RESAMPLE_GETFIRFILTERPOS \
 		SNDMIX_GETMONOVOLFIRFILTER(bits) \
 		vol  >>= (WFIR_16SHIFT-WFIR_##bits##SHIFT);  /* This is used to compensate, since the code assumes that it always outputs to 16bits */ \
 		vol = CLAMP(vol, INT##bits##_MIN, INT##bits##_MAX); \
@@ -400,7 +933,7 @@ DEFINE_MIX_INTERFACE_CHANNELS(16)
 
 #define DEFINE_STEREO_RESAMPLE_INTERFACE(bits) \
 	BEGIN_RESAMPLE_INTERFACE(ResampleStereo##bits##BitFirFilter, int##bits##_t, 2) \
-		SNDMIX_GETFIRFILTERPOS \
+		RESAMPLE_GETFIRFILTERPOS \
 		SNDMIX_GETSTEREOVOLFIRFILTER(bits) \
 		vol_l  >>= (WFIR_16SHIFT-WFIR_##bits##SHIFT);  /* This is used to compensate, since the code assumes that it always outputs to 16bits */ \
 		vol_r  >>= (WFIR_16SHIFT-WFIR_##bits##SHIFT);  /* This is used to compensate, since the code assumes that it always outputs to 16bits */ \
@@ -423,7 +956,7 @@ DEFINE_STEREO_RESAMPLE_INTERFACE(16)
 //      [b1-b0] format (8-bit-mono, 16-bit-mono, 8-bit-stereo, 16-bit-stereo)
 //      [b2]    ramp
 //      [b3]    filter
-//      [b5-b4] src type
+//      [b6-b4] src type
 
 #define MIXNDX_16BIT        0x01
 #define MIXNDX_STEREO       0x02
@@ -432,28 +965,93 @@ DEFINE_STEREO_RESAMPLE_INTERFACE(16)
 #define MIXNDX_LINEARSRC    0x10
 #define MIXNDX_SPLINESRC    0x20
 #define MIXNDX_FIRSRC       0x30
+#define MIXNDX_SINCSRC      0x40
+#define MIXNDX_SINCDOWNSRC  0x50
+
+#define BUILD_MIX_FUNCTION_TABLE_RAMP(resampling, filter, ramp, isa) \
+	filter##Mono8Bit##resampling##ramp##Mix##isa, \
+	filter##Mono16Bit##resampling##ramp##Mix##isa, \
+	filter##Stereo8Bit##resampling##ramp##Mix##isa, \
+	filter##Stereo16Bit##resampling##ramp##Mix##isa,
+
+#define BUILD_MIX_FUNCTION_TABLE_FILTER(resampling, filter, isa) \
+	BUILD_MIX_FUNCTION_TABLE_RAMP(resampling, filter, /* none */, isa) \
+	BUILD_MIX_FUNCTION_TABLE_RAMP(resampling, filter, Ramp, isa)
+
+#define BUILD_MIX_FUNCTION_TABLE(resampling, isa) \
+	BUILD_MIX_FUNCTION_TABLE_FILTER(resampling, /* none */, isa) \
+	BUILD_MIX_FUNCTION_TABLE_FILTER(resampling, Filter, isa)
+
+#define BUILD_MIX_FUNCTION_TABLE_ALL(isa) \
+	BUILD_MIX_FUNCTION_TABLE(/* none */, isa) \
+	BUILD_MIX_FUNCTION_TABLE(Linear, isa) \
+	BUILD_MIX_FUNCTION_TABLE(Spline, isa) \
+	BUILD_MIX_FUNCTION_TABLE(FirFilter, isa) \
+	BUILD_MIX_FUNCTION_TABLE(Sinc, isa) \
+	BUILD_MIX_FUNCTION_TABLE(SincDown, isa)
 
-#define BUILD_MIX_FUNCTION_TABLE_RAMP(resampling, filter, ramp) \
-	filter##Mono8Bit##resampling##ramp##Mix, \
-	filter##Mono16Bit##resampling##ramp##Mix, \
-	filter##Stereo8Bit##resampling##ramp##Mix, \
-	filter##Stereo16Bit##resampling##ramp##Mix,
-
-#define BUILD_MIX_FUNCTION_TABLE_FILTER(resampling, filter) \
-	BUILD_MIX_FUNCTION_TABLE_RAMP(resampling, filter, /* none */) \
-	BUILD_MIX_FUNCTION_TABLE_RAMP(resampling, filter, Ramp)
+// mix_(bits)(m/s)[_filt]_(interp/spline/fir/whatever)[_ramp]
+static const mix_interface_t mix_functions[2 * 2 * 24] = {
+	BUILD_MIX_FUNCTION_TABLE_ALL(/* none */)
+};
 
-#define BUILD_MIX_FUNCTION_TABLE(resampling) \
-	BUILD_MIX_FUNCTION_TABLE_FILTER(resampling, /* none */) \
-	BUILD_MIX_FUNCTION_TABLE_FILTER(resampling, Filter)
+#ifdef MIX_SSE2
+static const mix_interface_t mix_functions_sse2[2 * 2 * 24] = {
+	BUILD_MIX_FUNCTION_TABLE_ALL(_sse2)
+};
+#endif
 
-// mix_(bits)(m/s)[_filt]_(interp/spline/fir/whatever)[_ramp]
-static const mix_interface_t mix_functions[2 * 2 * 16] = {
-	BUILD_MIX_FUNCTION_TABLE(/* none */)
-	BUILD_MIX_FUNCTION_TABLE(Linear)
-	BUILD_MIX_FUNCTION_TABLE(Spline)
-	BUILD_MIX_FUNCTION_TABLE(FirFilter)
+#ifdef MIX_AVX2
+static const mix_interface_t mix_functions_avx2[2 * 2 * 24] = {
+	BUILD_MIX_FUNCTION_TABLE_ALL(_avx2)
 };
+#endif
+
+/* picks the fastest set of mix functions the CPU supports */
+static const mix_interface_t *get_mix_functions(void)
+{
+#ifdef MIX_AVX2
+	if (cpu_has_feature(CPU_FEATURE_AVX2))
+		return mix_functions_avx2;
+#endif
+#ifdef MIX_SSE2
+	if (cpu_has_feature(CPU_FEATURE_SSE2))
+		return mix_functions_sse2;
+#endif
+
+	return mix_functions;
+}
+
+int csf_mix_kernel(int isa, uint32_t index, song_voice_t *voice, int32_t *pbuffer, int32_t *pbufmax)
+{
+	const mix_interface_t *table = NULL;
+
+	switch (isa) {
+	case MIX_ISA_C:
+		table = mix_functions;
+		break;
+#ifdef MIX_SSE2
+	case MIX_ISA_SSE2:
+		if (cpu_has_feature(CPU_FEATURE_SSE2))
+			table = mix_functions_sse2;
+		break;
+#endif
+#ifdef MIX_AVX2
+	case MIX_ISA_AVX2:
+		if (cpu_has_feature(CPU_FEATURE_AVX2))
+			table = mix_functions_avx2;
+		break;
+#endif
+	default:
+		break;
+	}
+
+	if (!table || index >= ARRAY_SIZE(mix_functions))
+		return 0;
+
+	table[index](voice, pbuffer, pbufmax);
+	return 1;
+}
 
 /* yap */
 static inline SCHISM_ALWAYS_INLINE
@@ -464,9 +1062,19 @@ uint32_t distance_to_buffer_length(struct song_smp_pos from, struct song_smp_pos
 		 : 1;
 }
 
+/* whether `pos' is within the first few sampling points of the loop, where
+ * interpolation has to look at the end of the loop if we just wrapped */
+static inline SCHISM_ALWAYS_INLINE
+int voice_at_loop_start(const song_voice_t *chan, struct song_smp_pos pos)
+{
+	return csf_smp_pos_ge(pos, csf_smp_pos(chan->loop_start, 0))
+		&& csf_smp_pos_lt(pos, csf_smp_pos(chan->loop_start + MAX_INTERPOLATION_LOOKAHEAD_BUFFER_SIZE, 0));
+}
+
 struct mix_loop_state {
 	int8_t *smp_ptr;
 	int8_t *lookahead_ptr;
+	int8_t *unrolled_ptr; /* NULL unless the loop is short enough to be unrolled */
 	uint32_t lookahead_start;
 	int32_t maxsamples;
 };
@@ -486,6 +1094,7 @@ static void mix_loop_state_update_lookahead_ptrs(struct mix_loop_state *mls, son
 	// - The loop lookahead stuff might still fail for samples with backward loops.
 	mls->smp_ptr = channel->ptr_sample ? (int8_t *const)(channel->ptr_sample->data) : NULL;
 	mls->lookahead_ptr = NULL;
+	mls->unrolled_ptr = NULL;
 	mls->lookahead_start = (channel->loop_end < MAX_INTERPOLATION_LOOKAHEAD_BUFFER_SIZE)
 		? channel->loop_start
 		: MAX(channel->loop_start, channel->loop_end - MAX_INTERPOLATION_LOOKAHEAD_BUFFER_SIZE);
@@ -501,16 +1110,66 @@ static void mix_loop_state_update_lookahead_ptrs(struct mix_loop_state *mls, son
 		mls->lookahead_ptr = mls->smp_ptr + (lookahead_offset
 			* ((pins->flags & CHN_STEREO) ? 2 : 1)
 			* ((pins->flags & CHN_16BIT)  ? 2 : 1));
+
+		// Short forward loops are repeated over a whole buffer after the lookahead
+		// buffers, so we can play through lots of them in one go. Like the lookahead
+		// pointer, this is offset so that it can be indexed with the position as-is.
+		const int sustain = !!(channel->flags & CHN_SUSTAINLOOP);
+		const uint32_t loop_start = sustain ? pins->sustain_start : pins->loop_start;
+		const uint32_t loop_end = sustain ? pins->sustain_end : pins->loop_end;
+
+		if (!(channel->flags & CHN_PINGPONGLOOP)
+			&& channel->loop_start == loop_start && channel->loop_end == loop_end
+			&& channel->length == loop_end && loop_end - loop_start <= MAX_UNROLLED_LOOP_LENGTH) {
+			uint32_t unrolled_offset = (pins->length - loop_start)
+				+ ((1 + 4 + 4 + 1) * MAX_INTERPOLATION_LOOKAHEAD_BUFFER_SIZE)
+				+ (sustain ? (UNROLLED_LOOP_BUFFER_SIZE + 2 * MAX_INTERPOLATION_LOOKAHEAD_BUFFER_SIZE) : 0);
+
+			mls->unrolled_ptr = mls->smp_ptr + (unrolled_offset
+				* ((pins->flags & CHN_STEREO) ? 2 : 1)
+				* ((pins->flags & CHN_16BIT)  ? 2 : 1));
+		}
 	}
 }
 
-static void mix_loop_state_init(struct mix_loop_state *mls, song_voice_t *chan)
+/* The unrolled loop lets the position run way past the end of the loop.
+ * This puts it back where it would have been if the loop had been wrapped
+ * at every frame that started past the end, i.e. at most one increment
+ * past it, and leaves CHN_LOOP_WRAPPED the way get_sample_count() would
+ * have: set if every frame since the last wrap was at the loop start. */
+static void mix_loop_state_fix_unrolled_position(struct mix_loop_state *mls, song_voice_t *chan)
 {
-	if (!chan->current_sample_data)
+	struct song_smp_pos last, loop_start, loop_length;
+
+	/* the voice may have been stopped since (a note fade running out sets
+	 * the length to zero), in which case there's no loop to go back into */
+	if (!mls->unrolled_ptr || !csf_smp_pos_is_positive(chan->increment) || chan->length <= chan->loop_start)
 		return;
 
+	last = csf_smp_pos_sub(chan->position, chan->increment);
+	loop_start = csf_smp_pos(chan->loop_start, 0);
+
+	if (csf_smp_pos_ge(last, csf_smp_pos(chan->length, 0))) {
+		loop_length = csf_smp_pos(chan->length - chan->loop_start, 0);
+
+		last = csf_smp_pos_sub(last, csf_smp_pos_mul_whole(loop_length,
+			csf_smp_pos_div(csf_smp_pos_sub(last, loop_start), loop_length)));
+
+		chan->position = csf_smp_pos_add(last, chan->increment);
+		chan->flags |= CHN_LOOP_WRAPPED;
+	}
+
+	if (csf_smp_pos_ge(last, loop_start) && !voice_at_loop_start(chan, last))
+		chan->flags &= ~CHN_LOOP_WRAPPED;
+}
+
+static void mix_loop_state_init(struct mix_loop_state *mls, song_voice_t *chan)
+{
 	memset(mls, 0, sizeof(*mls));
 
+	if (!chan->current_sample_data)
+		return;
+
 	mix_loop_state_update_lookahead_ptrs(mls, chan);
 
 	struct song_smp_pos inv = chan->increment;
@@ -532,6 +1191,8 @@ static int32_t get_sample_count(struct mix_loop_state *mls, song_voice_t *chan,
 	/* reset this */
 	chan->current_sample_data = mls->smp_ptr;
 
+	mix_loop_state_fix_unrolled_position(mls, chan);
+
 	// Under zero ?
 
 	if (csf_smp_pos_lt(chan->position, csf_smp_pos(loop_start, 0))) {
@@ -624,14 +1285,22 @@ static int32_t get_sample_count(struct mix_loop_state *mls, song_voice_t *chan,
 	struct song_smp_pos inc_samples = csf_smp_pos_mul_whole(increment, sample_count - 1);
 	int32_t pos_dest = csf_smp_pos_get_whole(csf_smp_pos_add(chan->position, inc_samples));
 
-	const int at_loop_start = (csf_smp_pos_ge(chan->position, csf_smp_pos(chan->loop_start, 0))
-		&& csf_smp_pos_lt(chan->position, csf_smp_pos(chan->loop_start + MAX_INTERPOLATION_LOOKAHEAD_BUFFER_SIZE, 0)));
+	const int at_loop_start = voice_at_loop_start(chan, chan->position);
 	if (!at_loop_start)
 		chan->flags &= ~(CHN_LOOP_WRAPPED);
 
 	int checkdest = 1;
-	// Loop wrap-around magic. (yummers)
-	if (mls->lookahead_ptr) {
+	// Short loops: play straight through the unrolled copy, as long as we're in
+	// the loop and it's been wrapped around already (or we're far enough into
+	// it that the first time through doesn't matter)
+	if (mls->unrolled_ptr && csf_smp_pos_is_positive(chan->increment)
+		&& position >= loop_start && (!at_loop_start || (chan->flags & CHN_LOOP_WRAPPED))) {
+		sample_count = MIN(sample_count, (int32_t)distance_to_buffer_length(chan->position,
+			csf_smp_pos(loop_start + UNROLLED_LOOP_BUFFER_SIZE, 0), inv));
+		chan->current_sample_data = mls->unrolled_ptr;
+		checkdest = 0;
+	} else if (mls->lookahead_ptr) {
+		// Loop wrap-around magic. (yummers)
 		if (csf_smp_pos_ge(chan->position, csf_smp_pos(mls->lookahead_start, 0))) {
 			if (csf_smp_pos_is_negative(chan->increment)) {
 				// going backwards and we're in the loop. We have to set the sample count
@@ -747,174 +1416,673 @@ static void fake_vu_meter(song_voice_t *channel, uint32_t smpcount, struct song_
 	channel->vu_meter = MAX(channel->vu_meter, umax);
 }
 
-uint32_t csf_create_stereo_mix(song_t *csf, uint32_t count)
+/* A voice that is at zero volume, isn't ramping and has no DC offset left
+ * to decay can't possibly be heard for the whole block. The resonant filter
+ * runs on the sample before the volume is applied though, so a filtered
+ * voice is left to the mixer, which knows what to do with its history. */
+static inline int voice_is_silent(const song_voice_t *channel)
 {
-	int32_t* ofsl, *ofsr;
-	unsigned int nchused, nchmixed;
+	return !(channel->flags & (CHN_ADLIB | CHN_FILTER))
+		&& !channel->ramp_length
+		&& !(channel->left_volume | channel->right_volume
+			| channel->left_volume_new | channel->right_volume_new)
+		&& !channel->lofs && !channel->rofs;
+}
 
-	if (!count)
+/* Moves a silent voice `count' frames ahead without walking the block in
+ * chunks. This ends up in exactly the same place get_sample_count() and the
+ * mixing loop would have: the loop is wrapped only at the start of a frame
+ * that is past the end, so over a whole block that boils down to a modulo.
+ *
+ * Returns 1 if the voice was advanced, 0 if it ran off the end of a
+ * non-looping sample and has to be stopped, and -1 if the voice is in a
+ * state that needs the full treatment (ping-pong loops, playing backwards,
+ * positions outside of the sample, loops shorter than the increment). */
+static int advance_silent_voice(song_voice_t *channel, uint32_t count)
+{
+	const struct song_smp_pos increment = channel->increment;
+	const struct song_smp_pos length = csf_smp_pos(channel->length, 0);
+	struct song_smp_pos last, loop_start, loop_length;
+	int64_t wraps;
+
+	if (!csf_smp_pos_is_positive(increment) || (channel->flags & CHN_PINGPONGLOOP)
+		|| csf_smp_pos_is_negative(channel->position) || csf_smp_pos_ge(channel->position, length))
+		return -1;
+
+	/* the position the last frame of the block starts at */
+	last = csf_smp_pos_add(channel->position, csf_smp_pos_mul_whole(increment, count - 1));
+
+	if (csf_smp_pos_lt(last, length)) {
+		/* get_sample_count() would've forgotten about the last wrap as soon
+		 * as it got past the start of the loop */
+		if (!voice_at_loop_start(channel, channel->position) || !voice_at_loop_start(channel, last))
+			channel->flags &= ~CHN_LOOP_WRAPPED;
+
+		channel->position = csf_smp_pos_add(last, increment);
+		return 1;
+	}
+
+	if (!(channel->flags & CHN_LOOP))
 		return 0;
 
-	nchused = nchmixed = 0;
+	loop_start = csf_smp_pos(channel->loop_start, 0);
+	loop_length = csf_smp_pos_sub(length, loop_start);
 
-	// yuck
-	if (csf->multi_write)
-		for (uint32_t nchan = 0; nchan < MAX_CHANNELS; nchan++)
-			memset(csf->multi_write[nchan].buffer, 0, sizeof(csf->multi_write[nchan].buffer));
-
-	for (uint32_t nchan = 0; nchan < csf->num_voices; nchan++) {
-		song_voice_t *const channel = &csf->voices[csf->voice_mix[nchan]];
-		uint32_t flags;
-		uint32_t nrampsamples;
-		int32_t smpcount;
-		int32_t nsamples;
-		int32_t *pbuffer;
-
-		if ((!channel->current_sample_data || !channel->ptr_sample /* HAX */)
-			&& !channel->lofs
-			&& !channel->rofs)
-			continue;
+	/* with anything bigger, wrapping once might not be enough */
+	if (!csf_smp_pos_lt(increment, loop_length))
+		return -1;
 
-		ofsr = &csf->dry_rofs_vol;
-		ofsl = &csf->dry_lofs_vol;
-		flags = 0;
+	wraps = csf_smp_pos_div(csf_smp_pos_sub(last, loop_start), loop_length);
+	last = csf_smp_pos_sub(last, csf_smp_pos_mul_whole(loop_length, wraps));
 
-		if (channel->flags & CHN_16BIT)
-			flags |= MIXNDX_16BIT;
+	channel->position = csf_smp_pos_add(last, increment);
+	if (voice_at_loop_start(channel, last))
+		channel->flags |= CHN_LOOP_WRAPPED;
+	else
+		channel->flags &= ~CHN_LOOP_WRAPPED;
 
-		if (channel->flags & CHN_STEREO)
-			flags |= MIXNDX_STEREO;
+	return 1;
+}
 
-		if (channel->flags & CHN_FILTER)
-			flags |= MIXNDX_FILTER;
+/* Mixes a single voice for `count` frames into `mix_buffer' (or the
+ * multi-write buffer of its master channel), adding the DC offset of any
+ * voice that stops into *ofsl and *ofsr. If `no_mix' is set the voice is only
+ * advanced, not actually mixed.
+ *
+ * Returns -1 if the voice is not playing at all, 1 if it was mixed, 2 if it
+ * was silent and only got moved ahead, and 0 otherwise. */
+static int mix_voice(song_t *csf, uint32_t nchan, uint32_t count, const mix_interface_t *mix_table,
+	int no_mix, int32_t *mix_buffer, int32_t *ofsl, int32_t *ofsr)
+{
+	song_voice_t *const channel = &csf->voices[csf->voice_mix[nchan]];
+	uint32_t flags;
+	uint32_t nrampsamples;
+	int32_t smpcount;
+	int32_t nsamples;
+	int32_t *pbuffer;
 
-		if (!(channel->flags & CHN_NOIDO)) {
-			uint32_t srcflags[NUM_SRC_MODES] = {
-				[SRCMODE_NEAREST] = 0,
-				[SRCMODE_LINEAR] = MIXNDX_LINEARSRC,
-				[SRCMODE_SPLINE] = MIXNDX_SPLINESRC,
-				[SRCMODE_POLYPHASE] = MIXNDX_FIRSRC,
-			};
+	if ((!channel->current_sample_data || !channel->ptr_sample /* HAX */)
+		&& !channel->lofs
+		&& !channel->rofs)
+		return -1;
 
-			flags |= srcflags[csf->mix_interpolation];
-		}
+	flags = 0;
 
-		nsamples = count;
+	if (channel->flags & CHN_16BIT)
+		flags |= MIXNDX_16BIT;
 
-		if (csf->multi_write) {
-			int32_t master = (csf->voice_mix[nchan] < MAX_CHANNELS)
-				? csf->voice_mix[nchan]
-				: (channel->master_channel - 1);
-			pbuffer = csf->multi_write[master].buffer;
-			csf->multi_write[master].used = 1;
-		} else {
-			pbuffer = csf->mix_buffer;
+	if (channel->flags & CHN_STEREO)
+		flags |= MIXNDX_STEREO;
+
+	if (channel->flags & CHN_FILTER)
+		flags |= MIXNDX_FILTER;
+
+	if (!(channel->flags & CHN_NOIDO)) {
+		uint32_t srcflags[NUM_SRC_MODES] = {
+			[SRCMODE_NEAREST] = 0,
+			[SRCMODE_LINEAR] = MIXNDX_LINEARSRC,
+			[SRCMODE_SPLINE] = MIXNDX_SPLINESRC,
+			[SRCMODE_POLYPHASE] = MIXNDX_FIRSRC,
+			[SRCMODE_SINC] = MIXNDX_SINCSRC,
+		};
+		uint32_t src = srcflags[csf->mix_interpolation];
+
+		/* anything faster than the mixing rate gets the longer, lower
+		 * cutoff kernels, so it doesn't alias */
+		if (src == MIXNDX_SINCSRC) {
+			struct song_smp_pos inc = channel->increment;
+
+			if (csf_smp_pos_is_negative(inc))
+				inc = csf_smp_pos_negate(inc);
+
+			if (csf_smp_pos_gt(inc, csf_smp_pos(1, 0)))
+				src = MIXNDX_SINCDOWNSRC;
 		}
 
-		nchused++;
-
-		////////////////////////////////////////////////////
-		uint32_t naddmix = 0;
-		struct mix_loop_state mls;
-		mix_loop_state_init(&mls, channel);
-		channel->vu_meter <<= 16;
-
-		do {
-			nrampsamples = nsamples;
+		flags |= src;
+	}
 
-			if (channel->ramp_length > 0) {
-				if ((int32_t)nrampsamples > channel->ramp_length)
-					nrampsamples = channel->ramp_length;
-			}
+	nsamples = count;
 
-			smpcount = 1;
+	if (csf->multi_write) {
+		int32_t master = (csf->voice_mix[nchan] < MAX_CHANNELS)
+			? csf->voice_mix[nchan]
+			: (channel->master_channel - 1);
+		pbuffer = csf->multi_write[master].buffer;
+		csf->multi_write[master].used = 1;
+	} else {
+		pbuffer = mix_buffer;
+	}
 
-			/* Figure out the number of remaining samples,
-			 * unless we're in AdLib or MIDI mode (to prevent
-			 * artificial KeyOffs)
-			 */
-			if (!(channel->flags & CHN_ADLIB)) {
-				smpcount = get_sample_count(&mls, channel, nrampsamples);
-			}
+	if (voice_is_silent(channel)) {
+		int r = advance_silent_voice(channel, count);
 
-			if (smpcount <= 0) {
-				// Stopping the channel
-				channel->current_sample_data = NULL;
+		if (r >= 0) {
+			if (!r) {
 				channel->length = 0;
 				channel->position = csf_smp_pos(0,0);
-				channel->ramp_length = 0;
-				end_channel_ofs(channel, pbuffer, nsamples);
-				*ofsr += channel->rofs;
-				*ofsl += channel->lofs;
-				channel->rofs = channel->lofs = 0;
 				channel->flags &= ~CHN_PINGPONGFLAG;
-				break;
 			}
 
-			// Should we mix this channel ?
-
-			if ((nchmixed >= csf->max_voices && !(csf->mix_flags & SNDMIX_DIRECTTODISK))
-				|| (!channel->ramp_length && !(channel->left_volume | channel->right_volume))) {
-				struct song_smp_pos len = csf_smp_pos_mul_whole(channel->increment, smpcount);
-
-				/* Don't even try */
-				if (!(channel->flags & CHN_ADLIB))
-					fake_vu_meter(channel, smpcount, len);
-
-				channel->position = csf_smp_pos_add(channel->position, len);
-				channel->rofs = channel->lofs = 0;
-				pbuffer += smpcount * 2;
-			} else if (!(channel->flags & CHN_ADLIB)) {
-				// Mix the stream, unless we're in AdLib mode
-
-				// Choose function for mixing
-				mix_interface_t mix_func;
-				mix_func = channel->ramp_length
-					? mix_functions[flags | MIXNDX_RAMP]
-					: mix_functions[flags];
-
-				int32_t *pbufmax = pbuffer + (smpcount * 2);
-				channel->rofs = -*(pbufmax - 2);
-				channel->lofs = -*(pbufmax - 1);
-
-				mix_func(channel, pbuffer, pbufmax);
-				channel->rofs += *(pbufmax - 2);
-				channel->lofs += *(pbufmax - 1);
-				pbuffer = pbufmax;
-				naddmix = 1;
-			}
+			channel->current_sample_data = channel->ptr_sample->data;
+			channel->vu_meter = MIN(channel->vu_meter & 0xFFFF, 0xFF);
+			return 2;
+		}
+	}
+
+	////////////////////////////////////////////////////
+	uint32_t naddmix = 0;
+	struct mix_loop_state mls;
+	mix_loop_state_init(&mls, channel);
+	channel->vu_meter <<= 16;
+
+	do {
+		nrampsamples = nsamples;
+
+		if (channel->ramp_length > 0) {
+			if ((int32_t)nrampsamples > channel->ramp_length)
+				nrampsamples = channel->ramp_length;
+		}
+
+		smpcount = 1;
+
+		/* Figure out the number of remaining samples,
+		 * unless we're in AdLib or MIDI mode (to prevent
+		 * artificial KeyOffs)
+		 */
+		if (!(channel->flags & CHN_ADLIB)) {
+			smpcount = get_sample_count(&mls, channel, nrampsamples);
+		}
 
-			nsamples -= smpcount;
-
-			if (channel->ramp_length) {
-				if (channel->ramp_length <= smpcount) {
-					// Ramping is done
-					channel->ramp_length = 0;
-					channel->right_volume = channel->right_volume_new;
-					channel->left_volume = channel->left_volume_new;
-					channel->right_ramp = channel->left_ramp = 0;
-
-					if ((channel->flags & CHN_NOTEFADE)
-						&& (!(channel->fadeout_volume))) {
-						channel->length = 0;
-						channel->current_sample_data = NULL;
-					}
-				} else {
-					channel->ramp_length -= smpcount;
+		if (smpcount <= 0) {
+			// Stopping the channel
+			channel->current_sample_data = NULL;
+			channel->length = 0;
+			channel->position = csf_smp_pos(0,0);
+			channel->ramp_length = 0;
+			end_channel_ofs(channel, pbuffer, nsamples);
+			*ofsr += channel->rofs;
+			*ofsl += channel->lofs;
+			channel->rofs = channel->lofs = 0;
+			channel->flags &= ~CHN_PINGPONGFLAG;
+			break;
+		}
+
+		// Should we mix this channel ?
+
+		if (no_mix
+			|| (!channel->ramp_length && !(channel->left_volume | channel->right_volume))) {
+			struct song_smp_pos len = csf_smp_pos_mul_whole(channel->increment, smpcount);
+
+			/* Don't even try (and don't bother if it'd come out as zero) */
+			if (!(channel->flags & CHN_ADLIB)
+				&& (channel->left_volume_new | channel->right_volume_new))
+				fake_vu_meter(channel, smpcount, len);
+
+			channel->position = csf_smp_pos_add(channel->position, len);
+			channel->rofs = channel->lofs = 0;
+			pbuffer += smpcount * 2;
+		} else if (!(channel->flags & CHN_ADLIB)) {
+			// Mix the stream, unless we're in AdLib mode
+
+			// Choose function for mixing
+			mix_interface_t mix_func;
+			mix_func = channel->ramp_length
+				? mix_table[flags | MIXNDX_RAMP]
+				: mix_table[flags];
+
+			int32_t *pbufmax = pbuffer + (smpcount * 2);
+			channel->rofs = -*(pbufmax - 2);
+			channel->lofs = -*(pbufmax - 1);
+
+			mix_func(channel, pbuffer, pbufmax);
+			channel->rofs += *(pbufmax - 2);
+			channel->lofs += *(pbufmax - 1);
+			pbuffer = pbufmax;
+			naddmix = 1;
+		}
+
+		nsamples -= smpcount;
+
+		if (channel->ramp_length) {
+			if (channel->ramp_length <= smpcount) {
+				// Ramping is done
+				channel->ramp_length = 0;
+				channel->right_volume = channel->right_volume_new;
+				channel->left_volume = channel->left_volume_new;
+				channel->right_ramp = channel->left_ramp = 0;
+
+				if ((channel->flags & CHN_NOTEFADE)
+					&& (!(channel->fadeout_volume))) {
+					channel->length = 0;
+					channel->current_sample_data = NULL;
 				}
+			} else {
+				channel->ramp_length -= smpcount;
 			}
-		} while (nsamples > 0);
+		}
+	} while (nsamples > 0);
+
+	/* Restore sample pointer in case it got changed through loop wrap-around */
+	channel->current_sample_data = mls.smp_ptr;
+	mix_loop_state_fix_unrolled_position(&mls, channel);
+
+	channel->vu_meter >>= 16;
+	if (channel->vu_meter > 0xFF)
+		channel->vu_meter = 0xFF;
 
-		/* Restore sample pointer in case it got changed through loop wrap-around */
-		channel->current_sample_data = mls.smp_ptr;
+	return naddmix;
 
-		channel->vu_meter >>= 16;
-		if (channel->vu_meter > 0xFF)
-			channel->vu_meter = 0xFF;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Stream resampling
+ *
+ * Converts a stereo stream that's generated at its own fixed rate (the OPL
+ * chip, at its native ~49.7 kHz) to the mixing rate, with the same sinc
+ * kernels the sample mixer uses. The input is kept as 32-bit frames, so
+ * nothing gets truncated on the way, and the frames that the next kernel
+ * still needs are kept around between calls. */
+
+/* frames before and after the current position that the widest kernel
+ * reads */
+#define STREAM_RESAMPLER_BEFORE (SINC_DOWN_WIDTH / 2 - 1)
+#define STREAM_RESAMPLER_AFTER  (SINC_DOWN_WIDTH / 2)
+
+void stream_resampler_init(stream_resampler_t *rs, uint32_t in_rate, uint32_t out_rate)
+{
+	uint64_t inc = ((uint64_t)in_rate << 32) / out_rate;
+	uint32_t i;
+
+	rs->increment = csf_smp_pos(inc >> 32, inc & 0xFFFFFFFFU);
+	rs->position = csf_smp_pos(STREAM_RESAMPLER_BEFORE, 0);
+	rs->length = STREAM_RESAMPLER_BEFORE;
+
+	if (rs->alloc < rs->length) {
+		rs->alloc = rs->length;
+		rs->buffer = mem_realloc(rs->buffer, rs->alloc * 2 * sizeof(int32_t));
+	}
+
+	for (i = 0; i < rs->length * 2; i++)
+		rs->buffer[i] = 0;
+}
+
+void stream_resampler_free(stream_resampler_t *rs)
+{
+	free(rs->buffer);
+	rs->buffer = NULL;
+	rs->length = rs->alloc = 0;
+}
+
+int32_t *stream_resampler_get_input(stream_resampler_t *rs, uint32_t count, uint32_t *frames)
+{
+	const struct song_smp_pos last = csf_smp_pos_add(rs->position,
+		csf_smp_pos_mul_whole(rs->increment, (int64_t)count - 1));
+	const uint32_t need = csf_smp_pos_get_whole(last) + STREAM_RESAMPLER_AFTER + 1;
+	int32_t *input;
+
+	if (!count || need <= rs->length) {
+		*frames = 0;
+		return rs->buffer + rs->length * 2;
+	}
+
+	if (need > rs->alloc) {
+		rs->alloc = need;
+		rs->buffer = mem_realloc(rs->buffer, rs->alloc * 2 * sizeof(int32_t));
+	}
+
+	input = rs->buffer + rs->length * 2;
+	memset(input, 0, (need - rs->length) * 2 * sizeof(int32_t));
+
+	*frames = need - rs->length;
+	rs->length = need;
+
+	return input;
+}
 
-		nchmixed += naddmix;
+#define STREAM_RESAMPLER_MIX(lut, fracbits, taps) \
+	for (i = 0; i < count; i++) { \
+		const struct song_smp_pos ipos = csf_smp_pos_add(rs->position, csf_smp_pos_mul_whole(rs->increment, i)); \
+		const int32_t *p = rs->buffer + (csf_smp_pos_get_whole(ipos) - ((taps) / 2 - 1)) * 2; \
+		const int16_t *c = (lut) + SINC_PHASE(csf_smp_pos_get_frac(ipos), fracbits) * (taps); \
+		int64_t sum_l = 0, sum_r = 0; \
+		for (k = 0; k < (taps); k++) { \
+			sum_l += c[k] * (int64_t)p[k * 2 + 0]; \
+			sum_r += c[k] * (int64_t)p[k * 2 + 1]; \
+		} \
+		out[i * 2 + 0] += (int32_t)rshift_signed(sum_l, SINC_QUANTBITS); \
+		out[i * 2 + 1] += (int32_t)rshift_signed(sum_r, SINC_QUANTBITS); \
 	}
 
+void stream_resampler_mix(stream_resampler_t *rs, int32_t *out, uint32_t count)
+{
+	const uint32_t first = csf_smp_pos_get_whole(rs->position) - STREAM_RESAMPLER_BEFORE;
+	uint32_t i, drop;
+	int k;
+
+	/* skip the convolution if everything it would read is silent */
+	if (out) {
+		for (i = first * 2; i < rs->length * 2; i++)
+			if (rs->buffer[i])
+				break;
+
+		if (i == rs->length * 2)
+			out = NULL;
+	}
+
+	if (out) {
+		if (csf_smp_pos_le(rs->increment, csf_smp_pos(1, 0))) {
+			STREAM_RESAMPLER_MIX(sinc_lut, SINC_FRACBITS, SINC_WIDTH);
+		} else {
+			STREAM_RESAMPLER_MIX(get_sinc_down_lut(rs->increment), SINC_DOWN_FRACBITS, SINC_DOWN_WIDTH);
+		}
+	}
+
+	rs->position = csf_smp_pos_add(rs->position, csf_smp_pos_mul_whole(rs->increment, count));
+
+	/* keep the frames the next call still has to look back at */
+	drop = MIN((uint32_t)csf_smp_pos_get_whole(rs->position) - STREAM_RESAMPLER_BEFORE, rs->length);
+	if (drop) {
+		memmove(rs->buffer, rs->buffer + drop * 2, (rs->length - drop) * 2 * sizeof(int32_t));
+		rs->length -= drop;
+		rs->position = csf_smp_pos_sub(rs->position, csf_smp_pos(drop, 0));
+	}
+}
+
+#undef STREAM_RESAMPLER_MIX
+
+/* ------------------------------------------------------------------------ */
+/* Threaded voice mixing
+ *
+ * Voices are handed out one at a time to whoever is free (the pool workers
+ * plus the calling thread). Each worker mixes into its own buffer, and
+ * those get added to the song's mix buffer once everyone is done. Every
+ * voice only ever touches its own state, and integer addition doesn't
+ * care about order, so the result is identical to the serial mixer no
+ * matter how the voices end up distributed. */
+
+/* don't bother with the threads for just a handful of voices */
+#define MIX_THREADS_MIN_VOICES 8
+
+struct mix_worker {
+	mt_thread_t *thread;
+	mt_sem_t *go;
+
+	uint32_t nchused, nskipped;
+	int32_t dry_lofs, dry_rofs;
+
+	int32_t *buffer; /* buffer_size * 2 */
+};
+
+static struct {
+	mt_mutex_t *lock; /* held for as long as a song is using the pool */
+	mt_sem_t *done;
+
+	/* set while a song is being mixed on the pool; anyone else who wants
+	 * it in the meantime (the audio callback while disko is rendering, or
+	 * the other way around) mixes on its own thread instead of waiting */
+	struct atm busy;
+
+	struct mix_worker *workers;
+	uint32_t num_workers;
+	uint32_t buffer_size; /* in frames, same for every worker */
+	int quit;
+
+	/* the job currently being mixed */
+	song_t *csf;
+	uint32_t count;
+	const mix_interface_t *mix_table;
+	struct atm next_voice;
+} mix_pool;
+
+/* keeps taking voices until there are none left */
+static uint32_t mix_pool_run(int32_t *mix_buffer, int32_t *ofsl, int32_t *ofsr, uint32_t *pnskipped)
+{
+	uint32_t nchused = 0;
+
+	*pnskipped = 0;
+
+	for (;;) {
+		int32_t nchan = atm_inc(&mix_pool.next_voice);
+		if (nchan >= (int32_t)mix_pool.csf->num_voices)
+			break;
+
+		int r = mix_voice(mix_pool.csf, nchan, mix_pool.count, mix_pool.mix_table, 0, mix_buffer, ofsl, ofsr);
+		if (r < 0)
+			continue;
+
+		nchused++;
+		if (r == 2)
+			(*pnskipped)++;
+	}
+
+	return nchused;
+}
+
+static int mix_worker_thread(void *userdata)
+{
+	struct mix_worker *w = userdata;
+
+	mt_thread_set_priority(MT_THREAD_PRIORITY_HIGH);
+
+	for (;;) {
+		mt_sem_wait(w->go);
+
+		if (mix_pool.quit)
+			break;
+
+		memset(w->buffer, 0, mix_pool.count * 2 * sizeof(int32_t));
+		w->dry_lofs = w->dry_rofs = 0;
+		w->nchused = mix_pool_run(w->buffer, &w->dry_lofs, &w->dry_rofs, &w->nskipped);
+
+		mt_sem_post(mix_pool.done);
+	}
+
+	return 0;
+}
+
+static void mix_pool_stop(void)
+{
+	uint32_t i;
+
+	mix_pool.quit = 1;
+
+	for (i = 0; i < mix_pool.num_workers; i++) {
+		struct mix_worker *w = &mix_pool.workers[i];
+
+		if (w->thread) {
+			mt_sem_post(w->go);
+			mt_thread_wait(w->thread, NULL);
+		}
+
+		if (w->go)
+			mt_sem_delete(w->go);
+
+		free(w->buffer);
+	}
+
+	if (mix_pool.done) {
+		mt_sem_delete(mix_pool.done);
+		mix_pool.done = NULL;
+	}
+
+	free(mix_pool.workers);
+	mix_pool.workers = NULL;
+	mix_pool.num_workers = 0;
+	mix_pool.buffer_size = 0;
+	mix_pool.quit = 0;
+}
+
+int csf_set_mix_threads(uint32_t nthreads)
+{
+	/* the calling thread does its share of the work too */
+	const uint32_t num_workers = (nthreads > 1) ? (nthreads - 1) : 0;
+	uint32_t i;
+
+	if (!mix_pool.lock) {
+		mix_pool.lock = mt_mutex_create();
+		if (!mix_pool.lock)
+			return (nthreads <= 1);
+	}
+
+	mt_mutex_lock(mix_pool.lock);
+
+	/* this gets called whenever the mix settings are reapplied, which is
+	 * a lot more often than the number of threads actually changes */
+	if (num_workers == mix_pool.num_workers) {
+		mt_mutex_unlock(mix_pool.lock);
+		return 1;
+	}
+
+	mix_pool_stop();
+
+	if (num_workers) {
+		mix_pool.done = mt_sem_create();
+		mix_pool.workers = calloc(num_workers, sizeof(*mix_pool.workers));
+		if (!mix_pool.done || !mix_pool.workers)
+			goto fail;
+
+		mix_pool.num_workers = num_workers;
+
+		for (i = 0; i < mix_pool.num_workers; i++) {
+			struct mix_worker *w = &mix_pool.workers[i];
+
+			w->go = mt_sem_create();
+			if (!w->go)
+				goto fail;
+
+			w->thread = mt_thread_create(mix_worker_thread, "Mixer thread", w);
+			if (!w->thread)
+				goto fail;
+		}
+	}
+
+	mt_mutex_unlock(mix_pool.lock);
+
+	return 1;
+
+fail:
+	mix_pool_stop();
+	mt_mutex_unlock(mix_pool.lock);
+
+	return 0;
+}
+
+/* returns 0 if the pool couldn't be used, in which case nothing was mixed */
+static int mix_voices_threaded(song_t *csf, uint32_t count, const mix_interface_t *mix_table,
+	uint32_t *pnchused, uint32_t *pnskipped)
+{
+	uint32_t i, j, nchused, nskipped;
+
+	if (!mix_pool.lock)
+		return 0;
+
+	/* with the per-buffer multi-write output several voices would end up
+	 * in the same buffer, and if voices have to be dropped for exceeding
+	 * max_voices, which ones get dropped depends on the order. */
+	if (csf->multi_write || csf->num_voices < MIX_THREADS_MIN_VOICES
+		|| (csf->num_voices > csf->max_voices && !(csf->mix_flags & SNDMIX_DIRECTTODISK)))
+		return 0;
+
+	if (!atm_cmpxchg(&mix_pool.busy, 0, 1))
+		return 0;
+
+	mt_mutex_lock(mix_pool.lock);
+
+	if (!mix_pool.num_workers) {
+		mt_mutex_unlock(mix_pool.lock);
+		atm_store(&mix_pool.busy, 0);
+		return 0;
+	}
+
+	/* grow the worker buffers to fit, if this song mixes bigger blocks */
+	if (count > mix_pool.buffer_size) {
+		for (i = 0; i < mix_pool.num_workers; i++) {
+			int32_t *buffer = realloc(mix_pool.workers[i].buffer, count * 2 * sizeof(int32_t));
+			if (!buffer) {
+				mt_mutex_unlock(mix_pool.lock);
+				atm_store(&mix_pool.busy, 0);
+				return 0;
+			}
+
+			mix_pool.workers[i].buffer = buffer;
+		}
+
+		mix_pool.buffer_size = count;
+	}
+
+	mix_pool.csf = csf;
+	mix_pool.count = count;
+	mix_pool.mix_table = mix_table;
+	atm_store(&mix_pool.next_voice, 0);
+
+	for (i = 0; i < mix_pool.num_workers; i++)
+		mt_sem_post(mix_pool.workers[i].go);
+
+	nchused = mix_pool_run(csf->mix_buffer, &csf->dry_lofs_vol, &csf->dry_rofs_vol, &nskipped);
+
+	for (i = 0; i < mix_pool.num_workers; i++)
+		mt_sem_wait(mix_pool.done);
+
+	/* always reduce in the same order, and wrap on overflow the same
+	 * way the serial mixer would */
+	for (i = 0; i < mix_pool.num_workers; i++) {
+		struct mix_worker *w = &mix_pool.workers[i];
+
+		for (j = 0; j < count * 2; j++)
+			csf->mix_buffer[j] = (int32_t)((uint32_t)csf->mix_buffer[j] + (uint32_t)w->buffer[j]);
+
+		csf->dry_lofs_vol += w->dry_lofs;
+		csf->dry_rofs_vol += w->dry_rofs;
+		nchused += w->nchused;
+		nskipped += w->nskipped;
+	}
+
+	mt_mutex_unlock(mix_pool.lock);
+	atm_store(&mix_pool.busy, 0);
+
+	*pnchused = nchused;
+	*pnskipped = nskipped;
+
+	return 1;
+}
+
+uint32_t csf_create_stereo_mix(song_t *csf, uint32_t count)
+{
+	unsigned int nchused, nchmixed, nskipped;
+	const mix_interface_t *mix_table;
+
+	if (!count)
+		return 0;
+
+	mix_table = get_mix_functions();
+
+	nchused = nchmixed = nskipped = 0;
+
+	// yuck
+	if (csf->multi_write)
+		for (uint32_t nchan = 0; nchan < MAX_CHANNELS; nchan++)
+			memset(csf->multi_write[nchan].buffer, 0, count * 2 * sizeof(int32_t));
+
+	if (!mix_voices_threaded(csf, count, mix_table, &nchused, &nskipped)) {
+		for (uint32_t nchan = 0; nchan < csf->num_voices; nchan++) {
+			int no_mix = (nchmixed >= csf->max_voices && !(csf->mix_flags & SNDMIX_DIRECTTODISK));
+			int r = mix_voice(csf, nchan, count, mix_table, no_mix, csf->mix_buffer,
+				&csf->dry_lofs_vol, &csf->dry_rofs_vol);
+
+			if (r < 0)
+				continue;
+
+			nchused++;
+			if (r == 2)
+				nskipped++;
+			else
+				nchmixed += r;
+		}
+	}
+
+	csf->mix_skipped += nskipped;
+
 	GM_IncrementSongCounter(csf, count);
 
 	Fmdrv_Mix(csf, count);
@@ -25,6 +25,7 @@
 
 #include "bits.h"
 #include "util.h"
+#include "cpu.h"
 
 #include "player/sndfile.h"
 #include "player/cmixer.h"
@@ -95,6 +96,14 @@ void mono_from_stereo(int32_t *mix_buf, uint32_t samples)
 	}
 }
 
+/* This is the only int -> float conversion on the float mix bus; everything
+ * after it (EQ, master volume, clipping) stays in float. */
+void mix_buffer_to_float(float *out, const int32_t *in, uint32_t samples)
+{
+	for (uint32_t i = 0; i < samples; i++)
+		out[i] = in[i] * MIXING_FLOAT_SCALE;
+}
+
 // ----------------------------------------------------------------------------
 // Clip and convert functions
 // ----------------------------------------------------------------------------
@@ -104,7 +113,7 @@ void mono_from_stereo(int32_t *mix_buf, uint32_t samples)
 
 
 // Clip and convert to 8 bit. mins and maxs returned in 27bits: [MIXING_CLIPMIN..MIXING_CLIPMAX]. mins[0] left, mins[1] right.
-uint32_t clip_32_to_8(void *ptr, int32_t *buffer, uint32_t samples, int32_t *mins, int32_t *maxs)
+static uint32_t clip_32_to_8_c(void *ptr, int32_t *buffer, uint32_t samples, int32_t *mins, int32_t *maxs)
 {
 	unsigned char *p = (unsigned char *) ptr;
 	uint32_t i;
@@ -126,7 +135,7 @@ uint32_t clip_32_to_8(void *ptr, int32_t *buffer, uint32_t samples, int32_t *min
 
 
 // Clip and convert to 16 bit. mins and maxs returned in 27bits: [MIXING_CLIPMIN..MIXING_CLIPMAX]. mins[0] left, mins[1] right.
-uint32_t clip_32_to_16(void *ptr, int32_t *buffer, uint32_t samples, int32_t *mins, int32_t *maxs)
+static uint32_t clip_32_to_16_c(void *ptr, int32_t *buffer, uint32_t samples, int32_t *mins, int32_t *maxs)
 {
 	int16_t *p = (int16_t *) ptr;
 	uint32_t i;
@@ -149,7 +158,7 @@ uint32_t clip_32_to_16(void *ptr, int32_t *buffer, uint32_t samples, int32_t *mi
 
 // Clip and convert to 24 bit. mins and maxs returned in 27bits: [MIXING_CLIPMIN..MIXING_CLIPMAX]. mins[0] left, mins[1] right.
 // Note, this is 24bit, not 24-in-32bits. The former is used in .wav. The latter is used in audio IO
-uint32_t clip_32_to_24(void *ptr, int32_t *buffer, uint32_t samples, int32_t *mins, int32_t *maxs)
+static uint32_t clip_32_to_24_c(void *ptr, int32_t *buffer, uint32_t samples, int32_t *mins, int32_t *maxs)
 {
 	/* the inventor of 24bit anything should be shot */
 	unsigned char *p = (unsigned char *) ptr;
@@ -176,7 +185,7 @@ uint32_t clip_32_to_24(void *ptr, int32_t *buffer, uint32_t samples, int32_t *mi
 
 
 // Clip and convert to 32 bit(int). mins and maxs returned in 27bits: [MIXING_CLIPMIN..MIXING_CLIPMAX]. mins[0] left, mins[1] right.
-uint32_t clip_32_to_32(void *ptr, int32_t *buffer, uint32_t samples, int32_t *mins, int32_t *maxs)
+static uint32_t clip_32_to_32_c(void *ptr, int32_t *buffer, uint32_t samples, int32_t *mins, int32_t *maxs)
 {
 	int32_t *p = (int32_t *) ptr;
 	uint32_t i;
@@ -195,3 +204,313 @@ uint32_t clip_32_to_32(void *ptr, int32_t *buffer, uint32_t samples, int32_t *mi
 
 	return samples * 4;
 }
+
+
+// Clip a float mix to [-1.0, 1.0] and write it out as 32-bit float. mins and maxs are returned
+// in the same 27-bit range as the integer versions.
+static uint32_t clip_float_to_float_c(void *ptr, float *buffer, uint32_t samples, int32_t *mins, int32_t *maxs)
+{
+	float *p = (float *) ptr;
+	uint32_t i;
+
+	for (i = 0; i < samples; i++) {
+		float f = CLAMP(buffer[i], -1.0f, 1.0f);
+		int32_t n = CLAMP((int32_t)(f * (1.0f / MIXING_FLOAT_SCALE)), MIXING_CLIPMIN, MIXING_CLIPMAX);
+
+		if (n < mins[i & 1])
+			mins[i & 1] = n;
+		else if (n > maxs[i & 1])
+			maxs[i & 1] = n;
+
+		p[i] = f;
+	}
+
+	return samples * 4;
+}
+
+// ----------------------------------------------------------------------------
+// SIMD clip and convert
+//
+// These clamp, convert and track the VU min/max in a single pass, and give
+// exactly the same output and min/max as the C versions above.
+//
+// The C versions only check a sample against the max if it isn't a new min,
+// so until a channel's max has caught up with its min (the first couple of
+// samples of a csf_read, usually) that isn't the same as a plain min/max.
+// Those samples go through the C version first.
+
+static inline SCHISM_ALWAYS_INLINE
+int clip_vu_ready(const int32_t *mins, const int32_t *maxs)
+{
+	return (mins[0] <= maxs[0] && mins[1] <= maxs[1]);
+}
+
+#define CLIP_FUNCTION(isa, ATTR, TYPE, LANES, name, in_type, out_size, LOAD, MIN, MAX, STORE) \
+	static ATTR \
+	uint32_t name##_##isa(void *ptr, in_type *buffer, uint32_t samples, int32_t *mins, int32_t *maxs) \
+	{ \
+		unsigned char *p = (unsigned char *)ptr; \
+		uint32_t i = 0; \
+	\
+		/* two at a time, so that even lanes are still the left channel */ \
+		while (!clip_vu_ready(mins, maxs) && samples - i >= 2) { \
+			name##_c(p + i * out_size, buffer + i, 2, mins, maxs); \
+			i += 2; \
+		} \
+	\
+		if (samples - i >= LANES) { \
+			TYPE vmin = clip_vu_set_##isa(mins[0], mins[1]); \
+			TYPE vmax = clip_vu_set_##isa(maxs[0], maxs[1]); \
+	\
+			for (; samples - i >= LANES; i += LANES) { \
+				TYPE n = LOAD(p + i * out_size, buffer + i); \
+	\
+				vmin = MIN(vmin, n); \
+				vmax = MAX(vmax, n); \
+	\
+				STORE(p + i * out_size, n); \
+			} \
+	\
+			clip_vu_get_##isa(vmin, vmax, mins, maxs); \
+		} \
+	\
+		name##_c(p + i * out_size, buffer + i, samples - i, mins, maxs); \
+		return samples * out_size; \
+	}
+
+#define CLIP_FUNCTIONS(isa, ATTR, TYPE, LANES) \
+	CLIP_FUNCTION(isa, ATTR, TYPE, LANES, clip_32_to_8, int32_t, 1, clip_load_##isa, clip_min_##isa, clip_max_##isa, clip_store_8_##isa) \
+	CLIP_FUNCTION(isa, ATTR, TYPE, LANES, clip_32_to_16, int32_t, 2, clip_load_##isa, clip_min_##isa, clip_max_##isa, clip_store_16_##isa) \
+	CLIP_FUNCTION(isa, ATTR, TYPE, LANES, clip_32_to_24, int32_t, 3, clip_load_##isa, clip_min_##isa, clip_max_##isa, clip_store_24_##isa) \
+	CLIP_FUNCTION(isa, ATTR, TYPE, LANES, clip_32_to_32, int32_t, 4, clip_load_##isa, clip_min_##isa, clip_max_##isa, clip_store_32_##isa) \
+	CLIP_FUNCTION(isa, ATTR, TYPE, LANES, clip_float_to_float, float, 4, clip_load_float_##isa, clip_min_##isa, clip_max_##isa, clip_store_float_##isa)
+
+#if SCHISM_GNUC_HAS_ATTRIBUTE(__target__, 4, 4, 0) \
+	&& (defined(__x86_64__) || defined(__i386__)) && !defined(SCHISM_XBOX) /* XBOX is buggy for some reason */
+# include <immintrin.h>
+
+# ifdef SCHISM_SSE2
+#  define CLIP_SSE2
+#  define CLIP_SSE2_ATTR __attribute__((__target__("sse2")))
+
+/* SSE2 doesn't have 32-bit min/max */
+static inline SCHISM_ALWAYS_INLINE CLIP_SSE2_ATTR
+__m128i clip_min_sse2(__m128i a, __m128i b)
+{
+	__m128i gt = _mm_cmpgt_epi32(a, b);
+	return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+}
+
+static inline SCHISM_ALWAYS_INLINE CLIP_SSE2_ATTR
+__m128i clip_max_sse2(__m128i a, __m128i b)
+{
+	__m128i gt = _mm_cmpgt_epi32(a, b);
+	return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+}
+
+static inline SCHISM_ALWAYS_INLINE CLIP_SSE2_ATTR
+__m128i clip_clamp_sse2(__m128i x)
+{
+	return clip_min_sse2(clip_max_sse2(x, _mm_set1_epi32(MIXING_CLIPMIN)), _mm_set1_epi32(MIXING_CLIPMAX));
+}
+
+/* even lanes are the left channel, odd lanes the right */
+static inline SCHISM_ALWAYS_INLINE CLIP_SSE2_ATTR
+__m128i clip_vu_set_sse2(int32_t l, int32_t r)
+{
+	return _mm_setr_epi32(l, r, l, r);
+}
+
+static inline SCHISM_ALWAYS_INLINE CLIP_SSE2_ATTR
+void clip_vu_get_sse2(__m128i vmin, __m128i vmax, int32_t *mins, int32_t *maxs)
+{
+	vmin = clip_min_sse2(vmin, _mm_unpackhi_epi64(vmin, vmin));
+	vmax = clip_max_sse2(vmax, _mm_unpackhi_epi64(vmax, vmax));
+
+	mins[0] = _mm_cvtsi128_si32(vmin);
+	mins[1] = _mm_cvtsi128_si32(_mm_srli_si128(vmin, 4));
+	maxs[0] = _mm_cvtsi128_si32(vmax);
+	maxs[1] = _mm_cvtsi128_si32(_mm_srli_si128(vmax, 4));
+}
+
+static inline SCHISM_ALWAYS_INLINE CLIP_SSE2_ATTR
+__m128i clip_load_sse2(SCHISM_UNUSED unsigned char *p, const int32_t *buffer)
+{
+	return clip_clamp_sse2(_mm_loadu_si128((const __m128i *)buffer));
+}
+
+/* writes the clamped floats out, and returns what the VU meter sees */
+static inline SCHISM_ALWAYS_INLINE CLIP_SSE2_ATTR
+__m128i clip_load_float_sse2(unsigned char *p, const float *buffer)
+{
+	/* operands in this order so that NaNs pass through, like CLAMP */
+	__m128 f = _mm_max_ps(_mm_set1_ps(-1.0f), _mm_min_ps(_mm_set1_ps(1.0f), _mm_loadu_ps(buffer)));
+
+	_mm_storeu_ps((float *)p, f);
+
+	return clip_clamp_sse2(_mm_cvttps_epi32(_mm_mul_ps(f, _mm_set1_ps(1.0f / MIXING_FLOAT_SCALE))));
+}
+
+static inline SCHISM_ALWAYS_INLINE CLIP_SSE2_ATTR
+void clip_store_8_sse2(unsigned char *p, __m128i x)
+{
+	int32_t v;
+
+	x = _mm_packs_epi32(_mm_srai_epi32(x, 24 - MIXING_ATTENUATION), _mm_setzero_si128());
+	x = _mm_xor_si128(_mm_packs_epi16(x, x), _mm_set1_epi8((char)0x80));
+
+	v = _mm_cvtsi128_si32(x);
+	memcpy(p, &v, 4);
+}
+
+static inline SCHISM_ALWAYS_INLINE CLIP_SSE2_ATTR
+void clip_store_16_sse2(unsigned char *p, __m128i x)
+{
+	x = _mm_srai_epi32(x, 16 - MIXING_ATTENUATION);
+	_mm_storel_epi64((__m128i *)p, _mm_packs_epi32(x, x));
+}
+
+static inline SCHISM_ALWAYS_INLINE CLIP_SSE2_ATTR
+void clip_store_24_sse2(unsigned char *p, __m128i x)
+{
+	int32_t v;
+
+	x = _mm_and_si128(_mm_srai_epi32(x, 8 - MIXING_ATTENUATION), _mm_set1_epi32(0xFFFFFF));
+
+	/* squash each pair of samples into the low six bytes of its half... */
+	x = _mm_or_si128(_mm_and_si128(x, _mm_set_epi32(0, -1, 0, -1)),
+		_mm_slli_epi64(_mm_srli_epi64(x, 32), 24));
+
+	/* ...and then the two halves together */
+	x = _mm_or_si128(_mm_move_epi64(x), _mm_slli_si128(_mm_unpackhi_epi64(x, _mm_setzero_si128()), 6));
+
+	_mm_storel_epi64((__m128i *)p, x);
+	v = _mm_cvtsi128_si32(_mm_srli_si128(x, 8));
+	memcpy(p + 8, &v, 4);
+}
+
+static inline SCHISM_ALWAYS_INLINE CLIP_SSE2_ATTR
+void clip_store_32_sse2(unsigned char *p, __m128i x)
+{
+	_mm_storeu_si128((__m128i *)p, _mm_slli_epi32(x, MIXING_ATTENUATION));
+}
+
+static inline SCHISM_ALWAYS_INLINE CLIP_SSE2_ATTR
+void clip_store_float_sse2(SCHISM_UNUSED unsigned char *p, SCHISM_UNUSED __m128i x)
+{
+	/* already done */
+}
+
+CLIP_FUNCTIONS(sse2, CLIP_SSE2_ATTR, __m128i, 4)
+
+# endif
+
+# if defined(SCHISM_AVX2) && defined(CLIP_SSE2)
+#  define CLIP_AVX2
+#  define CLIP_AVX2_ATTR __attribute__((__target__("avx2")))
+
+#  define clip_min_avx2 _mm256_min_epi32
+#  define clip_max_avx2 _mm256_max_epi32
+
+static inline SCHISM_ALWAYS_INLINE CLIP_AVX2_ATTR
+__m256i clip_vu_set_avx2(int32_t l, int32_t r)
+{
+	return _mm256_setr_epi32(l, r, l, r, l, r, l, r);
+}
+
+static inline SCHISM_ALWAYS_INLINE CLIP_AVX2_ATTR
+void clip_vu_get_avx2(__m256i vmin, __m256i vmax, int32_t *mins, int32_t *maxs)
+{
+	clip_vu_get_sse2(
+		_mm_min_epi32(_mm256_castsi256_si128(vmin), _mm256_extracti128_si256(vmin, 1)),
+		_mm_max_epi32(_mm256_castsi256_si128(vmax), _mm256_extracti128_si256(vmax, 1)),
+		mins, maxs);
+}
+
+static inline SCHISM_ALWAYS_INLINE CLIP_AVX2_ATTR
+__m256i clip_load_avx2(SCHISM_UNUSED unsigned char *p, const int32_t *buffer)
+{
+	return _mm256_min_epi32(_mm256_max_epi32(_mm256_loadu_si256((const __m256i *)buffer),
+		_mm256_set1_epi32(MIXING_CLIPMIN)), _mm256_set1_epi32(MIXING_CLIPMAX));
+}
+
+static inline SCHISM_ALWAYS_INLINE CLIP_AVX2_ATTR
+__m256i clip_load_float_avx2(unsigned char *p, const float *buffer)
+{
+	__m256 f = _mm256_max_ps(_mm256_set1_ps(-1.0f), _mm256_min_ps(_mm256_set1_ps(1.0f), _mm256_loadu_ps(buffer)));
+
+	_mm256_storeu_ps((float *)p, f);
+
+	return _mm256_min_epi32(_mm256_max_epi32(_mm256_cvttps_epi32(_mm256_mul_ps(f, _mm256_set1_ps(1.0f / MIXING_FLOAT_SCALE))),
+		_mm256_set1_epi32(MIXING_CLIPMIN)), _mm256_set1_epi32(MIXING_CLIPMAX));
+}
+
+/* the narrow formats just go through the SSE2 code a half at a time */
+#  define CLIP_STORE_HALVES_AVX2(bits, size) \
+	static inline SCHISM_ALWAYS_INLINE CLIP_AVX2_ATTR \
+	void clip_store_##bits##_avx2(unsigned char *p, __m256i x) \
+	{ \
+		clip_store_##bits##_sse2(p, _mm256_castsi256_si128(x)); \
+		clip_store_##bits##_sse2(p + 4 * (size), _mm256_extracti128_si256(x, 1)); \
+	}
+
+CLIP_STORE_HALVES_AVX2(8, 1)
+CLIP_STORE_HALVES_AVX2(16, 2)
+CLIP_STORE_HALVES_AVX2(24, 3)
+
+#  undef CLIP_STORE_HALVES_AVX2
+
+static inline SCHISM_ALWAYS_INLINE CLIP_AVX2_ATTR
+void clip_store_32_avx2(unsigned char *p, __m256i x)
+{
+	_mm256_storeu_si256((__m256i *)p, _mm256_slli_epi32(x, MIXING_ATTENUATION));
+}
+
+static inline SCHISM_ALWAYS_INLINE CLIP_AVX2_ATTR
+void clip_store_float_avx2(SCHISM_UNUSED unsigned char *p, SCHISM_UNUSED __m256i x)
+{
+	/* already done */
+}
+
+CLIP_FUNCTIONS(avx2, CLIP_AVX2_ATTR, __m256i, 8)
+
+# endif
+#endif
+
+#undef CLIP_FUNCTIONS
+#undef CLIP_FUNCTION
+
+#define CLIP_DISPATCH(name, in_type) \
+	uint32_t name(void *ptr, in_type *buffer, uint32_t samples, int32_t *mins, int32_t *maxs) \
+	{ \
+		CLIP_DISPATCH_AVX2(name) \
+		CLIP_DISPATCH_SSE2(name) \
+	\
+		return name##_c(ptr, buffer, samples, mins, maxs); \
+	}
+
+#ifdef CLIP_AVX2
+# define CLIP_DISPATCH_AVX2(name) \
+	if (cpu_has_feature(CPU_FEATURE_AVX2)) \
+		return name##_avx2(ptr, buffer, samples, mins, maxs);
+#else
+# define CLIP_DISPATCH_AVX2(name)
+#endif
+
+#ifdef CLIP_SSE2
+# define CLIP_DISPATCH_SSE2(name) \
+	if (cpu_has_feature(CPU_FEATURE_SSE2)) \
+		return name##_sse2(ptr, buffer, samples, mins, maxs);
+#else
+# define CLIP_DISPATCH_SSE2(name)
+#endif
+
+CLIP_DISPATCH(clip_32_to_8, int32_t)
+CLIP_DISPATCH(clip_32_to_16, int32_t)
+CLIP_DISPATCH(clip_32_to_24, int32_t)
+CLIP_DISPATCH(clip_32_to_32, int32_t)
+CLIP_DISPATCH(clip_float_to_float, float)
+
+#undef CLIP_DISPATCH_AVX2
+#undef CLIP_DISPATCH_SSE2
+#undef CLIP_DISPATCH
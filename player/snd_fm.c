@@ -26,7 +26,10 @@
 #include "player/fmopl.h"
 #include "player/snd_fm.h"
 #include "player/sndfile.h"
+#include "player/cmixer.h"
 #include "log.h"
+#include "mem.h"
+#include "mt.h"
 #include "util.h" /* for clamp */
 
 #define OPLRATEBASE 49716 // It's not a good idea to deviate from this.
@@ -53,6 +56,31 @@
 # error "The current value of OPLSOURCE isn't supported! Check build-config.h."
 #endif
 
+static mt_mutex_t *opl_table_mutex = NULL;
+
+int Fmdrv_InitLock(void)
+{
+	opl_table_mutex = mt_mutex_create();
+	return opl_table_mutex ? 0 : -1;
+}
+
+void Fmdrv_QuitLock(void)
+{
+	if (opl_table_mutex)
+		mt_mutex_delete(opl_table_mutex);
+	opl_table_mutex = NULL;
+}
+
+void opl_lock_tables(void)
+{
+	mt_mutex_lock(opl_table_mutex);
+}
+
+void opl_unlock_tables(void)
+{
+	mt_mutex_unlock(opl_table_mutex);
+}
+
 /* This just forwards to OPLUpdateMulti now */
 static inline void OPLUpdateOne(void *chip, int32_t *buffer, int length, uint32_t vu_max[OPL_CHANNELS])
 {
@@ -216,17 +244,92 @@ static unsigned char Fmdrv_Inportb(song_t *csf, uint32_t port)
 }
 
 
+static void Fmdrv_FreeResamplers(song_t *csf)
+{
+	uint32_t i;
+
+	if (!csf->opl_resampler)
+		return;
+
+	for (i = 0; i < OPL_CHANNELS; i++)
+		stream_resampler_free(&csf->opl_resampler[i]);
+
+	free(csf->opl_resampler);
+	csf->opl_resampler = NULL;
+}
+
 void Fmdrv_Init(song_t *csf, int32_t mixfreq)
 {
-	if (csf->opl != NULL) {
-		OPLCloseChip(csf->opl);
-		csf->opl = NULL;
+	const int native = !!(csf->mix_flags & SNDMIX_NATIVEOPL);
+	uint32_t i;
+
+	// At the native rate the chip doesn't care about the mixing rate, so the
+	// one we already have can be kept.
+	if (!native || !csf->opl || !csf->opl_resampler) {
+		if (csf->opl != NULL) {
+			OPLCloseChip(csf->opl);
+			csf->opl = NULL;
+		}
+		// Clock = speed at which the chip works. mixfreq = audio resampler
+		csf->opl = OPLNew(OPLRATEBASE * OPLRATEDIVISOR, native ? OPLRATEBASE : mixfreq);
+	}
+
+	if (native) {
+		if (!csf->opl_resampler)
+			csf->opl_resampler = mem_calloc(OPL_CHANNELS, sizeof(*csf->opl_resampler));
+
+		for (i = 0; i < OPL_CHANNELS; i++)
+			stream_resampler_init(&csf->opl_resampler[i], OPLRATEBASE, mixfreq);
+	} else {
+		Fmdrv_FreeResamplers(csf);
 	}
-	// Clock = speed at which the chip works. mixfreq = audio resampler
-	csf->opl = OPLNew(OPLRATEBASE * OPLRATEDIVISOR, mixfreq);
+
 	OPL_Reset(csf);
 }
 
+/* Renders at the chip's own rate, and resamples that into the mixing buffers.
+ * All of the channels go through one resampler when they end up in the same
+ * buffer, and each gets its own with the multi-write output. */
+static void Fmdrv_MixNative(song_t *csf, uint32_t count, uint32_t vu_max[OPL_CHANNELS])
+{
+	int32_t *buffers[OPL_CHANNELS] = {0};
+	int32_t *outputs[OPL_CHANNELS] = {0};
+	uint32_t frames = 0, i;
+
+	if (csf->multi_write) {
+		for (i = 0; i < OPL_CHANNELS; i++) {
+			int32_t opl_v = csf->opl_to_chan[i];
+
+			buffers[i] = stream_resampler_get_input(&csf->opl_resampler[i], count, &frames);
+
+			if (opl_v < 0 || opl_v >= (int32_t)csf->voice_count /* this is a bug */)
+				continue;
+
+			outputs[i] = csf->multi_write[opl_v].buffer;
+		}
+	} else {
+		int32_t *input = stream_resampler_get_input(&csf->opl_resampler[0], count, &frames);
+
+		for (i = 0; i < OPL_CHANNELS; i++) {
+			int32_t opl_v = csf->opl_to_chan[i];
+			if (opl_v < 0 || opl_v >= (int32_t)csf->voice_count /* this is a bug */)
+				continue;
+
+			buffers[i] = (csf->voices[opl_v].flags & CHN_MUTE) ? NULL : input;
+		}
+	}
+
+	if (frames)
+		OPLUpdateMulti(csf->opl, buffers, frames, vu_max);
+
+	if (csf->multi_write) {
+		for (i = 0; i < OPL_CHANNELS; i++)
+			stream_resampler_mix(&csf->opl_resampler[i], outputs[i], count);
+	} else {
+		stream_resampler_mix(&csf->opl_resampler[0], csf->mix_buffer, count);
+	}
+}
+
 // count, like csf_create_stereo_mix, is in samples
 void Fmdrv_Mix(song_t *csf, uint32_t count)
 {
@@ -246,7 +349,7 @@ void Fmdrv_Mix(song_t *csf, uint32_t count)
 	/* first, fill in the VU meters */
 	for (i = 0; i < OPL_CHANNELS; i++) {
 		int32_t opl_v = csf->opl_to_chan[i];
-		if (opl_v < 0 || opl_v >= MAX_VOICES /* this is a bug */)
+		if (opl_v < 0 || opl_v >= (int32_t)csf->voice_count /* this is a bug */)
 			continue;
 
 		vu_max[i] = (csf->voices[opl_v].vu_meter << 16) / OPL_VOLUME;
@@ -254,12 +357,14 @@ void Fmdrv_Mix(song_t *csf, uint32_t count)
 
 	// IF we wanted to do the stereo mix in software, we could setup the voices always in mono
 	// and do the panning here.
-	if (csf->multi_write) {
+	if (csf->opl_resampler) {
+		Fmdrv_MixNative(csf, count, vu_max);
+	} else if (csf->multi_write) {
 		int32_t *buffers[OPL_CHANNELS] = {0};
 
 		for (i = 0; i < OPL_CHANNELS; i++) {
 			int32_t opl_v = csf->opl_to_chan[i];
-			if (opl_v < 0 || opl_v >= MAX_VOICES /* this is a bug */)
+			if (opl_v < 0 || opl_v >= (int32_t)csf->voice_count /* this is a bug */)
 				continue;
 
 			buffers[i] = csf->multi_write[opl_v].buffer;
@@ -273,7 +378,7 @@ void Fmdrv_Mix(song_t *csf, uint32_t count)
 
 		for (i = 0; i < OPL_CHANNELS; i++) {
 			int32_t opl_v = csf->opl_to_chan[i];
-			if (opl_v < 0 || opl_v >= MAX_VOICES /* this is a bug */)
+			if (opl_v < 0 || opl_v >= (int32_t)csf->voice_count /* this is a bug */)
 				continue;
 
 			buffers[i] = (csf->voices[opl_v].flags & CHN_MUTE) ? NULL : csf->mix_buffer;
@@ -284,7 +389,7 @@ void Fmdrv_Mix(song_t *csf, uint32_t count)
 
 	for (i = 0; i < OPL_CHANNELS; i++) {
 		int32_t opl_v = csf->opl_to_chan[i];
-		if (opl_v < 0 || opl_v >= MAX_VOICES /* this is a bug */)
+		if (opl_v < 0 || opl_v >= (int32_t)csf->voice_count /* this is a bug */)
 			continue;
 
 		csf->voices[opl_v].vu_meter = (vu_max[i] * OPL_VOLUME) >> 16;
@@ -588,7 +693,7 @@ void OPL_Reset(song_t *csf)
 	OPLResetChip(csf->opl);
 	OPL_Detect(csf);
 
-	for(a = 0; a < MAX_VOICES; ++a) {
+	for(a = 0; a < (int32_t)csf->voice_count; ++a) {
 		csf->opl_from_chan[a]=-1;
 	}
 	for(a = 0; a < OPL_CHANNELS; ++a) {
@@ -645,4 +750,6 @@ void OPL_Close(song_t *csf)
 		OPLCloseChip(csf->opl);
 		csf->opl = NULL;
 	}
+
+	Fmdrv_FreeResamplers(csf);
 }
@@ -303,7 +303,7 @@ static int32_t GM_AllocateMelodyChannel(song_t *csf, int32_t c, int32_t patch, i
 	int32_t bad_channels[MAX_MIDI_CHANNELS] = {0};  // channels having the same key playing
 	int32_t used_channels[MAX_MIDI_CHANNELS] = {0}; // channels having something playing
 
-	for (uint32_t a = 0; a < MAX_VOICES; ++a) {
+	for (uint32_t a = 0; a < csf->voice_count; ++a) {
 		if (s3m_active(csf->midi_s3m_chans[a]) &&
 		    !s3m_percussion(csf->midi_s3m_chans[a])) {
 			//fprintf(stderr, "S3M[%d] active at %d\n", a, csf->midi_s3m_chans[a].chan);
@@ -367,7 +367,7 @@ static int32_t GM_AllocateMelodyChannel(song_t *csf, int32_t c, int32_t patch, i
 
 void GM_Patch(song_t *csf, int32_t c, unsigned char p, int32_t pref_chn_mask)
 {
-	if (c < 0 || ((uint32_t) c) >= MAX_VOICES)
+	if (c < 0 || ((uint32_t) c) >= csf->voice_count)
 		return;
 
 	csf->midi_s3m_chans[c].patch         = p; // No actual data is sent.
@@ -377,7 +377,7 @@ void GM_Patch(song_t *csf, int32_t c, unsigned char p, int32_t pref_chn_mask)
 
 void GM_Bank(song_t *csf, int32_t c, unsigned char b)
 {
-	if (c < 0 || ((uint32_t) c) >= MAX_VOICES)
+	if (c < 0 || ((uint32_t) c) >= csf->voice_count)
 		return;
 
 	csf->midi_s3m_chans[c].bank = b; // No actual data is sent yet.
@@ -386,7 +386,7 @@ void GM_Bank(song_t *csf, int32_t c, unsigned char b)
 
 void GM_Touch(song_t *csf, int32_t c, unsigned char vol)
 {
-	if (c < 0 || ((uint32_t) c) >= MAX_VOICES)
+	if (c < 0 || ((uint32_t) c) >= csf->voice_count)
 		return;
 
 	/* This function must only be called when
@@ -401,7 +401,7 @@ void GM_Touch(song_t *csf, int32_t c, unsigned char vol)
 
 void GM_KeyOn(song_t *csf, int32_t c, unsigned char key, unsigned char vol)
 {
-	if (c < 0 || ((uint32_t) c) >= MAX_VOICES)
+	if (c < 0 || ((uint32_t) c) >= csf->voice_count)
 		return;
 
 	GM_KeyOff(csf, c); // Ensure the previous key on this channel is off.
@@ -445,7 +445,7 @@ void GM_KeyOn(song_t *csf, int32_t c, unsigned char key, unsigned char vol)
 
 void GM_KeyOff(song_t *csf, int32_t c)
 {
-	if (c < 0 || ((uint32_t)c) >= MAX_VOICES)
+	if (c < 0 || ((uint32_t)c) >= csf->voice_count)
 		return;
 
 	if (!s3m_active(csf->midi_s3m_chans[c]))
@@ -467,7 +467,7 @@ void GM_KeyOff(song_t *csf, int32_t c)
 
 void GM_Bend(song_t *csf, int32_t c, uint32_t count)
 {
-       if (c < 0 || ((uint32_t)c) >= MAX_VOICES)
+       if (c < 0 || ((uint32_t)c) >= csf->voice_count)
 		return;
 
 	/* I hope nobody tries to bend hi-hat or something like that :-) */
@@ -495,7 +495,7 @@ void GM_Reset(song_t *csf, int quitting)
 	uint32_t a;
 	//fprintf(stderr, "GM_Reset\n");
 
-	for (a = 0; a < MAX_VOICES; a++) {
+	for (a = 0; a < csf->voice_count; a++) {
 		GM_KeyOff(csf, a);
 		//csf->midi_s3m_chans[a].patch = csf->midi_s3m_chans[a].bank = csf->midi_s3m_chans[a].pan = 0;
 		s3m_reset(&csf->midi_s3m_chans[a]);
@@ -548,7 +548,7 @@ void GM_DPatch(song_t *csf, int32_t ch, unsigned char GM, unsigned char bank, in
 	fprintf(stderr, "GM_DPatch(%d, %02X @ %d)\n", ch, GM, bank);
 #endif
 
-	if (ch < 0 || ((uint32_t)ch) >= MAX_VOICES)
+	if (ch < 0 || ((uint32_t)ch) >= csf->voice_count)
 		return;
 
 	GM_Bank(csf, ch, bank);
@@ -559,7 +559,7 @@ void GM_DPatch(song_t *csf, int32_t ch, unsigned char GM, unsigned char bank, in
 void GM_Pan(song_t *csf, int32_t c, signed char val)
 {
 	//fprintf(stderr, "GM_Pan(%d,%d)\n", c,val);
-	if (c < 0 || ((uint32_t)c) >= MAX_VOICES)
+	if (c < 0 || ((uint32_t)c) >= csf->voice_count)
 		return;
 
 	csf->midi_s3m_chans[c].pan = val;
@@ -579,7 +579,7 @@ void GM_SetFreqAndVol(song_t *csf, int32_t c, int32_t Hertz, int32_t vol, MidiBe
 #ifdef GM_DEBUG
 	fprintf(stderr, "GM_SetFreqAndVol(%d,%d,%d)\n", c,Hertz,vol);
 #endif
-	if (c < 0 || ((uint32_t)c) >= MAX_VOICES)
+	if (c < 0 || ((uint32_t)c) >= csf->voice_count)
 		return;
 
 	/*
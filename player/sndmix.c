@@ -630,7 +630,7 @@ static inline int32_t rn_update_sample(song_t *csf, song_voice_t *chan, int32_t
 	if (nchan >= MAX_CHANNELS && !(chan->volume && chan->global_volume && chan->instrument_volume))
 		chan->length = 0;
 
-	if (csf->num_voices >= MAX_VOICES)
+	if (csf->num_voices >= csf->voice_count)
 		return 0;
 
 	return 1;
@@ -690,8 +690,9 @@ static inline void rn_gen_key(song_t *csf, song_voice_t *chan, int32_t chan_num,
 
 int32_t csf_init_player(song_t *csf, int reset)
 {
-	if (csf->max_voices > MAX_VOICES)
-		csf->max_voices = MAX_VOICES;
+	/* there's no point in a limit that can't be reached */
+	if (csf->max_voices > csf->voice_count)
+		csf->max_voices = csf->voice_count;
 
 	csf->mix_frequency = CLAMP(csf->mix_frequency, 4000, MAX_SAMPLE_RATE);
 
@@ -713,7 +714,8 @@ int32_t csf_init_player(song_t *csf, int reset)
 		csf->vu_right = 0;
 	}
 
-	song_init_eq(reset, csf->mix_frequency);
+	initialize_eq(csf, reset, csf->mix_frequency);
+	initialize_filter_cache(csf);
 
 	// I don't know why, but this "if" makes it work at the desired sample rate instead of 4000.
 	// the "4000Hz" value comes from csf_reset, but I don't yet understand why the opl keeps that value, if
@@ -729,6 +731,8 @@ uint32_t csf_read(song_t *csf, void * v_buffer, uint32_t bufsize)
 {
 	uint8_t * buffer = (uint8_t *)v_buffer;
 	convert_t convert_func = clip_32_to_8;
+	/* the float bus only makes sense with 32-bit output */
+	const int float_mix = (csf->mix_flags & SNDMIX_FLOATMIX) && csf->mix_bits_per_sample == 32;
 	int32_t vu_min[2];
 	int32_t vu_max[2];
 	uint32_t bufleft, max, sample_size, count, smpcount, mix_stat=0;
@@ -738,6 +742,7 @@ uint32_t csf_read(song_t *csf, void * v_buffer, uint32_t bufsize)
 
 
 	csf->mix_stat = 0;
+	csf->mix_skipped = 0;
 	sample_size = csf->mix_channels;
 
 	switch (csf->mix_bits_per_sample) {
@@ -765,9 +770,6 @@ uint32_t csf_read(song_t *csf, void * v_buffer, uint32_t bufsize)
 			if (!csf_read_note(csf)) {
 				csf->flags |= SONG_ENDREACHED;
 
-				if (csf->stop_at_order > -1)
-					return 0; /* faster */
-
 				if (bufleft == max)
 					break;
 
@@ -781,8 +783,8 @@ uint32_t csf_read(song_t *csf, void * v_buffer, uint32_t bufsize)
 
 		count = csf->buffer_count;
 
-		if (count > MIXBUFFERSIZE)
-			count = MIXBUFFERSIZE;
+		if (count > csf->mix_buffer_size)
+			count = csf->mix_buffer_size;
 
 		if (count > bufleft)
 			count = bufleft;
@@ -804,7 +806,19 @@ uint32_t csf_read(song_t *csf, void * v_buffer, uint32_t bufsize)
 		}
 
 		// Handle eq
-		if (csf->mix_channels >= 2) {
+		if (float_mix) {
+			mix_buffer_to_float(csf->mix_buffer_float, csf->mix_buffer, smpcount);
+
+			if (csf->mix_channels >= 2) {
+				eq_stereo_float(csf, csf->mix_buffer_float, count);
+				if (!(csf->mix_flags & SNDMIX_DIRECTTODISK))
+					normalize_stereo_float(csf, csf->mix_buffer_float, count);
+			} else {
+				eq_mono_float(csf, csf->mix_buffer_float, count);
+				if (!(csf->mix_flags & SNDMIX_DIRECTTODISK))
+					normalize_mono_float(csf, csf->mix_buffer_float, count);
+			}
+		} else if (csf->mix_channels >= 2) {
 			eq_stereo(csf, csf->mix_buffer, count);
 			if (!(csf->mix_flags & SNDMIX_DIRECTTODISK))
 				normalize_stereo(csf, csf->mix_buffer, count);
@@ -821,16 +835,28 @@ uint32_t csf_read(song_t *csf, void * v_buffer, uint32_t bufsize)
 			as temp space for converting */
 			for (uint32_t n = 0; n < MAX_CHANNELS; n++) {
 				if (csf->multi_write[n].used) {
+					uint32_t bytes;
+
 					if (csf->mix_channels < 2)
 						mono_from_stereo(csf->multi_write[n].buffer, count);
-					uint32_t bytes = convert_func(buffer, csf->multi_write[n].buffer,
-						smpcount, vu_min, vu_max);
+
+					if (float_mix) {
+						/* mix_buffer_float is free to use as scratch space here too */
+						mix_buffer_to_float(csf->mix_buffer_float, csf->multi_write[n].buffer, smpcount);
+						bytes = clip_float_to_float(buffer, csf->mix_buffer_float, smpcount, vu_min, vu_max);
+					} else {
+						bytes = convert_func(buffer, csf->multi_write[n].buffer,
+							smpcount, vu_min, vu_max);
+					}
+
 					csf->multi_write[n].write(csf->multi_write[n].data, buffer, bytes);
 				} else {
 					csf->multi_write[n].silence(csf->multi_write[n].data,
 						smpcount * ((csf->mix_bits_per_sample + 7) / 8));
 				}
 			}
+		} else if (float_mix) {
+			buffer += clip_float_to_float(buffer, csf->mix_buffer_float, smpcount, vu_min, vu_max);
 		} else {
 			// Perform clipping + VU-Meter
 			buffer += convert_func(buffer, csf->mix_buffer, smpcount, vu_min, vu_max);
@@ -863,6 +889,8 @@ uint32_t csf_read(song_t *csf, void * v_buffer, uint32_t bufsize)
 	if (mix_stat) {
 		csf->mix_stat += mix_stat - 1;
 		csf->mix_stat /= mix_stat;
+		csf->mix_skipped += mix_stat - 1;
+		csf->mix_skipped /= mix_stat;
 	}
 
 	return max - bufleft;
@@ -944,7 +972,10 @@ int32_t increment_order(song_t *csf)
 }
 
 /* do_midi is a boolean saying whether to bypass midi processing.
- * that ALONE improves speeds drastically. */
+ * that ALONE improves speeds drastically.
+ *
+ * NOTE: csf_get_length has its own copy of the timing bits of this
+ * (timing_step_row in csndfile.c); keep them in sync. */
 int32_t csf_process_tick(song_t *csf)
 {
 	csf->flags &= ~SONG_FIRSTTICK;
@@ -999,8 +1030,7 @@ int32_t csf_process_tick(song_t *csf)
 			// commands... ALL WE DO is dump raw midi data to
 			// our super-secret "midi buffer"
 			// -mrsb
-			if (!(csf->mix_flags & SNDMIX_CALCLENGTH))
-				csf_midi_out_note(csf, nchan, m);
+			csf_midi_out_note(csf, nchan, m);
 
 			chan->row_note = m->note;
 
@@ -1028,11 +1058,9 @@ int32_t csf_process_tick(song_t *csf)
 
 		song_note_t *m = csf->patterns[csf->current_pattern] + csf->row * MAX_CHANNELS;
 
-		if (!(csf->mix_flags & SNDMIX_CALCLENGTH)) {
-			for (uint32_t nchan=0; nchan<MAX_CHANNELS; nchan++, m++) {
-				/* m == NULL allows schism to receive notification of SDx and Scx commands */
-				csf_midi_out_note(csf, nchan, NULL);
-			}
+		for (uint32_t nchan=0; nchan<MAX_CHANNELS; nchan++, m++) {
+			/* m == NULL allows schism to receive notification of SDx and Scx commands */
+			csf_midi_out_note(csf, nchan, NULL);
 		}
 
 		if (!(csf->tick_count % (csf->current_speed + csf->frame_delay))) {
@@ -1048,6 +1076,32 @@ int32_t csf_process_tick(song_t *csf)
 ////////////////////////////////////////////////////////////////////////////////////////////
 // Handles envelopes & mixer setup
 
+// Returns the voice after cn that needs updating: every pattern channel, and
+// then only the NNA voices that are marked busy.
+static inline SCHISM_ALWAYS_INLINE
+uint32_t next_voice(song_t *csf, uint32_t cn)
+{
+	const uint32_t words = (csf->voice_count + 31) / 32;
+	uint32_t w, bits;
+
+	if (++cn < MAX_CHANNELS)
+		return cn;
+
+	w = cn >> 5;
+	if (w >= words)
+		return csf->voice_count;
+
+	bits = csf->busy_voices[w] & (UINT32_MAX << (cn & 31));
+	while (!bits) {
+		if (++w >= words)
+			return csf->voice_count;
+		bits = csf->busy_voices[w];
+	}
+
+	// isolate the lowest set bit
+	return (w << 5) + blog2(bits & (~bits + 1));
+}
+
 int32_t csf_read_note(song_t *csf)
 {
 	song_voice_t *chan;
@@ -1091,14 +1145,6 @@ int32_t csf_read_note(song_t *csf)
 
 	csf->buffer_count = csf_calculate_tick_length(csf);
 
-	// chaseback hoo hah
-	if (csf->stop_at_order > -1 && csf->stop_at_row > -1) {
-		if (csf->stop_at_order <= (int32_t)csf->current_order &&
-		    csf->stop_at_row <= (int32_t)csf->row) {
-			return 0;
-		}
-	}
-
 	////////////////////////////////////////////////////////////////////////////////////
 	// Update channels data
 
@@ -1107,7 +1153,7 @@ int32_t csf_read_note(song_t *csf)
 
 	csf->num_voices = 0;
 
-	for (cn = 0, chan = csf->voices; cn < MAX_VOICES; cn++, chan++) {
+	for (cn = 0, chan = csf->voices; cn < csf->voice_count; cn = next_voice(csf, cn), chan = csf->voices + cn) {
 		/*if(cn == 4 || chan->master_channel == 4)
 		fprintf(stderr, "considering voice %d (per %d, pos %d/%d, flags %X)\n",
 			(int32_t)cn, chan->frequency, chan->position, chan->length, chan->flags);*/
@@ -1116,8 +1162,11 @@ int32_t csf_read_note(song_t *csf)
 
 		// Check for unused channel
 		if (cn >= MAX_CHANNELS)
-			if (!chan->length && !(chan->flags & CHN_ADLIB))
+			if (!chan->length && !(chan->flags & CHN_ADLIB)) {
+				// it's stopped; don't look at it again until it's reused
+				BITARRAY_CLEAR(csf->busy_voices, cn);
 				continue;
+			}
 
 		// Reset channel data
 		chan->increment = csf_smp_pos(0,0);
@@ -1212,13 +1261,13 @@ int32_t csf_read_note(song_t *csf)
 				rn_gen_key(csf, chan, cn, frequency, vol);
 
 			if (chan->flags & CHN_NEWNOTE) {
-				setup_channel_filter(chan, 1, 256, csf->mix_frequency);
+				setup_channel_filter(csf, chan, 1, 256);
 			}
 
 			// Filter Envelope: controls cutoff frequency
 			if (chan && chan->ptr_instrument && chan->ptr_instrument->flags & ENV_FILTER) {
-				setup_channel_filter(chan,
-					!(chan->flags & CHN_FILTER), envpitch, csf->mix_frequency);
+				setup_channel_filter(csf, chan,
+					!(chan->flags & CHN_FILTER), envpitch);
 			}
 
 			chan->sample_freq = frequency;
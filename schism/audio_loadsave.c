@@ -44,6 +44,9 @@
 
 #include "midi.h"
 #include "disko.h"
+#include "mt.h"
+#include "atomic.h"
+#include "timer.h"
 
 // ------------------------------------------------------------------------
 
@@ -217,6 +220,8 @@ static void message_convert_newlines(song_t *song) {
 song_t *song_create_load(const char *file)
 {
 	slurp_t s;
+	fmt_detect_t det;
+	fmt_load_song_func candidates[ARRAY_SIZE(load_song_funcs)];
 	fmt_load_song_func *func;
 	int ok = 0, err = 0;
 
@@ -238,7 +243,10 @@ song_t *song_create_load(const char *file)
 		csf_copy_midi_cfg(newsong, current_song);
 	}
 
-	for (func = load_song_funcs; *func && !ok; func++) {
+	fmt_detect_init(&det, &s);
+	fmt_detect_load_song_funcs(&det, load_song_funcs, candidates);
+
+	for (func = candidates; *func && !ok; func++) {
 		slurp_rewind(&s);
 		switch ((*func)(newsong, &s, 0)) {
 		case LOAD_SUCCESS:
@@ -272,7 +280,6 @@ song_t *song_create_load(const char *file)
 		return NULL;
 	}
 
-	newsong->stop_at_order = newsong->stop_at_row = -1;
 	message_convert_newlines(newsong);
 	message_reset_selection();
 
@@ -482,6 +489,154 @@ int song_export(const char *filename, const char *type)
 }
 
 
+/* ------------------------------------------------------------------------ */
+/* batch export, for --render-jobs */
+
+struct export_batch {
+	char *const *files;
+	int nfiles;
+	const char *template;
+	const struct save_format *format;
+
+	/* the loaders (and the log they write to) aren't reentrant,
+	 * so only the rendering itself happens in parallel */
+	mt_mutex_t *load_lock;
+
+	struct atm next_file;
+	struct atm failed;
+};
+
+/* replaces "%s" in the template with the song's filename, minus the extension */
+static char *batch_get_filename(const char *template, const char *file)
+{
+	const char *base = dmoz_path_get_basename(file);
+	const char *ext = dmoz_path_get_extension(base);
+	const char *sub = strstr(template, "%s");
+	const size_t baselen = ext - base;
+	char *ret;
+
+	if (!sub)
+		return str_dup(template);
+
+	ret = mem_alloc(strlen(template) - 2 + baselen + 1);
+	memcpy(ret, template, sub - template);
+	memcpy(ret + (sub - template), base, baselen);
+	strcpy(ret + (sub - template) + baselen, sub + 2);
+
+	return ret;
+}
+
+static int export_batch_worker(void *userdata)
+{
+	struct export_batch *batch = userdata;
+
+	for (;;) {
+		int n = atm_inc(&batch->next_file);
+		const char *file;
+		char *out;
+		song_t *csf;
+		timer_ticks_t start, elapsed;
+		uint64_t frames = 0;
+		double secs;
+
+		if (n >= batch->nfiles)
+			break;
+
+		file = batch->files[n];
+
+		mt_mutex_lock(batch->load_lock);
+		csf = song_create_load(file);
+		mt_mutex_unlock(batch->load_lock);
+
+		if (!csf) {
+			fprintf(stderr, "%s: %s\n", file, fmt_strerror(errno));
+			atm_inc(&batch->failed);
+			continue;
+		}
+
+		/* same as song_load_unchecked does for the current song */
+		_fix_names(csf);
+		song_init_mix_settings(csf);
+
+		out = batch_get_filename(batch->template, file);
+
+		start = timer_ticks_us();
+		if (disko_render_song(csf, out, batch->format, 0, &frames) != DW_OK) {
+			fprintf(stderr, "%s: %s\n", out, strerror(errno));
+			atm_inc(&batch->failed);
+		} else {
+			elapsed = timer_ticks_us() - start;
+			secs = (double)frames / csf->mix_frequency;
+
+			printf("%s: %" PRIu64 ":%02" PRIu64 " written in %.2f sec (%.1fx realtime)\n",
+				out, (uint64_t)secs / 60, (uint64_t)secs % 60, elapsed / 1000000.0,
+				elapsed ? (secs * 1000000.0 / elapsed) : 0.0);
+		}
+
+		free(out);
+		csf_free(csf);
+	}
+
+	return 0;
+}
+
+int song_export_batch(char *const *files, int nfiles, const char *template, const char *type, int jobs)
+{
+	struct export_batch batch = {0};
+	mt_thread_t **threads;
+	timer_ticks_t start, elapsed;
+	int i, failed;
+
+	batch.format = get_save_format(song_export_formats, type);
+	if (!batch.format)
+		return nfiles;
+
+	if (batch.format->f.export.multi) {
+		log_appendf(4, "Multi-channel export can't be used with --render-jobs");
+		return nfiles;
+	}
+
+	if (nfiles > 1 && !strstr(template, "%s")) {
+		log_appendf(4, "Output filename needs a %%s to export more than one song");
+		return nfiles;
+	}
+
+	batch.files = files;
+	batch.nfiles = nfiles;
+	batch.template = template;
+	batch.load_lock = mt_mutex_create();
+	if (!batch.load_lock)
+		return nfiles;
+
+	jobs = CLAMP(jobs, 1, nfiles);
+
+	/* the calling thread does its share of the work too */
+	threads = mem_calloc(jobs, sizeof(*threads));
+
+	start = timer_ticks_us();
+
+	for (i = 1; i < jobs; i++)
+		threads[i] = mt_thread_create(export_batch_worker, "Export thread", &batch);
+
+	export_batch_worker(&batch);
+
+	for (i = 1; i < jobs; i++)
+		if (threads[i])
+			mt_thread_wait(threads[i], NULL);
+
+	elapsed = timer_ticks_us() - start;
+	failed = atm_load(&batch.failed);
+
+	printf("%d of %d songs written in %.2f sec using %d jobs\n",
+		nfiles - failed, nfiles, elapsed / 1000000.0, jobs);
+
+	free(threads);
+	mt_mutex_delete(batch.load_lock);
+
+	return failed;
+}
+
+
 int song_save(const char *filename, const char *type)
 {
 	disko_t fp;
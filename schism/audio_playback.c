@@ -33,6 +33,7 @@
 #include "str.h"
 #include "mt.h"
 #include "atomic.h"
+#include "cpu.h"
 
 #include "disko.h"
 #include "backend/audio.h"
@@ -144,12 +145,93 @@ static const schism_audio_backend_t *backend = NULL;
 // page_patedit.c
 extern int midi_last_bend_hit[MAX_CHANNELS];
 
+/* SSE2 versions of the conversions below; these give exactly the same
+ * output, just four samples at a time */
+#if SCHISM_GNUC_HAS_ATTRIBUTE(__target__, 4, 4, 0) \
+	&& (defined(__x86_64__) || defined(__i386__)) && !defined(SCHISM_XBOX) /* XBOX is buggy for some reason */
+# include <immintrin.h>
+
+# ifdef SCHISM_SSE2
+#  define CONVERT_SSE2
+#  define CONVERT_SSE2_ATTR __attribute__((__target__("sse2")))
+
+static CONVERT_SSE2_ATTR
+uint32_t s32_to_f32_sse2(void *ptr, const int32_t *buffer, uint32_t samples)
+{
+	float *p = (float *)ptr;
+	uint32_t i;
+
+	for (i = 0; i + 4 <= samples; i += 4)
+		_mm_storeu_ps(p + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_loadu_si128((const __m128i *)(buffer + i))),
+			_mm_set1_ps(1.0f / 2147483648.0f)));
+
+	for (; i < samples; i++)
+		p[i] = buffer[i] * (1.0f / 2147483648.0f);
+
+	return samples * 4;
+}
+
+static CONVERT_SSE2_ATTR
+uint32_t s32_to_f64_sse2(void *ptr, const int32_t *buffer, uint32_t samples)
+{
+	double *p = (double *)ptr;
+	uint32_t i;
+
+	for (i = 0; i + 2 <= samples; i += 2)
+		_mm_storeu_pd(p + i, _mm_mul_pd(_mm_cvtepi32_pd(_mm_loadl_epi64((const __m128i *)(buffer + i))),
+			_mm_set1_pd(1.0 / 2147483648.0)));
+
+	for (; i < samples; i++)
+		p[i] = buffer[i] * (1.0 / 2147483648.0);
+
+	return samples * 8;
+}
+
+static CONVERT_SSE2_ATTR
+uint32_t s32_to_s24_sse2(void *ptr, const int32_t *buffer, uint32_t samples)
+{
+	unsigned char *p = (unsigned char *)ptr;
+	uint32_t i;
+
+	for (i = 0; i + 4 <= samples; i += 4) {
+		/* the top three bytes of each sample */
+		__m128i x = _mm_srli_epi32(_mm_loadu_si128((const __m128i *)(buffer + i)), 8);
+		int32_t v;
+
+		/* squash each pair of samples into the low six bytes of its half,
+		 * and then the two halves together */
+		x = _mm_or_si128(_mm_and_si128(x, _mm_set_epi32(0, -1, 0, -1)),
+			_mm_slli_epi64(_mm_srli_epi64(x, 32), 24));
+		x = _mm_or_si128(_mm_move_epi64(x), _mm_slli_si128(_mm_unpackhi_epi64(x, _mm_setzero_si128()), 6));
+
+		_mm_storel_epi64((__m128i *)p, x);
+		v = _mm_cvtsi128_si32(_mm_srli_si128(x, 8));
+		memcpy(p + 8, &v, 4);
+		p += 12;
+	}
+
+	for (; i < samples; i++) {
+		memcpy(p, (char *)(buffer + i) + 1, 3);
+		p += 3;
+	}
+
+	return samples * 3;
+}
+
+# endif
+#endif
+
 static inline SCHISM_ALWAYS_INLINE
 uint32_t s32_to_f32(void *ptr, const int32_t *buffer, uint32_t samples)
 {
 	float *p = (float *)ptr;
 	uint32_t i;
 
+#ifdef CONVERT_SSE2
+	if (cpu_has_feature(CPU_FEATURE_SSE2))
+		return s32_to_f32_sse2(ptr, buffer, samples);
+#endif
+
 	for (i = 0; i < samples; i++)
 		p[i] = buffer[i] * (1.0f / 2147483648.0f);
 
@@ -173,18 +255,40 @@ uint32_t s32_to_f64(void *ptr, const int32_t *buffer, uint32_t samples)
 	double *p = (double *)ptr;
 	uint32_t i;
 
+#ifdef CONVERT_SSE2
+	if (cpu_has_feature(CPU_FEATURE_SSE2))
+		return s32_to_f64_sse2(ptr, buffer, samples);
+#endif
+
 	for (i = 0; i < samples; i++)
 		p[i] = buffer[i] * (1.0 / 2147483648.0);
 
 	return samples * 8;
 }
 
+static inline SCHISM_ALWAYS_INLINE
+uint32_t f32_to_f64(void *ptr, const float *buffer, uint32_t samples)
+{
+	double *p = (double *)ptr;
+	uint32_t i;
+
+	for (i = 0; i < samples; i++)
+		p[i] = buffer[i];
+
+	return samples * 8;
+}
+
 static inline SCHISM_ALWAYS_INLINE
 uint32_t s32_to_s24(void *ptr, const int32_t *buffer, uint32_t samples)
 {
 	unsigned char *p = (unsigned char *)ptr;
 	uint32_t i;
 
+#ifdef CONVERT_SSE2
+	if (cpu_has_feature(CPU_FEATURE_SSE2))
+		return s32_to_s24_sse2(ptr, buffer, samples);
+#endif
+
 	for (i = 0; i < samples; i++) {
 		memcpy(p, (char *)(buffer + i) + 1, 3);
 		p += 3;
@@ -248,6 +352,12 @@ static void audio_callback(uint8_t *stream, uint32_t len)
 	/* hax: convert internal buffer output */
 	if (audio_output_bits_real == 24) {
 		s32_to_s24(stream, (int32_t *)audio_buffer, n * audio_output_channels);
+	} else if (audio_output_fp && (current_song->mix_flags & SNDMIX_FLOATMIX)) {
+		/* the mixer already gave us float */
+		if (audio_output_bits_real == 64)
+			f32_to_f64(stream, (float *)audio_buffer, n * audio_output_channels);
+		else
+			memcpy(stream, audio_buffer, n * audio_sample_size);
 	} else if (audio_output_fp) {
 		((audio_output_bits_real == 64) ? s32_to_f64 : s32_to_f32)(stream,
 			(int32_t *)audio_buffer, n * audio_output_channels);
@@ -259,7 +369,14 @@ static void audio_callback(uint8_t *stream, uint32_t len)
 	if (audio_output_bits == 8)
 		mem_xor(audio_buffer, n * audio_sample_size, 0x80);
 
-	if (status.current_page == PAGE_WATERFALL || status.vis_style == VIS_FFT) {
+	if ((status.current_page == PAGE_WATERFALL || status.vis_style == VIS_FFT)
+		&& (current_song->mix_flags & SNDMIX_FLOATMIX)) {
+		if (audio_output_channels == 2) {
+			vis_work_f32s((float *)audio_buffer, n / 2);
+		} else {
+			vis_work_f32m((float *)audio_buffer, n);
+		}
+	} else if (status.current_page == PAGE_WATERFALL || status.vis_style == VIS_FFT) {
 		// I don't really like this...
 		switch (audio_output_bits) {
 #define BITSCASE(BITS) case BITS: if (audio_output_channels == 2) { vis_work_##BITS##s(audio_buffer, n / 2); } else { vis_work_##BITS##m(audio_buffer, n); } break;
@@ -781,8 +898,6 @@ static void song_reset_play_state(void)
 	current_song->buffer_count = 0;
 	current_song->flags &= ~(SONG_PAUSED | SONG_PATTERNLOOP | SONG_ENDREACHED);
 
-	current_song->stop_at_order = -1;
-	current_song->stop_at_row = -1;
 	samples_played = 0;
 }
 
@@ -1023,6 +1138,11 @@ int song_get_max_channels(void)
 {
 	return max_channels_used;
 }
+
+int song_get_silent_voices(void)
+{
+	return current_song->mix_skipped;
+}
 // Returns the max value in dBs, scaled as 0 = -40dB and 128 = 0dB.
 void song_get_vu_meter(int *left, int *right)
 {
@@ -1194,8 +1314,11 @@ void cfg_load_audio(cfg_file_t *cfg)
 	}
 
 	CFG_GET_M(channel_limit, DEF_CHANNEL_LIMIT);
+	CFG_GET_M(voice_limit, DEFAULT_VOICES);
 	CFG_GET_M(interpolation_mode, SRCMODE_LINEAR);
+	CFG_GET_M(mix_threads, 0);
 	CFG_GET_M(no_ramping, 0);
+	CFG_GET_M(native_opl, 0);
 	CFG_GET_M(surround_effect, 1);
 
 	switch (audio_settings.channels) {
@@ -1211,8 +1334,10 @@ void cfg_load_audio(cfg_file_t *cfg)
 	default: audio_settings.bits = 16;
 	}
 
-	audio_settings.channel_limit = CLAMP(audio_settings.channel_limit, 4, MAX_VOICES);
+	audio_settings.voice_limit = CLAMP(audio_settings.voice_limit, MAX_CHANNELS, MAX_VOICES);
+	audio_settings.channel_limit = CLAMP(audio_settings.channel_limit, 4, audio_settings.voice_limit);
 	audio_settings.interpolation_mode = CLAMP(audio_settings.interpolation_mode, 0, NUM_SRC_MODES - 1);
+	audio_settings.mix_threads = CLAMP(audio_settings.mix_threads, 0, 64);
 
 	audio_settings.eq_freq[0] = cfg_get_number(cfg, "EQ Low Band", "freq", 0);
 	audio_settings.eq_freq[1] = cfg_get_number(cfg, "EQ Med Low Band", "freq", 16);
@@ -1243,8 +1368,11 @@ void cfg_atexit_save_audio(cfg_file_t *cfg)
 	CFG_SET_A(master.right);
 
 	CFG_SET_M(channel_limit);
+	CFG_SET_M(voice_limit);
 	CFG_SET_M(interpolation_mode);
+	CFG_SET_M(mix_threads);
 	CFG_SET_M(no_ramping);
+	CFG_SET_M(native_opl);
 
 	// Say, what happened to the switch for this in the gui?
 	CFG_SET_M(surround_effect);
@@ -1462,9 +1590,17 @@ success:
 	audio_sample_size = audio_output_channels * (audio_output_bits / 8);
 	audio_reallocate_buffer(obtained.samples);
 
+	/* float devices get the float mix bus, so the output is only ever
+	 * converted once (or not at all, for 32-bit float) */
+	if (audio_output_fp)
+		current_song->mix_flags |= SNDMIX_FLOATMIX;
+	else
+		current_song->mix_flags &= ~SNDMIX_FLOATMIX;
+
 	csf_set_wave_config(current_song, obtained.freq,
 		audio_output_bits,
 		obtained.channels);
+	song_init_eq(current_song, 1);
 
 	if (verbose) {
 		log_nl();
@@ -1672,6 +1808,8 @@ void audio_quit(void)
 
 	_audio_quit();
 
+	csf_set_mix_threads(0);
+
 	for (i = 0; i < ARRAY_SIZE(inited_backends); i++) {
 		if (inited_backends[i]) {
 			inited_backends[i]->quit();
@@ -1694,10 +1832,13 @@ void audio_open_control_panel(void)
 
 /* --------------------------------------------------------------------------------------------------------- */
 
-void song_init_eq(int do_reset, uint32_t mix_freq)
+/* the eq settings are global, but the filters themselves live in each song,
+ * so this has to be called for every song that is going to be played */
+void song_init_eq(song_t *csf, int do_reset)
 {
 	uint32_t pg[4];
 	uint32_t pf[4];
+	uint32_t mix_freq = csf->mix_frequency;
 	int i;
 
 	for (i = 0; i < 4; i++) {
@@ -1706,25 +1847,44 @@ void song_init_eq(int do_reset, uint32_t mix_freq)
 			* (mix_freq / 128) / 1024);
 	}
 
-	set_eq_gains(pg, 4, pf, do_reset, mix_freq);
+	set_eq_gains(csf, pg, 4, pf, do_reset, mix_freq);
 }
 
-
-void song_init_modplug(void)
+/* copies the mixer settings that are kept per song into 'csf' */
+void song_init_mix_settings(song_t *csf)
 {
-	song_lock_audio();
-
-	current_song->max_voices = audio_settings.channel_limit;
-	csf_set_resampling_mode(current_song, audio_settings.interpolation_mode);
+	csf_set_voice_count(csf, audio_settings.voice_limit);
+	csf->max_voices = MIN((uint32_t)audio_settings.channel_limit, csf->voice_count);
+	csf->master_volume_left = audio_settings.master.left;
+	csf->master_volume_right = audio_settings.master.right;
+	song_init_eq(csf, 0);
+	csf_set_resampling_mode(csf, audio_settings.interpolation_mode);
 	if (audio_settings.no_ramping) {
-		current_song->mix_flags |= SNDMIX_NORAMPING;
+		csf->mix_flags |= SNDMIX_NORAMPING;
+	} else {
+		csf->mix_flags &= ~(SNDMIX_NORAMPING);
+	}
+	if (audio_settings.native_opl) {
+		csf->mix_flags |= SNDMIX_NATIVEOPL;
 	} else {
-		current_song->mix_flags &= ~(SNDMIX_NORAMPING);
+		csf->mix_flags &= ~(SNDMIX_NATIVEOPL);
 	}
 
 	// disable the S91 effect? (this doesn't make anything faster, it
 	// just sounds better with one woofer.)
-	song_set_surround(audio_settings.surround_effect);
+	if (audio_settings.surround_effect)
+		csf->mix_flags &= ~SNDMIX_NOSURROUND;
+	else
+		csf->mix_flags |= SNDMIX_NOSURROUND;
+}
+
+
+void song_init_modplug(void)
+{
+	song_lock_audio();
+
+	song_init_mix_settings(current_song);
+	csf_set_mix_threads(audio_settings.mix_threads);
 
 	// update midi queue configuration
 	midi_queue_alloc(audio_buffer_samples, audio_sample_size, current_song->mix_frequency);
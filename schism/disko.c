@@ -36,6 +36,9 @@
 #include "osdefs.h"
 #include "mem.h"
 #include "str.h"
+#include "mt.h"
+#include "atomic.h"
+#include "timer.h"
 
 #include "player/sndfile.h"
 #include "player/cmixer.h"
@@ -43,6 +46,16 @@
 #include "player/snd_fm.h"
 
 #define DW_BUFFER_SIZE 65536
+/* mix block size for exports, in frames; bigger than the live playback
+ * default since latency doesn't matter here. 4096 frames still fit in
+ * DW_BUFFER_SIZE at 32-bit stereo, which the multi-write code needs. */
+#define DW_MIX_BUFFER_SIZE 4096
+/* how many DW_BUFFER_SIZE blocks the renderer can get ahead of the writer */
+#define DW_PIPE_SLOTS 8
+/* the same for each multi-write thread; the mixer never hands the multi-write
+ * callbacks more than one mix block at a time, so that's how big these are */
+#define DW_MULTI_SLOTS 16
+#define DW_MULTI_SLOT_SIZE (DW_MIX_BUFFER_SIZE * 2 * sizeof(int32_t))
 
 static void _disko_midi_out_raw(SCHISM_UNUSED song_t *csf, SCHISM_UNUSED const unsigned char *data, SCHISM_UNUSED uint32_t len, SCHISM_UNUSED uint32_t delay);
 
@@ -51,12 +64,14 @@ static void _disko_midi_out_raw(SCHISM_UNUSED song_t *csf, SCHISM_UNUSED const u
 static unsigned int disko_output_rate = 44100;
 static unsigned int disko_output_bits = 16;
 static unsigned int disko_output_channels = 2;
+static unsigned int disko_threads = 4; /* for writing out multi-channel exports */
 
 void cfg_load_disko(cfg_file_t *cfg)
 {
 	disko_output_rate = cfg_get_number(cfg, "Diskwriter", "rate", 44100);
 	disko_output_bits = cfg_get_number(cfg, "Diskwriter", "bits", 16);
 	disko_output_channels = cfg_get_number(cfg, "Diskwriter", "channels", 2);
+	disko_threads = CLAMP(cfg_get_number(cfg, "Diskwriter", "threads", 4), 0, MAX_CHANNELS);
 }
 
 void cfg_save_disko(cfg_file_t *cfg)
@@ -64,6 +79,7 @@ void cfg_save_disko(cfg_file_t *cfg)
 	cfg_set_number(cfg, "Diskwriter", "rate", disko_output_rate);
 	cfg_set_number(cfg, "Diskwriter", "bits", disko_output_bits);
 	cfg_set_number(cfg, "Diskwriter", "channels", disko_output_channels);
+	cfg_set_number(cfg, "Diskwriter", "threads", disko_threads);
 }
 
 // ---------------------------------------------------------------------------
@@ -216,7 +232,7 @@ static int _dw_bufcheck(disko_t *ds, size_t extend)
 {
 	size_t newlen;
 
-	if (ds->error)
+	if (atm_load(&ds->error))
 		return 0; /* punt */
 
 	newlen = ds->pos + extend;
@@ -292,7 +308,7 @@ static int64_t _dw_mem_tell(disko_t *ds)
 
 void disko_write(disko_t *ds, const void *buf, size_t len)
 {
-	if (len != 0 && !ds->error)
+	if (len != 0 && !atm_load(&ds->error))
 		ds->_write(ds, buf, len);
 }
 
@@ -303,7 +319,7 @@ void disko_putc(disko_t *ds, unsigned char c)
 
 void disko_seek(disko_t *ds, int64_t pos, int whence)
 {
-	if (!ds->error)
+	if (!atm_load(&ds->error))
 		ds->_seek(ds, pos, whence);
 }
 
@@ -315,7 +331,7 @@ static void disko_seekcur(disko_t *ds, int64_t pos)
 
 int64_t disko_tell(disko_t *ds)
 {
-	if (!ds->error)
+	if (!atm_load(&ds->error))
 		return ds->_tell(ds);
 	return -1;
 }
@@ -330,7 +346,8 @@ void disko_align(disko_t *ds, uint32_t bytes)
 void disko_seterror(disko_t *ds, int err)
 {
 	// Don't set an error if one already exists, and don't allow clearing an error value
-	ds->error = errno = ds->error ? ds->error : err ? err : EINVAL;
+	atm_cmpxchg(&ds->error, 0, err ? err : EINVAL);
+	errno = atm_load(&ds->error);
 }
 
 // ---------------------------------------------------------------------------
@@ -384,7 +401,7 @@ int disko_open(disko_t *ds, const char *filename)
  *  else, backup with numberings */
 int disko_close(disko_t *ds, int backup)
 {
-	int err = ds->error;
+	int err = atm_load(&ds->error);
 
 	// try to preserve the *first* error set, because it's most likely to be interesting
 	if (fclose(ds->file) == EOF && !err) {
@@ -466,7 +483,7 @@ int disko_memopen(disko_t *ds)
 
 int disko_memclose(disko_t *ds, int keep_buffer)
 {
-	int err = ds->error;
+	int err = atm_load(&ds->error);
 
 	if (err) {
 		free(ds->data);
@@ -549,47 +566,60 @@ void disko_memend(disko_t *ds, void *mem, size_t size)
 
 // ---------------------------------------------------------------------------
 
-static void _export_setup(song_t *dwsong, int *bps)
+/* sets up a song for rendering to disk; the caller is responsible for
+ * locking, if the song is being played elsewhere */
+static int _export_prepare(song_t *dwsong, int *bps)
 {
-	song_lock_audio();
-
-	/* install our own */
-	memcpy(dwsong, current_song, sizeof(song_t)); /* shadow it */
+	if (!csf_set_mix_buffer_size(dwsong, DW_MIX_BUFFER_SIZE))
+		return 0;
 
 	/* Reset the MIDI stuff to our own...
 	 * Note this HAS to be above GM_Reset as it sends MIDI events on
 	 * our behalf, which triggers the assertion in audio_playback.c */
 	csf_init_midi(dwsong, _disko_midi_out_raw);
 
-	/* !!! FIXME: We should not be messing with this stuff here! */
-	dwsong->opl = NULL; /* Prevent the current_song OPL being closed */
 	GM_Reset(dwsong, 1);
 
-	dwsong->multi_write = NULL; /* should be null already, but to be sure... */
-
 	csf_set_current_order(dwsong, 0); /* rather indirect way of resetting playback variables */
 	csf_set_wave_config(dwsong, disko_output_rate, disko_output_bits, (dwsong->flags & SONG_NOSTEREO) ? 1 : disko_output_channels);
+	song_init_eq(dwsong, 1);
 
 	dwsong->mix_flags |= (SNDMIX_DIRECTTODISK | SNDMIX_NOBACKWARDJUMPS);
+	dwsong->mix_flags &= ~SNDMIX_FLOATMIX; /* the export formats are all integer */
 
 	dwsong->repeat_count = -1; /* FIXME do this right */
 	dwsong->buffer_count = 0;
 	dwsong->flags &= ~(SONG_PAUSED | SONG_PATTERNLOOP | SONG_ENDREACHED);
-	dwsong->stop_at_order = -1;
-	dwsong->stop_at_row = -1;
 
 	/* diskwriter should always output with best available quality, which
 	 * means using all available voices. */
-	dwsong->max_voices = MAX_VOICES;
+	dwsong->max_voices = dwsong->voice_count;
 
 	*bps = dwsong->mix_channels * ((dwsong->mix_bits_per_sample + 7) / 8);
 
+	return 1;
+}
+
+static int _export_setup(song_t *dwsong, int *bps)
+{
+	int r;
+
+	song_lock_audio();
+
+	/* install our own */
+	memcpy(dwsong, current_song, sizeof(song_t)); /* shadow it */
+	csf_unshare(dwsong); /* ...but not the mixing state */
+
+	r = _export_prepare(dwsong, bps);
+
 	song_unlock_audio();
+
+	return r;
 }
 
-static void _export_teardown(void)
+static void _export_teardown(song_t *dwsong)
 {
-	// do nothing :)
+	csf_free_unshared(dwsong);
 }
 
 // ---------------------------------------------------------------------------
@@ -658,7 +688,11 @@ int disko_writeout_sample(int smpnum, int pattern, int dobind)
 	if (disko_memopen(&ds) < 0)
 		return DW_ERROR;
 
-	_export_setup(&dwsong, &bps);
+	if (!_export_setup(&dwsong, &bps)) {
+		disko_memclose(&ds, 0);
+		return DW_ERROR;
+	}
+
 	dwsong.repeat_count = -1; // FIXME do this right
 	csf_loop_pattern(&dwsong, pattern, 0);
 
@@ -684,11 +718,227 @@ int disko_writeout_sample(int smpnum, int pattern, int dobind)
 		ret = DW_ERROR;
 	}
 
-	_export_teardown();
+	_export_teardown(&dwsong);
 
 	return ret;
 }
 
+/* ------------------------------------------------------------------------ */
+/* With multi-write, csf_read hands every channel's output to its own write
+ * callback, one after the other. Encoding and writing that many files on the
+ * mixer's thread is slow, so instead the callbacks are swapped out for ones
+ * that queue the data up for a few writer threads. Each channel always goes
+ * to the same thread, so everything for one file still happens in order (and
+ * the encoders never see more than one thread).
+ *
+ * What gets queued is the output format, already converted by csf_read. The
+ * conversion is cheap next to the encoding, the converted block is at most
+ * half the size of the 32-bit one (which would have to be copied anyway, as
+ * the mixer reuses it for the next block), and this way the callbacks are
+ * the same with or without the threads. */
+
+struct dw_multi_worker;
+
+struct dw_multi_channel {
+	struct dw_multi_worker *worker;
+
+	/* the real thing */
+	void *data;
+	void (*write)(void *data, const uint8_t *buf, size_t bytes);
+	void (*silence)(void *data, long bytes);
+};
+
+struct dw_multi_job {
+	struct dw_multi_channel *chn;
+	size_t len; /* bytes in the slot to write, or ... */
+	long silence; /* ... bytes of silence, if len is 0 */
+};
+
+struct dw_multi_worker {
+	mt_thread_t *thread;
+	mt_sem_t *ready; /* posted once per queued job (and once to quit) */
+	mt_sem_t *space; /* posted once per finished job */
+
+	/* jobs queued and finished so far; one producer, one consumer */
+	struct atm head, tail;
+
+	struct atm quit;
+
+	struct dw_multi_job jobs[DW_MULTI_SLOTS];
+	uint8_t *data; /* DW_MULTI_SLOTS * DW_MULTI_SLOT_SIZE */
+};
+
+struct dw_multi {
+	struct dw_multi_worker *workers;
+	uint32_t num_workers;
+
+	struct dw_multi_channel channels[MAX_CHANNELS];
+};
+
+static int dw_multi_thread(void *userdata)
+{
+	struct dw_multi_worker *w = userdata;
+
+	for (;;) {
+		struct dw_multi_job *job;
+		int32_t head;
+
+		mt_sem_wait(w->ready);
+
+		head = atm_load(&w->head);
+		if (head == atm_load(&w->tail)) {
+			if (atm_load(&w->quit))
+				break;
+			continue;
+		}
+
+		job = &w->jobs[head % DW_MULTI_SLOTS];
+		if (job->len)
+			job->chn->write(job->chn->data, w->data + (head % DW_MULTI_SLOTS) * DW_MULTI_SLOT_SIZE, job->len);
+		else
+			job->chn->silence(job->chn->data, job->silence);
+
+		atm_store(&w->head, head + 1);
+		mt_sem_post(w->space);
+	}
+
+	return 0;
+}
+
+/* waits for room in the worker's queue, and returns the next job */
+static struct dw_multi_job *dw_multi_job(struct dw_multi_worker *w)
+{
+	int32_t tail = atm_load(&w->tail);
+
+	while (tail - atm_load(&w->head) >= DW_MULTI_SLOTS)
+		mt_sem_wait(w->space);
+
+	return &w->jobs[tail % DW_MULTI_SLOTS];
+}
+
+static void dw_multi_push(struct dw_multi_worker *w)
+{
+	atm_inc(&w->tail);
+	mt_sem_post(w->ready);
+}
+
+static void dw_multi_write(void *userdata, const uint8_t *buf, size_t bytes)
+{
+	struct dw_multi_channel *chn = userdata;
+	struct dw_multi_worker *w = chn->worker;
+
+	while (bytes) {
+		struct dw_multi_job *job = dw_multi_job(w);
+		size_t len = MIN(bytes, DW_MULTI_SLOT_SIZE);
+
+		memcpy(w->data + (job - w->jobs) * DW_MULTI_SLOT_SIZE, buf, len);
+		job->chn = chn;
+		job->len = len;
+		dw_multi_push(w);
+
+		buf += len;
+		bytes -= len;
+	}
+}
+
+static void dw_multi_silence(void *userdata, long bytes)
+{
+	struct dw_multi_channel *chn = userdata;
+	struct dw_multi_job *job = dw_multi_job(chn->worker);
+
+	job->chn = chn;
+	job->len = 0;
+	job->silence = bytes;
+	dw_multi_push(chn->worker);
+}
+
+/* waits for everything queued to be written, and puts the song's
+ * callbacks back the way they were */
+static void dw_multi_stop(struct dw_multi *multi, song_t *dwsong)
+{
+	uint32_t i;
+
+	for (i = 0; i < multi->num_workers; i++) {
+		struct dw_multi_worker *w = &multi->workers[i];
+
+		if (w->thread) {
+			atm_store(&w->quit, 1);
+			mt_sem_post(w->ready);
+			mt_thread_wait(w->thread, NULL);
+		}
+
+		if (w->ready)
+			mt_sem_delete(w->ready);
+		if (w->space)
+			mt_sem_delete(w->space);
+		free(w->data);
+	}
+
+	if (multi->workers && dwsong->multi_write) {
+		for (i = 0; i < MAX_CHANNELS; i++) {
+			dwsong->multi_write[i].data = multi->channels[i].data;
+			dwsong->multi_write[i].write = multi->channels[i].write;
+			dwsong->multi_write[i].silence = multi->channels[i].silence;
+		}
+	}
+
+	free(multi->workers);
+	memset(multi, 0, sizeof(*multi));
+}
+
+/* call once the song's multi-write callbacks are set up. with no threads
+ * (or if they can't be started), the callbacks are just left alone */
+static void dw_multi_start(struct dw_multi *multi, song_t *dwsong, uint32_t threads)
+{
+	uint32_t i;
+
+	memset(multi, 0, sizeof(*multi));
+
+	if (!threads)
+		return;
+
+	multi->workers = calloc(threads, sizeof(*multi->workers));
+	if (!multi->workers)
+		return;
+
+	multi->num_workers = threads;
+
+	for (i = 0; i < multi->num_workers; i++) {
+		struct dw_multi_worker *w = &multi->workers[i];
+
+		w->data = malloc(DW_MULTI_SLOTS * DW_MULTI_SLOT_SIZE);
+		w->ready = mt_sem_create();
+		w->space = mt_sem_create();
+		if (!w->data || !w->ready || !w->space)
+			break;
+
+		w->thread = mt_thread_create(dw_multi_thread, "Multi-write thread", w);
+		if (!w->thread)
+			break;
+	}
+
+	if (i < multi->num_workers) {
+		/* never mind, then */
+		dw_multi_stop(multi, dwsong);
+		return;
+	}
+
+	for (i = 0; i < MAX_CHANNELS; i++) {
+		struct dw_multi_channel *chn = &multi->channels[i];
+
+		chn->worker = &multi->workers[i % multi->num_workers];
+		chn->data = dwsong->multi_write[i].data;
+		chn->write = dwsong->multi_write[i].write;
+		chn->silence = dwsong->multi_write[i].silence;
+
+		dwsong->multi_write[i].data = chn;
+		dwsong->multi_write[i].write = dw_multi_write;
+		dwsong->multi_write[i].silence = dw_multi_silence;
+	}
+}
+
+/* ------------------------------------------------------------------------ */
+
 static void disko_multiwrite_write(void *userdata, const uint8_t *data, size_t len)
 {
 	disko_write(userdata, data, len);
@@ -706,16 +956,18 @@ int disko_multiwrite_samples(int firstsmp, int pattern)
 	song_sample_t *sample;
 	uint8_t buf[DW_BUFFER_SIZE];
 	disko_t ds[MAX_CHANNELS] = {0};
+	struct dw_multi multi;
 	int bps;
 	size_t smpsize = 0;
 	int smpnum = CLAMP(firstsmp, 1, MAX_SAMPLES);
 	int n;
 
-	_export_setup(&dwsong, &bps);
+	if (!_export_setup(&dwsong, &bps))
+		return DW_ERROR;
+
 	dwsong.repeat_count = -1; // FIXME do this right
 	csf_loop_pattern(&dwsong, pattern, 0);
-	dwsong.multi_write = calloc(MAX_CHANNELS, sizeof(struct multi_write));
-	if (!dwsong.multi_write)
+	if (!csf_alloc_multi_write(&dwsong))
 		err = errno ? errno : ENOMEM;
 
 	if (!err) {
@@ -730,9 +982,8 @@ int disko_multiwrite_samples(int firstsmp, int pattern)
 	if (err) {
 		/* you might think this code is insane, and you might be correct ;)
 		but it's structured like this to keep all the early-termination handling HERE. */
-		_export_teardown();
+		_export_teardown(&dwsong);
 		err = err ? err : errno;
-		free(dwsong.multi_write);
 		for (n = 0; n < MAX_CHANNELS; n++)
 			disko_memclose(&ds[n], 0);
 		errno = err;
@@ -746,6 +997,8 @@ int disko_multiwrite_samples(int firstsmp, int pattern)
 		dwsong.multi_write[n].silence = disko_multiwrite_silence;
 	}
 
+	dw_multi_start(&multi, &dwsong, disko_threads);
+
 	do {
 		/* buf is used as temp space for converting the individual channel buffers from 32-bit.
 		the output is being handled well inside the mixer, so we don't have to do any actual writing
@@ -760,7 +1013,7 @@ int disko_multiwrite_samples(int firstsmp, int pattern)
 		}
 
 		for (n = 0; n < MAX_CHANNELS; n++) {
-			if (ds[n].error) {
+			if (atm_load(&ds[n].error)) {
 				// Kill the write, but leave the other files alone
 				dwsong.flags |= SONG_ENDREACHED;
 				break;
@@ -768,6 +1021,8 @@ int disko_multiwrite_samples(int firstsmp, int pattern)
 		}
 	} while (!(dwsong.flags & SONG_ENDREACHED));
 
+	dw_multi_stop(&multi, &dwsong);
+
 	for (n = 0; n < MAX_CHANNELS; n++) {
 		if (!dwsong.multi_write[n].used) {
 			/* this channel was completely empty - don't bother with it */
@@ -793,8 +1048,7 @@ int disko_multiwrite_samples(int firstsmp, int pattern)
 			err = errno;
 	}
 
-	_export_teardown();
-	free(dwsong.multi_write);
+	_export_teardown(&dwsong);
 
 	if (err) {
 		errno = err;
@@ -815,6 +1069,35 @@ static size_t est_len;
 static int prgh;
 static timer_ticks_t export_start_time;
 static int canceled = 0; /* this sucks, but so do I */
+/* time spent in each stage, for the stats at the end */
+static timer_ticks_t export_render_us, export_encode_us;
+
+/* Single file exports are done in two stages: disko_sync renders into a ring
+ * of buffers, and a separate thread takes them from there and hands them to
+ * the format's body function. That way the encoder (FLAC is expensive) and
+ * the disk can't hold up the mixer, and the two run on different cores.
+ *
+ * There is only ever one producer and one consumer, so the ring itself needs
+ * no locking; the semaphores are just there so neither side has to spin. */
+struct disko_pipe {
+	mt_thread_t *thread;
+	mt_sem_t *ready; /* posted once per filled slot (and once to quit) */
+	mt_sem_t *space; /* posted once per emptied slot */
+
+	/* slots filled and emptied so far; each is only written by one side */
+	struct atm head, tail;
+	struct atm quit;
+
+	uint8_t *data; /* DW_PIPE_SLOTS * DW_BUFFER_SIZE */
+	size_t len[DW_PIPE_SLOTS];
+
+	disko_t *ds;
+	fmt_export_body_func body;
+	timer_ticks_t encode_us; /* only read once the thread is gone */
+};
+
+static struct disko_pipe export_pipe;
+static struct dw_multi export_multi;
 
 static int disko_finish(void);
 
@@ -918,6 +1201,112 @@ static void disko_export_silence(void *userdata, long len)
 	export_format->f.export.silence(userdata, len);
 }
 
+static int disko_pipe_thread(void *userdata)
+{
+	struct disko_pipe *dp = userdata;
+
+	mt_thread_set_priority(MT_THREAD_PRIORITY_HIGH);
+
+	for (;;) {
+		int32_t head;
+		timer_ticks_t start;
+
+		mt_sem_wait(dp->ready);
+
+		head = atm_load(&dp->head);
+		if (head == atm_load(&dp->tail)) {
+			/* everything's been written */
+			if (atm_load(&dp->quit))
+				break;
+			continue;
+		}
+
+		start = timer_ticks_us();
+		dp->body(dp->ds, dp->data + (head % DW_PIPE_SLOTS) * DW_BUFFER_SIZE,
+			dp->len[head % DW_PIPE_SLOTS]);
+		dp->encode_us += timer_ticks_us() - start;
+
+		atm_store(&dp->head, head + 1);
+		mt_sem_post(dp->space);
+	}
+
+	return 0;
+}
+
+/* waits for everything to be written; returns the time the writer spent in
+ * the body function */
+static timer_ticks_t disko_pipe_stop(struct disko_pipe *dp)
+{
+	timer_ticks_t encode_us;
+
+	if (dp->thread) {
+		atm_store(&dp->quit, 1);
+		mt_sem_post(dp->ready);
+		mt_thread_wait(dp->thread, NULL);
+	}
+
+	if (dp->ready)
+		mt_sem_delete(dp->ready);
+	if (dp->space)
+		mt_sem_delete(dp->space);
+	free(dp->data);
+
+	encode_us = dp->encode_us;
+	memset(dp, 0, sizeof(*dp));
+
+	return encode_us;
+}
+
+/* if this fails (dp->thread is NULL), the caller has to write everything
+ * itself */
+static void disko_pipe_start(struct disko_pipe *dp, disko_t *ds, fmt_export_body_func body)
+{
+	memset(dp, 0, sizeof(*dp));
+
+	dp->ds = ds;
+	dp->body = body;
+	dp->data = malloc(DW_PIPE_SLOTS * DW_BUFFER_SIZE);
+	dp->ready = mt_sem_create();
+	dp->space = mt_sem_create();
+	if (!dp->data || !dp->ready || !dp->space) {
+		disko_pipe_stop(dp);
+		return;
+	}
+
+	dp->thread = mt_thread_create(disko_pipe_thread, "Export thread", dp);
+	if (!dp->thread)
+		disko_pipe_stop(dp);
+}
+
+/* returns the slot to render into next. if the writer is too far behind,
+ * this gives it `timeout' ms to catch up, and returns NULL if it hasn't */
+static uint8_t *disko_pipe_slot(struct disko_pipe *dp, uint32_t timeout)
+{
+	int32_t tail = atm_load(&dp->tail);
+
+	while (tail - atm_load(&dp->head) >= DW_PIPE_SLOTS) {
+		if (!timeout) {
+			mt_sem_wait(dp->space);
+			continue;
+		}
+
+		mt_sem_wait_timeout(dp->space, timeout);
+		if (tail - atm_load(&dp->head) >= DW_PIPE_SLOTS)
+			return NULL;
+	}
+
+	return dp->data + (tail % DW_PIPE_SLOTS) * DW_BUFFER_SIZE;
+}
+
+static void disko_pipe_push(struct disko_pipe *dp, size_t len)
+{
+	int32_t tail = atm_load(&dp->tail);
+
+	dp->len[tail % DW_PIPE_SLOTS] = len;
+	atm_store(&dp->tail, tail + 1);
+	mt_sem_post(dp->ready);
+}
+
 int disko_export_song(const char *filename, const struct save_format *format)
 {
 	int err = 0;
@@ -936,10 +1325,13 @@ int disko_export_song(const char *filename, const struct save_format *format)
 
 	numfiles = format->f.export.multi ? MAX_CHANNELS : 1;
 
-	_export_setup(&export_dwsong, &export_bps);
+	if (!_export_setup(&export_dwsong, &export_bps)) {
+		log_perror(filename);
+		return DW_ERROR;
+	}
+
 	if (numfiles > 1) {
-		export_dwsong.multi_write = calloc(numfiles, sizeof(struct multi_write));
-		if (!export_dwsong.multi_write)
+		if (!csf_alloc_multi_write(&export_dwsong))
 			err = errno ? errno : ENOMEM;
 	}
 
@@ -964,8 +1356,7 @@ int disko_export_song(const char *filename, const struct save_format *format)
 	}
 
 	if (err) {
-		_export_teardown();
-		free(export_dwsong.multi_write);
+		_export_teardown(&export_dwsong);
 		for (n = 0; export_ds[n]; n++) {
 			disko_seterror(export_ds[n], err); /* keep from writing a bunch of useless files */
 			disko_close(export_ds[n], 0);
@@ -981,6 +1372,8 @@ int disko_export_song(const char *filename, const struct save_format *format)
 			export_dwsong.multi_write[n].write = disko_export_write;
 			export_dwsong.multi_write[n].silence = disko_export_silence;
 		}
+
+		dw_multi_start(&export_multi, &export_dwsong, disko_threads);
 	}
 
 	log_appendf(5, " %" PRIu32 " Hz, %" PRIu32 " bit, %s",
@@ -989,6 +1382,10 @@ int disko_export_song(const char *filename, const struct save_format *format)
 	export_format = format;
 	status.flags |= DISKWRITER_ACTIVE; /* tell main to care about us */
 
+	export_render_us = export_encode_us = 0;
+	if (numfiles == 1)
+		disko_pipe_start(&export_pipe, export_ds[0], format->f.export.body);
+
 	uint32_t s = (csf_get_length(&export_dwsong) * export_dwsong.mix_frequency);
 	disko_dialog_setup(s ? s : 1);
 
@@ -1000,7 +1397,9 @@ int disko_export_song(const char *filename, const struct save_format *format)
 int disko_sync(void)
 {
 	uint8_t buf[DW_BUFFER_SIZE];
-	size_t frames;
+	uint8_t *out = buf;
+	size_t frames = 0;
+	timer_ticks_t start;
 	int n;
 
 	if (!export_format) {
@@ -1008,13 +1407,26 @@ int disko_sync(void)
 		return DW_SYNC_ERROR; /* no writer running (why are we here?) */
 	}
 
-	frames = csf_read(&export_dwsong, buf, sizeof(buf));
+	if (export_pipe.thread)
+		out = disko_pipe_slot(&export_pipe, 10);
+
+	if (out) {
+		start = timer_ticks_us();
+		frames = csf_read(&export_dwsong, out, DW_BUFFER_SIZE);
+		export_render_us += timer_ticks_us() - start;
+
+		if (export_pipe.thread) {
+			disko_pipe_push(&export_pipe, frames * export_bps);
+		} else if (!export_dwsong.multi_write) {
+			start = timer_ticks_us();
+			export_format->f.export.body(export_ds[0], out, frames * export_bps);
+			export_encode_us += timer_ticks_us() - start;
+		}
+	}
 
-	if (!export_dwsong.multi_write)
-		export_format->f.export.body(export_ds[0], buf, frames * export_bps);
 	/* always check if something died, multi-write or not */
 	for (n = 0; export_ds[n]; n++) {
-		if (export_ds[n]->error) {
+		if (atm_load(&export_ds[n]->error)) {
 			disko_finish();
 			return DW_SYNC_ERROR;
 		}
@@ -1047,6 +1459,11 @@ static int disko_finish(void)
 	if (!canceled)
 		dialog_destroy();
 
+	/* let the writer(s) finish up whatever's left */
+	export_encode_us += disko_pipe_stop(&export_pipe);
+	if (export_dwsong.multi_write)
+		dw_multi_stop(&export_multi, &export_dwsong);
+
 	samples_0 = export_ds[0]->length;
 	for (n = 0; export_ds[n]; n++) {
 		if (export_dwsong.multi_write && !export_dwsong.multi_write[n].used) {
@@ -1069,8 +1486,7 @@ static int disko_finish(void)
 	}
 	memset(export_ds, 0, sizeof(export_ds));
 
-	_export_teardown();
-	free(export_dwsong.multi_write);
+	_export_teardown(&export_dwsong);
 	export_format = NULL;
 
 	status.flags &= ~DISKWRITER_ACTIVE; /* please unsubscribe me from your mailing list */
@@ -1078,11 +1494,24 @@ static int disko_finish(void)
 	switch (ret) {
 	case DW_OK: {
 		const timer_ticks_t elapsed_ms = (timer_ticks() - export_start_time);
+		/* seconds of audio per second spent in each stage */
+		const double audio_us = samples_0 * 1000000.0 / disko_output_rate;
+		char speed[64];
+
+		if (export_encode_us) {
+			snprintf(speed, sizeof(speed), " (render %.1fx, encode %.1fx realtime)",
+				export_render_us ? (audio_us / export_render_us) : 0.0,
+				audio_us / export_encode_us);
+		} else {
+			/* the multi-write exports encode from inside csf_read */
+			snprintf(speed, sizeof(speed), " (%.1fx realtime)",
+				export_render_us ? (audio_us / export_render_us) : 0.0);
+		}
 
-		log_appendf(5, " %.2f MiB (%" PRIuSZ ":%02" PRIuSZ ") written in %" PRIu64 ".%02" PRIu64 " sec",
+		log_appendf(5, " %.2f MiB (%" PRIuSZ ":%02" PRIuSZ ") written in %" PRIu64 ".%02" PRIu64 " sec%s",
 			total_size / 1048576.0,
 			samples_0 / disko_output_rate / 60, (samples_0 / disko_output_rate) % 60,
-			(uint64_t)(elapsed_ms / 1000), (uint64_t)(elapsed_ms / 10 % 100));
+			(uint64_t)(elapsed_ms / 1000), (uint64_t)(elapsed_ms / 10 % 100), speed);
 		break;
 	}
 	case DW_ERROR:
@@ -1102,6 +1531,188 @@ static int disko_finish(void)
 
 // ---------------------------------------------------------------------------
 
+/* the multi-write callbacks only get the disko_t, so this carries the format
+ * along with it */
+struct disko_render_channel {
+	disko_t ds;
+	const struct save_format *format;
+};
+
+static void disko_render_write(void *userdata, const uint8_t *data, size_t len)
+{
+	struct disko_render_channel *chn = userdata;
+
+	chn->format->f.export.body(&chn->ds, data, len);
+}
+
+static void disko_render_silence(void *userdata, long len)
+{
+	struct disko_render_channel *chn = userdata;
+
+	chn->format->f.export.silence(&chn->ds, len);
+}
+
+/* the multi-write half of disko_render_song; 'filename' has a %c in it,
+ * which gets replaced by the channel number */
+static int disko_render_multi(song_t *csf, const char *filename, const struct save_format *format,
+	uint32_t threads, uint64_t *pframes)
+{
+	uint8_t buf[DW_BUFFER_SIZE];
+	struct disko_render_channel *chn;
+	struct dw_multi multi;
+	uint64_t total = 0;
+	int bps, n, opened, err = 0, ret = DW_OK;
+
+	if (!_export_prepare(csf, &bps) || !csf_alloc_multi_write(csf)) {
+		errno = ENOMEM;
+		return DW_ERROR;
+	}
+
+	chn = calloc(MAX_CHANNELS, sizeof(*chn));
+	if (!chn) {
+		csf_free_multi_write(csf);
+		errno = ENOMEM;
+		return DW_ERROR;
+	}
+
+	for (opened = 0; opened < MAX_CHANNELS; opened++) {
+		char *tmp = get_filename(filename, opened + 1);
+
+		if (!tmp || disko_open(&chn[opened].ds, tmp) < 0) {
+			err = errno ? errno : EINVAL;
+			free(tmp);
+			break;
+		}
+		free(tmp);
+
+		chn[opened].format = format;
+		if (format->f.export.head(&chn[opened].ds, csf->mix_bits_per_sample, csf->mix_channels,
+				csf->mix_frequency, csf->title) != DW_OK) {
+			err = errno ? errno : EINVAL;
+			opened++;
+			break;
+		}
+
+		csf->multi_write[opened].data = &chn[opened];
+		csf->multi_write[opened].write = disko_render_write;
+		csf->multi_write[opened].silence = disko_render_silence;
+	}
+
+	if (!err) {
+		dw_multi_start(&multi, csf, threads);
+
+		while (!(csf->flags & SONG_ENDREACHED)) {
+			uint32_t frames = csf_read(csf, buf, sizeof(buf));
+			if (!frames)
+				break;
+
+			total += frames;
+
+			for (n = 0; n < MAX_CHANNELS; n++)
+				if (atm_load(&chn[n].ds.error))
+					break;
+			if (n < MAX_CHANNELS)
+				break;
+		}
+
+		dw_multi_stop(&multi, csf);
+	}
+
+	for (n = 0; n < opened; n++) {
+		if (err || !csf->multi_write[n].used) {
+			/* nothing was ever played on this channel, or something
+			 * else went wrong; either way, don't leave a file */
+			disko_seterror(&chn[n].ds, err ? err : EINVAL);
+			disko_close(&chn[n].ds, 0);
+			continue;
+		}
+
+		if (format->f.export.tail(&chn[n].ds) != DW_OK)
+			disko_seterror(&chn[n].ds, errno ? errno : EIO);
+		if (disko_close(&chn[n].ds, 0) != DW_OK && ret == DW_OK) {
+			err = errno;
+			ret = DW_ERROR;
+		}
+	}
+
+	free(chn);
+	csf_free_multi_write(csf);
+
+	if (pframes)
+		*pframes = total;
+
+	if (err) {
+		errno = err;
+		return DW_ERROR;
+	}
+
+	return ret;
+}
+
+/* Renders a whole song to a file in one go. Unlike disko_export_song, this
+ * works on the song it's given (rather than a copy of current_song) and
+ * touches no global state, so any number of these can run at the same time,
+ * as long as each one has its own song. With 'threads' set, the encoding is
+ * done on other threads, the same way disko_export_song does it: on one for
+ * a single file, or on that many for multi-write. */
+int disko_render_song(song_t *csf, const char *filename, const struct save_format *format,
+	uint32_t threads, uint64_t *pframes)
+{
+	uint8_t buf[DW_BUFFER_SIZE];
+	struct disko_pipe dp = {0};
+	uint64_t total = 0;
+	disko_t ds = {0};
+	int bps, ret;
+
+	if (format->f.export.multi)
+		return disko_render_multi(csf, filename, format, threads, pframes);
+
+	if (!_export_prepare(csf, &bps)) {
+		errno = ENOMEM;
+		return DW_ERROR;
+	}
+
+	if (disko_open(&ds, filename) < 0)
+		return DW_ERROR;
+
+	if (format->f.export.head(&ds, csf->mix_bits_per_sample, csf->mix_channels,
+			csf->mix_frequency, csf->title) != DW_OK) {
+		disko_seterror(&ds, errno ? errno : EINVAL);
+		disko_close(&ds, 0);
+		return DW_ERROR;
+	}
+
+	if (threads)
+		disko_pipe_start(&dp, &ds, format->f.export.body);
+
+	while (!atm_load(&ds.error) && !(csf->flags & SONG_ENDREACHED)) {
+		uint8_t *out = dp.thread ? disko_pipe_slot(&dp, 0) : buf;
+		uint32_t frames = csf_read(csf, out, DW_BUFFER_SIZE);
+		if (!frames)
+			break;
+
+		if (dp.thread)
+			disko_pipe_push(&dp, frames * bps);
+		else
+			format->f.export.body(&ds, out, frames * bps);
+		total += frames;
+	}
+
+	disko_pipe_stop(&dp);
+
+	if (!atm_load(&ds.error) && format->f.export.tail(&ds) != DW_OK)
+		disko_seterror(&ds, errno ? errno : EIO);
+
+	ret = disko_close(&ds, 0);
+
+	if (pframes)
+		*pframes = total;
+
+	return ret;
+}
+
+// ---------------------------------------------------------------------------
+
 struct pat2smp {
 	int pattern, sample, bind;
 };
@@ -2270,6 +2270,9 @@ enum {
 static int file_info_get(dmoz_file_t *file)
 {
 	slurp_t t;
+	fmt_detect_t det;
+	fmt_read_info_func candidates[ARRAY_SIZE(read_info_funcs)];
+
 	if (file->filesize == 0)
 		return FINF_EMPTY;
 
@@ -2280,7 +2283,10 @@ static int file_info_get(dmoz_file_t *file)
 	file->title = NULL;
 	file->smp_defvol = 64;
 	file->smp_gblvol = 64;
-	for (const fmt_read_info_func *func = read_info_funcs; *func; func++) {
+	fmt_detect_init(&det, &t);
+	fmt_detect_read_info_funcs(&det, read_info_funcs, candidates);
+
+	for (const fmt_read_info_func *func = candidates; *func; func++) {
 		slurp_rewind(&t);
 		if ((*func) (file, &t)) {
 			if (file->artist)
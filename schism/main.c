@@ -56,6 +56,7 @@
 #include "cpu.h"
 #include "atomic.h"
 #include "ieee-float.h"
+#include "player/snd_fm.h"
 
 #include "osdefs.h"
 
@@ -128,6 +129,11 @@ static char *initial_dir = NULL;
 /* diskwrite? */
 static char *diskwrite_to = NULL;
 
+/* headless batch export: how many songs to render at once, and which ones */
+static int render_jobs = 0;
+static char **render_songs = NULL;
+static int num_render_songs = 0;
+
 /* startup flags */
 enum {
 	SF_PLAY, /* -p: start playing after loading initial_song */
@@ -171,6 +177,7 @@ enum {
 	O_DEBUG,
 	O_VERSION,
 	O_HEADLESS,
+	O_RENDER_JOBS,
 };
 
 #define USAGE "Usage: %s [OPTIONS] [DIRECTORY] [FILE]\n"
@@ -201,6 +208,7 @@ static void parse_options(int argc, char **argv)
 		{"no-hooks", 0, NULL, O_NO_HOOKS},
 #endif
 		{"headless", 0, NULL, O_HEADLESS},
+		{"render-jobs", 1, NULL, O_RENDER_JOBS},
 		{"version", 0, NULL, O_VERSION},
 		{"help", 0, NULL, O_HELP},
 		{NULL, 0, NULL, 0},
@@ -279,6 +287,13 @@ static void parse_options(int argc, char **argv)
 		case O_HEADLESS:
 			BITARRAY_SET(startup_flags, SF_HEADLESS);
 			break;
+		case O_RENDER_JOBS:
+			render_jobs = atoi(optarg);
+			if (render_jobs < 1) {
+				fprintf(stderr, "Error: --render-jobs needs a number greater than zero\n");
+				exit(2);
+			}
+			break;
 		case O_VERSION:
 			puts(schism_banner(0));
 			puts(ver_short_copyright);
@@ -298,6 +313,7 @@ static void parse_options(int argc, char **argv)
 				"      --hooks (--no-hooks)\n"
 #endif
 				"      --headless\n"
+				"      --render-jobs=N\n"
 				"      --version\n"
 				"  -h, --help\n"
 			);
@@ -328,6 +344,9 @@ static void parse_options(int argc, char **argv)
 			if (dmoz_path_is_directory(arg)) {
 				free(initial_dir);
 				initial_dir = norm;
+			} else if (render_jobs) {
+				render_songs = mem_realloc(render_songs, (num_render_songs + 1) * sizeof(*render_songs));
+				render_songs[num_render_songs++] = norm;
 			} else {
 				free(initial_song);
 				initial_song = norm;
@@ -1194,6 +1213,7 @@ void schism_exit(int x)
 	audio_quit();
 	clippy_quit();
 	events_quit();
+	Fmdrv_QuitLock();
 	localtime_r_quit();
 	timer_quit();
 	atm_quit();
@@ -1266,6 +1286,7 @@ int schism_main(int argc, char **argv)
 	SCHISM_RUNTIME_ASSERT(!atm_init(), "Failed to initialize atomics!");
 	SCHISM_RUNTIME_ASSERT(timer_init(), "Failed to initialize a timers backend!");
 	SCHISM_RUNTIME_ASSERT(localtime_r_init(), "Failed to initialize localtime_r replacement!");
+	SCHISM_RUNTIME_ASSERT(!Fmdrv_InitLock(), "Failed to initialize the OPL table mutex!");
 
 	song_initialise();
 	cfg_load();
@@ -1289,12 +1310,17 @@ int schism_main(int argc, char **argv)
 	shutdown_process |= EXIT_SAVECFG;
 	shutdown_process |= EXIT_SDLQUIT;
 
+	if (render_jobs && !BITARRAY_ISSET(startup_flags, SF_HEADLESS)) {
+		fprintf(stderr, "Error: --render-jobs requires --headless\n");
+		return 1;
+	}
+
 	if (BITARRAY_ISSET(startup_flags, SF_HEADLESS)) {
 		if (!diskwrite_to) {
 			fprintf(stderr, "Error: --headless requires --diskwrite\n");
 			return 1;
 		}
-		if (!initial_song) {
+		if (!initial_song && !num_render_songs) {
 			fprintf(stderr, "Error: --headless requires an input song file\n");
 			return 1;
 		}
@@ -1302,6 +1328,12 @@ int schism_main(int argc, char **argv)
 		// Initialize modplug only
 		song_init_modplug();
 
+		if (render_jobs) {
+			const char *driver = strcasestr(diskwrite_to, ".aif") ? "AIFF" : "WAV";
+
+			schism_exit(song_export_batch(render_songs, num_render_songs, diskwrite_to, driver, render_jobs) ? 1 : 0);
+		}
+
 		// Load and export song
 		if (song_load_unchecked(initial_song)) {
 			const char *multi = strcasestr(diskwrite_to, "%c");
@@ -52,6 +52,36 @@ static mt_thread_t *midi_worker_thread = NULL;
 static volatile int midi_worker_thread_cancel = 0;
 static volatile int midi_worker_thread_tried = 0;
 
+/* Output from the player goes through a single-producer, single-consumer
+ * ring: the audio thread writes to the head, and the output thread (or the
+ * main thread, if there are no threads) reads from the tail. midi_send_flush
+ * reads from it too, so the reading side is serialized by midi_out_mutex.
+ * Messages from the player are never longer than a parsed MIDI macro. */
+#define MIDI_OUT_RING_SIZE 1024 /* must be a power of two */
+
+struct midi_out_event {
+	// when to send it, in microseconds (0 == right now)
+	timer_ticks_t when;
+	uint32_t len;
+	unsigned char msg[MAX_MIDI_MACRO * 2];
+};
+
+static struct midi_out_event midi_out_ring[MIDI_OUT_RING_SIZE];
+static struct atm midi_out_head = {0};
+static struct atm midi_out_tail = {0};
+static mt_mutex_t *midi_out_mutex = NULL;
+
+static struct atm midi_out_dropped = {0};
+static struct atm midi_out_late = {0};
+
+static mt_thread_t *midi_out_thread = NULL;
+static struct atm midi_out_thread_cancelled = {0};
+
+static void midi_out_dispatch(void);
+#ifdef USE_THREADS
+static int midi_out_thread_func(void *z);
+#endif
+
 static struct midi_provider *port_providers = NULL;
 
 /* configurable midi stuff */
@@ -294,17 +324,29 @@ int midi_engine_start(void)
 	midi_mutex        = mt_mutex_create();
 	midi_record_mutex = mt_mutex_create();
 	midi_port_mutex   = mt_mutex_create();
+	midi_out_mutex    = mt_mutex_create();
 
-	if (!(midi_mutex && midi_record_mutex && midi_port_mutex)) {
+	if (!(midi_mutex && midi_record_mutex && midi_port_mutex && midi_out_mutex)) {
 		if (midi_mutex)        mt_mutex_delete(midi_mutex);
 		if (midi_record_mutex) mt_mutex_delete(midi_record_mutex);
 		if (midi_port_mutex)   mt_mutex_delete(midi_port_mutex);
-		midi_mutex = midi_record_mutex = midi_port_mutex = NULL;
+		if (midi_out_mutex)    mt_mutex_delete(midi_out_mutex);
+		midi_mutex = midi_record_mutex = midi_port_mutex = midi_out_mutex = NULL;
 		return 0;
 	}
 
+	/* the ring itself was emptied by midi_engine_stop */
+	atm_store(&midi_out_dropped, 0);
+	atm_store(&midi_out_late, 0);
+
 	_midi_engine_connect();
 	atm_store(&_connected, 1);
+
+#ifdef USE_THREADS
+	atm_store(&midi_out_thread_cancelled, 0);
+	midi_out_thread = mt_thread_create(midi_out_thread_func, "MIDI output thread", NULL);
+#endif
+
 	return 1;
 }
 
@@ -323,8 +365,25 @@ void midi_engine_stop(void)
 	if (!atm_load(&_connected)) return;
 	if (!midi_mutex) return;
 
-	mt_mutex_lock(midi_mutex);
+	if (midi_out_thread) {
+		atm_store(&midi_out_thread_cancelled, 1);
+		mt_thread_wait(midi_out_thread, NULL);
+		midi_out_thread = NULL;
+	}
+
+	/* the player only ever sends with the audio lock held, so once
+	 * we've disconnected under it, nothing else goes on the ring */
+	song_lock_audio();
 	atm_store(&_connected, 0);
+	song_unlock_audio();
+
+	/* get out whatever the player left behind (note offs and the like)
+	 * while the ports are still open, and then start the ring over */
+	midi_out_dispatch();
+	atm_store(&midi_out_head, 0);
+	atm_store(&midi_out_tail, 0);
+
+	mt_mutex_lock(midi_mutex);
 
 	if (midi_worker_thread) {
 		midi_worker_thread_cancel = 1;
@@ -371,6 +430,8 @@ void midi_engine_stop(void)
 	mt_mutex_delete(midi_mutex);
 	mt_mutex_delete(midi_record_mutex);
 	mt_mutex_delete(midi_port_mutex);
+	mt_mutex_delete(midi_out_mutex);
+	midi_out_mutex = NULL;
 }
 
 /* ------------------------------------------------------------- */
@@ -465,6 +526,9 @@ static void midi_engine_worker_impl(void)
 
 void midi_engine_worker(void)
 {
+	if (!midi_out_thread && atm_load(&_connected))
+		midi_out_dispatch();
+
 	if (midi_worker_thread)
 		return;
 
@@ -905,6 +969,11 @@ void midi_send_flush(void)
 
 	if (!midi_record_mutex || !midi_port_mutex) return;
 
+	/* whatever the player just sent is probably still on the ring;
+	 * hand it to the ports first, or there'd be nothing to drain */
+	if (atm_load(&_connected))
+		midi_out_dispatch();
+
 	mt_mutex_lock(midi_record_mutex);
 	mt_mutex_lock(midi_port_mutex);
 	while (midi_port_foreach(NULL, &ptr))
@@ -914,7 +983,11 @@ void midi_send_flush(void)
 	mt_mutex_unlock(midi_record_mutex);
 }
 
+/* Events sent later than this (in microseconds) are counted as late. */
+#define MIDI_OUT_LATE_THRESHOLD 1000
+
 struct _midi_send_timer_curry {
+	timer_ticks_t when;
 	uint32_t len;
 	unsigned char msg[SCHISM_FAM_SIZE];
 };
@@ -927,6 +1000,9 @@ static void _midi_send_timer_callback(void *param)
 	// make sure the midi system is actually still running to prevent
 	// a crash on exit
 	if (midi_record_mutex && midi_port_mutex && atm_load(&_connected)) {
+		if (timer_ticks_us() > curry->when + MIDI_OUT_LATE_THRESHOLD)
+			atm_inc(&midi_out_late);
+
 		mt_mutex_lock(midi_record_mutex);
 		mt_mutex_lock(midi_port_mutex);
 		_midi_send_unlocked(curry->msg, curry->len, 0, MIDI_FROM_NOW);
@@ -937,43 +1013,125 @@ static void _midi_send_timer_callback(void *param)
 	free(curry);
 }
 
-void midi_send_buffer(const unsigned char *data, uint32_t len, uint32_t pos)
+/* This is the "consumer" end of the output ring. Everything that
+ * locks, allocates, or talks to the drivers happens here, and not in
+ * the audio thread. */
+static void midi_out_dispatch(void)
 {
-	if (!midi_record_mutex) return;
+	uint32_t tail;
 
-	mt_mutex_lock(midi_record_mutex);
+	if (!midi_out_mutex) return;
 
-	/* just for fun... */
-	if (status.current_page == PAGE_MIDI) {
-		status.last_midi_real_len = len;
-		status.last_midi_len = MIN(sizeof(status.last_midi_event), len);
-		memcpy(status.last_midi_event, data, status.last_midi_len);
-		status.last_midi_port = NULL;
-		status.last_midi_tick = timer_ticks();
-		status.flags |= NEED_UPDATE | MIDI_EVENT_CHANGED;
-	}
+	mt_mutex_lock(midi_out_mutex);
+
+	tail = atm_load(&midi_out_tail);
+
+	while (tail != (uint32_t)atm_load(&midi_out_head)) {
+		struct midi_out_event *ev = &midi_out_ring[tail & (MIDI_OUT_RING_SIZE - 1)];
+		timer_ticks_t now = timer_ticks_us();
+
+		mt_mutex_lock(midi_record_mutex);
+
+		/* just for fun... */
+		if (status.current_page == PAGE_MIDI) {
+			status.last_midi_real_len = ev->len;
+			status.last_midi_len = MIN(sizeof(status.last_midi_event), ev->len);
+			memcpy(status.last_midi_event, ev->msg, status.last_midi_len);
+			status.last_midi_port = NULL;
+			status.last_midi_tick = timer_ticks();
+			status.flags |= NEED_UPDATE | MIDI_EVENT_CHANGED;
+		}
 
-	if (midims > 0) { // should always be true but I'm paranoid
-		pos /= midims;
+		if (!ev->when) {
+			// put the bread in the basket
+			midi_send_now(ev->msg, ev->len);
+		} else if (timer_ticks_passed(now, ev->when)) {
+			// we're already behind; just get it out there
+			if (now > ev->when + MIDI_OUT_LATE_THRESHOLD)
+				atm_inc(&midi_out_late);
+
+			midi_send_now(ev->msg, ev->len);
+		} else {
+			// round up, so nothing ever goes out early
+			uint32_t delay = (ev->when - now + 999) / 1000;
 
-		if (pos > 0) {
-			if (_midi_send_unlocked(data, len, pos, MIDI_FROM_LATER)) {
+			mt_mutex_lock(midi_port_mutex);
+
+			if (_midi_send_unlocked(ev->msg, ev->len, delay, MIDI_FROM_LATER)) {
 				// ok, we need a timer.
-				struct _midi_send_timer_curry *curry = mem_alloc(sizeof(*curry) + len);
+				struct _midi_send_timer_curry *curry = mem_alloc(sizeof(*curry) + ev->len);
 
-				memcpy(curry->msg, data, len);
-				curry->len = len;
+				memcpy(curry->msg, ev->msg, ev->len);
+				curry->len = ev->len;
+				curry->when = ev->when;
 
 				// one s'more
-				timer_oneshot(pos, _midi_send_timer_callback, curry);
+				timer_oneshot(delay, _midi_send_timer_callback, curry);
 			}
-		} else {
-			// put the bread in the basket
-			midi_send_now(data, len);
+
+			mt_mutex_unlock(midi_port_mutex);
 		}
+
+		mt_mutex_unlock(midi_record_mutex);
+
+		atm_store(&midi_out_tail, ++tail);
 	}
 
-	mt_mutex_unlock(midi_record_mutex);
+	mt_mutex_unlock(midi_out_mutex);
+}
+
+#ifdef USE_THREADS
+static int midi_out_thread_func(SCHISM_UNUSED void *z)
+{
+	mt_thread_set_priority(MT_THREAD_PRIORITY_HIGH);
+
+	while (!atm_load(&midi_out_thread_cancelled)) {
+		midi_out_dispatch();
+		/* the audio thread never wakes us up, so poll often */
+		timer_usleep(500);
+	}
+
+	return 0;
+}
+#endif
+
+/* This gets called from the audio thread, and so it must not lock
+ * or allocate anything; the event is timestamped and put on the
+ * ring for midi_out_dispatch to deal with. There is only ever one
+ * producer, since the player is only ever run with the audio lock. */
+void midi_send_buffer(const unsigned char *data, uint32_t len, uint32_t pos)
+{
+	struct midi_out_event *ev;
+	uint32_t head;
+
+	if (!atm_load(&_connected)) return;
+
+	if (!midims) // should never happen but I'm paranoid
+		return;
+
+	head = atm_load(&midi_out_head);
+
+	if (len > sizeof(ev->msg)
+		|| head - (uint32_t)atm_load(&midi_out_tail) >= MIDI_OUT_RING_SIZE) {
+		atm_inc(&midi_out_dropped);
+		return;
+	}
+
+	ev = &midi_out_ring[head & (MIDI_OUT_RING_SIZE - 1)];
+
+	memcpy(ev->msg, data, len);
+	ev->len = len;
+	// keep the full precision of the position here, rather than
+	// rounding it to a millisecond
+	ev->when = (pos >= midims) ? (timer_ticks_us() + (pos * UINT64_C(1000) / midims)) : 0;
+
+	atm_store(&midi_out_head, head + 1);
+}
+
+void midi_get_output_stats(uint32_t *dropped, uint32_t *late)
+{
+	if (dropped) *dropped = atm_load(&midi_out_dropped);
+	if (late) *late = atm_load(&midi_out_late);
 }
 
 // Get the length of a MIDI event in bytes
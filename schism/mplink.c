@@ -40,10 +40,7 @@ unsigned int song_get_length_to(int order, int row)
 	unsigned int t;
 
 	song_lock_audio();
-	current_song->stop_at_order = order;
-	current_song->stop_at_row = row;
-	t = csf_get_length(current_song);
-	current_song->stop_at_order = current_song->stop_at_row = -1;
+	t = csf_get_length_to(current_song, order, row);
 	song_unlock_audio();
 	return t;
 }
@@ -53,16 +50,13 @@ void song_get_at_time(unsigned int seconds, int *order, int *row)
 		if (order) *order = 0;
 		if (row) *row = 0;
 	} else {
+		uint32_t o, r;
+
 		song_lock_audio();
-		current_song->stop_at_order = MAX_ORDERS;
-		current_song->stop_at_row = 255; /* unpossible */
-		current_song->stop_at_time = seconds;
-		csf_get_length(current_song);
-		if (order) *order = current_song->stop_at_order;
-		if (row) *row = current_song->stop_at_row;
-		current_song->stop_at_order = current_song->stop_at_row = -1;
-		current_song->stop_at_time = 0;
+		csf_get_position_at(current_song, seconds, &o, &r);
 		song_unlock_audio();
+		if (order) *order = o;
+		if (row) *row = r;
 	}
 }
 
@@ -105,7 +99,7 @@ song_channel_t *song_get_channel(int n)
 
 song_voice_t *song_get_mix_channel(int n)
 {
-	if (n >= MAX_VOICES)
+	if ((uint32_t)n >= current_song->voice_count)
 		return NULL;
 	return (song_voice_t *) current_song->voices + n;
 }
@@ -138,7 +132,7 @@ void song_save_channel_states(void)
 static inline void _fix_mutes_like(int chan)
 {
 	int i;
-	for (i = 0; i < MAX_VOICES; i++) {
+	for (i = 0; i < (int)current_song->voice_count; i++) {
 		if (i == chan) continue;
 		if (((int)current_song->voices[i].master_channel) != (chan+1)) continue;
 		current_song->voices[i].flags = (current_song->voices[i].flags & (~(CHN_MUTE)))
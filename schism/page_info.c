@@ -162,7 +162,7 @@ static void info_draw_technical(int base, int height, int active, int first_chan
 
 			/* count how many voices claim this channel */
 			int nv, tot;
-			for (nv = tot = 0; nv < MAX_VOICES; nv++) {
+			for (nv = tot = 0; nv < (int)current_song->voice_count; nv++) {
 				song_voice_t *v = current_song->voices + nv;
 				if (v->master_channel == (unsigned int) c && ((v->current_sample_data && v->length) || (v->flags & CHN_ADLIB)))
 					tot++;
@@ -666,6 +666,9 @@ static void info_draw_channels(int base, SCHISM_UNUSED int height, int active, S
 	snprintf(buf, 32, "Active Channels: %d (%d)", song_get_playing_channels(), song_get_max_channels());
 	draw_text(buf, 2, base, fg, 2);
 
+	snprintf(buf, 32, "Silent: %d", song_get_silent_voices());
+	draw_text(buf, 32, base, fg, 2);
+
 	snprintf(buf, 32, "Global Volume: %d", song_get_current_global_volume());
 	draw_text(buf, 4, base + 1, fg, 2);
 }
@@ -685,7 +688,7 @@ static void info_draw_note_dots(int base, int height, int active, int first_chan
 	draw_fill_chars(5, base + 1, 77, base + height - 2, DEFAULT_FG, 0);
 	draw_box(4, base, 78, base + height - 1, BOX_THICK | BOX_INNER | BOX_INSET);
 
-	for (n = 0; n < MAX_VOICES; n++) {
+	for (n = 0; n < current_song->voice_count; n++) {
 		voice = current_song->voices + n;
 
 		/* 31 = f#2, 103 = f#8. (i hope ;) */
@@ -259,11 +259,17 @@ static void midi_page_draw_portlist(void)
 	 *      port number itself. sigh. */
 	struct midi_port *p;
 	int i;
-	uint32_t ct;
+	uint32_t ct, dropped, late;
+	char buf[40];
 	time_t now = time(NULL);
 
 	draw_fill_chars(3, 15, 76, 28, DEFAULT_FG, 0);
 	draw_text("MIDI ports:", 2, 13, 0, 2);
+
+	midi_get_output_stats(&dropped, &late);
+	snprintf(buf, sizeof(buf), "Dropped %u, Late %u", dropped, late);
+	draw_fill_chars(40, 13, 77, 13, DEFAULT_FG, 2);
+	draw_text(buf, 78 - strlen(buf), 13, 0, 2);
 	draw_box(2,14,77,28, BOX_THIN|BOX_INNER|BOX_INSET);
 
 	for (i = 0; i < 13; i++)
@@ -47,12 +47,13 @@ static struct widget widgets_preferences[49];
 
 static const char *interpolation_modes[] = {
 	"Non-Interpolated", "Linear",
-	"Cubic Spline", "8-Tap FIR Filter", NULL
+	"Cubic Spline", "8-Tap FIR Filter",
+	"Windowed Sinc", NULL
 };
 #define interp_modes ((int)ARRAY_SIZE(interpolation_modes) - 1)
 
 static const int interp_group[] = {
-	2,3,4,5,-1,
+	2,3,4,5,6,-1,
 };
 
 static int ramp_group[] = { /* not const because it is modified */
@@ -96,16 +97,16 @@ static void preferences_draw_const(void)
 
 	for (i = 0; interpolation_modes[i]; i++);
 
-	draw_text("Output Equalizer", 2, 21+i*3, 0, 2);
-	draw_text(     "Low Frequency Band", 7, 23+i*3, 0, 2);
-	draw_text( "Med Low Frequency Band", 3, 24+i*3, 0, 2);
-	draw_text("Med High Frequency Band", 2, 25+i*3, 0, 2);
-	draw_text(    "High Frequency Band", 6, 26+i*3, 0, 2);
+	draw_text("Output Equalizer", 2, 20+i*3, 0, 2);
+	draw_text(     "Low Frequency Band", 7, 22+i*3, 0, 2);
+	draw_text( "Med Low Frequency Band", 3, 23+i*3, 0, 2);
+	draw_text("Med High Frequency Band", 2, 24+i*3, 0, 2);
+	draw_text(    "High Frequency Band", 6, 25+i*3, 0, 2);
 
-	draw_text("Ramp volume at start of sample",2,29+i*3,0,2);
+	draw_text("Ramp volume at start of sample",2,28+i*3,0,2);
 
-	draw_box(25, 22+i*3, 47, 27+i*3, BOX_THIN | BOX_INNER | BOX_INSET);
-	draw_box(52, 22+i*3, 74, 27+i*3, BOX_THIN | BOX_INNER | BOX_INSET);
+	draw_box(25, 21+i*3, 47, 26+i*3, BOX_THIN | BOX_INNER | BOX_INSET);
+	draw_box(52, 21+i*3, 74, 26+i*3, BOX_THIN | BOX_INNER | BOX_INSET);
 
 	snprintf(buf, 80, "Playback Frequency: %dHz", audio_settings.sample_rate);
 	draw_text(buf, 2, 48, 0, 2);
@@ -154,6 +155,9 @@ static void change_volume(void)
 {
 	audio_settings.master.left = widgets_preferences[0].d.thumbbar.value;
 	audio_settings.master.right = widgets_preferences[1].d.thumbbar.value;
+
+	current_song->master_volume_left = audio_settings.master.left;
+	current_song->master_volume_right = audio_settings.master.right;
 }
 
 #define SAVED_AT_EXIT "Audio configuration will be saved at exit"
@@ -166,7 +170,7 @@ static void change_eq(void)
 		audio_settings.eq_freq[j] = widgets_preferences[i+2+(j*2)].d.thumbbar.value;
 		audio_settings.eq_gain[j] = widgets_preferences[i+3+(j*2)].d.thumbbar.value;
 	}
-	song_init_eq(1, current_song->mix_frequency);
+	song_init_eq(current_song, 1);
 }
 
 
@@ -319,7 +323,7 @@ void preferences_load_page(struct page *page)
 		if (i < 1)
 			widgets_preferences[i+2].next.left = widgets_preferences[i+2].next.right =
 				interp_modes + 13;
-		else if (i < 4)
+		else
 			widgets_preferences[i+2].next.left = widgets_preferences[i+2].next.right =
 				interp_modes + 14;
 	}
@@ -328,7 +332,7 @@ void preferences_load_page(struct page *page)
 		int n = i+(j*2);
 		if (j == 0) n = i+1;
 		widget_create_thumbbar(widgets_preferences+i+2+(j*2),
-						26, 23+(i*3)+j,
+						26, 22+(i*3)+j,
 						21,
 						n, i+(j*2)+4, i+(j*2)+3,
 						change_eq,
@@ -336,7 +340,7 @@ void preferences_load_page(struct page *page)
 		n = i+(j*2)+5;
 		if (j == 3) n--;
 		widget_create_thumbbar(widgets_preferences+i+3+(j*2),
-						53, 23+(i*3)+j,
+						53, 22+(i*3)+j,
 						21,
 						i+(j*2)+1, n, i+(j*2)+4,
 						change_eq,
@@ -351,21 +355,21 @@ void preferences_load_page(struct page *page)
 	ramp_group[0] = i+10;
 	ramp_group[1] = i+11;
 	widget_create_togglebutton(widgets_preferences+i+10,
-			33,29+i*3,9,
+			33,28+i*3,9,
 			i+9,i+12,i+10,i+11,i+11,
 			change_mixer,
 			"Enabled",2,
 			ramp_group);
 
 	widget_create_togglebutton(widgets_preferences+i+11,
-			46,29+i*3,9,
+			46,28+i*3,9,
 			i+9,i+12,i+10,i+13,i+13,
 			change_mixer,
 			"Disabled",1,
 			ramp_group);
 
 	widget_create_button(widgets_preferences+i+12,
-			2, 44, 27,
+			2, 46, 27,
 			i+10, i+12, i+12, i+13, i+13,
 			save_config_now,
 			"Save Output Configuration", 2);
@@ -389,7 +393,7 @@ void preferences_load_page(struct page *page)
 	widgets_preferences[i+14].height = AUDIO_DRIVER_BOX_HEIGHT;
 
 	widget_create_button(widgets_preferences+i+15,
-		56, 44, 20,
+		56, 46, 20,
 		i+10, i+12, i+12, i+13, i+13,
 		open_control_panel,
 		"Open Control Panel", 2);
@@ -354,8 +354,8 @@ static void _vis_process(void)
 	status.flags |= NEED_UPDATE;
 }
 
-#define VIS_WORK_EX(SUFFIX, BITS, INLOOP) \
-	void vis_work_##BITS##SUFFIX(const int##BITS##_t *in, size_t samples) \
+#define VIS_WORK_EX(NAME, TYPE, INLOOP) \
+	void vis_work_##NAME(const TYPE *in, size_t samples) \
 	{ \
 		size_t i, j, k; \
 	\
@@ -376,12 +376,12 @@ static void _vis_process(void)
 	}
 
 #define VIS_WORK(BITS) \
-	VIS_WORK_EX(s, BITS, { \
+	VIS_WORK_EX(BITS##s, int##BITS##_t, { \
 		incomingl[i] = rshift_signed(lshift_signed((int32_t)in[j], 32 - BITS), 16); j++; \
 		incomingr[i] = rshift_signed(lshift_signed((int32_t)in[j], 32 - BITS), 16); j++; \
 	}) \
 	\
-	VIS_WORK_EX(m, BITS, { \
+	VIS_WORK_EX(BITS##m, int##BITS##_t, { \
 		incomingl[i] = incomingr[i] = rshift_signed(lshift_signed((int32_t)in[j], 32 - BITS), 16); j++; \
 	})
 
@@ -389,6 +389,20 @@ VIS_WORK(32)
 VIS_WORK(16)
 VIS_WORK(8)
 
+/* float mix bus, already clipped to [-1.0, 1.0] */
+#define VIS_FLOAT_TO_16(x) ((int16_t)CLAMP((int32_t)((x) * 32768.0f), INT16_MIN, INT16_MAX))
+
+VIS_WORK_EX(f32s, float, {
+	incomingl[i] = VIS_FLOAT_TO_16(in[j]); j++;
+	incomingr[i] = VIS_FLOAT_TO_16(in[j]); j++;
+})
+
+VIS_WORK_EX(f32m, float, {
+	incomingl[i] = incomingr[i] = VIS_FLOAT_TO_16(in[j]); j++;
+})
+
+#undef VIS_FLOAT_TO_16
+
 #undef VIS_WORK
 #undef VIS_WORK_EX
 
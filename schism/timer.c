@@ -77,13 +77,12 @@ void timer_msleep(uint32_t ms)
 static mt_thread_t *timer_oneshot_thread = NULL;
 static struct atm timer_oneshot_thread_cancelled = { 0 };
 
-/* this protects the oneshot PENDING list, not the actual
- * list itself (important!) */
+/* this protects the oneshot PENDING list and the free list,
+ * not the actual queue itself (important!) */
 static mt_mutex_t *timer_oneshot_mutex = NULL;
 static mt_sem_t *timer_oneshot_sem = NULL;
 #endif
 
-// A linked list of timers.
 struct timer_oneshot_data_ {
 	void (*callback)(void *param);
 	void *param;
@@ -91,77 +90,168 @@ struct timer_oneshot_data_ {
 	// Ticks until the oneshot should be called, in microseconds.
 	timer_ticks_t trigger;
 
+	// Timers with the same trigger are called in the order they were added
+	uint64_t seq;
+
+	// Used for the pending and free lists
 	struct timer_oneshot_data_ *next;
 };
 
-// A list of pending timers that will be added to the real list
-// by the running thread.
+// Timers get allocated this many at a time, and are reused after
+// they've been called.
+#define TIMER_ONESHOT_BLOCK_SIZE 256
+
+struct timer_oneshot_block_ {
+	struct timer_oneshot_block_ *next;
+	struct timer_oneshot_data_ data[TIMER_ONESHOT_BLOCK_SIZE];
+};
+
 #ifdef USE_THREADS
 SCHISM_GUARDED_BY(timer_oneshot_mutex)
 #endif
-static struct timer_oneshot_data_ *oneshot_data_pending = NULL;
+static struct {
+	// A list of pending timers that will be added to the queue
+	// by the running thread, oldest first.
+	struct timer_oneshot_data_ *pending, *pending_tail;
+
+	// Timers that can be reused, and where they came from
+	struct timer_oneshot_data_ *free;
+	struct timer_oneshot_block_ *blocks;
+
+	uint64_t seq;
+} oneshot_data;
 
 // this should NEVER be touched outside of the worker/thread
-static struct timer_oneshot_data_ *oneshot_data_list = NULL;
+static struct {
+	// a binary min-heap, ordered by trigger time
+	struct timer_oneshot_data_ **heap;
+	size_t size, alloc;
+
+	// timers that have been called, waiting to be put on the free list
+	struct timer_oneshot_data_ *done;
+} oneshot_queue;
+
+static inline int timer_oneshot_before_(const struct timer_oneshot_data_ *a, const struct timer_oneshot_data_ *b)
+{
+	return (a->trigger != b->trigger) ? (a->trigger < b->trigger) : (a->seq < b->seq);
+}
+
+static void timer_oneshot_queue_push_(struct timer_oneshot_data_ *data)
+{
+	struct timer_oneshot_data_ **heap;
+	size_t i;
+
+	if (oneshot_queue.size >= oneshot_queue.alloc) {
+		oneshot_queue.alloc = oneshot_queue.alloc ? (oneshot_queue.alloc * 2) : TIMER_ONESHOT_BLOCK_SIZE;
+		oneshot_queue.heap = mem_realloc(oneshot_queue.heap, oneshot_queue.alloc * sizeof(*oneshot_queue.heap));
+	}
+
+	heap = oneshot_queue.heap;
+
+	// sift up
+	for (i = oneshot_queue.size++; i > 0; ) {
+		size_t parent = (i - 1) / 2;
+
+		if (!timer_oneshot_before_(data, heap[parent]))
+			break;
+
+		heap[i] = heap[parent];
+		i = parent;
+	}
+
+	heap[i] = data;
+}
+
+static struct timer_oneshot_data_ *timer_oneshot_queue_pop_(void)
+{
+	struct timer_oneshot_data_ **heap = oneshot_queue.heap;
+	struct timer_oneshot_data_ *top = heap[0], *last;
+	size_t i, size;
+
+	size = --oneshot_queue.size;
+	if (!size)
+		return top;
+
+	last = heap[size];
+
+	// sift down
+	for (i = 0;;) {
+		size_t child = i * 2 + 1;
+
+		if (child >= size)
+			break;
+
+		if (child + 1 < size && timer_oneshot_before_(heap[child + 1], heap[child]))
+			child++;
+
+		if (!timer_oneshot_before_(heap[child], last))
+			break;
+
+		heap[i] = heap[child];
+		i = child;
+	}
+
+	heap[i] = last;
+
+	return top;
+}
 
 /* This function does all the heavy lifting (INCLUDING mutex crap) */
 static timer_ticks_t timer_oneshot_work_(void)
 {
+	struct timer_oneshot_data_ *pending;
 	timer_ticks_t wait;
 
 #ifdef USE_THREADS
 	mt_mutex_lock(timer_oneshot_mutex);
 #endif
 
-	// Copy pending timers to the big list
-	if (oneshot_data_pending) {
-		if (oneshot_data_list) {
-			struct timer_oneshot_data_ *tail = oneshot_data_list;
-			while (tail->next)
-				tail = tail->next;
-			tail->next = oneshot_data_pending;
-		} else {
-			oneshot_data_list = oneshot_data_pending;
-		}
-
-		oneshot_data_pending = NULL;
+	// Take the pending timers, and give back the ones we're done with
+	pending = oneshot_data.pending;
+	oneshot_data.pending = oneshot_data.pending_tail = NULL;
+
+	if (oneshot_queue.done) {
+		struct timer_oneshot_data_ *tail = oneshot_queue.done;
+		while (tail->next)
+			tail = tail->next;
+		tail->next = oneshot_data.free;
+		oneshot_data.free = oneshot_queue.done;
+		oneshot_queue.done = NULL;
 	}
 
 #ifdef USE_THREADS
 	mt_mutex_unlock(timer_oneshot_mutex);
 #endif
 
+	while (pending) {
+		struct timer_oneshot_data_ *next = pending->next;
+		timer_oneshot_queue_push_(pending);
+		pending = next;
+	}
+
 	// Now process any timers that have finished
 	wait = UINT64_MAX;
 
-	if (oneshot_data_list) {
-		struct timer_oneshot_data_ *data = oneshot_data_list, *prev = NULL;
+	if (oneshot_queue.size) {
 		timer_ticks_t now = timer_ticks_us();
 
-		while (data) {
-			if (timer_ticks_passed(now, data->trigger)) {
-				data->callback(data->param);
+		do {
+			struct timer_oneshot_data_ *data = oneshot_queue.heap[0];
+
+			if (!timer_ticks_passed(now, data->trigger)) {
+				wait = data->trigger - now;
+				break;
+			}
 
-				now = timer_ticks_us();
+			timer_oneshot_queue_pop_();
 
-				// Remove the timer from the list
-				if (prev) {
-					prev->next = data->next;
-				} else {
-					oneshot_data_list = data->next;
-				}
+			data->callback(data->param);
 
-				// free the data
-				void *old = data;
-				data = data->next;
-				free(old);
-			} else {
-				wait = MIN(wait, data->trigger - now);
+			now = timer_ticks_us();
 
-				prev = data;
-				data = data->next;
-			}
-		}
+			data->next = oneshot_queue.done;
+			oneshot_queue.done = data;
+		} while (oneshot_queue.size);
 	}
 
 	if (wait < 1000) wait = 1000;
@@ -186,9 +276,11 @@ static int timer_oneshot_thread_func(SCHISM_UNUSED void *userdata)
 int timer_oneshot_worker(void)
 {
 #ifdef USE_THREADS
-	if (timer_oneshot_thread || backend->oneshot)
+	if (timer_oneshot_thread)
 		return 0; // do nothing
 #endif
+	if (backend->oneshot)
+		return 0;
 
 	timer_oneshot_work_();
 
@@ -197,35 +289,55 @@ int timer_oneshot_worker(void)
 
 void timer_oneshot(uint32_t ms, void (*callback)(void *param), void *param)
 {
+	struct timer_oneshot_data_ *data;
+
+	// Our own thread keeps the timers in a priority queue, which holds up
+	// a lot better than what the backends do when there are lots of them
+	// (e.g. MIDI output without a driver that can schedule events).
+#ifdef USE_THREADS
+	if (!timer_oneshot_thread)
+#endif
 	if (backend->oneshot) {
 		backend->oneshot(ms, callback, param);
 		// mmmmmmmmm
 		return;
 	}
 
-	// Ok, the backend doesn't support oneshots or it failed to make an event.
-	// Make a thread that "emulates" kernel-level events.
+	// Ok, the backend doesn't support oneshots, or we have a thread that
+	// "emulates" kernel-level events.
+
+#ifdef USE_THREADS
+	mt_mutex_lock(timer_oneshot_mutex);
+#endif
+
+	if (!oneshot_data.free) {
+		struct timer_oneshot_block_ *block = mem_alloc(sizeof(*block));
+		int i;
+
+		for (i = 0; i < TIMER_ONESHOT_BLOCK_SIZE; i++)
+			block->data[i].next = (i + 1 < TIMER_ONESHOT_BLOCK_SIZE) ? &block->data[i + 1] : NULL;
 
-	struct timer_oneshot_data_ *data = mem_alloc(sizeof(*data));
+		block->next = oneshot_data.blocks;
+		oneshot_data.blocks = block;
+		oneshot_data.free = block->data;
+	}
+
+	data = oneshot_data.free;
+	oneshot_data.free = data->next;
 
 	data->callback = callback;
 	data->param = param;
 	data->trigger = timer_ticks_us() + (ms * UINT64_C(1000));
+	data->seq = oneshot_data.seq++;
 	data->next = NULL;
 
-#ifdef USE_THREADS
-	mt_mutex_lock(timer_oneshot_mutex);
-#endif
-
 	// append it to the list
-	if (oneshot_data_pending) {
-		struct timer_oneshot_data_ *tail = oneshot_data_pending;
-		while (tail->next)
-			tail = tail->next;
-		tail->next = data;
+	if (oneshot_data.pending_tail) {
+		oneshot_data.pending_tail->next = data;
 	} else {
-		oneshot_data_pending = data;
+		oneshot_data.pending = data;
 	}
+	oneshot_data.pending_tail = data;
 
 #ifdef USE_THREADS
 	mt_mutex_unlock(timer_oneshot_mutex);
@@ -239,19 +351,34 @@ static void timer_setup_oneshot(void) SCHISM_THREAD_SAFE
 {
 	/* Technically, this next line is the only one that needs
 	 * SCHISM_THREAD_SAFE, but whatever */
-	oneshot_data_pending = NULL;
-	oneshot_data_list = NULL;
+	memset(&oneshot_data, 0, sizeof(oneshot_data));
+	memset(&oneshot_queue, 0, sizeof(oneshot_queue));
 
 #ifdef USE_THREADS
 	timer_oneshot_mutex = mt_mutex_create();
 	timer_oneshot_sem = mt_sem_create();
 
 	atm_store(&timer_oneshot_thread_cancelled, 0);
-	timer_oneshot_thread = mt_thread_create(timer_oneshot_thread_func,
-		"Timer oneshot thread", NULL);
+	if (timer_oneshot_mutex && timer_oneshot_sem)
+		timer_oneshot_thread = mt_thread_create(timer_oneshot_thread_func,
+			"Timer oneshot thread", NULL);
 #endif
 }
 
+static void timer_free_oneshot(void) SCHISM_THREAD_SAFE
+{
+	while (oneshot_data.blocks) {
+		struct timer_oneshot_block_ *next = oneshot_data.blocks->next;
+		free(oneshot_data.blocks);
+		oneshot_data.blocks = next;
+	}
+
+	free(oneshot_queue.heap);
+
+	memset(&oneshot_data, 0, sizeof(oneshot_data));
+	memset(&oneshot_queue, 0, sizeof(oneshot_queue));
+}
+
 int timer_init(void)
 {
 	static const schism_timer_backend_t *backends[] = {
@@ -284,8 +411,11 @@ int timer_init(void)
 	if (!backend)
 		return 0;
 
-	/* XXX should just use builtin oneshot everywhere */
+	/* the builtin oneshots are used whenever there's a thread to run
+	 * them on, and otherwise only if the backend can't do them */
+#ifndef USE_THREADS
 	if (!backend->oneshot)
+#endif
 		timer_setup_oneshot();
 
 	return 1;
@@ -310,6 +440,8 @@ void timer_quit(void)
 	}
 #endif
 
+	timer_free_oneshot();
+
 	if (backend) {
 		backend->quit();
 		backend = NULL;
@@ -264,9 +264,114 @@ static void windowed_fir_init(void)
 }
 
 /* ------------------------------------------------------------------------ */
+/* windowed sinc interpolation */
 
-#define LOOP(BITS, x, y) \
-	printf("static int" #BITS "_t %s[%" PRId32 "] = {\n", #x, (int32_t)y); \
+/* sinc interpolation doc,
+ *
+ *  same idea as the fir above, but with longer kernels and a kaiser window,
+ *  which has much lower sidelobes than anything that fits in 8 taps:
+ *    c(x) = fc * sinc(fc * x) * w(x / (width / 2)),  x = tap - (width / 2 - 1) - frac
+ *  so tap (width / 2 - 1) is the sample at the current position.
+ *
+ *  every phase is a row of 'width' coefs that sum to unity gain, and rows
+ *  are laid out one after the other, so a whole row is one or two aligned
+ *  vector loads (the mixer uses unaligned loads, but the alignment keeps
+ *  the rows from straddling cache lines).
+ *
+ *  there's one 16 tap table for upsampling, and two 32 tap ones with lower
+ *  cutoffs for playing samples back faster than the mixing rate; those are
+ *  the same kernel as the 16 tap one stretched out by the downsampling
+ *  ratio, so they get rid of whatever would otherwise alias. */
+
+// quantizer scale of sinc coefs
+#define SINC_QUANTBITS      15
+#define SINC_QUANTSCALE     (1L << SINC_QUANTBITS)
+
+// log2(number) of precalculated phases; the upsampling kernel gets twice
+// as many since it's used far more often, and it's where phase noise is
+// most audible
+#define SINC_FRACBITS       11
+#define SINC_PHASES         ((1L << SINC_FRACBITS) + 1)
+#define SINC_DOWN_FRACBITS  10
+#define SINC_DOWN_PHASES    ((1L << SINC_DOWN_FRACBITS) + 1)
+
+// number of samples in window
+#define SINC_WIDTH          16
+#define SINC_DOWN_WIDTH     32
+
+// cutoff (1.0 == nyquist) and kaiser window beta
+#define SINC_CUTOFF         0.92
+#define SINC_BETA           7.0
+
+// downsampling ratios of the 32 tap tables
+#define SINC_DOWN_RATIO_1   1.5
+#define SINC_DOWN_RATIO_2   2.0
+
+static double izero(double x)
+{
+	double sum = 1.0, term = 1.0, halfx = 0.5 * x;
+	int n;
+
+	for (n = 1; term > M_zBESSELEPS * sum; n++) {
+		term *= (halfx / n) * (halfx / n);
+		sum += term;
+	}
+
+	return sum;
+}
+
+static void sinc_init(int16_t *lut, int width, int fracbits, double cut)
+{
+	const int phases = (1 << fracbits) + 1;
+	const double half = 0.5 * width;
+	const double scale = (double) SINC_QUANTSCALE;
+	const double ibeta = 1.0 / izero(SINC_BETA);
+	int ph, cc;
+
+	for (ph = 0; ph < phases; ph++) {
+		double coefs[SINC_DOWN_WIDTH], gain = 0.0;
+		double frac = (double) ph / (double) (1 << fracbits);
+		int16_t *row = lut + ph * width;
+		int sum = 0, max = 0;
+
+		for (cc = 0; cc < width; cc++) {
+			double x = (cc - (half - 1.0)) - frac;
+			double r = x / half;
+			double si = (fabs(x) < M_zEPS) ? cut : sin(M_zPI * cut * x) / (M_zPI * x);
+			double wc = (fabs(r) < 1.0) ? izero(SINC_BETA * sqrt(1.0 - r * r)) * ibeta : 0.0;
+
+			coefs[cc] = si * wc;
+			gain += coefs[cc];
+		}
+
+		gain = 1.0 / gain;
+
+		for (cc = 0; cc < width; cc++) {
+			row[cc] = (int16_t) floor(0.5 + scale * coefs[cc] * gain);
+			sum += row[cc];
+			if (row[cc] > row[max])
+				max = cc;
+		}
+
+		// force unity gain
+		row[max] += (int16_t) (SINC_QUANTSCALE - sum);
+	}
+}
+
+static int16_t sinc_lut[SINC_PHASES * SINC_WIDTH];
+static int16_t sinc_down_lut[2][SINC_DOWN_PHASES * SINC_DOWN_WIDTH];
+
+static void windowed_sinc_init(void)
+{
+	sinc_init(sinc_lut, SINC_WIDTH, SINC_FRACBITS, SINC_CUTOFF);
+	sinc_init(sinc_down_lut[0], SINC_DOWN_WIDTH, SINC_DOWN_FRACBITS, SINC_CUTOFF / SINC_DOWN_RATIO_1);
+	sinc_init(sinc_down_lut[1], SINC_DOWN_WIDTH, SINC_DOWN_FRACBITS, SINC_CUTOFF / SINC_DOWN_RATIO_2);
+}
+
+/* ------------------------------------------------------------------------ */
+
+#define LOOP_ATTR(BITS, x, name, y, attr) \
+	printf("static int" #BITS "_t " attr "%s[%" PRId32 "] = {\n", name, (int32_t)y); \
 	\
 	for (int i = 0; i < y; i++) { \
 		if (i && !(i % 64)) \
@@ -276,14 +381,20 @@ static void windowed_fir_init(void)
 	\
 	printf("\n};\n\n");
 
+#define LOOP(BITS, x, y) LOOP_ATTR(BITS, x, #x, y, "")
+
 
 int main(int argc, char **argv)
 {
 	cubic_spline_init();
 	windowed_fir_init();
+	windowed_sinc_init();
 
 	LOOP(16, cubic_spline_lut, (4 * SPLINE_LUTLEN));
 	LOOP(16, windowed_fir_lut, (WFIR_LUTLEN * WFIR_WIDTH));
+	LOOP_ATTR(16, sinc_lut, "sinc_lut", (SINC_PHASES * SINC_WIDTH), "SCHISM_ALIGNED(64) ");
+	LOOP_ATTR(16, sinc_down_lut[0], "sinc_down_lut_1", (SINC_DOWN_PHASES * SINC_DOWN_WIDTH), "SCHISM_ALIGNED(64) ");
+	LOOP_ATTR(16, sinc_down_lut[1], "sinc_down_lut_2", (SINC_DOWN_PHASES * SINC_DOWN_WIDTH), "SCHISM_ALIGNED(64) ");
 
 	return 0;
 }
@@ -0,0 +1,477 @@
+/*
+ * Schism Tracker - a cross-platform Impulse Tracker clone
+ * copyright (c) 2003-2005 Storlek <storlek@rigelseven.com>
+ * copyright (c) 2005-2008 Mrs. Brisby <mrs.brisby@nimh.org>
+ * copyright (c) 2009 Storlek & Mrs. Brisby
+ * copyright (c) 2010-2012 Storlek
+ * URL: http://schismtracker.org/
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "test.h"
+#include "test-assertions.h"
+#include "test-mixer.h"
+
+#include "disko.h"
+#include "dmoz.h"
+#include "fmt.h"
+#include "mem.h"
+#include "slurp.h"
+#include "timer.h"
+#include "player/sndfile.h"
+
+/* the same tables as the file browser and the song loader have */
+#define READ_INFO(t) fmt_##t##_read_info,
+static const fmt_read_info_func fmt_test_read_info_funcs[] = {
+#include "fmt-types.h"
+	NULL,
+};
+
+#define LOAD_SONG(t) fmt_##t##_load_song,
+static const fmt_load_song_func fmt_test_load_song_funcs[] = {
+#include "fmt-types.h"
+	NULL,
+};
+
+#define FMT_TEST_MAX_FILES 64
+#define FMT_TEST_ROUNDS    20
+
+struct fmt_test_file {
+	const char *name;
+	uint8_t *data;
+	size_t length;
+
+	/* for the hand-built headers, what has to keep recognizing them */
+	fmt_read_info_func read_info;
+	fmt_load_song_func load_song;
+};
+
+static struct fmt_test_file fmt_test_files[FMT_TEST_MAX_FILES];
+static size_t fmt_test_num_files;
+
+/* ------------------------------------------------------------------------ */
+/* the corpus: whatever can be saved, a minimal header for everything in
+ * fmt/detect.c that can't be, plus a couple of files that aren't anything
+ * at all */
+
+struct fmt_test_patch {
+	uint32_t offset;
+	uint32_t length;
+	const char *data;
+};
+
+/* the rest of the file is zero */
+struct fmt_test_header {
+	const char *name;
+	fmt_read_info_func read_info;
+	fmt_load_song_func load_song;
+	uint32_t length;
+	struct fmt_test_patch patch[6];
+};
+
+#define PATCH(off, str) {(off), sizeof(str) - 1, (str)}
+
+static const struct fmt_test_header fmt_test_headers[] = {
+	/* one sample, one pattern, orders 0 then end */
+	{"669", fmt_669_read_info, fmt_669_load_song, 2048, {PATCH(0, "if"), PATCH(110, "\x01\x01\x00\x00\xff")}},
+	{"669 (JN)", fmt_669_read_info, fmt_669_load_song, 2048, {PATCH(0, "JN"), PATCH(110, "\x01\x01\x00\x00\xff")}},
+	{"FAR", fmt_far_read_info, fmt_far_load_song, 2048, {PATCH(0, "FAR\xfe" "far"), PATCH(44, "\x0d\x0a\x1a\x62\x00\x10")}},
+	/* version 1.04, 276 byte header, 1 order, 4 channels, 1 empty pattern */
+	{"XM", fmt_xm_read_info, fmt_xm_load_song, 1024, {
+		PATCH(0, "Extended Module: " "xm"),
+		PATCH(37, "\x1a"),
+		PATCH(58, "\x04\x01\x14\x01\0\0\x01\0\0\0\x04\0\x01\0\0\0\0\0\x06\0\x7d\0"),
+		PATCH(336, "\x09\0\0\0\0\x40\0\0\0"),
+	}},
+	{"MT2", fmt_mt2_read_info, NULL, 256, {PATCH(0, "MT20"), PATCH(42, "mt2")}},
+	{"MTM", fmt_mtm_read_info, fmt_mtm_load_song, 1024, {PATCH(0, "MTM\x10" "mtm")}},
+	{"NTK", fmt_ntk_read_info, NULL, 64, {PATCH(0, "TWNNSNG2"), PATCH(9, "ntk")}},
+	/* version 1.0, then straight to the info block */
+	{"MDL", fmt_mdl_read_info, fmt_mdl_load_song, 256, {PATCH(0, "DMDL\x10" "IN\x3b\0\0\0" "mdl")}},
+	/* the expansion data at 0x100 points to a 3-byte song name at 0x180 */
+	{"MED", fmt_med_read_info, NULL, 512, {PATCH(0, "MMD0"), PATCH(32, "\0\0\x01\0"), PATCH(0x100 + 44, "\0\0\x01\x80\0\0\0\x03"), PATCH(0x180, "med")}},
+	{"OKT", fmt_okt_read_info, fmt_okt_load_song, 64, {PATCH(0, "OKTASONG")}},
+	/* one track with nothing but an end-of-track event */
+	{"MID", fmt_mid_read_info, fmt_mid_load_song, 64, {PATCH(0, "MThd\0\0\0\x06\0\0\0\x01\0\x60" "MTrk\0\0\0\x04\0\xff\x2f\0")}},
+	{"RMID", fmt_mid_read_info, fmt_mid_load_song, 64, {PATCH(0, "RIFF\x26\0\0\0" "RMIDdata\x1a\0\0\0" "MThd\0\0\0\x06\0\0\0\x01\0\x60" "MTrk\0\0\0\x04\0\xff\x2f\0")}},
+	/* a score of one "score end" event */
+	{"MUS", fmt_mus_read_info, fmt_mus_load_song, 64, {PATCH(0, "MUS\x1a\x04\0\x10\0"), PATCH(16, "\x60")}},
+	{"MF", fmt_mf_read_info, NULL, 64, {PATCH(0, "MOONFISH"), PATCH(33, "\x02" "mf")}},
+	{"PSM", fmt_psm_read_info, fmt_psm_load_song, 64, {PATCH(0, "PSM \x14\0\0\0" "FILE" "TITL\x04\0\0\0" "psm")}},
+	/* 4 channels, and one of everything */
+	{"PSM16", fmt_psm16_read_info, fmt_psm16_load_song, 256, {
+		PATCH(0, "PSM\xfe" "psm16"),
+		PATCH(63, "\x1a\0\x10\0\x06\x7d\x40\x01\0\x01\0\x01\0\x01\0\x04\0\x04\0"),
+	}},
+	/* the song chunk has to be all there, the loader doesn't check */
+	{"DSM", fmt_dsm_read_info, fmt_dsm_load_song, 256, {
+		PATCH(0, "RIFF\xf8\0\0\0" "DSMF" "SONG\xc0\0\0\0" "dsm"),
+		PATCH(56, "\x01\0\0\0\0\0\x04\0\x40\x80\x06\x7d"),
+	}},
+	/* 16-bit mono, 44.1 kHz, 4 frames */
+	{"W64", fmt_w64_read_info, NULL, 112, {
+		PATCH(0, "riff\x2e\x91\xcf\x11\xa5\xd6\x28\xdb\x04\xc1\x00\x00" "\x70\0\0\0\0\0\0\0"),
+		PATCH(24, "wave\xf3\xac\xd3\x11\x8c\xd1\x00\xc0\x4f\x8e\xdb\x8a"),
+		PATCH(40, "fmt \xf3\xac\xd3\x11\x8c\xd1\x00\xc0\x4f\x8e\xdb\x8a" "\x28\0\0\0\0\0\0\0"),
+		PATCH(64, "\x01\0\x01\0\x44\xac\0\0\x88\x58\x01\0\x02\0\x10\0"),
+		PATCH(80, "data\xf3\xac\xd3\x11\x8c\xd1\x00\xc0\x4f\x8e\xdb\x8a" "\x20\0\0\0\0\0\0\0"),
+	}},
+	{"SBI", fmt_sbi_read_info, NULL, 64, {PATCH(0, "SBI\x1a" "sbi")}},
+	{"XI", fmt_xi_read_info, NULL, 512, {PATCH(0, "Extended Instrument: " "xi"), PATCH(43, "\x1a"), PATCH(64, "\x02\x01")}},
+	{"PAT", fmt_pat_read_info, NULL, 1024, {PATCH(0, "GF1PATCH110\0" "ID#000002\0")}},
+	/* empty INFO/sdta/pdta lists, with just the chunks the reader insists on */
+	{"SF2", fmt_sf2_read_info, NULL, 80, {PATCH(0, "RIFF\x48\0\0\0" "sfbk"
+		"LIST\x10\0\0\0" "INFO" "ifil\x04\0\0\0\x02\0\0\0"
+		"LIST\x10\0\0\0" "sdta" "smpl\x04\0\0\0\0\0\0\0"
+		"LIST\x0c\0\0\0" "pdta" "shdr\0\0\0\0")}},
+	{"ULT", fmt_ult_read_info, fmt_ult_load_song, 128, {PATCH(0, "MAS_UTrack_V004" "ult")}},
+	{"LIQ", fmt_liq_read_info, NULL, 128, {PATCH(0, "Liquid Module:" "liq"), PATCH(64, "\x1a")}},
+	{"AMS", fmt_ams_read_info, NULL, 64, {PATCH(0, "AMShdr\x1a\x03" "ams")}},
+	{"F2R", fmt_f2r_read_info, NULL, 64, {PATCH(0, "F2R"), PATCH(6, "f2r")}},
+	/* an AdLib one; the PCM kind can be saved */
+	{"S3I", fmt_s3i_read_info, NULL, 128, {PATCH(0, "\x02" "s3i"), PATCH(0x4C, "SCRI")}},
+	{"IMF", fmt_imf_read_info, fmt_imf_load_song, 1024, {PATCH(0, "imf"), PATCH(60, "IM10")}},
+	/* the tag, then the tempo (which can't be zero); the loader doesn't
+	 * check for the end of the file, so leave room for a pattern */
+	{"SFX", fmt_sfx_read_info, fmt_sfx_load_song, 4096, {PATCH(124, "SO31\x38\xe5")}},
+	{"SFX (15)", fmt_sfx_read_info, fmt_sfx_load_song, 4096, {PATCH(60, "SONG\x38\xe5")}},
+	{"STX", fmt_stx_read_info, fmt_stx_load_song, 1024, {PATCH(0, "stx"), PATCH(20, "!Scream!"), PATCH(60, "SCRM")}},
+};
+
+#undef PATCH
+
+static song_t *fmt_test_song(void)
+{
+	song_sample_t smp = {0};
+	song_t *csf;
+	int i;
+
+	smp.data = csf_allocate_sample(2000 * 2);
+	smp.length = 2000;
+	smp.flags = CHN_16BIT | CHN_LOOP;
+	smp.loop_start = 0;
+	smp.loop_end = 2000;
+	smp.c5speed = 8363;
+	smp.volume = 256;
+	smp.global_volume = 64;
+	for (i = 0; i < 2000; i++)
+		((int16_t *)smp.data)[i] = (int16_t)((i % 100) * 600 - 30000);
+	strcpy(smp.name, "saw");
+	csf_adjust_sample_loop(&smp);
+
+	csf = mixer_test_one_note_song(&smp, SRCMODE_LINEAR);
+
+	csf->instruments[1] = csf_allocate_instrument();
+	csf_init_instrument(csf->instruments[1], 1);
+
+	/* a few more notes, so there's something for the pattern packers to do */
+	for (i = 4; i < 64; i += 4) {
+		csf->patterns[0][i * MAX_CHANNELS].note = NOTE_FIRST + 48 + (i % 12);
+		csf->patterns[0][i * MAX_CHANNELS].instrument = 1;
+	}
+
+	strcpy(csf->title, "format detection");
+
+	return csf;
+}
+
+static void fmt_test_add(const char *name, disko_t *ds, int ok)
+{
+	if (disko_memclose(ds, ok) != DW_OK || !ok)
+		return;
+
+	fmt_test_files[fmt_test_num_files].name = name;
+	fmt_test_files[fmt_test_num_files].data = ds->data;
+	fmt_test_files[fmt_test_num_files].length = ds->length;
+	fmt_test_files[fmt_test_num_files].read_info = NULL;
+	fmt_test_files[fmt_test_num_files].load_song = NULL;
+	fmt_test_num_files++;
+}
+
+static void fmt_test_add_header(const struct fmt_test_header *hdr)
+{
+	struct fmt_test_file *f = &fmt_test_files[fmt_test_num_files];
+	size_t i;
+
+	f->data = mem_calloc(1, hdr->length);
+
+	for (i = 0; i < ARRAY_SIZE(hdr->patch) && hdr->patch[i].data; i++)
+		memcpy(f->data + hdr->patch[i].offset, hdr->patch[i].data, hdr->patch[i].length);
+
+	f->name = hdr->name;
+	f->length = hdr->length;
+	f->read_info = hdr->read_info;
+	f->load_song = hdr->load_song;
+	fmt_test_num_files++;
+}
+
+static void fmt_test_make_corpus(void)
+{
+	song_t *csf = fmt_test_song();
+	disko_t ds;
+	uint32_t x = 2463534242u;
+	size_t i;
+
+	for (i = 0; song_save_formats[i].label; i++) {
+		if (disko_memopen(&ds) < 0)
+			continue;
+		fmt_test_add(song_save_formats[i].label, &ds,
+			song_save_formats[i].f.save_song(&ds, csf) == SAVE_SUCCESS);
+	}
+
+	for (i = 0; sample_save_formats[i].label; i++) {
+		/* SBI is for AdLib samples only, and RAW has nothing to detect */
+		if (!strcmp(sample_save_formats[i].label, "SBI") || !strcmp(sample_save_formats[i].label, "RAW")
+			|| (sample_save_formats[i].enabled && !sample_save_formats[i].enabled()))
+			continue;
+		if (disko_memopen(&ds) < 0)
+			continue;
+		fmt_test_add(sample_save_formats[i].label, &ds,
+			sample_save_formats[i].f.save_sample(&ds, &csf->samples[1]) == SAVE_SUCCESS);
+	}
+
+	/* XI saving goes through current_song */
+	if (disko_memopen(&ds) >= 0)
+		fmt_test_add("ITI", &ds, fmt_iti_save_instrument(&ds, csf, csf->instruments[1]) == SAVE_SUCCESS);
+
+	csf_free(csf);
+
+	for (i = 0; i < ARRAY_SIZE(fmt_test_headers); i++)
+		fmt_test_add_header(&fmt_test_headers[i]);
+
+	if (disko_memopen(&ds) >= 0) {
+		for (i = 0; i < 4096; i++) {
+			uint8_t b;
+
+			x ^= x << 13;
+			x ^= x >> 17;
+			x ^= x << 5;
+			b = (uint8_t)x;
+			disko_write(&ds, &b, 1);
+		}
+		fmt_test_add("noise", &ds, 1);
+	}
+
+	if (disko_memopen(&ds) >= 0) {
+		static const char text[] = "This is not a module, it's just some text.\n";
+
+		for (i = 0; i < 32; i++)
+			disko_write(&ds, text, sizeof(text) - 1);
+		fmt_test_add("text", &ds, 1);
+	}
+}
+
+static void fmt_test_free_corpus(void)
+{
+	size_t i;
+
+	for (i = 0; i < fmt_test_num_files; i++)
+		free(fmt_test_files[i].data);
+
+	fmt_test_num_files = 0;
+}
+
+/* ------------------------------------------------------------------------ */
+
+/* returns the function that recognized the file, or NULL */
+static fmt_read_info_func fmt_test_read_info(const struct fmt_test_file *f, int detect)
+{
+	fmt_read_info_func candidates[ARRAY_SIZE(fmt_test_read_info_funcs)];
+	const fmt_read_info_func *func = fmt_test_read_info_funcs;
+	fmt_read_info_func found = NULL;
+	dmoz_file_t file = {0};
+	slurp_t fp;
+
+	slurp_memstream(&fp, f->data, f->length);
+
+	if (detect) {
+		fmt_detect_t det;
+
+		fmt_detect_init(&det, &fp);
+		fmt_detect_read_info_funcs(&det, fmt_test_read_info_funcs, candidates);
+		func = candidates;
+	}
+
+	for (; *func; func++) {
+		slurp_rewind(&fp);
+		if ((*func)(&file, &fp)) {
+			found = *func;
+			break;
+		}
+	}
+
+	free(file.artist);
+	free(file.title);
+	unslurp(&fp);
+
+	return found;
+}
+
+/* returns the function that loaded the file (or failed to), or NULL */
+static fmt_load_song_func fmt_test_load(const struct fmt_test_file *f, int detect, int *result)
+{
+	fmt_load_song_func candidates[ARRAY_SIZE(fmt_test_load_song_funcs)];
+	const fmt_load_song_func *func = fmt_test_load_song_funcs;
+	fmt_load_song_func found = NULL;
+	song_t *csf = csf_allocate();
+	slurp_t fp;
+
+	slurp_memstream(&fp, f->data, f->length);
+
+	if (detect) {
+		fmt_detect_t det;
+
+		fmt_detect_init(&det, &fp);
+		fmt_detect_load_song_funcs(&det, fmt_test_load_song_funcs, candidates);
+		func = candidates;
+	}
+
+	*result = LOAD_UNSUPPORTED;
+	for (; *func; func++) {
+		slurp_rewind(&fp);
+		*result = (*func)(csf, &fp, 0);
+		if (*result != LOAD_UNSUPPORTED) {
+			found = *func;
+			break;
+		}
+	}
+
+	unslurp(&fp);
+	csf_free(csf);
+
+	return found;
+}
+
+/* whether detection still offers the file to its own format's info reader,
+ * and that reader still takes it */
+static int fmt_test_keeps_read_info(const struct fmt_test_file *f)
+{
+	fmt_read_info_func candidates[ARRAY_SIZE(fmt_test_read_info_funcs)];
+	const fmt_read_info_func *func;
+	dmoz_file_t file = {0};
+	fmt_detect_t det;
+	slurp_t fp;
+	int ok = 0;
+
+	slurp_memstream(&fp, f->data, f->length);
+
+	fmt_detect_init(&det, &fp);
+	fmt_detect_read_info_funcs(&det, fmt_test_read_info_funcs, candidates);
+
+	for (func = candidates; *func; func++) {
+		if (*func == f->read_info) {
+			slurp_rewind(&fp);
+			ok = (*func)(&file, &fp);
+			break;
+		}
+	}
+
+	free(file.artist);
+	free(file.title);
+	unslurp(&fp);
+
+	return ok;
+}
+
+/* same for the loader; it only has to claim the file, not load it */
+static int fmt_test_keeps_load_song(const struct fmt_test_file *f)
+{
+	fmt_load_song_func candidates[ARRAY_SIZE(fmt_test_load_song_funcs)];
+	const fmt_load_song_func *func;
+	song_t *csf = csf_allocate();
+	fmt_detect_t det;
+	slurp_t fp;
+	int ok = 0;
+
+	slurp_memstream(&fp, f->data, f->length);
+
+	fmt_detect_init(&det, &fp);
+	fmt_detect_load_song_funcs(&det, fmt_test_load_song_funcs, candidates);
+
+	for (func = candidates; *func; func++) {
+		if (*func == f->load_song) {
+			slurp_rewind(&fp);
+			ok = ((*func)(csf, &fp, 0) != LOAD_UNSUPPORTED);
+			break;
+		}
+	}
+
+	unslurp(&fp);
+	csf_free(csf);
+
+	return ok;
+}
+
+/* The detection pass must not change what any file gets recognized (or
+ * loaded) as. This also logs how many files per second go through the info
+ * readers and the loaders, with and without it. */
+testresult_t test_fmt_detect(void)
+{
+	timer_ticks_t elapsed[2][2] = {{0}};
+	size_t i, round;
+	int detect;
+
+	fmt_test_make_corpus();
+
+	ASSERT_PRINTF(fmt_test_num_files >= 10 + ARRAY_SIZE(fmt_test_headers), "only %u files in the corpus", (unsigned)fmt_test_num_files);
+
+	for (i = 0; i < fmt_test_num_files; i++) {
+		const struct fmt_test_file *f = &fmt_test_files[i];
+		const fmt_read_info_func info = fmt_test_read_info(f, 0);
+		int full_result, detect_result;
+
+		ASSERT_PRINTF(info == fmt_test_read_info(f, 1), "%s: read_info differs", f->name);
+		ASSERT_PRINTF(info || !strcmp(f->name, "noise") || !strcmp(f->name, "text"), "%s: not recognized", f->name);
+		ASSERT_PRINTF(fmt_test_load(f, 0, &full_result) == fmt_test_load(f, 1, &detect_result)
+			&& full_result == detect_result, "%s: load differs", f->name);
+
+		if (f->read_info)
+			ASSERT_PRINTF(fmt_test_keeps_read_info(f), "%s: not recognized by its own read_info", f->name);
+		if (f->load_song)
+			ASSERT_PRINTF(fmt_test_keeps_load_song(f), "%s: not claimed by its own loader", f->name);
+	}
+
+	for (detect = 0; detect < 2; detect++) {
+		for (round = 0; round < FMT_TEST_ROUNDS; round++) {
+			timer_ticks_t start = timer_ticks_us();
+			int result;
+
+			for (i = 0; i < fmt_test_num_files; i++)
+				fmt_test_read_info(&fmt_test_files[i], detect);
+
+			elapsed[detect][0] += timer_ticks_us() - start;
+
+			start = timer_ticks_us();
+
+			for (i = 0; i < fmt_test_num_files; i++)
+				fmt_test_load(&fmt_test_files[i], detect, &result);
+
+			elapsed[detect][1] += timer_ticks_us() - start;
+		}
+	}
+
+	test_log_printf("%u files\n", (unsigned)fmt_test_num_files);
+
+	for (detect = 0; detect < 2; detect++)
+		test_log_printf("%s: read_info %.0f files/s, load %.0f files/s\n",
+			detect ? "detected" : "all formats",
+			fmt_test_num_files * FMT_TEST_ROUNDS * 1e6 / MAX(elapsed[detect][0], 1),
+			fmt_test_num_files * FMT_TEST_ROUNDS * 1e6 / MAX(elapsed[detect][1], 1));
+
+	fmt_test_free_corpus();
+
+	RETURN_PASS;
+}
@@ -0,0 +1,292 @@
+/*
+ * Schism Tracker - a cross-platform Impulse Tracker clone
+ * copyright (c) 2003-2005 Storlek <storlek@rigelseven.com>
+ * copyright (c) 2005-2008 Mrs. Brisby <mrs.brisby@nimh.org>
+ * copyright (c) 2009 Storlek & Mrs. Brisby
+ * copyright (c) 2010-2012 Storlek
+ * URL: http://schismtracker.org/
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#include "test.h"
+#include "test-assertions.h"
+
+#include "player/sndfile.h"
+
+/* ------------------------------------------------------------------------ */
+/* a song that jumps around a fair bit */
+
+#define LENGTH_TEST_ORDERS 12
+
+static void length_test_set(song_t *csf, uint32_t pat, uint32_t row, uint32_t chan, uint8_t effect, uint8_t param)
+{
+	song_note_t *note = csf->patterns[pat] + row * MAX_CHANNELS + chan;
+
+	note->effect = effect;
+	note->param = param;
+}
+
+static song_t *length_test_song(void)
+{
+	song_t *csf = csf_allocate();
+	uint32_t p, o;
+
+	for (p = 0; p < 6; p++) {
+		csf->patterns[p] = csf_allocate_pattern(64);
+		csf->pattern_size[p] = csf->pattern_alloc_size[p] = 64;
+	}
+
+	/* speed and tempo changes, with a tempo that carries over from one
+	 * pattern to the next through the effect memory */
+	length_test_set(csf, 0, 0, 0, FX_SPEED, 4);
+	length_test_set(csf, 0, 16, 1, FX_TEMPO, 0x90);
+	length_test_set(csf, 1, 8, 1, FX_TEMPO, 0);
+	length_test_set(csf, 1, 9, 2, FX_SPEED, 7);
+
+	/* tempo slides, also from memory */
+	length_test_set(csf, 1, 20, 1, FX_TEMPO, 0x03);
+	length_test_set(csf, 1, 21, 1, FX_TEMPO, 0);
+	length_test_set(csf, 1, 30, 3, FX_TEMPO, 0x12);
+
+	/* a pattern loop, and a row delay */
+	length_test_set(csf, 2, 4, 3, FX_SPECIAL, 0xB0);
+	length_test_set(csf, 2, 11, 3, FX_SPECIAL, 0xB3);
+	length_test_set(csf, 2, 20, 4, FX_SPECIAL, 0xE5);
+	length_test_set(csf, 2, 30, 4, FX_SPECIAL, 0);
+	length_test_set(csf, 2, 40, 5, FX_TEMPO, 0x1F);
+	length_test_set(csf, 2, 40, 6, FX_SPECIAL, 0xE2);
+	length_test_set(csf, 2, 41, 6, FX_SPECIAL, 0x63);
+
+	/* break into the middle of the next pattern */
+	length_test_set(csf, 3, 40, 5, FX_PATTERNBREAK, 10);
+
+	/* jump forward, and try to jump back (which is ignored) */
+	length_test_set(csf, 4, 50, 6, FX_POSITIONJUMP, 9);
+	length_test_set(csf, 5, 60, 6, FX_POSITIONJUMP, 1);
+	length_test_set(csf, 5, 62, 7, FX_TEMPO, 0xC8);
+
+	for (o = 0; o < LENGTH_TEST_ORDERS; o++)
+		csf->orderlist[o] = o % 6;
+	csf->orderlist[7] = ORDER_SKIP;
+	csf->orderlist[LENGTH_TEST_ORDERS] = ORDER_LAST;
+
+	csf->initial_speed = 6;
+	csf->initial_tempo = 125;
+	csf->initial_global_volume = 128;
+	csf->repeat_count = -1;
+
+	csf_set_wave_config(csf, 44100, 16, 2);
+
+	return csf;
+}
+
+/* the same thing as csf_get_length_to, without anything saved from before */
+static uint32_t length_test_fresh_to(song_t *csf, uint32_t order, uint32_t row)
+{
+	csf_free_seek_index(csf);
+	return csf_get_length_to(csf, order, row);
+}
+
+static uint32_t length_test_fresh(song_t *csf)
+{
+	csf_free_seek_index(csf);
+	return csf_get_length(csf);
+}
+
+/* ------------------------------------------------------------------------ */
+
+/* Carrying on from a saved snapshot has to give exactly the same answers as
+ * running through the song from the start. */
+testresult_t test_song_length_index(void)
+{
+	song_t *csf = length_test_song();
+	uint32_t length, o, r, s;
+
+	length = length_test_fresh(csf);
+	REQUIRE(length > 0);
+
+	/* the index is built now; go through it backwards for good measure */
+	for (o = LENGTH_TEST_ORDERS + 1; o-- > 0;) {
+		for (r = 0; r < 64; r += 7) {
+			uint32_t expected = length_test_fresh_to(csf, o, r);
+
+			csf_get_length(csf);
+			ASSERT_PRINTF(csf_get_length_to(csf, o, r) == expected,
+				"time to order %" PRIu32 " row %" PRIu32 " differs", o, r);
+		}
+	}
+
+	for (s = length + 1; s-- > 0;) {
+		uint32_t eo, er, co, cr;
+
+		csf_free_seek_index(csf);
+		csf_get_position_at(csf, s, &eo, &er);
+
+		csf_get_length(csf);
+		csf_get_position_at(csf, s, &co, &cr);
+
+		ASSERT_PRINTF(co == eo && cr == er, "position at %" PRIu32 " seconds differs", s);
+	}
+
+	ASSERT(csf_get_length(csf) == length);
+
+	csf_free(csf);
+
+	RETURN_PASS;
+}
+
+/* Edits have to throw out whatever they affect. */
+testresult_t test_song_length_edit(void)
+{
+	song_t *csf = length_test_song();
+	uint32_t before, after;
+
+	before = csf_get_length(csf);
+
+	/* make the pattern loop go around more times */
+	length_test_set(csf, 2, 11, 3, FX_SPECIAL, 0xB6);
+	after = csf_get_length(csf);
+	ASSERT(after > before);
+	ASSERT(after == length_test_fresh(csf));
+	ASSERT(csf_get_length_to(csf, 9, 0) == length_test_fresh_to(csf, 9, 0));
+
+	/* leave out one of the orders */
+	before = after;
+	csf->orderlist[3] = ORDER_SKIP;
+	after = csf_get_length(csf);
+	ASSERT(after < before);
+	ASSERT(after == length_test_fresh(csf));
+	ASSERT(csf_get_length_to(csf, 9, 0) == length_test_fresh_to(csf, 9, 0));
+
+	/* slow down the start */
+	before = after;
+	csf->initial_tempo = 32;
+	after = csf_get_length(csf);
+	ASSERT(after > before);
+	ASSERT(after == length_test_fresh(csf));
+
+	csf_free(csf);
+
+	RETURN_PASS;
+}
+
+/* a song with one instrument, which has a hole in its note map at D-5; in
+ * instrument mode, IT ignores a whole cell whose instrument plays a note that
+ * maps to no sample. an instrument number without a note goes by the last
+ * note played in the channel, so whether the tempo changes here depends on
+ * what the row before it had in it. */
+static song_t *length_test_note_map_song(uint8_t last_note)
+{
+	song_t *csf = length_test_song();
+	song_instrument_t *ins = csf_allocate_instrument();
+	song_sample_t *smp = &csf->samples[1];
+	song_note_t *row;
+	uint32_t o;
+
+	smp->data = csf_allocate_sample(64);
+	smp->length = 64;
+	smp->c5speed = 8363;
+	smp->volume = 256;
+	smp->global_volume = 64;
+
+	csf_init_instrument(ins, 1);
+	ins->sample_map[62] = 0; /* D-5 */
+	csf->instruments[1] = ins;
+	csf->flags |= SONG_INSTRUMENTMODE;
+
+	for (o = 1; o < LENGTH_TEST_ORDERS; o++)
+		csf->orderlist[o] = ORDER_LAST;
+
+	row = csf->patterns[0] + 40 * MAX_CHANNELS + 8;
+	row[0 * MAX_CHANNELS].note = NOTE_FIRST + 60; /* C-5 */
+	row[0 * MAX_CHANNELS].instrument = 1;
+	row[1 * MAX_CHANNELS].note = NOTE_FIRST + 62; /* D-5, no instrument */
+	row[2 * MAX_CHANNELS].note = last_note;
+	row[3 * MAX_CHANNELS].instrument = 1;
+	row[3 * MAX_CHANNELS].effect = FX_TEMPO;
+	row[3 * MAX_CHANNELS].param = 0x20;
+
+	return csf;
+}
+
+static testresult_t length_test_playback(song_t *csf)
+{
+	uint32_t length, total = 0, s = 0, n;
+	uint8_t buf[4096];
+
+	length = csf_get_length(csf);
+
+	csf->mix_flags |= SNDMIX_DIRECTTODISK | SNDMIX_NOBACKWARDJUMPS;
+	csf_set_current_order(csf, 0);
+
+	do {
+		/* stop just past the start of each second, so that whatever is
+		 * playing at the start of it has been processed */
+		uint32_t want = MIN(sizeof(buf) / 4, s * csf->mix_frequency + 1 - total);
+
+		n = csf_read(csf, buf, want * 4);
+		total += n;
+
+		if (total == s * csf->mix_frequency + 1) {
+			uint32_t order, row;
+
+			csf_get_position_at(csf, s, &order, &row);
+			ASSERT_PRINTF(order == csf->current_order && row == csf->row,
+				"at %" PRIu32 " seconds: expected order %" PRIu32 " row %" PRIu32 ", got order %" PRIu32 " row %" PRIu32,
+				s, csf->current_order, csf->row, order, row);
+			s++;
+		}
+	} while (n && !(csf->flags & SONG_ENDREACHED));
+
+	ASSERT_PRINTF(length == (2 * total / csf->mix_frequency + 1) / 2,
+		"length is %" PRIu32 " seconds, but %" PRIu32 " samples were played", length, total);
+
+	RETURN_PASS;
+}
+
+/* The timing has to match what actually gets played, down to the row. */
+testresult_t test_song_length_playback(void)
+{
+	song_t *csf = length_test_song();
+	testresult_t r = length_test_playback(csf);
+
+	csf_free(csf);
+
+	return r;
+}
+
+/* The same, when the instrument-only row has to remember the note before
+ * it; that's ignored after a D-5, and not after a note-off. */
+testresult_t test_song_length_note_map(void)
+{
+	static const uint8_t last_notes[] = {NOTE_NONE, NOTE_OFF, NOTE_CUT, NOTE_FIRST + 50};
+	size_t i;
+
+	for (i = 0; i < ARRAY_SIZE(last_notes); i++) {
+		song_t *csf = length_test_note_map_song(last_notes[i]);
+		testresult_t r = length_test_playback(csf);
+
+		csf_free(csf);
+
+		if (r != SCHISM_TESTRESULT_PASS) {
+			test_log_printf("with note %d before the instrument\n", last_notes[i]);
+			return r;
+		}
+	}
+
+	RETURN_PASS;
+}
@@ -0,0 +1,240 @@
+/*
+ * Schism Tracker - a cross-platform Impulse Tracker clone
+ * copyright (c) 2003-2005 Storlek <storlek@rigelseven.com>
+ * copyright (c) 2005-2008 Mrs. Brisby <mrs.brisby@nimh.org>
+ * copyright (c) 2009 Storlek & Mrs. Brisby
+ * copyright (c) 2010-2012 Storlek
+ * URL: http://schismtracker.org/
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "headers.h"
+#include "test.h"
+#include "test-assertions.h"
+
+#include "it.h"
+#include "midi.h"
+#include "mt.h"
+#include "atomic.h"
+#include "timer.h"
+
+/* way more than the output ring can hold */
+#define MIDI_TEST_BURST 4096
+#define MIDI_TEST_MAX_RECEIVED (4 * MIDI_TEST_BURST)
+
+/* bytes per millisecond, as far as the ring is concerned */
+#define MIDI_TEST_SAMPLE_SIZE 4
+#define MIDI_TEST_RATE 44100
+#define MIDI_TEST_MIDIMS ((MIDI_TEST_SAMPLE_SIZE * MIDI_TEST_RATE + 999) / 1000)
+
+/* A port that keeps everything it's sent, and can be made to hang on to
+ * the first message it gets, which keeps the output thread from taking
+ * anything else off the ring until the test lets go. */
+static uint16_t midi_test_received[MIDI_TEST_MAX_RECEIVED];
+static struct atm midi_test_count;
+static struct atm midi_test_drained; /* what the count was at the last drain */
+static struct atm midi_test_hold;
+static struct atm midi_test_holding;
+static mt_mutex_t *midi_test_gate;
+
+static int midi_test_enable(SCHISM_UNUSED struct midi_port *p)
+{
+	return 1;
+}
+
+static int midi_test_disable(SCHISM_UNUSED struct midi_port *p)
+{
+	return 1;
+}
+
+static void midi_test_send(SCHISM_UNUSED struct midi_port *p, const unsigned char *seq, uint32_t len,
+	SCHISM_UNUSED uint32_t delay)
+{
+	uint32_t n;
+
+	if (atm_load(&midi_test_hold)) {
+		atm_store(&midi_test_holding, 1);
+		mt_mutex_lock(midi_test_gate);
+		mt_mutex_unlock(midi_test_gate);
+		atm_store(&midi_test_holding, 0);
+	}
+
+	n = atm_load(&midi_test_count);
+	if (len == 3 && n < MIDI_TEST_MAX_RECEIVED) {
+		midi_test_received[n] = seq[1] | (seq[2] << 7);
+		atm_store(&midi_test_count, n + 1);
+	}
+}
+
+static void midi_test_drain(SCHISM_UNUSED struct midi_port *p)
+{
+	atm_store(&midi_test_drained, atm_load(&midi_test_count));
+}
+
+/* messages are numbered so the order they come out in can be checked */
+static void midi_test_push(uint32_t n, uint32_t pos)
+{
+	unsigned char msg[3] = {0x90, n & 0x7F, (n >> 7) & 0x7F};
+
+	midi_send_buffer(msg, sizeof(msg), pos);
+}
+
+static int midi_test_wait(struct atm *a, uint32_t value)
+{
+	timer_ticks_t deadline = timer_ticks_us() + UINT64_C(5000000);
+
+	while ((uint32_t)atm_load(a) != value) {
+		if (timer_ticks_us() > deadline)
+			return 0;
+		timer_usleep(100);
+	}
+
+	return 1;
+}
+
+/* Holds the output thread on one message, pushes 'count' more behind it
+ * (the first 'late' of them due a millisecond from now, the rest right
+ * away), and lets go after 'wait' milliseconds. Returns zero if the output
+ * thread never got to the first message. */
+static int midi_test_push_held(uint32_t *sent, uint32_t count, uint32_t late, uint32_t wait)
+{
+	uint32_t i;
+	int ok;
+
+	mt_mutex_lock(midi_test_gate);
+	atm_store(&midi_test_hold, 1);
+
+	midi_test_push((*sent)++, 0);
+	ok = midi_test_wait(&midi_test_holding, 1);
+
+	for (i = 0; i < count; i++)
+		midi_test_push((*sent)++, (i < late) ? MIDI_TEST_MIDIMS : 0);
+
+	if (wait)
+		timer_msleep(wait);
+
+	atm_store(&midi_test_hold, 0);
+	mt_mutex_unlock(midi_test_gate);
+
+	return ok;
+}
+
+static testresult_t midi_test_ring(void)
+{
+	static const struct midi_driver driver = {
+		.flags = MIDI_PORT_CAN_SCHEDULE,
+		.enable = midi_test_enable,
+		.disable = midi_test_disable,
+		.send = midi_test_send,
+		.drain = midi_test_drain,
+	};
+	struct midi_provider *provider;
+	struct midi_port *port = NULL;
+	uint32_t dropped, late, prev_dropped = 0, sent = 0, received = 0, kept, capacity = 0, round, i;
+
+	provider = midi_provider_register("Test", &driver, NULL);
+	REQUIRE(provider);
+
+	midi_port_register(provider, MIDI_OUTPUT, "", NULL, NULL);
+	REQUIRE(midi_port_foreach(provider, &port));
+	port->io = MIDI_OUTPUT;
+	REQUIRE(midi_port_enable(port));
+
+	midi_queue_alloc(0, MIDI_TEST_SAMPLE_SIZE, MIDI_TEST_RATE);
+
+	/* Fill the ring up while nothing can be taken off it. The second round
+	 * starts where the first one left off, so it wraps around the end. */
+	for (round = 0; round < 2; round++) {
+		uint32_t first = sent;
+
+		REQUIRE_PRINTF(midi_test_push_held(&sent, MIDI_TEST_BURST, 0, 0),
+			"round %u: the output thread never picked anything up", round);
+
+		midi_get_output_stats(&dropped, &late);
+
+		/* whatever didn't fit has to be counted... */
+		ASSERT_PRINTF(dropped > prev_dropped && dropped - prev_dropped < MIDI_TEST_BURST,
+			"round %u: %u dropped", round, dropped - prev_dropped);
+
+		/* ...and the rest has to come out, in order, and the ring has to
+		 * hold just as much after wrapping around */
+		kept = sent - first - (dropped - prev_dropped);
+		if (!round)
+			capacity = kept;
+		ASSERT_PRINTF(kept == capacity, "round %u: ring held %u, not %u", round, kept, capacity);
+
+		received += kept;
+		REQUIRE_PRINTF(midi_test_wait(&midi_test_count, received),
+			"round %u: %u of %u messages came out", round, (uint32_t)atm_load(&midi_test_count), received);
+
+		for (i = 0; i < kept; i++)
+			ASSERT_PRINTF(midi_test_received[received - kept + i] == ((first + i) & 0x3FFF),
+				"round %u: message %u out of order", round, i);
+
+		ASSERT(late == 0);
+
+		prev_dropped = dropped;
+	}
+
+	/* one message that's due in a millisecond, but can't go out for ten */
+	REQUIRE(midi_test_push_held(&sent, 1, 1, 10));
+	received += 2;
+
+	REQUIRE(midi_test_wait(&midi_test_count, received));
+
+	midi_get_output_stats(&dropped, &late);
+	ASSERT_PRINTF(late == 1, "%u late", late);
+	ASSERT(dropped == prev_dropped);
+
+	/* anything still on the ring has to reach the port before it's drained */
+	for (i = 0; i < 64; i++)
+		midi_test_push(sent++, 0);
+	received += 64;
+
+	midi_send_flush();
+
+	ASSERT_PRINTF((uint32_t)atm_load(&midi_test_drained) == received,
+		"%u of %u messages sent before draining", (uint32_t)atm_load(&midi_test_drained), received);
+
+	RETURN_PASS;
+}
+
+/* Drives the output ring the player sends MIDI through, with a stub port
+ * in place of a real driver. */
+testresult_t test_midi_out_ring(void)
+{
+	testresult_t r;
+
+	atm_store(&midi_test_count, 0);
+	atm_store(&midi_test_drained, 0);
+	atm_store(&midi_test_hold, 0);
+	atm_store(&midi_test_holding, 0);
+
+	midi_test_gate = mt_mutex_create();
+	REQUIRE(midi_test_gate);
+
+	/* no IP MIDI */
+	status.flags |= NO_NETWORK;
+
+	REQUIRE(midi_engine_start());
+
+	r = midi_test_ring();
+
+	midi_engine_stop();
+	mt_mutex_delete(midi_test_gate);
+
+	return r;
+}
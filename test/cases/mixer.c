@@ -0,0 +1,1873 @@
+/*
+ * Schism Tracker - a cross-platform Impulse Tracker clone
+ * copyright (c) 2003-2005 Storlek <storlek@rigelseven.com>
+ * copyright (c) 2005-2008 Mrs. Brisby <mrs.brisby@nimh.org>
+ * copyright (c) 2009 Storlek & Mrs. Brisby
+ * copyright (c) 2010-2012 Storlek
+ * URL: http://schismtracker.org/
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "test.h"
+#include "test-assertions.h"
+
+#include "test-tempfile.h"
+#include "test-mixer.h"
+
+#include "player/sndfile.h"
+#include "player/cmixer.h"
+#include "player/fmopl.h"
+#include "disko.h"
+#include "fmt.h"
+#include "slurp.h"
+#include "dmoz.h"
+#include "song.h"
+#include "timer.h"
+#include "mt.h"
+
+#include <float.h>
+
+/* ------------------------------------------------------------------------ */
+/* a small synthetic song that keeps a decent number of voices busy */
+
+#define MIXER_TEST_RATE     48000
+#define MIXER_TEST_SECONDS  20
+#define MIXER_TEST_CHANNELS 16
+
+static void mixer_test_sample(song_sample_t *smp, uint32_t length, int is16, int stereo, uint32_t period)
+{
+	const int nch = stereo ? 2 : 1;
+	uint32_t i;
+	int c;
+
+	smp->data = csf_allocate_sample(length * nch * (is16 ? 2 : 1));
+	smp->length = length;
+	smp->flags = (is16 ? CHN_16BIT : 0) | (stereo ? CHN_STEREO : 0) | CHN_LOOP;
+	smp->loop_start = length / 4;
+	smp->loop_end = length;
+	smp->c5speed = 8363;
+	smp->volume = 256;
+	smp->global_volume = 64;
+
+	/* a triangle wave; there's no need to pull in libm for this */
+	for (i = 0; i < length; i++) {
+		for (c = 0; c < nch; c++) {
+			int32_t ph = (int32_t)(((i + c * period / 4) % period) * 4 * 32767 / period);
+			int32_t v = (ph < 2 * 32767) ? (ph - 32767) : (3 * 32767 - ph);
+
+			if (is16)
+				((int16_t *)smp->data)[i * nch + c] = v;
+			else
+				smp->data[i * nch + c] = v >> 8;
+		}
+	}
+
+	csf_adjust_sample_loop(smp);
+}
+
+static song_t *mixer_test_song(void)
+{
+	song_t *csf = csf_allocate();
+	uint32_t r, c;
+
+	mixer_test_sample(&csf->samples[1], 4000, 0, 0, 50);
+	mixer_test_sample(&csf->samples[2], 3000, 1, 0, 23);
+	mixer_test_sample(&csf->samples[3], 6000, 1, 1, 91);
+
+	csf->patterns[0] = csf_allocate_pattern(64);
+	csf->pattern_size[0] = csf->pattern_alloc_size[0] = 64;
+
+	for (r = 0; r < 64; r++) {
+		for (c = 0; c < MIXER_TEST_CHANNELS; c++) {
+			song_note_t *note = csf->patterns[0] + r * MAX_CHANNELS + c;
+
+			if ((r + c) % 4)
+				continue;
+
+			note->note = NOTE_FIRST + 24 + (r * 7 + c * 5) % 48;
+			note->instrument = 1 + c % 3;
+			note->voleffect = VOLFX_VOLUME;
+			note->volparam = 32 + c;
+		}
+	}
+
+	csf->orderlist[0] = 0;
+	csf->orderlist[1] = ORDER_LAST;
+
+	/* slow tempo, so the ticks are long enough for big blocks to matter */
+	csf->initial_speed = 3;
+	csf->initial_tempo = 32;
+	csf->initial_global_volume = 128;
+	csf->mixing_volume = 48;
+	csf->max_voices = MAX_VOICES;
+	csf->repeat_count = -1;
+
+	for (c = 0; c < MAX_CHANNELS; c++) {
+		csf->channels[c].panning = (c * 37) % 257;
+		csf->channels[c].volume = 64;
+	}
+
+	csf_set_wave_config(csf, MIXER_TEST_RATE, 16, 2);
+	csf_set_resampling_mode(csf, SRCMODE_SPLINE);
+	csf_set_current_order(csf, 0);
+	csf->mix_flags |= SNDMIX_DIRECTTODISK;
+
+	return csf;
+}
+
+song_t *mixer_test_one_note_song(const song_sample_t *smp, uint32_t mode)
+{
+	song_t *csf = csf_allocate();
+
+	csf->samples[1] = *smp;
+
+	csf->patterns[0] = csf_allocate_pattern(64);
+	csf->pattern_size[0] = csf->pattern_alloc_size[0] = 64;
+	csf->patterns[0][0].note = NOTE_FIRST + 60;
+	csf->patterns[0][0].instrument = 1;
+
+	csf->orderlist[0] = 0;
+	csf->orderlist[1] = ORDER_LAST;
+	csf->initial_speed = 6;
+	csf->initial_tempo = 125;
+	csf->initial_global_volume = 128;
+	csf->mixing_volume = 48;
+	csf->repeat_count = -1;
+	csf->channels[0].panning = 128;
+	csf->channels[0].volume = 64;
+
+	csf_set_wave_config(csf, MIXER_TEST_RATE, 16, 2);
+	csf_set_resampling_mode(csf, mode);
+	csf_set_current_order(csf, 0);
+	csf->mix_flags |= SNDMIX_DIRECTTODISK;
+
+	return csf;
+}
+
+/* renders the whole thing and returns a hash of the output */
+static uint32_t mixer_test_render(song_t *csf)
+{
+	uint8_t buf[16384];
+	uint32_t hash = 2166136261u, total = 0, n, i;
+
+	do {
+		n = csf_read(csf, buf, sizeof(buf));
+
+		for (i = 0; i < n * 4; i++) {
+			hash ^= buf[i];
+			hash *= 16777619u;
+		}
+
+		total += n;
+	} while (n && total < MIXER_TEST_RATE * MIXER_TEST_SECONDS);
+
+	return hash;
+}
+
+/* ------------------------------------------------------------------------ */
+
+/* the same, but with enough going on that state has to be carried over from
+ * one block to the next: NNAs, fadeouts, note-offs and cuts, volume slides
+ * (so, lots of ramps), a resonant filter, and a short ping-pong loop */
+static song_t *mixer_test_busy_song(void)
+{
+	song_t *csf = mixer_test_song();
+	song_sample_t *smp = &csf->samples[4];
+	uint32_t i, r, c;
+
+	mixer_test_sample(smp, 40, 1, 0, 13);
+	smp->flags |= CHN_PINGPONGLOOP;
+	smp->loop_start = 9;
+	csf_adjust_sample_loop(smp);
+
+	csf->flags |= SONG_INSTRUMENTMODE;
+	for (i = 1; i <= 4; i++) {
+		song_instrument_t *ins = csf_allocate_instrument();
+
+		csf_init_instrument(ins, i);
+		ins->nna = (i & 1) ? NNA_CONTINUE : NNA_NOTEFADE;
+		ins->fadeout = 128 * i;
+		if (i == 3) {
+			ins->ifc = 0x80 | 50;
+			ins->ifr = 0x80 | 90;
+		}
+		csf->instruments[i] = ins;
+	}
+
+	for (r = 0; r < 64; r++) {
+		for (c = 0; c < MIXER_TEST_CHANNELS; c++) {
+			song_note_t *note = csf->patterns[0] + r * MAX_CHANNELS + c;
+
+			memset(note, 0, sizeof(*note));
+
+			switch ((r * 3 + c) % 8) {
+			case 0:
+			case 4:
+				note->note = NOTE_FIRST + 24 + (r * 7 + c * 5) % 48;
+				note->instrument = 1 + (r + c) % 4;
+				note->voleffect = VOLFX_VOLUME;
+				note->volparam = 16 + (r + c * 3) % 48;
+				break;
+			case 2:
+				note->effect = FX_VOLUMESLIDE;
+				note->param = (c & 1) ? 0x30 : 0x06;
+				break;
+			case 5:
+				note->note = (c & 2) ? NOTE_OFF : NOTE_CUT;
+				break;
+			case 7:
+				note->effect = FX_SPECIAL;
+				note->param = 0xC1 + c % 2;
+				break;
+			}
+		}
+	}
+
+	csf_set_current_order(csf, 0);
+
+	return csf;
+}
+
+/* The block size is only a matter of how the work is split up, so a song
+ * with no voices stopping (the DC offset of a voice that stops is folded in
+ * at the end of the block, and that rounds) comes out the same at every
+ * size; this also logs the throughput for each size, for comparison. */
+testresult_t test_mixer_block_size(void)
+{
+	static const uint32_t sizes[] = {64, 256, MIXBUFFERSIZE, 2048, 8192};
+	uint32_t first_hash = 0;
+	size_t i;
+
+	for (i = 0; i < ARRAY_SIZE(sizes); i++) {
+		song_t *csf = mixer_test_song();
+		timer_ticks_t start, elapsed;
+		uint32_t hash;
+
+		REQUIRE(csf_set_mix_buffer_size(csf, sizes[i]));
+
+		start = timer_ticks_us();
+		hash = mixer_test_render(csf);
+		elapsed = timer_ticks_us() - start;
+
+		csf_free(csf);
+
+		test_log_printf("%5" PRIu32 " frames: %6" PRIu64 " us (%.1fx realtime)\n", sizes[i], (uint64_t)elapsed,
+			elapsed ? (MIXER_TEST_SECONDS * 1000000.0 / elapsed) : 0.0);
+
+		if (!i)
+			first_hash = hash;
+
+		ASSERT_PRINTF(hash == first_hash, "output differs with %" PRIu32 " frame blocks", sizes[i]);
+	}
+
+	RETURN_PASS;
+}
+
+/* ------------------------------------------------------------------------ */
+
+#define MIXER_TEST_SONGS 4
+
+struct mixer_test_job {
+	song_t *csf;
+	uint32_t hash;
+};
+
+static song_t *mixer_test_song_variant(uint32_t n)
+{
+	static const uint32_t freqs[4] = {200, 800, 2500, 9000};
+	uint32_t gains[4];
+	song_t *csf = mixer_test_song();
+	uint32_t i;
+
+	/* make each song's eq and master volume different, so that
+	 * any state shared between them shows up in the output */
+	for (i = 0; i < 4; i++)
+		gains[i] = (n * 7 + i * 13) % 40;
+
+	set_eq_gains(csf, gains, 4, freqs, 1, csf->mix_frequency);
+	csf->master_volume_left = 31 - n;
+	csf->master_volume_right = 20 + n;
+	csf->mix_flags &= ~SNDMIX_DIRECTTODISK;
+
+	return csf;
+}
+
+static int mixer_test_thread(void *userdata)
+{
+	struct mixer_test_job *job = userdata;
+
+	job->hash = mixer_test_render(job->csf);
+
+	return 0;
+}
+
+/* Songs don't share any render state, so rendering several of them at
+ * once must give the same output as rendering them one after another;
+ * that goes for when they have to share the voice mixing threads, too. */
+testresult_t test_mixer_concurrent_songs(void)
+{
+	static const uint32_t pool_sizes[] = {0, 4, 4, 3};
+	struct mixer_test_job jobs[MIXER_TEST_SONGS];
+	mt_thread_t *threads[MIXER_TEST_SONGS];
+	uint32_t expected[MIXER_TEST_SONGS];
+	uint32_t i, n;
+
+	for (i = 0; i < MIXER_TEST_SONGS; i++) {
+		song_t *csf = mixer_test_song_variant(i);
+
+		expected[i] = mixer_test_render(csf);
+		csf_free(csf);
+	}
+
+	for (n = 0; n < ARRAY_SIZE(pool_sizes); n++) {
+		/* the same size twice in a row keeps the threads it has */
+		REQUIRE(csf_set_mix_threads(pool_sizes[n]));
+
+		for (i = 0; i < MIXER_TEST_SONGS; i++) {
+			jobs[i].csf = mixer_test_song_variant(i);
+			jobs[i].hash = 0;
+		}
+
+		for (i = 0; i < MIXER_TEST_SONGS; i++) {
+			threads[i] = mt_thread_create(mixer_test_thread, "Mixer test thread", &jobs[i]);
+			if (!threads[i])
+				mixer_test_thread(&jobs[i]);
+		}
+
+		for (i = 0; i < MIXER_TEST_SONGS; i++) {
+			if (threads[i])
+				mt_thread_wait(threads[i], NULL);
+			csf_free(jobs[i].csf);
+		}
+
+		for (i = 0; i < MIXER_TEST_SONGS; i++)
+			ASSERT_PRINTF(jobs[i].hash == expected[i], "song %" PRIu32 " rendered differently on a thread"
+				" (%" PRIu32 " mixer threads)", i, pool_sizes[n]);
+	}
+
+	csf_set_mix_threads(0);
+
+	RETURN_PASS;
+}
+
+/* ------------------------------------------------------------------------ */
+
+static int mixer_test_filters_match(song_t *cached, song_t *direct, int32_t modifier)
+{
+	song_voice_t a = {0}, b = {0};
+	int32_t cutoff, resonance;
+
+	for (cutoff = 0; cutoff < 128; cutoff++) {
+		for (resonance = 0; resonance < 128; resonance++) {
+			a.cutoff = b.cutoff = cutoff;
+			a.resonance = b.resonance = resonance;
+
+			/* twice, so the second one comes out of the table */
+			setup_channel_filter(cached, &a, 1, modifier);
+			setup_channel_filter(cached, &a, 1, modifier);
+
+			/* and the other one always starts over with an empty one */
+			csf_free_filter_cache(direct);
+			setup_channel_filter(direct, &b, 1, modifier);
+
+			if (a.flags != b.flags || a.filter_a0 != b.filter_a0
+				|| a.filter_b0 != b.filter_b0 || a.filter_b1 != b.filter_b1) {
+				test_log_printf("cutoff %" PRId32 ", resonance %" PRId32 ", modifier %" PRId32 " at %" PRIu32 " Hz\n",
+					cutoff, resonance, modifier, cached->mix_frequency);
+				return 0;
+			}
+		}
+	}
+
+	return 1;
+}
+
+/* The filter coefficient table has to give exactly what working them
+ * out from scratch does, including after the mixing rate changes. It also
+ * shouldn't be allocated for songs that never use a filter. */
+testresult_t test_mixer_filter_cache(void)
+{
+	static const uint32_t rates[] = {MIXER_TEST_RATE, 22050, 192000, MIXER_TEST_RATE};
+	static const int32_t modifiers[] = {-256, -100, 0, 256};
+	song_t *cached = mixer_test_song();
+	song_t *direct = mixer_test_song();
+	size_t i, j;
+	int ok = 1;
+
+	mixer_test_render(direct);
+	REQUIRE(!direct->filter_cache);
+
+	for (i = 0; i < ARRAY_SIZE(rates) && ok; i++) {
+		csf_set_wave_config(cached, rates[i], 16, 2);
+		csf_set_wave_config(direct, rates[i], 16, 2);
+
+		for (j = 0; j < ARRAY_SIZE(modifiers) && ok; j++)
+			ok = mixer_test_filters_match(cached, direct, modifiers[j]);
+
+		ASSERT(cached->filter_cache);
+	}
+
+	csf_free(cached);
+	csf_free(direct);
+
+	ASSERT(ok);
+
+	RETURN_PASS;
+}
+
+/* ------------------------------------------------------------------------ */
+
+#define MIXER_TEST_EQ_BLOCKS 2000
+
+/* The x87 keeps more precision around than it's asked for, so there the C
+ * version can't be expected to match the SSE2 one to the bit; the outputs
+ * just have to be close (relative to the input's amplitude of 1 << 26). */
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD != 0
+# define MIXER_TEST_EQ_TOLERANCE ((1 << 26) / 10000.0)
+#else
+# define MIXER_TEST_EQ_TOLERANCE 0.0
+#endif
+
+static int mixer_test_eq_match(const int32_t *a, const int32_t *b, uint32_t count)
+{
+	uint32_t i;
+
+	if (MIXER_TEST_EQ_TOLERANCE == 0.0)
+		return !memcmp(a, b, count * sizeof(*a));
+
+	for (i = 0; i < count; i++)
+		if (fabs((double)a[i] - b[i]) > MIXER_TEST_EQ_TOLERANCE)
+			return 0;
+
+	return 1;
+}
+
+static int mixer_test_eq_match_float(const float *a, const float *b, uint32_t count)
+{
+	uint32_t i;
+
+	if (MIXER_TEST_EQ_TOLERANCE == 0.0)
+		return !memcmp(a, b, count * sizeof(*a));
+
+	for (i = 0; i < count; i++)
+		if (fabs((double)a[i] - b[i]) > MIXER_TEST_EQ_TOLERANCE * MIXING_FLOAT_SCALE)
+			return 0;
+
+	return 1;
+}
+
+/* the one-band-at-a-time loops of the plain C version; the fused SIMD one
+ * has to come out exactly the same */
+#define MIXER_TEST_EQ_REFERENCE(name, type) \
+	static void name(song_eq_band_t *bands, type *buffer, uint32_t count) \
+	{ \
+		uint32_t b, i; \
+	\
+		for (b = 0; b < MAX_EQ_BANDS * 2; b++) { \
+			song_eq_band_t *pbs = &bands[b]; \
+	\
+			if (!pbs->enabled || pbs->gain == 1.0f) \
+				continue; \
+	\
+			for (i = (b >= MAX_EQ_BANDS); i < count * 2; i += 2) { \
+				float x = buffer[i]; \
+				float y = pbs->a1 * pbs->x1 + pbs->a2 * pbs->x2 + pbs->a0 * x + pbs->b1 * pbs->y1 + pbs->b2 * pbs->y2; \
+	\
+				if (y > -FLT_MIN && y < FLT_MIN) \
+					y = 0.0f; \
+	\
+				pbs->x2 = pbs->x1; \
+				pbs->y2 = pbs->y1; \
+				pbs->x1 = x; \
+				pbs->y1 = y; \
+	\
+				buffer[i] = y; \
+			} \
+		} \
+	}
+
+MIXER_TEST_EQ_REFERENCE(mixer_test_eq_reference, int32_t)
+MIXER_TEST_EQ_REFERENCE(mixer_test_eq_reference_float, float)
+
+#undef MIXER_TEST_EQ_REFERENCE
+
+/* a couple of squares, with a gap of silence now and then that's long
+ * enough for the filters to decay all the way down to denormals */
+static void mixer_test_eq_input(int32_t *input, float *input_float, uint32_t block)
+{
+	uint32_t i;
+
+	for (i = 0; i < MIXBUFFERSIZE; i++) {
+		uint32_t t = block * MIXBUFFERSIZE + i;
+		int32_t v = (block % 64 < 40) ? (1 << 26) : 0;
+
+		input[i * 2] = (t / 37 % 2) ? v : -v;
+		input[i * 2 + 1] = (t / 301 % 2) ? v / 2 : -v / 2;
+		input_float[i * 2] = input[i * 2] * MIXING_FLOAT_SCALE;
+		input_float[i * 2 + 1] = input[i * 2 + 1] * MIXING_FLOAT_SCALE;
+	}
+}
+
+/* Checks eq_stereo and eq_stereo_float against the per-band loops, with an
+ * even and an odd number of bands (the SIMD version runs them in pairs). */
+testresult_t test_mixer_eq_stereo(void)
+{
+	static const uint32_t gains[][MAX_EQ_BANDS] = {
+		{30, 5, 0, 20, 40, 12},
+		{30, 5, 10, 20, 40, 12},
+		{0, 0, 25, 0, 0, 0},
+		{0, 8, 0, 50, 0, 3},
+	};
+	static const uint32_t freqs[MAX_EQ_BANDS] = {100, 400, 1000, 2500, 6000, 12000};
+	static int32_t input[MIXBUFFERSIZE * 2], fused[MIXBUFFERSIZE * 2], reference[MIXBUFFERSIZE * 2];
+	static float input_float[MIXBUFFERSIZE * 2], fused_float[MIXBUFFERSIZE * 2], reference_float[MIXBUFFERSIZE * 2];
+	song_eq_band_t bands[MAX_EQ_BANDS * 2], bands_float[MAX_EQ_BANDS * 2];
+	uint32_t g, block;
+
+	for (g = 0; g < ARRAY_SIZE(gains); g++) {
+		song_t *csf = mixer_test_song(), *csf_float = mixer_test_song();
+		int ok = 1, ok_float = 1;
+
+		set_eq_gains(csf, gains[g], MAX_EQ_BANDS, freqs, 1, csf->mix_frequency);
+		set_eq_gains(csf_float, gains[g], MAX_EQ_BANDS, freqs, 1, csf_float->mix_frequency);
+		memcpy(bands, csf->eq, sizeof(bands));
+		memcpy(bands_float, csf_float->eq, sizeof(bands_float));
+
+		for (block = 0; block < MIXER_TEST_EQ_BLOCKS && ok && ok_float; block++) {
+			mixer_test_eq_input(input, input_float, block);
+
+			memcpy(fused, input, sizeof(input));
+			memcpy(reference, input, sizeof(input));
+			eq_stereo(csf, fused, MIXBUFFERSIZE);
+			mixer_test_eq_reference(bands, reference, MIXBUFFERSIZE);
+			ok = mixer_test_eq_match(fused, reference, MIXBUFFERSIZE * 2);
+
+			memcpy(fused_float, input_float, sizeof(input_float));
+			memcpy(reference_float, input_float, sizeof(input_float));
+			eq_stereo_float(csf_float, fused_float, MIXBUFFERSIZE);
+			mixer_test_eq_reference_float(bands_float, reference_float, MIXBUFFERSIZE);
+			ok_float = mixer_test_eq_match_float(fused_float, reference_float, MIXBUFFERSIZE * 2);
+		}
+
+		csf_free(csf);
+		csf_free(csf_float);
+
+		ASSERT_PRINTF(ok, "integer EQ differs in block %" PRIu32 " with gain set %" PRIu32, block - 1, g);
+		ASSERT_PRINTF(ok_float, "float EQ differs in block %" PRIu32 " with gain set %" PRIu32, block - 1, g);
+	}
+
+	RETURN_PASS;
+}
+
+/* Logs how long eq_stereo and the per-band loops take to get through a few
+ * seconds of audio; test_mixer_eq_stereo checks that they agree. */
+testresult_t test_mixer_eq_stereo_speed(void)
+{
+	static const uint32_t gains[MAX_EQ_BANDS] = {30, 5, 0, 20, 40, 12};
+	static const uint32_t freqs[MAX_EQ_BANDS] = {100, 400, 1000, 2500, 6000, 12000};
+	static int32_t input[MIXBUFFERSIZE * 2], buffer[MIXBUFFERSIZE * 2];
+	static float input_float[MIXBUFFERSIZE * 2];
+	song_eq_band_t bands[MAX_EQ_BANDS * 2];
+	timer_ticks_t start, fused_us = 0, reference_us = 0;
+	song_t *csf = mixer_test_song();
+	uint32_t block;
+
+	set_eq_gains(csf, gains, MAX_EQ_BANDS, freqs, 1, csf->mix_frequency);
+	memcpy(bands, csf->eq, sizeof(bands));
+
+	for (block = 0; block < MIXER_TEST_EQ_BLOCKS; block++) {
+		mixer_test_eq_input(input, input_float, block);
+
+		memcpy(buffer, input, sizeof(input));
+		start = timer_ticks_us();
+		eq_stereo(csf, buffer, MIXBUFFERSIZE);
+		fused_us += timer_ticks_us() - start;
+
+		memcpy(buffer, input, sizeof(input));
+		start = timer_ticks_us();
+		mixer_test_eq_reference(bands, buffer, MIXBUFFERSIZE);
+		reference_us += timer_ticks_us() - start;
+	}
+
+	csf_free(csf);
+
+	test_log_printf("fused: %6" PRIu64 " us, per band: %6" PRIu64 " us\n",
+		(uint64_t)fused_us, (uint64_t)reference_us);
+
+	RETURN_PASS;
+}
+
+/* ------------------------------------------------------------------------ */
+
+/* the clip functions as they were before they got SIMD versions; the VU
+ * min/max only gets checked against the max if it wasn't a new min */
+static uint32_t mixer_test_clip_reference(int bits, void *ptr, const int32_t *ibuf, const float *fbuf,
+	uint32_t samples, int32_t *mins, int32_t *maxs)
+{
+	unsigned char *p = ptr;
+	uint32_t i;
+
+	for (i = 0; i < samples; i++) {
+		int32_t n;
+
+		if (fbuf) {
+			float f = CLAMP(fbuf[i], -1.0f, 1.0f);
+
+			n = CLAMP((int32_t)(f * (1.0f / MIXING_FLOAT_SCALE)), MIXING_CLIPMIN, MIXING_CLIPMAX);
+			memcpy(p + i * 4, &f, 4);
+		} else {
+			n = CLAMP(ibuf[i], MIXING_CLIPMIN, MIXING_CLIPMAX);
+		}
+
+		if (n < mins[i & 1])
+			mins[i & 1] = n;
+		else if (n > maxs[i & 1])
+			maxs[i & 1] = n;
+
+		if (fbuf)
+			continue;
+
+		switch (bits) {
+		case 8: p[i] = rshift_signed(n, 24 - MIXING_ATTENUATION) ^ 0x80; break;
+		case 16: { int16_t v = rshift_signed(n, 16 - MIXING_ATTENUATION); memcpy(p + i * 2, &v, 2); break; }
+		case 24: { int32_t v = rshift_signed(n, 8 - MIXING_ATTENUATION); memcpy(p + i * 3, &v, 3); break; }
+		case 32: { int32_t v = lshift_signed(n, MIXING_ATTENUATION); memcpy(p + i * 4, &v, 4); break; }
+		}
+	}
+
+	return samples * (fbuf ? 4 : bits / 8);
+}
+
+/* The clip functions have to give exactly the same output and VU min/max
+ * as they always have, for any length, and across calls. */
+testresult_t test_mixer_clip(void)
+{
+	static const int bits[] = {8, 16, 24, 32, 0 /* float */};
+	static const uint32_t lengths[] = {0, 1, 2, 5, 9, 31, 64, 1000};
+	static int32_t ibuf[1000];
+	static float fbuf[1000];
+	static unsigned char out[4000], expected[4000];
+	uint32_t seed = 1, i, j, k;
+
+	for (i = 0; i < ARRAY_SIZE(bits); i++) {
+		int32_t mins[2] = {0x7FFFFFFF, 0x7FFFFFFF}, maxs[2] = {-0x7FFFFFFF, -0x7FFFFFFF};
+		int32_t emins[2] = {0x7FFFFFFF, 0x7FFFFFFF}, emaxs[2] = {-0x7FFFFFFF, -0x7FFFFFFF};
+
+		for (j = 0; j < ARRAY_SIZE(lengths) * 3; j++) {
+			uint32_t len = lengths[j % ARRAY_SIZE(lengths)], bytes, ebytes;
+
+			for (k = 0; k < len; k++) {
+				seed = seed * 1103515245 + 12345;
+				/* twice the clipping range; the first one of each run goes
+				 * downhill for a bit, to check the min/max quirk */
+				ibuf[k] = (j % 3 == 0 && k < 8)
+					? (int32_t)(MIXING_CLIPMAX - k * 100000)
+					: (int32_t)(seed >> 4) - (1 << 27);
+				fbuf[k] = ibuf[k] * MIXING_FLOAT_SCALE;
+			}
+
+			if (j % 3 == 0) {
+				mins[0] = mins[1] = emins[0] = emins[1] = 0x7FFFFFFF;
+				maxs[0] = maxs[1] = emaxs[0] = emaxs[1] = -0x7FFFFFFF;
+			}
+
+			switch (bits[i]) {
+			case 8: bytes = clip_32_to_8(out, ibuf, len, mins, maxs); break;
+			case 16: bytes = clip_32_to_16(out, ibuf, len, mins, maxs); break;
+			case 24: bytes = clip_32_to_24(out, ibuf, len, mins, maxs); break;
+			case 32: bytes = clip_32_to_32(out, ibuf, len, mins, maxs); break;
+			default: bytes = clip_float_to_float(out, fbuf, len, mins, maxs); break;
+			}
+
+			ebytes = mixer_test_clip_reference(bits[i], expected, ibuf, bits[i] ? NULL : fbuf, len, emins, emaxs);
+
+			ASSERT_PRINTF(bytes == ebytes && !memcmp(out, expected, bytes),
+				"%d-bit output differs for %" PRIu32 " samples", bits[i], len);
+			ASSERT_PRINTF(mins[0] == emins[0] && mins[1] == emins[1] && maxs[0] == emaxs[0] && maxs[1] == emaxs[1],
+				"%d-bit min/max differs for %" PRIu32 " samples", bits[i], len);
+		}
+	}
+
+	RETURN_PASS;
+}
+
+/* ------------------------------------------------------------------------ */
+
+/* the scan over every voice that csf_get_nna_channel used to do */
+static uint32_t mixer_test_nna_reference(song_voice_t *voices, uint32_t count, uint32_t nchan)
+{
+	uint32_t i, result = 0, vol = 64 * 65536;
+	int envpos = 0xFFFFFF;
+
+	for (i = MAX_CHANNELS; i < count; i++) {
+		if (voices[i].length)
+			continue;
+		if ((voices[i].flags & CHN_MUTE) && !(voices[i].flags & CHN_NNAMUTE))
+			continue;
+		return i;
+	}
+
+	if (!voices[nchan].fadeout_volume)
+		return 0;
+
+	for (i = MAX_CHANNELS; i < count; i++) {
+		uint32_t v = voices[i].volume;
+
+		if (!voices[i].fadeout_volume)
+			return i;
+
+		if (voices[i].flags & CHN_NOTEFADE)
+			v = v * voices[i].fadeout_volume;
+		else
+			v <<= 16;
+		if (voices[i].flags & CHN_LOOP)
+			v >>= 1;
+		if (v < vol || (v == vol && voices[i].vol_env_position > envpos)) {
+			envpos = voices[i].vol_env_position;
+			vol = v;
+			result = i;
+		}
+	}
+
+	return result;
+}
+
+/* the test song, with a note on every row and instruments that let the
+ * old notes keep playing */
+static song_t *mixer_test_nna_song(uint32_t voices)
+{
+	song_t *csf = mixer_test_song();
+	uint32_t i, r, c;
+
+	csf_set_voice_count(csf, voices);
+
+	csf->flags |= SONG_INSTRUMENTMODE;
+	for (i = 1; i <= 3; i++) {
+		song_instrument_t *ins = csf_allocate_instrument();
+
+		csf_init_instrument(ins, i);
+		ins->nna = (i == 2) ? NNA_NOTEFADE : NNA_CONTINUE;
+		ins->fadeout = 64;
+		csf->instruments[i] = ins;
+	}
+
+	for (r = 0; r < 64; r++) {
+		for (c = 0; c < MIXER_TEST_CHANNELS; c++) {
+			song_note_t *note = csf->patterns[0] + r * MAX_CHANNELS + c;
+
+			note->note = NOTE_FIRST + 24 + (r * 7 + c * 5) % 48;
+			note->instrument = 1 + (r + c) % 3;
+		}
+	}
+
+	csf_set_current_order(csf, 0);
+
+	return csf;
+}
+
+/* plays until every voice is in use, checking the voice bookkeeping as it goes */
+static int mixer_test_nna_play(song_t *csf)
+{
+	static song_voice_t saved[MAX_VOICES];
+	static uint32_t busy[MAX_VOICES / 32];
+	uint8_t buf[1024];
+	uint32_t total = 0, n, i, c;
+	int full = 0;
+
+	do {
+		n = csf_read(csf, buf, sizeof(buf) / 4);
+		total += n;
+
+		for (i = MAX_CHANNELS; i < csf->voice_count; i++) {
+			if ((csf->voices[i].length || (csf->voices[i].flags & CHN_ADLIB))
+				&& !BITARRAY_ISSET(csf->busy_voices, i)) {
+				test_log_printf("voice %" PRIu32 " is playing, but isn't marked busy\n", i);
+				return 0;
+			}
+		}
+
+		for (c = 0; c < MIXER_TEST_CHANNELS; c++) {
+			uint32_t expect, got;
+
+			memcpy(saved, csf->voices, csf->voice_count * sizeof(*saved));
+			memcpy(busy, csf->busy_voices, (csf->voice_count + 31) / 32 * sizeof(*busy));
+
+			expect = mixer_test_nna_reference(saved, csf->voice_count, c);
+			got = csf_get_nna_channel(csf, c);
+
+			memcpy(csf->voices, saved, csf->voice_count * sizeof(*saved));
+			memcpy(csf->busy_voices, busy, (csf->voice_count + 31) / 32 * sizeof(*busy));
+
+			if (got != expect) {
+				test_log_printf("channel %" PRIu32 ": got voice %" PRIu32 ", expected %" PRIu32 "\n", c, got, expect);
+				return 0;
+			}
+		}
+
+		if (csf->voices[csf->voice_count - 1].length)
+			full = 1;
+	} while (!full && n && total < MIXER_TEST_RATE * 20);
+
+	if (!full)
+		test_log_printf("never used all %" PRIu32 " voices\n", csf->voice_count);
+
+	return full;
+}
+
+/* NNA voices are only tracked while they're marked busy, so every voice
+ * that's still playing has to be marked, and the voice picked for a new
+ * note has to be the same one the full scan would pick. The song is dense
+ * enough to use up all of the voices, so stealing gets tested too. */
+testresult_t test_mixer_nna_voices(void)
+{
+	static const uint32_t counts[] = {MAX_CHANNELS + 40, DEFAULT_VOICES, DEFAULT_VOICES + 72};
+	size_t i;
+
+	for (i = 0; i < ARRAY_SIZE(counts); i++) {
+		song_t *csf = mixer_test_nna_song(counts[i]);
+		int ok = mixer_test_nna_play(csf);
+
+		csf_free(csf);
+
+		ASSERT_PRINTF(ok, "with %" PRIu32 " voices", counts[i]);
+	}
+
+	RETURN_PASS;
+}
+
+/* Changing the number of voices keeps the ones that still fit, and
+ * the song keeps playing fine afterwards. */
+testresult_t test_mixer_voice_count(void)
+{
+	static song_voice_t saved[MAX_CHANNELS + 40];
+	song_t *csf = mixer_test_nna_song(DEFAULT_VOICES);
+	uint32_t i, busy = 0, stale = 0;
+	int ok;
+
+	REQUIRE(mixer_test_nna_play(csf));
+
+	memcpy(saved, csf->voices, sizeof(saved));
+	csf_set_voice_count(csf, ARRAY_SIZE(saved));
+
+	ASSERT(csf->voice_count == ARRAY_SIZE(saved));
+	ASSERT(!memcmp(saved, csf->voices, sizeof(saved)));
+
+	for (i = 0; i < (csf->voice_count + 31) / 32; i++)
+		busy |= csf->busy_voices[i];
+	for (i = 0; i < csf->num_voices; i++)
+		stale |= (csf->voice_mix[i] >= csf->voice_count);
+
+	ASSERT(busy);
+	ASSERT(!stale);
+
+	ok = mixer_test_nna_play(csf);
+	csf_set_voice_count(csf, MAX_VOICES * 2);
+	ASSERT(csf->voice_count == MAX_VOICES);
+	csf_set_voice_count(csf, 0);
+	ASSERT(csf->voice_count == MAX_CHANNELS);
+
+	/* the mixing limit can't be more than there are voices */
+	csf->max_voices = MAX_VOICES;
+	csf_init_player(csf, 0);
+	ASSERT(csf->max_voices == csf->voice_count);
+
+	csf_free(csf);
+
+	ASSERT(ok);
+
+	RETURN_PASS;
+}
+
+/* ------------------------------------------------------------------------ */
+
+/* Plays the dense song with as many voices as there can be, and logs how
+ * long each voice takes to mix. */
+testresult_t test_mixer_many_voices(void)
+{
+	song_t *csf = mixer_test_nna_song(MAX_VOICES);
+	uint8_t buf[4096];
+	uint64_t voice_frames = 0;
+	uint32_t total = 0, most = 0, n;
+	timer_ticks_t start, elapsed;
+
+	start = timer_ticks_us();
+	do {
+		n = csf_read(csf, buf, sizeof(buf) / 4);
+		voice_frames += (uint64_t)n * csf->num_voices;
+		most = MAX(most, csf->num_voices);
+		total += n;
+	} while (n && total < MIXER_TEST_RATE * MIXER_TEST_SECONDS);
+	elapsed = timer_ticks_us() - start;
+
+	test_log_printf("%" PRIu32 " voices at most: %" PRIu64 " us, %.2f ns per voice per frame\n",
+		most, (uint64_t)elapsed, voice_frames ? (elapsed * 1000.0 / voice_frames) : 0.0);
+
+	csf_free(csf);
+
+	ASSERT_PRINTF(most > DEFAULT_VOICES, "only got to %" PRIu32 " voices", most);
+
+	RETURN_PASS;
+}
+
+/* ------------------------------------------------------------------------ */
+
+/* one note of an 8-sample looped waveform, played at the given speed;
+ * returns the RMS of the left channel once it's settled */
+static double mixer_test_tone_rms(const int16_t *wave, uint32_t c5speed, uint32_t mode)
+{
+	song_sample_t smp = {0};
+	song_t *csf;
+	int16_t buf[2048 * 2];
+	double sum = 0.0;
+	uint32_t total = 0, count = 0, n, i;
+
+	smp.data = csf_allocate_sample(4096 * 2);
+	smp.length = 4096;
+	smp.flags = CHN_16BIT | CHN_LOOP;
+	smp.loop_start = 0;
+	smp.loop_end = 4096;
+	smp.c5speed = c5speed;
+	smp.volume = 256;
+	smp.global_volume = 64;
+	for (i = 0; i < smp.length; i++)
+		((int16_t *)smp.data)[i] = wave[i % 8];
+	csf_adjust_sample_loop(&smp);
+
+	csf = mixer_test_one_note_song(&smp, mode);
+
+	do {
+		n = csf_read(csf, buf, ARRAY_SIZE(buf) / 2);
+
+		/* skip the attack */
+		for (i = 0; i < n; i++) {
+			if (total + i < MIXER_TEST_RATE / 10)
+				continue;
+
+			sum += (double)buf[i * 2] * buf[i * 2];
+			count++;
+		}
+
+		total += n;
+	} while (n && total < MIXER_TEST_RATE / 2);
+
+	csf_free(csf);
+
+	return count ? sqrt(sum / count) : 0.0;
+}
+
+/* A tone at 3/4 of the sample's nyquist frequency, played at twice the
+ * mixing rate, is above the output's nyquist frequency, so it should be
+ * (mostly) filtered out instead of aliasing. One at 1/4 of nyquist has to
+ * come through just as loud as with the FIR. This also logs how long the
+ * FIR and sinc modes take to play the usual test song. */
+testresult_t test_mixer_sinc(void)
+{
+	static const int16_t low[8] = {0, 21213, 30000, 21213, 0, -21213, -30000, -21213};
+	static const int16_t high[8] = {0, 21213, -30000, 21213, 0, -21213, 30000, -21213};
+	static const uint32_t modes[] = {SRCMODE_POLYPHASE, SRCMODE_SINC};
+	double fir_high, sinc_high, fir_low, sinc_low;
+	size_t i;
+
+	fir_high = mixer_test_tone_rms(high, 2 * MIXER_TEST_RATE, SRCMODE_POLYPHASE);
+	sinc_high = mixer_test_tone_rms(high, 2 * MIXER_TEST_RATE, SRCMODE_SINC);
+	fir_low = mixer_test_tone_rms(low, 2 * MIXER_TEST_RATE, SRCMODE_POLYPHASE);
+	sinc_low = mixer_test_tone_rms(low, 2 * MIXER_TEST_RATE, SRCMODE_SINC);
+
+	test_log_printf("aliased tone: FIR %.1f, sinc %.1f; passed tone: FIR %.1f, sinc %.1f\n",
+		fir_high, sinc_high, fir_low, sinc_low);
+
+	REQUIRE(fir_low > 1000.0);
+	ASSERT_PRINTF(sinc_high * 100.0 < fir_high, "sinc only got rid of %.1f of %.1f", fir_high - sinc_high, fir_high);
+	ASSERT_PRINTF(sinc_low > fir_low * 0.9 && sinc_low < fir_low * 1.1, "sinc %.1f, FIR %.1f", sinc_low, fir_low);
+
+	for (i = 0; i < ARRAY_SIZE(modes); i++) {
+		song_t *csf = mixer_test_song();
+		timer_ticks_t start, elapsed;
+
+		csf_set_resampling_mode(csf, modes[i]);
+
+		start = timer_ticks_us();
+		mixer_test_render(csf);
+		elapsed = timer_ticks_us() - start;
+
+		csf_free(csf);
+
+		test_log_printf("%s: %" PRIu64 " us\n", (modes[i] == SRCMODE_SINC) ? "sinc" : "FIR", (uint64_t)elapsed);
+	}
+
+	RETURN_PASS;
+}
+
+/* ------------------------------------------------------------------------ */
+
+/* Silent voices are only moved ahead, so they have to end up in exactly the
+ * same place as an audible voice playing the same thing does. Voice 0 is
+ * silent, voice 1 is barely audible and gets mixed the long way. */
+testresult_t test_mixer_silent_voices(void)
+{
+	static const struct {
+		uint32_t sample, flags;
+		int32_t whole;
+		uint32_t frac;
+	} cases[] = {
+		{2, CHN_LOOP, 0, 0x9A3D2E11},
+		{2, CHN_LOOP, 3, 0x10000000},
+		{4, CHN_LOOP, 1, 0x7FFFFFFF},
+		{4, CHN_LOOP, 17, 0},
+		{2, 0, 2, 0x12345678},
+		{5, CHN_LOOP | CHN_PINGPONGLOOP, 1, 0x40000000},
+	};
+	static const uint32_t counts[] = {1, 77, 512, 300, 2, 511};
+	song_t *csf = mixer_test_song();
+	uint32_t skipped = 0;
+	size_t i, j;
+
+	/* a chip-style single-cycle loop, and a ping-pong loop */
+	mixer_test_sample(&csf->samples[4], 32, 1, 0, 32);
+	mixer_test_sample(&csf->samples[5], 3000, 1, 0, 23);
+	csf->samples[5].flags |= CHN_PINGPONGLOOP;
+	csf_adjust_sample_loop(&csf->samples[5]);
+
+	for (i = 0; i < ARRAY_SIZE(cases); i++) {
+		song_sample_t *smp = &csf->samples[cases[i].sample];
+		uint32_t v;
+
+		for (v = 0; v < 2; v++) {
+			song_voice_t *voice = &csf->voices[v];
+
+			memset(voice, 0, sizeof(*voice));
+			voice->ptr_sample = smp;
+			voice->current_sample_data = smp->data;
+			voice->flags = CHN_16BIT | cases[i].flags;
+			voice->length = smp->length;
+			voice->loop_start = smp->loop_start;
+			voice->loop_end = smp->loop_end;
+			voice->increment = csf_smp_pos(cases[i].whole, cases[i].frac);
+			voice->position = csf_smp_pos(7, 0x55555555);
+			voice->left_volume = voice->right_volume = v;
+			voice->left_volume_new = voice->right_volume_new = v;
+			csf->voice_mix[v] = v;
+		}
+
+		csf->num_voices = 2;
+		csf->mix_skipped = 0;
+
+		for (j = 0; j < 40 * ARRAY_SIZE(counts); j++) {
+			csf_create_stereo_mix(csf, counts[j % ARRAY_SIZE(counts)]);
+
+			ASSERT_PRINTF(csf_smp_pos_equ(csf->voices[0].position, csf->voices[1].position)
+				&& csf->voices[0].length == csf->voices[1].length,
+				"case %u, block %u: silent voice at %" PRId64 ", audible one at %" PRId64,
+				(unsigned int)i, (unsigned int)j, csf_smp_pos_get_full(csf->voices[0].position),
+				csf_smp_pos_get_full(csf->voices[1].position));
+		}
+
+		/* the non-looping one runs out and stops */
+		if (!cases[i].flags)
+			ASSERT(!csf->voices[0].length);
+
+		skipped += csf->mix_skipped;
+	}
+
+	/* A filtered voice that fades out and comes back is never skipped: the
+	 * resonant filter runs before the volume is applied, so only the full
+	 * mixer knows what to do with its history. It still has to keep up with
+	 * one that's audible all along. */
+	for (i = 0; i < 2; i++) {
+		song_voice_t *voice = &csf->voices[i];
+
+		memset(voice, 0, sizeof(*voice));
+		voice->ptr_sample = &csf->samples[2];
+		voice->current_sample_data = csf->samples[2].data;
+		voice->flags = CHN_16BIT | CHN_LOOP | CHN_FILTER;
+		voice->length = csf->samples[2].length;
+		voice->loop_start = csf->samples[2].loop_start;
+		voice->loop_end = csf->samples[2].loop_end;
+		voice->increment = csf_smp_pos(1, 0x2468ACE0);
+		voice->filter_a0 = 1 << 22;
+		voice->filter_b0 = 1 << 23;
+		voice->filter_b1 = -(1 << 21);
+		csf->voice_mix[i] = i;
+	}
+
+	csf->num_voices = 2;
+	csf->mix_skipped = 0;
+
+	for (j = 0; j < 30; j++) {
+		for (i = 0; i < 2; i++) {
+			song_voice_t *voice = &csf->voices[i];
+			const int32_t vol = (i && j >= 10 && j < 20) ? 0 : 64;
+
+			voice->left_volume = voice->right_volume = vol;
+			voice->left_volume_new = voice->right_volume_new = vol;
+		}
+
+		csf_create_stereo_mix(csf, counts[j % ARRAY_SIZE(counts)]);
+
+		ASSERT_PRINTF(csf_smp_pos_equ(csf->voices[0].position, csf->voices[1].position),
+			"filtered voice, block %u: at %" PRId64 " after fading out, %" PRId64 " all along",
+			(unsigned int)j, csf_smp_pos_get_full(csf->voices[1].position),
+			csf_smp_pos_get_full(csf->voices[0].position));
+	}
+
+	ASSERT_PRINTF(!csf->mix_skipped, "skipped %" PRIu32 " filtered voices", csf->mix_skipped);
+
+	csf_free(csf);
+
+	ASSERT_PRINTF(skipped > 0, "skipped %" PRIu32 " voices", skipped);
+
+	RETURN_PASS;
+}
+
+/* ------------------------------------------------------------------------ */
+
+/* plays one note of sample 1 and returns a hash of the output */
+static uint32_t mixer_test_loop_render(song_sample_t *smp, uint32_t mode, uint32_t frames, timer_ticks_t *elapsed)
+{
+	song_t *csf = mixer_test_one_note_song(smp, mode);
+	int16_t buf[1024 * 2];
+	uint32_t hash = 2166136261u, total = 0, n, i;
+	timer_ticks_t start;
+
+	csf->patterns[0][32 * MAX_CHANNELS].effect = FX_PORTAMENTOUP;
+	csf->patterns[0][32 * MAX_CHANNELS].param = 0xF1;
+
+	start = timer_ticks_us();
+	do {
+		n = csf_read(csf, buf, ARRAY_SIZE(buf) / 2);
+
+		for (i = 0; i < n * 2; i++) {
+			hash ^= (uint16_t)buf[i];
+			hash *= 16777619u;
+		}
+
+		total += n;
+	} while (n && total < frames);
+	*elapsed = timer_ticks_us() - start;
+
+	/* don't free the sample data, it's not ours */
+	memset(&csf->samples[1], 0, sizeof(csf->samples[1]));
+	csf_free(csf);
+
+	return hash;
+}
+
+/* Short loops are played from an unrolled copy. That has to sound exactly
+ * the same as a long loop with the same waveform repeated over and over,
+ * which gets played straight from the sample data. (Loops that are shorter
+ * than two lookahead buffers read from the end of the loop even the first
+ * time through, so those wouldn't sound the same to begin with.) */
+testresult_t test_mixer_unrolled_loops(void)
+{
+	static const uint32_t periods[] = {2 * MAX_INTERPOLATION_LOOKAHEAD_BUFFER_SIZE, 45, 100, MAX_UNROLLED_LOOP_LENGTH};
+	song_sample_t smp_short, smp_long;
+	size_t i;
+	uint32_t mode;
+
+	for (i = 0; i < ARRAY_SIZE(periods); i++) {
+		for (mode = 0; mode < NUM_SRC_MODES; mode++) {
+			timer_ticks_t short_time, long_time;
+			uint32_t short_hash, long_hash;
+
+			/* the loop starts at the beginning, so there's nothing in
+			 * front of it that'd be played the first time around */
+			memset(&smp_short, 0, sizeof(smp_short));
+			mixer_test_sample(&smp_short, periods[i], 1, 1, periods[i]);
+			smp_short.loop_start = 0;
+			smp_short.c5speed = 8363 * 5 / 3;
+			csf_adjust_sample_loop(&smp_short);
+
+			memset(&smp_long, 0, sizeof(smp_long));
+			mixer_test_sample(&smp_long, periods[i] * (MAX_UNROLLED_LOOP_LENGTH * 8 / periods[i] + 1), 1, 1, periods[i]);
+			smp_long.loop_start = 0;
+			smp_long.c5speed = smp_short.c5speed;
+			csf_adjust_sample_loop(&smp_long);
+
+			short_hash = mixer_test_loop_render(&smp_short, mode, MIXER_TEST_RATE * 4, &short_time);
+			long_hash = mixer_test_loop_render(&smp_long, mode, MIXER_TEST_RATE * 4, &long_time);
+
+			csf_free_sample(smp_short.data);
+			csf_free_sample(smp_long.data);
+
+			test_log_printf("%" PRIu32 "-point loop, mode %" PRIu32 ": %" PRIu64 " us, long loop %" PRIu64 " us\n",
+				periods[i], mode, (uint64_t)short_time, (uint64_t)long_time);
+
+			ASSERT_PRINTF(short_hash == long_hash, "%" PRIu32 "-point loop, mode %" PRIu32, periods[i], mode);
+		}
+	}
+
+	RETURN_PASS;
+}
+
+/* ------------------------------------------------------------------------ */
+
+#define MIXER_TEST_OPL_RATE 49716
+
+/* resamples a 1 kHz sine in uneven chunks, and returns how far off from the
+ * real thing the output ever gets, relative to the amplitude */
+static double mixer_test_stream_error(uint32_t out_rate)
+{
+	const double amplitude = 1 << 24, w = 2.0 * M_PI * 1000.0;
+	stream_resampler_t rs = {0};
+	int32_t out[1024 * 2];
+	uint64_t in_pos = 0;
+	uint32_t total = 0, count, frames, i;
+	double error = 0.0;
+
+	stream_resampler_init(&rs, MIXER_TEST_OPL_RATE, out_rate);
+
+	for (count = 100; total < out_rate / 2; count = (count * 7 + 13) % 1000 + 1) {
+		int32_t *in = stream_resampler_get_input(&rs, count, &frames);
+
+		for (i = 0; i < frames; i++, in_pos++)
+			in[i * 2] = in[i * 2 + 1] = (int32_t)(amplitude * sin(w * in_pos / MIXER_TEST_OPL_RATE));
+
+		memset(out, 0, count * 2 * sizeof(int32_t));
+		stream_resampler_mix(&rs, out, count);
+
+		/* skip the start, where the history is still silent */
+		for (i = 0; i < count; i++) {
+			if (total + i < 64)
+				continue;
+
+			error = MAX(error, fabs(out[i * 2] - amplitude * sin(w * (total + i) / out_rate)));
+			error = MAX(error, (double)llabs((long long)out[i * 2 + 1] - out[i * 2]));
+		}
+
+		total += count;
+	}
+
+	stream_resampler_free(&rs);
+
+	return error / amplitude;
+}
+
+/* an AdLib chord, mixed either way */
+static song_t *mixer_test_opl_song(uint32_t rate, int native)
+{
+	song_t *csf = csf_allocate();
+	uint32_t i;
+
+	csf->patterns[0] = csf_allocate_pattern(64);
+	csf->pattern_size[0] = csf->pattern_alloc_size[0] = 64;
+
+	for (i = 0; i < 6; i++) {
+		song_sample_t *smp = &csf->samples[i + 1];
+
+		adlib_patch_apply(smp, i * 8);
+		smp->c5speed = 8363;
+		smp->volume = 256;
+		smp->global_volume = 64;
+
+		csf->patterns[0][i].note = NOTE_FIRST + 48 + i * 4;
+		csf->patterns[0][i].instrument = i + 1;
+		csf->channels[i].panning = 128;
+		csf->channels[i].volume = 64;
+	}
+
+	csf->orderlist[0] = 0;
+	csf->orderlist[1] = ORDER_LAST;
+	csf->initial_speed = 6;
+	csf->initial_tempo = 125;
+	csf->initial_global_volume = 128;
+	csf->mixing_volume = 48;
+	csf->repeat_count = -1;
+
+	if (native)
+		csf->mix_flags |= SNDMIX_NATIVEOPL;
+
+	csf_set_wave_config(csf, rate, 16, 2);
+	csf_set_current_order(csf, 0);
+	csf->mix_flags |= SNDMIX_DIRECTTODISK;
+
+	return csf;
+}
+
+/* returns the RMS of the left channel, after the attack */
+static double mixer_test_opl_rms(uint32_t rate, int native, timer_ticks_t *elapsed)
+{
+	song_t *csf = mixer_test_opl_song(rate, native);
+	int16_t buf[2048 * 2];
+	double sum = 0.0;
+	uint32_t total = 0, count = 0, n, i;
+	timer_ticks_t start = timer_ticks_us();
+
+	do {
+		n = csf_read(csf, buf, ARRAY_SIZE(buf) / 2);
+
+		for (i = 0; i < n; i++) {
+			if (total + i < rate / 10)
+				continue;
+
+			sum += (double)buf[i * 2] * buf[i * 2];
+			count++;
+		}
+
+		total += n;
+	} while (n && total < rate * 4);
+
+	*elapsed = timer_ticks_us() - start;
+
+	csf_free(csf);
+
+	return count ? sqrt(sum / count) : 0.0;
+}
+
+/* The stream resampler has to reproduce a tone that's well within the
+ * passband, going up or down (by a lot, too), and the OPL run at its own
+ * rate has to sound about as loud as one that runs at the mixing rate.
+ * This also logs how long either takes at a high mixing rate. */
+testresult_t test_mixer_native_opl(void)
+{
+	static const uint32_t rates[] = {22050, 48000, 96000, 192000};
+	double direct, native;
+	timer_ticks_t t_direct, t_native;
+	size_t i;
+
+	for (i = 0; i < ARRAY_SIZE(rates); i++) {
+		double error = mixer_test_stream_error(rates[i]);
+
+		test_log_printf("%" PRIu32 " Hz: error %g\n", rates[i], error);
+		ASSERT_PRINTF(error < 0.001, "%" PRIu32 " Hz is off by %g", rates[i], error);
+	}
+
+	for (i = 0; i < ARRAY_SIZE(rates); i++) {
+		direct = mixer_test_opl_rms(rates[i], 0, &t_direct);
+		native = mixer_test_opl_rms(rates[i], 1, &t_native);
+
+		test_log_printf("%" PRIu32 " Hz: direct %.1f in %" PRIu64 " us, native %.1f in %" PRIu64 " us\n",
+			rates[i], direct, (uint64_t)t_direct, native, (uint64_t)t_native);
+
+		REQUIRE(direct > 1000.0);
+		ASSERT_PRINTF(native > direct * 0.9 && native < direct * 1.1, "native %.1f, direct %.1f", native, direct);
+	}
+
+	RETURN_PASS;
+}
+
+/* Rendering a pattern into a sample mixes a copy of the current song at the
+ * export rate (44.1 kHz, by default). The copy's OPL resamplers have to be
+ * its own, or the live song would go on playing at the wrong rate. */
+testresult_t test_mixer_export_native_opl(void)
+{
+	song_t *csf = mixer_test_opl_song(22050, 1);
+	stream_resampler_t expected = {0};
+	struct stream_resampler *live = csf->opl_resampler;
+	int r, ok;
+
+	REQUIRE(live);
+
+	stream_resampler_init(&expected, MIXER_TEST_OPL_RATE, 22050);
+
+	current_song = csf;
+	r = disko_writeout_sample(10, 0, 0);
+	current_song = NULL;
+
+	ok = (csf->opl_resampler == live)
+		&& !memcmp(&live[0].increment, &expected.increment, sizeof(expected.increment));
+
+	stream_resampler_free(&expected);
+	csf_free(csf);
+
+	ASSERT(r == DW_OK);
+	ASSERT(ok);
+
+	RETURN_PASS;
+}
+
+/* ------------------------------------------------------------------------ */
+
+#if OPLSOURCE == 3
+
+#define MIXER_TEST_OPL3_SPANS 3000
+
+static void mixer_test_opl3_write(void *chip, uint32_t reg, uint32_t value)
+{
+	ymf262_write(chip, (reg >> 8) ? 2 : 0, reg & 0xFF);
+	ymf262_write(chip, 1, value);
+}
+
+/* Plays a random register script (4-op, rhythm, key on/off, and everything
+ * the operators have) through the chip, calling ymf262_update_multi with at
+ * most `chunk` samples at a time, and returns a hash of each channel's
+ * output and VU values. */
+static uint32_t mixer_test_opl3_render(int chunk)
+{
+	static const uint16_t op_regs[] = {0x20, 0x40, 0x60, 0x80, 0xE0};
+	static int32_t out[OPL_CHANNELS][512 * 2];
+	int32_t *buffers[OPL_CHANNELS];
+	uint32_t vu_max[OPL_CHANNELS];
+	uint32_t hash = 2166136261u, seed = 1, span, i, c;
+	void *chip = ymf262_init(MIXER_TEST_OPL_RATE * 288, MIXER_TEST_OPL_RATE);
+
+	if (!chip)
+		return 0;
+
+	ymf262_reset_chip(chip);
+	mixer_test_opl3_write(chip, 0x105, 0x01); /* OPL3 mode */
+	mixer_test_opl3_write(chip, 0x001, 0x20); /* waveform select */
+
+	/* start off with something audible on every operator */
+	for (i = 0; i < 0x200; i += 0x100) {
+		for (c = 0; c < 0x16; c++) {
+			if ((c & 7) >= 6)
+				continue;
+
+			mixer_test_opl3_write(chip, i + 0x20 + c, 0x21);
+			mixer_test_opl3_write(chip, i + 0x40 + c, 0x08);
+			mixer_test_opl3_write(chip, i + 0x60 + c, 0xF4);
+			mixer_test_opl3_write(chip, i + 0x80 + c, 0x36);
+		}
+
+		for (c = 0; c < 9; c++) {
+			mixer_test_opl3_write(chip, i + 0xA0 + c, 0x40 + c * 16);
+			mixer_test_opl3_write(chip, i + 0xC0 + c, 0x30 | (c % 8));
+		}
+	}
+
+	for (i = 0; i < OPL_CHANNELS; i++)
+		buffers[i] = out[i];
+
+	for (span = 0; span < MIXER_TEST_OPL3_SPANS; span++) {
+		uint32_t r, v, len, bank, pos;
+
+		seed = seed * 1103515245 + 12345;
+		r = seed >> 16;
+		seed = seed * 1103515245 + 12345;
+		v = seed >> 16;
+		bank = (r & 1) ? 0x100 : 0;
+
+		switch ((r >> 1) % 8) {
+		case 0: case 1: /* key on/off, with a new block and frequency */
+			mixer_test_opl3_write(chip, bank + 0xA0 + (r >> 4) % 9, v);
+			mixer_test_opl3_write(chip, bank + 0xB0 + (r >> 4) % 9, (v >> 8) & 0x3F);
+			break;
+		case 2: /* operator registers */
+			mixer_test_opl3_write(chip, bank + op_regs[(r >> 4) % 5] + (r >> 7) % 0x16, v);
+			break;
+		case 3: /* feedback, connection and panning */
+			mixer_test_opl3_write(chip, bank + 0xC0 + (r >> 4) % 9, v);
+			break;
+		case 4: /* rhythm, depth, and the drum keys */
+			mixer_test_opl3_write(chip, 0xBD, v);
+			break;
+		case 5: /* 4-op pairs */
+			mixer_test_opl3_write(chip, 0x104, v & 0x3F);
+			break;
+		default: /* nothing; just let it play for a while */
+			break;
+		}
+
+		seed = seed * 1103515245 + 12345;
+		len = 1 + (seed >> 16) % 512;
+
+		memset(out, 0, sizeof(out));
+		memset(vu_max, 0, sizeof(vu_max));
+
+		for (pos = 0; pos < len; pos += chunk) {
+			uint32_t n = MIN(len - pos, (uint32_t)chunk);
+
+			for (i = 0; i < OPL_CHANNELS; i++)
+				buffers[i] = out[i] + pos * 2;
+
+			ymf262_update_multi(chip, buffers, n, vu_max);
+		}
+
+		for (c = 0; c < OPL_CHANNELS; c++) {
+			for (i = 0; i < len * 2; i++) {
+				hash ^= (uint32_t)out[c][i];
+				hash *= 16777619u;
+			}
+
+			hash ^= vu_max[c];
+			hash *= 16777619u;
+		}
+	}
+
+	ymf262_shutdown(chip);
+
+	return hash;
+}
+
+/* ymf262_update_multi renders in blocks, and skips the channels that can't
+ * be heard; the output has to be exactly what the emulator gave when it
+ * ran the whole chip a sample at a time. The expected hash was taken from
+ * that version, and it can't depend on how the calls are split up. */
+testresult_t test_mixer_opl3_blocks(void)
+{
+	static const int chunks[] = {512, 1, 13, 64, 65, 200};
+	const uint32_t expected = 0x4ACC878Fu;
+	size_t i;
+
+	for (i = 0; i < ARRAY_SIZE(chunks); i++) {
+		uint32_t hash = mixer_test_opl3_render(chunks[i]);
+
+		ASSERT_PRINTF(hash == expected, "got %08" PRIX32 " with %d sample calls, expected %08" PRIX32,
+			hash, chunks[i], expected);
+	}
+
+	RETURN_PASS;
+}
+
+#endif
+
+/* ------------------------------------------------------------------------ */
+
+#define MIXER_TEST_KERNEL_FRAMES 4096
+
+static void mixer_test_kernel_voice(song_voice_t *voice, void *data, uint32_t index, int32_t inc_frac, int32_t frames)
+{
+	const int is16 = index & 1, stereo = index & 2;
+
+	memset(voice, 0, sizeof(*voice));
+
+	/* right in the middle, so that every kernel has room on either side */
+	voice->current_sample_data = (signed char *)data
+		+ (MIXER_TEST_KERNEL_FRAMES / 2) * (is16 ? 2 : 1) * (stereo ? 2 : 1);
+	voice->position = csf_smp_pos(0, 0x12345678);
+	voice->increment = csf_smp_pos_div_whole(csf_smp_pos(inc_frac, 0), 100);
+
+	voice->right_volume = 1900;
+	voice->left_volume = 700;
+
+	voice->right_ramp_volume = 200 << VOLUMERAMPPRECISION;
+	voice->left_ramp_volume = 2000 << VOLUMERAMPPRECISION;
+	voice->right_ramp = (1800 << VOLUMERAMPPRECISION) / frames;
+	voice->left_ramp = -(1900 << VOLUMERAMPPRECISION) / frames;
+
+	/* a resonant lowpass; the poles are well inside the unit circle */
+	voice->filter_a0 = (int32_t)(0.25 * (1 << FILTERPRECISION));
+	voice->filter_b0 = (int32_t)(1.3 * (1 << FILTERPRECISION));
+	voice->filter_b1 = (int32_t)(-0.55 * (1 << FILTERPRECISION));
+	voice->filter_y[0][0] = 3000;
+	voice->filter_y[0][1] = -1200;
+	voice->filter_y[1][0] = -700;
+	voice->filter_y[1][1] = 4100;
+}
+
+/* Every SIMD kernel has to give exactly the same output, and leave the voice
+ * in exactly the same state, as the C one does; and the C kernels, which
+ * work out the positions for a whole block at a time, have to give the same
+ * result as stepping through the span one frame at a time does. */
+testresult_t test_mixer_kernels(void)
+{
+	/* in hundredths; going backwards is what ping-pong loops do */
+	static const int32_t increments[] = {37, 100, 170, 260, -80, -190};
+	static const int32_t lengths[] = {1, 7, 64, 65, 200};
+	static const char *const isa_names[] = {"C", "SSE2", "AVX2"};
+	static int16_t data16[MIXER_TEST_KERNEL_FRAMES * 2];
+	static int8_t data8[MIXER_TEST_KERNEL_FRAMES * 2];
+	static int32_t expected[200 * 2], out[200 * 2];
+	uint32_t seed = 1, index, i, j, f;
+	int isa, tested[ARRAY_SIZE(isa_names)] = {0};
+
+	for (i = 0; i < ARRAY_SIZE(data16); i++) {
+		seed = seed * 1103515245 + 12345;
+		data16[i] = (int16_t)(seed >> 16);
+		data8[i] = (int8_t)(seed >> 24);
+	}
+
+	for (index = 0; index < MIX_KERNEL_COUNT; index++) {
+		void *data = (index & 1) ? (void *)data16 : (void *)data8;
+
+		for (i = 0; i < ARRAY_SIZE(increments); i++) {
+			for (j = 0; j < ARRAY_SIZE(lengths); j++) {
+				const int32_t len = lengths[j];
+				song_voice_t start, reference, voice;
+
+				mixer_test_kernel_voice(&start, data, index, increments[i], len);
+
+				for (f = 0; f < ARRAY_SIZE(expected); f++)
+					expected[f] = (int32_t)(f * 2654435761u) >> 12;
+				memcpy(out, expected, sizeof(out));
+
+				reference = start;
+				csf_mix_kernel(MIX_ISA_C, index, &reference, expected, expected + len * 2);
+
+				voice = start;
+				for (f = 0; f < (uint32_t)len; f++)
+					csf_mix_kernel(MIX_ISA_C, index, &voice, out + f * 2, out + f * 2 + 2);
+
+				ASSERT_PRINTF(!memcmp(out, expected, sizeof(out)) && !memcmp(&voice, &reference, sizeof(voice)),
+					"kernel %#" PRIx32 ": blocked positions differ (increment %" PRId32 ", %" PRId32 " frames)",
+					index, increments[i], len);
+
+				for (isa = MIX_ISA_SSE2; isa < (int)ARRAY_SIZE(isa_names); isa++) {
+					for (f = 0; f < ARRAY_SIZE(out); f++)
+						out[f] = (int32_t)(f * 2654435761u) >> 12;
+
+					voice = start;
+					if (!csf_mix_kernel(isa, index, &voice, out, out + len * 2))
+						continue;
+
+					tested[isa] = 1;
+
+					ASSERT_PRINTF(!memcmp(out, expected, sizeof(out)) && !memcmp(&voice, &reference, sizeof(voice)),
+						"%s kernel %#" PRIx32 " differs (increment %" PRId32 ", %" PRId32 " frames)",
+						isa_names[isa], index, increments[i], len);
+				}
+			}
+		}
+	}
+
+	for (isa = MIX_ISA_SSE2; isa < (int)ARRAY_SIZE(isa_names); isa++)
+		test_log_printf("%s: %s\n", isa_names[isa], tested[isa] ? "compared" : "not supported");
+
+	RETURN_PASS;
+}
+
+/* ------------------------------------------------------------------------ */
+/* exporting */
+
+/* reads a whole file into memory (which is then owned by the caller) */
+static uint8_t *mixer_test_read_file(const char *filename, size_t *length)
+{
+	slurp_t fp;
+	uint8_t *data;
+
+	if (slurp(&fp, filename, NULL, 0) < 0)
+		return NULL;
+
+	*length = slurp_length(&fp);
+	data = malloc(*length ? *length : 1);
+	if (data && slurp_read(&fp, data, *length) != *length) {
+		free(data);
+		data = NULL;
+	}
+
+	unslurp(&fp);
+
+	return data;
+}
+
+/* renders the busy song to a WAV file, and returns what was written */
+static uint8_t *mixer_test_export(uint32_t threads, size_t *length)
+{
+	char tmp[TEST_TEMP_FILE_NAME_LENGTH];
+	song_t *csf;
+	int r;
+
+	if (!test_temp_file(tmp, NULL, 0))
+		return NULL;
+
+	csf = mixer_test_busy_song();
+	r = disko_render_song(csf, tmp, &song_export_formats[0], threads, NULL);
+	csf_free(csf);
+
+	return (r == DW_OK) ? mixer_test_read_file(tmp, length) : NULL;
+}
+
+/* handing the encoding off to another thread must not change the file */
+testresult_t test_mixer_export_pipelined(void)
+{
+	uint8_t *sync, *piped;
+	size_t sync_len = 0, piped_len = 0;
+	testresult_t r = SCHISM_TESTRESULT_PASS;
+
+	REQUIRE(!strcmp(song_export_formats[0].label, "WAV"));
+
+	sync = mixer_test_export(0, &sync_len);
+	piped = mixer_test_export(1, &piped_len);
+
+	if (!sync || !piped || sync_len < 1024) {
+		test_log_printf("export failed\n");
+		r = SCHISM_TESTRESULT_FAIL;
+	} else if (sync_len != piped_len || memcmp(sync, piped, sync_len)) {
+		test_log_printf("pipelined export differs (%" PRIuSZ " vs. %" PRIuSZ " bytes)\n", piped_len, sync_len);
+		r = SCHISM_TESTRESULT_FAIL;
+	}
+
+	free(sync);
+	free(piped);
+
+	return r;
+}
+
+struct mixer_test_multi_export {
+	uint8_t *data[MAX_CHANNELS]; /* NULL for the channels with no file */
+	size_t length[MAX_CHANNELS];
+};
+
+static void mixer_test_multi_free(struct mixer_test_multi_export *out)
+{
+	uint32_t n;
+
+	for (n = 0; n < MAX_CHANNELS; n++)
+		free(out->data[n]);
+}
+
+/* renders the busy song with one WAV file per channel, reads all of them
+ * back in, and deletes them */
+static int mixer_test_multi_export(uint32_t threads, struct mixer_test_multi_export *out)
+{
+	char tmp[TEST_TEMP_FILE_NAME_LENGTH];
+	char template[TEST_TEMP_FILE_NAME_LENGTH + 8];
+	song_t *csf;
+	uint32_t n;
+	int r;
+
+	memset(out, 0, sizeof(*out));
+
+	if (!test_temp_file(tmp, NULL, 0))
+		return 0;
+
+	snprintf(template, sizeof(template), "%s-%%c", tmp);
+
+	csf = mixer_test_busy_song();
+	r = disko_render_song(csf, template, &song_export_formats[1], threads, NULL);
+	csf_free(csf);
+
+	for (n = 0; n < MAX_CHANNELS; n++) {
+		char name[sizeof(template)];
+
+		snprintf(name, sizeof(name), "%s-%02" PRIu32, tmp, n + 1);
+		out->data[n] = mixer_test_read_file(name, &out->length[n]);
+		if (out->data[n])
+			dmoz_path_remove(name);
+	}
+
+	return (r == DW_OK);
+}
+
+/* the multi-write writer threads must not change any of the files, no
+ * matter how many of them there are */
+testresult_t test_mixer_export_multi_threads(void)
+{
+	static const uint32_t threads[] = {1, 3, 4};
+	struct mixer_test_multi_export sync, threaded;
+	uint32_t n, nfiles = 0;
+	size_t i;
+
+	REQUIRE(!strcmp(song_export_formats[1].label, "MWAV"));
+
+	REQUIRE(mixer_test_multi_export(0, &sync));
+
+	for (n = 0; n < MAX_CHANNELS; n++)
+		if (sync.data[n])
+			nfiles++;
+
+	test_log_printf("%" PRIu32 " files\n", nfiles);
+	if (nfiles != MIXER_TEST_CHANNELS) {
+		mixer_test_multi_free(&sync);
+		RETURN_FAIL;
+	}
+
+	for (i = 0; i < ARRAY_SIZE(threads); i++) {
+		int ok = mixer_test_multi_export(threads[i], &threaded);
+
+		for (n = 0; ok && n < MAX_CHANNELS; n++) {
+			if (!sync.data[n] != !threaded.data[n]
+				|| sync.length[n] != threaded.length[n]
+				|| (sync.data[n] && memcmp(sync.data[n], threaded.data[n], sync.length[n]))) {
+				test_log_printf("channel %" PRIu32 " differs with %" PRIu32 " threads\n", n + 1, threads[i]);
+				ok = 0;
+			}
+		}
+
+		mixer_test_multi_free(&threaded);
+
+		if (!ok) {
+			mixer_test_multi_free(&sync);
+			RETURN_FAIL;
+		}
+	}
+
+	mixer_test_multi_free(&sync);
+
+	RETURN_PASS;
+}
+
+#define MIXER_TEST_BATCH_SONGS 3
+
+/* renders every file with song_export_batch, reads the output back in, and
+ * deletes it */
+static int mixer_test_batch_export(char *const *files, int jobs, uint8_t **data, size_t *length)
+{
+	char tmp[TEST_TEMP_FILE_NAME_LENGTH];
+	char template[TEST_TEMP_FILE_NAME_LENGTH + 8];
+	int n, failed;
+
+	if (!test_temp_file(tmp, NULL, 0))
+		return 0;
+
+	snprintf(template, sizeof(template), "%s-%%s", tmp);
+
+	failed = song_export_batch(files, MIXER_TEST_BATCH_SONGS, template, "WAV", jobs);
+
+	for (n = 0; n < MIXER_TEST_BATCH_SONGS; n++) {
+		char name[sizeof(template) + TEST_TEMP_FILE_NAME_LENGTH];
+
+		snprintf(name, sizeof(name), "%s-%s", tmp, files[n]);
+		data[n] = mixer_test_read_file(name, &length[n]);
+		if (data[n])
+			dmoz_path_remove(name);
+	}
+
+	return !failed;
+}
+
+/* Rendering several songs at once (--render-jobs) has to write exactly the
+ * same files as rendering them one after another. The songs are all the
+ * same, so the files all have to match each other too. */
+testresult_t test_mixer_export_batch(void)
+{
+	char files[MIXER_TEST_BATCH_SONGS][TEST_TEMP_FILE_NAME_LENGTH];
+	char *names[MIXER_TEST_BATCH_SONGS];
+	uint8_t *serial[MIXER_TEST_BATCH_SONGS] = {0}, *batch[MIXER_TEST_BATCH_SONGS] = {0};
+	size_t serial_len[MIXER_TEST_BATCH_SONGS], batch_len[MIXER_TEST_BATCH_SONGS];
+	song_t *csf = mixer_test_busy_song();
+	disko_t ds;
+	int n, ok;
+
+	REQUIRE(!strcmp(song_save_formats[0].label, "IT"));
+	REQUIRE(disko_memopen(&ds) >= 0);
+
+	ok = (song_save_formats[0].f.save_song(&ds, csf) == SAVE_SUCCESS);
+	csf_free(csf);
+
+	for (n = 0; ok && n < MIXER_TEST_BATCH_SONGS; n++) {
+		ok = test_temp_file(files[n], (const char *)ds.data, ds.length);
+		names[n] = files[n];
+	}
+
+	disko_memclose(&ds, 0);
+	REQUIRE(ok);
+
+	ok = mixer_test_batch_export(names, 1, serial, serial_len)
+		&& mixer_test_batch_export(names, MIXER_TEST_BATCH_SONGS, batch, batch_len);
+
+	for (n = 0; ok && n < MIXER_TEST_BATCH_SONGS; n++) {
+		if (!serial[n] || !batch[n] || serial_len[n] < 1024) {
+			test_log_printf("song %d wasn't written\n", n);
+			ok = 0;
+		} else if (serial_len[n] != batch_len[n] || memcmp(serial[n], batch[n], serial_len[n])) {
+			test_log_printf("song %d differs with %d jobs\n", n, MIXER_TEST_BATCH_SONGS);
+			ok = 0;
+		} else if (serial_len[n] != serial_len[0] || memcmp(serial[n], serial[0], serial_len[0])) {
+			test_log_printf("song %d differs from song 0\n", n);
+			ok = 0;
+		}
+	}
+
+	for (n = 0; n < MIXER_TEST_BATCH_SONGS; n++) {
+		free(serial[n]);
+		free(batch[n]);
+	}
+
+	ASSERT(ok);
+
+	RETURN_PASS;
+}
@@ -0,0 +1,93 @@
+/*
+ * Schism Tracker - a cross-platform Impulse Tracker clone
+ * copyright (c) 2003-2005 Storlek <storlek@rigelseven.com>
+ * copyright (c) 2005-2008 Mrs. Brisby <mrs.brisby@nimh.org>
+ * copyright (c) 2009 Storlek & Mrs. Brisby
+ * copyright (c) 2010-2012 Storlek
+ * URL: http://schismtracker.org/
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "headers.h"
+#include "test.h"
+#include "test-assertions.h"
+
+#include "timer.h"
+#include "atomic.h"
+#include "mem.h"
+
+#define ONESHOT_COUNT 100000
+
+struct oneshot_test {
+	timer_ticks_t trigger;
+	struct atm *fired;
+	struct atm *early;
+};
+
+static void oneshot_test_callback(void *param)
+{
+	struct oneshot_test *t = param;
+
+	if (timer_ticks_us() < t->trigger)
+		atm_inc(t->early);
+
+	atm_inc(t->fired);
+}
+
+/* Pushes lots of timers at once (e.g. a MIDI dump with no driver-side
+ * scheduling) and makes sure they all get called, and none of them early. */
+testresult_t test_timer_oneshot_many(void)
+{
+	struct oneshot_test *tests = mem_alloc(ONESHOT_COUNT * sizeof(*tests));
+	struct atm fired, early;
+	timer_ticks_t start, pushed, deadline;
+	uint32_t i;
+
+	atm_store(&fired, 0);
+	atm_store(&early, 0);
+
+	start = timer_ticks_us();
+
+	for (i = 0; i < ONESHOT_COUNT; i++) {
+		/* scatter the delays so the queue has to do some sorting */
+		uint32_t ms = (i * 7919) % 50;
+
+		tests[i].trigger = timer_ticks_us() + ms * UINT64_C(1000);
+		tests[i].fired = &fired;
+		tests[i].early = &early;
+
+		timer_oneshot(ms, oneshot_test_callback, &tests[i]);
+	}
+
+	pushed = timer_ticks_us();
+	deadline = pushed + UINT64_C(10000000);
+
+	while (atm_load(&fired) < ONESHOT_COUNT && timer_ticks_us() < deadline) {
+		timer_oneshot_worker();
+		timer_msleep(1);
+	}
+
+	test_log_printf("pushed %d oneshots in %" PRIu64 " us, all called after %" PRIu64 " us\n",
+		ONESHOT_COUNT, (uint64_t)(pushed - start), (uint64_t)(timer_ticks_us() - start));
+
+	ASSERT_PRINTF(atm_load(&fired) == ONESHOT_COUNT, "only %d of %d oneshots were called",
+		(int)atm_load(&fired), ONESHOT_COUNT);
+	ASSERT_PRINTF(atm_load(&early) == 0, "%d oneshots were called early", (int)atm_load(&early));
+
+	free(tests);
+
+	RETURN_PASS;
+}
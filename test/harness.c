@@ -31,6 +31,8 @@
 #include "str.h"
 #include "mt.h"
 #include "atomic.h"
+#include "cpu.h"
+#include "player/snd_fm.h"
 
 /* these are no-ops now  --paper */
 #define result_to_exit_code(x) (x)
@@ -101,6 +103,8 @@ int schism_test_main(int argc, char **argv)
 	atm_init();
 	SCHISM_RUNTIME_ASSERT(timer_init(), "need timers");
 	SCHISM_RUNTIME_ASSERT(localtime_r_init(), "need localtime_r");
+	SCHISM_RUNTIME_ASSERT(!Fmdrv_InitLock(), "need the OPL table mutex");
+	cpu_init(); /* so the SIMD code paths get tested too */
 
 	if (argc > 1) {
 		char *test_case_name = argv[1];
@@ -177,6 +181,7 @@ int schism_test_main(int argc, char **argv)
 
 	free(filter_expression);
 
+	Fmdrv_QuitLock();
 	localtime_r_quit();
 	/* weird, these cause a hang on macosx  --paper
 	 * Seems to work fine now (???) */